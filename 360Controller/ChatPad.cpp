@@ -54,21 +54,23 @@ IOReturn ChatPadKeyboardClass::getReport(IOMemoryDescriptor *report, IOHIDReport
     return kIOReturnUnsupported;
 }
 
+// Serial packets carry the pressed keys every time, so only changes are reported
 IOReturn ChatPadKeyboardClass::handleReport(IOMemoryDescriptor *report, IOHIDReportType reportType, IOOptionBits options)
 {
 	IOBufferMemoryDescriptor *realReport = OSDynamicCast(IOBufferMemoryDescriptor, report);
-	if (realReport != NULL)
-	{
-		unsigned char *data = (unsigned char*)realReport->getBytesNoCopy();
-		if (data[0] == 0x00)
-		{
-			for (int i = 2; i < 5; i++)
-			{
-				data[i] = ChatPad2USB(data[i]);
-			}
-		}
-	}
-	return IOHIDDevice::handleReport(report, reportType, options);
+	if ((realReport == NULL) || (keyReport == NULL) || (realReport->getLength() < 5))
+		return kIOReturnBadArgument;
+
+	const unsigned char *data = (const unsigned char*)realReport->getBytesNoCopy();
+	if (data[0] != 0x00)
+		return kIOReturnSuccess;
+	if (!ChatPadUpdateKeys(&keyState, data[1], data + 2, 3))
+		return kIOReturnSuccess;
+
+	unsigned char *out = (unsigned char*)keyReport->getBytesNoCopy();
+	out[0] = 0x00;
+	memcpy(out + 1, &keyState, sizeof(keyState));
+	return IOHIDDevice::handleReport(keyReport, reportType, options);
 }
 
 OSNumber* ChatPadKeyboardClass::newPrimaryUsageNumber() const
@@ -115,11 +117,26 @@ static IOHIDDevice* GetParent(const IOService *current)
 
 bool ChatPadKeyboardClass::start(IOService *provider)
 {
+    // Constant byte, then modifiers and the key bitmap
+    keyReport = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, 1 + sizeof(CHATPAD_KEYS));
+    if (keyReport == NULL)
+        return false;
+    bzero(&keyState, sizeof(keyState));
     if (!IOHIDDevice::start(provider))
         return false;
     return OSDynamicCast(Xbox360Peripheral, provider) != NULL;
 }
 
+void ChatPadKeyboardClass::free(void)
+{
+    if (keyReport != NULL)
+    {
+        keyReport->release();
+        keyReport = NULL;
+    }
+    IOHIDDevice::free();
+}
+
 OSString* ChatPadKeyboardClass::newManufacturerString() const
 {
 	IOHIDDevice *device = GetParent(this);
@@ -22,15 +22,19 @@
  */
 
 #include <IOKit/hid/IOHIDDevice.h>
+#include "chatpadkeys.h"
 
 class ChatPadKeyboardClass : public IOHIDDevice
 {
 	OSDeclareDefaultStructors(ChatPadKeyboardClass)
 
 private:
+    CHATPAD_KEYS keyState;
+    IOBufferMemoryDescriptor *keyReport;
 
 public:
     virtual bool start(IOService *provider);
+    virtual void free(void);
 
     // IOHidDevice methods
     virtual IOReturn newReportDescriptor(IOMemoryDescriptor **descriptor) const;
@@ -28,6 +28,7 @@ namespace HID_360 {
 #include "xbox360hid.h"
 }
 #include "_60Controller.h"
+#include "xboxone.h"
 
 #pragma mark - Xbox360ControllerClass
 
@@ -80,6 +81,34 @@ IOReturn Xbox360ControllerClass::newReportDescriptor(IOMemoryDescriptor **descri
     return kIOReturnSuccess;
 }
 
+// Track clients, so reports can be left unprocessed while nobody is listening
+bool Xbox360ControllerClass::handleOpen(IOService *client, IOOptionBits options, void *argument)
+{
+    bool wasOpen = handleIsOpen(client);
+    Xbox360Peripheral *owner;
+
+    if (!IOHIDDevice::handleOpen(client, options, argument))
+        return false;
+    if (!wasOpen)
+        clientCount++;
+    owner = GetOwner(this);
+    if (owner != NULL)
+    {
+        owner->IdleWake();
+        owner->FlushLatestReport();
+    }
+    return true;
+}
+
+void Xbox360ControllerClass::handleClose(IOService *client, IOOptionBits options)
+{
+    bool wasOpen = handleIsOpen(client);
+
+    IOHIDDevice::handleClose(client, options);
+    if (wasOpen && (clientCount > 0))
+        clientCount--;
+}
+
 // Handles a message from the userspace IOHIDDeviceInterface122::setReport function
 IOReturn Xbox360ControllerClass::setReport(IOMemoryDescriptor *report,IOHIDReportType reportType,IOOptionBits options)
 {
@@ -123,8 +152,11 @@ IOReturn Xbox360ControllerClass::setReport(IOMemoryDescriptor *report,IOHIDRepor
 // Get report
 IOReturn Xbox360ControllerClass::getReport(IOMemoryDescriptor *report,IOHIDReportType reportType,IOOptionBits options)
 {
-    // Doesn't do anything yet ;)
-    return kIOReturnUnsupported;
+    Xbox360Peripheral *owner = GetOwner(this);
+
+    if ((reportType != kIOHIDReportTypeInput) || (owner == NULL))
+        return kIOReturnUnsupported;
+    return owner->CopyLatestReport(report);
 }
 
 IOReturn Xbox360ControllerClass::handleReport(IOMemoryDescriptor * descriptor, IOHIDReportType reportType, IOOptionBits options) {
@@ -427,47 +459,6 @@ IOReturn XboxOriginalControllerClass::setReport(IOMemoryDescriptor *report,IOHID
  * Does not pretend to be an Xbox 360 controller.
  */
 
-typedef struct {
-    UInt8 command;
-    UInt8 reserved1;
-    UInt8 counter;
-    UInt8 size;
-} PACKED XBOXONE_HEADER;
-
-typedef struct {
-    XBOXONE_HEADER header;
-    UInt16 buttons;
-    UInt16 trigL, trigR;
-    XBOX360_HAT left, right;
-} PACKED XBOXONE_IN_REPORT;
-
-typedef struct {
-    XBOXONE_HEADER header;
-    UInt16 buttons;
-    UInt16 trigL, trigR;
-    XBOX360_HAT left, right;
-    UInt8 unknown1[6];
-    UInt8 triggersAsButtons; // 0x40 is RT. 0x80 is LT
-    UInt8 unknown2[7];
-} PACKED XBOXONE_IN_FIGHTSTICK_REPORT;
-
-typedef struct {
-    XBOXONE_HEADER header;
-    UInt16 buttons;
-    UInt16 trigL, trigR;
-    XBOX360_HAT left, right;
-    UInt16 true_buttons;
-    UInt16 true_trigL, true_trigR;
-    XBOX360_HAT true_left, true_right;
-    UInt8 paddle;
-} PACKED XBOXONE_ELITE_IN_REPORT;
-
-typedef struct {
-    XBOXONE_HEADER header;
-    UInt8 state;
-    UInt8 dummy;
-} PACKED XBOXONE_IN_GUIDE_REPORT;
-
 typedef struct {
     XBOXONE_HEADER header;
     UInt8 mode; // So far always 0x00
@@ -514,56 +505,12 @@ OSString* XboxOneControllerClass::newProductString() const
 
 UInt16 XboxOneControllerClass::convertButtonPacket(UInt16 buttons)
 {
-    UInt16 new_buttons = 0;
-
-    new_buttons |= ((buttons & 4) == 4) << 4;
-    new_buttons |= ((buttons & 8) == 8) << 5;
-    new_buttons |= ((buttons & 16) == 16) << 12;
-    new_buttons |= ((buttons & 32) == 32) << 13;
-    new_buttons |= ((buttons & 64) == 64) << 14;
-    new_buttons |= ((buttons & 128) == 128) << 15;
-    new_buttons |= ((buttons & 256) == 256) << 0;
-    new_buttons |= ((buttons & 512) == 512) << 1;
-    new_buttons |= ((buttons & 1024) == 1024) << 2;
-    new_buttons |= ((buttons & 2048) == 2048) << 3;
-    new_buttons |= ((buttons & 4096) == 4096) << 8;
-    new_buttons |= ((buttons & 8192) == 8192) << 9;
-    new_buttons |= ((buttons & 16384) == 16384) << 6;
-    new_buttons |= ((buttons & 32768) == 32768) << 7;
-
-    new_buttons |= (isXboxOneGuideButtonPressed) << 10;
-
-    return new_buttons;
+    return XboxOne_ConvertButtons(buttons, isXboxOneGuideButtonPressed);
 }
 
 void XboxOneControllerClass::convertFromXboxOne(void *buffer, UInt8 packetSize)
 {
-    XBOXONE_ELITE_IN_REPORT *reportXone = (XBOXONE_ELITE_IN_REPORT*)buffer;
-    XBOX360_IN_REPORT *report360 = (XBOX360_IN_REPORT*)buffer;
-    UInt8 trigL = 0, trigR = 0;
-    XBOX360_HAT left, right;
-
-    report360->header.command = 0x00;
-    report360->header.size = 0x14;
-
-    if (packetSize == 0x1a) // Fight Stick
-    {
-        if ((0x80 & reportXone->true_trigR) == 0x80) { trigL = 255; }
-        if ((0x40 & reportXone->true_trigR) == 0x40) { trigR = 255; }
-    }
-    else
-    {
-        trigL = (reportXone->trigL / 1023.0) * 255;
-        trigR = (reportXone->trigR / 1023.0) * 255;
-    }
-    left = reportXone->left;
-    right = reportXone->right;
-
-    report360->buttons = convertButtonPacket(reportXone->buttons);
-    report360->trigL = trigL;
-    report360->trigR = trigR;
-    report360->left = left;
-    report360->right = right;
+    XboxOne_ConvertReport(buffer, packetSize, isXboxOneGuideButtonPressed);
 }
 
 IOReturn XboxOneControllerClass::handleReport(IOMemoryDescriptor * descriptor, IOHIDReportType reportType, IOOptionBits options)
@@ -582,7 +529,7 @@ IOReturn XboxOneControllerClass::handleReport(IOMemoryDescriptor * descriptor, I
             }
             else if (report->header.command==0x20)
             {
-                if (report->header.size==0x0e || report->header.size==0x1d || report->header.size==0x1a)
+                if (report->header.size==XBOXONE_SIZE_PAD || report->header.size==XBOXONE_SIZE_ELITE || report->header.size==XBOXONE_SIZE_FIGHTSTICK)
                 {
                     convertFromXboxOne(report, report->header.size);
                     XBOX360_IN_REPORT *report360=(XBOX360_IN_REPORT*)report;
@@ -29,6 +29,7 @@ class Xbox360ControllerClass : public IOHIDDevice
 
 private:
     bool pretend360;
+    UInt32 clientCount;
 
 private:
     OSString* getDeviceString(UInt8 index,const char *def=NULL) const;
@@ -40,6 +41,10 @@ public:
 
     virtual IOReturn newReportDescriptor(IOMemoryDescriptor **descriptor) const;
 
+    virtual bool handleOpen(IOService *client, IOOptionBits options, void *argument);
+    virtual void handleClose(IOService *client, IOOptionBits options);
+    bool hasClients(void) const { return clientCount != 0; }
+
     virtual IOReturn setReport(IOMemoryDescriptor *report,IOHIDReportType reportType,IOOptionBits options=0);
     virtual IOReturn getReport(IOMemoryDescriptor *report,IOHIDReportType reportType,IOOptionBits options);
     virtual IOReturn handleReport(
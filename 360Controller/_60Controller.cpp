@@ -24,6 +24,7 @@
 #include <IOKit/IOLib.h>
 #include <IOKit/IOMessage.h>
 #include <IOKit/IOTimerEventSource.h>
+#include <kern/clock.h>
 #include "_60Controller.h"
 #include "ChatPad.h"
 #include "Controller.h"
@@ -32,6 +33,35 @@
 
 #define kIOSerialDeviceType   "Serial360Device"
 
+#define kReadStallsKey          "ReadStalls"
+#define kReadRetriesKey         "ReadRetries"
+#define kReadRecoveriesKey      "ReadRecoveries"
+#define kIdleResumeLatencyKey   "IdleResumeLatency"
+
+// Failed reads are retried after 2, 4, 8... ms, up to half a second
+#define READ_RETRY_BASE_MS      2
+#define READ_RETRY_MAX_MS       500
+#define READ_RETRY_MAX_ATTEMPTS 12
+
+// Longest idle suspend timeout in seconds, so it still fits in milliseconds
+#define IDLE_TIMEOUT_MAX        (0xffffffffU / 1000)
+
+// Devices (VID << 16 | PID) that failed chatpad negotiation since the driver loaded.
+// A stall or an unsupported request says there's no chatpad straight away, other
+// errors only after a few attaches in a row. Either way the model is skipped for
+// a few attaches, then tried again.
+#define CHATPAD_CACHE_SIZE      16
+#define CHATPAD_MISSING_FAILURES 3
+#define CHATPAD_MISSING_SKIPS   4
+
+typedef struct CHATPAD_CACHE_ENTRY {
+    volatile UInt32 key;
+    volatile SInt32 failures;       // Attaches in a row that failed to negotiate
+    volatile SInt32 skips;          // Attaches left that skip the chatpad
+} CHATPAD_CACHE_ENTRY;
+
+static CHATPAD_CACHE_ENTRY chatpadCache[CHATPAD_CACHE_SIZE];
+
 OSDefineMetaClassAndStructors(Xbox360Peripheral, IOService)
 #define super IOService
 
@@ -51,6 +81,54 @@ public:
     }
 };
 
+static UInt32 ChatPadCacheKey(IOUSBDevice *device)
+{
+    return ((UInt32)device->GetVendorID() << 16) | device->GetProductID();
+}
+
+static CHATPAD_CACHE_ENTRY* ChatPadCacheFind(UInt32 key, bool create)
+{
+    for (int i = 0; i < CHATPAD_CACHE_SIZE; i++)
+    {
+        if (chatpadCache[i].key == key)
+            return &chatpadCache[i];
+        if (create && OSCompareAndSwap(0, key, &chatpadCache[i].key))
+            return &chatpadCache[i];
+    }
+    // Full - the device will just be negotiated with every time
+    return NULL;
+}
+
+// Uses up one of the model's skips, if it has any left
+static bool ChatPadSkip(UInt32 key)
+{
+    CHATPAD_CACHE_ENTRY *entry = ChatPadCacheFind(key, false);
+
+    if ((entry == NULL) || (entry->skips <= 0))
+        return false;
+    OSDecrementAtomic(&entry->skips);
+    return true;
+}
+
+static void ChatPadRecord(UInt32 key, IOReturn status)
+{
+    CHATPAD_CACHE_ENTRY *entry = ChatPadCacheFind(key, status != kIOReturnSuccess);
+
+    if (entry == NULL)
+        return;
+    if (status == kIOReturnSuccess)
+    {
+        entry->failures = 0;
+        return;
+    }
+    if ((status == kIOUSBPipeStalled) || (status == kIOReturnUnsupported) ||
+        (OSIncrementAtomic(&entry->failures) + 1 >= CHATPAD_MISSING_FAILURES))
+    {
+        entry->failures = 0;
+        entry->skips = CHATPAD_MISSING_SKIPS;
+    }
+}
+
 // Find the maximum packet size of this pipe
 static UInt32 GetMaxPacketSize(IOUSBPipe *pipe)
 {
@@ -60,160 +138,243 @@ static UInt32 GetMaxPacketSize(IOUSBPipe *pipe)
     else return ed->wMaxPacketSize;
 }
 
-void Xbox360Peripheral::SendSpecial(UInt16 value)
+// Queues a request for the default pipe. Requests go out one at a time, in order,
+// and the handler is called from the completion
+bool Xbox360Peripheral::QueueControl(UInt8 requestType, UInt8 request, UInt16 value, UInt16 index,
+                                     const void *data, UInt16 length, ControlHandler handler)
 {
-    IOUSBDevRequest controlReq;
+    CONTROL_REQUEST *entry;
+    bool start;
 
-    controlReq.bmRequestType = USBmakebmRequestType(kUSBOut, kUSBVendor, kUSBInterface);
-    controlReq.bRequest = 0x00;
-    controlReq.wValue = value;
-    controlReq.wIndex = 0x0002;
-    controlReq.wLength = 0;
-    controlReq.pData = NULL;
-    if (device->DeviceRequest(&controlReq, 100, 100, NULL) != kIOReturnSuccess)
-        IOLog("Failed to send special message %.4x\n", value);
+    if (length > sizeof(entry->data))
+        return false;
+    IOLockLock(controlLock);
+    if (controlStopping || (controlCount == CONTROL_QUEUE_SIZE))
+    {
+        IOLockUnlock(controlLock);
+        return false;
+    }
+    entry = &controlQueue[(controlHead + controlCount) % CONTROL_QUEUE_SIZE];
+    entry->request.bmRequestType = requestType;
+    entry->request.bRequest = request;
+    entry->request.wValue = value;
+    entry->request.wIndex = index;
+    entry->request.wLength = length;
+    entry->request.pData = (length != 0) ? entry->data : NULL;
+    if (data != NULL)
+        memcpy(entry->data, data, length);
+    entry->handler = handler;
+    controlCount++;
+    start = (controlCount == 1);
+    IOLockUnlock(controlLock);
+    if (start)
+        StartControl();
+    return true;
 }
 
-void Xbox360Peripheral::SendInit(UInt16 value, UInt16 index)
+// Sends the request at the head of the queue
+void Xbox360Peripheral::StartControl(void)
 {
-    IOUSBDevRequest controlReq;
+    IOUSBCompletion complete;
+    IOUSBDevRequest *request;
+    IOReturn err;
 
-    controlReq.bmRequestType = USBmakebmRequestType(kUSBOut, kUSBVendor, kUSBDevice);
-    controlReq.bRequest = 0xa9;
-    controlReq.wValue = value;
-    controlReq.wIndex = index;
-    controlReq.wLength = 0;
-    controlReq.pData = NULL;
-    device->DeviceRequest(&controlReq, 100, 100, NULL);	// Will fail - but device should still act on it
+    IOLockLock(controlLock);
+    request = &controlQueue[controlHead].request;
+    IOLockUnlock(controlLock);
+    complete.target = this;
+    complete.action = ControlCompleteInternal;
+    complete.parameter = NULL;
+    err = device->DeviceRequest(request, 100, 100, &complete);
+    if (err != kIOReturnSuccess)
+        ControlComplete(NULL, err, 0);
 }
 
-bool Xbox360Peripheral::SendSwitch(bool sendOut)
+void Xbox360Peripheral::ControlCompleteInternal(void *target, void *parameter, IOReturn status, UInt32 bufferSizeRemaining)
 {
-    IOUSBDevRequest controlReq;
+    if (target != NULL)
+        ((Xbox360Peripheral*)target)->ControlComplete(parameter, status, bufferSizeRemaining);
+}
 
-    controlReq.bmRequestType = USBmakebmRequestType(sendOut ? kUSBOut : kUSBIn, kUSBVendor, kUSBDevice);
-    controlReq.bRequest = 0xa1;
-    controlReq.wValue = 0x0000;
-    controlReq.wIndex = 0xe416;
-    controlReq.wLength = sizeof(chatpadInit);
-    controlReq.pData = chatpadInit;
-    IOReturn err = device->DeviceRequest(&controlReq, 100, 100, NULL);
+void Xbox360Peripheral::ControlComplete(void *parameter, IOReturn status, UInt32 bufferSizeRemaining)
+{
+    CONTROL_REQUEST *entry;
+    bool stopping, more;
+
+    IOLockLock(controlLock);
+    entry = &controlQueue[controlHead];
+    stopping = controlStopping;
+    IOLockUnlock(controlLock);
+    // The entry stays at the head (and ReleaseAll keeps waiting) until the handler is done
+    if (!stopping && (entry->handler != NULL))
+        (this->*entry->handler)(status, entry->data);
+    IOLockLock(controlLock);
+    controlHead = (controlHead + 1) % CONTROL_QUEUE_SIZE;
+    controlCount--;
+    if (controlStopping)
+        controlCount = 0;
+    more = (controlCount != 0);
+    if (!more)
+        IOLockWakeup(controlLock, &controlCount, false);
+    IOLockUnlock(controlLock);
+    if (more)
+        StartControl();
+}
+
+// Waits for the request in flight, and drops the rest
+void Xbox360Peripheral::StopControl(void)
+{
+    IOLockLock(controlLock);
+    controlStopping = true;
+    while (controlCount != 0)
+        IOLockSleep(controlLock, &controlCount, THREAD_UNINT);
+    IOLockUnlock(controlLock);
+}
+
+bool Xbox360Peripheral::SendSpecial(UInt16 value, ControlHandler handler)
+{
+    return QueueControl(USBmakebmRequestType(kUSBOut, kUSBVendor, kUSBInterface), 0x00, value, 0x0002, NULL, 0, handler);
+}
+
+void Xbox360Peripheral::SendInit(UInt16 value, UInt16 index)
+{
+    // Will fail - but device should still act on it
+    QueueControl(USBmakebmRequestType(kUSBOut, kUSBVendor, kUSBDevice), 0xa9, value, index, NULL, 0, NULL);
+}
+
+bool Xbox360Peripheral::SendSwitch(bool sendOut, ControlHandler handler)
+{
+    return QueueControl(USBmakebmRequestType(sendOut ? kUSBOut : kUSBIn, kUSBVendor, kUSBDevice), 0xa1, 0x0000, 0xe416,
+                        chatpadInit, sizeof(chatpadInit), handler);
+}
+
+bool Xbox360Peripheral::ChatPadSwitchFailed(bool sendOut, IOReturn err)
+{
     if (err == kIOReturnSuccess)
-        return true;
+        return false;
 
     const char *errStr = device->stringFromReturn(err);
     IOLog("start - failed to %s chatpad setting (%x): %s\n",
           sendOut ? "write" : "read", err, errStr);
-    return false;
+    ChatPadNegotiated(err);
+    return true;
 }
 
-void Xbox360Peripheral::SendToggle(void)
+// Negotiation runs on control completions once the pad is up:
+// configure, then read, write back and read again the 'switch'
+void Xbox360Peripheral::ChatPadNegotiate(void)
 {
-    SendSpecial(serialToggle ? 0x1F : 0x1E);
-    serialToggle = !serialToggle;
+    // Send 'configuration'
+    SendInit(0xa30c, 0x4423);
+    SendInit(0x2344, 0x7f03);
+    SendInit(0x5839, 0x6832);
+    // Set 'switch'
+    if (!SendSwitch(false, &Xbox360Peripheral::ChatPadSwitchRead))
+        ChatPadNegotiated(kIOReturnNoResources);
 }
 
-void Xbox360Peripheral::ChatPadTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender)
+void Xbox360Peripheral::ChatPadSwitchRead(IOReturn status, const UInt8 *data)
 {
-    Xbox360Peripheral *controller;
+    if (ChatPadSwitchFailed(false, status))
+        return;
+    memcpy(chatpadInit, data, sizeof(chatpadInit));
+    if (!SendSwitch(true, &Xbox360Peripheral::ChatPadSwitchWritten))
+        ChatPadNegotiated(kIOReturnNoResources);
+}
 
-    controller = OSDynamicCast(Xbox360Peripheral, owner);
-    controller->ChatPadTimerAction(sender);
+void Xbox360Peripheral::ChatPadSwitchWritten(IOReturn status, const UInt8 *data)
+{
+    if (ChatPadSwitchFailed(true, status))
+        return;
+    if (!SendSwitch(false, &Xbox360Peripheral::ChatPadSwitchConfirmed))
+        ChatPadNegotiated(kIOReturnNoResources);
 }
 
-void Xbox360Peripheral::ChatPadTimerAction(IOTimerEventSource *sender)
+void Xbox360Peripheral::ChatPadSwitchConfirmed(IOReturn status, const UInt8 *data)
 {
-    int nextTime, serialGot;
+    if (ChatPadSwitchFailed(false, status))
+        return;
+    memcpy(chatpadInit, data, sizeof(chatpadInit));
+    ChatPadNegotiated(kIOReturnSuccess);
+}
 
-    serialGot = 0;
-    nextTime = 1000;
-    switch (serialTimerState)
-    {
-        case tsToggle:
-            SendToggle();
-            if (serialActive)
-            {
-                if (!serialHeard)
-                {
-                    serialActive = false;
-                    serialGot = 2;
-                }
-            }
-            else
-            {
-                if (serialHeard)
-                {
-                    serialTimerState = tsReset1;
-                    serialResetCount = 0;
-                    nextTime = 40;
-                }
-            }
-            break;
+// The keepalive starts whether or not the switch went through, as it always has
+void Xbox360Peripheral::ChatPadNegotiated(IOReturn status)
+{
+    LockRequired locker(mainLock);
 
-        case tsMiniToggle:
-            SendToggle();
-            if (serialHeard)
-            {
-                serialTimerState = tsSet1;
-                nextTime = 40;
-            }
-            else
-            {
-                serialResetCount++;
-                if (serialResetCount > 3)
-                {
-                    serialTimerState = tsToggle;
-                }
-                else
-                {
-                    serialTimerState = tsReset1;
-                    nextTime = 40;
-                }
-            }
-            break;
+    // Pads without a chatpad, such as the Hori Real Arcade Pro EX, fail here
+    if (device != NULL)
+        ChatPadRecord(ChatPadCacheKey(device), status);
+    if (isInactive() || (serialTimer == NULL))
+        return;
+    chatpadReady = true;
+    // Begin toggle
+    serialHeard = false;
+    serialHandshake.reset();
+    ChatPadRestart();
+    // Begin reading
+    if (!idleSuspended && !QueueSerialRead())
+        ScheduleReadRecovery(true);
+}
 
-        case tsReset1:
-            SendSpecial(0x1B);
-            serialTimerState = tsReset2;
-            nextTime = 35;
-            break;
+// Arms the timer for the next step once the step's request is done, so the
+// work loop never waits on the device
+void Xbox360Peripheral::ChatPadStepComplete(IOReturn status, const UInt8 *data)
+{
+    if (status != kIOReturnSuccess)
+        IOLog("Failed to send special message (0x%.8x)\n", status);
+    if ((serialTimer != NULL) && !idleSuspended)
+        serialTimer->wakeAtTime(serialDeadline);
+}
 
-        case tsReset2:
-            SendSpecial(0x1B);
-            serialTimerState = tsMiniToggle;
-            nextTime = 150;
-            break;
+void Xbox360Peripheral::ChatPadTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender)
+{
+    Xbox360Peripheral *controller;
 
-        case tsSet1:
-            SendSpecial(0x18);
-            serialTimerState = tsSet2;
-            nextTime = 10;
-            break;
+    controller = OSDynamicCast(Xbox360Peripheral, owner);
+    controller->ChatPadTimerAction(sender);
+}
 
-        case tsSet2:
-            SendSpecial(0x10);
-            serialTimerState = tsSet3;
-            nextTime = 10;
-            break;
+// Moves the deadline on from the last one, rather than from now, so time
+// spent sending doesn't add up
+void Xbox360Peripheral::ChatPadSchedule(UInt32 delay)
+{
+    UInt64 now, interval;
+
+    clock_get_uptime(&now);
+    nanoseconds_to_absolutetime((UInt64)delay * 1000000ULL, &interval);
+    // Start again from now if we've fallen a whole step behind
+    if ((serialDeadline == 0) || ((serialDeadline + interval) < now))
+        serialDeadline = now;
+    serialDeadline += interval;
+}
 
-        case tsSet3:
-            SendSpecial(0x03);
-            serialTimerState = tsToggle;
-            nextTime = 940;
-            serialActive = true;
-            serialGot = 1;
-            break;
-    }
-    sender->setTimeoutMS(nextTime);	// Todo: Make it take into account function execution time?
+// Starts the keepalive from the top, a toggle period from now
+void Xbox360Peripheral::ChatPadRestart(void)
+{
+    serialDeadline = 0;
+    ChatPadSchedule(serialHandshake.startDelay());
+    serialTimer->wakeAtTime(serialDeadline);
+}
+
+void Xbox360Peripheral::ChatPadTimerAction(IOTimerEventSource *sender)
+{
+    ChatPadHandshake::ACTION action = serialHandshake.step(serialHeard);
+
+    ChatPadSchedule(action.delay);
+    // The timer is set again when the request completes
+    if (!action.send || !SendSpecial(action.command, &Xbox360Peripheral::ChatPadStepComplete))
+        sender->wakeAtTime(serialDeadline);
     serialHeard = false;
-    // Make it happen after the timer's set, for minimum impact
-    switch (serialGot)
+    // Make it happen after the request's queued, for minimum impact
+    switch (action.event)
     {
-        case 1:
+        case ChatPadHandshake::evConnected:
             SerialConnect();
             break;
 
-        case 2:
+        case ChatPadHandshake::evDisconnected:
             SerialDisconnect();
             break;
 
@@ -287,6 +448,9 @@ void Xbox360Peripheral::readSettings(void)
     if (value != NULL) swapSticks = value->getValue();
     value = OSDynamicCast(OSBoolean, dataDictionary->getObject("Pretend360"));
     if (value != NULL) pretend360 = value->getValue();
+    number = OSDynamicCast(OSNumber, dataDictionary->getObject("IdleSuspendTimeout"));
+    if (number != NULL) idleTimeout = number->unsigned32BitValue();
+    if (idleTimeout > IDLE_TIMEOUT_MAX) idleTimeout = IDLE_TIMEOUT_MAX;
 
 #if 0
     IOLog("Xbox360Peripheral preferences loaded:\n  invertLeft X: %s, Y: %s\n   invertRight X: %s, Y:%s\n  deadzone Left: %d, Right: %d\n\n",
@@ -301,17 +465,40 @@ bool Xbox360Peripheral::init(OSDictionary *propTable)
 {
     bool res=super::init(propTable);
     mainLock = IOLockAlloc();
+    controlLock = IOLockAlloc();
     device=NULL;
     interface=NULL;
     inPipe=NULL;
     outPipe=NULL;
     inBuffer=NULL;
+    latestReport=NULL;
+    latestReportRaw=false;
     padHandler = NULL;
     serialIn = NULL;
     serialInPipe = NULL;
     serialInBuffer = NULL;
     serialTimer = NULL;
     serialHandler = NULL;
+    chatpadReady = false;
+    serialDeadline = 0;
+    serialHandshake.reset();
+    controlHead = 0;
+    controlCount = 0;
+    controlStopping = false;
+    padRecovery.timer = NULL;
+    padRecovery.stalled = false;
+    padRecovery.attempts = 0;
+    serialRecovery = padRecovery;
+    readStallCount = 0;
+    readRetryCount = 0;
+    readRecoveryCount = 0;
+    idleTimer = NULL;
+    idleTimeout = 0;
+    idleActivity = false;
+    idleSuspended = false;
+    idleResumePending = false;
+    idleResumeStart = 0;
+    bzero(idleSnapshot, sizeof(idleSnapshot));
     // Default settings
     invertLeftX=invertLeftY=false;
     invertRightX=invertRightY=false;
@@ -340,6 +527,7 @@ bool Xbox360Peripheral::init(OSDictionary *propTable)
 // Free the extension
 void Xbox360Peripheral::free(void)
 {
+    IOLockFree(controlLock);
     IOLockFree(mainLock);
     super::free();
 }
@@ -452,12 +640,46 @@ interfacefound:
         goto fail;
     }
     outPipe->retain();
+    // Create timers for read recovery
+    workloop = getWorkLoop();
+    padRecovery.timer = IOTimerEventSource::timerEventSource(this, RecoveryTimerActionWrapper);
+    serialRecovery.timer = IOTimerEventSource::timerEventSource(this, RecoveryTimerActionWrapper);
+    if ((padRecovery.timer == NULL) || (serialRecovery.timer == NULL))
+    {
+        IOLog("start - failed to create timers for read recovery\n");
+        goto fail;
+    }
+    if ((workloop == NULL)
+        || (workloop->addEventSource(padRecovery.timer) != kIOReturnSuccess)
+        || (workloop->addEventSource(serialRecovery.timer) != kIOReturnSuccess))
+    {
+        IOLog("start - failed to connect timers for read recovery\n");
+        goto fail;
+    }
+    PublishReadCounters();
+    // Create timer for idle suspend
+    idleTimer = IOTimerEventSource::timerEventSource(this, IdleTimerActionWrapper);
+    if ((idleTimer == NULL) || (workloop->addEventSource(idleTimer) != kIOReturnSuccess))
+    {
+        IOLog("start - failed to create idle timer\n");
+        goto fail;
+    }
     // Get a buffer
     inBuffer=IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task,0,GetMaxPacketSize(inPipe));
     if(inBuffer==NULL) {
         IOLog("start - failed to allocate input buffer\n");
         goto fail;
     }
+    latestReport=IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task,0,inBuffer->getLength());
+    if(latestReport==NULL) {
+        IOLog("start - failed to allocate report buffer\n");
+        goto fail;
+    }
+    bzero(latestReport->getBytesNoCopy(),latestReport->getLength());
+    // Skip the chatpad on devices that have recently failed to negotiate one
+    if (ChatPadSkip(ChatPadCacheKey(device))) {
+        goto nochat;
+    }
     // Find chatpad interface
     intf.bInterfaceClass = kIOUSBFindInterfaceDontCare;
     intf.bInterfaceSubClass = 93;
@@ -495,32 +717,11 @@ interfacefound:
         IOLog("start - failed to create timer for chatpad\n");
         goto fail;
     }
-    workloop = getWorkLoop();
     if ((workloop == NULL) || (workloop->addEventSource(serialTimer) != kIOReturnSuccess))
     {
         IOLog("start - failed to connect timer for chatpad\n");
         goto fail;
     }
-    // Configure ChatPad
-    // Send 'configuration'
-    SendInit(0xa30c, 0x4423);
-    SendInit(0x2344, 0x7f03);
-    SendInit(0x5839, 0x6832);
-    // Set 'switch'
-    if ((!SendSwitch(false)) || (!SendSwitch(true)) || (!SendSwitch(false))) {
-        // Commenting goto fail fixes the driver for the Hori Real Arcade Pro EX
-        //goto fail;
-    }
-    // Begin toggle
-    serialHeard = false;
-    serialActive = false;
-    serialToggle = false;
-    serialResetCount = 0;
-    serialTimerState = tsToggle;
-    serialTimer->setTimeoutMS(1000);
-    // Begin reading
-    if (!QueueSerialRead())
-        goto fail;
 nochat:
     if (!QueueRead())
         goto fail;
@@ -542,7 +743,11 @@ nochat:
 
     // Done
     PadConnect();
+    ArmIdleTimer();
     registerService();
+    // Negotiating with the chatpad takes a while, so let the pad work in the meantime
+    if (serialTimer != NULL)
+        ChatPadNegotiate();
     return true;
 fail:
     ReleaseAll();
@@ -623,6 +828,32 @@ void Xbox360Peripheral::stop(IOService *provider)
 // Releases all the objects used
 void Xbox360Peripheral::ReleaseAll(void)
 {
+    IOTimerEventSource *timers[3];
+
+    // Control handlers and the recovery and idle timers take mainLock, so they must be gone before we take it
+    StopControl();
+    // Taken under the lock so nothing re-arms them once they're on their way out
+    IOLockLock(mainLock);
+    timers[0] = idleTimer;
+    timers[1] = padRecovery.timer;
+    timers[2] = serialRecovery.timer;
+    idleTimer = NULL;
+    padRecovery.timer = NULL;
+    serialRecovery.timer = NULL;
+    IOLockUnlock(mainLock);
+    for (int i = 0; i < 3; i++)
+    {
+        IOTimerEventSource *timer = timers[i];
+
+        if (timer != NULL)
+        {
+            timer->cancelTimeout();
+            if (getWorkLoop() != NULL)
+                getWorkLoop()->removeEventSource(timer);
+            timer->release();
+        }
+    }
+
     LockRequired locker(mainLock);
 
     SerialDisconnect();
@@ -664,6 +895,10 @@ void Xbox360Peripheral::ReleaseAll(void)
         inBuffer->release();
         inBuffer=NULL;
     }
+    if(latestReport!=NULL) {
+        latestReport->release();
+        latestReport=NULL;
+    }
     if(interface!=NULL) {
         interface->close(this);
         interface=NULL;
@@ -687,6 +922,11 @@ bool Xbox360Peripheral::didTerminate(IOService *provider, IOOptionBits options,
 IOReturn Xbox360Peripheral::message(UInt32 type,IOService *provider,void *argument)
 {
     switch(type) {
+        case kIOUSBMessagePortHasBeenResumed:
+            // Remote wakeup, most likely a button press
+            IdleWake();
+            return super::message(type,provider,argument);
+
         case kIOMessageServiceIsTerminated:
         case kIOMessageServiceIsRequestingClose:
         default:
@@ -813,32 +1053,77 @@ void Xbox360Peripheral::ReadComplete(void *parameter,IOReturn status,UInt32 buff
 
         switch(status) {
             case kIOReturnOverrun:
-                IOLog("read - kIOReturnOverrun, clearing stall\n");
-                if (inPipe != NULL)
-                    inPipe->ClearStall();
+                // Clearing the stall is a control transfer, so it's done from the recovery timer
+                padRecovery.stalled = true;
+                readStallCount++;
                 // Fall through
             case kIOReturnSuccess:
+                if ((padRecovery.attempts != 0) && !padRecovery.stalled)
+                {
+                    padRecovery.attempts = 0;
+                    readRecoveryCount++;
+                    PublishReadCounters();
+                }
+                if (idleResumeStart != 0)
+                {
+                    UInt64 now, elapsed;
+
+                    clock_get_uptime(&now);
+                    absolutetime_to_nanoseconds(now - idleResumeStart, &elapsed);
+                    setProperty(kIdleResumeLatencyKey, elapsed / 1000, 32);
+                    idleResumeStart = 0;
+                }
                 if (inBuffer != NULL)
                 {
                     const XBOX360_IN_REPORT *report=(const XBOX360_IN_REPORT*)inBuffer->getBytesNoCopy();
+                    // The Xbox One header carries a sequence number, which shouldn't count as input
+                    IOByteCount skip = ((controllerType == XboxOne) || (controllerType == XboxOnePretend360)) ? 4 : 0;
+                    IOByteCount compare = inBuffer->getLength();
+
+                    if (compare > sizeof(idleSnapshot))
+                        compare = sizeof(idleSnapshot);
+                    if ((compare > skip) && (memcmp(idleSnapshot + skip, (const UInt8*)report + skip, compare - skip) != 0))
+                    {
+                        memcpy(idleSnapshot, report, compare);
+                        idleActivity = true;
+                    }
                     if(((report->header.command==inReport)&&(report->header.size==sizeof(XBOX360_IN_REPORT)))
                        || (report->header.command==0x20) || (report->header.command==0x07)) /* Xbox One */ {
-                        err = padHandler->handleReport(inBuffer, kIOHIDReportTypeInput);
-                        if(err!=kIOReturnSuccess) {
-                            IOLog("read - failed to handle report: 0x%.8x\n",err);
+                        if (!padHandler->hasClients() && (report->header.command!=0x07) && (latestReport!=NULL)) {
+                            // Nobody is listening, so keep the raw report until somebody asks for it
+                            // Guide button packets still go through, as they update the pad's state
+                            memcpy(latestReport->getBytesNoCopy(), report, inBuffer->getLength());
+                            latestReportRaw=true;
+                        } else {
+                            err = padHandler->handleReport(inBuffer, kIOHIDReportTypeInput);
+                            if(err!=kIOReturnSuccess) {
+                                IOLog("read - failed to handle report: 0x%.8x\n",err);
+                            }
+                            // Guide button packets aren't input reports, so they mustn't replace the latest one
+                            if ((latestReport!=NULL) && (report->header.command!=0x07)) {
+                                memcpy(latestReport->getBytesNoCopy(), inBuffer->getBytesNoCopy(), inBuffer->getLength());
+                                latestReportRaw=false;
+                            }
                         }
                     }
                 }
                 break;
-            case kIOReturnNotResponding:
-                IOLog("read - kIOReturnNotResponding\n");
+            case kIOReturnAborted:
+                // Pipe is being torn down
                 reread=false;
                 break;
+            case kIOReturnNotResponding:
             default:
+                // Possibly transient, so try again after a short delay
+                if (reread) ScheduleReadRecovery(false);
                 reread=false;
                 break;
         }
-        if(reread) QueueRead();
+        if (reread && padRecovery.stalled) {
+            ScheduleReadRecovery(false);
+            reread=false;
+        }
+        if (reread && !QueueRead()) ScheduleReadRecovery(false);
     }
 }
 
@@ -852,30 +1137,229 @@ void Xbox360Peripheral::SerialReadComplete(void *parameter, IOReturn status, UIn
         switch (status)
         {
             case kIOReturnOverrun:
-                IOLog("read (serial) - kIOReturnOverrun, clearing stall\n");
-                if (serialInPipe != NULL)
-                    serialInPipe->ClearStall();
+                serialRecovery.stalled = true;
+                readStallCount++;
                 // Fall through
             case kIOReturnSuccess:
+                if ((serialRecovery.attempts != 0) && !serialRecovery.stalled)
+                {
+                    serialRecovery.attempts = 0;
+                    readRecoveryCount++;
+                    PublishReadCounters();
+                }
                 serialHeard = true;
+                idleActivity = true;
                 if (serialInBuffer != NULL)
                     SerialMessage(serialInBuffer, serialInBuffer->getCapacity() - bufferSizeRemaining);
                 break;
 
-            case kIOReturnNotResponding:
-                IOLog("read (serial) - kIOReturnNotResponding\n");
+            case kIOReturnAborted:
                 reread = false;
                 break;
 
+            case kIOReturnNotResponding:
             default:
+                if (reread)
+                    ScheduleReadRecovery(true);
                 reread = false;
                 break;
         }
-        if (reread)
-            QueueSerialRead();
+        if (reread && serialRecovery.stalled)
+        {
+            ScheduleReadRecovery(true);
+            reread = false;
+        }
+        if (reread && !QueueSerialRead())
+            ScheduleReadRecovery(true);
+    }
+}
+
+// Arm the recovery timer for a pipe, backing off on each consecutive failure
+// Called with mainLock held
+void Xbox360Peripheral::ScheduleReadRecovery(bool serial)
+{
+    READ_RECOVERY *recovery = serial ? &serialRecovery : &padRecovery;
+    UInt32 delay;
+
+    if ((recovery->timer == NULL) || isInactive() || idleSuspended)
+        return;
+    if (recovery->attempts >= READ_RETRY_MAX_ATTEMPTS)
+    {
+        IOLog("read%s - giving up after %d attempts\n", serial ? " (serial)" : "", recovery->attempts);
+        return;
+    }
+    delay = READ_RETRY_BASE_MS << recovery->attempts;
+    if (delay > READ_RETRY_MAX_MS)
+        delay = READ_RETRY_MAX_MS;
+    recovery->attempts++;
+    recovery->timer->setTimeoutMS(delay);
+}
+
+void Xbox360Peripheral::RecoveryTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender)
+{
+    Xbox360Peripheral *controller;
+
+    controller = OSDynamicCast(Xbox360Peripheral, owner);
+    controller->RecoveryTimerAction(sender);
+}
+
+// Clear any stall and restart the read, outside of the completion
+void Xbox360Peripheral::RecoveryTimerAction(IOTimerEventSource *sender)
+{
+    LockRequired locker(mainLock);
+    bool serial = (sender == serialRecovery.timer);
+    READ_RECOVERY *recovery = serial ? &serialRecovery : &padRecovery;
+    IOUSBPipe *pipe = serial ? serialInPipe : inPipe;
+    bool queued;
+
+    // ReleaseAll has already taken the timer
+    if (!serial && (sender != padRecovery.timer))
+        return;
+    if ((pipe == NULL) || isInactive() || idleSuspended)
+        return;
+    if (recovery->stalled)
+    {
+        if (pipe->ClearStall() != kIOReturnSuccess)
+        {
+            ScheduleReadRecovery(serial);
+            return;
+        }
+        recovery->stalled = false;
+    }
+    readRetryCount++;
+    queued = serial ? QueueSerialRead() : QueueRead();
+    if (!queued)
+        ScheduleReadRecovery(serial);
+    PublishReadCounters();
+}
+
+void Xbox360Peripheral::IdleTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender)
+{
+    Xbox360Peripheral *controller;
+
+    controller = OSDynamicCast(Xbox360Peripheral, owner);
+    controller->IdleTimerAction(sender);
+}
+
+// Suspends the device after a full period with no input and nobody listening,
+// and brings it back once IdleWake has asked for it
+void Xbox360Peripheral::IdleTimerAction(IOTimerEventSource *sender)
+{
+    bool suspend = false, resume = false;
+
+    {
+        LockRequired locker(mainLock);
+
+        if ((device == NULL) || isInactive() || (sender != idleTimer))
+            return;
+        if (idleSuspended)
+        {
+            resume = idleResumePending;
+        }
+        else if (idleTimeout != 0)
+        {
+            if (!idleActivity && (padHandler != NULL) && !padHandler->hasClients())
+            {
+                idleSuspended = true;
+                suspend = true;
+            }
+            else
+            {
+                idleActivity = false;
+                sender->setTimeoutMS(idleTimeout * 1000);
+            }
+        }
+    }
+    // Aborting pipes calls the completions, which take mainLock
+    if (suspend)
+        IdleSuspend();
+    if (resume)
+        IdleResume();
+}
+
+// Called on the work loop, without mainLock
+void Xbox360Peripheral::IdleSuspend(void)
+{
+    IOReturn err;
+
+    if (serialTimer != NULL)
+        serialTimer->cancelTimeout();
+    if (padRecovery.timer != NULL)
+        padRecovery.timer->cancelTimeout();
+    if (serialRecovery.timer != NULL)
+        serialRecovery.timer->cancelTimeout();
+    if (inPipe != NULL)
+        inPipe->Abort();
+    if (serialInPipe != NULL)
+        serialInPipe->Abort();
+    err = device->SuspendDevice(true);
+    if (err != kIOReturnSuccess)
+    {
+        IOLog("idle - failed to suspend device (0x%.8x)\n", err);
+        IdleResume();
     }
 }
 
+// Called on the work loop, without mainLock
+void Xbox360Peripheral::IdleResume(void)
+{
+    IOReturn err;
+
+    err = device->SuspendDevice(false);
+    if (err != kIOReturnSuccess)
+        IOLog("idle - failed to resume device (0x%.8x)\n", err);
+    {
+        LockRequired locker(mainLock);
+
+        idleSuspended = false;
+        idleResumePending = false;
+        idleActivity = true;
+        if (!QueueRead())
+            ScheduleReadRecovery(false);
+        if (chatpadReady && !QueueSerialRead())
+            ScheduleReadRecovery(true);
+    }
+    if (chatpadReady)
+        ChatPadRestart();
+    ArmIdleTimer();
+}
+
+// Requests a resume from idle suspend, on client open or remote wakeup
+void Xbox360Peripheral::IdleWake(void)
+{
+    LockRequired locker(mainLock);
+
+    if (!idleSuspended || idleResumePending || (idleTimer == NULL))
+        return;
+    clock_get_uptime(&idleResumeStart);
+    idleResumePending = true;
+    idleTimer->setTimeoutMS(0);
+}
+
+void Xbox360Peripheral::ArmIdleTimer(void)
+{
+    LockRequired locker(mainLock);
+
+    if ((idleTimer == NULL) || idleSuspended)
+        return;
+    if (idleTimeout != 0)
+    {
+        idleActivity = false;
+        idleTimer->setTimeoutMS(idleTimeout * 1000);
+    }
+    else
+    {
+        idleTimer->cancelTimeout();
+    }
+}
+
+void Xbox360Peripheral::PublishReadCounters(void)
+{
+    setProperty(kReadStallsKey, readStallCount, 32);
+    setProperty(kReadRetriesKey, readRetryCount, 32);
+    setProperty(kReadRecoveriesKey, readRecoveryCount, 32);
+}
+
 // Handle a completed asynchronous write
 void Xbox360Peripheral::WriteComplete(void *parameter,IOReturn status,UInt32 bufferSizeRemaining)
 {
@@ -887,6 +1371,45 @@ void Xbox360Peripheral::WriteComplete(void *parameter,IOReturn status,UInt32 buf
 }
 
 
+// Runs a deferred report through the pad. Called with mainLock held
+void Xbox360Peripheral::ProcessLatestReport(void)
+{
+    IOReturn err;
+
+    if ((padHandler == NULL) || (latestReport == NULL) || !latestReportRaw)
+        return;
+    latestReportRaw = false;
+    err = padHandler->handleReport(latestReport, kIOHIDReportTypeInput);
+    if (err != kIOReturnSuccess)
+        IOLog("read - failed to handle deferred report: 0x%.8x\n", err);
+}
+
+// Called when a client opens the pad, so it starts with the current state
+void Xbox360Peripheral::FlushLatestReport(void)
+{
+    // Don't wait - if the lock is busy, a read is completing and will deliver a fresh report
+    if (!IOLockTryLock(mainLock))
+        return;
+    ProcessLatestReport();
+    IOLockUnlock(mainLock);
+}
+
+// Copies the current (converted) input report for getReport
+IOReturn Xbox360Peripheral::CopyLatestReport(IOMemoryDescriptor *report)
+{
+    LockRequired locker(mainLock);
+    IOByteCount length;
+
+    if ((padHandler == NULL) || (latestReport == NULL))
+        return kIOReturnNotReady;
+    ProcessLatestReport();
+    length = report->getLength();
+    if (length > sizeof(XBOX360_IN_REPORT))
+        length = sizeof(XBOX360_IN_REPORT);
+    report->writeBytes(0, latestReport->getBytesNoCopy(), length);
+    return kIOReturnSuccess;
+}
+
 void Xbox360Peripheral::MakeSettingsChanges()
 {
     if (controllerType == XboxOne)
@@ -906,6 +1429,8 @@ void Xbox360Peripheral::MakeSettingsChanges()
         }
     }
 
+    ArmIdleTimer();
+
     noMapping = true;
     UInt8 normalMapping[15] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 15 };
     for (int i = 0; i < 15; i++)
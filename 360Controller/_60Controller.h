@@ -27,15 +27,20 @@
 #include <IOKit/usb/IOUSBDevice.h>
 #include <IOKit/usb/IOUSBInterface.h>
 #include "ControlStruct.h"
+#include "chatpadhandshake.h"
 
 class Xbox360ControllerClass;
 class ChatPadKeyboardClass;
 
+#define CONTROL_QUEUE_SIZE 16
+
 class Xbox360Peripheral : public IOService
 {
     OSDeclareDefaultStructors(Xbox360Peripheral)
 
 private:
+    typedef void (Xbox360Peripheral::*ControlHandler)(IOReturn status, const UInt8 *data);
+
     void ReleaseAll(void);
     bool QueueRead(void);
     bool QueueSerialRead(void);
@@ -46,14 +51,42 @@ private:
 
     void SerialReadComplete(void *parameter, IOReturn status, UInt32 bufferSizeRemaining);
 
+    static void RecoveryTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender);
+    void RecoveryTimerAction(IOTimerEventSource *sender);
+    void ScheduleReadRecovery(bool serial);
+    void PublishReadCounters(void);
+    void ProcessLatestReport(void);
+
+    static void IdleTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender);
+    void IdleTimerAction(IOTimerEventSource *sender);
+    void IdleSuspend(void);
+    void IdleResume(void);
+    void ArmIdleTimer(void);
+
     void readSettings(void);
 
+    bool QueueControl(UInt8 requestType, UInt8 request, UInt16 value, UInt16 index,
+                      const void *data, UInt16 length, ControlHandler handler);
+    void StartControl(void);
+    void StopControl(void);
+    static void ControlCompleteInternal(void *target, void *parameter, IOReturn status, UInt32 bufferSizeRemaining);
+    void ControlComplete(void *parameter, IOReturn status, UInt32 bufferSizeRemaining);
+
     static void ChatPadTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender);
     void ChatPadTimerAction(IOTimerEventSource *sender);
-    void SendToggle(void);
-    void SendSpecial(UInt16 value);
+    void ChatPadStepComplete(IOReturn status, const UInt8 *data);
+    void ChatPadSchedule(UInt32 delay);
+    void ChatPadRestart(void);
+    bool SendSpecial(UInt16 value, ControlHandler handler);
     void SendInit(UInt16 value, UInt16 index);
-    bool SendSwitch(bool sendOut);
+    bool SendSwitch(bool sendOut, ControlHandler handler);
+
+    void ChatPadNegotiate(void);
+    void ChatPadSwitchRead(IOReturn status, const UInt8 *data);
+    void ChatPadSwitchWritten(IOReturn status, const UInt8 *data);
+    void ChatPadSwitchConfirmed(IOReturn status, const UInt8 *data);
+    bool ChatPadSwitchFailed(bool sendOut, IOReturn err);
+    void ChatPadNegotiated(IOReturn status);
 
     void PadConnect(void);
     void PadDisconnect(void);
@@ -65,15 +98,17 @@ private:
     void MakeSettingsChanges(void);
 
 protected:
-    typedef enum TIMER_STATE {
-        tsToggle,
-        tsReset1,
-        tsReset2,
-        tsMiniToggle,
-        tsSet1,
-        tsSet2,
-        tsSet3,
-    } TIMER_STATE;
+    typedef struct READ_RECOVERY {
+        IOTimerEventSource *timer;
+        bool stalled;           // Pipe needs ClearStall before the next read
+        int attempts;           // Consecutive failed reads, drives the backoff
+    } READ_RECOVERY;
+
+    typedef struct CONTROL_REQUEST {
+        IOUSBDevRequest request;
+        UInt8 data[2];
+        ControlHandler handler;
+    } CONTROL_REQUEST;
 
     typedef enum CONTROLLER_TYPE {
         Xbox360 = 0,
@@ -85,24 +120,44 @@ protected:
     IOUSBDevice *device;
     IOLock *mainLock;
 
+    // Default pipe requests
+    IOLock *controlLock;
+    CONTROL_REQUEST controlQueue[CONTROL_QUEUE_SIZE];
+    int controlHead, controlCount;
+    bool controlStopping;
+
     // Joypad
     IOUSBInterface *interface;
     IOUSBPipe *inPipe,*outPipe;
     IOBufferMemoryDescriptor *inBuffer;
+    IOBufferMemoryDescriptor *latestReport;
+    bool latestReportRaw;               // latestReport hasn't been through the pad yet
 
     // Keyboard
     IOUSBInterface *serialIn;
     IOUSBPipe *serialInPipe;
     IOBufferMemoryDescriptor *serialInBuffer;
     IOTimerEventSource *serialTimer;
-    bool serialToggle, serialHeard, serialActive;
-    int serialResetCount;
-    TIMER_STATE serialTimerState;
+    bool serialHeard;
+    ChatPadHandshake serialHandshake;
+    UInt64 serialDeadline;              // Absolute time of the next keepalive step
     ChatPadKeyboardClass *serialHandler;
     Xbox360ControllerClass *padHandler;
     UInt8 chatpadInit[2];
+    bool chatpadReady;
     CONTROLLER_TYPE controllerType;
 
+    // Read recovery
+    READ_RECOVERY padRecovery, serialRecovery;
+    UInt32 readStallCount, readRetryCount, readRecoveryCount;
+
+    // Idle suspend
+    IOTimerEventSource *idleTimer;
+    UInt32 idleTimeout;                 // Seconds without input before suspending, 0 to disable
+    bool idleActivity, idleSuspended, idleResumePending;
+    UInt64 idleResumeStart;             // When resume was requested, until the first report arrives
+    UInt8 idleSnapshot[32];
+
     // Settings
     bool invertLeftX,invertLeftY;
     bool invertRightX,invertRightY;
@@ -141,6 +196,9 @@ public:
     virtual void WriteComplete(void *parameter,IOReturn status,UInt32 bufferSizeRemaining);
 
     bool QueueWrite(const void *bytes,UInt32 length);
+    void FlushLatestReport(void);
+    void IdleWake(void);
+    IOReturn CopyLatestReport(IOMemoryDescriptor *report);
     void fiddleReport(XBOX360_HAT& left, XBOX360_HAT& right);
 
     IOHIDDevice* getController(int index);
@@ -0,0 +1,151 @@
+/*
+ MICE Xbox 360 Controller driver for Mac OS X
+ Copyright (C) 2006-2013 Colin Munro
+
+ chatpadhandshake.cpp - ChatPad keepalive state machine
+
+ This file is part of Xbox360Controller.
+
+ Xbox360Controller is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ Xbox360Controller is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with Foobar; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "chatpadhandshake.h"
+
+// Keepalive sequence, indexed by state. A command of 0 means toggle
+static const struct {
+    unsigned short command;
+    unsigned short delay;
+    ChatPadHandshake::STATE next;   // For the steps that don't depend on being heard
+} steps[] = {
+    /* tsToggle */      { 0x00, 1000, ChatPadHandshake::tsToggle },
+    /* tsReset1 */      { 0x1B,   35, ChatPadHandshake::tsReset2 },
+    /* tsReset2 */      { 0x1B,  150, ChatPadHandshake::tsMiniToggle },
+    /* tsMiniToggle */  { 0x00,   40, ChatPadHandshake::tsMiniToggle },
+    /* tsSet1 */        { 0x18,   10, ChatPadHandshake::tsSet2 },
+    /* tsSet2 */        { 0x10,   10, ChatPadHandshake::tsSet3 },
+    /* tsSet3 */        { 0x03,  940, ChatPadHandshake::tsToggle },
+};
+
+// Retry and backoff policy
+static const struct {
+    unsigned int skipLimit;     // Toggles skipped in a row while the chatpad is talking
+    unsigned int missBudget;    // Silent periods tolerated before the chatpad is dropped
+    int resetAttempts;          // Reset sequences tried before going back to toggling
+    unsigned int backoffShift;  // Probe period doubles per failed reset, up to this many times
+} policy = { 9, 2, 3, 3 };
+
+void ChatPadHandshake::reset(void)
+{
+    state = tsToggle;
+    toggle = false;
+    active = false;
+    resetCount = 0;
+    skips = 0;
+    misses = 0;
+    failures = 0;
+}
+
+unsigned int ChatPadHandshake::startDelay(void) const
+{
+    return steps[tsToggle].delay;
+}
+
+unsigned short ChatPadHandshake::nextToggle(void)
+{
+    unsigned short value = toggle ? 0x1F : 0x1E;
+    toggle = !toggle;
+    return value;
+}
+
+ChatPadHandshake::ACTION ChatPadHandshake::step(bool heard)
+{
+    ACTION action;
+
+    action.send = true;
+    action.command = steps[state].command;
+    action.delay = steps[state].delay;
+    action.event = evNone;
+    switch (state)
+    {
+        case tsToggle:
+            if (active)
+            {
+                if (heard)
+                {
+                    // The chatpad is talking, so the toggle can wait
+                    misses = 0;
+                    if (skips < policy.skipLimit)
+                    {
+                        skips++;
+                        action.send = false;
+                    }
+                    else
+                    {
+                        skips = 0;
+                    }
+                }
+                else if (++misses > policy.missBudget)
+                {
+                    active = false;
+                    action.event = evDisconnected;
+                }
+            }
+            else if (heard)
+            {
+                state = tsReset1;
+                resetCount = 0;
+                action.delay = steps[tsMiniToggle].delay;
+            }
+            else
+            {
+                // Nobody there - probe less often after each failed reset
+                action.delay <<= (failures < policy.backoffShift) ? failures : policy.backoffShift;
+            }
+            if (action.send)
+                action.command = nextToggle();
+            break;
+
+        case tsMiniToggle:
+            action.command = nextToggle();
+            if (heard)
+            {
+                state = tsSet1;
+            }
+            else if (++resetCount > policy.resetAttempts)
+            {
+                state = tsToggle;
+                failures++;
+                action.delay = steps[tsToggle].delay;
+            }
+            else
+            {
+                state = tsReset1;
+            }
+            break;
+
+        default:
+            state = steps[state].next;
+            if (state == tsToggle)
+            {
+                active = true;
+                skips = 0;
+                misses = 0;
+                failures = 0;
+                action.event = evConnected;
+            }
+            break;
+    }
+    return action;
+}
@@ -0,0 +1,71 @@
+/*
+ MICE Xbox 360 Controller driver for Mac OS X
+ Copyright (C) 2006-2013 Colin Munro
+
+ chatpadhandshake.h - declaration of the ChatPad keepalive state machine
+
+ This file is part of Xbox360Controller.
+
+ Xbox360Controller is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ Xbox360Controller is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with Foobar; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef __CHATPADHANDSHAKE_H__
+#define __CHATPADHANDSHAKE_H__
+
+// Decides what to send the chatpad and when, given only whether it has been
+// heard from since the last step. Sending and timing are left to the caller.
+class ChatPadHandshake
+{
+public:
+    typedef enum STATE {
+        tsToggle,
+        tsReset1,
+        tsReset2,
+        tsMiniToggle,
+        tsSet1,
+        tsSet2,
+        tsSet3,
+    } STATE;
+
+    typedef enum EVENT {
+        evNone,
+        evConnected,
+        evDisconnected,
+    } EVENT;
+
+    typedef struct ACTION {
+        bool send;                  // Send command on the default pipe
+        unsigned short command;
+        unsigned int delay;         // ms from this step's deadline to the next
+        EVENT event;
+    } ACTION;
+
+    ChatPadHandshake() { reset(); }
+
+    void reset(void);
+    ACTION step(bool heard);
+
+    bool isActive(void) const { return active; }
+    unsigned int startDelay(void) const;
+
+private:
+    STATE state;
+    bool toggle, active;
+    int resetCount;
+    unsigned int skips, misses, failures;
+
+    unsigned short nextToggle(void);
+};
+
+#endif /* __CHATPADHANDSHAKE_H__ */
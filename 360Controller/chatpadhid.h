@@ -46,12 +46,12 @@ static const unsigned char ReportDescriptor[] = {
     0x75, 0x01,                    //   REPORT_SIZE (1)
     0x95, 0x04,                    //   REPORT_COUNT (4)
     0x81, 0x03,                    //   INPUT (Cnst,Var,Abs)
-    0x95, 0x03,                    //   REPORT_COUNT (3)
-    0x75, 0x08,                    //   REPORT_SIZE (8)
+    0x95, 0x60,                    //   REPORT_COUNT (96)
+    0x75, 0x01,                    //   REPORT_SIZE (1)
     0x15, 0x00,                    //   LOGICAL_MINIMUM (0)
-    0x26, 0xe7, 0x00,              //   LOGICAL_MAXIMUM (231)
+    0x25, 0x01,                    //   LOGICAL_MAXIMUM (1)
     0x19, 0x00,                    //   USAGE_MINIMUM (Reserved (no event indicated))
-    0x29, 0xe7,                    //   USAGE_MAXIMUM (Keyboard Right GUI)
-    0x81, 0x00,                    //   INPUT (Data,Ary,Abs)
+    0x29, 0x5f,                    //   USAGE_MAXIMUM (Keypad 7 and Home)
+    0x81, 0x02,                    //   INPUT (Data,Var,Abs)
     0xc0                           // END_COLLECTION
 };
@@ -23,31 +23,60 @@
 
 #include "chatpadkeys.h"
 
-#define ROW_SIZE 8
-
-typedef struct MAP_DATA {
-	unsigned char row[ROW_SIZE];
-} MAP_DATA;
-
-static const MAP_DATA columns[] = {
-{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-{0x00, 0x24, 0x23, 0x22, 0x21, 0x20, 0x1F, 0x1E},
-{0x00, 0x18, 0x1C, 0x17, 0x15, 0x08, 0x1A, 0x14},
-{0x00, 0x0D, 0x0B, 0x0A, 0x09, 0x07, 0x16, 0x04},
-{0x00, 0x11, 0x05, 0x19, 0x06, 0x1B, 0x1D, 0x00},
-{0x00, 0x4F, 0x10, 0x37, 0x2C, 0x50, 0x00, 0x00},
-{0x00, 0x00, 0x36, 0x28, 0x13, 0x27, 0x26, 0x25},
-{0x00, 0x2A, 0x0F, 0x00, 0x00, 0x12, 0x0C, 0x0E},
+// Serial key code (column in the high nibble, row in the low) to keyboard usage
+static constexpr unsigned char keymap[256] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x00
+    0x00, 0x24, 0x23, 0x22, 0x21, 0x20, 0x1F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x10
+    0x00, 0x18, 0x1C, 0x17, 0x15, 0x08, 0x1A, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x20
+    0x00, 0x0D, 0x0B, 0x0A, 0x09, 0x07, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x30
+    0x00, 0x11, 0x05, 0x19, 0x06, 0x1B, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x40
+    0x00, 0x4F, 0x10, 0x37, 0x2C, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x50
+    0x00, 0x00, 0x36, 0x28, 0x13, 0x27, 0x26, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x60
+    0x00, 0x2A, 0x0F, 0x00, 0x00, 0x12, 0x0C, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x70
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x80
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x90
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xA0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xB0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xC0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xD0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xE0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0xF0
 };
 
+// Every usage must fit the key bitmap
+static constexpr bool KeymapFits(unsigned int index)
+{
+    return (index == sizeof(keymap)) || ((keymap[index] < (CHATPAD_KEY_BYTES * 8)) && KeymapFits(index + 1));
+}
+static_assert(KeymapFits(0), "ChatPad keymap has a usage outside the key bitmap");
+
 unsigned char ChatPad2USB(unsigned char input)
 {
-	unsigned char row = input & 0x0F;
-	unsigned char column = (input & 0xF0) >> 4;
-
-	if (row >= ROW_SIZE)
-		return 0x00;
-	if (column >= (sizeof(columns) / sizeof(columns[0])))
-		return 0x00;
-	return columns[column].row[row];
+	return keymap[input];
+}
+
+// Rebuilds the key bitmap from a serial packet's modifiers and key codes,
+// and returns whether anything was pressed or released
+bool ChatPadUpdateKeys(CHATPAD_KEYS *state, unsigned char modifiers, const unsigned char *codes, int count)
+{
+	CHATPAD_KEYS keys = {};
+	bool changed = false;
+
+	keys.modifiers = modifiers & CHATPAD_MODIFIER_MASK;
+	for (int i = 0; i < count; i++)
+	{
+		unsigned char usage = keymap[codes[i]];
+		if (usage != 0x00)
+			keys.keys[usage >> 3] |= 1 << (usage & 0x07);
+	}
+	if (keys.modifiers != state->modifiers)
+		changed = true;
+	for (int i = 0; i < CHATPAD_KEY_BYTES; i++)
+	{
+		if (keys.keys[i] != state->keys[i])
+			changed = true;
+	}
+	if (changed)
+		*state = keys;
+	return changed;
 }
@@ -21,4 +21,15 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+// Keyboard usages 0x00-0x5F, one bit each
+#define CHATPAD_KEY_BYTES       12
+// Shift, Control, Alt and GUI - the rest of the byte is padding
+#define CHATPAD_MODIFIER_MASK   0x0F
+
+typedef struct CHATPAD_KEYS {
+    unsigned char modifiers;
+    unsigned char keys[CHATPAD_KEY_BYTES];
+} CHATPAD_KEYS;
+
 unsigned char ChatPad2USB(unsigned char input);
+bool ChatPadUpdateKeys(CHATPAD_KEYS *state, unsigned char modifiers, const unsigned char *codes, int count);
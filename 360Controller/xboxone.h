@@ -0,0 +1,133 @@
+/*
+    MICE Xbox 360 Controller driver for Mac OS X
+    Copyright (C) 2006-2013 Colin Munro
+
+    xboxone.h - Xbox One input reports and their conversion
+
+    This file is part of Xbox360Controller.
+
+    Xbox360Controller is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    Xbox360Controller is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Foobar; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+#ifndef __XBOXONE_H__
+#define __XBOXONE_H__
+
+#include "ControlStruct.h"
+
+// Shared by the wired driver and the Xbox One wireless receiver, which both
+// present Xbox One pads with the 360 report layout
+
+typedef struct {
+    UInt8 command;
+    UInt8 reserved1;
+    UInt8 counter;
+    UInt8 size;
+} PACKED XBOXONE_HEADER;
+
+typedef struct {
+    XBOXONE_HEADER header;
+    UInt16 buttons;
+    UInt16 trigL, trigR;
+    XBOX360_HAT left, right;
+} PACKED XBOXONE_IN_REPORT;
+
+typedef struct {
+    XBOXONE_HEADER header;
+    UInt16 buttons;
+    UInt16 trigL, trigR;
+    XBOX360_HAT left, right;
+    UInt8 unknown1[6];
+    UInt8 triggersAsButtons; // 0x40 is RT. 0x80 is LT
+    UInt8 unknown2[7];
+} PACKED XBOXONE_IN_FIGHTSTICK_REPORT;
+
+typedef struct {
+    XBOXONE_HEADER header;
+    UInt16 buttons;
+    UInt16 trigL, trigR;
+    XBOX360_HAT left, right;
+    UInt16 true_buttons;
+    UInt16 true_trigL, true_trigR;
+    XBOX360_HAT true_left, true_right;
+    UInt8 paddle;
+} PACKED XBOXONE_ELITE_IN_REPORT;
+
+typedef struct {
+    XBOXONE_HEADER header;
+    UInt8 state;
+    UInt8 dummy;
+} PACKED XBOXONE_IN_GUIDE_REPORT;
+
+// Input report sizes, as given in the header
+#define XBOXONE_SIZE_PAD            0x0e
+#define XBOXONE_SIZE_FIGHTSTICK     0x1a
+#define XBOXONE_SIZE_ELITE          0x1d
+
+static inline UInt16 XboxOne_ConvertButtons(UInt16 buttons, bool guide)
+{
+    UInt16 new_buttons = 0;
+
+    new_buttons |= ((buttons & 4) == 4) << 4;
+    new_buttons |= ((buttons & 8) == 8) << 5;
+    new_buttons |= ((buttons & 16) == 16) << 12;
+    new_buttons |= ((buttons & 32) == 32) << 13;
+    new_buttons |= ((buttons & 64) == 64) << 14;
+    new_buttons |= ((buttons & 128) == 128) << 15;
+    new_buttons |= ((buttons & 256) == 256) << 0;
+    new_buttons |= ((buttons & 512) == 512) << 1;
+    new_buttons |= ((buttons & 1024) == 1024) << 2;
+    new_buttons |= ((buttons & 2048) == 2048) << 3;
+    new_buttons |= ((buttons & 4096) == 4096) << 8;
+    new_buttons |= ((buttons & 8192) == 8192) << 9;
+    new_buttons |= ((buttons & 16384) == 16384) << 6;
+    new_buttons |= ((buttons & 32768) == 32768) << 7;
+
+    new_buttons |= guide << 10;
+
+    return new_buttons;
+}
+
+// Rewrites an input report in place as a 360 one
+static inline void XboxOne_ConvertReport(void *buffer, UInt8 packetSize, bool guide)
+{
+    XBOXONE_ELITE_IN_REPORT *reportXone = (XBOXONE_ELITE_IN_REPORT*)buffer;
+    XBOX360_IN_REPORT *report360 = (XBOX360_IN_REPORT*)buffer;
+    UInt8 trigL = 0, trigR = 0;
+    UInt16 buttons;
+    XBOX360_HAT left, right;
+
+    if (packetSize == XBOXONE_SIZE_FIGHTSTICK)
+    {
+        if ((0x80 & reportXone->true_trigR) == 0x80) { trigL = 255; }
+        if ((0x40 & reportXone->true_trigR) == 0x40) { trigR = 255; }
+    }
+    else
+    {
+        trigL = (reportXone->trigL * 255) / 1023;
+        trigR = (reportXone->trigR * 255) / 1023;
+    }
+    buttons = reportXone->buttons;
+    left = reportXone->left;
+    right = reportXone->right;
+
+    report360->header.command = 0x00;
+    report360->header.size = 0x14;
+    report360->buttons = XboxOne_ConvertButtons(buttons, guide);
+    report360->trigL = trigL;
+    report360->trigR = trigR;
+    report360->left = left;
+    report360->right = right;
+}
+
+#endif // __XBOXONE_H__
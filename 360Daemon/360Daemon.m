@@ -165,11 +165,11 @@ static void callbackConnected(void *param,io_iterator_t iterator)
                 c = 0x0a;
                 if (serialNumber != nil)
                 {
-                    for (i = 0; i < 4; i++)
+                    for (i = 0; i < kDaemonLEDSlots; i++)
                     {
                         if ([leds serialNumberAtLEDIsBlank:i] || ([[leds serialNumberAtLED:i] caseInsensitiveCompare:serialNumber] == NSOrderedSame))
                         {
-                            c = 0x06 + i;
+                            c = 0x06 + (i % 4);
                             if ([leds serialNumberAtLEDIsBlank:i]) {
                                 [leds setLED:i toSerialNumber:serialNumber];
                                 // NSLog(@"Added controller with LED %i", i);
@@ -235,7 +235,7 @@ static void callbackDisconnected(void *param, io_iterator_t iterator)
         serial = GetSerialNumber(object);
         if (serial != nil)
         {
-            for (i = 0; i < 4; i++)
+            for (i = 0; i < kDaemonLEDSlots; i++)
             {
                 if ([leds serialNumberAtLEDIsBlank:i])
                     continue;
@@ -8,6 +8,9 @@
 
 #import <Foundation/Foundation.h>
 
+// Player slots tracked across all receivers; the pad lights LED (slot % 4)
+#define kDaemonLEDSlots 16
+
 @interface DaemonLEDs : NSObject
 - (void)setLED:(int)theLED toSerialNumber:(NSString*)serialNum;
 - (NSString *)serialNumberAtLED:(int)theLED;
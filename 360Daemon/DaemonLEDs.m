@@ -9,110 +9,46 @@
 #import "DaemonLEDs.h"
 
 @interface DaemonLEDs ()
-@property (copy) NSString *theLED0;
-@property (copy) NSString *theLED1;
-@property (copy) NSString *theLED2;
-@property (copy) NSString *theLED3;
+@property (strong) NSMutableArray *serialNumbers;
 @end
 
 @implementation DaemonLEDs
 
-- (void)setLED:(int)theLED toSerialNumber:(NSString*)serialNum
+- (instancetype)init
 {
-	switch (theLED) {
-		case 0:
-			self.theLED0 = serialNum;
-			break;
-
-		case 1:
-			self.theLED1 = serialNum;
-			break;
-
-		case 2:
-			self.theLED2 = serialNum;
-			break;
-
-		case 3:
-			self.theLED3 = serialNum;
-			break;
-
-		default:
-			break;
+	if (self = [super init]) {
+		self.serialNumbers = [NSMutableArray arrayWithCapacity:kDaemonLEDSlots];
+		for (int i = 0; i < kDaemonLEDSlots; i++)
+			[self.serialNumbers addObject:[NSNull null]];
 	}
+	return self;
 }
 
-- (NSString *)serialNumberAtLED:(int)theLED
+- (void)setLED:(int)theLED toSerialNumber:(NSString*)serialNum
 {
-	switch (theLED) {
-		case 0:
-			return self.theLED0;
-			break;
-
-		case 1:
-			return self.theLED1;
-			break;
-
-		case 2:
-			return self.theLED2;
-			break;
-
-		case 3:
-			return self.theLED3;
-			break;
+	if (theLED < 0 || theLED >= kDaemonLEDSlots)
+		return;
+	self.serialNumbers[theLED] = serialNum ? [serialNum copy] : [NSNull null];
+}
 
-		default:
-			return @"";
-			break;
-	}
+- (NSString *)serialNumberAtLED:(int)theLED
+{
+	if (theLED < 0 || theLED >= kDaemonLEDSlots)
+		return @"";
+	id serialNum = self.serialNumbers[theLED];
+	return serialNum == [NSNull null] ? nil : serialNum;
 }
 
 - (BOOL)serialNumberAtLEDIsBlank:(int)theLED
 {
-	switch (theLED) {
-		case 0:
-			return self.theLED0 == nil;
-			break;
-
-		case 1:
-			return self.theLED1 == nil;
-			break;
-
-		case 2:
-			return self.theLED2 == nil;
-			break;
-
-		case 3:
-			return self.theLED3 == nil;
-			break;
-
-		default:
-			return NO;
-			break;
-	}
+	if (theLED < 0 || theLED >= kDaemonLEDSlots)
+		return NO;
+	return self.serialNumbers[theLED] == [NSNull null];
 }
 
 - (void)clearSerialNumberAtLED:(int)theLED
 {
-	switch (theLED) {
-		case 0:
-			self.theLED0 = nil;
-			break;
-
-		case 1:
-			self.theLED1 = nil;
-			break;
-
-		case 2:
-			self.theLED2 = nil;
-			break;
-
-		case 3:
-			self.theLED3 = nil;
-			break;
-
-		default:
-			break;
-	}
+	[self setLED:theLED toSerialNumber:nil];
 }
 
 @end
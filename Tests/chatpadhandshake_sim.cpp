@@ -0,0 +1,155 @@
+/*
+ MICE Xbox 360 Controller driver for Mac OS X
+ Copyright (C) 2006-2013 Colin Munro
+
+ chatpadhandshake_sim.cpp - runs the chatpad handshake against a simulated chatpad
+
+ This file is part of Xbox360Controller.
+
+ Xbox360Controller is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ Xbox360Controller is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with Foobar; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include <stdio.h>
+#include <string.h>
+#include "hosttest.h"
+#include "chatpadhandshake.h"
+
+// Simulated time runs in milliseconds, and gives up after this long
+#define SIM_LIMIT       60000
+#define SIM_REPLIES     4096
+
+// A chatpad that answers each command after a delay, as long as it's
+// plugged in and has booted
+typedef struct SimChatPad {
+    unsigned int latency;       // ms from a command to the chatpad's reply
+    unsigned int boot;          // ms before it answers anything
+    unsigned int unplug;        // ms at which it goes away, 0 for never
+} SimChatPad;
+
+typedef struct SimResult {
+    int connected;              // ms when evConnected came, -1 if it didn't
+    int disconnected;           // ms when evDisconnected came, -1 if it didn't
+    int commands;               // Commands sent before connecting
+    int probes;                 // Toggles sent while nothing was there
+} SimResult;
+
+// Drives the handshake the way ChatPadTimerAction does: each step runs at its
+// deadline and is told whether anything arrived since the step before
+static SimResult Simulate(const SimChatPad &pad, unsigned int limit)
+{
+    static unsigned int replies[SIM_REPLIES];
+    ChatPadHandshake handshake;
+    SimResult result = { -1, -1, 0, 0 };
+    unsigned int now, previous = 0;
+    int count = 0;
+
+    now = handshake.startDelay();
+    while (now < limit)
+    {
+        bool heard = false;
+        for (int i = 0; i < count; i++)
+        {
+            if ((replies[i] > previous) && (replies[i] <= now))
+                heard = true;
+        }
+
+        ChatPadHandshake::ACTION action = handshake.step(heard);
+        if (action.send)
+        {
+            if (result.connected == -1)
+                result.commands++;
+            if (!heard && !handshake.isActive() && (result.connected == -1))
+                result.probes++;
+            bool present = (now >= pad.boot) && ((pad.unplug == 0) || (now < pad.unplug));
+            if (present && (count < SIM_REPLIES))
+                replies[count++] = now + pad.latency;
+        }
+        if ((action.event == ChatPadHandshake::evConnected) && (result.connected == -1))
+            result.connected = now;
+        if ((action.event == ChatPadHandshake::evDisconnected) && (result.disconnected == -1))
+            result.disconnected = now;
+        previous = now;
+        now += action.delay;
+    }
+    return result;
+}
+
+// Time to active for a range of chatpad latencies, the numbers to watch
+// when the handshake's delays are changed
+static void Benchmark(void)
+{
+    static const unsigned int latencies[] = { 1, 10, 35, 50, 100, 150, 200, 300, 500, 800 };
+
+    printf("latency ms   active ms   commands\n");
+    for (unsigned int i = 0; i < sizeof(latencies) / sizeof(latencies[0]); i++)
+    {
+        SimChatPad pad = { latencies[i], 0, 0 };
+        SimResult result = Simulate(pad, SIM_LIMIT);
+
+        printf("%10u   %9d   %8d\n", latencies[i], result.connected, result.commands);
+    }
+}
+
+static void TestConnect(void)
+{
+    // A quick chatpad is up after one toggle period and a reset sequence
+    SimChatPad quick = { 5, 0, 0 };
+    SimResult result = Simulate(quick, SIM_LIMIT);
+    CHECK(result.connected != -1);
+    CHECK(result.connected < 2500);
+    CHECK(result.disconnected == -1);
+
+    // Slower firmware takes another reset sequence, but it still gets there
+    SimChatPad slow = { 300, 0, 0 };
+    result = Simulate(slow, SIM_LIMIT);
+    CHECK(result.connected != -1);
+    CHECK(result.connected < 4000);
+    CHECK(result.disconnected == -1);
+
+    // One that takes a while to boot is found by the probing
+    SimChatPad late = { 20, 5000, 0 };
+    result = Simulate(late, SIM_LIMIT);
+    CHECK(result.connected > 5000);
+    CHECK(result.connected < 12000);
+}
+
+static void TestAbsent(void)
+{
+    // Nothing there, nothing connects, but it keeps probing once a period
+    SimChatPad absent = { 5, SIM_LIMIT, 0 };
+    SimResult result = Simulate(absent, SIM_LIMIT);
+    CHECK(result.connected == -1);
+    CHECK(result.disconnected == -1);
+    CHECK(result.probes >= (SIM_LIMIT / 1000) - 2);
+}
+
+static void TestUnplug(void)
+{
+    // Pulled out once active, it's dropped within the miss budget
+    SimChatPad pulled = { 5, 0, 10000 };
+    SimResult result = Simulate(pulled, SIM_LIMIT);
+    CHECK(result.connected != -1);
+    CHECK(result.disconnected > 10000);
+    CHECK(result.disconnected < 14000);
+}
+
+int main(int argc, char *argv[])
+{
+    TestConnect();
+    TestAbsent();
+    TestUnplug();
+    if ((argc > 1) && (strcmp(argv[1], "-b") == 0))
+        Benchmark();
+    return HostTestResult("chatpadhandshake");
+}
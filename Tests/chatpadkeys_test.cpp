@@ -0,0 +1,140 @@
+/*
+ MICE Xbox 360 Controller driver for Mac OS X
+ Copyright (C) 2006-2013 Colin Munro
+
+ chatpadkeys_test.cpp - checks the chatpad keymap and key state diffing
+
+ This file is part of Xbox360Controller.
+
+ Xbox360Controller is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ Xbox360Controller is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with Foobar; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include <string.h>
+#include "hosttest.h"
+#include "chatpadkeys.h"
+
+// Serial codes, column in the high nibble and row in the low
+#define CODE_1      0x17
+#define CODE_A      0x37
+#define CODE_Q      0x27
+#define CODE_SPACE  0x54
+#define CODE_ENTER  0x63
+
+// Keyboard usages
+#define USAGE_A     0x04
+#define USAGE_Q     0x14
+#define USAGE_1     0x1E
+#define USAGE_ENTER 0x28
+#define USAGE_SPACE 0x2C
+
+static bool IsPressed(const CHATPAD_KEYS *state, unsigned char usage)
+{
+    return (state->keys[usage >> 3] & (1 << (usage & 0x07))) != 0;
+}
+
+static int PressedCount(const CHATPAD_KEYS *state)
+{
+    int count = 0;
+
+    for (int i = 0; i < CHATPAD_KEY_BYTES * 8; i++)
+    {
+        if (IsPressed(state, i))
+            count++;
+    }
+    return count;
+}
+
+static void TestKeymap(void)
+{
+    bool used[256];
+
+    CHECK(ChatPad2USB(CODE_1) == USAGE_1);
+    CHECK(ChatPad2USB(CODE_A) == USAGE_A);
+    CHECK(ChatPad2USB(CODE_Q) == USAGE_Q);
+    CHECK(ChatPad2USB(CODE_SPACE) == USAGE_SPACE);
+    CHECK(ChatPad2USB(CODE_ENTER) == USAGE_ENTER);
+    CHECK(ChatPad2USB(0x00) == 0x00);
+
+    // Every usage fits the bitmap and no two keys share one
+    memset(used, 0, sizeof(used));
+    for (int code = 0; code < 256; code++)
+    {
+        unsigned char usage = ChatPad2USB(code);
+
+        // Only the low half of the codes has keys
+        if (code >= 0x80)
+            CHECK(usage == 0x00);
+        if (usage == 0x00)
+            continue;
+        CHECK(usage < CHATPAD_KEY_BYTES * 8);
+        CHECK(!used[usage]);
+        used[usage] = true;
+    }
+}
+
+static void TestDiff(void)
+{
+    CHATPAD_KEYS state;
+    const unsigned char none[] = { 0x00, 0x00, 0x00 };
+    const unsigned char a[] = { CODE_A, 0x00, 0x00 };
+    const unsigned char aq[] = { CODE_A, CODE_Q, 0x00 };
+    const unsigned char qa[] = { CODE_Q, CODE_A, 0x00 };
+    const unsigned char four[] = { CODE_1, CODE_A, CODE_Q, CODE_SPACE };
+    const unsigned char unmapped[] = { 0x90, 0x00, 0x00 };
+
+    memset(&state, 0, sizeof(state));
+
+    // Nothing held, nothing to report
+    CHECK(!ChatPadUpdateKeys(&state, 0x00, none, 3));
+
+    // A press is reported once, repeats of the same packet aren't
+    CHECK(ChatPadUpdateKeys(&state, 0x00, a, 3));
+    CHECK(IsPressed(&state, USAGE_A));
+    CHECK(PressedCount(&state) == 1);
+    CHECK(!ChatPadUpdateKeys(&state, 0x00, a, 3));
+
+    // The order keys come in doesn't matter
+    CHECK(ChatPadUpdateKeys(&state, 0x00, aq, 3));
+    CHECK(!ChatPadUpdateKeys(&state, 0x00, qa, 3));
+    CHECK(PressedCount(&state) == 2);
+
+    // Modifiers on their own are a change, the padding bits aren't
+    CHECK(ChatPadUpdateKeys(&state, 0x01, qa, 3));
+    CHECK(state.modifiers == 0x01);
+    CHECK(!ChatPadUpdateKeys(&state, 0xF1, qa, 3));
+    CHECK(state.modifiers == 0x01);
+
+    // Release
+    CHECK(ChatPadUpdateKeys(&state, 0x00, none, 3));
+    CHECK(PressedCount(&state) == 0);
+    CHECK(state.modifiers == 0x00);
+
+    // More keys than the serial packet's three slots
+    CHECK(ChatPadUpdateKeys(&state, 0x00, four, 4));
+    CHECK(PressedCount(&state) == 4);
+    CHECK(IsPressed(&state, USAGE_1));
+    CHECK(IsPressed(&state, USAGE_SPACE));
+
+    // Codes without a key are ignored
+    CHECK(ChatPadUpdateKeys(&state, 0x00, unmapped, 3));
+    CHECK(PressedCount(&state) == 0);
+    CHECK(!ChatPadUpdateKeys(&state, 0x00, unmapped, 3));
+}
+
+int main(void)
+{
+    TestKeymap();
+    TestDiff();
+    return HostTestResult("chatpadkeys");
+}
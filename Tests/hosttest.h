@@ -0,0 +1,61 @@
+/*
+ MICE Xbox 360 Controller driver for Mac OS X
+ Copyright (C) 2006-2013 Colin Munro
+
+ hosttest.h - checks shared by the tests that run on the build machine
+
+ This file is part of Xbox360Controller.
+
+ Xbox360Controller is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ Xbox360Controller is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with Foobar; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef __HOSTTEST_H__
+#define __HOSTTEST_H__
+
+#include <stdio.h>
+#include <stdint.h>
+
+// I/O Kit's integer types, for the driver headers that use them
+typedef uint8_t UInt8;
+typedef uint16_t UInt16;
+typedef int16_t SInt16;
+typedef uint32_t UInt32;
+typedef int32_t SInt32;
+
+// I/O Kit's compare and swap, a full barrier like the kernel's
+static inline bool OSCompareAndSwap(UInt32 oldValue, UInt32 newValue, volatile UInt32 *address)
+{
+    return __sync_bool_compare_and_swap(address, oldValue, newValue);
+}
+
+// Failed checks are reported and counted, so one run shows all of them
+static int hostFailures = 0;
+
+#define CHECK(x) \
+    do { \
+        if (!(x)) \
+        { \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #x); \
+            hostFailures++; \
+        } \
+    } while (0)
+
+// Returned from main
+static inline int HostTestResult(const char *name)
+{
+    printf("%s: %s\n", name, (hostFailures == 0) ? "ok" : "FAILED");
+    return (hostFailures == 0) ? 0 : 1;
+}
+
+#endif // __HOSTTEST_H__
@@ -0,0 +1,109 @@
+/*
+ MICE Xbox 360 Controller driver for Mac OS X
+ Copyright (C) 2006-2013 Colin Munro
+
+ onebringup_test.cpp - checks the Xbox One receiver bring-up table
+
+ This file is part of Xbox360Controller.
+
+ Xbox360Controller is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ Xbox360Controller is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with Foobar; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include <string.h>
+#include "hosttest.h"
+#include "onepackets.h"
+#include "onebringup.h"
+
+// OneWirelessGamingReceiver::bringUpBuffer, which control transfers go through
+#define BRINGUP_BUFFER  8
+
+// The receiver's address as it appeared in the trace
+static const unsigned char traceAddress[] = { 0x62, 0x45, 0xb4, 0xea };
+
+static void TestSteps(void)
+{
+    for (unsigned int i = 0; i < ONE_BRINGUP_STEPS; i++)
+    {
+        const OneStep *step = &kOneBringUp[i];
+        unsigned int count = (step->count == 0) ? 1 : step->count;
+
+        switch (step->type)
+        {
+            case ONE_STEP_IN:
+            case ONE_STEP_OUT:
+                // A write may carry no data, a read always has its answer
+                CHECK((step->data != NULL) == (step->length != 0));
+                CHECK(step->length <= BRINGUP_BUFFER);
+                if (step->type == ONE_STEP_IN)
+                    CHECK(step->length != 0);
+                CHECK(step->index + (count - 1) * step->stride <= 0xFFFF);
+                break;
+
+            case ONE_STEP_FIRMWARE:
+                CHECK((step->data != NULL) && (step->length != 0));
+                break;
+
+            case ONE_STEP_SEND:
+                CHECK((step->data != NULL) && (step->length != 0));
+                CHECK(step->length <= ONE_PACKET_MAX);
+                break;
+
+            case ONE_STEP_WAIT:
+                CHECK(step->delay != 0);
+                break;
+
+            default:
+                CHECK(!"unknown step type");
+                break;
+        }
+
+        // Only reads are compared, and a read is either skipped or polled
+        CHECK((step->flags & ~(ONE_STEP_UNCHECKED | ONE_STEP_POLL)) == 0);
+        if (step->type != ONE_STEP_IN)
+            CHECK(step->flags == 0);
+        CHECK((step->flags & (ONE_STEP_UNCHECKED | ONE_STEP_POLL)) != (ONE_STEP_UNCHECKED | ONE_STEP_POLL));
+    }
+}
+
+// A wrong answer only stops the bring-up on a status poll, so those must
+// be reads of the firmware status registers, and anything that holds the
+// traced receiver's own address must not be compared at all
+static void TestChecks(void)
+{
+    int polls = 0;
+
+    for (unsigned int i = 0; i < ONE_BRINGUP_STEPS; i++)
+    {
+        const OneStep *step = &kOneBringUp[i];
+
+        if (step->type != ONE_STEP_IN)
+            continue;
+        if (step->flags & ONE_STEP_POLL)
+        {
+            CHECK(step->request == 71);
+            CHECK((step->index == 0x0230) || (step->index == 0x0234));
+            polls++;
+        }
+        if ((step->length == sizeof(traceAddress)) && (memcmp(step->data, traceAddress, sizeof(traceAddress)) == 0))
+            CHECK(step->flags & ONE_STEP_UNCHECKED);
+    }
+    CHECK(polls != 0);
+}
+
+int main(void)
+{
+    TestSteps();
+    TestChecks();
+    return HostTestResult("onebringup");
+}
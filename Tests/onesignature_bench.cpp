@@ -0,0 +1,128 @@
+/*
+ MICE Xbox 360 Controller driver for Mac OS X
+ Copyright (C) 2006-2013 Colin Munro
+
+ onesignature_bench.cpp - checks and times Xbox One receiver message classification
+
+ This file is part of Xbox360Controller.
+
+ Xbox360Controller is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ Xbox360Controller is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with Foobar; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include "hosttest.h"
+#include "onesignature.h"
+
+// The messages OneWirelessGamingReceiver::ProcessMessage switches on, then the
+// responses PairingStep waits for, which fall through to the transactions
+static const unsigned int handled[] = {
+    ONE_SIGNATURE(0x04, 0x00, 0x40, 0x4a),
+    ONE_SIGNATURE(0x48, 0x00, 0x08, 0x00),
+    ONE_SIGNATURE(0x44, 0x00, 0x08, 0x00),
+    ONE_SIGNATURE(0x50, 0x00, 0xc0, 0x4a),
+    ONE_SIGNATURE(0x5c, 0x00, 0xc0, 0x4a),
+    ONE_SIGNATURE(0x7c, 0x00, 0xc0, 0x4a),
+    ONE_SIGNATURE(0x6c, 0x00, 0xc0, 0x4a),
+    ONE_SIGNATURE(0x44, 0x00, 0xc0, 0x4a),
+    ONE_SIGNATURE(0x4c, 0x00, 0xc0, 0x4a),
+};
+static const unsigned int awaited[] = {
+    ONE_SIGNATURE(0x08, 0x00, 0x0d, 0x4a),
+    ONE_SIGNATURE(0x08, 0x00, 0x0e, 0x4a),
+    ONE_SIGNATURE(0x3c, 0x00, 0x08, 0x00),
+};
+
+#define COUNT(a) (int)(sizeof(a) / sizeof(a[0]))
+
+// The same shape as ProcessMessage: a switch for the handled messages, and a
+// bucket for the rest
+static int Classify(const unsigned char *data)
+{
+    unsigned int signature = OneSignature(data);
+
+    switch (signature)
+    {
+        case ONE_SIGNATURE(0x04, 0x00, 0x40, 0x4a): return 0;
+        case ONE_SIGNATURE(0x48, 0x00, 0x08, 0x00): return 1;
+        case ONE_SIGNATURE(0x44, 0x00, 0x08, 0x00): return 2;
+        case ONE_SIGNATURE(0x50, 0x00, 0xc0, 0x4a): return 3;
+        case ONE_SIGNATURE(0x5c, 0x00, 0xc0, 0x4a): return 4;
+        case ONE_SIGNATURE(0x7c, 0x00, 0xc0, 0x4a): return 5;
+        case ONE_SIGNATURE(0x6c, 0x00, 0xc0, 0x4a): return 6;
+        case ONE_SIGNATURE(0x44, 0x00, 0xc0, 0x4a): return 7;
+        case ONE_SIGNATURE(0x4c, 0x00, 0xc0, 0x4a): return 8;
+        default: return 16 + OneTransactionBucket(signature);
+    }
+}
+
+static void TestSignature(void)
+{
+    const unsigned char data[] = { 0x7c, 0x00, 0xc0, 0x4a, 0x01 };
+
+    CHECK(OneSignature(data) == 0x7c00c04a);
+    CHECK(ONE_SIGNATURE(0xff, 0xff, 0xff, 0xff) == 0xffffffff);
+    for (int i = 0; i < COUNT(handled); i++)
+    {
+        for (int j = 0; j < i; j++)
+            CHECK(handled[i] != handled[j]);
+        for (int j = 0; j < COUNT(awaited); j++)
+            CHECK(handled[i] != awaited[j]);
+    }
+}
+
+static void TestBuckets(void)
+{
+    for (unsigned int s = 0; s < 0x10000; s++)
+    {
+        int bucket = OneTransactionBucket(s * 0x9e3779b1U);
+        CHECK((bucket >= 0) && (bucket < ONE_TRANSACTION_BUCKETS));
+    }
+    // Every byte counts, so messages differing in any one land apart
+    for (int shift = 0; shift < 32; shift += 8)
+        CHECK(OneTransactionBucket(0x08000d4a) != OneTransactionBucket(0x08000d4a ^ (1U << shift)));
+}
+
+// Nanoseconds to classify a packet, over a mix like a paired pad's traffic:
+// mostly input and status, with the odd pairing response
+static void Benchmark(void)
+{
+    const int rounds = 10000000;
+    unsigned char packets[16][4];
+    volatile int sink = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        unsigned int signature = (i < 12) ? handled[i % 3] : (i < 15) ? awaited[i - 12] : 0x12345678;
+        packets[i][0] = signature >> 24;
+        packets[i][1] = signature >> 16;
+        packets[i][2] = signature >> 8;
+        packets[i][3] = signature;
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++)
+        sink = sink + Classify(packets[i & 15]);
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    printf("classify: %.2f ns per packet\n", (double)elapsed.count() / rounds);
+}
+
+int main(int argc, char *argv[])
+{
+    TestSignature();
+    TestBuckets();
+    if ((argc > 1) && (strcmp(argv[1], "-b") == 0))
+        Benchmark();
+    return HostTestResult("onesignature");
+}
@@ -0,0 +1,369 @@
+/*
+ MICE Xbox 360 Controller driver for Mac OS X
+ Copyright (C) 2006-2013 Colin Munro
+
+ wirelesslink_replay.cpp - replays receiver traffic through the connection state machine
+
+ This file is part of Xbox360Controller.
+
+ Xbox360Controller is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ Xbox360Controller is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with Foobar; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include <stdio.h>
+#include <string.h>
+#include "hosttest.h"
+#include "wirelesslink.h"
+
+#define PACKET_MAX  32
+
+// One packet as the receiver read it, with the milliseconds since the
+// receiver was plugged in
+typedef struct TRACE {
+    unsigned int time;
+    const char *hex;
+} TRACE;
+
+// What ProcessMessage would have done to one connection
+typedef struct REPLAY {
+    WirelessLink link;
+    bool service, registered;
+    int created, torndown, terminated;
+    int queued;                 // Waiting for the HID driver
+    int delivered;              // Reached the HID driver, queued or not
+    int dispatched;             // Of those, handed over without queueing
+    int firstInput;             // Time the first report reached the HID driver, -1 if none yet
+    int rejected;               // Guesses the info packet showed to be wrong
+    char serial[10];            // Registered as
+    char previous[10];          // Last controller confirmed on the connection, empty if none
+} REPLAY;
+
+static int FromHex(const char *hex, unsigned char *data)
+{
+    int length = 0;
+    unsigned int byte;
+
+    while ((length < PACKET_MAX) && (sscanf(hex, "%2x", &byte) == 1))
+    {
+        data[length++] = byte;
+        hex += 2;
+        while (*hex == ' ')
+            hex++;
+    }
+    return length;
+}
+
+// Carries out the actions in the same order as WirelessGamingReceiver::ProcessMessage.
+// Once registered, the HID driver is taken to start at once and drain the queue.
+static void Replay(REPLAY *replay, const TRACE *trace)
+{
+    unsigned char data[PACKET_MAX];
+    int length = FromHex(trace->hex, data);
+    WirelessLink::PACKET packet = WirelessLink::classify(data, length);
+    unsigned int actions = replay->link.receive(packet);
+
+    if (actions & WirelessLink::acTeardown)
+    {
+        if (replay->service)
+        {
+            replay->torndown++;
+            if (actions & WirelessLink::acTerminate)
+                replay->terminated++;
+        }
+        replay->service = false;
+        replay->registered = false;
+        replay->queued = 0;
+        replay->link.disconnected();
+        return;
+    }
+    if (actions & WirelessLink::acCreate)
+    {
+        if (!replay->service)
+            replay->created++;
+        replay->service = true;
+        if ((packet != WirelessLink::pkInfo) && (replay->previous[0] != '\0'))
+        {
+            strcpy(replay->serial, replay->previous);
+            replay->link.recognised();
+        }
+    }
+    if (actions & WirelessLink::acConfirm)
+    {
+        char serial[10];
+
+        if (WirelessLink::serialNumber(data, length, serial, sizeof(serial)) &&
+            (strcmp(serial, replay->serial) != 0))
+        {
+            // Torn down and started over from this packet
+            replay->rejected++;
+            replay->torndown++;
+            replay->terminated++;
+            replay->service = false;
+            replay->registered = false;
+            replay->queued = 0;
+            replay->previous[0] = '\0';
+            replay->link.disconnected();
+            Replay(replay, trace);
+            return;
+        }
+    }
+    if (actions & WirelessLink::acDispatch)
+    {
+        if (replay->registered && (replay->queued == 0))
+        {
+            replay->delivered++;
+            replay->dispatched++;
+            if ((packet == WirelessLink::pkHID) && (replay->firstInput == -1))
+                replay->firstInput = trace->time;
+            return;
+        }
+        actions |= WirelessLink::acQueue;
+    }
+    if (actions & WirelessLink::acQueue)
+        replay->queued++;
+    if ((actions & WirelessLink::acRegister) && replay->service)
+    {
+        if (packet == WirelessLink::pkInfo)
+        {
+            WirelessLink::serialNumber(data, length, replay->serial, sizeof(replay->serial));
+            strcpy(replay->previous, replay->serial);
+        }
+        replay->registered = true;
+    }
+    if (replay->registered && (replay->queued != 0))
+    {
+        // The HID driver drains what was queued before it started
+        replay->delivered += replay->queued;
+        replay->queued = 0;
+        if (replay->firstInput == -1)
+            replay->firstInput = trace->time;
+    }
+}
+
+// Replays traffic on a connection, which may remember the controller it last saw
+static void ReplayFrom(REPLAY *replay, const char *previous, const TRACE *traces, int count)
+{
+    *replay = REPLAY();
+    replay->firstInput = -1;
+    strcpy(replay->previous, previous);
+    for (int i = 0; i < count; i++)
+        Replay(replay, &traces[i]);
+}
+
+static void ReplayAll(REPLAY *replay, const TRACE *traces, int count)
+{
+    ReplayFrom(replay, "", traces, count);
+}
+
+// Replays more traffic on a connection that has seen a controller before
+static void ReplayAgain(REPLAY *replay, const TRACE *traces, int count)
+{
+    char previous[10];
+
+    strcpy(previous, replay->previous);
+    ReplayFrom(replay, previous, traces, count);
+}
+
+#define LINK        "08 80"
+#define UNLINK      "08 00"
+#define INFO        "00 0f 00 f0 f0 cc fd 45 1a 20 12 34 ab cd 00 00 13 a2 10 01 00 00 00 00 00 00 00 00 00"
+#define REPORT      "00 01 00 f0 00 13 00 00 00 00 12 34 56 78 9a bc de f0 00 00 00 00 00 00 00 00 00 00 00"
+#define REPORT2     "00 01 00 f0 00 13 10 00 ff 00 12 34 56 78 9a bc de f0 00 00 00 00 00 00 00 00 00 00 00"
+#define BATTERY     "00 00 00 13 a2 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00"
+#define HIDINFO     "00 01 00 f0 00 f0 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00"
+
+// A pad switched on next to a receiver that's already running
+static const TRACE powerOn[] = {
+    {    0, LINK },
+    {    3, HIDINFO },
+    {   18, BATTERY },
+    {   41, INFO },
+    {   48, REPORT },
+    {   56, REPORT2 },
+    {   64, REPORT },
+    { 9000, UNLINK },
+};
+
+// The receiver plugged in with a pad already on, so the link message was missed
+static const TRACE alreadyOn[] = {
+    {    0, REPORT },
+    {    8, REPORT2 },
+    {   20, INFO },
+    {   28, REPORT },
+};
+
+// Switched off again before it had sent its info
+static const TRACE gaveUp[] = {
+    {    0, LINK },
+    {    5, REPORT },
+    {  200, UNLINK },
+    {  210, REPORT },
+    {  900, LINK },
+    {  930, INFO },
+    {  940, REPORT },
+};
+
+// Another pad switched on, using the connection the first one had
+#define INFO2       "00 0f 00 f0 f0 cc fd 45 1a 20 55 66 77 88 00 00 13 a2 10 01 00 00 00 00 00 00 00 00 00"
+static const TRACE otherPad[] = {
+    {    0, LINK },
+    {    3, HIDINFO },
+    {    9, REPORT },
+    {   41, INFO2 },
+    {   48, REPORT },
+};
+
+#define COUNT(a) (int)(sizeof(a) / sizeof(a[0]))
+
+static void TestClassify(void)
+{
+    unsigned char data[PACKET_MAX];
+    char serial[10];
+
+    CHECK(WirelessLink::classify(data, FromHex(LINK, data)) == WirelessLink::pkLink);
+    CHECK(WirelessLink::classify(data, FromHex("08 c0", data)) == WirelessLink::pkLink);
+    CHECK(WirelessLink::classify(data, FromHex(UNLINK, data)) == WirelessLink::pkUnlink);
+    CHECK(WirelessLink::classify(data, FromHex(INFO, data)) == WirelessLink::pkInfo);
+    CHECK(WirelessLink::classify(data, FromHex(REPORT, data)) == WirelessLink::pkHID);
+    CHECK(WirelessLink::classify(data, FromHex(BATTERY, data)) == WirelessLink::pkUpdate);
+    CHECK(WirelessLink::classify(data, FromHex("00", data)) == WirelessLink::pkOther);
+    CHECK(WirelessLink::classify(data, FromHex("00 02 00", data)) == WirelessLink::pkOther);
+
+    CHECK(WirelessLink::serialNumber(data, FromHex(INFO, data), serial, sizeof(serial)));
+    CHECK(strcmp(serial, "1234ABCD") == 0);
+    CHECK(!WirelessLink::serialNumber(data, FromHex(LINK, data), serial, sizeof(serial)));
+    CHECK(!WirelessLink::serialNumber(data, FromHex(INFO, data), serial, 8));
+}
+
+static void TestPowerOn(void)
+{
+    REPLAY replay;
+
+    ReplayAll(&replay, powerOn, COUNT(powerOn) - 1);
+    CHECK(replay.created == 1);
+    CHECK(replay.registered);
+    CHECK(strcmp(replay.serial, "1234ABCD") == 0);
+    // Nothing is lost, and reports after registering skip the queue
+    CHECK(replay.delivered == COUNT(powerOn) - 2);
+    CHECK(replay.dispatched == 3);
+    CHECK(replay.firstInput == 41);
+    CHECK(replay.link.getState() == WirelessLink::lsActive);
+
+    Replay(&replay, &powerOn[COUNT(powerOn) - 1]);
+    CHECK(replay.torndown == 1);
+    CHECK(replay.terminated == 1);
+    CHECK(replay.link.getState() == WirelessLink::lsEmpty);
+}
+
+static void TestAlreadyOn(void)
+{
+    REPLAY replay;
+
+    ReplayAll(&replay, alreadyOn, COUNT(alreadyOn));
+    CHECK(replay.created == 1);
+    CHECK(replay.registered);
+    CHECK(replay.delivered == COUNT(alreadyOn));
+    CHECK(replay.firstInput == 20);
+}
+
+static void TestGaveUp(void)
+{
+    REPLAY replay;
+
+    ReplayAll(&replay, gaveUp, 3);
+    // Never registered, so it's only detached
+    CHECK(replay.torndown == 1);
+    CHECK(replay.terminated == 0);
+    CHECK(replay.delivered == 0);
+
+    ReplayAll(&replay, gaveUp, COUNT(gaveUp));
+    // The stray report after the unlink starts a node of its own, which the next link keeps
+    CHECK(replay.created == 2);
+    CHECK(replay.registered);
+    CHECK(replay.firstInput == 930);
+}
+
+// A controller the connection has seen before is live on its first report
+static void TestReturning(void)
+{
+    REPLAY replay;
+
+    ReplayAll(&replay, powerOn, COUNT(powerOn));
+    CHECK(strcmp(replay.previous, "1234ABCD") == 0);
+
+    ReplayAgain(&replay, powerOn, COUNT(powerOn) - 1);
+    CHECK(replay.rejected == 0);
+    CHECK(replay.created == 1);
+    CHECK(replay.registered);
+    CHECK(strcmp(replay.serial, "1234ABCD") == 0);
+    // Registered on the first report, the HID info packet before it was queued
+    CHECK(replay.firstInput == 3);
+    CHECK(replay.delivered == COUNT(powerOn) - 2);
+    CHECK(replay.link.getState() == WirelessLink::lsActive);
+}
+
+// A different controller on the same connection is started over once its info arrives
+static void TestOtherPad(void)
+{
+    REPLAY replay;
+
+    ReplayAll(&replay, powerOn, COUNT(powerOn));
+    ReplayAgain(&replay, otherPad, COUNT(otherPad));
+    CHECK(replay.rejected == 1);
+    CHECK(replay.created == 2);
+    CHECK(replay.terminated == 1);
+    CHECK(replay.registered);
+    CHECK(strcmp(replay.serial, "55667788") == 0);
+    CHECK(strcmp(replay.previous, "55667788") == 0);
+    CHECK(replay.link.getState() == WirelessLink::lsActive);
+}
+
+// The same traffic gives the same result every time
+static void TestDeterministic(void)
+{
+    REPLAY first, second;
+
+    ReplayAll(&first, powerOn, COUNT(powerOn));
+    ReplayAll(&second, powerOn, COUNT(powerOn));
+    CHECK(first.link.getState() == second.link.getState());
+    CHECK(first.created == second.created);
+    CHECK(first.torndown == second.torndown);
+    CHECK(first.delivered == second.delivered);
+    CHECK(first.dispatched == second.dispatched);
+    CHECK(first.firstInput == second.firstInput);
+    CHECK(strcmp(first.serial, second.serial) == 0);
+}
+
+int main(int argc, char *argv[])
+{
+    TestClassify();
+    TestPowerOn();
+    TestAlreadyOn();
+    TestGaveUp();
+    TestReturning();
+    TestOtherPad();
+    TestDeterministic();
+    if ((argc > 1) && (strcmp(argv[1], "-b") == 0))
+    {
+        REPLAY replay;
+
+        ReplayAll(&replay, powerOn, COUNT(powerOn));
+        printf("link to first input: %d ms\n", replay.firstInput - (int)powerOn[0].time);
+        ReplayAll(&replay, alreadyOn, COUNT(alreadyOn));
+        printf("first packet to first input, link missed: %d ms\n", replay.firstInput - (int)alreadyOn[0].time);
+        ReplayAll(&replay, powerOn, COUNT(powerOn));
+        ReplayAgain(&replay, powerOn, COUNT(powerOn));
+        printf("link to first input, returning controller: %d ms\n", replay.firstInput - (int)powerOn[0].time);
+    }
+    return HostTestResult("wirelesslink");
+}
@@ -0,0 +1,69 @@
+/*
+ MICE Xbox 360 Controller driver for Mac OS X
+ Copyright (C) 2006-2013 Colin Munro
+
+ wirelessslot_test.cpp - checks wireless controller location IDs don't collide
+
+ This file is part of Xbox360Controller.
+
+ Xbox360Controller is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ Xbox360Controller is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with Foobar; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "hosttest.h"
+#include "wirelessslot.h"
+
+// USB location IDs of receivers on one machine, including ones next to each
+// other on a hub, where the old owner + 1 + index scheme collided
+static const unsigned int owners[] = {
+    0x14100000, 0x14200000, 0x14110000, 0x14120000,
+    0x1a100000, 0x14111000, 0x14111100, 0x14111200,
+};
+#define OWNERS (int)(sizeof(owners) / sizeof(owners[0]))
+
+static void TestPacking(void)
+{
+    CHECK(WirelessSlotLocation(0x14100000, 0) == 0x14100010);
+    CHECK(WirelessSlotLocation(0x14100000, WIRELESS_SLOTS - 1) == 0x1410001F);
+    // Whatever was in the owner's low bits is replaced
+    CHECK(WirelessSlotLocation(0x1410001F, 3) == 0x14100013);
+    CHECK(WirelessSlotLocation(0xFFFFFFFF, 0) == 0xFFFFFFF0);
+}
+
+// Slots are handed out system-wide, so however the controllers are spread
+// over the receivers no two get the same ID, and none gets a receiver's
+static void TestUnique(void)
+{
+    unsigned int locations[WIRELESS_SLOTS];
+
+    for (int spread = 1; spread <= OWNERS; spread++)
+    {
+        for (int slot = 0; slot < WIRELESS_SLOTS; slot++)
+        {
+            locations[slot] = WirelessSlotLocation(owners[slot % spread], slot);
+            for (int i = 0; i < slot; i++)
+                CHECK(locations[i] != locations[slot]);
+            for (int i = 0; i < OWNERS; i++)
+                CHECK(locations[slot] != owners[i]);
+            // Still reads as a device under its receiver
+            CHECK((locations[slot] & ~0x1FU) == (owners[slot % spread] & ~0x1FU));
+        }
+    }
+}
+
+int main(void)
+{
+    TestPacking();
+    TestUnique();
+    return HostTestResult("wirelessslot");
+}
@@ -0,0 +1,274 @@
+/*
+ MICE Xbox 360 Controller driver for Mac OS X
+ Copyright (C) 2006-2013 Colin Munro
+
+ wirelessstress_sim.cpp - drives a full house of wireless controllers through the receiver queues
+
+ This file is part of Xbox360Controller.
+
+ Xbox360Controller is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ Xbox360Controller is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with Foobar; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "hosttest.h"
+#include "wirelesslink.h"
+#include "wirelessring.h"
+#include "wirelessslot.h"
+
+// Connections on each receiver, fixed by the hardware
+#define CONNECTIONS         4
+// Enough receivers for every system-wide slot
+#define RECEIVERS           (WIRELESS_SLOTS / CONNECTIONS)
+#define PADS                (RECEIVERS * CONNECTIONS)
+
+// Milliseconds between reports, as fast as a pad sends them
+#define REPORT_INTERVAL     8
+// One status packet in this many, like a battery update
+#define STATUS_EVERY        16
+// Where each packet carries its number, past anything the receiver looks at
+#define COUNTER_OFFSET      24
+
+#define PACKET_LENGTH       29
+
+static const unsigned char linkPacket[] = { 0x08, 0x80 };
+static const unsigned char infoPacket[PACKET_LENGTH] = {
+    0x00, 0x0f, 0x00, 0xf0, 0xf0, 0xcc, 0xfd, 0x45, 0x1a, 0x20, 0x12, 0x34, 0xab, 0xcd, 0x00, 0x00, 0x13, 0xa2, 0x10, 0x01,
+};
+static const unsigned char reportPacket[PACKET_LENGTH] = {
+    0x00, 0x01, 0x00, 0xf0, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0,
+};
+static const unsigned char statusPacket[PACKET_LENGTH] = {
+    0x00, 0x00, 0x00, 0x13, 0xa2,
+};
+
+// One controller, fed by its receiver's thread and read by a thread of its own
+typedef struct PAD {
+    WirelessLink link;
+    WGRQUEUE queue;
+    std::atomic<bool> done;     // Nothing more will be queued
+    // Written by the receiver thread
+    UInt32 sent;                // Numbered packets queued
+    int dropped[WIRELESS_RINGS];
+    int refused;
+    bool registered;            // The link stayed registered throughout
+    // Written by the reader thread
+    UInt32 received, expected, skipped;
+    int misordered, torn;
+} PAD;
+
+static PAD pads[PADS];
+
+static void Stamp(unsigned char *data, UInt32 counter)
+{
+    memcpy(data + COUNTER_OFFSET, &counter, sizeof(counter));
+}
+
+// What WirelessGamingReceiver::ProcessMessage does with the queue. Reports
+// it would hand straight to a running controller are queued here too, so
+// the rings see the full rate.
+static void Receive(PAD *pad, const unsigned char *data, int length)
+{
+    unsigned int actions = pad->link.receive(WirelessLink::classify(data, length));
+
+    if (actions & (WirelessLink::acQueue | WirelessLink::acDispatch))
+    {
+        if (!WirelessQueuePush(&pad->queue, data, length, pad->dropped))
+            pad->refused++;
+    }
+}
+
+// A receiver's read completion, taking packets from its pads in turn
+static void ReceiverThread(int receiver, UInt32 packets, bool paced)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    unsigned char data[PACKET_LENGTH];
+    PAD *pad;
+
+    for (int i = 0; i < CONNECTIONS; i++)
+    {
+        pad = &pads[(receiver * CONNECTIONS) + i];
+        Receive(pad, linkPacket, sizeof(linkPacket));
+        memcpy(data, infoPacket, sizeof(data));
+        data[0x0D] = (unsigned char)((receiver * CONNECTIONS) + i);
+        Stamp(data, pad->sent++);
+        Receive(pad, data, sizeof(data));
+    }
+    for (UInt32 tick = 0; tick < packets; tick++)
+    {
+        if (paced)
+            std::this_thread::sleep_until(start + std::chrono::milliseconds(tick * REPORT_INTERVAL));
+        for (int i = 0; i < CONNECTIONS; i++)
+        {
+            pad = &pads[(receiver * CONNECTIONS) + i];
+            if ((pad->sent % STATUS_EVERY) == (STATUS_EVERY - 1))
+                memcpy(data, statusPacket, sizeof(data));
+            else
+                memcpy(data, reportPacket, sizeof(data));
+            Stamp(data, pad->sent++);
+            Receive(pad, data, sizeof(data));
+            if (!pad->link.isRegistered())
+                pad->registered = false;
+        }
+    }
+    for (int i = 0; i < CONNECTIONS; i++)
+        pads[(receiver * CONNECTIONS) + i].done.store(true, std::memory_order_release);
+}
+
+// The HID driver draining the queue, checking every packet comes in order
+static void ReaderThread(PAD *pad)
+{
+    unsigned char data[WIRELESS_PACKET_SIZE];
+    UInt32 counter;
+    int length;
+
+    for (;;)
+    {
+        bool finished = pad->done.load(std::memory_order_acquire);
+
+        length = sizeof(data);
+        if (!WirelessQueuePop(&pad->queue, data, &length))
+        {
+            if (finished)
+                break;
+            std::this_thread::yield();
+            continue;
+        }
+        if (length != PACKET_LENGTH)
+        {
+            pad->torn++;
+            continue;
+        }
+        memcpy(&counter, data + COUNTER_OFFSET, sizeof(counter));
+        if (counter < pad->expected)
+        {
+            pad->misordered++;
+            continue;
+        }
+        // Reports and status packets sit in different rings, so a status
+        // packet coming out as the wrong kind means the rings were mixed up
+        if ((data[1] == 0x01) != ((counter % STATUS_EVERY) != (STATUS_EVERY - 1)) && (counter != 0))
+            pad->torn++;
+        pad->skipped += counter - pad->expected;
+        pad->expected = counter + 1;
+        pad->received++;
+    }
+}
+
+// Runs every pad for the given number of packets, returns the seconds it took
+static double Run(UInt32 packets, bool paced)
+{
+    std::thread receivers[RECEIVERS], readers[PADS];
+    std::chrono::steady_clock::time_point start;
+
+    for (int i = 0; i < PADS; i++)
+    {
+        PAD *pad = &pads[i];
+
+        pad->link.reset();
+        WirelessQueueInit(&pad->queue);
+        pad->done.store(false);
+        pad->sent = 0;
+        memset(pad->dropped, 0, sizeof(pad->dropped));
+        pad->refused = 0;
+        pad->registered = true;
+        pad->received = 0;
+        pad->expected = 0;
+        pad->skipped = 0;
+        pad->misordered = 0;
+        pad->torn = 0;
+    }
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < PADS; i++)
+        readers[i] = std::thread(ReaderThread, &pads[i]);
+    for (int i = 0; i < RECEIVERS; i++)
+        receivers[i] = std::thread(ReceiverThread, i, packets, paced);
+    for (int i = 0; i < RECEIVERS; i++)
+        receivers[i].join();
+    for (int i = 0; i < PADS; i++)
+        readers[i].join();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static int Dropped(const PAD *pad)
+{
+    return pad->dropped[WIRELESS_RING_HID] + pad->dropped[WIRELESS_RING_OTHER];
+}
+
+// Every pad at its real report rate: the readers keep up, so nothing is lost
+static void TestFullRate(void)
+{
+    Run(50, true);
+    for (int i = 0; i < PADS; i++)
+    {
+        CHECK(pads[i].registered);
+        CHECK(pads[i].link.getState() == WirelessLink::lsActive);
+        CHECK(pads[i].refused == 0);
+        CHECK(Dropped(&pads[i]) == 0);
+        CHECK(pads[i].received == pads[i].sent);
+        CHECK(pads[i].skipped == 0);
+        CHECK(pads[i].misordered == 0);
+        CHECK(pads[i].torn == 0);
+    }
+}
+
+// The receivers as fast as they can go, so the queues overflow: packets may
+// be dropped, but every one is either delivered in order or counted
+static void TestFlood(UInt32 packets)
+{
+    Run(packets, false);
+    for (int i = 0; i < PADS; i++)
+    {
+        CHECK(pads[i].refused == 0);
+        CHECK(pads[i].misordered == 0);
+        CHECK(pads[i].torn == 0);
+        CHECK(pads[i].received + (UInt32)Dropped(&pads[i]) == pads[i].sent);
+        CHECK(pads[i].skipped == (UInt32)Dropped(&pads[i]));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    TestFullRate();
+    TestFlood(20000);
+    if ((argc > 1) && (strcmp(argv[1], "-b") == 0))
+    {
+        UInt32 sent = 0, dropped = 0;
+        double seconds;
+
+        seconds = Run(1000, true);
+        for (int i = 0; i < PADS; i++)
+        {
+            sent += pads[i].sent;
+            dropped += Dropped(&pads[i]);
+        }
+        printf("%d pads at %d reports/s for %.1f s: %u packets, %u dropped\n",
+               PADS, 1000 / REPORT_INTERVAL, seconds, sent, dropped);
+
+        sent = 0;
+        dropped = 0;
+        seconds = Run(1000000, false);
+        for (int i = 0; i < PADS; i++)
+        {
+            sent += pads[i].sent;
+            dropped += Dropped(&pads[i]);
+        }
+        printf("%d pads flooding: %.1f M packets/s queued, %.1f%% dropped\n",
+               PADS, sent / seconds / 1e6, dropped * 100.0 / sent);
+    }
+    return HostTestResult("wirelessstress");
+}
@@ -0,0 +1,127 @@
+/*
+ MICE Xbox 360 Controller driver for Mac OS X
+ Copyright (C) 2006-2013 Colin Munro
+
+ xboxone_test.cpp - checks the Xbox One to 360 report conversion
+
+ This file is part of Xbox360Controller.
+
+ Xbox360Controller is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ Xbox360Controller is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with Foobar; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include <string.h>
+#include "hosttest.h"
+#include "xboxone.h"
+
+// Xbox One button bit, and the 360 bit it becomes
+static const struct {
+    UInt16 xone;
+    int bit360;
+} buttonMap[] = {
+    { 0x0004,  4 },     // Menu to Start
+    { 0x0008,  5 },     // View to Back
+    { 0x0010, 12 },     // A
+    { 0x0020, 13 },     // B
+    { 0x0040, 14 },     // X
+    { 0x0080, 15 },     // Y
+    { 0x0100,  0 },     // D-pad up
+    { 0x0200,  1 },     // D-pad down
+    { 0x0400,  2 },     // D-pad left
+    { 0x0800,  3 },     // D-pad right
+    { 0x1000,  8 },     // Left shoulder
+    { 0x2000,  9 },     // Right shoulder
+    { 0x4000,  6 },     // Left thumb
+    { 0x8000,  7 },     // Right thumb
+};
+
+static void TestButtons(void)
+{
+    CHECK(XboxOne_ConvertButtons(0x0000, false) == 0x0000);
+    CHECK(XboxOne_ConvertButtons(0x0000, true) == (1 << 10));
+    // The sync and unused bits don't show up
+    CHECK(XboxOne_ConvertButtons(0x0003, false) == 0x0000);
+    for (unsigned int i = 0; i < sizeof(buttonMap) / sizeof(buttonMap[0]); i++)
+        CHECK(XboxOne_ConvertButtons(buttonMap[i].xone, false) == (1 << buttonMap[i].bit360));
+    // Bit 11 has no Xbox One button
+    CHECK(XboxOne_ConvertButtons(0xFFFC, true) == 0xF7FF);
+}
+
+// Integer scaling gives what the floating point version used to
+static void TestTriggers(void)
+{
+    XBOXONE_ELITE_IN_REPORT in;
+
+    for (int value = 0; value <= 1023; value++)
+    {
+        memset(&in, 0, sizeof(in));
+        in.header.command = 0x20;
+        in.header.size = XBOXONE_SIZE_PAD;
+        in.trigL = value;
+        in.trigR = 1023 - value;
+        XboxOne_ConvertReport(&in, XBOXONE_SIZE_PAD, false);
+
+        const XBOX360_IN_REPORT *out = (const XBOX360_IN_REPORT*)&in;
+        CHECK(out->trigL == (UInt8)((value / 1023.0) * 255));
+        CHECK(out->trigR == (UInt8)(((1023 - value) / 1023.0) * 255));
+    }
+}
+
+static void TestReport(void)
+{
+    XBOXONE_ELITE_IN_REPORT in;
+    const XBOX360_IN_REPORT *out = (const XBOX360_IN_REPORT*)&in;
+
+    // Converted in place, sticks included
+    memset(&in, 0, sizeof(in));
+    in.header.command = 0x20;
+    in.header.size = XBOXONE_SIZE_PAD;
+    in.buttons = 0x0010;
+    in.trigL = 1023;
+    in.left.x = -32768;
+    in.left.y = 12345;
+    in.right.x = 32767;
+    in.right.y = -1;
+    XboxOne_ConvertReport(&in, XBOXONE_SIZE_PAD, true);
+    CHECK(out->header.command == 0x00);
+    CHECK(out->header.size == 0x14);
+    CHECK(out->buttons == ((1 << 12) | (1 << 10)));
+    CHECK(out->trigL == 255);
+    CHECK(out->trigR == 0);
+    CHECK(out->left.x == -32768);
+    CHECK(out->left.y == 12345);
+    CHECK(out->right.x == 32767);
+    CHECK(out->right.y == -1);
+
+    // The fight stick's triggers are buttons
+    memset(&in, 0, sizeof(in));
+    in.header.size = XBOXONE_SIZE_FIGHTSTICK;
+    in.trigL = 1023;
+    in.true_trigR = 0x80;
+    XboxOne_ConvertReport(&in, XBOXONE_SIZE_FIGHTSTICK, false);
+    CHECK(out->trigL == 255);
+    CHECK(out->trigR == 0);
+    in.header.size = XBOXONE_SIZE_FIGHTSTICK;
+    in.true_trigR = 0x40;
+    XboxOne_ConvertReport(&in, XBOXONE_SIZE_FIGHTSTICK, false);
+    CHECK(out->trigL == 0);
+    CHECK(out->trigR == 255);
+}
+
+int main(void)
+{
+    TestButtons();
+    TestTriggers();
+    TestReport();
+    return HostTestResult("xboxone");
+}
@@ -123,6 +123,8 @@ void Wireless360Controller::readSettings(void)
     if (number != NULL) mapping[14] = number->unsigned32BitValue();
     value = OSDynamicCast(OSBoolean, dataDictionary->getObject("SwapSticks"));
     if (value != NULL) swapSticks = value->getValue();
+    number = OSDynamicCast(OSNumber, dataDictionary->getObject("PowerOffTimeout"));
+    if (number != NULL) SetPowerOffTimeout(number->unsigned32BitValue());
 #if 0
     IOLog("Xbox360ControllerClass preferences loaded:\n  invertLeft X: %s, Y: %s\n   invertRight X: %s, Y:%s\n  deadzone Left: %d, Right: %d\n\n",
             invertLeftX?"True":"False",invertLeftY?"True":"False",
@@ -362,8 +364,11 @@ IOReturn Wireless360Controller::setProperties(OSObject *properties)
     OSDictionary *dictionary = OSDynamicCast(OSDictionary,properties);
 
     if(dictionary!=NULL) {
+        WirelessDevice *device = OSDynamicCast(WirelessDevice, getProvider());
         setProperty(kDriverSettingKey,dictionary);
         readSettings();
+        if (device != NULL)
+            device->RememberSettings(dictionary);
         return kIOReturnSuccess;
     } else return kIOReturnBadArgument;
 }
@@ -0,0 +1,197 @@
+/*
+    MICE Xbox 360 Controller driver for Mac OS X
+    Copyright (C) 2006-2013 Colin Munro
+
+    OneWirelessController.cpp - HID device for a controller paired to the Xbox One receiver
+
+    This file is part of Xbox360Controller.
+
+    Xbox360Controller is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    Xbox360Controller is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Foobar; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+#include <IOKit/IOLib.h>
+#include "OneWirelessController.h"
+#include "OneWirelessGamingReceiver.h"
+#include "../360Controller/xboxone.h"
+#include "../360Controller/xbox360hid.h"
+
+OSDefineMetaClassAndStructors(OneWirelessController, IOHIDDevice)
+#define super IOHIDDevice
+
+bool OneWirelessController::init(OSDictionary *dictionary)
+{
+    if (!super::init(dictionary))
+        return false;
+
+    report = NULL;
+    haveData = false;
+    guide = false;
+    bzero(lastData, sizeof(lastData));
+    bzero(mac, sizeof(mac));
+    slot = 0;
+    serialString[0] = '\0';
+    return true;
+}
+
+// Set by the receiver before the device is started
+void OneWirelessController::SetIdentity(const unsigned char *address, int index)
+{
+    memcpy(mac, address, sizeof(mac));
+    slot = index;
+    snprintf(serialString, sizeof(serialString), "%02x%02x%02x%02x%02x%02x",
+             mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+}
+
+bool OneWirelessController::handleStart(IOService *provider)
+{
+    if (!super::handleStart(provider))
+        return false;
+
+    // Every report goes through this one buffer, so input never allocates
+    report = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, ONE_REPORT_SIZE);
+    if (report == NULL)
+    {
+        IOLog("start - failed to allocate report buffer\n");
+        return false;
+    }
+    return true;
+}
+
+void OneWirelessController::handleStop(IOService *provider)
+{
+    if (report != NULL)
+    {
+        report->release();
+        report = NULL;
+    }
+    super::handleStop(provider);
+}
+
+// Converts an Xbox One input message to the 360 report layout and passes it on
+void OneWirelessController::ReceiveInput(const unsigned char *data, int length)
+{
+    const XBOXONE_HEADER *header = (const XBOXONE_HEADER*)data;
+    XBOX360_IN_REPORT *last = (XBOX360_IN_REPORT*)lastData;
+    unsigned char *buffer;
+
+    if ((report == NULL) || (length < (int)sizeof(XBOXONE_HEADER)))
+        return;
+
+    switch (header->command)
+    {
+        case 0x20:
+            if ((header->size != XBOXONE_SIZE_PAD) && (header->size != XBOXONE_SIZE_ELITE) && (header->size != XBOXONE_SIZE_FIGHTSTICK))
+                return;
+            if (length < (int)sizeof(XBOXONE_HEADER) + header->size)
+                return;
+            buffer = (unsigned char*)report->getBytesNoCopy();
+            memcpy(buffer, data, sizeof(XBOXONE_HEADER) + header->size);
+            XboxOne_ConvertReport(buffer, header->size, guide);
+            memcpy(lastData, buffer, sizeof(lastData));
+            haveData = true;
+            break;
+
+        case 0x07:
+            if ((length < (int)sizeof(XBOXONE_IN_GUIDE_REPORT)) || (header->size != sizeof(XBOXONE_IN_GUIDE_REPORT) - sizeof(XBOXONE_HEADER)))
+                return;
+            guide = ((const XBOXONE_IN_GUIDE_REPORT*)data)->state != 0;
+            if (!haveData)
+                return;
+            if (guide)
+                last->buttons |= 1 << 10;
+            else
+                last->buttons &= ~(1 << 10);
+            report->writeBytes(0, lastData, sizeof(lastData));
+            break;
+
+        default:
+            return;
+    }
+
+    report->setLength(sizeof(XBOX360_IN_REPORT));
+    handleReport(report);
+}
+
+IOReturn OneWirelessController::newReportDescriptor(IOMemoryDescriptor **descriptor) const
+{
+    IOBufferMemoryDescriptor *buffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, sizeof(ReportDescriptor));
+
+    if (buffer == NULL)
+        return kIOReturnNoResources;
+    buffer->writeBytes(0, ReportDescriptor, sizeof(ReportDescriptor));
+    *descriptor = buffer;
+    return kIOReturnSuccess;
+}
+
+// Get info
+
+OSString* OneWirelessController::newManufacturerString() const
+{
+    return OSString::withCString("Microsoft");
+}
+
+OSNumber* OneWirelessController::newPrimaryUsageNumber() const
+{
+    // Gamepad
+    return OSNumber::withNumber(0x05, 8);
+}
+
+OSNumber* OneWirelessController::newPrimaryUsagePageNumber() const
+{
+    // Generic Desktop
+    return OSNumber::withNumber(0x01, 8);
+}
+
+OSNumber* OneWirelessController::newProductIDNumber() const
+{
+    return OSNumber::withNumber((unsigned long long)0x2d1, 16);
+}
+
+OSString* OneWirelessController::newProductString() const
+{
+    return OSString::withCString("Xbox One Wireless Controller");
+}
+
+OSString* OneWirelessController::newTransportString() const
+{
+    return OSString::withCString("Wireless");
+}
+
+OSNumber* OneWirelessController::newVendorIDNumber() const
+{
+    return OSNumber::withNumber((unsigned long long)0x45e, 16);
+}
+
+// The receiver's location, with the slot in the low bits so each pad differs
+OSNumber* OneWirelessController::newLocationIDNumber() const
+{
+    OneWirelessGamingReceiver *receiver;
+    OSNumber *number;
+    UInt32 location;
+
+    receiver = OSDynamicCast(OneWirelessGamingReceiver, getProvider());
+    if (receiver == NULL)
+        return NULL;
+    number = receiver->newLocationIDNumber();
+    if (number == NULL)
+        return NULL;
+    location = number->unsigned32BitValue() + 1 + slot;
+    number->release();
+    return OSNumber::withNumber(location, 32);
+}
+
+OSString* OneWirelessController::newSerialNumberString() const
+{
+    return OSString::withCString(serialString);
+}
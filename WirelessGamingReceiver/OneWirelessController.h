@@ -0,0 +1,69 @@
+/*
+    MICE Xbox 360 Controller driver for Mac OS X
+    Copyright (C) 2006-2013 Colin Munro
+
+    OneWirelessController.h - declaration of a controller paired to the Xbox One receiver
+
+    This file is part of Xbox360Controller.
+
+    Xbox360Controller is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    Xbox360Controller is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Foobar; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+#ifndef __ONEWIRELESSCONTROLLER_H__
+#define __ONEWIRELESSCONTROLLER_H__
+
+#include <IOKit/hid/IOHIDDevice.h>
+#include <IOKit/IOBufferMemoryDescriptor.h>
+
+// Report buffer size, enough for any Xbox One input message
+#define ONE_REPORT_SIZE             64
+
+class OneWirelessController : public IOHIDDevice
+{
+    OSDeclareDefaultStructors(OneWirelessController);
+public:
+    bool init(OSDictionary *dictionary = 0);
+
+    void SetIdentity(const unsigned char *address, int index);
+    const unsigned char* GetMAC(void) const { return mac; }
+
+    // Called from the receiver's read completion, so it mustn't block or log
+    void ReceiveInput(const unsigned char *data, int length);
+
+    IOReturn newReportDescriptor(IOMemoryDescriptor **descriptor) const;
+
+    virtual OSString* newManufacturerString() const;
+    virtual OSNumber* newPrimaryUsageNumber() const;
+    virtual OSNumber* newPrimaryUsagePageNumber() const;
+    virtual OSNumber* newProductIDNumber() const;
+    virtual OSString* newProductString() const;
+    virtual OSString* newTransportString() const;
+    virtual OSNumber* newVendorIDNumber() const;
+    virtual OSNumber* newLocationIDNumber() const;
+    virtual OSString* newSerialNumberString() const;
+protected:
+    bool handleStart(IOService *provider);
+    void handleStop(IOService *provider);
+private:
+    IOBufferMemoryDescriptor *report;
+    UInt8 lastData[20];         // Last report sent, the guide button arrives separately
+    bool haveData;
+    bool guide;
+
+    unsigned char mac[6];
+    int slot;
+    char serialString[16];
+};
+
+#endif // __ONEWIRELESSCONTROLLER_H__
@@ -4,20 +4,20 @@
  Written by Radu Pascal (aka haiduc32)
  
  */
+#include <IOKit/IOSubMemoryDescriptor.h>
+#include <libkern/OSByteOrder.h>
 #include "OneWirelessGamingReceiver.h"
+#include "OneWirelessController.h"
 #include "WirelessDevice.h"
 #include "devices.h"
+#include "onebringup.h"
+#include "onepackets.h"
 
 //#define PROTOCOL_DEBUG
 
-OSDefineMetaClassAndStructors(OneWirelessGamingReceiver, IOService)
+#define kUnknownMessagesKey     "UnknownMessages"
 
-// Holds data for asynchronous reads
-typedef struct WGRREAD
-{
-    IOUSBPipe *pipe;
-    IOBufferMemoryDescriptor *buffer;
-} WGRREAD;
+OSDefineMetaClassAndStructors(OneWirelessGamingReceiver, IOService)
 
 // Get maximum packet size for a pipe
 static UInt32 GetMaxPacketSize(IOUSBPipe *pipe)
@@ -28,45 +28,6 @@ static UInt32 GetMaxPacketSize(IOUSBPipe *pipe)
     else return ed->wMaxPacketSize;
 }
 
-static char char2int(char input)
-{
-    if(input >= '0' && input <= '9')
-        return input - '0';
-    if(input >= 'A' && input <= 'F')
-        return input - 'A' + 10;
-    if(input >= 'a' && input <= 'f')
-        return input - 'a' + 10;
-    return 0;
-}
-
-
-static void HexToBytes(const char input[], char* output, unsigned long hexLength)
-{
-    for (int i = 0; i < hexLength / 2; i++)
-    {
-        *(output + i) = char2int(input[i*2])*16 + char2int(input[i*2+1]);
-    }
-}
-
-static void HexToBytes(const char input[], unsigned char* output, unsigned long hexLength)
-{
-    for (int i = 0; i < hexLength / 2; i++)
-    {
-        *(output + i) = char2int(input[i*2])*16 + char2int(input[i*2+1]);
-    }
-}
-
-bool CompareSignature(const unsigned char message[], const char signature[])
-{
-    unsigned char signatureBytes[4];
-    HexToBytes(signature, signatureBytes, 8);
-    
-    return (message[0] == signatureBytes[0] &&
-            message[1] == signatureBytes[1] &&
-            message[2] == signatureBytes[2] &&
-            message[3] == signatureBytes[3]);
-}
-
 // Start device
 bool OneWirelessGamingReceiver::start(IOService *provider)
 {
@@ -80,21 +41,56 @@ bool OneWirelessGamingReceiver::start(IOService *provider)
     int iConnection, iOther;
     IOUSBPipe *pipe = NULL;
     
-    char outBuff[4];
-    char outHex[] = "098840c0";
-    HexToBytes(outHex, outBuff, 8);
+    transactionLock = IOLockAlloc();
+    transactionTimer = NULL;
+    ResetTransactions();
     
-    pairingLock = IOLockAlloc();
+    bringUpTimer = NULL;
+    bringUpTimes = NULL;
+    bringUpWaiting = ONE_WAIT_NONE;
+    bringUpBusy = false;
+    bringUpStopping = false;
+    upload.firmware = NULL;
     
     
     IOUSBDevRequest	request;
+    OSNumber *number;
     int err;
     
     started = false;
+    unknownMessages = 0;
+    unknownPending = 0;
+    unknownCall = thread_call_allocate(UnknownThread, this);
+    
+    controllerLock = IOLockAlloc();
+    bzero(controllers, sizeof(controllers));
+    controllersStopping = false;
+    bzero(reads, sizeof(reads));
+    
+    uploadLock = IOLockAlloc();
+    packetPoolBusy = 0;
+    for (int i = 0; i < ONE_PACKET_POOL; i++)
+        packetPool[i] = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, ONE_PACKET_MAX);
+    if ((transactionLock == NULL) || (controllerLock == NULL) || (uploadLock == NULL))
+    {
+        IOLog("start - failed to allocate locks\n");
+        FreeResources();
+        return false;
+    }
+    uploadTime = 0;
+    uploadDepth = FIRMWARE_UPLOAD_DEPTH;
+    number = OSDynamicCast(OSNumber, getProperty("FirmwareUploadDepth"));
+    if (number != NULL)
+        uploadDepth = number->unsigned32BitValue();
+    if (uploadDepth < 1)
+        uploadDepth = 1;
+    if (uploadDepth > FIRMWARE_UPLOAD_MAXDEPTH)
+        uploadDepth = FIRMWARE_UPLOAD_MAXDEPTH;
     
     if (!IOService::start(provider))
     {
         IOLog("start - superclass failed\n");
+        FreeResources();
         return false;
     }
     
@@ -222,969 +218,492 @@ bool OneWirelessGamingReceiver::start(IOService *provider)
     err = device->DeviceRequest(&request, 5000, 0);
     IOLog("SET_CONFIG status: %d\n", err);
     
-    QueueRead(inDevicePipe);
-    QueueRead(inCPipe);
-    
-    
-    // send CONTROL request on the bus
-    
-    if (!controlIn ( 7, 0, 0x0024, "09883081")) goto fail;
-    if (!controlOut( 6, 0, 0x0024, "098840c0")) goto fail;
-    if (!controlIn ( 7, 0, 0x0024, "14884080")) goto fail;
-    if (!controlIn ( 7, 0, 0x002c, "00000000")) goto fail;
-    if (!controlIn ( 7, 0, 0x0024, "14884080")) goto fail;
-    if (!controlOut( 6, 0, 0x0024, "148840c0")) goto fail;
-    if (!controlIn ( 7, 0, 0x0024, "14884080")) goto fail;
-    if (!controlIn ( 7, 0, 0x0030, "00000000")) goto fail;
-    if (!controlIn ( 7, 0, 0x0000, "44003276")) goto fail;
-    if (!controlIn ( 7, 0, 0x1000, "00306276")) goto fail;
-    if (!controlOut( 6, 0, 0x0080, "09020000")) goto fail;
-    if (!controlIn ( 7, 0, 0x014c, "00141f00")) goto fail;
-    if (!controlOut( 6, 0, 0x0080, "0f020000")) goto fail;
-    if (!controlIn ( 7, 0, 0x014c, "00141f00")) goto fail;
-    if (!controlIn (71, 0, 0x0230, "00000000")) goto fail;
-    if (!controlOut(70, 0, 0x9018, "1838e400")) goto fail;
-    if (!controlIn (71, 0, 0x9018, "1838e400")) goto fail;
-    if (!controlOut( 6, 0, 0x0800, "01000000")) goto fail;
-    if (!controlOut( 6, 0, 0x09a0, "30024000")) goto fail;
-    if (!controlOut( 6, 0, 0x09a4, "01000000")) goto fail;
-    if (!controlOut( 6, 0, 0x09a8, "01000000")) goto fail;
-    if (!controlOut( 6, 0, 0x09c4, "44000000")) goto fail;
-    if (!controlOut( 6, 0, 0x0a6c, "03000000")) goto fail;
-    
-    //write the first chunck of firmware
-    //identifier for the chunck of firmware
-    if (!controlOut(70, 0, 0x0230, "40000800")) goto fail;
-    //ready to receive firmware?
-    if (!controlIn (71, 0, 0x0234, "00000000")) goto fail;
-    //here comes one big chunk of firmware!
-    if (!controlOut(70, 0, 0x0234, "00000038")) goto fail;
-    
-    if (!QueueWrite(outDevicePipe, GetFirmware(1)))
-    {
-        //did not succeed!
-        IOLog("Failed to write firmware 1\n");
-        
-        goto fail;
-    }
-    waitWriteCompleted();
-    
-    //write the second chunck of firmware
-    //check that firmware has been received? //this packet type should be checked untill the proper code is received
-    if (!controlIn (71, 0, 0x0234, "000000f8")) goto fail;
-    
-    //identifier for the chunck of firmware
-    if (!controlOut(70, 0, 0x0230, "40380800")) goto fail;
-    //check again that firmware has been received/ready to receive new firmware chunk
-    if (!controlIn (71, 0, 0x0234, "000000f8")) goto fail;
-    //here comes one big chunk of firmware!
-    if (!controlOut(70, 0, 0x0234, "00000038")) goto fail;
-    
-    if (!QueueWrite(outDevicePipe, GetFirmware(2)))
+    // Create timer for response deadlines
+    transactionTimer = IOTimerEventSource::timerEventSource(this, TransactionTimerActionWrapper);
+    if ((transactionTimer == NULL) || (getWorkLoop() == NULL) || (getWorkLoop()->addEventSource(transactionTimer) != kIOReturnSuccess))
     {
-        //did not succeed!
-        IOLog("Failed to write firmware 2\n");
-        
+        IOLog("start - failed to create response timer\n");
         goto fail;
     }
-    waitWriteCompleted();
     
-    //write third chunck of firmware
-    //check that firmware has been received?
-    if (!controlIn (71, 0, 0x0234, "000000f8")) goto fail;
-    //identifier for the chunck of firmware
-    if (!controlOut(70, 0, 0x0230, "40700800")) goto fail;
-    //check again that firmware has been received/ready to receive new firmware chunk
-    if (!controlIn (71, 0, 0x0234, "000000f8")) goto fail;
-    //here comes one big chunk of firmware!
-    if (!controlOut(70, 0, 0x0234, "00000038")) goto fail;
-    
-    if (!QueueWrite(outDevicePipe, GetFirmware(3)))
+    // Create timer for the bring-up's delays and firmware timeouts
+    bringUpTimer = IOTimerEventSource::timerEventSource(this, BringUpTimerActionWrapper);
+    if ((bringUpTimer == NULL) || (getWorkLoop()->addEventSource(bringUpTimer) != kIOReturnSuccess))
     {
-        //did not succeed!
-        IOLog("Failed to write firmware 3\n");
-        
+        IOLog("start - failed to create bring-up timer\n");
         goto fail;
     }
-    waitWriteCompleted();
     
-    //write fourth chunck of firmware
-    //check that firmware has been received?
-    if (!controlIn (71, 0, 0x0234, "000000f8")) goto fail;
-    //identifier for the chunck of firmware
-    if (!controlOut(70, 0, 0x0230, "40a80800")) goto fail;
-    //check again that firmware has been received/ready to receive new firmware chunk
-    if (!controlIn (71, 0, 0x0234, "000000f8")) goto fail;
-    //here comes one big chunk of firmware!
-    if (!controlOut(70, 0, 0x0234, "00000038")) goto fail;
-    
-    if (!QueueWrite(outDevicePipe, GetFirmware(4)))
+    // The read buffers are reused for every read on their endpoint
+    reads[0].pipe = inDevicePipe;
+    reads[1].pipe = inCPipe;
+    for (int i = 0; i < ONE_READS; i++)
     {
-        //did not succeed!
-        IOLog("Failed to write firmware 4\n");
-        
-        goto fail;
+        if (reads[i].pipe == NULL)
+            continue;
+        reads[i].buffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, GetMaxPacketSize(reads[i].pipe));
+        if (reads[i].buffer == NULL)
+        {
+            IOLog("start - failed to allocate read buffer\n");
+            goto fail;
+        }
+        QueueRead(&reads[i]);
     }
-    waitWriteCompleted();
     
-    //write fith chunck of firmware
-    //check that firmware has been received?
-    if (!controlIn (71, 0, 0x0234, "000000f8")) goto fail;
-    //identifier for the chunck of firmware
-    if (!controlOut(70, 0, 0x0230, "40e00800")) goto fail;
-    //check again that firmware has been received/ready to receive new firmware chunk
-    if (!controlIn (71, 0, 0x0234, "000000f8")) goto fail;
-    // why did it change? does it have another function?
-    if (!controlOut(70, 0, 0x0234, "0000780d")) goto fail;
+    // The rest of the bring-up runs from the transfers' completions, so
+    // attaching the receiver doesn't hold up this thread
+    BringUpStart();
     
-    if (!QueueWrite(outDevicePipe, GetFirmware(5)))
-    {
-        //did not succeed!
-        IOLog("Failed to write firmware 5\n");
-        
-        goto fail;
-    }
-    waitWriteCompleted();
-    
-    //write sixth chunck of firmware
-    //check that firmware has been received?
-    if (!controlIn (71, 0, 0x0234, "000078cd")) goto fail;
-    //identifier for the chunck of firmware
-    if (!controlOut(70, 0, 0x0230, "00081100")) goto fail;
-    //check again that firmware has been received/ready to receive new firmware chunk
-    if (!controlIn (71, 0, 0x0234, "000078cd")) goto fail;
-    // why did it change? does it have another function?
-    if (!controlOut(70, 0, 0x0234, "0000a023")) goto fail;
+    return true;
+fail:
+    IOLog("fail\n");
+    ReleaseAll();
+    FreeResources();
+    return false;
+}
+
+// Runs kOneBringUp from the first step
+void OneWirelessGamingReceiver::BringUpStart(void)
+{
+    bringUpStep = 0;
+    bringUpRepeat = 0;
+    bringUpAttempt = 0;
+    bringUpDelayed = false;
+    bringUpTimes = OSData::withCapacity(ONE_BRINGUP_STEPS * sizeof(UInt32));
+    clock_get_uptime(&bringUpBegan);
+    bringUpStepBegan = bringUpBegan;
+    
+    IOLockLock(uploadLock);
+    bringUpBusy = true;
+    IOLockUnlock(uploadLock);
+    
+    BringUpRun();
+}
+
+// Issues steps until one has to wait, either for its delay or for the
+// hardware. Steps that finish straight away are looped over rather than
+// recursed into, there are long runs of them.
+void OneWirelessGamingReceiver::BringUpRun(void)
+{
+    const OneStep *step;
+    IOReturn status;
+    UInt32 delay;
     
-    if (!QueueWrite(outDevicePipe, GetFirmware(6)))
+    while (!BringUpStopped())
     {
-        //did not succeed!
-        IOLog("Failed to write firmware 6\n");
+        if (bringUpStep >= ONE_BRINGUP_STEPS)
+        {
+            BringUpFinish(kIOReturnSuccess);
+            return;
+        }
+        step = &kOneBringUp[bringUpStep];
         
-        goto fail;
+        if (!bringUpDelayed)
+        {
+            bringUpDelayed = true;
+            delay = (bringUpAttempt != 0) ? ONE_STEP_RETRY_DELAY : step->delay;
+            if (delay != 0)
+            {
+                IOLockLock(uploadLock);
+                if (!bringUpStopping)
+                {
+                    bringUpWaiting = ONE_WAIT_DELAY;
+                    bringUpTimer->setTimeoutMS(delay);
+                    IOLockUnlock(uploadLock);
+                    return;
+                }
+                IOLockUnlock(uploadLock);
+                continue;
+            }
+        }
+        
+        switch (step->type)
+        {
+            case ONE_STEP_IN:
+            case ONE_STEP_OUT:
+                status = BringUpControl();
+                if (status == kIOReturnSuccess)
+                    return;
+                break;
+                
+            case ONE_STEP_FIRMWARE:
+                if (UploadFirmware(IOMemoryDescriptor::withAddress((void*)step->data, step->length, kIODirectionOut)))
+                    return;
+                status = kIOReturnNoMemory;
+                break;
+                
+            case ONE_STEP_SEND:
+                status = SendPacket(step->data, step->length, NULL, NULL, NULL) ? kIOReturnSuccess : kIOReturnNoMemory;
+                break;
+                
+            default:
+                status = kIOReturnSuccess;
+                break;
+        }
+        if (!BringUpResult(status))
+            return;
     }
-    waitWriteCompleted();
-    
-    //write seventh chunck of firmware
-    //check that firmware has been received?
-    if (!controlIn (71, 0, 0x0234, "0000a0e3")) goto fail;
-    //identifier for the chunck of firmware
-    if (!controlOut(70, 0, 0x0230, "00000800")) goto fail;
-    //check again that firmware has been received/ready to receive new firmware chunk
-    if (!controlIn (71, 0, 0x0234, "0000a0e3")) goto fail;
-    // why did it change? does it have another function?
-    if (!controlOut(70, 0, 0x0234, "00004000")) goto fail;
+}
+
+// Starts the current step's control transfer
+IOReturn OneWirelessGamingReceiver::BringUpControl(void)
+{
+    const OneStep *step = &kOneBringUp[bringUpStep];
+    IOUSBCompletion complete;
+    IOReturn err;
     
-    if (!QueueWrite(outDevicePipe, GetFirmware("400000104600008e580005344a000000809e460001105800080046100110581088004620011258210ba04031040140000c003a10041c3a11043c5031fffc4e36fffa640000000000")))
+    bzero(&bringUpRequest, sizeof(bringUpRequest));
+    bringUpRequest.bmRequestType = USBmakebmRequestType((step->type == ONE_STEP_IN) ? kUSBIn : kUSBOut, kUSBVendor, kUSBDevice);
+    bringUpRequest.bRequest = step->request;
+    bringUpRequest.wValue = step->value;
+    bringUpRequest.wIndex = step->index + bringUpRepeat * step->stride;
+    bringUpRequest.wLength = step->length;
+    if (step->length != 0)
     {
-        IOLog("Failed to write firmware 7\n");
-        
-        goto fail;
+        bringUpRequest.pData = bringUpBuffer;
+        if (step->type == ONE_STEP_OUT)
+            memcpy(bringUpBuffer, step->data, step->length);
+        else
+            bzero(bringUpBuffer, sizeof(bringUpBuffer));
     }
-    waitWriteCompleted();
-    
-    //not firmware per se (IMHO), but still part of initialization
-    //write eigth chunck of firmware
-    //check that firmware has been received?
-    if (!controlIn (71, 0, 0x0234, "000040c0")) goto fail;
-    // finish writing firmware?
-    if (!controlOut(70, 0, 0x0230, "00000000")) goto fail;
     
-    //?? clear something?
-    if (!controlOut(1, 0x12, 0x00, 0)) goto fail;
+    complete.target = this;
+    complete.action = _ControlComplete;
+    complete.parameter = NULL;
+    err = device->DeviceRequest(&bringUpRequest, ONE_STEP_TIMEOUT, ONE_STEP_TIMEOUT, &complete);
+    if (err != kIOReturnSuccess)
+        IOLog("bring-up - step %d failed to start (0x%.8x)\n", bringUpStep, err);
+    return err;
+}
+
+void OneWirelessGamingReceiver::ControlComplete(void *parameter, IOReturn status, UInt32 bufferSizeRemaining)
+{
+    const OneStep *step = &kOneBringUp[bringUpStep];
     
-    //??
-    if (!controlIn (71, 0, 0x0230, "00000000")) goto fail;
-    //?? (tripple retry)
-    IOSleep(100); //<- might have solved the need for tripple retry..
-    if (!controlIn (71, 0, 0x0230, "01000000"))
+    if (status == kIOReturnSuccess && step->type == ONE_STEP_IN && (step->flags & ONE_STEP_UNCHECKED) == 0)
     {
-        IOSleep(100);
-        if (!controlIn (71, 0, 0x0230, "01000000"))
+        if (bufferSizeRemaining != 0 || memcmp(bringUpBuffer, step->data, step->length) != 0)
         {
-            IOSleep(100);
-            if (!controlIn (71, 0, 0x0230, "01000000")) goto fail;
+            IOLog("bring-up - step %d read %02x%02x%02x%02x\n", bringUpStep,
+                  bringUpBuffer[0], bringUpBuffer[1], bringUpBuffer[2], bringUpBuffer[3]);
+            // Not the status the receiver should be in yet, it may still get there
+            if (step->flags & ONE_STEP_POLL)
+                status = kIOReturnNotReady;
         }
     }
+    BringUpComplete(status);
+}
+
+// Moves on from the current transfer, to the next one, the next step or
+// another attempt at this one. Returns false once the bring-up is over.
+bool OneWirelessGamingReceiver::BringUpResult(IOReturn status)
+{
+    const OneStep *step = &kOneBringUp[bringUpStep];
+    UInt64 now, ns;
+    UInt32 us;
     
-    if (!QueueWrite(outDevicePipe, GetFirmware("08001150010000000100000000000000")))
+    bringUpDelayed = false;
+    if (status != kIOReturnSuccess)
     {
-        IOLog("Failed to write firmware 8\n");
-        
-        goto fail;
+        // Part of a firmware block has already gone, so it can't be sent again
+        if (step->type != ONE_STEP_FIRMWARE && ++bringUpAttempt < ONE_STEP_ATTEMPTS)
+        {
+            IOLog("bring-up - step %d failed (0x%.8x), retrying\n", bringUpStep, status);
+            return true;
+        }
+        IOLog("bring-up - step %d failed (0x%.8x)\n", bringUpStep, status);
+        BringUpFinish(status);
+        return false;
     }
-    waitWriteCompleted();
+    bringUpAttempt = 0;
+    if (++bringUpRepeat < step->count)
+        return true;
+    bringUpRepeat = 0;
+    
+    // Delays, repeats and retries all count towards the step's time
+    clock_get_uptime(&now);
+    absolutetime_to_nanoseconds(now - bringUpStepBegan, &ns);
+    us = (UInt32)(ns / 1000);
+    if (bringUpTimes != NULL)
+        bringUpTimes->appendBytes(&us, sizeof(us));
+    bringUpStepBegan = now;
+    bringUpStep++;
+    return true;
+}
+
+// A transfer finished asynchronously, carry on from it
+void OneWirelessGamingReceiver::BringUpComplete(IOReturn status)
+{
+    if (BringUpStopped())
+        return;
+    if (BringUpResult(status))
+        BringUpRun();
+}
+
+void OneWirelessGamingReceiver::BringUpFinish(IOReturn status)
+{
+    UInt64 now, ns;
     
-    //write nineth chunck of firmware
-    if (!QueueWrite(outDevicePipe, GetFirmware("040042513100000000000000")))
+    clock_get_uptime(&now);
+    absolutetime_to_nanoseconds(now - bringUpBegan, &ns);
+    setProperty("BringUpTime", ns / 1000, 64);
+    if (bringUpTimes != NULL)
     {
-        IOLog("Failed to write firmware 9\n");
-        
-        goto fail;
+        setProperty("BringUpStepTimes", bringUpTimes);
+        bringUpTimes->release();
+        bringUpTimes = NULL;
     }
-    waitWriteCompleted();
     
+    IOLockLock(uploadLock);
+    bringUpBusy = false;
+    IOLockWakeup(uploadLock, &bringUpBusy, false);
+    IOLockUnlock(uploadLock);
     
-    //write tenth chunck of firmware
-    if (!QueueWrite(outDevicePipe, GetFirmware("040023500200000000000000")))
+    if (status == kIOReturnSuccess)
     {
-        IOLog("Failed to write firmware 10\n");
-        
-        goto fail;
+        IOLog("Started\n");
+        started = true;
+        //we should be receiving a 155 byte packet with 128 byte payload in 0.9 sec with the 4 starting bytes 7880a04a
+        //meaning it has read all the wireless broadcasting devices ( or that it's ready to receive pairing?)
     }
-    waitWriteCompleted();
-    
-    //need to read from endpoint 5.. 3 packets..
-    
-    //QueueRead(inDevicePipe);
-    //QueueRead(inDevicePipe);
-    //QueueRead(inDevicePipe);
-    
-    if (!controlIn (7, 0, 0x0038, "98023b01")) goto fail;
-    if (!controlOut(6, 0, 0x0038, "98023b01")) goto fail;
-    
-    //now there are a shitload of packets that I have no idea what are used for..
-    //1.pcap - 212
-    if (!controlOut(6, 0, 0x1004, "03000000")) goto fail;
-    if (!controlOut(6, 0, 0x0238, "00000000")) goto fail;
-    if (!controlOut(6, 0, 0x1004, "00000000")) goto fail;
-    if (!controlOut(6, 0, 0x1204, "00000000")) goto fail;
-    if (!controlOut(6, 0, 0x0070, "6464006b")) goto fail;
-    if (!controlOut(6, 0, 0x0208, "70000000")) goto fail;
-    if (!controlOut(6, 0, 0x0214, "73220000")) goto fail;
-    if (!controlOut(6, 0, 0x0218, "44230000")) goto fail;
-    if (!controlOut(6, 0, 0x021c, "aa340000")) goto fail;
-    if (!controlOut(6, 0, 0x0230, "00120400")) goto fail;
-    if (!controlOut(6, 0, 0x0250, "00000000")) goto fail;
-    if (!controlOut(6, 0, 0x0400, "000c0800")) goto fail;
-    if (!controlOut(6, 0, 0x0408, "1f1fbf1f")) goto fail;
-    if (!controlOut(6, 0, 0x0800, "01000000")) goto fail;
-    if (!controlOut(6, 0, 0x1004, "0c000000")) goto fail;
-    if (!controlOut(6, 0, 0x1404, "13000000")) goto fail;
-    if (!controlOut(6, 0, 0x1018, "ff3f3e00")) goto fail;
-    if (!controlOut(6, 0, 0x1030, "5598fcff")) goto fail;
-    if (!controlOut(6, 0, 0x1034, "ff000000")) goto fail;
-    if (!controlOut(6, 0, 0x1104, "09010000")) goto fail;
-    if (!controlOut(6, 0, 0x1204, "00000000")) goto fail;
-    if (!controlOut(6, 0, 0x1300, "20430600")) goto fail;
-    if (!controlOut(6, 0, 0x1304, "00470a00")) goto fail;
-    if (!controlOut(6, 0, 0x1308, "38320400")) goto fail;
-    if (!controlOut(6, 0, 0x130c, "2f210300")) goto fail;
-    if (!controlOut(6, 0, 0x1328, "0f0f1500")) goto fail;
-    if (!controlOut(6, 0, 0x1330, "01101000")) goto fail;
-    if (!controlOut(6, 0, 0x1334, "00000100")) goto fail;
-    if (!controlOut(6, 0, 0x1340, "3f580000")) goto fail;
-    if (!controlOut(6, 0, 0x1344, "202b0900")) goto fail;
-    if (!controlOut(6, 0, 0x1348, "900f0a00")) goto fail;
-    if (!controlOut(6, 0, 0x134c, "0f1fd047")) goto fail;
-    if (!controlOut(6, 0, 0x1364, "0300f403")) goto fail;
-    if (!controlOut(6, 0, 0x1368, "0300f403")) goto fail;
-    if (!controlOut(6, 0, 0x136c, "04207401")) goto fail;
-    if (!controlOut(6, 0, 0x1374, "04207401")) goto fail;
-    if (!controlOut(6, 0, 0x1378, "8420f403")) goto fail;
-    if (!controlOut(6, 0, 0x1380, "dc002c00")) goto fail;
-//next: 326
-    if (!controlOut(6, 0, 0x13a0, "3c3c3c3c")) goto fail;
-    if (!controlOut(6, 0, 0x13a4, "3c3c3c3c")) goto fail;
-    if (!controlOut(6, 0, 0x13a8, "000a1622")) goto fail;
-    if (!controlOut(6, 0, 0x13ac, "760a1622")) goto fail;
-    if (!controlOut(6, 0, 0x13b0, "18183f3f")) goto fail;
-    if (!controlOut(6, 0, 0x13c0, "06060080")) goto fail;
-//next: 344
-    if (!controlOut(6, 0, 0x13e0, "0420f5e3")) goto fail;
-    if (!controlOut(6, 0, 0x13e4, "8420f5e3")) goto fail;
-    if (!controlOut(6, 0, 0x13e8, "0421f5e3")) goto fail;
-    if (!controlOut(6, 0, 0x13ec, "ff0f0600")) goto fail;
-    if (!controlOut(6, 0, 0x1400, "9f5f0100")) goto fail;
-    if (!controlOut(6, 0, 0x1408, "7f010000")) goto fail;
-    if (!controlOut(6, 0, 0x140c, "03800000")) goto fail;
-    if (!controlOut(6, 0, 0x150c, "02000000")) goto fail;
-    if (!controlOut(6, 0, 0x1608, "02000000")) goto fail;
-    if (!controlOut(6, 0, 0x13e0, "0420f4e3")) goto fail;
-    if (!controlOut(6, 0, 0x13e4, "8420f4e3")) goto fail;
-    if (!controlOut(6, 0, 0x13e8, "0421f4e3")) goto fail;
-    if (!controlOut(6, 0, 0x1264, "00000000")) goto fail;
-    if (!controlOut(6, 0, 0x1228, "000000ee")) goto fail;
-    if (!controlOut(6, 0, 0x122c, "000000ee")) goto fail;
-    if (!controlOut(6, 0, 0x13a0, "3c3c3c0f")) goto fail;
-    if (!controlOut(6, 0, 0x13a4, "3c3c3c0f")) goto fail;
-    if (!controlOut(6, 0, 0x0404, "f5bcfe1e")) goto fail;
-    if (!controlOut(6, 0, 0x0a38, "0a000000")) goto fail;
-    if (!controlOut(6, 0, 0x0504, "0000007f")) goto fail;
-    if (!controlOut(6, 0, 0x050c, "0000801a")) goto fail;
-    
-    for (UInt16 ctraddr = 0xa800; ctraddr <= 0xabfc; ctraddr+= 4)
-    {
-        IOSleep(10);
-        if (!controlOut(6, 0, ctraddr, "01000000")) goto fail;
-    }
-    
-//next:1175
-    if (!controlIn (7, 0, 0x1100, "0a10a433")) goto fail;
-    if (!controlOut(6, 0, 0x1100, "0a0ea433")) goto fail;
-    if (!controlOut(6, 0, 0x041c, "00081018")) goto fail;
-    if (!controlOut(6, 0, 0x0420, "20283038")) goto fail;
-    if (!controlOut(6, 0, 0x0424, "40485058")) goto fail;
-    if (!controlOut(6, 0, 0x0428, "60687078")) goto fail;
-    if (!controlIn (7, 0, 0x080c, "3302ff03")) goto fail;
-    if (!controlOut(6, 0, 0x080c, "2302ff03")) goto fail;
-    if (!controlIn (7, 0, 0x1344, "202b0900")) goto fail;
-    if (!controlOut(6, 0, 0x1344, "00000000")) goto fail;
-    if (!controlIn (7, 0, 0x1200, "00000000")) goto fail;
-    if (!controlOut(6, 0, 0x7028, "00000000")) goto fail;
-    if (!controlOut(6, 0, 0x7010, "00000000")) goto fail;
-    
-    //return true;
-    IOSleep(100);
-    for (UInt16 ctraddr = 0x1800; ctraddr <= 0x1fe8; ctraddr+= 8)
-    {
-        IOSleep(10);
-        if (!controlOut(6, 0, ctraddr, "ffffffffffff0000")) goto fail;
-    }
-    //a check?
-    if (!controlIn (7, 0, 0x1114, "40060000")) goto fail;
-//next:1979
-    if (!controlOut(6, 0, 0x1114, "40060000")) goto fail;
-    if (!controlIn (7, 0, 0x1700, "02000000")) goto fail;
-    if (!controlIn (7, 0, 0x1704, "a20a0100")) goto fail;
-    if (!controlIn (7, 0, 0x1708, "00000000")) goto fail;
-    if (!controlIn (7, 0, 0x170c, "00000000")) goto fail;
-    if (!controlIn (7, 0, 0x1710, "00000000")) goto fail;
-    if (!controlIn (7, 0, 0x1714, "00000000")) goto fail;
-    if (!controlOut(6, 0, 0x1340, "3f580000")) goto fail;
-    
-    
-    if (!controlIn (7, 0, 0x0024, "0388c081")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "0388c081")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "038800c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "18880080")) goto fail;
-    if (!controlIn (7, 0, 0x002c, "6245b4ea")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "18880080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "188800c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "18880080")) goto fail;
-    if (!controlIn (7, 0, 0x002c, "6245b4ea")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "18880080")) goto fail;
-//next:2033
-    if (!controlOut(6, 0, 0x0024, "188800c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "18880080")) goto fail;
-    if (!controlIn (7, 0, 0x0030, "f7580000")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "18880080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "188830c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "15883080")) goto fail;
-    if (!controlIn (7, 0, 0x002c, "12ff0200")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "15883080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "158830c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "15883080")) goto fail;
-    if (!controlIn (7, 0, 0x002c, "12ff0200")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "15883080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "1588f0c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    if (!controlIn (7, 0, 0x0028, "ffff1410")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "0d88f0c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    if (!controlIn (7, 0, 0x0028, "ffff1410")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "0d88f0c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    if (!controlIn (7, 0, 0x002c, "14100000")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "0d88f0c0")) goto fail;
-//next:2108
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    if (!controlIn (7, 0, 0x002c, "14100000")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "0d88f0c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    if (!controlIn (7, 0, 0x0030, "00ffffff")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "0d88f0c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    if (!controlIn (7, 0, 0x0030, "00ffffff")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "0d88f0c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    if (!controlIn (7, 0, 0x0034, "ffffffff")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-//next:2153
-    if (!controlOut(6, 0, 0x0024, "0d88f0c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    if (!controlIn (7, 0, 0x0034, "ffffffff")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "0d8830c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "15883080")) goto fail;
-    if (!controlIn (7, 0, 0x0030, "ffff2700")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "15883080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "158890c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-    //this diverges!!!! from a 3'rd party scan: 0000002d
-    //from my scan: 00000034
-    //don't know if these are machine based, or different on each scan..
-    //so we'll do nothing if values doesn't match..
-    controlIn (7, 0, 0x0034, "00000034");
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "108890c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-    //same as before
-    controlIn (7, 0, 0x0034, "00000034");
-    
-    if (!controlIn (7, 0, 0x0114, "00000000")) goto fail;
-    //this is specific, needs to be the previous value (just one byte?)
-    if (!controlOut(6, 0, 0x0114, "00340000")) goto fail;
-    if (!controlIn (7, 0, 0x0118, "00000000")) goto fail;
-    if (!controlOut(6, 0, 0x0118, "007f0000")) goto fail;
-    if (!controlIn (7, 0, 0x0020, "ffe79100")) goto fail;
-    if (!controlOut(6, 0, 0x0020, "ffa79100")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "108850c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "1b885080")) goto fail;
-    if (!controlIn (7, 0, 0x0030, "1f00c1c1")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "1b885080")) goto fail;
-//next:2231
-    if (!controlOut(6, 0, 0x0024, "1b8850c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "1b885080")) goto fail;
-    if (!controlIn (7, 0, 0x0030, "1f00c1c1")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "1b885080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "1b8850c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "1b885080")) goto fail;
-    if (!controlIn (7, 0, 0x0034, "00002600")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "1b885080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "1b8860c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "13886080")) goto fail;
-    if (!controlIn (7, 0, 0x0028, "00000000")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "13886080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "138860c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "13886080")) goto fail;
-    if (!controlIn (7, 0, 0x002c, "27000000")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "13886080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "138860c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "13886080")) goto fail;
-    if (!controlIn (7, 0, 0x002c, "27000000")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "13886080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "138860c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "13886080")) goto fail;
-    //diverges compared to a 3rd party scan: 00290081
-    controlIn (7, 0, 0x0030, "00280081");
-    if (!controlIn (7, 0, 0x0024, "13886080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "138860c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "13886080")) goto fail;
-    if (!controlIn (7, 0, 0x0030, "00280081")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "13886080")) goto fail;
-//2315
-    if (!controlOut(6, 0, 0x0024, "138860c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "13886080")) goto fail;
-    if (!controlIn (7, 0, 0x0034, "00002900")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "13886080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "138870c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "12887080")) goto fail;
-    if (!controlIn (7, 0, 0x0028, "00000027")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "12887080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "128870c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "12887080")) goto fail;
-    if (!controlIn (7, 0, 0x0028, "00000027")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "12887080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "128870c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "12887080")) goto fail;
-    if (!controlIn (7, 0, 0x002c, "00000000")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "12887080")) goto fail;
-//next:2363
-    if (!controlOut(6, 0, 0x0024, "128870c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "12887080")) goto fail;
-    if (!controlIn (7, 0, 0x0030, "27000000")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "12887080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "128870c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "12887080")) goto fail;
-    if (!controlIn (7, 0, 0x0030, "27000000")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "12887080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "128870c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "12887080")) goto fail;
-    //this diverges, 3rd party scan: 00240000
-    controlIn (7, 0, 0x0034, "00220082");
-    if (!controlIn (7, 0, 0x0024, "12887080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "128870c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "12887080")) goto fail;
-    //same as before
-    controlIn (7, 0, 0x0034, "00220082");
-    if (!controlIn (7, 0, 0x0024, "12887080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "128880c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "11888080")) goto fail;
-    if (!controlIn (7, 0, 0x0028, "00002700")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "11888080")) goto fail;
-//next:2423
-    if (!controlOut(6, 0, 0x0024, "118880c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "11888080")) goto fail;
-    if (!controlIn (7, 0, 0x002c, "0000002b")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "11888080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "118880c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "11888080")) goto fail;
-    if (!controlIn (7, 0, 0x002c, "0000002b")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "11888080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "118880c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "11888080")) goto fail;
-    if (!controlIn (7, 0, 0x0030, "00000000")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "11888080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "118880c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "11888080")) goto fail;
-    if (!controlIn (7, 0, 0x0034, "29000000")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "11888080")) goto fail;
-//next:2471
-    if (!controlOut(6, 0, 0x0024, "118880c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "11888080")) goto fail;
-    if (!controlIn (7, 0, 0x0034, "29000000")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "11888080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "118890c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-    if (!controlIn (7, 0, 0x0028, "00270000")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "118890c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-    if (!controlIn (7, 0, 0x0028, "00270000")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "108890c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-    if (!controlIn (7, 0, 0x002c, "00002700")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-//next:2519
-    if (!controlOut(6, 0, 0x0024, "108890c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-    if (!controlIn (7, 0, 0x0030, "00000026")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "108890c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-    if (!controlIn (7, 0, 0x0030, "00000026")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "108890c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-    //diverges, 3rd party scan: 0000002d
-    controlIn (7, 0, 0x0034, "00000034");
-    if (!controlIn (7, 0, 0x0024, "10889080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "1088f0c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    if (!controlIn (7, 0, 0x0028, "ffff1410")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "0d88f0c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-    if (!controlIn (7, 0, 0x002c, "14100000")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "0d88f080")) goto fail;
-//next:2579 ->(in test_no_press: 2695)
-    if (!controlOut(6, 0, 0x0024, "0d8850c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "1b885080")) goto fail;
-    //diverges, 3rd party scan: 22bc0000
-    controlIn (7, 0, 0x002c, "22b60000");
-    if (!controlIn (7, 0, 0x0024, "1b885080")) goto fail;
-    
-    if (!controlOut(6, 0, 0x0024, "1b8850c0")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "1b885080")) goto fail;
-    if (!controlIn (7, 0, 0x0028, "00000022")) goto fail;
-    
-    if (!controlIn (7, 0, 0x2714, "00000000")) goto fail;
-    if (!controlOut(6, 0, 0x2714, "00000000")) goto fail;
-    if (!controlIn (7, 0, 0x293c, "1c1bf2c8")) goto fail;
-    if (!controlOut(6, 0, 0x293c, "181bf2c8")) goto fail;
-//next:2612
-    //THIS IS NOT ACTUAL FIRMWARE!!!
-    //these section diverges between 3rd party scans!!!!
-    if (!QueueWrite(outDevicePipe, GetFirmware("0c008450081041006245b4ea2d59000000000000")))
+    else
     {
-        IOLog("Failed to write firmware 11\n");
-        
-        goto fail;
+        IOLog("bring-up - failed at step %d\n", bringUpStep);
+        setProperty("BringUpFailedStep", bringUpStep, 32);
+        terminate();
     }
-    waitWriteCompleted();
+}
+
+// Checks whether ReleaseAll wants the bring-up to stop, and lets it know the
+// bring-up has if so
+bool OneWirelessGamingReceiver::BringUpStopped(void)
+{
+    bool stopped;
     
-    if (!QueueWrite(outDevicePipe, GetFirmware("0c008550101041006245b4ea2d59000000000000")))
+    IOLockLock(uploadLock);
+    stopped = bringUpStopping;
+    if (stopped)
     {
-        IOLog("Failed to write firmware 12\n");
-        
-        goto fail;
-    }
-    waitWriteCompleted();
-    
-//next:2615
-    if (!controlIn (7, 0, 0x0080, "0f020000")) goto fail;
-    if (!controlIn (7, 0, 0x141c, "e4ff0000")) goto fail;
-    if (!controlOut(6, 0, 0x141c, "e4f00000")) goto fail;
-    if (!controlIn (7, 0, 0x110c, "1e000000")) goto fail;
-    if (!controlOut(6, 0, 0x110c, "1e000000")) goto fail;
-    if (!controlIn (71, 0, 0x0120, "00000000")) goto fail;
-    if (!controlOut(70, 0, 0x0120, "10100000")) goto fail;
-    if (!controlIn (71, 0, 0x0128, "00000000")) goto fail;
-    if (!controlOut(70, 0, 0x0128, "00100000")) goto fail;
-    if (!controlIn (71, 0, 0x01b8, "fffff7ff")) goto fail;
-    if (!controlOut(70, 0, 0x01b8, "f5fff7ff")) goto fail;
-    
-    //NOT ACTUAL FIRMWARE
-    if (!QueueWrite(outDevicePipe, GetFirmware("1000c65020234100fa5e361824234100fa5e361800000000")))
-    {
-        IOLog("Failed to write firmware 13\n");
-        
-        goto fail;
+        bringUpBusy = false;
+        IOLockWakeup(uploadLock, &bringUpBusy, false);
     }
-    waitWriteCompleted();
+    IOLockUnlock(uploadLock);
+    return stopped;
+}
 
-//next:2651
-    if (!controlIn (7, 0, 0x1340, "3f580000")) goto fail;
-    if (!controlOut(6, 0, 0x1340, "3f581000")) goto fail;
-    if (!controlIn (7, 0, 0x110c, "1e000000")) goto fail;
-    if (!controlOut(6, 0, 0x110c, "5f010000")) goto fail;
-    if (!controlIn (7, 0, 0x141c, "e4f00000")) goto fail;
-    if (!controlIn (7, 0, 0x2308, "14140000")) goto fail;
+// Stops the bring-up and waits until nothing of it is outstanding
+void OneWirelessGamingReceiver::BringUpStop(void)
+{
+    UInt64 deadline;
+    bool uploading;
     
-//next:2669
-    //NOT ACTUAL FIRMWARE
-    if (!QueueWrite(outDevicePipe, GetFirmware("0c003750000000006245b4ea2d59000000000000")))
-    {
-        IOLog("Failed to write firmware 14\n");
-        
-        goto fail;
-    }
-    waitWriteCompleted();
+    if (uploadLock == NULL)
+        return;
     
-    if (!QueueWrite(outDevicePipe, GetFirmware("08003850030000000300000000000000")))
+    IOLockLock(uploadLock);
+    bringUpStopping = true;
+    if (bringUpWaiting == ONE_WAIT_DELAY)
     {
-        IOLog("Failed to write firmware 15\n");
-        
-        goto fail;
+        bringUpTimer->cancelTimeout();
+        bringUpWaiting = ONE_WAIT_NONE;
+        bringUpBusy = false;
     }
-    waitWriteCompleted();
+    uploading = (upload.firmware != NULL);
+    IOLockUnlock(uploadLock);
     
-    if (!QueueWrite(outDevicePipe, GetFirmware("08003950050000004000000000000000")))
-    {
-        IOLog("Failed to write firmware 16\n");
-        
-        goto fail;
-    }
-    waitWriteCompleted();
+    // An upload only finishes once all its writes are back
+    if (uploading && outDevicePipe != NULL)
+        outDevicePipe->Abort();
     
-    if (!QueueWrite(outDevicePipe, GetFirmware("08008a50240441004048505800000000")))
+    clock_interval_to_deadline(FIRMWARE_UPLOAD_TIMEOUT, kMillisecondScale, &deadline);
+    IOLockLock(uploadLock);
+    while (bringUpBusy)
     {
-        //did not succeed!
-        IOLog("Failed to write firmware 17\n");
-        
-        goto fail;
+        if (IOLockSleepDeadline(uploadLock, &bringUpBusy, deadline, THREAD_UNINT) != THREAD_AWAKENED)
+            break;
     }
-    waitWriteCompleted();
+    IOLockUnlock(uploadLock);
+}
+
+void OneWirelessGamingReceiver::BringUpTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender)
+{
+    OneWirelessGamingReceiver *receiver;
     
-    if (!QueueWrite(outDevicePipe, GetFirmware("3c008b5000d441000000002003002400000000000000000000000000100000000000000000006245b4ea2d596245b4ea2d59000000001001000f00000000000000000000")))
+    receiver = OSDynamicCast(OneWirelessGamingReceiver, owner);
+    if (receiver != NULL)
+        receiver->BringUpTimerAction(sender);
+}
+
+// Either a step's delay is over, or a firmware block took too long
+void OneWirelessGamingReceiver::BringUpTimerAction(IOTimerEventSource *sender)
+{
+    bool timedOut;
+    int waiting;
+    
+    IOLockLock(uploadLock);
+    waiting = bringUpWaiting;
+    bringUpWaiting = ONE_WAIT_NONE;
+    timedOut = (waiting == ONE_WAIT_UPLOAD) && (upload.firmware != NULL);
+    if (timedOut && upload.status == kIOReturnSuccess)
+        upload.status = kIOReturnTimeout;
+    IOLockUnlock(uploadLock);
+    
+    switch (waiting)
     {
-        //did not succeed!
-        IOLog("Failed to write firmware 18\n");
-        
-        goto fail;
+        case ONE_WAIT_DELAY:
+            BringUpRun();
+            break;
+            
+        case ONE_WAIT_UPLOAD:
+            // Cancels what's left, the completions still arrive and finish the step
+            if (timedOut)
+                outDevicePipe->Abort();
+            break;
+            
+        default:
+            break;
     }
-    waitWriteCompleted();
-
-//next:2678
-    if (!controlIn (7, 0, 0x1104, "09010000")) goto fail;
-    if (!controlOut(6, 0, 0x1104, "09010000")) goto fail;
-    if (!controlOut(6, 0, 0x1004, "04000000")) goto fail;
-    if (!controlOut(70, 0, 0x9018, "1838e400")) goto fail;
-    if (!controlIn (71, 0, 0x9018, "1838e400")) goto fail;
-    if (!controlIn (7, 0, 0x1004, "04000000")) goto fail;
-    if (!controlOut(6, 0, 0x1400, "177f0100")) goto fail;
-    if (!controlOut(6, 0, 0x1004, "0c000000")) goto fail;
-    if (!controlOut(70, 0, 0x9018, "1838e400")) goto fail;
-    if (!controlIn (71, 0, 0x9018, "1838e400")) goto fail;
-    if (!controlIn (7, 0, 0x1004, "0c000000")) goto fail;
-    if (!controlOut(6, 0, 0x1004, "00000000")) goto fail;
-    if (!controlOut(6, 0, 0x1330, "01101000")) goto fail;
-    if (!controlOut(6, 0, 0x1334, "00000100")) goto fail;
-    if (!controlOut(6, 0, 0x13a0, "3c3c3c0f")) goto fail;
-    if (!controlOut(6, 0, 0x13a4, "3c3c3c0f")) goto fail;
-    if (!controlIn (7, 0, 0x2378, "06000000")) goto fail;
-    if (!controlOut(6, 0, 0x2378, "02000000")) goto fail;
-    if (!controlIn (7, 0, 0x13c0, "06060080")) goto fail;
-    if (!controlOut(6, 0, 0x13c0, "06060000")) goto fail;
-    if (!controlIn (7, 0, 0x200c, "0a030087")) goto fail;
-    if (!controlOut(6, 0, 0x200c, "0a030086")) goto fail;
-    if (!controlOut(6, 0, 0x0504, "00000000")) goto fail;
-    if (!controlOut(6, 0, 0x050c, "00000000")) goto fail;
-    
-    if (!controlIn (7, 0, 0x0024, "1b885080")) goto fail;
-    if (!controlOut(6, 0, 0x0023, "1b8850c0")) goto fail;
-    if (!controlIn (7, 0, 0x0024, "1b885080")) goto fail;
-    //diverges from a 3rd party scan:22bc0000
-    if (!controlIn (7, 0, 0x002c, "22b60000")) goto fail;
-    
-//next:2763 (2846)
-    if (!QueueWrite(outDevicePipe, GetFirmware("0800fc51020000000000000000000000"))) goto failFirmware;
-    if (!QueueWrite(outDevicePipe, GetFirmware("0800fd51030000000100000000000000"))) goto failFirmware;
-    if (!QueueWrite(outDevicePipe, GetFirmware("0800fe51040000000000000000000000"))) goto failFirmware;
-    
-    if (!controlOut(6, 0, 0x1004, "0c000000")) goto fail;
-    
-    //this diverges from 3rd party scans
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400e151010000000101000000000000000000000020011000000000"))) goto failFirmware;
-    
-    //also diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400e25124000000010100000000000000000000012a011000000000"))) goto failFirmware;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400e35134000000010100000000000000000000012b011000000000"))) goto failFirmware;
-    
-    if (!QueueWrite(outDevicePipe, GetFirmware("0800f451020000000000000000000000"))) goto failFirmware;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400e551640000000101000000000000000000000227011000000000"))) goto failFirmware;
-        
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("1000a650b4134100207b3ceda8134100e08520f400000000"))) goto failFirmware;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400e751780000000101000000000000000000000227011000000000"))) goto failFirmware;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1000c850b41341000100a489a813410001040f1b00000000"))) goto failFirmware;
+}
+
+// Starts sending a firmware block as a run of bulk writes, keeping up to
+// uploadDepth of them queued on the pipe and topping the queue up from each
+// completion. Takes the reference to firmware.
+bool OneWirelessGamingReceiver::UploadFirmware(IOMemoryDescriptor *firmware)
+{
+    UInt32 packet;
     
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400e951950000000101000000000000000000000222011000000000"))) goto failFirmware;
+    if (firmware == NULL)
+        return false;
     
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400ea51010000000101000000000000000000000020010000000000"))) goto failFirmware;
-    if (!QueueWrite(outDevicePipe, GetFirmware("08003b50060000004000000000000000"))) goto failFirmware;
+    packet = GetMaxPacketSize(outDevicePipe);
+    
+    IOLockLock(uploadLock);
+    upload.firmware = firmware;
+    upload.length = firmware->getLength();
+    upload.segment = (packet == 0) ? upload.length : packet * FIRMWARE_SEGMENT_PACKETS;
+    upload.issued = 0;
+    upload.written = 0;
+    upload.inFlight = 0;
+    upload.issuing = false;
+    upload.status = kIOReturnSuccess;
+    clock_get_uptime(&upload.start);
+    bringUpWaiting = ONE_WAIT_UPLOAD;
+    bringUpTimer->setTimeoutMS(FIRMWARE_UPLOAD_TIMEOUT);
+    IOLockUnlock(uploadLock);
+    
+    UploadNext();
+    return true;
+}
+
+// Queues writes until the pipeline is full. Only one caller issues at a time so
+// the segments reach the pipe in order, anyone else just leaves it to them.
+// Whoever issues last also notices when the block is done.
+void OneWirelessGamingReceiver::UploadNext(void)
+{
+    IOUSBCompletion complete;
+    IOMemoryDescriptor *segment, *firmware;
+    IOByteCount offset, length;
+    IOReturn err, status;
     
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("08008c501411410040066ff700000000"))) goto failFirmware;
+    complete.target = this;
+    complete.action = _UploadComplete;
     
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("30000805a000002000ff1c00000000000000000000000001a0000000ffffffffffff6245b4ea2d596245b4ea2d5910000200010000000000"))) goto failFirmware;
+    IOLockLock(uploadLock);
+    if (upload.issuing)
+    {
+        IOLockUnlock(uploadLock);
+        return;
+    }
+    upload.issuing = true;
+    while (upload.firmware != NULL && upload.status == kIOReturnSuccess && upload.issued < upload.length && upload.inFlight < uploadDepth)
+    {
+        offset = upload.issued;
+        length = upload.length - offset;
+        if (length > upload.segment)
+            length = upload.segment;
+        upload.issued += length;
+        upload.inFlight++;
+        IOLockUnlock(uploadLock);
+        
+        segment = IOSubMemoryDescriptor::withSubRange(upload.firmware, offset, length, kIODirectionOut);
+        if (segment == NULL)
+            err = kIOReturnNoMemory;
+        else
+        {
+            complete.parameter = segment;
+            err = outDevicePipe->Write(segment, 0, 0, length, &complete);
+            if (err != kIOReturnSuccess)
+                segment->release();
+        }
+        
+        IOLockLock(uploadLock);
+        if (err != kIOReturnSuccess)
+        {
+            IOLog("upload - failed to start (0x%.8x)\n", err);
+            upload.inFlight--;
+            upload.status = err;
+        }
+    }
+    upload.issuing = false;
     
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("08008d501411410040066ff700000000"))) goto failFirmware;
+    // Taking the block marks it finished, so it's only finished once
+    firmware = NULL;
+    status = upload.status;
+    if (upload.firmware != NULL && upload.inFlight == 0 && (status != kIOReturnSuccess || upload.written == upload.length))
+    {
+        firmware = upload.firmware;
+        upload.firmware = NULL;
+        if (bringUpWaiting == ONE_WAIT_UPLOAD)
+        {
+            bringUpTimer->cancelTimeout();
+            bringUpWaiting = ONE_WAIT_NONE;
+        }
+    }
+    IOLockUnlock(uploadLock);
     
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("30000805a000002000ff1c00000000000000000000000001a0000000ffffffffffff6245b4ea2d596245b4ea2d5920000200010000000000"))) goto failFirmware;
-    
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("0c008e50081041006245b4ea2d59000000000000"))) goto failFirmware;
-    
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("0c008150101041006245b4ea2d59000000000000"))) goto failFirmware;
-    
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("0c003250000000006245b4ea2d59000000000000"))) goto failFirmware;
-    
-    if (!QueueWrite(outDevicePipe, GetFirmware("0800835000144100134f010000000000"))) goto failFirmware;
-    
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400e451010000000101000000000000000000000020010000000000"))) goto failFirmware;
-    
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("38000805a000002000ff240000000000000000000000000140000000ffffffffffff6245b4ea2d59ffffffffffff3000000001080c1218243048606c00000000"))) goto failFirmware;
-    
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a55030114100a06cefe3341141000000000040114100b81c010000000000"))) goto failFirmware;
-    
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a65030114100a06cefe3341141000000000040114100b81c010000000000"))) goto failFirmware;
-    
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400e751060000000101000000000000000000000022010000000000"))) goto failFirmware;
-    
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("38000805a000002000ff240000000000000000000000000140000000ffffffffffff6245b4ea2d59ffffffffffff4000000001080c1218243048606c00000000"))) goto failFirmware;
-    //QueueRead(inDevicePipe);
-    
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a85030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto failFirmware;
-    
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a95030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto failFirmware;
-    
-//next:2837 (2919) (we might have missed some reads, was too complicated to track..)
-    
-    //diverges
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400ea510b0000000101000000000000000000000022010000000000"))) goto failFirmware;
-    
-    //only for logging
-    IOSleep(100);
-// next optimized for smaller code:
-    //consider diverges as default
-    if (!QueueWrite(outDevicePipe, GetFirmware("38000805a000002000ff240000000000000000000000000140000000ffffffffffff6245b4ea2d59ffffffffffff5000000001080c1218243048606c00000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800ab5030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800ac5030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400ed5124000000010100000000000000000000012a010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("38000805a000002000ff240000000000000000000000000140000000ffffffffffff6245b4ea2d59ffffffffffff6000000001080c1218243048606c00000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800ae5030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a15030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400e25128000000010100000000000000000000012a000000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("38000805a000002000ff240000000000000000000000000140000000ffffffffffff6245b4ea2d59ffffffffffff7000000001080c1218243048606c00000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a35030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a45030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400e5512c0000000101000000000000000000000129010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("38000805a000002000ff240000000000000000000000000140000000ffffffffffff6245b4ea2d59ffffffffffff8000000001080c1218243048606c00000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a65030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a75030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400e851300000000101000000000000000000000129000000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("38000805a000002000ff240000000000000000000000000140000000ffffffffffff6245b4ea2d59ffffffffffff9000000001080c1218243048606c00000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a95030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800aa5030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400eb51950000000101000000000000000000000222010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("38000805a000002000ff240000000000000000000000000140000000ffffffffffff6245b4ea2d59ffffffffffffa000000001080c1218243048606c00000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800ac5030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    //vs 3d party:------>1800a75030114100d0c2b2053411410060c9900d401141000000000000000000
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800ad5030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400ee51990000000101000000000000000000000222000000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("38000805a000002000ff240000000000000000000000000140000000ffffffffffff6245b4ea2d59ffffffffffffb000000001080c1218243048606c00000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a15030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a25030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    //only for logging:
-    IOSleep(100);
-//next: 2881? (double check) (2967)
-    //does not diverge
-    if (!QueueWrite(outDevicePipe, GetFirmware("0800f351020000000000000000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1000a450b4134100a06cefe3a8134100f07a20f400000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1000c550b41341000100a489a813410001040f1b00000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400e6519d0000000101000000000000000000000220010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("38000805a000002000ff240000000000000000000000000140000000ffffffffffff6245b4ea2d59ffffffffffffc000000001080c1218243048606c00000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a75030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a85030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400e951a10000000101000000000000000000000220000000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("38000805a000002000ff240000000000000000000000000140000000ffffffffffff6245b4ea2d59ffffffffffffd000000001080c1218243048606c00000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800aa5030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800ab5030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("38000805a000002000ff240000000000000000000000000140000000ffffffffffff6245b4ea2d59ffffffffffffe000000001080c1218243048606c00000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800ac5030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800ad5030114100a06cefe334114100f07a20f4401141000101010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("08008e5000144100177f010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1400e151990000000101000000000000000000000222010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("080082501c04410000c0000000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("5000835000c04100080000200200380000000000000000000000000080000000ffffffffffff6245b4ea2d596245b4ea2d59000088006cf700f8ffff640031c60000dd100050f211011000289d2400000000000000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("080084501411410040065fec00000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a55030114100a06cefe3341141000000000040114100c41c010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1800a65030114100a06cefe3341141000000000040114100c41c010000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("08008750240441004048505800000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("3c00885000d24100000000200200220000000000000000000000000070000000ffffffffffff6245b4ea2d596245b4ea2d590000700f1000289d00000000000000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("08008950240441004048505800000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("3c008a5000d04100000000200200240000000000000000000000000040000000ffffffffffff6245b4ea2d59ffffffffffff0000000001080c1218243048606c00000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("38003b500700000001000000990000000a00000001000000060000000b00000024000000280000002c00000030000000950000009d000000a100000000000000"))) goto fail;
-    //for some reason needs a 200msec sleep
-    IOSleep(200);
-    if (!QueueWrite(outDevicePipe, GetFirmware("0800fc51020000000000000000000000"))) goto fail;
-    if (!QueueWrite(outDevicePipe, GetFirmware("1000ad50b4134100a06cefe3a8134100f07a20f400000000"))) goto fail;
-//next:2938 (3021)
-    
-    //IOSleep(500);
-    //does not diverge
-    if (!QueueWrite(outDevicePipe, GetFirmware("1000ce50b41341000100a489a813410001040f1b00000000"))) goto fail;
-    //don't really need this sleep. I think..
-    IOSleep(100);
-    
-    IOLog("Started\n");
-    started = true;
-    //we should be receiving a 155 byte packet with 128 byte payload in 0.9 sec with the 4 starting bytes 7880a04a
-    //meaning it has read all the wireless broadcasting devices ( or that it's ready to receive pairing?)
-
-    //
-    
-    //reading from these pipes will be repetitive since we have set the started property to true.
-    //QueueRead(inDevicePipe);
-    
-    //IOSleep(2000);
-    
-    return true;
-failFirmware:
-    IOLog("Failed to write firmware\n");
-    goto exit;
-fail:
-    IOLog("fail\n");
-exit:
-    ReleaseAll();
-    return false;
+    if (firmware != NULL)
+        UploadFinish(firmware, status);
 }
 
-void OneWirelessGamingReceiver::waitWriteCompleted()
+void OneWirelessGamingReceiver::UploadComplete(void *parameter, IOReturn status, UInt32 bufferSizeRemaining)
 {
-    int sleptMillis;
+    IOMemoryDescriptor *segment = (IOMemoryDescriptor*)parameter;
+    IOByteCount length;
+    
+    length = segment->getLength();
+    segment->release();
+    
+    // A short write means the receiver didn't take the whole segment
+    if (status == kIOReturnSuccess && bufferSizeRemaining != 0)
+        status = kIOReturnUnderrun;
+    if (status != kIOReturnSuccess)
+        IOLog("upload - Error writing: 0x%.8x\n", status);
+    
+    IOLockLock(uploadLock);
+    upload.inFlight--;
+    if (status == kIOReturnSuccess)
+        upload.written += length;
+    else if (upload.status == kIOReturnSuccess)
+        upload.status = status;
+    IOLockUnlock(uploadLock);
+    
+    UploadNext();
+}
+
+void OneWirelessGamingReceiver::UploadFinish(IOMemoryDescriptor *firmware, IOReturn status)
+{
+    UInt64 end, ns;
     
-    sleptMillis = 0;
-    //wait till the firmware chunck has been transmitted
-    while (!deviceWriteCompleted)
-    {
-        //sleep for one millisecond
-        IOLog("Sleeping 1..\n");
-        IOSleep(1);
-        sleptMillis++;
-        if (sleptMillis >= 10) break;
-    }
+    firmware->release();
+    
+    clock_get_uptime(&end);
+    uploadTime += end - upload.start;
+    absolutetime_to_nanoseconds(uploadTime, &ns);
+    setProperty("FirmwareUploadTime", ns / 1000, 64);
+    
+    if (status != kIOReturnSuccess)
+        IOLog("upload - failed (0x%.8x)\n", status);
+    BringUpComplete(status);
 }
 
 void OneWirelessGamingReceiver::waitReadCompleted()
@@ -1192,88 +711,62 @@ void OneWirelessGamingReceiver::waitReadCompleted()
     //TODO: do we really need it?
 }
 
-
-bool OneWirelessGamingReceiver::controlIn(UInt8 bRequest, UInt16 wValue, UInt16 wIndex, const char checkControlHex[])
+// Stop the device
+void OneWirelessGamingReceiver::stop(IOService *provider)
 {
-    unsigned char inBuff[4];
-    unsigned char expectedBuff[4];
-    IOUSBDevRequest request;
-    int err;
-    
-    HexToBytes(checkControlHex, expectedBuff, 8);
-    
-    bzero( &request, sizeof(IOUSBDevRequest));
-    
-    request.bmRequestType = USBmakebmRequestType(kUSBIn, kUSBVendor, kUSBDevice);
-    request.bRequest = bRequest;
-    request.wValue = wValue;
-    request.wIndex = wIndex;
-    request.wLength = 4;
-    request.pData = inBuff;
-    err = device->DeviceRequest(&request, 5000, 0);
-    //IOLog("CONTROL In status: %d : %02x%02x%02x%02x\n", err, inBuff[0], inBuff[1], inBuff[2], inBuff[3]);
-    if (err != 0)
-    {
-        IOLog("There was an error: %d\n", err);
-        return false;
-    }
-    
-    for (int i = 0; i < 4; i++)
-    {
-        if (inBuff[i] != expectedBuff[i])
-        {
-            IOLog("Expected control value did not match! Retrying.\n");
-            //IOLog("Expected %02x%02x%02x%02x but received %02x%02x%02x%02x\n", expectedBuff[0], expectedBuff[1], expectedBuff[2], expectedBuff[3], inBuff[0], inBuff[1], inBuff[2], inBuff[3]);
-        }
-    }
-    //TODO: compare inBuff with checkControl and print an error message plus return false
-    return true;
+    IOLog("stop\n");
+    ReleaseAll();
+    FreeResources();
+    IOService::stop(provider);
 }
 
-bool OneWirelessGamingReceiver::controlOut(UInt8 bRequest, UInt16 wValue, UInt16 wIndex, const char controlHex[])
+// Frees what start allocated that ReleaseAll leaves alone, so it runs once
+// nothing can use the locks any more
+void OneWirelessGamingReceiver::FreeResources(void)
 {
-    unsigned char outBuff[256];
-    IOUSBDevRequest request;
-    int err;
-    
-    size_t inSize = 0;
-    
-    if (controlHex != 0)
+    if (uploadLock != NULL)
     {
-        inSize = strlen(controlHex);
-        HexToBytes(controlHex, outBuff, inSize);
+        IOLockFree(uploadLock);
+        uploadLock = NULL;
     }
-    
-    bzero( &request, sizeof(IOUSBDevRequest));
-    
-    request.bmRequestType = USBmakebmRequestType(kUSBOut, kUSBVendor, kUSBDevice);
-    request.bRequest = bRequest;
-    request.wValue = wValue;
-    request.wIndex = wIndex;
-    if (controlHex != 0)
+    if (transactionLock != NULL)
     {
-        request.wLength = inSize/2;
-        request.pData = outBuff;
+        IOLockFree(transactionLock);
+        transactionLock = NULL;
     }
-    err = device->DeviceRequest(&request, 5000, 0);
-    if (controlHex !=0)
+    if (controllerLock != NULL)
     {
-        //IOLog("CONTROL Out status: %d : %02x%02x%02x%02x\n", err, outBuff[0], outBuff[1], outBuff[2], outBuff[3]);
+        IOLockFree(controllerLock);
+        controllerLock = NULL;
     }
-    else
+    for (int i = 0; i < ONE_READS; i++)
     {
-        //IOLog("CONTROL Out status: %d\n", err);
+        if (reads[i].buffer != NULL)
+        {
+            reads[i].buffer->release();
+            reads[i].buffer = NULL;
+        }
+    }
+    for (int i = 0; i < ONE_PACKET_POOL; i++)
+    {
+        if (packetPool[i] != NULL)
+        {
+            packetPool[i]->release();
+            packetPool[i] = NULL;
+        }
     }
-    //TODO: compare inBuff with checkControl and print an error message plus return false
-    return true;
 }
 
-// Stop the device
-void OneWirelessGamingReceiver::stop(IOService *provider)
+// Free the objects that live as long as the driver
+void OneWirelessGamingReceiver::free(void)
 {
-    IOLog("stop\n");
-    ReleaseAll();
-    IOService::stop(provider);
+    // A pending publish holds a reference, so none can be queued now
+    if (unknownCall != NULL)
+    {
+        thread_call_free(unknownCall);
+        unknownCall = NULL;
+    }
+    IOService::free();
 }
 
 // Handle termination
@@ -1305,39 +798,23 @@ IOReturn OneWirelessGamingReceiver::message(UInt32 type,IOService *provider,void
 #endif
 }
 
-// Queue a read on a controller
-bool OneWirelessGamingReceiver::QueueRead(IOUSBPipe *pipe)
+// Queue a read on one of the input endpoints
+bool OneWirelessGamingReceiver::QueueRead(OneRead *read)
 {
-    //IOLog("QueueRead on pipe %d\n", pipe);
-    
     IOUSBCompletion complete;
     IOReturn err;
-    WGRREAD *data = (WGRREAD*)IOMalloc(sizeof(WGRREAD));
-    
     
-    if (data == NULL)
+    if (read->pipe == NULL || read->buffer == NULL)
         return false;
     
-    data->pipe = pipe;
-    data->buffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, GetMaxPacketSize(pipe));
-    if (data->buffer == NULL)
-    {
-        IOFree(data, sizeof(WGRREAD));
-        return false;
-    }
-    
     complete.target = this;
     complete.action = _ReadComplete;
-    complete.parameter = data;
-    
+    complete.parameter = read;
     
-    err = pipe->Read(data->buffer, 0, 0, data->buffer->getLength(), &complete);
+    err = read->pipe->Read(read->buffer, 0, 0, read->buffer->getLength(), &complete);
     if (err == kIOReturnSuccess)
         return true;
     
-    data->buffer->release();
-    IOFree(data, sizeof(WGRREAD));
-    
     // IOLog("read - failed to start (0x%.8x)\n", err);
     return false;
 }
@@ -1345,11 +822,9 @@ bool OneWirelessGamingReceiver::QueueRead(IOUSBPipe *pipe)
 // Handle a completed read on a controller
 void OneWirelessGamingReceiver::ReadComplete(void *parameter, IOReturn status, UInt32 bufferSizeRemaining)
 {
-    IOLog("ReadComplete\n");
-    WGRREAD *data = (WGRREAD*)parameter;
-
+    //IOLog("ReadComplete\n");
+    OneRead *read = (OneRead*)parameter;
     bool reread = true;
-    IOUSBPipe *pipe = data != 0 ? data->pipe : 0;
     
     switch (status)
     {
@@ -1360,7 +835,7 @@ void OneWirelessGamingReceiver::ReadComplete(void *parameter, IOReturn status, U
             // fall through
             break;
         case kIOReturnSuccess:
-            ProcessMessage((unsigned char*)data->buffer->getBytesNoCopy(), (int)data->buffer->getLength() - bufferSizeRemaining);
+            ProcessMessage((unsigned char*)read->buffer->getBytesNoCopy(), (int)read->buffer->getLength() - bufferSizeRemaining);
             break;
             
         case kIOReturnNotResponding:
@@ -1373,45 +848,29 @@ void OneWirelessGamingReceiver::ReadComplete(void *parameter, IOReturn status, U
             break;
     }
     
-    //int newIndex = data->index;
-    data->buffer->release();
-    IOFree(data, sizeof(WGRREAD));
-    
-    if (reread && device != NULL)
-    {
-        //IOLog("Re-read set: %d\n", pipe);
-        if (pipe->GetEndpoint()->number == inCPipe->GetEndpoint()->number)
-        //IOSleep(1000);
-        {
-            //IOLog("Reading from inCPipe ref: %d\n", inCPipe);
-            QueueRead(inCPipe);
-        }
-        else if (pipe->GetEndpoint()->number == inDevicePipe->GetEndpoint()->number)
-        {
-            //IOLog("Reading from inDevicePipe ref: %d\n", inDevicePipe);
-            QueueRead(inDevicePipe);
-        }
-    }
+    if (reread && (device != NULL) && !controllersStopping)
+        QueueRead(read);
 }
 
-bool OneWirelessGamingReceiver::QueueWrite(IOUSBPipe *pipe, IOBufferMemoryDescriptor *outBuffer)
+bool OneWirelessGamingReceiver::QueueWrite(IOUSBPipe *pipe, IOMemoryDescriptor *outBuffer)
 {
     //IOLog("QueueWrite\n");
     IOUSBCompletion complete;
     IOReturn err;
     
-    deviceWriteCompleted = false;
-    
+    if (outBuffer == NULL)
+        return false;
+
     complete.target = this;
     complete.action = _WriteComplete;
     complete.parameter = outBuffer;
     
-    //TODO: check that getCapacity() returns the length of the buffer!!!
-    err = outDevicePipe->Write(outBuffer, 0, 0, outBuffer->getCapacity(), &complete);
+    err = outDevicePipe->Write(outBuffer, 0, 0, outBuffer->getLength(), &complete);
     if (err == kIOReturnSuccess)
         return true;
     else
     {
+        ReleasePacket(outBuffer);
         IOLog("send - failed to start (0x%.8x)\n",err);
         return false;
     }
@@ -1426,9 +885,7 @@ void OneWirelessGamingReceiver::WriteComplete(void *parameter,IOReturn status,UI
     if(status!=kIOReturnSuccess) {
         IOLog("write - Error writing: 0x%.8x\n",status);
     }
-    memory->release();
-    
-    deviceWriteCompleted = true;
+    ReleasePacket(memory);
 }
 
 // Release any allocated objects
@@ -1436,6 +893,50 @@ void OneWirelessGamingReceiver::ReleaseAll(void)
 {
     IOLog("ReleaseAll\n");
     
+    BringUpStop();
+    
+    // A read or a pairing timeout could still finish a pairing, so shut
+    // them down before the controllers go
+    if (controllerLock != NULL)
+    {
+        IOLockLock(controllerLock);
+        controllersStopping = true;
+        IOLockUnlock(controllerLock);
+    }
+    for (int i = 0; i < ONE_READS; i++)
+    {
+        if (reads[i].pipe != NULL)
+            reads[i].pipe->Abort();
+    }
+    if (transactionTimer != NULL)
+    {
+        transactionTimer->cancelTimeout();
+        if (getWorkLoop() != NULL)
+            getWorkLoop()->removeEventSource(transactionTimer);
+        transactionTimer->release();
+        transactionTimer = NULL;
+    }
+    if (transactionLock != NULL)
+    {
+        IOLockLock(transactionLock);
+        ResetTransactions();
+        IOLockUnlock(transactionLock);
+    }
+    RemoveControllers();
+    
+    if (bringUpTimer != NULL)
+    {
+        bringUpTimer->cancelTimeout();
+        if (getWorkLoop() != NULL)
+            getWorkLoop()->removeEventSource(bringUpTimer);
+        bringUpTimer->release();
+        bringUpTimer = NULL;
+    }
+    if (bringUpTimes != NULL)
+    {
+        bringUpTimes->release();
+        bringUpTimes = NULL;
+    }
     if (device != NULL)
     {
         device->close(this);
@@ -1459,325 +960,359 @@ void OneWirelessGamingReceiver::_WriteComplete(void *target, void *parameter, IO
         ((OneWirelessGamingReceiver*)target)->WriteComplete(parameter, status, bufferSizeRemaining);
 }
 
-// Processes a message for a controller
+void OneWirelessGamingReceiver::_UploadComplete(void *target, void *parameter, IOReturn status, UInt32 bufferSizeRemaining)
+{
+    if (target != NULL)
+        ((OneWirelessGamingReceiver*)target)->UploadComplete(parameter, status, bufferSizeRemaining);
+}
+
+void OneWirelessGamingReceiver::_ControlComplete(void *target, void *parameter, IOReturn status, UInt32 bufferSizeRemaining)
+{
+    if (target != NULL)
+        ((OneWirelessGamingReceiver*)target)->ControlComplete(parameter, status, bufferSizeRemaining);
+}
+
+// Processes a message from the receiver. The first four bytes say what it is,
+// so they're read as one number and switched on.
 void OneWirelessGamingReceiver::ProcessMessage(const unsigned char *data, int length)
 {
-    IOLog("ProcessMessage\n");
+    UInt32 signature;
+    
+    // Controller input goes straight out, ahead of everything else
+    if (DeliverInput(data, length))
+        return;
+    
+#ifdef PROTOCOL_DEBUG
     const char hex[] = "0123456789ABCDEF";
-//#ifdef PROTOCOL_DEBUG
     char s[1024];
     int i;
     
-    for (i = 0; i < length; i++)
+    for (i = 0; (i < length) && (i < (int)sizeof(s) / 2 - 1); i++)
     {
         s[(i * 2) + 0] = hex[(data[i] & 0xF0) >> 4];
         s[(i * 2) + 1] = hex[data[i] & 0x0F];
     }
     s[i * 2] = '\0';
     IOLog("Got data (%d bytes): %s\n", length, s);
-    //0400404A - button press on the wireless adapter
-    if (data[0] == 0x04 && data[1] == 0x00 && data[2] == 0x40 && data[3] == 0x4A)
-    {
-        IOLog("Received adapter button press (fireworks, rainbows and unicorns)");
-        QueueWrite(outDevicePipe, GetFirmware("040000510000000000000000"));
-        QueueWrite(outDevicePipe, GetFirmware("080081501411410040060f0000000000"));
-        //QueueRead(inDevicePipe);
-        QueueWrite(outDevicePipe, GetFirmware("1800825038c041000000dd100050f2110110019d289900000000000000000000"));
-        QueueWrite(outDevicePipe, GetFirmware("080083501411410040063f6400000000"));
-        
+#endif
+    
+    if (length < 4)
+    {
+        UnknownMessage();
+        return;
     }
-    else if (data[0] == 0x48 && data[1] == 0x00 && data[2] == 0x08 && data[3] == 0x00)
+    signature = OneSignature(data);
+    
+    switch (signature)
     {
+        case ONE_SIGNATURE(0x04, 0x00, 0x40, 0x4a):
+            ReceivedButton(data, length);
+            return;
+        case ONE_SIGNATURE(0x48, 0x00, 0x08, 0x00):
+            ReceivedPairing(data, length);
+            return;
+        case ONE_SIGNATURE(0x44, 0x00, 0x08, 0x00):
+            Received44000800(data, length);
+            return;
+        case ONE_SIGNATURE(0x50, 0x00, 0xc0, 0x4a):
+            Received5000c04a(data, length);
+            return;
+        case ONE_SIGNATURE(0x5c, 0x00, 0xc0, 0x4a):
+            Received5c00c04a(data, length);
+            return;
+        case ONE_SIGNATURE(0x7c, 0x00, 0xc0, 0x4a):
+            // Only this variant wants a reply, others may still be awaited
+            if ((length > 0x7d) && (data[0x7c] == 0x00) && (data[0x7d] == 0x02))
+            {
+                Received7c00c04a(data, length);
+                return;
+            }
+            break;
+        case ONE_SIGNATURE(0x6c, 0x00, 0xc0, 0x4a):
+            Received6c00c04a(data, length);
+            return;
+        case ONE_SIGNATURE(0x44, 0x00, 0xc0, 0x4a):
+            Received4400c04a(data, length);
+            return;
+        case ONE_SIGNATURE(0x4c, 0x00, 0xc0, 0x4a):
+            Received4c00c04a(data, length);
+            return;
+        default:
+            break;
+    }
+    
+    if (!CompleteResponse(signature, data))
+        UnknownMessage();
+}
 
-        PairingParam *pparam = (PairingParam*)IOMalloc(sizeof(PairingParam));
-        thread_t thread;
-        
-        pparam->parent = this;
-        
-        //TODO: set a signal that we are pairing (so we don't send ping messages)?
-        //IOSleep(500);
-        IOLog("Received pairing signal!!!! freaking unikorns shooting rainbows!\n");
-        
-        
-        
-        //extract controller and adapter IDs
-        //get controller id at 2E for 6 bytes
-        //get adapter id at 28 for 6 bytes
-        for (int i = 0; i < 6; i ++)
-        {
-            controllerId[i] = data[i + 0x2e];
-            adapterId[i] = data[i + 0x28];
-        }
-        IOLog("Extracted controllerId: %02x%02x%02x%02x%02x%02x\n",
-              controllerId[0],
-              controllerId[1],
-              controllerId[2],
-              controllerId[3],
-              controllerId[4],
-              controllerId[5]);
-        IOLog("Extracted adapterId: %02x%02x%02x%02x%02x%02x\n",
-              adapterId[0],
-              adapterId[1],
-              adapterId[2],
-              adapterId[3],
-              adapterId[4],
-              adapterId[5]);
-        
-        kernel_thread_start(&ProcessPairing, pparam, &thread);
-        thread_deallocate(thread);
+// Counts messages nothing handled, logging them would swamp the system log
+// Called from the read completion, so the count is published later from a
+// thread call, at most once per interval however many arrive
+void OneWirelessGamingReceiver::UnknownMessage(void)
+{
+    UInt64 deadline;
+    
+    OSIncrementAtomic(&unknownMessages);
+    if ((unknownCall == NULL) || !OSCompareAndSwap(0, 1, &unknownPending))
+        return;
+    // Keep the receiver around until the call has run
+    retain();
+    clock_interval_to_deadline(ONE_UNKNOWN_INTERVAL, kMillisecondScale, &deadline);
+    if (thread_call_enter_delayed(unknownCall, deadline))
+        release();
+}
+
+// Thread call for publishing the unknown message count
+void OneWirelessGamingReceiver::UnknownThread(thread_call_param_t param0, thread_call_param_t param1)
+{
+    OneWirelessGamingReceiver *receiver = (OneWirelessGamingReceiver*)param0;
+    
+    // Cleared first, so a message counted after this read schedules another run
+    OSCompareAndSwap(1, 0, &receiver->unknownPending);
+    receiver->setProperty(kUnknownMessagesKey, receiver->unknownMessages, 32);
+    receiver->release();
+}
+
+//0400404A - button press on the wireless adapter
+void OneWirelessGamingReceiver::ReceivedButton(const unsigned char *data, int length)
+{
+    IOLog("Received adapter button press (fireworks, rainbows and unicorns)");
+    SendPacket(kOneButton1, NULL);
+    SendPacket(kOneButton2, NULL);
+    //QueueRead(inDevicePipe);
+    SendPacket(kOneButton3, NULL);
+    SendPacket(kOneButton4, NULL);
+}
+
+void OneWirelessGamingReceiver::ReceivedPairing(const unsigned char *data, int length)
+{
+    //TODO: set a signal that we are pairing (so we don't send ping messages)?
+    IOLog("Received pairing signal!!!! freaking unikorns shooting rainbows!\n");
+    
+    if (length < 0x34)
+        return;
+    
+    //extract controller and adapter IDs
+    //get controller id at 2E for 6 bytes
+    //get adapter id at 28 for 6 bytes
+    for (int i = 0; i < 6; i ++)
+    {
+        controllerId[i] = data[i + 0x2e];
+        adapterId[i] = data[i + 0x28];
     }
-    else if (CompareSignature(data, "44000800"))
+    IOLog("Extracted controllerId: %02x%02x%02x%02x%02x%02x\n",
+          controllerId[0],
+          controllerId[1],
+          controllerId[2],
+          controllerId[3],
+          controllerId[4],
+          controllerId[5]);
+    IOLog("Extracted adapterId: %02x%02x%02x%02x%02x%02x\n",
+          adapterId[0],
+          adapterId[1],
+          adapterId[2],
+          adapterId[3],
+          adapterId[4],
+          adapterId[5]);
+    
+    PairingStart(data);
+}
+
+void OneWirelessGamingReceiver::Received44000800(const unsigned char *data, int length)
+{
+    IOLog("Replying to 44000800\n");
+    
+    //sending third message
+    SendPacket(kOneReply44000800, &kOneRadio);
+}
+
+void OneWirelessGamingReceiver::Received5000c04a(const unsigned char *data, int length)
+{
+    //should be responding to this one only once!
+    if (!received5000c04a)
     {
-        unsigned char msg[84];
-        IOBufferMemoryDescriptor* outBuffer;
-        
-        IOLog("Replying to 44000800\n");
-        
-        //sending third message
-        ::HexToBytes("4c000805a800002001ff3800000000000000000000000001500000007eed8d5c41e36245b4ea2d596245b4ea2d5930010000000000000000640031c60000dd100050f2110210012c999500000001000000000000", msg, 84*2);
-        
-        // controllerid at position 28
-        // adapterId at positions 34 and 40
-        for (int i = 0; i < 6 ; i++ )
-        {
-            msg[i + 28] = controllerId[i];
-            msg[i + 34] = adapterId[i];
-            msg[i + 40] = adapterId[i];
-        }
-        
-        outBuffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, 84);
-        outBuffer->writeBytes(0, msg, 84);
+        received5000c04a = true;
+        IOLog("Replying to 5000c04a\n");
         
+        SendPacket(kOneReply5000c04a, &kOneData);
+    }
+}
+
+void OneWirelessGamingReceiver::Received5c00c04a(const unsigned char *data, int length)
+{
+    //TODO: update sequence number
+    IOLog("Replying to 5c00c04a\n");
+    
+    SendPacket(kOneReply5c00c04a, &kOneData);
+}
+
+void OneWirelessGamingReceiver::Received7c00c04a(const unsigned char *data, int length)
+{
+    //TODO: update sequence number
+    IOLog("Replying to 7c00c04a\n");
+    
+    SendPacket(kOneReply7c00c04a, &kOneData);
+}
+
+void OneWirelessGamingReceiver::Received6c00c04a(const unsigned char *data, int length)
+{
+    IOBufferMemoryDescriptor* outBuffer;
+    
+    IOLog("Replying to 6c00c04a\n");
+    
+    if (length <= 0x42)
+        return;
+    outBuffer = NewPacket(kOneReply6c00c04a, sizeof(kOneReply6c00c04a), &kOneData, controllerId, adapterId);
+    if (outBuffer != NULL)
+    {
+        //update the sequence
+        StampPacket(outBuffer, kOneDataSequence, &data[0x42]);
         QueueWrite(outDevicePipe, outBuffer);
     }
-    else if (CompareSignature(data, "5000c04a"))
+}
+
+void OneWirelessGamingReceiver::Received4400c04a(const unsigned char *data, int length)
+{
+    IOLog("Replying to 4400c04a\n");
+    
+    if (!received4400c04a)
     {
-        unsigned char msg[72];
-        IOBufferMemoryDescriptor* outBuffer;
-        
-        //should be responding to this one only once!
-        if (!received5000c04a)
-        {
-            received5000c04a = true;
-            IOLog("Replying to 5000c04a\n");
-        
-            ::HexToBytes("400000500000000000000000a000002001001f00000000000000000000000000880290007eed8d5c41e36245b4ea2d596245b4ea2d590000000000001e30040100e0ffff00000000", msg, 72*2);
-        
-            // controllerid at position 28
-            // adapterId at positions 34 and 40
-            for (int i = 0; i < 6 ; i++ )
-            {
-                msg[i + 0x24] = controllerId[i];
-                msg[i + 0x2a] = adapterId[i];
-                msg[i + 0x30] = adapterId[i];
-            }
+        received4400c04a = true;
         
-            outBuffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, 72);
-            outBuffer->writeBytes(0, msg, 72);
+        //work-arround - don't want any replies to the 5000c04a message after this point
+        received5000c04a = true;
         
-            QueueWrite(outDevicePipe, outBuffer);
-        }
+        //this will send 2 replies
+        SendPacket(kOneReply4400c04a1, &kOneData);
+        SendPacket(kOneReply4400c04a2, &kOneData);
+        SendPacket(kOneReply4400c04a3, &kOneData);
     }
-    else if (CompareSignature(data, "5c00c04a"))
+}
+
+void OneWirelessGamingReceiver::Received4c00c04a(const unsigned char *data, int length)
+{
+    IOLog("Replying to 4c00c04a\n");
+    
+    SendPacket(kOneReply4c00c04a, &kOneData);
+}
+
+// Hands controller input to its HID device. Anything else, or input from a
+// controller that hasn't paired, is left for ProcessMessage.
+bool OneWirelessGamingReceiver::DeliverInput(const unsigned char *data, int length)
+{
+    const unsigned char *input;
+    int i;
+    
+    if ((length < ONE_INPUT_OFFSET + 4) || (data[2] != 0xc0) || (data[3] != 0x4a))
+        return false;
+    input = data + ONE_INPUT_OFFSET;
+    if ((input[0] != 0x20) && (input[0] != 0x07))
+        return false;
+    
+    IOLockLock(controllerLock);
+    for (i = 0; i < WIRELESS_CONNECTIONS; i++)
     {
-        //TODO: update sequence number
-        unsigned char msg[68];
-        IOBufferMemoryDescriptor* outBuffer;
-        
-        IOLog("Replying to 5c00c04a\n");
-        
-        ::HexToBytes("3c0000500000000000000000a000002001001e00000000000000000000000000880290007eed8d5c41e36245b4ea2d596245b4ea2d590000000000000420010000000000", msg, 68*2);
-        
-        // controllerid at position 28
-        // adapterId at positions 34 and 40
-        for (int i = 0; i < 6 ; i++ )
+        if ((controllers[i] != NULL) && (memcmp(controllers[i]->GetMAC(), data + ONE_SOURCE_OFFSET, 6) == 0))
         {
-            msg[i + 0x24] = controllerId[i];
-            msg[i + 0x2a] = adapterId[i];
-            msg[i + 0x30] = adapterId[i];
+            controllers[i]->ReceiveInput(input, length - ONE_INPUT_OFFSET);
+            break;
         }
+    }
+    IOLockUnlock(controllerLock);
+    return i < WIRELESS_CONNECTIONS;
+}
 
-        outBuffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, 68);
-        outBuffer->writeBytes(0, msg, 68);
-        
-        QueueWrite(outDevicePipe, outBuffer);
+// Creates the HID device for a controller that has finished pairing
+void OneWirelessGamingReceiver::AddController(const unsigned char *mac)
+{
+    OneWirelessController *controller;
+    int i, slot;
+    
+    controller = new OneWirelessController;
+    if (controller == NULL)
+        return;
+    if (!controller->init())
+    {
+        controller->release();
+        return;
     }
-    else if (CompareSignature(data, "7c00c04a") && data[0x7c] == 0x00 && data[0x7d] == 0x02)
+    
+    // Claim the slot before starting, so two pairings can't take the same one
+    IOLockLock(controllerLock);
+    if (controllersStopping)
     {
-        //TODO: update sequence number
-        unsigned char msg[80];
-        IOBufferMemoryDescriptor* outBuffer;
-        
-        IOLog("Replying to 7c00c04a\n");
-        
-        ::HexToBytes("480000500000000000000000a000002001002700000000000000000000000000880290007eed8d5c41e36245b4ea2d596245b4ea2d59000000000000012001090004203a0000009c00e0ffff00000000", msg, 80*2);
-        
-        // controllerid at position 28
-        // adapterId at positions 34 and 40
-        for (int i = 0; i < 6 ; i++ )
-        {
-            msg[i + 0x24] = controllerId[i];
-            msg[i + 0x2a] = adapterId[i];
-            msg[i + 0x30] = adapterId[i];
-        }
-        
-        outBuffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, 80);
-        outBuffer->writeBytes(0, msg, 80);
-        
-        QueueWrite(outDevicePipe, outBuffer);
+        IOLockUnlock(controllerLock);
+        controller->release();
+        return;
     }
-    else if (CompareSignature(data, "6c00c04a"))
+    slot = -1;
+    for (i = 0; i < WIRELESS_CONNECTIONS; i++)
     {
-        unsigned char msg[80];
-        IOBufferMemoryDescriptor* outBuffer;
-        unsigned char seq = data[0x42];
-        
-        IOLog("Replying to 6c00c04a\n");
-        
-        ::HexToBytes("480000500000000000000000a000002001002700000000000000000000000000880290007eed8d5c41e36245b4ea2d596245b4ea2d5900000000000001200309000420d60000000000e0ffff00000000", msg, 80*2);
-        
-        //update the sequence
-        msg[0x3e] = seq;
-        
-        // controllerid at position 28
-        // adapterId at positions 34 and 40
-        for (int i = 0; i < 6 ; i++ )
-        {
-            msg[i + 0x24] = controllerId[i];
-            msg[i + 0x2a] = adapterId[i];
-            msg[i + 0x30] = adapterId[i];
-        }
-        
-        outBuffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, 80);
-        outBuffer->writeBytes(0, msg, 80);
-        
-        QueueWrite(outDevicePipe, outBuffer);
+        if ((controllers[i] != NULL) && (memcmp(controllers[i]->GetMAC(), mac, 6) == 0))
+            break;
+        if ((controllers[i] == NULL) && (slot == -1))
+            slot = i;
     }
-    else if (CompareSignature(data, "4400c04a"))
+    if ((i == WIRELESS_CONNECTIONS) && (slot != -1))
     {
-        unsigned char msg[72];
-        IOBufferMemoryDescriptor* outBuffer;
-        
-        IOLog("Replying to 4400c04a\n");
-        
-        if (!received4400c04a)
-        {
-            received4400c04a = true;
-        
-        
-            //work-arround - don't want any replies to the 5000c04a message after this point
-            received5000c04a = true;
-            
-            //this will send 2 replies
-            
-            ::HexToBytes("400000500000000000000000a000002001001f00000000000000000000000000880290007eed8d5c41e36245b4ea2d596245b4ea2d590000000000000520020100e0ffff00000000", msg, 72*2);
-            
-            // controllerid at position 28
-            // adapterId at positions 34 and 40
-            for (int i = 0; i < 6 ; i++ )
-            {
-                msg[i + 0x24] = controllerId[i];
-                msg[i + 0x2a] = adapterId[i];
-                msg[i + 0x30] = adapterId[i];
-            }
-            
-            outBuffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, 72);
-            outBuffer->writeBytes(0, msg, 72);
-            
-            QueueWrite(outDevicePipe, outBuffer);
-            
-            ::HexToBytes("400000500000000000000000a000002001002100000000000000000000000000880290007eed8d5c41e36245b4ea2d596245b4ea2d590000000000000a200303000114ff00000000", msg, 72*2);
-            
-            // controllerid at position 28
-            // adapterId at positions 34 and 40
-            for (int i = 0; i < 6 ; i++ )
-            {
-                msg[i + 0x24] = controllerId[i];
-                msg[i + 0x2a] = adapterId[i];
-                msg[i + 0x30] = adapterId[i];
-            }
-            
-            outBuffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, 72);
-            outBuffer->writeBytes(0, msg, 72);
-            
-            QueueWrite(outDevicePipe, outBuffer);
-            //::HexToBytes("400000500000000000000000a000002001001f00000000000000000000000000880290007eed8d5c41e36245b4ea2d596245b4ea2d590000000000001e30040100e0ffff00000000", msg, 72*2);
-            ::HexToBytes("400000500000000000000000a000002001001f00000000000000000000000000880290007eed8d5c41e36245b4ea2d596245b4ea2d590000000000001e3004010000000000000000", msg, 72*2);
-            
-            // controllerid at position 28
-            // adapterId at positions 34 and 40
-            for (int i = 0; i < 6 ; i++ )
-            {
-                msg[i + 0x24] = controllerId[i];
-                msg[i + 0x2a] = adapterId[i];
-                msg[i + 0x30] = adapterId[i];
-            }
-            
-            outBuffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, 72);
-            outBuffer->writeBytes(0, msg, 72);
-            
-            QueueWrite(outDevicePipe, outBuffer);
-        }
-        
+        controller->SetIdentity(mac, slot);
+        controllers[slot] = controller;
     }
-    else if (CompareSignature(data, "4c00c04a"))
+    IOLockUnlock(controllerLock);
+    
+    if (i != WIRELESS_CONNECTIONS)
     {
-        unsigned char msg[72];
-        IOBufferMemoryDescriptor* outBuffer;
-        
-        IOLog("Replying to 4c00c04a\n");
-        
-        //this will send 2 replies
-        
-        ::HexToBytes("400000500000000000000000a000002001001f00000000000000000000000000880290007eed8d5c41e36245b4ea2d596245b4ea2d590000000000001e30050101e0ffff00000000", msg, 72*2);
-        
-        // controllerid at position 28
-        // adapterId at positions 34 and 40
-        for (int i = 0; i < 6 ; i++ )
-        {
-            msg[i + 0x24] = controllerId[i];
-            msg[i + 0x2a] = adapterId[i];
-            msg[i + 0x30] = adapterId[i];
-        }
-        
-        outBuffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, 72);
-        outBuffer->writeBytes(0, msg, 72);
-        
-        QueueWrite(outDevicePipe, outBuffer);
+        // Paired again, the existing device carries on
+        controller->release();
+        return;
     }
-    else
+    if (slot == -1)
     {
-        //TODO: we might act on expired waitlocks.. how do we figure out?
-        if (waitLock != NULL)
-        {
-            IOLog("waitLock si not null\n");
-        }
-        else
-        {
-            IOLog("waitLock is null\n");
-        }
-        
-        //check for locks
-        if (waitLock != NULL)
-            
+        IOLog("controller - no free slot\n");
+        controller->release();
+        return;
+    }
+    
+    if (!controller->attach(this))
+    {
+        IOLog("controller - failed to attach\n");
+        goto fail;
+    }
+    if (!controller->start(this))
+    {
+        IOLog("controller - failed to start\n");
+        controller->detach(this);
+        goto fail;
+    }
+    return;
+fail:
+    IOLockLock(controllerLock);
+    controllers[slot] = NULL;
+    IOLockUnlock(controllerLock);
+    controller->release();
+}
+
+// Removes every controller's HID device
+void OneWirelessGamingReceiver::RemoveControllers(void)
+{
+    OneWirelessController *controller;
+    
+    // Without the lock start failed before any could be added
+    if (controllerLock == NULL)
+        return;
+    for (int i = 0; i < WIRELESS_CONNECTIONS; i++)
+    {
+        IOLockLock(controllerLock);
+        controller = controllers[i];
+        controllers[i] = NULL;
+        IOLockUnlock(controllerLock);
+        if (controller != NULL)
         {
-            if (waitLock->signature[0] == data[0] &&
-            waitLock->signature[1] == data[1] &&
-            waitLock->signature[2] == data[2] &&
-            waitLock->signature[3] == data[3])
-            {
-                IOLock * lock = waitLock->lock;
-                void *event = waitLock->lock;
-                waitLock = NULL;
-                IOLockWakeup(lock, event, false);
-            }
+            controller->terminate(kIOServiceRequired);
+            controller->detachAll(gIOServicePlane);
+            controller->release();
         }
-        
     }
-//#endif
-    //IOLog("Got data (%d bytes)\n", length);
-    
-    //TODO: figure out if the buffer needs to be released, and how
 }
 
 // Get our location ID
@@ -1807,212 +1342,303 @@ OSNumber* OneWirelessGamingReceiver::newLocationIDNumber() const
     return OSNumber::withNumber(location, 32);
 }
 
-IOBufferMemoryDescriptor* OneWirelessGamingReceiver::GetFirmware(int index)
+// Copies a message into a pooled buffer, stamping in the addresses if it has
+// any. If every pooled buffer is in flight a new one is allocated instead.
+IOBufferMemoryDescriptor* OneWirelessGamingReceiver::NewPacket(const unsigned char *packet, IOByteCount length, const OneAddressing *addressing,
+                                                               const unsigned char *controller, const unsigned char *adapter)
 {
-    char* buff;
-    unsigned long hexLength;
-    IOBufferMemoryDescriptor* outBuffer;
+    IOBufferMemoryDescriptor *buffer = NULL;
+    UInt32 busy;
+    int i;
     
-    switch (index) {
-        case 1:
-            hexLength = strlen(firmware1);
-            buff = new char[hexLength];
-            ::HexToBytes(firmware1, buff, hexLength);
-            break;
-        case 2:
-            hexLength = strlen(firmware2);
-            buff = new char[hexLength];
-            ::HexToBytes(firmware2, buff, hexLength);
-            break;
-        case 3:
-            hexLength = strlen(firmware3);
-            buff = new char[hexLength];
-            ::HexToBytes(firmware3, buff, hexLength);
-            break;
-        case 4:
-            hexLength = strlen(firmware4);
-            buff = new char[hexLength];
-            ::HexToBytes(firmware4, buff, hexLength);
-            break;
-        case 5:
-            hexLength = strlen(firmware5);
-            buff = new char[hexLength];
-            ::HexToBytes(firmware5, buff, hexLength);
-            break;
-        case 6:
-            hexLength = strlen(firmware6);
-            buff = new char[hexLength];
-            ::HexToBytes(firmware6, buff, hexLength);
-            break;
-        default:
-            break;
+    if (length <= ONE_PACKET_MAX)
+    {
+        for (i = 0; i < ONE_PACKET_POOL; )
+        {
+            busy = packetPoolBusy;
+            if ((busy & (1 << i)) != 0 || packetPool[i] == NULL)
+                i++;
+            else if (OSCompareAndSwap(busy, busy | (1 << i), &packetPoolBusy))
+            {
+                buffer = packetPool[i];
+                buffer->setLength(length);
+                break;
+            }
+        }
+    }
+    if (buffer == NULL)
+    {
+        buffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, length);
+        if (buffer == NULL)
+            return NULL;
     }
     
-    outBuffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, hexLength/2);
-    outBuffer->writeBytes(0, buff, hexLength/2);
-    
-    return outBuffer;
+    memcpy(buffer->getBytesNoCopy(), packet, length);
+    if (addressing != NULL)
+    {
+        StampPacket(buffer, addressing->controller, controller);
+        StampPacket(buffer, addressing->adapter, adapter);
+        StampPacket(buffer, addressing->source, adapter);
+    }
+    return buffer;
 }
 
-IOBufferMemoryDescriptor* OneWirelessGamingReceiver::GetFirmware(const char input[])
+// Returns a buffer to the pool, or releases it if it didn't come from there
+void OneWirelessGamingReceiver::ReleasePacket(IOMemoryDescriptor *buffer)
 {
-    char* buff;
-    unsigned long hexLength;
-    IOBufferMemoryDescriptor* outBuffer;
+    for (int i = 0; i < ONE_PACKET_POOL; i++)
+    {
+        if (buffer == packetPool[i])
+        {
+            OSBitAndAtomic(~(1 << i), &packetPoolBusy);
+            return;
+        }
+    }
+    buffer->release();
+}
+
+void OneWirelessGamingReceiver::StampPacket(IOBufferMemoryDescriptor *buffer, const OnePatch &field, const unsigned char *value)
+{
+    memcpy((unsigned char*)buffer->getBytesNoCopy() + field.offset, value, field.length);
+}
+
+bool OneWirelessGamingReceiver::SendPacket(const unsigned char *packet, IOByteCount length, const OneAddressing *addressing,
+                                           const unsigned char *controller, const unsigned char *adapter)
+{
+    return QueueWrite(outDevicePipe, NewPacket(packet, length, addressing, controller, adapter));
+}
+
+// Forgets every outstanding request, without calling their handlers
+void OneWirelessGamingReceiver::ResetTransactions(void)
+{
+    int i;
     
-    hexLength = strlen(input);
-    buff = new char[hexLength];
-    ::HexToBytes(input, buff, hexLength);
-    outBuffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, hexLength/2);
-    outBuffer->writeBytes(0, buff, hexLength/2);
+    for (i = 0; i < ONE_TRANSACTION_BUCKETS; i++)
+    {
+        transactionHead[i] = -1;
+        transactionTail[i] = -1;
+    }
+    for (i = 0; i < ONE_TRANSACTIONS; i++)
+        transactions[i].next = (i + 1 < ONE_TRANSACTIONS) ? i + 1 : -1;
+    transactionFree = 0;
+    transactionWake = 0;
+    bzero(pairings, sizeof(pairings));
+}
+
+// Registers a handler for the next message starting with signature. Requests
+// for the same signature are answered in the order they were made, and the
+// handler gets kIOReturnTimeout if nothing comes in time.
+bool OneWirelessGamingReceiver::ExpectResponse(UInt32 signature, TransactionHandler handler, OnePairing *pairing)
+{
+    Transaction *transaction;
+    UInt64 deadline;
+    int index, bucket;
     
+    clock_interval_to_deadline(ONE_TRANSACTION_TIMEOUT, kMillisecondScale, &deadline);
+    bucket = OneTransactionBucket(signature);
     
-    return outBuffer;
+    IOLockLock(transactionLock);
+    index = transactionFree;
+    if (index == -1)
+    {
+        IOLockUnlock(transactionLock);
+        IOLog("expect - too many requests waiting\n");
+        return false;
+    }
+    transaction = &transactions[index];
+    transactionFree = transaction->next;
+    transaction->signature = signature;
+    transaction->deadline = deadline;
+    transaction->handler = handler;
+    transaction->pairing = pairing;
+    transaction->next = -1;
+    if (transactionTail[bucket] == -1)
+        transactionHead[bucket] = index;
+    else
+        transactions[transactionTail[bucket]].next = index;
+    transactionTail[bucket] = index;
+    // Setting the timer under the lock keeps a later deadline from overtaking this one
+    if (((transactionWake == 0) || (deadline < transactionWake)) && (transactionTimer != NULL))
+    {
+        transactionWake = deadline;
+        transactionTimer->wakeAtTime(deadline);
+    }
+    IOLockUnlock(transactionLock);
+    return true;
 }
 
-void OneWirelessGamingReceiver::ProcessPairing(void* parameter, wait_result_t waitResult)
+// Hands a message to the oldest request waiting for it, if there is one
+bool OneWirelessGamingReceiver::CompleteResponse(UInt32 signature, const unsigned char *data)
 {
+    TransactionHandler handler;
+    OnePairing *pairing;
+    int bucket, index, previous;
     
-    unsigned char msg1[20];
-    unsigned char msg3[68];
-    IOBufferMemoryDescriptor* outBuffer;
-    PairingParam *data = (PairingParam*)parameter;
-    AbsoluteTime atime;
-    uint64_t deadline;
-    WaitSignature *waitSignature = (WaitSignature*)IOMalloc(sizeof(WaitSignature));
-    int lockStatus;
-    bool needToUnlock = false;
-    
+    bucket = OneTransactionBucket(signature);
     
+    IOLockLock(transactionLock);
+    previous = -1;
+    for (index = transactionHead[bucket]; index != -1; index = transactions[index].next)
+    {
+        if (transactions[index].signature == signature)
+            break;
+        previous = index;
+    }
+    if (index == -1)
+    {
+        IOLockUnlock(transactionLock);
+        return false;
+    }
+    if (previous == -1)
+        transactionHead[bucket] = transactions[index].next;
+    else
+        transactions[previous].next = transactions[index].next;
+    if (transactionTail[bucket] == index)
+        transactionTail[bucket] = previous;
+    handler = transactions[index].handler;
+    pairing = transactions[index].pairing;
+    transactions[index].next = transactionFree;
+    transactionFree = index;
+    IOLockUnlock(transactionLock);
+    
+    (this->*handler)(pairing, kIOReturnSuccess, data);
+    return true;
+}
+
+void OneWirelessGamingReceiver::TransactionTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender)
+{
+    OneWirelessGamingReceiver *receiver = OSDynamicCast(OneWirelessGamingReceiver, owner);
     
-    nanoseconds_to_absolutetime(100000000ull, &atime);
-    clock_absolutetime_interval_to_deadline(atime, &deadline);
+    if (receiver != NULL)
+        receiver->TransactionTimerAction(sender);
+}
+
+// Times out every request past its deadline, then sets the timer for the next one
+void OneWirelessGamingReceiver::TransactionTimerAction(IOTimerEventSource *sender)
+{
+    TransactionHandler handlers[ONE_TRANSACTIONS];
+    OnePairing *expired[ONE_TRANSACTIONS];
+    UInt64 now, next;
+    int bucket, index, previous, following, count, i;
     
-    IOLog("ATime is %llu\n", atime);
+    clock_get_uptime(&now);
+    next = 0;
+    count = 0;
     
-    if (IOLockTryLock(data->parent->pairingLock))
+    IOLockLock(transactionLock);
+    for (bucket = 0; bucket < ONE_TRANSACTION_BUCKETS; bucket++)
     {
-        needToUnlock = true;
-        // Sending first message
-        //bytes 8-d are the controllerId
-        ::HexToBytes("0c008d5008184100ffffffffffff000000000000", msg1, 40);
-        for (int i = 0; i < 6; i++) 
+        previous = -1;
+        for (index = transactionHead[bucket]; index != -1; index = following)
         {
-            msg1[i + 8] = data->parent->controllerId[i];
-        }
-        
-        outBuffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, 20);
-        outBuffer->writeBytes(0, msg1, 20);
-        
-        data->parent->QueueWrite(data->parent->outDevicePipe, outBuffer);
-        
-        //-- previous checkpoint
-        
-        //wait for confirmation message
-        //set the header that we are expecting
-        IOLog("Waiting for confirmation for first message\n");
-        ::HexToBytes("08000d4a", waitSignature->signature, 8);
-        waitSignature->lock = data->parent->pairingLock;
-        data->parent->waitLock = waitSignature;
-        lockStatus = IOLockSleepDeadline(data->parent->pairingLock, data->parent->pairingLock, deadline, THREAD_UNINT);
-        IOLog("Lock woke up\n");
-        
-        
-        if (lockStatus == THREAD_TIMED_OUT)
-        {
-            // TODO: MUST BE THREAD SAFE!
-            if (data->parent->waitLock == waitSignature)
+            following = transactions[index].next;
+            if (transactions[index].deadline > now)
             {
-                data->parent->waitLock = NULL;
+                if ((next == 0) || (transactions[index].deadline < next))
+                    next = transactions[index].deadline;
+                previous = index;
+                continue;
             }
-            IOLog("Thread timed out. \n");
+            if (previous == -1)
+                transactionHead[bucket] = following;
+            else
+                transactions[previous].next = following;
+            if (transactionTail[bucket] == index)
+                transactionTail[bucket] = previous;
+            handlers[count] = transactions[index].handler;
+            expired[count] = transactions[index].pairing;
+            count++;
+            transactions[index].next = transactionFree;
+            transactionFree = index;
         }
-        else if (lockStatus != THREAD_AWAKENED)
-        {
-            goto fail;
-        }
-        
-        
-        
-        // Sending second message
-        data->parent->QueueWrite(data->parent->outDevicePipe, data->parent->GetFirmware("0c003e500100000000000000401f000000000000"));
-        
-        //wait for confirmation message
-        ::HexToBytes("08000e4a", waitSignature->signature, 8);
-        waitSignature->lock = data->parent->pairingLock;
-        data->parent->waitLock = waitSignature;
-        lockStatus = IOLockSleepDeadline(data->parent->pairingLock, data->parent->pairingLock, deadline, THREAD_UNINT);
-        IOLog("Lock woke up\n");
-        
-        if (lockStatus == THREAD_TIMED_OUT)
-        {
-            // TODO: MUST BE THREAD SAFE!
-            if (data->parent->waitLock == waitSignature)
-            {
-                data->parent->waitLock = NULL;
-            }
-            IOLog("Thread timed out. \n");
-        }
-        else if (lockStatus != THREAD_AWAKENED)
-        {
-            goto fail;
-        }
-        IOLog("Confirmation received\n");
-        
-        
-        //sending third message
-        ::HexToBytes("3c000805a000002001ff2600000000000000000000000001100000007eed8d5c41e36245b4ea2d596245b4ea2d59f00000001001000f0000000000000000000000000000", msg3, 68*2);
-        
-        // controllerid at position 28
-        // adapterId at positions 34 and 40
-        for (int i = 0; i < 6 ; i++ )
-        {
-            msg3[i + 28] = data->parent->controllerId[i];
-            msg3[i + 34] = data->parent->adapterId[i];
-            msg3[i + 40] = data->parent->adapterId[i];
-        }
-        
-        outBuffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, 68);
-        outBuffer->writeBytes(0, msg3, 68);
-        
-        data->parent->QueueWrite(data->parent-> outDevicePipe, outBuffer);
-        
-        //wait for confirmation message
-        ::HexToBytes("3c000800", waitSignature->signature, 8);
-        waitSignature->lock = data->parent->pairingLock;
-        data->parent->waitLock = waitSignature;
-        lockStatus = IOLockSleepDeadline(data->parent->pairingLock, data->parent->pairingLock, deadline, THREAD_UNINT);
-        IOLog("Lock woke up\n");
-        
-        if (lockStatus == THREAD_TIMED_OUT)
-        {
-            // TODO: MUST BE THREAD SAFE!
-            if (data->parent->waitLock == waitSignature)
-            {
-                data->parent->waitLock = NULL;
-            }
-            IOLog("Thread timed out. \n");
-        }
-        else if (lockStatus != THREAD_AWAKENED)
+    }
+    transactionWake = next;
+    if (next != 0)
+        sender->wakeAtTime(next);
+    IOLockUnlock(transactionLock);
+    
+    for (i = 0; i < count; i++)
+        (this->*handlers[i])(expired[i], kIOReturnTimeout, NULL);
+}
+
+// A controller asked to pair, walk it through the handshake unless it already is
+void OneWirelessGamingReceiver::PairingStart(const unsigned char *data)
+{
+    OnePairing *pairing = NULL;
+    int i;
+    
+    IOLockLock(transactionLock);
+    for (i = 0; i < ONE_PAIRINGS; i++)
+    {
+        if (pairings[i].active && (memcmp(pairings[i].controllerId, data + 0x2e, 6) == 0))
         {
-            goto fail;
+            IOLockUnlock(transactionLock);
+            IOLog("pairing - already in progress\n");
+            return;
         }
-        IOLog("Confirmation received\n");
-        
-        IOLog("Done sending pairing commands.\n");
+        if (!pairings[i].active && (pairing == NULL))
+            pairing = &pairings[i];
     }
-    
-fail:
-    if (needToUnlock)
+    if (pairing != NULL)
     {
-        IOLockUnlock(data->parent->pairingLock);
+        pairing->active = true;
+        pairing->step = 0;
+        memcpy(pairing->controllerId, data + 0x2e, 6);
+        memcpy(pairing->adapterId, data + 0x28, 6);
     }
+    IOLockUnlock(transactionLock);
     
-    IOFree(data, sizeof(PairingParam));
-    IOFree(waitSignature, sizeof(WaitSignature));
+    if (pairing == NULL)
+    {
+        IOLog("pairing - too many controllers pairing\n");
+        return;
+    }
+    PairingStep(pairing, kIOReturnSuccess, NULL);
+}
 
-    //when all is said and done
-    //thread_deallocate(current_thread());
-    //thread_terminate(current_thread());
-     
+// Sends the next pairing message once the last one is confirmed or timed out.
+// Each step registers for its confirmation before sending, so it can't be missed.
+void OneWirelessGamingReceiver::PairingStep(OnePairing *pairing, IOReturn status, const unsigned char *data)
+{
+    IOBufferMemoryDescriptor* outBuffer;
+    
+    if (status == kIOReturnTimeout)
+        IOLog("pairing - step %d timed out\n", pairing->step);
+    
+    switch (pairing->step++)
+    {
+        case 0:
+            if (!ExpectResponse(ONE_SIGNATURE(0x08, 0x00, 0x0d, 0x4a), &OneWirelessGamingReceiver::PairingStep, pairing))
+                break;
+            //bytes 8-d are the controllerId
+            outBuffer = NewPacket(kOnePairing1, sizeof(kOnePairing1), NULL, NULL, NULL);
+            if (outBuffer != NULL)
+                StampPacket(outBuffer, kOnePairController, pairing->controllerId);
+            if (!QueueWrite(outDevicePipe, outBuffer))
+                IOLog("pairing - failed to send step 0\n");
+            return;
+            
+        case 1:
+            if (!ExpectResponse(ONE_SIGNATURE(0x08, 0x00, 0x0e, 0x4a), &OneWirelessGamingReceiver::PairingStep, pairing))
+                break;
+            if (!SendPacket(kOnePairing2, NULL, pairing))
+                IOLog("pairing - failed to send step 1\n");
+            return;
+            
+        case 2:
+            if (!ExpectResponse(ONE_SIGNATURE(0x3c, 0x00, 0x08, 0x00), &OneWirelessGamingReceiver::PairingStep, pairing))
+                break;
+            if (!SendPacket(kOnePairing3, &kOneRadio, pairing))
+                IOLog("pairing - failed to send step 2\n");
+            return;
+            
+        default:
+            IOLog("Done sending pairing commands.\n");
+            AddController(pairing->controllerId);
+            break;
+    }
+    
+    IOLockLock(transactionLock);
+    pairing->active = false;
+    IOLockUnlock(transactionLock);
 }
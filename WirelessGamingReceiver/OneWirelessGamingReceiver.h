@@ -25,29 +25,83 @@
 
 #include <IOKit/usb/IOUSBDevice.h>
 #include <IOKit/usb/IOUSBInterface.h>
+#include <IOKit/IOTimerEventSource.h>
+#include <kern/thread_call.h>
+#include "onesignature.h"
 
 // This value is defined by the hardware and fixed
 #define WIRELESS_CONNECTIONS        4
 
-constexpr static const char firmware1[] = "003800100009460001105800080046200110582108004c010008441000001c1000014c017ffe4600011258000ba04620011c582107104c010008441000001c1000014c017ffe83c44a00782046200400443000ea8022800114310104442000981420810614300108dd9e92003bfffcbceffc4610040004208100800158210022142081000410010a42109c091410010a46f0011c0057804d8421d10c46f00112045782e2d107840046f0008458f78eacdd2fec043bfffc84dd9e92003a6f9cbceffc461004000420810080015821001114208100041001064660011258630bbc5810808014100106445003e8b4069c01b606d80c84024410006d844046f0000658f78c04dd2f8400b60646f00112040782ef54000003c0038400d507802046f0008258f78af4dd2f46f00112042782ef4410012c40210436c10384a1d81f46f00112040782dcc006844046f0011210278b904660011200130b9084a1d10f842046f0008258f78204dd2f46f00112040782dcc804840110030b9046f0011c0007854cc03346f00112047782ef840a400380f6cf2b4660011258630bb8b40684a39c01b606d80746f0008758f785d8dd2fb6e64600041204000281c0175410000fc10f960046f0008758f78418dd2f84a1d807840046f0008758f78528dd2f46000412842f1410028146f00112040782df84a1d822460004100460010540033808921fc00a840244100064844046f0000658f78c04dd2f54030080c00a840244100064844146f0000658f78c04dd2f4600041014600105ec043a6f9c84dd9e92003a6f9cbceffc4600041058000800046000784073400997f854038002c00846f001120477831244620000d52996309644c10746f001120477830184c1d52054000002c00746f001120477830284c2d51797fcc70846f001120477831144610000d50e800780274620008e58210ca4443000c946f0000458f7813cdd2f46000410580008008420146000784620008e58210ca440009c06443000d446f0000458f7813cdd2f4600011b58000580dd27ec043a6f9c84dd9e92003a6f9cbceffc4620008e58210ca480c080e15c00002084204430009646f0000458f7813cdd2f4600011258000c0438701a0a46100410581088000400807884414061180c40030004140080780400807a406300041460807aec043a6f9c84dd9e3a6fa4bceff48420f18144100040101f8004101f80074610041058108800b4415060059c58010002b6018001f20114208071047000714680041042138c0bf78158840800c9f74273840bcff44690008058948ad450137a6450237ee4500401a084644be024014600041050137aa450237ef4580009b084644be0240146000410469000805894897c50137ae450237f0458000980443000204be024014600041050137ce450237f8444300020580009904be024018403aff5aff4100401a8100401b814730009aff7aff6a9f4a9f5a9f2a9f35003001c46f0008158f787b4dd2f0414007158008005f181100f8004f00114040071ec0c3a6fa484dd9e3a6f9cbceff480c0500f800480e146f0000158f78c2cdd2f0403016b0413016c500000209a01e402e945001305a35000802894049830a68754210080c23b5020814838730a0a944ca0ba9871b640a0fb143080a30223800ca44354213fff922e4010b80840108804ac43a645a6875410807f582100405421007fae87ae4546000410001305a30423016c9c495410801f9c91580008001423016c101305a310100198f00146f0000158f78c58dd2f8401d508f00146f0000158f78c58dd2f8400ec0c3a6f9c84dd9e3a6fa0bceff880c0500f800480e146f0000158f78c2cdd2f040301690413016a500000209a01e402e973003305a250118008944c98710080800754840080548400ff4e83000af00146f0000158f78c58dd2f8008d564500181283873020a0003801c9604c0064600011a58000548d502a03a50218008b601949498b20213800ca4135410bfff920e4000380840000404ac13941ca657983050000088846058108040ae57b660a512a757928e40423808ad125452807fa715af5742421809af15aec7a6c6447fffcf40319c0258318008aec646100410a4935810880054213fffac82000305a20423016a9c015400001f9c911423016a100305a210008188f00146f0000158f78c58dd2f8401d508f00146f0000158f78c58dd2f8400ec083a6fa084dd9e3a6faabceff480c0500f800446f0000158f78c2cdd2f850047c0000459ce013c46a0008158a50488d522a73f54420080c434389302023883020a40042406dd3c0004801a4620011a582102189404802998024be02801a63f441fffc040000404ae3f0403016b9c011403016b0443016b0453016c5472001f500381485073802895fc9b2c80284620008e58210cc0443001fa99f74e46ffcbf00146f0000158f78c58dd2fec0c3a6faa84dd9e3a6faabceff48100500005c88520f08146a0008158a5048845c00050d563a65754108080c16e38640e028cd838940e0aa674968cca44a6b554108002c21d00237ffb80295c010010443001bd4620008e58210cc046f0000458f7813cdd2fa6b400137ffb582100024210f024aeb450008040f101d51fc114a63300137ffb46f0008558f78268dd2f4600008e58000cdc50137ff846f0008158f78a4cdd2fa6728480af3414937ffd940c4610011a58108218980150137fe84be028015003800894048808a687a645443fffc040210c0458108040ae87ae45040401699c0114040169040401690414016a5470001f5023800894949a485033812888484e16ff91ec0c3a6faa84dd9e3bfffcbceffc46f0008058f78728dd2fec043bfffc84dd9e3a6faabcefe48420101f8015101f8017101f801646100410581088005030f894f181f38250af8017509f8016508f801580e0f60101c385a1001301bc500e0004940480699838505e01248088804a4dc08063a64754108080c15ea443f6025410bfff38039602f183b4a6b6bf46f0008358f7880cdd2f80c08401b4bf4c604021002f8015000f8017001f801646f00112145782f046f0008258f7830cdd2f000f8017802646f0008258f78af4dd2f000f8017f10346f0008558f780f4dd2f506e000495b499be800684204420001046f0005a58f783c4dd2fa637501e01243813860258000040a04aae37b626a433920e4000380858000648ac33f30111c181b8000385a19c0154000003100385a1f602b406d590ec1c3a6faa84dd9e3bfffcbceffc46f0008058f78848dd2fec043bfffc84dd9e3a6faabceffcb620a8c180c1a04384e081238102a84247c0005a59ce03c48147d50cdd3ca637441fffc040000404ae371ca400019df98cd08006842044200010e2e9e9f0ec043a6faa84dd9e3a6faabceff44690041080e05894880046300082583186c047c0005a59ce03c4008385a0005481ac400420009c01940340641008983850a4012099be4c82802da67754108080c128a4b3a0013813aa02f38154213fffdd238420800644200010dd3ca6373813aa0258000040a04aae37b626a433920e4000380858000648ac33108481a8000385a09c0154000003100385a0f301d5c6ec0c3a6faa84dd9e92003a6f98bc0420016d80c054210002ca0984024410006f46f0000658f78c04dd2f0403016d580000021403016d3a6f9884dd9e92003a6f98bc0420016d80c04401000040210002ca0984024410006f46f0000658f78c04dd2f0403016d420040081403016d3a6f9884dd9e92003a6faabceff4b6208143a8c146300410583189b080c140700c03a0434640011a584202084650011a585281f840329c1a40321c1bf3818122a842850045c00648d52c46f0005a58f783c4dd2ff00146f0008158f780c4dd2f80e0c80d80204620008e58210cc0443000d046f0000458f7813cdd2f13c38008a6778d015410803fae77a473922e4010b80858108648ac73a07aaa741c7480018420442000108006e30ae9d0ec0c3a6faa84dd9e3a6f98bc4600040058000200a18440032009960054100010c10646f001120467832dd52a54100020c10646f001120467832ed52254100040c10646f001120467832fd51a54000080c00646f0011204678330d51292d097b09634c00646f0011204678331d5095463000297b0c60546f00112046783328420400098064620008e58210ce84430006e46f0000458f7813cdd2fdd263a6f9884dd9e92003a6fa0bc468000045884013c80e180c084205c0000204620008e58210ce8443000364be02001842040009c064620008e58210ce8443000374be020014600011258000c8438701a0a4610040058108200a00d84414061180c40630004a98d3a6fa084dd9e3a6fa0bc443000b380e1810284204620008e58210d0880c046f0000458f7813cdd2f840014830004a831a9f5b6063a6fa084dd9e3a6f9cbceffc842080c04620008e58210d08443000e3467000045873813cdd27800684204620008e58210d24443000d5dd27b406c02c84204620008e58210d08443000e64600011a580001e4dd27800684204620008e58210d08443000e6dd27a071b4468400a851b641a831b6064650011a585281e4a0aab4259e91a8aad907a00b46f0000258f78bb8dd2fec043a6f9c84dd9e3a6f9cbceffc46f0011a0417807c80e0c118800146f0000258f78bb8dd2f441003e84213842444207fff984a46f0011a0407807c922f46f0000258f78ff0dd2fec043a6f9c84dd9e3a6faabceff446f0000258f7873cdd2f81204607ffff58000fff4610011a581081e441c4800015c0800480e1b4c1461001e0882946a0000458a5013cf181d54a800684204620008e58210d084430014e4be02801a032401480014e150034800684204620008e58210d24443000d54be02801b4068420400080064620008e58210d08443001524be02801800646f0008058f78cb4dd2fa436c00e9e01ac36f001a832a039a9b9b6e6a831b6c0a03a9c01a83ad505a075c103a034dd2115c38004d508a07c9a414e150003d502a83c8106b4c84680011a588401e44c647fb3b4a6d618a034842040048001921f4620008e58210d084430017246f0000458f7813cdd2fa0348a0946f0008058f78d48dd2fec0c3a6faa84dd9e3a6fa4bceffc4480ea6080e1469000045894813c84204620008e58210d084430010680c04be02401e307e81d460ea5f1580005a14003800684204620008e58210d084430010e4be024014003a037441f15a0960142700473ac36cf079e01ac3680e8d5038400ac364400ffff4003800684204620008e58210d084430011c4093bc0846f0000458f7813cdd2f509483e7440003e8409480174670011a587381e446f0000258f7873cdd2f40848000b4a7d706a03c400400014e04000c46f0011a1487807d800946f0008058f78d48dd2f14830002842080064620008e58210d24443000d546f0000458f7813cdd2fb426c90c46f0011a0407807aa9b9b6e6a831b6c0a03a9c01a83aec043a6fa484dd9e3a6f9cbceff44660010158630ad080e0500f800446f0000158f78c2cdd2fb446a031a0729a90400104064430008484204620008e58210d0846f0000458f7813cdd2fb446a072f0019e49401088029c4a944a9871a9c9b4269c49b62646f0000158f78c58dd2fec0c3a6f9c84dd9e92003a6f9cbceffc4660011a586301e484e0a03380274620008e58210d084430009cb6c6a9b1a9f246f0000458f7813cdd2fa03346f0008058f78fb8dd2fa9f3ec043a6f9c84dd9e92003a6f9cbceffc4660011a586301e4a1f38420a872b6c6a9b1cf1446f0000258f789b8dd2f80274620008e58210d084430005ca83346f0000458f7813cdd2fd507800746f0000258f78bb8dd2fec043a6f9c84dd9e3a6f98bceff8842080c04620008e58210d4040008006443000a946f0000458f7813cdd2f500f800446f0000158f78c2cdd2fa032c802d5099e01a832800646f0008158f78658dd2f80c0f00146f0000158f78c58dd2f8006ec083a6f9884dd9e3a6f9cbceff4844080c04430008e4001000680e180224620008e58210d4046f0000458f7813cdd2f500f800446f0000158f78c2cdd2fa07280069c49a872802746f0008158f78704dd2ff00146f0000158f78c58dd2fec0c3a6f9c84dd9e92003a6fa0bc4600011a580001f88440a88246f0008158f787b4dd2f4670011258738d044660011558630f444680008158840124a9f280264600011a580001f84be020015073864846500114585286248cd4dff14600011a580002088440a88246f0008158f787b4dd2f46700114587386244660011558630f944680008158840124a9f280264600011a580002084be02001507386484650011558528f448cd4dff13a6fa084dd9e92003a6f98bceff85cf00080e8064660011a58630218d50d4610011a581082285c000258502080104060801b4061001a840184204620008e58210d5c4430019b46f0000458f7813cdd2f500f800446f0000158f78c2cdd2fa032c802d5099e01a832800646f0008158f78658dd2f80c0f00146f0000158f78c58dd2f8006ec083a6f9884dd9e3a6f98bceff8842080c04620008e58210d5c400080064430015046f0000458f7813cdd2f500f800446f0000158f78c2cdd2fa032c802d5099e01a832800646f0008158f78658dd2f80c0f00146f0000158f78c58dd2f8006ec083a6f9884dd9e3a6fa0bceff8844080c0548080ff400100068022443001244620008e58210d5c46f0000458f7813cdd2fa032c022b446d51e0051001280e24c544019500f800446f0000158f78c2cdd2fa07280079e49a87246f0008158f78624dd2ff00146f0000158f78c58dd2fd505b4424c237fe384e08007ec083a6fa084dd9e3a6fa0bceff8844080c0548080ff400100068022443000fb4620008e58210d5c46f0000458f7813cdd2fa032c022b446d51e0051001b80e24c544019500f800446f0000158f78c2cdd2fa07280079e49a87246f0008158f78624dd2ff00146f0000158f78c58dd2fd505b4424c237fe384e08007ec083a6fa084dd9e3a6f9cbceff480e10010801a80c0e623e90e840080204620008e58210d5c443000de46f0000458f7813cdd2f8420443000e4400098064620008e58210d5c46f0000458f7813cdd2f500f800446f0000158f78c2cdd2fa07280069c49a872802746f0008158f7875cdd2ff00146f0000158f78c58dd2fec0c3a6f9c84dd9e92003a6f9cbceff480e10010801a80c0e623e90e840080204620008e58210d5c443000c146f0000458f7813cdd2f8420443000c7400098064620008e58210d5c46f0000458f7813cdd2f500f800446f0000158f78c2cdd2fa07280069c49a872802746f0008158f78704dd2ff00146f0000158f78c58dd2fec0c3a6f9c84dd9e92003a6fa4bceffc4600011a580002188520149000024670011558738fe446f0008158f787b4dd2f4660011758630fe44680008158840488a9f21093001a80264600011a580002184be02001507380804650011758528fe450630020dfee4610011a581082188440a88e500080104660010658630d6046f0008158f787b4dd2f46700118587387e485214680008158840488a9ba1093801a80274600011a580002284be020014600010c5063025858500b2050738020deee4610011a5810821884401420800a50008020466000905863020846f0008158f787b4dd2f4670011858738ce485224680008158840488a9ba1093801a80274600011a580002384be020014600009b5063064c58500ef050738020deeeec043a6fa484dd9e92003a6f98bc842080c04620008e58210d78400080064430007f46f0000458f7813cdd2fa031b426b620b406a1b1a9813a6f9884dd9e3a6fa0bc84e081008027400380064620008e58210d784430009146f0000458f7813cdd2fb4c84c64400480c7d507800646f0008158f78624dd2f80063a6fa084dd9e92003a6fa8bc84c080e08121810246a0000458a5013c4003000680264620008e58210d78443000494be028014003240680264620008e58210d784430004a4be028014003200680264620008e58210d784430004b4be0280114938001b707b6e9147400013a6fa884dd9e3a6fa4bceffc84c080e0810140030006469000045894813c80264620008e58210d784430006f4be02401400320068026443000704620008e58210d784be02401a0798008804746f0008158f7869cdd2fec043a6fa484dd9e3a6fa4bceffc84c080e0810140030006469000045894813c80264620008e58210d784430005e4be024014003200680264430005f4620008e58210d784be02401b4478008802746f0008158f7869cdd2fec043a6fa484dd9e3a6f98bc842080c04620008e58210d78400080064430002946f0000458f7813cdd2fa9b1b6c63a6f9884dd9e46000411580003b4b44046300a0040210c0446100400b640b4215410800fe624e90db44042215009b64046100411040080cb58000001140080cb46000119580000a4a701a682a640a6c3404220084021400840220804402104044031e0084610041140210c041420802846100411a6c5a6844001a008581080a440000804b60146200410b40142007c08b6014600041004110204580008184210c408141102048493b4604610041140319002b66046201010b4605821020258318004b660142080f3042080f4800158210001142080f4042000ed42215809142000ed8020042080c0464fff004021100258210100142080c0042000c180204021100258210100142000c1042080c24021100258210100142080c2043000c38020403190024624321058318100143000c3142080d5dd9e3a6faabcefdc46300119583180ec960039c1810144300fff504e0001972140320cb74660011a586305485073001401e30003549e000f40949008964800a3000246300119583181f0944d55ef001f3841820241ef04045421007f934740a51c0840a50804a6f1441fffb74022200941ce1009f5874650011958528230008380163852820215ef8003f5845454000f4052a404b6bfa77405ef80045852800114af8005f58640a26009405f200905ef800714af80015881800346a0011958a500ec39e50109409404029cc150807fc88400ae3baef5f003f30504af800640124009ae3310930001aef210a3000410830013ae7eaebd05ef80011053800911e38007b41f100380164400006411c38017ae3aaf3cf10410138008ec243a6faa84dd9e46f00112041782da84414001000c40000402842040008006dd9e9200dd9e92003a6f983c96009e018486424010244630011a58318248992396489690a76146300119583181a0c92838418800e682e8049d2138418808846642300c244640011a5842024898dca6dac30c46300119583181b038418800e686e8049d21384188084630040004418025463001195831816038418a0ad50ca7a2848038418808c60746300119583181b038418808846642000c244630011a583182489803a600e602e915c903e6a2e907842046000119580001c0d50a46000119580001c038100800e622e8049c49381008083a6f9804dd9e46100119581081c0960038008000842140008006dd9e920046100119581081a0960038108000e622e9038401d50a46100119581081b038008000842540008006dd9e92003a6f9cbceffc80e00000001200638013e602e92c800646f0008158f78b20dd2f4610011958108140c01384001003801d38009800c0038400d5504620041184613830980844100202141100f3d5463820980084a1da0b46200411463010105831820238009808143100f3800646f0008158f78b38dd2fc013460001125800011438101800c1049e49381018088421460001195800015038101808d51946200119582101503811180084a1d9114610040004308025461001195810816038109a029a595cf08033e90338011808460001125800011438001800ec043a6f9c84dd9e3a6faabcefe446300112960000518ba0f0839648840180e2f185d806840010018ba048000111f1034430005042308c244620011b5821058098da04418174cc0404518178c51ff0034430005042300c24852046200fff4610011b58108b488389149f8002149f800180c9149f80044081840058210ffe46a0011958a5010c8127d51e0421817ccae004418180ccdd464001195842010cb4a4cdd7a021c8d5a062c9d3a123ccd104318184cbce46f00119043780474e3200c8d5c780c0b46acb2b80e680c2800846f0008158f782b0dd2fb60ac01fa0c540148c01e269e818e2c1e91600300012c31384a18020d3100030001a4620011a5821021894dc981a46f0008158f78488dd2f8480b68ab4aac5db804680c7b40ac021f30184a19c599648f181d11da135a0c5e264e8179ae3e243e914f50346300112583180d0383196028869e283e80c9a5c40410406f10284614011901af182d5038006d50315cf800451ce000155ce00ff84a58d448d104dc2ffa6f401049f8004c4668460462001195821010c3831260aa0c200700012a699977c956b42210c0940211404ae9900500012426118094252840b956e40531404af598421f50150218014d913f50380894242f0734610011b581085805042005d95249921b484cc05a65142109409d52146f0011200478b97f1059f21e024e915f402cc13a65142109409ae51441fffa0af13ae528441a65958108003ae5946f0011210278ba0d50ea651848058108020ae51441fffa0af13ae52a65958108003ae5984a44c92c0090010001d9e491010001dd5028400ec1c3a6faa84dd9e92003a6fa8bc4680011b58840b9054a000ff84e0469000815894838cb408c02250047ff8802a4be0240180c0c01b0000001a84201013001c94044610011a581082189801802646f0008158f78488dd2f80068424844046f0008558f783d8dd2fd5089df997f84450001050840050dfd780073a6fa884dd9e92003a6faabcefdc460004115800079850107f808440f084f185f28246500119585280ac51cf801cf304f405b543b424968c4e2201604020a0099690f2839e9197d0e6f04ef2014640352009548180ff5064002497b04290940b5cf30020e81d50347f24466001128481048302f140420c0c403210054031a0028401143302f14c904035846038329d098462803c84428406103e0000d51e5064006a97b0e6d0e82c84814c92402346300119583180dc38019c00f58146f0008158f78e94dd2ff501846038329d09109e0000803c84428406f303103e0001f58146f0008458f78714dd2ff501480000f538329d019cd938329d09480000ee502400389690e650e84646400112584201244034100084210001ff384c90c00a8420544500ff38129d09c40a480000df38329d019cd938329d09480000d8e607e822463001195831813038419c00e68be90c9d01462001125821011438119c0838411c08480000ba9d2138419c08463001125831811438019c08480000af9ec184c0d57e461001125810811438009c08480000a450647fff96b24e25009f463001195831812038419c0046300119583180cc38419c08800880298047f58146f0008158f78a50dd2f8481f5014c924022844038229d098008f58146f0008158f78e94dd2f8426421304244620011a58210248998aa4b2540500ff802746f0008558f78320dd2f544500fff501c473d51d38229d0180089c9138229d098027f58146f0008558f782c4dd2f464001195842012038321c00f501c3089f1946000119580000cc38401c0850647fff8486424310244610011a581082489921a6e1cb1dd52b464001195842013038021c00e60be90684c09cd938621c08d5299d81464001195842013038621c08464001125842011438321c08d5219ed984c04640011958420130460001125800011438621c0838301c08d51250347fff8486423190244610011a5810824898d9a6d9462001125821011438311c08f302444000209c199600f0824c027ea6d5094e03ff4a48ffff4ba6f1e667e9b6d5dfec243a6faa84dd9e3a6fa0bc80e044000010810146f0008158f7822cdd2f80c0c031a082440000101203000c14810001b6e246f0011200178b9646258e08541080034010e4085821001040108804a8734600011b58000580802646f0008058f78490dd2fc80f0003001a4620011a5821021894048026980246f0008158f78488dd2f3a6fa084dd9e3bfffcbceffc96489600c115e608e8064610041c5810804ad5064610041c5810804b8e08a68884614001800c40000804ae08d527e608e8094610041c84415810804a4021000cd50a4610041c50207ff884615810804b4021880ca6c84021080540210c02ae8846100119581082ec3810800084a1d90646f0008258f78204dd2fec043bfffc84dd9e3a6faabcefdc96909648f281f182463004110431804754a000fff38346f0008158f78f0cdd2f05cf8001f002541e007f94055025000150357f9684e0f084f185f286f38715cf80008387f203800a541e00ff46f0008158f78c44dd2f81004e02013646f0011200378b9104740002cb4600340010cb43a73bf1045442001f40420404af3ba6fa0044001c54420002c40e46400119584200cc38422800926794df5442007f40319004d506f105926794df40318404aefaf201ca1100340012e662e90d46f0011200478b92a6fa5442007f926794df40319004aefaf101800846f0008158f78b64dd2fb61fa6fa5440007f926794df40319004aefa0044001b84c69f2142521824a73a4620011a582102485442007f996aaf290044001b4fc300099f2142321824848198daaf1ad50980649ed942319824800299188460aee2f106ae7d00340010cb060024001b10238013d54b84a1db3c84601034001d1033801346f00112049782f146f00112045782f284c084214000940c4000240298699db1c81b5032ffdc4660011258630bc8b6a61033801346700112b4a6049382f184419d294031140c4031a4045442001f143382f1b686d519443000205450801f4c61ffda46f00112145782f2d50e84a2db0cf10746300119583180dc101380130024001b3821a8080034001c423180091034001c0454000246600119586300ec3843290050528024a6ee5442000f95245431800f40319004aeee44700fff384329014600011b580005809284af2f8028384329019d2196e140419c773833290946f0008058f78558dd2fc00451ce0001d50f0034001a4620011a5821021894dc8028981a46f0008158f78488dd2f84408008842246f0008558f783d8dd2fb41f802a46f0008558f781ecdd2f001400120224000c800a46f0008558f784d4dd2f0034001b84869ed9423190244600011a580002480284000c98d8128180025cfe00204ef3fec505cf8000d50580fc05cf8000c7154470005042751c2484604610011b58108b4899f9466001195863010c46900081589484088103d534462001125821011439c128004640011258420124f10239c22808805c800a46f0008158f78910dd2f46100119581082700050801c4460002e585280011260800c1050801c4600011b5800058046f0008058f78558dd2f800a46f0008558f780ccdd2f8067d510b44680078022c2044be0240184611c83000146500119585281208cf0def2464001195842012039c22808cb08800a802346f0008258f78284dd2f4600011b5800058046f0008058f78728dd2fec243a6faa84dd9e3a6faabceffc8120800280e2838146f0008158f7822cdd2f5060000cc80b80474410037346f0008558f78160dd2f4800016b4084c009548407f046a0005a58a503844e820011b902a00280474be02801b726adf650137ff44600011b58000b384800014db90284488c104be02801b9028ee804037fff80478c284be02801a636b726adf65c000004467000045873813c80284620008e58210d8c4430038c4be01c01a63780285c0000104620008e58210d8c4430038d4be01c0100930006e724e804a7f7e6f0e9250003000e4620011a582102189404980250137ff446f0008158f78488dd2fa6b64630008558318160e644e9064400010144100394d506a6b744000100441003964be00c01480000fc800746f0008158f78a30dd2f84a14c02c0d084258049422384735011005d944c4620011b58210580984ab421e6314ef200c74670011258738b74b487461004119ca15c5100814031141b4030141a1043000fb667a6f6462001105821080038310d01042080478020981aa832804850037ff446f0008558f783d8dd2fb427840642008024a6b64610011a58108248980110207ffa84a2a634d80646f0011200078b93d508a63646100112581081103800800010030011a63684a1d860a63744100050421004244620011b58210580984a04108178c11c842542000424501105d89404980146f0008158f782b0dd2f8020c00e0000001a4620011a582102189404980246f0008158f78488dd2fa67744000050420080244620011b58210580984204108184c12b501106089801842146f0008158f78310dd2f8020c0200000001a84401020801c94044620011a58210218980246f0008158f78488dd2fa6b7a6364021400840210004441003bf4400020146f0008558f78160dd2fa6b7a6368425420104734620011b58210b48940450137ff4980246f0008158f78488dd2fa637842146f0008258f78284dd2fd524c807804744000200441003cdd5094023c0084021240444000201441003cf46f0008558f78160dd2f0003000e4620011a58210218940450137ff4980246f0008158f78488dd2fec043a6faa84dd9e3a6faabceffc97809648c20746000112580000d038201a0a845f46000119580001d084a13820190946300119583181f04620011258210b684600011958000230d921b4824010980c40109004b62246200082582103019872944bb4414640041138219a0a94735842080c984cb42138101a0a842000208013440002034410025cd54a8481b4224042180c40421005404204024480005084204283202438101a0a46000119580000ec38101909b6824600011b58000b4838119a0a8900812147c0008159ce02b046a0008158a504888008dd3c80e08020c00c0000001a4620011a58210218940498024be02801d5f18d21549480ff84a58d104c92ffeb800646f0008558f78544dd2f00238013440002024410027046f0008558f78160dd2fec043a6faa84dd9e92003a6faabcefe446f00112043782da960096484e3200f184a146300119583181d0d906842038118109480000e646000119580000ac46100112581080d0f381f082f1838540508f801447c0000159ce0c584690011258948b7046f00112041782da84614071a80c401384024e1200aaf4014450ffffa4604c1280a4800846f0000158f78c2cdd2ff201f005a4509c49ac50dd3c46300119583182ec40150c00f401a788a420ce39f10344200fa0b4814022089746f00112044782d742211024e240e815800846f0000158f78c2cdd2fb449800a4033880480268046b66946f0008258f789ccdd2ff005dd3cf302a45846f00112042782d9e241e808800846f0000158f78c2cdd2fd541800846f0000158f78c2cdd2fd549464001125842013446300112583181444025100040150c00a708a6508040421204244400001942108024e022e815800846f0000158f78c2cdd2fb449842040338804800a8041b66946f0008258f789ccdd2ff005dd3cf202a45046f00112042782d9e241e810800846f0000158f78c2cdd2fb429442100004021280cf00540110404d511800846f0000158f78c2cdd2f441100004010a80cb44940108405f00540108802b629dd3cf201f302f4039c929cda9d248d4144500010f281f382f4834ca2ff4146f00112041782dc46000112045002dbd105141002db8401d5028400ec1c3a6faa84dd9e92003a6faabcefcc4680005a5884038480c18444802046000119580000a4dd2880268442506f801c46000119580000a8dd284690005a589483c446f0008158f787e0dd2f8420442000148006dd2900a30003a573a73401c300020033001254a5001f92ae4052b80858a50040544200035852801a926494dc41ce1c0941ce1c085842001c10a300038540ad73507f8004af341033001211c3000210a300058420442000188007dd29a738a6f9440fffc85442000358318002404200044231940984468420500f8008af38aef9dd2946100119581080a48446500f800edd2846100119581080a48446500f8014dd2884204420002e4600011a58000548dd298026442000144600011a58000548dd288027442000184600011a5800055cdd28ec343a6faa84dd9e3a6f983ca6c88440a7429d11db10a783a749de0da784a74ade0aa785a74bde07a786a74cde04a787a74dd60696a0848a8c094c227feb80023a6f9804dd9e92003a6faabcefe497c88120c7664620041146000119580000a48540443000ff08100001044100474011841a40420437894146500119585280aad8f381078485506f801047c0005a59ce0384d51140151c778029f4828f01548400ff42119073f181dd3cf00180268445dd3cf40284458006e702e8ed9ff997f885008062506f801046a0005a58a50384d519005e0000e6afe813f3819ff94be02801f1038445801c4be02801f0038026844597f84be02801f301cf04d511548200ff8009838942038c7343c40c73f0838445800650440001803ce307e9dbec1c3a6faa84dd9e92003a6fa8bc80a080c28141501000308002844680e381045092802046f0005a58f78384dd2fa63044500062d80ca6318ebdd809a632445000b0540000f0d8038400d5028401ae3884001004000084a05004801844200018d5155ef1817ee818a640443000dd4c11c008a678c9050010000c10140000a6c19cda996b980397689893a6c19c5a984a98ebe341e8e784013a6fa884dd9e3a6faabc51fffc14507f82a0f0874660005a586303c48420442000a0508f82008007dd26509f81608420442000a08008dd2650af80c08420442000a08009dd2651cf80208420442000a0800add26801c8420442000a0dd268400f086f083f084f085812044a00046878580c080e08100d578f00344100023f3074220042442302873f4079c91a65a989298a2a61c0051800aa71901e18005a696f182a6dbc8154fe30014e665e811c410502f82a04224f0738d21aed2af1011e10004ae5111e10003549480ffd549cd02c213e665e811c410502f8200422470738d01aed2af10ae1311e10004548400fff302aed1d535e604e812e674e810c430502f81604223f0739df9aed2af10ae1311e1000497f8f402af11d522e679e810c41f502f80c0422370739db1aed2af10ae1311e1000497b0f502af51d511c410f106502f80204220f0739d49aed2af10ae1311e100049768f302aed1f586f4039c219600f083f507f003a6a8e202e985f784842044200032507f82a04600011a58000e3cf683148f800584c046f0005a58f783c4dd2f8007802946f0008258f78e58dd2f4680005a58840384f6828146d50d383398009db5c31284aa4ca280108d414be0200154a500ff4640011a58420e3c9834987e8445e349e9ecf105500f8200506f8340508f820414af800246f0008258f78e58dd2f442000328006842046f0005a58f783c4dd2f854580a84254a87380e88088852047c0005a59ce03848105d50aa6f89dfdcb07b69f8d21dd3cb49f549480ff80064204a8739e7c84454c747ff251cf8340810480fc809c84c083888062810746a0005a58a50384f702d50cf381b69f9db14be028019c39b49ff30197c097b08d0542238c244650011a58528e3c981580288445e2c9e803e6eae9e9506f83404420003280068420811cf782838446f0005a58f783c4dd2ff0058445814842a00873846015cf80058122838a4670005a587383848143d50b004400008d05c4074be01c015035000154a180ff80064205247350147ffc84454c8e7ff08400509f83e0806a10048004b609840181408383d533a771a739e285e81646f0005a58f78384dd2f80278445800646f0005a58f78384dd2f80078029844546f0005a58f78384dd2f8d01548400ff8445506f83404264087350040001507f83404270087380098026e10ae9d6815c5005000105cf800754a000ffe35ce910807c05cf800584c080fc809c85254680005a58840384838304af8002d513403e280115cf80078500838a8143d5d2b69f8d414be020019db1b49f54a500ff97b09dfd420524244620011a58210e3c980280278445e2dce803e74ae9eaf104506f8340500f8160838414af800246f0008258f78e58dd2f800644200032842046f0005a58f783c4dd2f508f8164f404844580684232087380a6f38480c280e8852046a0005a58a50384d50ba6f89dfdcb08f5818d214be02801f501549480fff3048005420498739e7c84454c71fff080fc809c84c083888062810746a0005a58a50384f702d50cf381b69f9db14be028019c39b49ff30197c097b08d0542038c244650011a58528e3c802898058445e2c9e803e6eae9e9506f83408006842044200032f782811c838446f0005a58f783c4dd2f84a085254670005a587383848145d50e003400008d059ed996d8e663e8074be01c015055000154a280fff30480064205247350147ffc84454c81ffec80aa840115cf8004509f83e081408385d533a731a6f9e264e81646f0005a58f78384dd2f80278445800646f0005a58f78384dd2f80078029844546f0005a58f78384dd2f8d01548400ff8445506f83404264087350040001507f83404270087380098026e10ae9d6815c5005000105cf800554a000ffe35ce91080bc05cf800484c080fc807c85254680005a58840384838504af8002d513405e280115cf80058500838a8145d5d2f3818d414be020019db1f30154a500ff97b09dfd420524244650011a58528e3c802798058445e2dce803e74ae9ea506f80c0f103507f83408006838314af800246f0008258f78e58dd2f800744200032842046f0005a58f783c4dd2ff0038445814680a742a0087380e285004690005a58948384d50ba6f09db5c308f5818d014be02401f501548400ff800542041c73802684454c657ff184a1509f83e0814515cf8004d530a734a6fce264e81646f0005a58f78384dd2f80278445800646f0005a58f78384dd2f80078029844546f0005a58f78384dd2f8d01548400ff8445506f83404264087350040001507f83404270087380098026e11ce9d65055000154a280fff203e342e90c05cf800484c085054670005a58738384049f8002d518f303850041c1a801d5db003e0000c31c003e000451ce0005e664e816e72ae8148d219db14be01c01549480ff97b04204a024f5034640011a58420e3c803c98048445e2c5e9e3506f8020f1068006149f800284e046f0008258f78e58dd2f85254680005a5884038404af8002d50da6f09db5c316e74ae8148d419df94be0200154a500ff97f842052424f3064620011a58210e3c980280268445e2e3e9e914af800246f0011210a78b9551ff83ec3a6faa84dd9e3a6faabceffc80c280e0548080ff800284204420004646f0005a58f783c4dd2fa639ae304e820004108300028420878950a3000a850384a150930028d55080074200f0738481003000082020000a000000094c32401f5ef17fbae81700330009800998dc103300098460a7009c03c4069cd987ca4c3f7ffbd50880064201a0731020002a10500028a6339c01ae33d525cb245ef17fbae81b5cf00032e818a7379d21af37808a01e200009d234fe200079cd987ca4c3f7ff9d50a80864241a0731022000c1002000b1052000aa6f1a6b498039c91ae31aeb49c499648a638e220e9afec043a6faa84dd9e92003a6faabcefd404a0000280a046f00112040782df51cf801884c081018421b6dc126e0002509500044c00c0bc4630011b5831858000000000";
+// Requests that can wait for a response at once
+#define ONE_TRANSACTIONS            16
+// Milliseconds to wait for each response
+#define ONE_TRANSACTION_TIMEOUT     100
+// Controllers that can be pairing at the same time
+#define ONE_PAIRINGS                WIRELESS_CONNECTIONS
 
-constexpr static const char firmware2[] = "0038001000018ac8c84b8008f381f58246f0008158f7822cdd2f80e046f0011200078bb5a07a8048b6018d04f502a03aa06a408400139c0446f0005a58f78384dd2f1283800c46f0011200078b9646158c1054843fff54000003400064084084040440840004148380038027f00146f0008058f78490dd2f80c04e0301880003801a4620011a5821021894048027980246f0008158f78488dd2f4800017900148003000480025410803f4010a00840108004805c503f8027504f8026800a46f0008258f78f38dd2f46f0011200378bb546700119587382908d4c3aa52800aef9003f80264620008258210e18508f8010b6c812640002f383f282803c8007009f8027dd22842a40a50010f2024c00800f842942000424f2039807102000091090000810a0000a4800013380288007dd22e60a4ef2012c85094280202446300119583182908903803c50040002844646f0005a58f78384dd2ff003109400081004000910a4000aa6389c01ae384800011050750020a63884285400000c4c00c013000480009e01ae10000480079205ae18000480065400007fae20006380104263040ba6385410000cc10d84484c11409d541000f0443000c04c11809794934c11009455c000f04fc3003f46f0011c00078048c03946000119580000a4a680001380104c20c031a681001380114c20c02ca642000380124c10402746f0010e04078099c0214600011b5800056846f0008058f78cb4dd2f5003800a46f0008458f78a4cdd2f800a46f0008458f78978dd2f8403842146f0005658f78fa4dd2f80dc480000a646a0011b58a5058000050ac84e03009d8008f58246f0008158f7822cdd2f80e0f502c80b80484410039f46f0008558f78160dd2f4800008aa06aa00280484084001346f0005a58f78384dd2f1283800c46f0011200078b9646358c0054843fff540000034000640840840c044084000414838003800a802746f0008058f78490dd2fc8110003801a4620011a5821021894048027980246f0008158f78488dd2fd50284e000a480008f4154a500ff800a46f0008158f78a30dd2f8380c8384680011258840b708521b4084014a80c40008002c021c620500f8020f18246f0000158f78c2cdd2ff102b4684010840540308c02b668800a805c802946f0008258f789ccdd2ff00880c946f0000158f78c58dd2fd51b0023801344000200441003c746f0008558f78160dd2fd50e46f0011200078b98c00a4600011200100ba19c4910100ba1d50284c08006ec2c3a6faa84dd9e92009649e624e8038421d53db42084454c110022e626e80684a1d10984a2d932d51284a7d11f84a8d92dd5239c04b4204600011258000b969648ae40e622e9228420d51f9c04b4204600011258000b91964cd5179c04b4204600011258000b9dd51046f00112042782e38420b640d50b9c04b4204600011258000b9254108007ae4084208001dd9e9200b44084014c200014c20484a2da38d520461004005810828cb401b6414643232fb4615000ffe458420fffd520460004008420042000a3141000a34600040058000270b440b620b4204210dc08d517461004005810828c8440b401b64146400fffb4615000ffe458420fff40319004b661b420b640b4204210dc08b6208400dd9e9649542080039222ca0fb46054218003ca0b8441d504b4809c91ab199c04e241e9fb8400d5028401dd9e92003a6f9c3c9689842c403104379242c91bd516a2c3546180039c4b50407ff89f444031a0089268ce0fb4c3b484b4a5404210054042180240421404b683e222e9ea8400d50284013a6f9c04dd9e3a6f983c9649542080079222ca11d50ca2c2545180039c929f044031a0089268cd07b484b683e241e9f48400d50284013a6f9804dd9e92003a6f983c9649542080079222ca11d50ca2c2545180039c929f044031a0089268cd07b463b664e241e9f48400d50284013a6f9804dd9e92003a6f983ca4885cf10648e8188080a2a154310003b4a4cb125cf28040e80fd504a3918064b6c04021200892489c049d19dbf89522ad088400d50284013a6f9804dd9e920046000411a0415810800ca841dd9e92003bfffcbceffc0210000ce624e8038401d514a0028442b4a0d202d50e46f00112042782f54610011a58108f2046f0005a58f78384dd2f840bec043bfffc84dd9e3a6f9cbceffc8020a2898461b4214c21c02096c84620011b5821058054418002922810410ac910310ac810110acb8c084610011a58108e3c082000014650011a58528e6e18208005d9f84800009584034c20409296484670011b5873858010138ace460004105800080cb4404221600942216409c9074610300040210404b640d57a42216008b6404600041158000018b420922c4010b008b62084c0b46080265831861cb660846010338acd46f00112146782f5442006484600011a58000f2046f0005a58f783c4dd2f46f0008458f78884dd2f46f00112146782e246f00112146782df46f00112146782e000038acb46f00112146782f68026804646f0008a58f78750dd2f00038acbe60fe808800646f0008b58f78584dd2fd50d4610008b581085845cf00064e8038401d50284024be004014600011b580005684660008058630ea884204be0180146f0011c00078049c8114600011a58000e70441493e04be018014600011a58000e8844149f984be018018400ec043a6f9c84dd9e92003a6fa4bceffc46000411a04184534010880280e0a84184c046800002588407500493808084014be02001540480039db1c004445003e8def5ec043a6fa484dd9e3a6faabcefb484a046f0011210578b9846400411046200d480a458630400146200d404728107448f1fff4640041146610000584203404073a0025863003f14728107b6c480e3b464b46497804201d009b60455c080ff54a100ff46f0008358f78fd8dd2f4640041258420010b42458108003b6248006b424549380ff9222944ab6244083f00946f0008a58f78d38dd2f800646f0008a58f78fc4dd2f4003c0099600c00a4003a0099602802946f0008b58f785a4dd2f803c804a800646f0008a58f78750dd2f840046f0008b58f782e4dd2f80068029804846f0008b58f784a8dd2f46f0008358f78fd8dd2f800646f0008e58f7850cdd2f84a14c82c034e6cfe91892f85473800fcf0646f0008e58f784e8dd2f840146f0008e58f7844cdd2f840146f0008e58f78480dd2f8401d50e840046f0008e58f7844cdd2f840046f0008e58f78480dd2f840046f0008e58f784b4dd2f800646f0008b58f785fcdd2fd507800646f0008b58f7882cdd2f506f800446f0008358f78e08dd2f800646f0008b58f7828cdd2f46f0011200078bb785024c044008800646f0008b58f78530dd2f46f0011200078bb746f0008b58f782e4dd2f842146f0011210178b98ec4c3a6faa84dd9e92003a6f98bcb42084a54c128090e626e81084a2d153e623e806c11f84a14c12c140d52584a3d16884a44c12c13ad56c84a84c128107e629e80884a6d17f84a74c12c12f4800008384a94c12811984aa4c12c1274800011e501000089c0446f0008258f78cf4dd2f4800011b502000089c04b4c0b44297b046300082583189ccc2038006d504800644201f404be00c014600011258000b708421b4404010980c4010840540108802846046200119582100ac38311909480000f39c44b4c15030000897b08006842044201f40b46346f0008258f789ccdd2f4610011284014060180c040082dc4063180540630002146082dc480000d69c04b4204600011258000b97480000c59c04b44046100112581081109258ae88b4409250ae89b4409248ae8ab400ae0b480000bc9c04b4204600011258000b5c480000b39c04b4204600011258000b60480000ab46f00112041782da4e1300a650100008b44146f00112142782f35010000cb44146100112142082f45cf10021e90544200020142082f446f00112043782f44620011a58210ea08420d505b4a53851060a96609d4c956a99459d09e223e9f746f0011c00178048846046f0011210378ba2c90f461004105810880cb4414221600942216409b641b44142216008b6414610041158108128b441925040214008b64146400411b4415821001eb641463004100412004b581080011412004b445fff1f044181018043404214021441810104310105802214310105042081064432008040210c04142081069c04b4204600011258000b7cd52f9c04b420b46092385410800f4231c00b46200119582102ec383104084620011258210134b460926838310408b440460001125800014438200408d5129c04b4204600011258000b935410800fae40d5089c04b4204600011258000b64b62084003a6f9884dd9e3a6fa0bceff846200112043102de80c19c59141102de8440a1f381004013d009f2815410807f8444840b122f80024c100071e42ce8154c110046e425e80a84a24c1280c5e423e83484a1d925480000a284a9d14ce42ae85484a8d91dd53d445000154c128084e436e8089d45d1179d6cd16b84acd910d55f9d6c4c1280b1e43ae8049f69d908d5699d6d4c1280979d694c12808b8400480000b6a0320213000c46f0008358f78c5cdd2f480000aca0320213000c46f0008458f781e0dd2f480000a2a0320213000c46f0008758f787c4dd2f48000098a0320213000c46f0008358f78cdcdd2f4800008ea0320213000c46f0008358f78d08dd2f48000084a0320213000c46f0008358f78d8cdd2fd56fa0325013001846f0008358f78dc4dd2f0213000c022f8002924e402138085410bfffd564a0320213000c46f0008358f78d54dd2fd55fa0320213000c46f0008558f78e0cdd2fd556a0320213000c46f0008358f78e58dd2fd54d4023c0095421000f803f800646f0008358f78e18dd2f46f00112042782f59c9454213fffd531a0320213000c502f800446f0008358f78bd4dd2fd52fa0320213000c46f0008e58f78264dd2fd526a0320213000c46f0008c58f78000dd2fd512a0320213000c46f0008b58f78df4dd2fd514a0320213000c46f0008558f78740dd2f5423bfff021f8002922e4010b80840108804121f8002461004000430808c92f04231fc085473800f1430808ccf038007d536001f800594045410807f101f800546f0011200278b96021f800254210003989240738004582100585430bfff107f8006102f8007e468e808922e4010b80858108008121f8002020f8002f10154003fffa8731203000c8026800846f0008058f78490dd2f842040008006ec083a6fa084dd9e3a6fa4bceffc81009c1480e2812146f0008158f7822cdd2f80c0c8038401d54446f0011200178b965c3386494400064840238c1b40200c1a5484000f5400800346158000408450089dd440006408408404045473bfff40840004a03240841c04802946f0005a58f78384dd2f1273000c148300034600011b58000580802646f0008058f78490dd2f80e0c0038400d50c4600011a58000208802646f0008158f78488dd2f8007ec043a6fa484dd9e92008423420004248420d5088440920084679c914c21fffd9c49e220e9f8dd9e92003a6fa4bceffc46700410842184c046900084589487c40483828c9db1548400ff440000144e82000a4be024014400006484204c607ff2d52fc12e46600410842146900084589487c40473010e8d0144000032c7094be02401440001f484204c807ff5d519c11846600411842146800084588407c4042300809df9969444000032c2084be020014400006484204c707ff48001d5028400ec043a6fa484dd9e92004600041158000004b4205810800cb620b400dd9e3a6f9c3c4610011a58108e3ca608c01b8400a6889c4dc2114670041c46f0011c0067804b587380439d4199074c6100069628aea0e603e8074620011a58210e6e4c117fe93a6f9c04dd9e92003a6f9cbceffc4670005a587383c4842084454600011c580000484be01c014660008058630c804600011b580005684610008458108eac84404be018014600011a58000e704610008458108c9084404be018014600011a58000e884610008458108b1884404be01801848046f0011c1047804846f0011c1047804d8420442006484600011a58000f204be01c01ec043a6f9c84dd9e3a6fa0bc842080c0442006484600011a58000f2046f0005a58f783c4dd2f9c34a683a6025421003f402120084021000446f00112142782f550730020a63154100040c12ba6f84410001a9264543180089e8a5400001040610c1a40608c1bc0029db4802780464680005a588403844600011a58000f204be0200146f00112042782f59c724630011a58318f2098799a9698334be02001d50b80274600011a58000f2046f0005a58f78384dd2f46100112040082f59c81142082f546f0011c0027804b4610011a58108f20382080083a6fa084dd9e3a6fa0bca6c3a64280c04031e008a600a6b14010c008401184044010800440212008460004114010880414100202a675a6b44010a008401088041410020344201f408400842146f0008258f789ccdd2f4600041d802684464660005a58630384580004184be018014600041d46100119581080a484465800041e4be018014600041d46100119581080a45800042484464be018014600041058000410b420810058108100b62084c04670000258738750b4289db1541081008401c1064be01c014450015edef63a6fa084dd9e3a6fa0bceff846f0011200178b99844146000112142002e14e1300ac141002e14660041146f0008558f78f9cdd2f440006400413005046f0000258f78750dd2f04630050c60a44000064426300244400c8004063001797b04610011b5810858000208acc840942210024840a40210076400300779802960010008acce61fe95c4600011a58000e3ca680c256846010308acc00308acba6409c05c10646f0011c1017804bd5064650011a58528e6ed8f446f0011c0057804bdb0546f0011c1027804b46f0011c0007804be60fe8038460d5095c400064842284414031101b4030901a8421844046f0008458f78018dd2f4670005a587383844610011a58108e3c8445801f4be01c014600011a58000e3c9c454420002d4be01c01803f84454600011a58000e69811f4be01c0146f0008458f78898dd2f4600041c58000049af804414b7084600011a58000e884660008058630ea84be01801846046f00112143782f64600011b5800056884214be01801ec083a6fa084dd9e3a6f98bcef7046f0011200478b99463001128441142182e0cc3646f00112040782f446f0011c0067804b9542144182e04610011a58108ea08467b67ff281f682f08398e9502f8010d503a309ab114c11fffe9c0494424400fffc40108002801f46f0008458f781e0dd2f461000db58108ba04600011a58000e7046f0008058f78ea8dd2fec903a6f9884dd9e3a6faabceff446f0008458f787e4dd2f84a1d80746000411a04142108809a84146000411a0c180204620009242318c0958210b00a8c1810046700412142080d184c0469000025894875005c40080840199b004a3804c4be02401540e0001c8034ea200054450012cdef144200030500f80048424f28146f0008558f78e0cdd2fec0c3a6faa84dd9e3a6f9cbceffc46f0011200178ba3840046f0000358f78120dd2f46f0008558f78b88dd2f46f0011c0017804dc91b46f0011c0007804b5cf00064e80d46f00112040782e0c808842146f0008558f78ce4dd2fd5124660008558630ce484008421d507840084214660008558630ce4dd2684018020dd2646f001000427805184218403dd22842046f0011210178b9946f0008b58f789fcdd2f840246f0000258f78750dd2f46f0011c0007804be60fe8038460d5095c400064842284414031101b4030901a8440842146f0008458f78018dd2f4660041080264600600084e01470814314030141840546f0000258f78750dd2f46000411842c14730141a841ec043a6f9c84dd9e92003a6fa0bc46f0011c0057804d84214c5080da46f00112045782e2d96e840046f0008458f78da4dd2f46000411042000834221000914200083461004000420804c42214c091420804c0410004580e04210d0081410004584c04680000258840750041381c39db1840ac9064be02001445000a0def7842046f00112141782e246f00112040782e0c82246f00112040782e1c82846f0011c0007804b5cf00064e808460004005800042044100492d5074600040058000420441003b2b62046000400441000a81410010ad57d46100410042081054600011a58000e7014208105d5054600011a58000e88842146f0008058f78ea8dd2fd56746000411041000d04210d009141000d046f00112046782f6ce2346000411461004115800070cb44004208045810042215008142080454670000258738750b4289db1840ac9064be01c0144500014def846000112041002f69c49141002f6460004000420004c4610041142214c081420004c04208083460004105821000114208083042001051420010504608049840046f0008458f78d1cdd2f95b6842146f00112141782e24620008058210ea85cf31dede90750636214440003e8401300d74600011b580005684be008013a6fa084dd9e84a1d00ac00684a2d00c84a3d824d50e46000420d50f4600042058000010d50a4600042058000020d5054600042058000030a082e241e802a842a083e222e802a843b420a0819c4942208824b62040110457a841dd9e92004610042096005020001038308a02500002309cd938308a0a382082025021002e3820820add9e92004620042096005030024038410e0250000290986138110e0a381102029c493811020add9e96489600e630e82084a1d80646000420501081b0d514c80646000420501081c0d50e84a2d80646000420501081d0d50784a3d80a46000420501081e0382006029c913820060add9e3a6faabceffc4640011204a202f746300411960105c18047507500014030400896499db94011840446300425583188009d7140a5080895fa50928001894399fb95b2956a45e0ff0015c5000099b3b627996b549481ff84604080780244100200b666b665149202f74c80c00e960084a1d80a401140099610964846f0008558f78118dd2fec043a6faa84dd9e96009648c8064600042050108130d53184a1d8064600042050108140d52a84a2d8064600042050108150d52384a3d8064600042050108160d51c84a4d8064600042050108170d51584a5d8064600042050108180d50e84a6d8064600042050108190d50784a7d80a46000420501081a0382006029c913820060add9e960084469e01420008244620011a582102489802a600844196484c0140074600042050108060d514c8064600042050108070d50e84a2d8064600042050108080d50784a3d80a4600042050108090382006029c913820060add9e9200960084469e01420008244620011a582102489802a600844196484c0140074600042050108020d514c8064600042050108030d50e84a2d8064600042050108040d50784a3d80a4600042050108050382006029c913820060add9e920084619600964896914c01c00b46000420503080a038400e02501082a0d51684a2d80a46000420503080b038400e02501082b0d50be603e91146000420503080c038400e02501082c09d2138400e0a3830060298933820060add9e9200960084469e01420008244620011a582102489802a600844196484c01400746000420501080f0d514c8064600042050108100d50e84a2d8064600042050108110d50784a3d80a4600042050108120382006029c913820060add9e92003a6f98bc5060001400237fff0000001b00337ffe40404008402120084022080440210c04463004239406583187c09803b640964884a2d11ee623e80484a1d95cd50684a3d12184a4d957d52fa6b74600041104100047941680439802a8418420a637b46694069802a8c2a63794069802d509a6b74600041104100047941680439802a843d539a6f74600041104200047941e46300423583187c09803a883a63794069803a844d528a63780439446984aa0caa08be262e90846100fff9a9a58108fffe222e80800137fff46f0008558f7837cdd2fa6b746300423583187c094969893a0d3a05100037ffe9a5946f0008558f78074dd2f3a6f9884dd9e84619648960096914c11c00b46100420503001f038408e0250000250d520c90a461004205030020038408e0250000260d51684a2d90a461004205030021038408e0250000270d50b84a3d911461004205030022038408e0250000280989438208e0a382082029c913820820add9e92003a6faabcef74960050300060f38150300070f38250300080f38350300090f384503000a0f385503000b0f386503000c0f387503000d0f388503000e0f389503000f0f38a50300100f38b50300110f38c50300120f38d50300130f38e50300140f38f50300150f39050300160f39150300170f39250300180f39350300190f394503001a0f395503001b0f396503001c0f397503001d0f398503001e0f399503001f0f39a50300200f39b50300210f39c50300220f39d50300230502002c0f39e4610042050300240f2a1504000108440506000205080003050a0004051e00050f39f50300250f3a03820920a38209a0a3820a20a3820aa0a3820fa0a51c00260f401509002703820920a50700280f402505002903820920a503002a0f403500002b03820920af4043820920af4053820920af4063820920af4073820920af4083820920af4093820920af40a3820920af40b3820920af40c3820920af40d3820920af40e3820920af40f3820920af4103820920af4113820920af4123820920af4133820920af4143820920af4153820920af4163820920af4173820920af4183820920af4193820920af41a3820920af41b3820920af41c3820920af41d3820920af41e3820920af41f3820920af4203820920a3820f20a3820a60a38209e0a3820960a38208e0a3820820af0213820820aec8c3a6faa84dd9e92003a6faabcefe49649502000785cf084004ef301518080a2e1b42497d896484e730137e6304ef20147b62046300420505080103851960250608100b6a4504080203841920250508110a902504080303841920250808200a903504080403841920251e08250a904504080503841920251c08260a905504080603841920250a08270a9065040807038419202a907504080803841920214400008504080903841920214400009504080a0384192021440000a504080b0384192021440000b504080c0384192021440000c504080d0384192021440000d504080e0384192021440000e504080f0384192021440000f5040812038619a0214600010506081f03851960214500011384192025050829014400012504081303841920214400013504081403841920214400014504081503841920214400015504081603841920214400016504081703841920214400017504081803841920214400018504081903841920214400019504081a0384192021440001a504081b0384192021440001b504081c0384192021440001c504081d0384192021440001d504081e0384192021440001e504082a038019a02a811500082103891a20214910002f0825090822050008230149f8003f084049f80023891a60214910003f00338018202a81450008240049f80043891a60214910005f08538918202149100063801fa02a8173891f20214910008509082803801aa0214010009149f80013801a6021401000a389196021491000b380192021401000c500082b038918202501082c01491000d389186021491000e38719a0a3871a20af20238718a0a049f80033871a60af20438718a0a049f80053871a60a3871fa0a3871f20a3871aa0af20138718a0a3871960a3871920a3871820a3871860a8007d51584a1d702d50f46200425582108004010a008984a4420040046f0005a58f78384dd2f8400d5028401ec1c3a6faa84dd9e3a6f98bc460004254660005a586303c4842044202000580008004be0180146000423842044202000580008004be01801460004208420442038004be018013a6f9884dd9e3a6faabceff44670008058738334440000104610008058108a9cdd27440000114610008058108964dd2784004610008058108830dd2784c084014610008058108a68dd27810646f0008158f78184dd2f878546f0008158f78508dd2f46a0008158a507b4d516983994044620011b582105801c848004500005c89802f1819df94be0280184a5f101dfef9db18cabd61044000050429300244620011b58210580509485d084e0892242137024d5dd4600011b5800058046f0008058f78394dd2f460004105800080046f0011b148782cd1480000446203000a04340108804a84346f0008458f788e4dd2fec0c3a6faa84dd9e92008423420004248420d5088440920084679c914c21fffd9c49e220e9f8dd9e9200461004000420805342214c0942215009142080534600040058000130b420442cffff40108802b620b42058108001b620dd9e92003a6fa0bc4600040058000148b420810058108001b62084c04670008558738b34b408401030094220700b9db154108003840ac20384a3d1064be01c0144500064def04660040058630148b406461ff80f58108fff40000402b6064670008558738b3484014be01c01b426462f0fff58210fff40108802b62684014be01c01b4064630f00040000c04b606b40646200401920c40003008b6060431008142318c0914310081461004000420802080015821000114208020041000194210c809141000193a6fa084dd9e3a6f9cbceffc4660040058630130b4064411000140000404b606467000585873811c440000644be01c01460004005800001cb440924840212008b64046100400b44058210030b6404400484fa80d84014be01c01b406467000585873812842004408b60684054be01c01b4264210c009b62684024be01c0146000400041000534630018040108c0414100053ec043a6f9c84dd9e3a6f9cbceffc96009648c83d84014670008558738b344c1040174660040058630130b426840a58108001b6264be01c01b426840a5810803ab6264be01c01b406843bd53c4660040058630130b426840558108004b6264be01c01460004100410014c9224944c1410014c46f0008558f78b54dd2fb406441fffc558000001b606b406d54c84a14670008558738b34d9274660040058630130b426840a58108100b6264be01c01b426840a5810ba00b6264be01c01b406441ffbff40000402b60646f0008558f78c50dd2f460004100410014c5810800f1410014cd5234660040058630130b426840558108400b6264be01c01460004100410014c9224944c1410014c46f0008558f78b54dd2fb406441fc5ff58000100b606b40640000402b606ec043a6f9c84dd9e3a6fa0bc9649e624e804840148000092b400441000304c00c06146f001000427805184208403dd22840080204660008558630ce44be01801840184204be018014600040058000148b420462ff80f463005f0401088025831800240108c04b620810084c04670008558738b34b4089db1401030094020700954108003840aca02c1064be01c0144500064def14600040004200052924c402130081420005280200420802042210009142080200410001984614210c8081410001946f0011200178ba346f0011210378b99840046f0000358f78184dd2fd52c44500031d002d52846f0011200178ba3840046f0000358f78120dd2f4660008558630ce446f0008558f78b88dd2f840084214be01801840180204be0180146f001000427805184218403dd22842046f0011210178b9984003a6fa084dd9e9200460004000410009714100097dd9e92003a6fa0bc4610041d58108235ae084600041058000410b420810058108008b62084c04670000258738750b4289db1541080088401c1064be01c014450015edef63a6fa084dd9e92003a6fa0bc4600041058000410b420810058108004b62084c04670000258738750b4289db1541080048401c1064be01c014450015edef63a6fa084dd9e3a6fa0bc4670011258738bd0b407850c4200202446f0008158f7822cdd2f80c0c041b447a002422120244610011c581080501223000cb4474221202446f0005a58f78384dd2fb40746158a084280202446f0011200078b9654843ffc54000003400064084084040440840004148300034600011b58000580802646f0008058f78490dd2fc80f0003001a4620011a5821021894048026980246f0008158f78488dd2f3a6fa084dd9e3a6f98bc844146f0011c1027804d4660008058630cb44600011b580005684be018014600011a58000e884be018014600011a58000e704be0180146f0010e001782c9840046f0000358f78120dd2f3a6f9884dd9e3a6f9cbceffc84214660008058630cb44600011a58000e8846f0011c1017804d4be018014600011a58000e704be018014600011b580005684be0180146f0011200078b99c80846f0011c0007804b5cf00064e807840046f0008458f78da4dd2f46000411042000834221000914200083461004000420804c42214c091420804c041000d04210d008141000d0ec043a6f9c84dd9e3a6f9cbceff44400003a501f8007844146f0005158f780f0dd2f000f800796424e15001646400400461000a0806480439f4158108a3f97681412004114118042141100435cf280fee853d52346100400041080194210f40b9fc1c12646500400466000808065464000908043461000a15863000f58420a1e58108e7f97f81462804114418042141100435cf380fee8305410007f460000b84010a0085800007f40108004d52546500400466000808065464000908043461000a15863001e58420a3c58108e7f97f81462804114418042141100435cf380fee80b5410007f462000b84010a008582100e0401088044620040014110044ec0c3a6f9c84dd9e92003bfffcbceffc460004100430005380204620085f4231e809582109101430005314208019460004000400000e84a3921454000003d8088001461020c0581084051410004c46f0008658f78168dd2f46000410842514100040041000404010bc08923fc1fb041000404441000040109002c9fa46f0011200078b9a46f00100101782f484a1d810461004000420810080015821001114208100041001065810808014100106460004000400009740004008921fc00b46f0010e001782c9840046f0000358f78120dd2f46000400041000964210f8094210fc0914100096ec043bfffc84dd9e3bfffcbceff44400003a501f8007844146f0005158f780f0dd2f200f80074e0500124640040080648043802244060a3f14020041140180421401004314008044d53646000400040000194200740bc01846300400804344469e3f1441804180224435942f143100424600040044248a0f142080435800011044140007d51746300400804344469ee01441804180224435947f143100424600040044248a3f14208043580001104414000fb620ec0c3bfffc84dd9e3a6fa0bc4600040058000418b4204620011258210b9a54108080c1124610040058108400b46158318011b661443fff7fb42040108c02b6208401ae10d502ae5046f0000058f78044dd2f842146000100580002f4ae404600040058000208b440443fefff40210c0246100400b64058108038b40184239214540000034c00c0694660040546400405465001204620040546302020582107bc46000405586307b0584207b4585280125831820284efb6e6580007c0b6a446100405b6628445b640581087c48400d505442003e94c01000ab44144300090542100909c014c21fff64600041058000080842eb62046f0008658f7834cdd2f46000410580001008425b6208427b620b42044250000401088024c117ffb4600041058000100b4204434000040108c02c1fb46200410463020c0460004104610084058210130583184045800006458108130b662b620d53e46700410468000e946500410466000d846300410464000c846100410462000c058108110460004105873810458840fe05852810858630f7f5831810c5842073f5821031fb70758000100b6c5b683b6418425b6208427b620b42044250000401088024c117ffb4600041058000100b4204434000040108c02c1fb4610041058108140b441443ff00040210c0258210131b641460004105800014cb4204210e808b62046f0000058f78054dd2f4600040058000258b4204210f808b620640000203a6fa084dd9e3a6f98bceff84660011b58630580500f800446f0000158f78c2cdd2f0413016df001b63f84201413016d46f0000158f78c58dd2fb41f54000002c007800646f0008058f7867cdd2fb41f40003c08921fc00a4600011b5800058046f0008058f789c8dd2fec083a6f9884dd9e3a6faabcefdc8420a4c0d50484a74c1281054021840e96949c49c2f94610011c581081d000708372006083730050837400408378002083775473800f95b44063980497b0402120084052c008404230084053140440420804462004124042140446f00119143780bf1441028200308376004083754031c0084031900480221431028344240071142082a04610041258108320b4615431fe005020fff09269b4829cd9465e0fff58528fff9261404214024031e00898dcb66246300412b482b4a1b441404228085412fe00929a9229542100389243984c9a4a4010c00858108307804380a21411829ff281f58280a2f284f585f201f5028023f18358210a0058528a10f186f281f103f204f582f50558108a1458210a1c58528a24f183f284f585f10647c0041258108a2c59ce0a3883c3f18615cf80075090001450800020506000245070000e8540f20180beb742a443a685541081ff5421000f4010c00840108804f2028085b622a485a44454210fff4021400854108fff40110404f2038064b622b429f20447c00412b6228d4104148001f20559ce0a00b6225094802cb428f206b622b426141f028da4b80213ffff54210fff4021400854108fff40110404f207b622a67a00247ffc4010c008401088041412828f84a4a0715084002c141202915073802c021000165063002c5000002c1411829e4ca2ffa946f0011c022782a08023800114208281403140088423141002a4b67c815cec243a6faa84dd9e84af46f0011c0027854d4600011c580001d01050037784a31050037884af8460849f4610011958108308125001b884a2103003731050037210408010103003741030037510400376ca09460000b858000128a809942bac08d50d8404ac0884a1da044401c638d50584a2da044404e9d0a8098400847fd50b9c49445000201a310008d9fb9c0184224c00800b40202408464001195842035298948420d5ee460001195800030884209ea946f0011910178305142000091410000b142000081410000add9e3a6faabcefc4960150200008461001195810830838108a02f0819c895cf10020e802d5035020ffe1f00146300119583183085040000a3831920296914c21c00448000482e243e802d503503180209a9a96915cf10021e912502080105cf10020e9035020fff0f00146100119581083085030000c38208e0ad51098515cf08020e9035010ffe0f2015031000c462001195821030838110e0af30146100119581083085021800c38108a029c895cf10020e803f286d5045040ffe1f486f601460001195800034895b598f194dcf2069818f684f088f182e022e80450308020f382f60146f0011c0037854d4620011958210308504300083811120acb0c44100180838242830424f00251e3001c81264800035f46100119581082fcb4a14430dea856528008444017704012141b4011941a92219e4af001f1834410018042800424049f80018382f00251e4801c480000d8f3045410001f988b94944640011958420348f6089954b445b4c64c230017f001441001804210042484a0f18746f0011902178184f18b46f00119041780bff185f107f1834800022f845facad9fc1f18584cc8540f087480000a5f3045413801f984b944c4640011958420348980cb420b4459c4ae2224ef30099a46ca484984a96494e9300075cf08258e80a8428d50984414c914003d50484624c91c0059223121e0004a444a4ace222e905023e00049a4ad504023e00049a514011840756108001c16ea0c1a0a9e262e9064640040098549acbd5029ad3f103e261e95cbc0140120409e223e957384e79018028421218734640011958420308984cf4055423801f124082208088381e79014240987380244640011958420308984ca52c124082218088381e79014240987380244640011958420308984c122082228048381e7901a404422098739854120082238088381e79014600011958000308424098734420ffff986014308112a46d4c114005383e7901aced384e7901ad2e381e79019c499649381e79095cf08020e90938ae7909d506bc0140120409e223e9069ff9f006e0074ef3ff5bf0079e01f106e0204ef3ff2848ffff35f202f3045401001f980394044640011958420348f6089804b420b4c64c13416ca4454420ffff4c11015ff207846c42208c7350420404a40641e110005040801ff08983844800014a020f0000f6044610011958108348983094049801a4454420ffff4c110137a406f207846c42208c73f08a464001195842074c049f000180e115ef800c15cf800d83c840a110008385048f800bd57d020500004de38078f6044610011958108348983094049801a4054420ffff4c01006b04450001e324e90440049001d503400224014004000656000001c05cf301e663e8595063801f84a08461e2e3e8038006d5029a3bf103844c42100873800146100119581083089801040001129a849a604024080640140406e204e90456110001d503561080019cd9c1029d69442000329fb14c317fdce6a3e92d4630011258318154d51bc902d518a05b0201800cc10c9a48e224e811a05c84c198014002000641c3001bd509a05d98819a08e204e804e2824ef300ab8c7ca418f205446000ff401008024c037fe084014dc040044800009d9df98d4cf10ae227e882f201811e80bc05ef800c05cf800de643e82b443f906f40148c00e633e825807c84408421e301e90440040401d5028003f40384cc42401873446f906f800446400119584203089804040001129c4998069ed9e613e8029c91440000324c107fe4e444e902d564f10584444c114031f301e663e865444ec7b1400490005cf00063e85e807c84408421e301e90440040401d5028003f603848c42601073444ec7b1800646600119586303089806040001129c4998049ed95cf00063e8029c91446000324c137fe3e444e93ad531f00584284c00c036f201e643e832443ed39140048c00e619e82c807c84408421e301e90440040401d5028003f40384cc42401873446ed391800446400119584203089804040001129c4998069ed9e619e8029c91440000324c107fe4e443e909842146f001191017830584a1480001b951ef000c51ce0001f109508e7fe1e2284ef2feb4f2029e91f282f306f402e0644ef3fe8846f0011910578305480001a1f6045410001f988e94944630011958318348f4089953b4c5b4844c620011f6014410018042130424f18346f0011902178184f003f185f08a48000178845facad9fc1f18384cc8540f085480000b7f3045413801f984b944c4640011958420348980cb420b4459c4ce2224ef300aba4c4a4ac985396494e9300175cf1812de9055cf1012c4ef300995cf1012de9055cf1812c4ef300925cf0826ce8039471d50c8428d50a84414c9140049223d50584624c91c0059226121e0004a444a4ace222e905023e00049a4ad504023e00049a514011840700000000";
+// Buffers kept for the messages sent to controllers
+#define ONE_PACKET_POOL             8
 
-constexpr static const char firmware3[] = "0038001056108001c16fa0c1a0a9e262e9064640040098549acbd5029ad344104105e223e85cbc0140120409e223e957384e79018028421218734640011958420308984cf4035423801f124082208088381e79014240987380244640011958420308984ca52c124082218088381e79014240987380244640011958420308984c122082228048381e7901a404422098739854120082238088381e79014600011958000308424098734420ffff986014308112a46d4c114005383e7901aced384e7901ad2e381e79019c499649381e79095cf08020e90938ae7909d506bc0140120409e223e9069ff9f006e0074ef3ff49f0059e01f106e0204ef3ff1c48ffff29f202f3045401001f980394044640011958420348f6089804b420b4c64c1340a3a4454420ffff4c110096f203846c42208c73a406504204048381f08741e11000049f800548000083020f0000f6044610011958108348983094049801a4454420ffff4c110070f203a406846c42208c73f089464001195842074c80c199d4048f0001d55da4384dc30059f1044620011958210348980894049802a4054430ffff4c01804ca0f9e303e90440040c01d5034001a0014004800656000001c03ef401e683e83b44008235e203e8375053001f85408481e2c4e8038005d5029a34f10a844c42100873800146100119581083089801040001129a839a584024880640148406e203e90456110001d503561080019d21c1028d41442000329f694c417fdce743e90b8420560500034050800646f0011910578305d51c9db18cecf309e266e8a251ce000151ef000cf407e29c4ef2ff7df6029fb1f682f006f102e0014ef3ff51842046f001191017830584a08005ec3c3a6faa84dd9e46100119581082fc0000800846200411044100479cc196d8a14910308008a909c00e46200c009b25e244e905840140000c06d5058401100080088400dd9e92003bfffcbceffc96484e2200874e320085a40084a4d82fe623e8605cf18078e80e5cf10b54e97950016da35cf006a3e9745001656f44105116d50b5cf18082e8485cf10b54e9695001588b44104432e220e863441f92c798115cf0018fe95d444f8fe398144410c7fee220e856440138e5d55084a2d80ee623e8515cf11324e94c500158275cf00897e94744018705d54184a1d82be623e8215cf18078e8115cf10b54e93a50016da35cf006a3e9355001656f5cf00d47e9304400f0a1d52a5cf18082e806502174ac4400e54dd522502170c45c011839d52384a3d92046f0008758f782b4dd2fd51b84a8d818e623e8165cf18083e81144006ec7e202e80d441f8fe398114410bc46e220e80644012c8d40010006d5048400d5028401ec043bfffc84dd9e3a6faabcefec960046f0011c0027854df08384014c20400846100112581082dcf182d51cca0746400112584203bcf482d51546f0011c0037854e461001125810857c5031ffcc96d85c31800d5020ff2040008c1b40010c1af0824680041258840a5850547fa8802884c047c00412815c812a810580e680a1f1034020980e9694c21d46f0011c022782a080264021400840230804b648042e0293f0020435029404448297b485f58146f0008758f782f4dd2f8421f5014070801b9db184844c627fdd8007ec143a6faa84dd9e3a6fa8bc468004114670ffff4090800058738ffe84c046a0000258a50750041400479db14020a4018401e229e903e2e2e8064be02801445005dcdef23a6fa884dd9e92003a6fa0bc46f0011c0017854c97c084a2d13f840846f0008158f7822cdd2f80c0c037a04284081203000cb6e14635870846f0011c0027854e583180084021200840711c04b6e146f0011200278b964600011b58000580542100034021640840210c04a8b3802646f0008058f78490dd2fc80f0003001a4620011a5821021894048026980246f0008158f78488dd2f3a6fa084dd9e9600560000015c00000158100002460004129648141002a4dd9e92003a6faabcefec840046f0008758f785bcdd2f4600011958000308a04346a004129c49a843878058a50a94812080dfb40a849fb42ab44ab46a4c0200805e500000850087c2408f141b407140094041c009000480104010a808922a5442003f545383ff54319fff54210fffacb4ad751043000cacf710830000a8714c04000e803f8444460001195800031846f0005a58f78384dd2fd5209e019600e602e80e042480050204800c9a4a5cf087d0e806447000c740738006d50284e04600011958000318803f844446f0005a58f78384dd2f84a1d72da670e622e82a5000801c47e0011959ef03089800881ea482944d988a9c94043480039494885eb662a482a131988a9c949494885ea911a482a574984a944c883e12508024a4429c499649ac425cf08020e90487c013e0000251ce0001445000404dc2ff7d46300119583183080241801e0251801f1441800a1451800b441000678440840246f0000658f78c04dd2f840146f0008758f785bcdd2fec143a6faa84dd9e92003bfffcbceffc46f0008658f788a0dd2f4600011c5800054ca641c906460001125800073cd51884a1d906460001125800065cd511a6c2461001125810865c5031ffcc96d85c31800d502081c040010c1b40008c1a46f0008658f78680dd2f840146f0008758f785bcdd2fec043bfffc84dd9e92003a6fa0bc8420810084444600011c5800054c46f0005a58f783c4dd2fb4c84670011c5873854c92d8afb846300112b4089210ae39b4089208ae3ab408ae3bc6174620041280024610c35084805810800110618ba4144102801410004baf3846f0008758f78750dd2fafb8d5074600041210618ba41460028084003a6fa084dd9e4600040258000100b420b44042217c08b640b44042217c09b640b620dd9e920046200402042100404630040040210c02c2028441b64146f0010e00178d91c1088421b62046f0011210178b9bd502b620dd9e92003a6faabcefe44600040ef0818020f1828020f184f101f083f085f002f181f10358000004f08258108008f004f183f1055800000cf08458108010844446400110f18546f001031427838b46100100581080c48460584208004400f800b6811430800ba809a8cba8cda8cf143080094600005858000348f10147e0040eb6014600008758000c44f102b60146000003580008bcf103839eb6014600008758000b3cf104b60146000003580008f4f105815cb6014600008758000aa8140f000546000053580001d8b88646000087580009a4812a14050007460000555800001881091404807a460000875800086480e880a7466200001404007b840f1403808014628081ec1c3a6faa84dd9e92003a6f9cbceffc840084284620010e5821023c4660011246f0005458f78e4cdd2f00030b9b84a1d80946f0008758f78844dd2f840010030b9b840046700052587381e04660010d586306104be01c0100130c2c4450002054008060d00e9569d03dc84650130c2c50030c6046f0005358f780acdd2fd5444400002d46f0005458f78cc4dd2f00030c2c50007fe09600e602e82e00130c304400015c420080244620010d58210610980204200010c21350030c2cdd2200130c3044000014420080244610010e58108ce09801a0044be01c01d51684038421d50e50130c2c50030c6046f0005258f78840dd2fd50984038421844046f0005658f78f24dd2fec043a6f9c84dd9e3a6fa0bc442006485c30864940708c1b40710c1a8100840346f0005858f78148dd2f800746f0008158f7822cdd2f80c0a0028047802897f946f0005a58f78384dd2f1273000c46f0011200078b965473bfff54000003400064084073800446058d0840738004a9f380264600011b5800058046f0008058f78490dd2f4600011b5800058046f0008058f7867cdd2f3a6fa084dd9e3a6f9cbceff4441000308403f18146f0005858f78148dd2f4400012c46f0008158f7822cdd2f84281210000c46f0011200278b9646358d1854210003583180084021640840210c04a88380204600011b5800058046f0008058f78490dd2f8424400f840046f0008558f78e0cdd2f46600000586306c0840a4be0180184074be01801461004000420810642211c09142081068001041000854210b00914100085466004005863020cb4e6840a58138010b62646f0000258f78750dd2f427390098420b6e646f0010010178302461004000420808c847e40210c021420808c4600040558000700b42058108001b620b42040108c02b620b40658000200b606ec0c3a6f9c84dd9e92003a6faabceffc96009722976a208f8020207f8024ca114600040204100040462ffbcf58210fff4010880240318404143000404800014397a05ef18401e8235ef183ffe848444000404c32003d5ef18041e80d449000104c34803240a484084c35003084884c324029d529409208084c34802e40a20c084c35002c95214c32401dd523449010004c3480265ef19001e80844a008004c35001f44400c00d50b449040004c34801840a484084c350014444020004c3200108480d50e8484d50c8485d50a8486d5088487d5068488d5048489d502848ac97044a402104090280040949008854105c480004c254009894750140001421504249e4996484052a0085452bf005484000f4084140446500c004073d8084073940240741c04468003f04010c00850a07ffc4010a00254a500ff40138404e742e90384a0d507465001105852880c3852aa0254529fff404240088542404290044c25001484a3da08406360084042180458108010d50a84e14c23c008406360084042180458108020462004025821008cb4e284c19f414003000c96dd40001c04956c406e2c0940632c084231f4085071008c5083fffc4031980499af88a8d57585214c14c07844a40220409028004094900805c480004c2080048540d50a50a380015014000142a504248f4154a500ff4052a0085452bf005484000f4014140446500c004073d8084073940240109c04467003f040a540089f4440a51c0297684010a804e6a6e90384a0d50746700110587388143853960254529fff404240088502404290044c24001485434c254009406360084042180458108010d50984a1da07406360084042180458108020462004025821008cb4e2446100009f414003000c96dd40001c04956c406e2c0940632c084231f40850a1018c50757ffc403198044062a800996fb602b669b625b686d50a4600008e58000db046f0000458f78484dd2fec043a6faa84dd9e8423420004248420d5088440920084679c914c21fffd9c49e220e9f8dd9e92003a6f9c3c960454408fff400040084630041040701004583185288480b40384a14200340bd018b6e384a0b4c39d694203340bc80654630fff4c60c00ed50544000064d8f4d507461004100410814bb622d50684019d2144500064dce13a6f9c04dd9e9200960454108fff581090004000400846400410806440008004142201491401814a84200401814a9c494200340bc006440000644c107ff88401dd9e92003a6f9cbceff49780502f80048460800680e1f38146f0008758f78f24dd2f46300112042183004610011958108b109c1138608808f1014640011958420b30140183004600011958000bb038720a0a38100a0aec0c3a6f9c84dd9e92003a6fa8bc46f00112046783004600011958000bb050837fff40740808409380004600011958000b1089004600011958000b3046a0008758a50f8899f808047fff0c13ffff0c24ffff9fb14be028014e66fff746f00112146783003a6fa884dd9e46200112041102ff4630011958318c303801860a9cc9b4804600011958000cb03840060a143102ffdd9e920046f00112040782ff4e07001a9e41944a4630011958318cb0988b4630011958318c30984b0c30ffff0c417fff9e01b6834e06fffa46f00112140782ffdd9e92003a6faabceffc46100410042080208380582102001420802046f0011200678bb1ce48462004f00401000c4610040d580000011401000cb40147e10000812146a201e880414687000480a14677f03046471114806140007804588400015873807f58a5085d58420001b60114a4800214810006a9e9a916a99b8101b4014670008758738f0442004c08b601b421d50844500065d60a97914be01c01b4289230964c9cb1840ac9f5842146f0011210178bb14610040db4015400007fb61cec043a6faa84dd9e3a6faabcefc4844096489600f184f28bb61ff28df28c4e13037f4660008758630fc4dd26b41f44100010dd26b41f44100114dd26b41f44100138dd26b41f4410012cdd26b41f44100130dd26b41f44100210dd26b41f44100244dd2646000412466000885863008058000704dd264600041258000714dd264600041258000934dd264600041258000004dd264600041258000718dd264600041258000980dd26f004f081f101c92e46280056b41f4660008758630f8858210e53dd26b41f4625403744100138dd26b41f462081005821001b4410012cdd26b41f44100244442001c0dd26f30184445641800184654001901a4001101b8420f089f18205cf8000d51bf30184a14660008758630f88db074628205658210e53b41fd50cb41f4420010044100244dd2646283056b41f58210e538420d5d7f709f101f30284464071041a4660008758630f88cb2244100010801cdd2646200400801c582108b144100114dd26f001c807801c4410021044208888dd264620a898582103bc801c4410013046f0008758f78f88dd2fd51146200421582108f144100114801cdd264620a890801c582103bc44100130dd2684614660008758630f244410024c502f8030801c40919c0c4be0180146300412f387f38544100250801c502f802c4be01801f007f1059ff958000704581089fcf783f087f18504af8002d504f3039ed9f383f003f1019c01f088c91f4ea30009f20c92479497801c40248804d50e84a14ca2c05ef20c441f80ff4034a0084021040240218804801c4410024c46f0008758f78f88dd2fd54bf30184a1db254ea3000cf20c461ff80f58108fff4034c00840210402d50d84a14ca2c0b4f20c46080fff58000fff4034e0084021000240218804801c4410024c46f0008758f78f88dd2f4800009ff10184a24c12c0984ea30009f20b92479497801c40248804d50e84a14ca2c108f20b440f80ff402100024034a00840218804801c4410025046f0008758f78f88dd2f480000f54620041280628420a85144237f7f1421833b4ea300074620120758210f7fd505462012a758210f7f1421833b8043463800001431033a4fc3000c808246380000583180121432024d15c101c5d50d8082462c00005821001280641422024d44200081142181c5466004128401a83446f0008758f78f04dd2f46200412463f0f3084e0a9f414710260143102608047d50c44500065d70c46f0008758f78f04dd2ff0059df9b4409694840ac2f346400412462f0f305821000314220260804404210261f2864ea30007463f0f3058318020d505463f0f305831802a1432026046300412583189845041836448000147f30184a1db7a46300412442000128083a89944237f7f1422033b4ea300074620140758210f7fd5054620154758210f7f1422033b4638000080441431033a4fc3000c808246380000583180121432024d15c101c5d50d8082462c00005821001280641422024d44200081142181c5466004128401a83446f0008758f78f04dd2f46200412463f0f3084e0a9f414710260143102608047d50c44500065d70c46f0008758f78f04dd2ff3059df9b4439694840ac2f346400412462f0f305821000314220260804404210261f2864ea30007463f0f3058318040d505463f0f305831805414320260806480838400043182611402033a480000cef1074640041280a4463c00025831810184004420005ab601a8a1143281c64fc3000c463800008044583180121432024d15c101c5d50a5021df1180641422024d44200081142181c580c58401a83446f0008758f78f04dd2f46200412463f0f3084e0a9f414710260143102608047d50c44500065d70c46f0008758f78f04dd2ff3059df9b4439694840ac2f346200412463f0f305831800614310260042102614670041280c784618400f286140381c6a8f4800346f0008758f78f04dd2f8460a8f44ea300074638000258318128d505463c00025831811c143381c64fc3000e46500412464800008065584200121442824d15c181c5d50e46500412463c00005831801280851432824d44300081143201c546800412467004128461588409808400b608a8fc800346f0008758f78f04dd2f463f0f3084c0a9bcb6c8b6688066d50c44500065d60c46f0008758f78f04dd2ff0059db1b46096dc840ac3f34ea3000b46400412463f0f305842098058318080d50946400412463f0f3058420980583180a8b66446300412583189845041fd948420b463b624f006842140308c1a94874ea3000840210c775cf10179e90ed50640210c775cf101cbe908f30840108c0c4010840540948402f0034e05000984214010800c4094840448fffdb0f101c90df302cb064620011958210af8d5234620011958210afcd51ef00184a1d80df302cb064620011958210b00d5144620011958210b04d50ff00184a2d80ef302cb064620011958210b08d5054620011958210b0c38917008f00284a29c419648f1824c12fd1af00184a39c419648f1814c12fcca507f8034b41f4660008758630f244410024c8047dd26b41f4620011958210af838a10000f30d4620011958210afc4618080838910000581080804620011958210b0038410000403184024620011958210b044054a00840350c04382100004031940440424008403190044021600840318804f38d80434680008758840f884410024cdd28b41f441002508047dd26b47f4620011958210b0838410c004620011958210b0c38210c00f30d440f80804031800240320c044021200840318804f38db41f804344100250dd28b41f4410024c8047dd26b41f441002508047dd26b41f441002648047dd26f20d46180fff58108fff4021040240a56008b41f4025080444100264dd28b41f804744100278dd26f20d46380fff58318fff40210c024094e008b41f4024880444100278dd28f004c8164660041246f0008858f78020dd2f46f0008858f780acdd2f8401a83446f0008758f78f04dd2ff104a874ec3c3a6faa84dd9e3a6fa0bc97c04660008758630f88c7108400462a00565821040680204be01801462a00565821040684208401d50f462a005658210402802780074be01801462a005658210402840180274be0180184004660008758630f88441003088040dd2644100308442008008400dd264680008758840f0444000023dd288400441003088040dd2644100308442040008400dd26840add288400441003088040dd2644100308442008008400dd2644000023dd288400441003088040dd2684004410030844201000dd2644000050dd28c7628400441003088040dd2644100308442100008400dd2644000028dd288400441003088040dd2644100308442200008400dd2644000014dd288400441003088040dd2644100308442400008400dd2644000028dd288400441003088040dd2646200080441003088400dd2644000014dd284410030884408401dd2644100308442400008401dd2644000028dd284410030884408401dd2646200080441003088401dd2644000014dd28840046280056582100048020dd2646280056582100048420d5414410030880478007dd2646200100441003088007dd2644000032dd284410030880478401dd2646200100441003088401dd2644000032dd284410030880478007dd2646200200441003088007dd2644000032dd284410030880478401dd2646200200441003088401dd2644000032dd284628005680278007dd264628005680278401dd263a6fa084dd9e92003a6fa4bceff4978046000412467000885873808058000004dd274600041244100042a8414690008758948fc480068420dd29462800564680008758840f8858210f5784208006dd28800644100010dd29462304f058210006441000108006dd28800644100244dd2944210100441002448006dd28800644100298dd294620303058210304441002988006dd288006441002a8dd29441002a8502f8004800646f0008758f78f24dd2ff20142216009441002a88006dd28800644100114dd2946200c21582101f1441001148006dd28800644100130dd294620ab92582103bc441001308006dd28800644100210dd2944209595441002108006dd284600041285008421a844148000044600041258000088dd27460004128422141000224600041258000300dd274600041244107408141000c04600041158000004dd2746000411580000048428b700b620b7004600041258000080dd274600041244130001141000204600041258000718dd2746000412461c000258108101141001c6460004125800073cdd274600041246180000141001cf4600041258000704dd2746000412148001c14600041258000714dd274600041258000934dd2746380000583180124610041240237808800140210c0458330080143081c51420024d4600041258000980dd274600041258000700dd274630041246470f2080438002461092f558420006144182605810890844310000143101c080e0141001da4690008758948f04440003e84be02401040381dd8d0154000080c005445000644c82fff446000412461092f558108900141001da040001f4ce0454100007d505401010095410800784a7d1179c89ce0a920394034610041240210004142081f4d50c441fff8f4000040294944610041240010004140081f446800088588400ac46f0008858f78020dd2f4be02001460004115800000446f0008858f78080dd2f460004115800000484e08428b6e0b620b6e0466004124be020018401a83446f0008758f78f04dd2fa9f4ec0c3a6fa484dd9e920046200112041102fe4630011958318d303801860a9cc9b4804600011958000db03840060a143102fedd9e920046f00112040782fe4e07001a9e41944a4630011958318db0988b4630011958318d30984b0c30ffff0c417fff9e01b6834e06fffa46f00112140782fedd9e92003a6faabcefbc46f00112042780339600964840314009f08684a1f18b103f803e122f801ed9068428f18a449000b8d50f46f0011200478ba9443000a4442000b84091901a4091101b8444f28a460004124660008858630f3058000714dd26460004125800076cdd264600041258000770dd264600041258000718dd264600041258000934dd264600041258000980dd26f306462004124618000058418080460c00024031f80858108012144101c584a046600fff4011840458000101502f803ff18c58630ffff089f585f281480000c0463004124024a008f387f0064021240444100210f388f384f58246f0008758f78f88dd2ff007f108f20447c00412580007185810876c5821077059ce0010149f800df087f188f284049f800bf502807c50af803c8386f109f007b6204400003ff2088421b602000500004c90c00940102008f20440008004b602d50bf2044000400846100412b60244000060140083048401b603f383f58246f0008758f78f04dd2ff303460004128420b6231410024d8040f10c1410024d8400140102608421f5024c90c007460c001058000006d505460c00205800000c84201401026080c1d50f441000654c608015f383f58297914be020010413827ff303f502d50680e24680008758840f04964c9cb1840ac1ea84414c91400b46100412460c00105810898058000006d50946100412460c0020581089805800000cb60146000412040002618d4140207006401280064050041b41c0081bf0014ca07f804420fffd049f800d80dce25ce9065cf2b000e80d8d21d5028f21f2059c519649f185f305f00ae2604ef3ff3f4660041246f0008858f78f5cdd2f8401a83446f0008758f78f04dd2f8400a834ec443a6faa84dd9e92008421804044000258403100979c4996489818846b92014c11fff9dd9e3a6faabcefb446f0011200478ba8960046f0011200278ba9f081846c840056420001f28d8446f0854001901a4001101bf30196488440f186583180808424f08ef183f284f28af28bf282f288f38ff4064660008758630fc44670008758738f88c47ef0018420dd26f00146280056582107578420dd27f00144100010dd26f00146230d705821000644100010dd27f00144100244dd26f0014410024444210180dd27f0014421014044100244dd27f00144100058dd26f00144100054dd26f001462657c044100058dd27f001462015ac58210a0044100054dd27f00144100210dd26f00144100114dd26f00146200c21582101f144100114dd27463004108448142181489456f0014680008758840f24dd26f001462050005821010f44100200dd2705cf800e84c04670008758738f04f00144100200502f80404be02001f1109db15410810097b184054e1200934be01c01445003e8deed4800008cf001f106dd26f106f001462a005658210f53dd27f0018424dd26f0014424012c8424dd27f00144100010dd26f00146230d705821000644100010dd27f00144100244dd26f00144100210dd26f10d84a1d909f0014410024444210130dd27878dd508f0014410024444210170dd278786f0014670008758738fc4441001144be01c0146200c21f0014660008758630f88582101f1441001144be01801f001441000444be01c01f0014620049258210016441000444be01801463004108448142181489456f0014680008758840f244be01c01f001462050005821010f441002004be018014670008758738f0484c0f00144100200502f80404be02001f1109db15410810097b18405c1064be01c01445003e8deee4630041084421421814846000412466000885863008058000004dd264600041258000704dd264600041258000718dd264600041258000714dd264600041258000088dd264600041258000300dd264630041244207408142180c04600041158000004dd26f203463004119e91f287854058318004844846400412b7435011900cb643b743846114a20001b661b7418004f40780a084421440031414228022b63f50008070dd264630041244230001142180204600041258000084dd264630041244220000142180214600041258000cb8dd264620041214a1032e81024690008758948f0484054be0240104440304467004129283952344200b0b14440304142381c180c7f20f80a6463c000258318101142301c5143281c6440000324be02401f307460000884021c00846400412580000804001000458420c2414af8009f08c04af8008f48746300412f10c8481f001a91c8480a91c402e0404401e2008402104044410021046f0008758f78f88dd2ff001502f80444410021046f0008758f78f24dd2f46000412466000885863008058000c084be01801f0014610041214008302840346f0008758f78f04dd2f4600041258000c144be01801462004124410040c141103054600041258000c044be018014620041258610c0444100093b626f705d50a9df946f0008758f78f04dd2f5cf380c8e806b426840a54108080c9f3f785469004124683ffff467007ff58840fff58738fff84c0f307b6c30404830ae6c2e80ae2e0e812461ff0004000200892089801d50b84a4de09e300e8074648000042007c099804d50fce0440a0300ad51684a1de04900cf082d51184a2de04900cf08bd50cf304f40a900c561300034030041b4040041af384f48a840a46f0008758f78f04dd2f9db184a5dec6f30684a1d330f00384a4d82df10b421528755cf0abf2e90451ce7fffd5105cf08708e8215cf081c3e80451ce0005d5155cf082aee80451ce0004d50f5cf08423e80451ce0003d5095cf08549e80451ce0002d50351ce0001f20984a69c91f2894c22ff2cf20b448000644225287514af800842012024467000895873821c4be01c01f20af402812042221075420120244be01c0180c0c0234e920022442003e842200824f304402124b6f00204af8008848a423028754273242442419024443011e842420c2450317c184051a408502103e841e288d640321c96d503846083c3f1015481807f540f007fc90a467004124084200858738c6050638010d509467004124084200858738c6450638010b70746500412b606042283045821000714228304f206ca1f5471807f846480058380814081208100f3834073a008542f007f80239e4914100314f401cc06147483181424031cd505147e03191425031dc9f2f183804584e0147101c646600088586300ac46f0008858f78020dd2f4be01801460004115800000446f0008858f78080dd2f46300411583180048448b6e3b643b6e3468004124be0180146400412806484011472032414718325140400044660008758630f044be018011474000484024be01801f006c006f1039e49f1834e13fcb9ec4c3a6faa84dd9e3a6faabceffc461004118448960004a08001a889e60fe80a460004124612020258000ce058108020d57346f0011200178baac92a5cf00034e80a460004124616450358000ce058108f3fd5625cf00045e802d54d5cf00075e802d5495cf000aee80a460004124613f3f358000ce058108f3fd54e460004124616464358000ce058108f3fd5455cf00034e80a460004124613f3f358000ce058108333d5395cf00045e80a460004124613f3f258000ce058108833d52d5cf00075e80a460004124613333258000ce058108833d5215cf000aee80a460004124613333258000ce058108028d5155cf000c5e80a460004124615050358000ce058108f3fd509460004124615050358000ce058108333b62046600412810684014410ffff05c300c2141300c2140400044690008758948f044be0240146700412842014140004441033f080071413832f4410004c1410032e440000144be02401440033e01403832f440000144be024014600041115c300c214a00001ec043a6faa84dd9e3a6f9c3c46200412041101ca80c2461010008460141301c944440000047101ca984c97f898df467012c080a280824c13fff346101280141281c9844a041201ca44400037964842109024401088579ad9e060e9038400d5055e31fff2560180013a6f9c04dd9e92004600011158000e6846200412b42058510320d1059d6cd103a081b6418c084650011158528f28d8f1dd9e92004600011158000c3846200412b42058510320d1059d6cd103a081b6418c084650011158528e68d8f146000400b40092045400000fe603e90846000412461870005810830aa843dd9e3a6f9c3c4600011158000c18a047b4c0a1c1a102a143a084a0c5a006b6e6b6a4b662b6203a6f9c04dd9e92003a6fa4bceffc4660011158630bc84670008758738f88a63084a9d80e02830001049300018028804984004be01c01802880498401d505e602e805a471a0b14be01c018cc84650011158528c18dee5ec043a6fa484dd9e92003a6faabceffc55c000ff4fc2000e46f0011200078ba884a1d8134660011258630acc854bd50f46f0011200078ba984a1d8074660011258630b248545d50384c0814680e685204680008758840f88d515a63884a9d80aa479a0b984004be02001a479a0b98401d505e602e805a479a0b94be020018d218ce8e12ae9eb4fc2000e46f0011200878baa84a14c82c0134660011258630b4cd50e46f0011200878bab84a14c82c0074660011258630b54d502850084004670008758738f88d514a63084a9d80aa471a0b184004be01c01a471a0b18401d505e602e805a471a0b14be01c018401e008e9ecec043a6faa84dd9e3a6fa4bceff48400f0814660011158630bb04670008758738f88a63084a9d80e02830001049300018028804984004be01c01802880498401d505e602e805a471a0b14be01c018cc84650011158528bc8dee5508f80044670008758738f2480484410003484004be01c01f2014660008758630f88441000345821000184004be0180180484410003484014be01c01f201840140210004441000344be01801ec0c3a6fa484dd9e92003a6faabceff484e054a000ff55c080ff506f8004441001308007804646f0008758f78f24dd2ff00184614200480942004c094dc1c00542004808d50342004c08f08144100130f2018007469001105894882e46f0008758f78f88dd2f5084802202048000e340e93002048001e20ae92c441000588046800746f0008758f78f24dd2ff001461f8fff58108fff8461400004024dc1c00500140000d5084fc3000504147fffd503001400014010e00840008004f08144100058f201800746f0008758f78f88dd2f5084003446500110585289bc509480344c82ffc59df984a2df9be74fe80e46f0011200578ba98461d30646f0011200578babdb148400d50d46f0011200578ba88421d10646f0011200578baad907840146f0008958f78bfcdd2fec0c3a6faa84dd9e960096489690e60fe82484014c10401240210403463001125831894446400112584208fc4002081a4001881b8429d54946100112581089c456210001463001125831898c4001881a4000881b8427d53984014c10401b84a2da0746000112580009fc8423d52e84665621000184074011881a4010081b4640011258420a144630011258318a44d51984a2da074600011258000a7c8421d51584645621000184054011881a4010081b4640011258420a844630011258318aa44002081a4001881b8440b460a1019c91b6838c08e041e9fadd9e92003a6f9c3c4600041146180250466004124650077780868448a1c1a881585287778400480000af84214c008092e6064ef30092e60b4ef30092e6114ef30092e6174ef30092e61e4ef300925cf000284ef300915cf0003a4ef300905cf000464ef3008f5cf000584ef300885cf000624ef300815cf00069e97a5cf0006fe9745cf00075e96e5cf0007ae9685cf0007ee9625cf00081e95c5cf00083e95c5cf00088e95f5cf0008ae95f5cf0008ee95f5cf00092e95f5cf0009ae95f5cf000a0e95f5cf000a8e9595cf000ace9535cf000b0e94d5cf000b2e9475cf000b5e9415cf000b7e93b5cf000b9e9355cf000bbe92f441000bb4c00802f9c494c00802f9c494c00802f9c494c00802f9c494c00802f5cf000c2e92e5cf000c6e92e5cf000cae92e5cf000cee9285cf000d0e9228c314c00801d9c494c0080179c494c0080119c494c00800b9c494c00800546180250d51846180240d51546180230d51246180220d50f46180210d50c46180200d509461801f0d506461801e0d503461801d04010040480441453018c9c011412018d441000d680654c00ff48460004119e5c1431018c1411018ca9c13a6f9c04dd9e3a6fa0bc4670041184c04680008758840f04041380809db1964c8401c1064be0200144507530def64670041284c04680008758840f040413804c9db18401c1064be0200144507530def73a6fa084dd9e3a6faabcefe4549000ff96c89690e7224ef20183ca0e440000e0429480244600011c580005508920102480004800017544a000e042a4a8244610011c5810855040650400506300888481508f801410437f7810337f794670008758738f244410021480488400dd27f3054410021814337fdf80488400dd274430003842348c24f5059cd94640011c5842055094da98dca9594410021c80488400dd274430001c42348c2405ef80059cd947c0011c59ce055094db887c15e180014410022080488400dd27f3054410022414337fe280488400dd27846e42348c24f4059cd994dc887ca9194410022880488400dd27f5054410021414537fe480488401dd2705cf80054410021815c37fe580488401dd2705ef80054410021c15e37fe680488401dd27846742348c24f4059cd94600011c5800055094dd98d8a9194410022080488401dd27f5054410022414537fe880488401dd2705cf80054410022815c37fe980488401dd2705ef80054410024c15e37fea80488400dd27f30550537facb665f5834410025080488400dd2705cf800550437fb015c20000f4824410026480488400dd2705ef800550337fb415e18000f3814410027880488400dd2705ef800551c37fb815ee00004410024c80488401dd2705ef8005f5034410025015e2800080488401dd27f402f50544100264b6a480488401dd27f30105ef8005804815e18000441002788401dd27f10546000412b63c041001dd46200ff04010880214137ff3041001e6b626041001e7a871041001e8a872041001e9a873041001f0a874041001f1a875041001f2a876040001f350a500a84650041280858064804380224670011c58738550a83740651c0084001402831447e007f004a203180481831905c1031c0470831d55ce007f41ce20085473807f407e1c0447c7f00040a5400840a57002408420084073a804408478024073a004abf19c0184e44c03ffdb440000e0420480240410820646a0011c58a50550880a500000b8b620802204208207a88104208208a88204208209a8830420820aa8840420820ba885042081cfa88604208304a88704208305142000080410820514100009ec1c3a6faa84dd9e92003a6faabceffc46f0011c00278550846196004c21c00946f0011c00578551d8038500d50e46f0011c0087863084a14c82c13446f0011c005786314c50412e449000e0429424244630011c5831855040648c005063002804237ff74670008758738f88441002148400dd2744000038420400244620011c582105509c0194029802a081441002188400dd274400001c420400244630011c583185509c0194039803a0814410021c8400dd2704237ffa441002208400dd27840e420400244620011c582105509c0194049802a081441002248400dd2704237ffc441002288400dd2704237ffd441002148401dd2704237ffe441002188401dd278407420400244630011c583185509c0194059803a0814410021c8401dd27b446441002208401dd27a0b1441002248401dd27a0b2441002288401dd27a0b34410024c8400dd27a0b4441002508400dd27a0b5441002648400dd27a0b6441002788400dd27a0b74410024c8401dd2704230008441002508401dd2704230009441002648401dd270423000a441002788401dd2746000412041001dd463ff00f0423000b58318fff40108c0240108804141001dd04130018141001e604130019141001e70413001a141001e80413001b141001e90413001c141001f00413001d141001f10413001e141001f20413001f141001f3507480a84600011c580005504660041280a680858064804399f88400140303149c01a27940a0a00941c0c009812a5410807f55ce7f0054a5007f5494ff0015c2831814a2031c149183191411031d84244c00ffe6440000e0420400244620011c582105509802500000b8b440802314208206a08114208207a08214208208a08314208209a0841420820aa0851420820ba086142081cfa0871420830404200008142083050400000914008205ec043a6faa84dd9e92003a6faabcefd4960084ee46f0011200178bb240738006f0838402549100fff7824c10400484c8d50956108001844084644061841a4061041b46f0011200178bb384a1d90846f0011200378bb44c30c00ed51684a2d91446f0011200178bb484a1d90940800c08d50c84a2db0940801008d50784a2d90444800030d502850046f0008958f78b30dd2f46f0008958f78cecdd2f46f0008958f78b78dd2ff302c30646f0008958f78b04dd2ff002401300044080a0044610011058108998b4015450003f4c54400c46200412a00958510320d0059d6cd003a08ab6408c2c4650011058528ea8d9ec461004000420800e84a100000000";
+// Where a controller's messages carry its address and the Xbox One message itself
+#define ONE_SOURCE_OFFSET           0x2e
+#define ONE_INPUT_OFFSET            0x40
+// Input endpoints, each with a read always queued
+#define ONE_READS                   2
+// Milliseconds between updates of the unknown message count while they arrive
+#define ONE_UNKNOWN_INTERVAL        1000
 
-constexpr static const char firmware4[] = "00380010925454210003d2080410800e84a2923454108003d913f102c11e84a4d60384a8de0f464004124611e425806458108cf8141200c8141180c9d503f002c00c46f0011200178baa84a1d9424610011058108ea8d50846f0011200178bab84a1d937d5f5b4015450003f4c544005a009a08ab6408c2c4650011158528190d9f34610040058108130b441443fbfbf40210c02b641f002c00746f0011200378ba8cb0bd50646f0011200378ba9cb08b44158214040d50c84a1db0bd50384a1db08461004125810808844200040b6414e9301b1468001115884019050940008506f802447c0008759ce0f2446a0008758a50f88d56200540000f303db5c4410014480468400dd3c04740001f409460fe000580007ff5473bfff4073ac084042000240439004f4898044441001448400dd2a4410014480468401dd3cf309462fe000582107ff4031880240338c04f3898043441001448401dd2a4410015880468400dd3cf409b4a904748001545283ff54420c00404214044073b00840421c04f581f4898044441001588400dd2a4410015880468401dd3cf309f50154318c004031940440319c04f3898401804344100158dd2a8d108d304650011158528bb04c82ff9b46f0011200178baa467001105873882ef18450a3801a509380265083800651cf8024a438f103e2204ef3008aa439e2014ef300865023800e5033801e5003802ef285f386f08784c0f20484a1800644100254da0bb44946f0008758f78f88dd2f800604248001d50ab44846f0008758f78f88dd2f0424000180064410026046f0008758f78f88dd2ff0054410029cb440800646f0008758f78f88dd2f800644100210805c46f0008758f78f24dd2ff1090235000092304010c008403184048043800644100210f38946f0008758f78f88dd2f800644100148805c46f0008758f78f24dd2ff20900150002440f87ff402100024010ac08403088048043800644100148f38946f0008758f78f88dd2ff1068006b4414410005846f0008758f78f88dd2ff1078006b4414410029846f0008758f78f88dd2f9db184a2de8750738034465001105852899a50a5003450948034508400344c72ff67f202c20e840146f0008858f78a28dd2f46f0011200178ba884a1d962d564f702506f80244690008758948f244680008758840f8880074410021080464be02401f30992704031c00858318c0cf38980438007441002104be0200180074410014880464be02401f309442f87ff403188025831b000f38980438007441001484be0200180074410005880464be02401f309461f8fff58108fff462060004031840240318804f38980078043441000584be020019df984a2dfbf840046f0008858f78a28dd2f46f0011200578ba98401d00646f0011200578babd80c8400d505f10484a1d907840146f0008958f78bfcdd2ff00346f0008a58f784b0dd2f4610041246200777582107731420818cf30346f0011210378bb5ec2c3a6faa84dd9e920046f0011200278bb2461004129600041080c0ca02d50c84a1da074c014003d50784a3d820d50b84a2da1dc806443ffcff40108c02d51784a1d808443ffcff40108c0258108100d50e84a2d808443ffcff40108c0258108200d50584a3d8305810830046300412141180c08023041081c0ca02d51084a1da0b4c014003d50b84a3d81b9222944a58108001d51684a2da14c8049222944ad51084414c014003d50484424c0140059222944ad50484434c014007401088048003141001c0dd9e92003a6faabcefd49600e60fe97050107f9e9648e631e90a50107f8c9648e63de90544101c1cf188d50444201a1af28846300411583183a8b42347e004115410803f15ef8003b6234611b0f0f184805eb423f285f2874621b0f05821040040208804f103f289f20415ef8006581083acf18358210476f105f284f206581083c0f18558210214f107f286f20958108218f187b64346a00ff0f204f303b643839ef208f305813cb6434420fffff306468383c0b64380e9f3074662428280a7808558a500ff84205884023c58630e28b743142f008714ae0088148480e8146380e91412808a1412008b4800008b46200411582103a8b42247e004115410803f15ef8004b622b42215ef8006f18946101005f18315ef800805ef80034610041159ef05fff18115ef8003f10947e351604630041159ef0a00f38541e0f804f10415ef800905ef8005581083acf387f184f10659ef03c015ef80055810821405ef8007f186f10859ef021815ef80075810821c05ef8001f188f10959ef022015ef8001b62246a35160f20458a50a06b7424410060605ef800547c00550b63e59ce0055f203f1068123b64105ef80074680f3c315cf000080e3f10880c3b641465f4000f2018083463fa00058840c3c583182005852820015c10000148480e8148380e91453008a1432008b846e4c01c00a4610041258108004b44158210020d5084610041258108004b44142211409b6414610041004208146443fffe140210c0214208146e60fe90c460004115800032cb42087d94010f80258108002d50b460004115800032cb42084594010880258108004b620ec2c3a6faa84dd9e9600561000805cf0807fe9038400d511541000405400003fc1064410001f42000401d50752000000441fffe042000400dd9e92003a6faabceffc96004670011958738e904660008a58630f90e60fe97ca638dd269640a6394080c008dd26400060084623f3f358210f3f400400044610041140000802140080c5a63add26548000ffa63bdd2654a000ff0003800c4015200840840404dd2696400003800d4010c00840840404dd26400060084633f3f358318f3f400400044610041140000c02140080c60003800edd26548000ff0003800fdd26549000ff000380104014a00840840404dd269640000380114010c00840840404dd26400060084623f3f358210f3f400400044610041140000802140080c700038012dd26548000ff00038013dd269600400020084633f3f3400400044610041158318f3f40000c02140080c8a63c4800008da63edd26548000ffa63fdd269680000380084021200840840804dd269640000380094010c00840840404dd26400060084623f3f358210f3f400400044610041140000802140080c50003800add26548000ff0003800bdd2654a000ff0003800c4015200840840404dd2696400003800d4010c00840840404dd26400060084633f3f358318f3f400400044610041140000c02140080c60003800edd26548000ff0003800fdd26549000ff000380104014a00840840404dd269640000380114010c00840840404dd26400060084623f3f358210f3f400400044610041140000802140080c700038012dd2655c000ff00038013dd26548000ff401420084633f3f3400e040458318f3f4610041140000c02140080c8a63ddd2696404000a00840a500044094c0084000c00840952404408400044010e0084633f3f358318f3f408404044620041140148404800240108c0240840c02141100f5148000f6ec043a6faa84dd9e920046100411043080eb9600926394dbe60fe91350107f9e9648e631e90950007f8c9600e61de90444201c1cd50344201a1a58318006d5055831800444201f1f461004118001142080f0143000eb8400dd9e3a6fa43c46700412810080c7800680a080808068502400208420141003149c4904938318b7230493031c149180018c6804928319b7220492031d1491000185248c484c14ffec8020041082058400141400103a6fa404dd9e461004129600042080c0c806422110095821000bd51084a1d806440fffe440210002d50984a2d809440fffe54021000258210001142080c08401dd9e3a6f98bc462004100461006f462fff7f58210ff5406308029600844196484c01401346f0011200478b9c586300084620011258210bb64630011258318bb74c404019d51384a2d81846f0011200478b9c84a142634c084620011258210bb64630011258318bb7dc058400af10ae18d50fae18ae10d50cc80b46f0011210278bb746f0011210278bb65863000246f0011200078bb684a1d83246000411043000ca926494dc58318003143000ca46200412043100494231ac09143100498002043001c592684031a008143001c58040043100204231d0094231d4094231d408460004121431002058000084b440445fe1ff4021140258210800d53584a2d83446000411043000ca926494dc5831800c143000ca46200412043100494231ac09143100498002043001c592684031a00858318001143001c58040043100204231d0094231d4094231d008460004121431002058000084b440445fe1ff4021140258210200b640c90a46f0011200078bb746f0008b58f782e4dd2f460004101460006f84013a6f9884dd9e3a6f9cbceffc4640040004520048446f0f0f40529802585290101452004880640451804a446f0fff40529802585290001451804a464004100452006e466fff7f58630ff5405298021452006e46300411044180ec4663f3f097c8966140109804141180ec9790960046f0008b58f7823cdd2f8007802646f0008b58f78320dd2fec043a6f9c84dd9e4630041258318c508420b6230410000850218010b6220440000950110010b6818481b6830440000ab6820440000bb6818482b6830440000cb6820440000db6818483b6830430000eb6620400000fb601dd9e92003bfffcbceffc8420960046f0008b58f78320dd2f8401ec043bfffc84dd9e920046f0011200378b9c4620041196029648042100eccb15846296004c11c00b441fc0ff5400003f4021040240102008d50c924694965400003f40100804d507924694965410003f4010880446000411141000ec8400dd9e92003a6faa3c9600e60fe80384c0d51a461001105810882e446000ffa488e202e906a489e240e9030060fffe50108034465001105852899ad9f2445000ff4c6280f646000412041001dd440000684203002446900ff046a0011958a50ea4880a500000244010a40214107ff846100412042081e014207ffd042081e114207ffe042081e214207fff042081e3b640042081e4a881042081e5a882042081eaa883042081eba884042081eca885042081eda886042081eea887042081ef14200008042081e614200009042081e71420000a042081e81420000b042081e91420000c042081f01420000d042081f11420000e042081f21420000f041081f3465004121410001058528c508423b62546200412504280109ce4b52450118010b50304a1031cb4e154a5007f47c7f00040a520084094c0085473807f4094f00240751c044073a404469007f040842008408424024073a00414707ffc84e2b6e584e1b544b52305c1031cb50155ce007f41ce20085484007f408e200447c7f00040a5400840a570024084280446a007f04094a0084094a8024084240414807ffbb6e5b524b50305c1031cb54155ce007f41ce200854a5007f40ae280447c7f0004094c0084094f0024095240446a007f040842008408428024084a00414807ffa8500b705b4a4b4830421031cb4215421007f5410807f40212008402104044032c008842d426304244031f002401220084010a80240210c044021040499b74610011958108ea438209b0a14707ff73a6faa04dd9e92003a6faabc9600e60fe8038420d51a462001105821082e441000ffa4d0e203e906a4d1e260e90300117ffe50210034465001105852899adaf2445000ff4c1280c74430006842308c244660011958630ea498deb5034e8200bb4620041244410000049101c0144101c0e60fe9124600041258000774b44046aff00f58a50fff40212802b640a099b46040218804b64044000068420080248386881c8c18b46046200412143101e0a0c1143101e1a0c2143101e2a0c3143101e3a0c4143101e4a0c5143101e5a0c6143101eaa0c7143101eb04300008143101ec04300009143101ed0430000a143101ee0430000b143101ef0430000c143101e60430000d143101e70430000e143101e80430000f143101e904300010143101f004300011143101f104300012143101f284ed42709c2404200013460004129df9142001f395fb80a04630041288fc58318c609c9c5011000c9c0c84801442831445ef00ffb4c345c0ff0040637802b6c39d21a3b9b543408340094084700240842804b70340832009b54241c4700240a57802b74245efff00b542548400ff40ae2804b74297b0b54140a57802b741b54140842804b701b50040847802b700b50040632004b6c084c44c437fca8005149001c03a6faa84dd9e3bfffcbceffc46f0008958f78ba4dd2f46f0008958f78cecdd2f46f0008958f78b30dd2f46f0008958f78b78dd2f46f0008958f78f90dd2fec043bfffc84dd9e3a6f98bceff88442501f800684c0440001c4ad8846f0005158f780f0dd2f021f8003445002e646000112d905842110100b9cd50310600b9cec083a6f9884dd9e3a6fa0bceff8508f800746700051587380f080288441440000b2dd27003400004660011958630e9080288441440000b3aef0dd270034000080288441440000b4aef1dd270034000080288441440000b5aef2dd270034000080288441440000beaef3dd270034000080288441440000bfaef4dd270034000080288441440000a0aef5dd270034000080288441440000a1aef6dd270034000080288441440000a2aef7dd270034000080288441440000a310330008dd270034000080288441440000a410330009dd270034000080288441440000a51033000add270034000080288441440000a61033000bdd270034000080288441440000a71033000cdd270034000080288441440000a81033000ddd270034000080288441440000a91033000edd270034000080288441440000aa1033000fdd270034000080288441440000ab10330010dd270034000080288441440000ac10330011dd270034000080288441440000ad10330012dd270004000010030013ec083a6fa084dd9e92003a6f9cbceff4463004000431800e97804001b40997d054000007844296484c01000684a14c62c08ed50384a1de04101f8007d50b44000035501f8007844146f0005158f780f0dd2f000f80074210040bc906844146f0011210278ba89604c806842146f0011210178ba984a1de04107f8007d50b44000036501f8007844146f0005158f780f0dd2f000f800742100c0bc106844146f0011210278baa4200080bc006842146f0011210178bab84214c60c04946f0011200578ba8d61046f0011200578ba9d10b46f0011200578baad10646f0011200578babd93446000400848014400048460004005800004cb420442fffc540108802b62046300400b42058108010b62004018008804342003009140180080431002042319809143100204610040058108124b441b6819c0cb440b680b441b64144277000b42040108804b62046f0011200078ba9c0194610040004208049463fff0058318fff40210c024457700040211404142080494600041004100146581080141410014646f0011200078ba8c0194610040004208049463f00ff58318fff4650770040210c02402114041420804946000410041001465810800a1410014646f0011200078baac80646f0011200078babc01646100400042080494657000094949244402114041420804980010410004a9224944c581080071410004aec0c3a6f9c84dd9e92003a6f9cbceffc9649b440b4c0b4e0e625e9139c04b460927f46f0011210378ba5b46046f0011210378ba6b420922846f0011210178ba7969084024c20003de643e806c20b84a14c22c088d51e84a3d25e84a44c22c082d57b46f0011200078ba546f0011200178ba646f0011200278ba746f0008b58f78bf8dd2f46f0008958f78ba4dd2fd56946f0011200078ba546f0011200178ba646f0011200278ba746f0008b58f78bf8dd2f46f0008958f78b30dd2fd55246f0011200078ba546f0011200178ba646f0011200278ba746f0008b58f78bf8dd2f46f0008958f78ba4dd2f46f0008958f78cecdd2f46f0008958f78b30dd2f46f0008958f78b78dd2f46f0008958f78f90dd2fd52792c892f097b097f88007802646f0008958f78d94dd2fce0a80078026844146f0008a58f78750dd2fd51246f0011200278bb28026800746f0008958f78ebcdd2fd50646f0008958f78cecdd2f8400ec043a6f9c84dd9e3a6fa0bceff884c08460501f8007844144000138aec8b6df4670008758738f2446f0005158f780f0dd2f805f4410003880064be01c01003f8007b41f461fff0f58108fff5431800f400004024031c00840318004b67f80438006441000384660008758630f884be01801805f4410003884014be01c01003f8007b41f461fff0f58108fff5431800f400004024031c00840318004b67f8043441000388401811f4be01801ec083a6fa084dd9e3a6faabceffc8040b500b4e0a25180c0923046f0011210178bb2b42284a146f0011210178bb4b422922846f0011210178bb3b402b522b422b5424210e40bd9404640041180a65013000c50330008b46305c08000044200470de280044610011958108a4815e08000887cb4424221640947c0400040217004a889b445a88ce264e80a9adc5031d8efc31b441003e840118477d50c50122710e261e912524258f098e3440003e8401180774600011958000e7846f0008058f78ea8dd2fd53c92109600501000209648e624e8095400000f46f0008a58f78c78dd2fd52d4205680b844046f0011210278bacc00384e1d50392e897f84204e00b84614c01c00d500300085013000cb400b42146f0008758f784e4dd2f8cd0b466540400ff8027844046f0008458f78018dd2f842146f0011210178b948400ec043a6faa84dd9e92003bfffcbceffc4600011958000e784610008c5810816c844046f0008058f78c80dd2fec043bfffc84dd9e92003bfffcbceffc441000144600011958000a4846f0008c58f78000dd2f84208041840f46f0008458f78714dd2fec043bfffc84dd9e3a6faabcefb44610011158108f84548000ff3a0084004620011158210f7cf090121f80223a0104004620011158210f74f08e121f801e3a01040051cf8030b61c121e0002462004104635850458318840507f801c04a10109143101094690005a589483c484204420001480074be02401a7baa73ba4fba6bc0003801292c795b75442001f926e4031b808542100035454007f584200404053140459e1001c4060100995b458318018af3b8481508f8004af7a11e38004af3dacfb1063801284204420001880084be02401004400000034000154420003584200085831800110440000103400014660005a58630384501f80408446500f8008dd26501f80388446500f800edd26803c8446500f8014dd264620041004310101441fff1f40318402143101014600041d802744200014dd264600041d80285800001444200018dd26460004118424a8414600041058000410b420810058108004b62084c04670008758738f04b428840a54108040c1089db14be01c0197b1445003e8def546100411460004108440a88914a00109ec4c3a6faa84dd9e3a6faabcef644610011158108f689600f0813a008800503f80803a018424f001ac98e60fe80946f0011200178ba984a1d90a4800065446f0011200178ba884a14c12864d4620011200510bacf001d014842046f00112141782fd46f00112141782fa46f00112141782fb46f00112141782fc10010bac463004128420502f808c58318720f184ac52b622f382f189f187f1868381d502878146100411041080ecf1854fc3009946100411042080ed541100205421003fc10350217fc046100411041080ec5410803f98514e1400048420d502964846f00112042782faca0646f00112043782fbc309e241e90746f00112042782fbe222e8d054208003e442e935462001125ef08078e9064430007f143102fad50d50308008143102fae424e807844046f00112142782fbd5069e4c46f00112141782fbf0054470003f5450003f50828004501280085c3400405c60804040838c1a845f846284014013981a9f6cf28af38bf08cd52e462001125ef0807ce9064430007f143102fad50c9ccc143102fae428e807844046f00112142782fbd5068e2846f00112141782fbf2054430003f5411003f9d4c5c4280404051901a841e8461845ff38af08bf28c5080fffc8e28f0054030180994de40528c04f58d480000a246100411042080ea541100205421003fc10350217fc046100411041080ec92285410803f98514e1400048420d502964846f00112042782fcca0646f00112043782fdc30ae241e90846f00112042782fde2224ef2055a54208003e442e936462001125ef08078e9064430007f143102fcd50d50308008143102fce424e807844046f00112142782fdd5069e4c46f00112141782fdf3054470003f4011a0095450803f9d2c501280085c3200405c60804040438c1a841f844284614013981a9f6cf08af28bf38cd52f462001125ef0807ce9064430007f143102fcd50c9ccc143102fce428e807844046f00112142782fdd5068e2846f00112141782fdf0054430003f401020095410803f9d4c5c4280404051901a8441847e841ff28af38bf08c9f0c8e28f205440fc0ff40822008403100024042a00840420c04f48d4010a00840840c0440308c04f38e148f800f460004114660008858630080580000044be0180146000411580003444be0180146600411a131843340320402a8f180e6044380d18126403220094031a008143380d184e046a0008758a50f04046480809df997b4840ac6084be0280144500bb8dff64800021b467004124690008758948f040413804c9db1840ac1084be0240144500bb8def748000209460004114660008858630080580003b0dd26f102442f1fffb4814600041240320802b66158000320dd26464004124600041258000704044200c8dd264600041258000708dd2644001328dd26f301e66fe8154fc3000b46500411464001c05852832858420020d51d46500411464001c05852832858420080d5144fc3000b46500411464001c05852832858420010d50946500411464001c05852832858420040b68546000412467004125800000446f0008858f78080dd2fa1b954430010cc0458330010a8f9460004125800012446f0008858f78080dd2f46400412443ff57c143200494660008758630fc4f0014670008758738f88e60fe845801c8420dd26801c8424dd26801c44100010dd26801c44100044dd26801c44100210dd26801c44100264dd26801c44100114dd26462a005658210f538420801cdd2784244424012c801cdd2746230cf05821000644100010801cdd27462025125821001644100044801cdd27462000b958210e9e44100210801cdd2746200888801c44100264d5528420801cdd26801c8424dd26801c44100010dd26801c441002a8dd26801c44100210dd26801c44100254dd26801c44100260dd26801c44100114dd26462a005658210f578420801cdd27842444240123801cdd27462304f05821000644100010801cdd27462014ec58210d28441002a8801cdd27462000b958210e9e44100210801cdd27462364555821077744100254801cdd27462663ca801c5821058f44100260dd27462008044410011458210081801cdd274660008858630080440013b84be01801440013bc4be0180146600411044300ef403e7c0840319004143300ef8425f18815cf8003049f8006850284a24c82c00846200411f305143100ecd53584a34c82c00cf107f30c46200411f00f40908c00140100ecd51884a44c82c00cf307f00b46200411582103b040918000f10ed50af307f00a46200411f10d582103b040918000b6224e94000946300411583183b844200010d50746300411583183b858248010b643f201e64fe80d463004124420111046400412142181c1584207088440d50d4630041244200d0d46400412142181c15842070844200808b644460004125800071446f0008858f78080dd2ff303cb0646200412143101c5d5074630041244200081142181c5f0034410029846f0008758f78fc4dd2f460004115800028046f0008858f78080dd2ff003846044100298502f8094f3a546f0008758f78f24dd2ff325926294daf003804344100298f3a546f0008758f78f88dd2f4630041144200030142180a084a24c82c008840746f0008c58f781a0dd2f4670041184c0041380809db1964c840ac10a46f0008758f78f04dd2f445003e8def3d5114660041280e10413004c9df9840ac11546f0008758f78f04dd2f445003e8dff446f0008858f78020dd2f46f0008858f780acdd2f4800028b84a24c82c00a46100411041080ef5410800ff18781218540149f8006049f800884e5838a500f808038101c00463000b04020a008f00340108c04402088044410021046f0008758f78f88dd2f46200411842880a246380008808246600412a8514410210515c1000114328099462004121432009a141301c658210724b4224603800f58000fff40108002b622f103c91a84a44c82801084a54c82801184a34c82800646302000b422d52146042000b422d52346306000b422d51946046000b422d51b84a44c82801084a54c82801384a34c82800646382000b422d508460c2000b422d50a46386000b42240108c04d506460c6000b42240108004b62280468421a85415c1000446341006f1025831800ab66184c0f2029db1b422840a5410a000c10946f0008758f78f04dd2f44500064def246300412804346101fc015c181c6141101c98022041081ca96485ef08050e8069df9e4ea4ef3ff67d52d5ef080a1e9059ff94e74ff60d52684254025043684a4d9028d2684a54ca2801e800946f0008958f78a9cdd2f806084a1db11149f8008049f8006504f808c542480ff38322008e649e911842038122008d50d8d4148ffff3a8460502f808c149f800838312008049f80068d0184264c80fe4505cf8003149f8006501f808c4fc30051a648c90a46200412802215c101c944200fff142081cb001f808dc90c46200412802244310000143101c944200fff142081cb001f808ec90c46200412463020008022143101c944200fff142081cb001f808fc90c46200412463020108022143101c944200fff142081cb001f8090c90c46200412463060008022143101c944200fff142081cb001f8091c95f46200412463060104610041258210724d551a648c90c46200412802244320000143101c944200fff142081cb001f808dc90c46200412802244310000143101c944230fff142081cb001f808ec90c46200412463020208022143101c944200fff142081cb001f808fc90c46200412463020308022143101c944200fff142081cb001f8090c90c46200412463060208022143101c944200fff142081cb001f8091c90e46200412463060304610041258210724b66244200fff142081cb4650011158528f283a028c04506f804080864670041281273a020c245873872483c685023a028c04854a3a020c243a028c043a020c243a028c003a020c20b407462f800f58210fff400008028464b6074c81801c84054c80002584234c80800c4fc3000646202000b407d52046302020b407d5224fc3000646102010b407d50e46202030b407d5124fc3000646306000b407d51246106020b40740000404d50e4fc3000846206010b40740000804d50646306030b40740000c04b607809eb4a7846040019404b607040481caa660968050217f80421104244e26000544100080d5054010a8565010808092084000200840008004462010004414000098d9140481ca9d214c317fdf8d0184664c81ff99f001e60fe805802744200c0cd51cf20150117fdc9648e62de802d507f3015011ffcc9648e62de805802744202222d50bf00150107f9e9648e631e802d501802744201818b641501f808c4fc30013a688ca20a689ca1ea68aca1ca68bca1aa68cca18a68df00984214000881af089d511a688ca0fa689ca0da68aca0ba68bca09a68cca07a68df30484214030881af384f00984214c00c00df2044c20400af302440f9fffb42340108002b623d50cf202443f9fffb42240108c02b622b4224210bc08b62246f0008858f78020dd2f46f0008858f780acdd2f4fc2f9e0ec9c3a6faa84dd9e92003a6faabcef34464001125842003c96009648f085f1873a020400969096d84640011258420024f0ae121f805ef289f3863a020c04505f807c466001125863001c468001125884000451ef80643a028c24500f804c47c0011159ce0ffc46a0011158a50fd44670008758738fc4f0813a02040080453a010420501f8094b63f3a0304004640011158420fe4f0ac121f805a3a040c0446900088589480804660008758630f883a0f0c243a0404003a0f04203a0e0400f0aa121f80563a020c04f5013a028c243a0204003a0284203a05080046f00111044783f8b47f405240093a01882044100244105f80c6124f8062f005dd2746000412580007004be0240146000412580000044be024014640041244500042a961f507c577f0058420dd27f005462a0056582106578420dd26f00544100010dd27f005462380705821000644100010dd26f00544100114dd27f005462004085821029544100114dd26f00544100130dd27f0054620a890582103bc44100130dd26f00544100210dd27f0054420b8b844100210dd264640041084a8145201484410020cf0054690008758948f24dd27f005462004f04410020cdd26f00544100200dd27f005462050805821040f44100200dd2684e0506f80c04680008758840f04f0054410020080464be02401f1309df95410840097f98405c1064be02001445003e8dfef4640041084a214520148d57df005f1074690008758948f24dd27f107f005462a005658210e53dd26f00544100010dd27f005462380705821000644100010dd26f00544100114dd27f005462004085821029544100114dd26f00544100130dd27f0054620a890582103bc44100130dd26f00544100210dd27f0054420a4a444100210dd264640041084a8145201484410020cf0054680008758840f04dd27f005462004f04410020cdd26f00544100200dd27f005462050805821040f44100200dd26f707506f80c0f0054410020080464be02401f1309df95410840097f98405c1064be02001445003e8dfef4640041084a2145201488420f00546f0008858f78f9cdd2f46000412466000885863008058000088dd264600041258000300dd264640041284e08521810414920004a9e480a484821444002244407408144280c04600041158000004dd26464004115842000484a8b6e4b6a4b6e45002107cdd264640041244530001145200204600041258000084dd264640041244520000145200214600041258000718dd26464004124654000258528101145201c6460004125800073cdd264640041246580000145201cf4600041258000714dd264600041258000934dd264600041258000704dd264600041258000980dd26f3054608000040a1f8085800001246900412810980a84664802059c1808040a500045863000c808515c481c514a4024d1462826044500060145203040462030580a45863000c1462030544410000144281c084054660008758630f044be01801f106460092f54030f008580009049e4246500412400180044011840458528774f08af788f18bf586504f8034505f80a0f3074e32019f46f0011200778ba84660005a586303844e7300cbf584f4838005501f80b88446dd26f003501f807c44200018dd264680041204af800505cf8009f504f4034690008758948f884fc3002338229c0044110100f483f584949440210404800a441002444be02401f403460092f538321e024023f008461004125800090240210004143401c1142081daf504d515f483f5844410024444210180800a4be0240144100a0a141401c146200412f10b141101daf504f40384c0440001f4f483f58446f0008758f78f04dd2ff1069db1b40197b154000008f403f504c005443027104c61ffec8405f483f5844660041246f0008758f78f04dd2f461092f55810890058630768b626840546f0008758f78f04dd2ff403f5044fc3000c460092f54013f0085800090440108004b626d504f10a84eab62684c0440001f4f483f58446f0008758f78f04dd2ff1069db1b40197b154000008f403f504c005443027104c61ffec8405f483f58446f0008758f78f04dd2f46200412461092f5581089008062141101da8421a85c8420a85c84059df946f0008758f78f04dd2ff403f504e6e64ef3ff54480001c3f584f4838005501f80b08446dd26f003501f806444200018dd264680041204af800505cf8009f504f40384e04690008758948f884fc3002338229c0044110100f483f584949440210404800a441002444be02401f403460092f538321e024023f008461004125800090240210004143401c1142081daf504d515f483f5844410024444210180800a4be0240144100a0a141401c146200412f10b141101daf504f40384c0440001f4f483f58446f0008758f78f04dd2ff1069db1b40197b154000008f403f504c005443027104c61ffec8405f483f5844660041246f0008758f78f04dd2f461092f55810890058630768b626840546f0008758f78f04dd2ff403f5044fc3000c460092f54013f0085800090440108004b626d504f10a84eab62684c0440001f4f483f58446f0008758f78f04dd2ff1069db1b40197b154000008f403f504c005443027104c61ffec8405f483f58446f0008758f78f04dd2f46200412461092f5581089008062141101da8421a85c8420a85c84059df946f0008758f78f04dd2ff403f504e6e64ef3ff54480000f946f0011200178ba94660005a58630384c978f584f4838005501f80a88446dd26f003501f804c44200018dd26f40347c0041246800412049f8007f5045884076881443822a40044110100f00594944021040444100244f483f58446f0008758f78f88dd2f460092f5b46a4074f0085800090240138004143e01c1b62884c0f504f403f1069db1b40197b1541000088405c10ef483f58446f0008758f78f04dd2f440003e8f403f5044c607fed463092f5583189049e5c40238c04b628b64884c0f1069db1b40197b1541000088405c10ef483f58446f0008758f78f04dd2f440003e8f403f5044c607fed461092f558108900b6288d2184268d444c90ffa4d578f584f4838005501f80c48443dd26f003501f8094844cdd26f40347c0041246800412049f8007f5045884076881443822a40044310100f005949440210c0444100244f483f58446f0008758f78f88dd2f50148003460092f5b46a4070f0085800090240238004143e01c1b64884c0f504f403f1069db1b40197b1541000088405c10ef483f58446f0008758f78f04dd2f440003e8f403f5044c607fed463092f5583189049e9c40138c04b648b62884c0f1069db1b40197b1541000088405c10ef483f58446f0008758f78f04dd2f440003e8f403f5044c607fed461092f558108900b6288d2184238d444c90ffa2f30884029cd9f3884c307d6546800088588400ac46f0008858f78020dd2f4be02001460004115800000446f0008858f78080dd2f461004115810800484e08468b6e1b661b6e1466004124be020018401a83446f0008758f78f04dd2fa9f4f109c923f30584a1db2046000412041001da46f00119141782a846000412580007804630011958318aa0465ffbedb440984358528884984db641461004129c04581087d44c00ffefeccc3a6faa84dd9e92003a6faabcef0c46400112584200c0960096489690f087f188f28a3a020800505f80cc46400112584200b83a028424508f80d846700112587380b03a02040096d83a04042046400112584200883a038400507f8058aea8f38bf0b8121400063a020c048387505f807c506f809c47e0011259ef00683a0e0c24500f80b44670008758738fc44680008758840f88f0813a020c04f583f6823a0e0c24466000885863008046f0011204a7802b80be3a028c0440954009b484109f80eeb69cf40312af80763a020c243a028c003a020c2046400112584200503a020c04f5023a028c2446300112583180443a0204003a0284203a018800f5013a02882044100244f007dd2746000412580007004be0180146000412580000044be018014640041244500042a961f608c677f0078420dd27f007462a0056582106578420dd28f00744100010dd27f007462380705821000644100010dd28f00744100114dd27f007462004085821029544100114dd28f00744100130dd27f0074620ab90582103bc44100130dd28f00744100210dd27f0074420a8a844100210dd284640041084a8145201484410020cf007506f80e8dd27f007462004f04410020cdd28f00744100200dd27f007462050805821040f44100200dd2884e04690008758948f244680008758840f04f0074410020080464be02401f13a9df95410840097f98405c1064be02001445003e8dfef4640041084a214520148d57df007f108506f80e8dd27f108f007462a005658210e53dd28f00744100010dd27f007462380705821000644100010dd28f00744100114dd27f007462004085821029544100114dd28f00744100130dd27f0074620a890582103bc44100130dd28f00744100210dd27f0074420b8b844100210dd284640041084a8145201484410020cf0074690008758948f24dd27f007462004f04410020cdd28f00744100200dd27f007462050805821040f44100200dd28f7084680008758840f04f0074410020080464be02401f13a9df95410840097f98405c1064be02001445003e8dfef4640041084a2145201488421f00746f0008858f78f9cdd2f46400412846084a1a96446000412a8e4f385467000885873808058000088dd274600041258000300468004128120dd2784c2442074081464002246000411b64958000004dd274600041258000704dd274600041258000080dd274600041258000084dd2746500412f589f305f0094640041158420004844858000080f089b664b644b6641464002244607408b6c944030001f60983c5838546a4000246180000b606b664b644b6644442000058a50101144f00214600041214ae01c6141281cff286f38558000714dd274600041258000934dd27f007461800004690041240a07808810980a84674801058108012808540a504045873800659c0008015c481c514a4024d1472826044510000145201c0f508f206f3054e52010af00b46f0011200478ba840607008508f80c04670005a58738384509f8034cc7df486501f80cc84498008dd27501f8058800944200024dd27461092f55810890140130404f40646a00412838af18880c44680008758840f88f20aca2e503f80c03821980044510100f007949440211404441002444be0200138049a02140501c1e6c6e80c462092f540037008582109014610041240000804d50c9c33463092f540007008583189014610041240000c04140081dad513f00744100244442101804be0200144000404140501c146100412f508145081da4460006484e0041e01dd9df95410800897f98405c10946f0008758f78f04dd2f44502710dff19db146100412462092f55821090097b1142081dae6c9e9a34800012cf385501f80d88008dd278009501f807c44200020dd27465092f55852890140531404f30546a00412838af58880c34680008758840f88f00ac82f501f80c03820980044310100f007949440210c04441002444be0200138049a02140501c1e6c5e80d9c31465092f540007008585289014610041240001404d50c9c34462092f540007008582109014610041240000804140081dad513f00744100244442101804be0200144000404140500000000";
+// Firmware writes queued on the pipe at once, FirmwareUploadDepth overrides it
+#define FIRMWARE_UPLOAD_DEPTH       4
+#define FIRMWARE_UPLOAD_MAXDEPTH    16
+// Packets per firmware write, so that only the last write of a block is short
+#define FIRMWARE_SEGMENT_PACKETS    4
+// Milliseconds a single block may take before it's abandoned
+#define FIRMWARE_UPLOAD_TIMEOUT     2000
 
-constexpr static const char firmware5[] = "780d001001c146100412f308143081da4460006484e0041e01dd9df95410800897f98405c10946f0008758f78f04dd2f44502710dff19db146100412462092f55821090097b1142081dae6c8e9a2480000b046f0011200278ba9508f80c04670005a58738384509f8034ca52501f80e084468008dd2746300412f3898009501f809c44200018dd27f50946a0041258528704838af608f5894680008758840f04500f80c03820180044110100f0079494402104044410024446f0008758f78f88dd2f465092f5b449f009401370085852890140109404b640141501da84e0041e01dd9df95410800897f98405c1064be0200144502710dff4461092f5581089009db184a6141501da8d24decbd551501f80ec84438008dd2746300412f3898009501f80b4844cdd27f50946a0041258528704838af608f5894680008758840f04500f80c03820180044110100f0079494402104044410024446f0008758f78f88dd2f9c73465092f5b449f0094010f0085852890140109404b640141501da84e0041e01dd9df95410800897f98405c1064be0200144502710dff4461092f5581089009db184a3141501da8d24deca460004128421a8448420a844840546f0008758f78f04dd2f4600041284e01470026046800088588400ac46f0008858f78020dd2f4be02001460004115800000446f0008858f78080dd2f46000411580000048428b6e0b620b6e0466004124be020018401a83446f0008758f78f04dd2fa9f4ecf43a6faa84dd9e3a6fa0bc96498040e624e8048401480000ea46400412466004114638000880a6b420447ff57c0482004914720049143300991432809a84664c118059e627e81484634c118035e624e80884414c11002284624c11c0bad52484044c10003884654c11c0b3d53a840b4c100079e62ce80884674c11804c84084c1040a7d558846c4c118082440000ff4c10409f4800008f46f0008b58f78f54dd2f4800009646f0008858f780ecdd2f4800008f9c84b4c246f0008a58f78140dd2f963046f0008958f78920dd2f480000809c94b4e246600088586301b0d55d9c94b402960046f0008858f78a28dd2fd56f46f0008a58f78140dd2f4660008858630c4484004be0180184014be01801d55f9c94b4e246f0008a58f78140dd2f97f884008027804080604660008d58630a58d5119c94b4e246f0008a58f78140dd2f97f884008027804080604660008d58630018dd268440802784018062dd26d53746600410586300409c94b402b4e6b426442fff3f40108802b626960046f0008c58f78334dd2fb6e6d5229c94b4e2466000895863023897f846f0008a58f78140dd2f80278400dd2680278401dd26d50f9c94b402b422b44292284200400b9648969446f0008a58f78190dd2f46400411804446380008461004128400140200991431009a148080493a6fa084dd9e3bfffcbceff4848796c08428801fb69ff38146f0008e58f78264dd2f440003e846f0008758f78f04dd2f8400ec0c3bfffc84dd9e3bfffcbceff4846897008023801ff481b67f46f0008e58f78264dd2f440003e846f0008758f78f04dd2f8400ec0c3bfffc84dd9e3bfffcbceff4848c96c08428801fb69ff38146f0008e58f78264dd2f440003e846f0008758f78f04dd2f8400ec0c3bfffc84dd9e3bfffcbceff48446500f80048424f28146f0008e58f78264dd2f8400ec0c3bfffc84dd9e3bfffcbceff4848396c08428801fb69ff38146f0008e58f78264dd2f8400ec0c3bfffc84dd9e92003a6faabceffc460004004615c1fe58108e80141000470420004a443f0fff40210c021420004a80200420806e464fff7f58420fff402110021420806e0410006f46700100401090021410006f468000005884063c46f0008758f78898dd2f0423805184038421dd2246f0008058f7800cdd2f46f0008558f789fcdd2f46f0008558f78a40dd2f461004100420820140212008924814208201840a84204be020014660008058630c1c840c46100080581080f84be01801840d46100080581080a84be01801840f4610008558108f444be01801840784204be02001461000805810827c4620008e58210da846800000588407ac84074be02001466000005863068484074be018014620008e58210da84610008058108b80840a4be02001840a4be01801840246f0008158f78070dd2f46f0008058f78088dd2f840046f0000258f786d4dd2f804046f0011210278ba38020840046f0000358f78120dd2f462000865821008046f0010e142780b046000086580000d446f0005758f782e0dd2f462000865821040046f0010014278054462000865821026846f00100142780424660003458630f7c84014be01801844546f00101142781ca84014be018010423805184028420dd2246f0008b58f78a7cdd2f46f0008b58f78a3cdd2f460004000420008c8020582100011420008c84001400808f4670011b5873858046f0008c58f78140dd2f47c0008159ce02b046a0008458a50484840246f0000258f78cf4dd2f80c046f0000258f7873cdd2fa0b24430006d81004c21c01e46f0011200078b9c84a1d80f461004000410807054108800c9088404804146f0008458f78714dd2f44109c4040040437461004001400808ea17244000067d816468000865884096484004be0200184214c00800780014be0200184a1d807840146f0008758f78528dd2fa0f2445000644c32c1b646f00112040782df84a14c02c0f5a0334e0300f246f0011200178ba2c9184600041104200043582101411420004300038ac8d876442008c14600011a5800057846f0005a58f783c4dd2fd56a460004110400004446f00112041782f846f00112140782f94c00c004841fd5029a0146f0011200278ba24610011a58108ea09e9138308a02842c404020089288421104244031e00898e34640011c58420050984cb66184634610041142210c240440804d4630011c583180509c513841860a461004110410805000438ac89c9284a138118a0adc264680011a002405785cf10020e81f4430006442108c244630011a5831857940108017440000464221002446000119580002909893964846f0008358f78720dd2f000405789c011004057846800112842000040bcc804146f0008a58f78750dd2f040402f3e60fe808840046f0008b58f78584dd2fd50d4610008b581085845cf00064e8038401d50284024be0040146f0011200178ba246f00112040782f4e220e94000138ac8844046f00112142782dfc90b46000410042002034640300040211004142002034600041004200106445dff7f4021140214200106c11a4600011a5800057846f0008258f78fccdd2f46f0008458f78898dd2f4600011b58000568842146f0008058f78ea8dd2fd50a46f00112040782f346f0008558f78fd8dd2f46f00112040782df84214c00c0b5a0b34c2040b246f0011200178ba2c9184600041104300043583181411430004300038ac84c01400d4600011a58000578442008c146f0005a58f783c4dd2f4680011246f00112040782f400140ba2e2204ef2008b4400008c46f0000258f78750dd2f00040ba24690011a58948ea03804820046f0008558f78f54dd2f00038ac884a1d815842046000119580002904420005c46f0005a58f783c4dd2f00140ba23814860046f00119101782914690011200048ba24680011a58840ea0380402008420804146f0008a58f78750dd2f00048ba238040200e60fe808840046f0008b58f78584dd2fd50d4610008b581085845cf00064e8038401d50284024be00401460004110420004446f0011200178ba246f00112142782f8846342308c240440004d4620011c582100509c193841020a46000411040000509cda38010e0a4600011a58000ea0380006024e05000746f0008558f78f9cdd2f4600011200100ba29c4910100ba2a03244500071d87646700000587386c0840a4be01c0184074be01c01461004000420810642211c09142081068001041000854210b00914100085467004005873820cb507840a58140010b62746f0000258f78750dd2f42841009b70746f0010100378a089ed946f0011200178ba346f0010110378a08840046f0000358f78184dd2f842046f0010010178302460004000420008c422100091420008c4610000058108a2c4620008e58210da8840a46f0000058f787acdd2f840a46f0000058f78684dd2f46f0008158f78028dd2f46100101002085ab80069e91102085ab46f0000258f78a30dd2f8400ec043a6faa84dd9e84a1d80646f0008058f78d90dd2f46f0008658f78614dd2f4690008158948488d516dd3c810080204600011b580005804be02801c80c0004001a4650011a585282189404802898054be02401041381704600011b58000b38c9e5800646f0000258f78a30dd2f48fffd54776966692f52414d2f6472697665722f6663652f6663652e63000000776966692f52414d2f6472697665722f70646d612f70646d612e6300535720525459206661696c00776966692f52414d2f706572692f6d637563746c2f6d637563746c2e63000000776966692f52414d2f6170692f636e6d5f74696d65722e6300000000776966692f52414d2f6170692f636e6d5f74696d65722e6800000000776966692f52414d2f6170692f70646d615f71756575652e63000000776966692f52414d2f6170692f706b745f71756575652e6300000000776966692f52414d2f6170692f6c6973742e6300776966692f52414d2f6170692f74786d5f64697370617463682e63004e554c4c000000006e6f6e650a00000000000000";
+// Milliseconds a bring-up control transfer may take, and how often it's tried
+#define ONE_STEP_TIMEOUT            500
+#define ONE_STEP_ATTEMPTS           3
+// Milliseconds to wait before trying a step again
+#define ONE_STEP_RETRY_DELAY        100
 
-constexpr static const char firmware6[] = "a0230010803e803e204e007d0000000048000000c800000044000000c400000044010000c401000044020000840200000100b700c4000000777755338faa1166101f1f3f17000000170000003a3a0f0000609c0f05070000777744338faa336600f333030200c800d8000000777755338faa1166101f1f3f17000000170000003a3a0f0000609c0f05070000777744228faa33aa00f333030300200032000000777745338faa1166101f1f3f16000000170000003a3a0f0000609c0f05070000777733228faa66aa00f333030400340044000000777744338faa3366101f1f3f16000000160000003a3a0f0000609c0f05070000777733218faa66af00f333030500640074000000775744338faa33661010103f14000000140000003a3a0f0000607c2f05070000654622218faaaaaf00f30303060078008c000000774633338faa6666100f0f3f13000000130000003a3a0f0000607c2b05070000643522108faaaaff0083f30207009500a5000000653433338faa6666100f0f3f12000000120000003a3a0f0000607c2b05070000320322108faaaaff0083f3020400000004204100520000003400000004204100520000000500000004204100d20000003500000004204100d20000000900000004204100da0000003900000004204100da0000003000000000234100081400000400000000234100003400003400000000234100083400003100000000234100081400000500000000234100003400003500000000234100083400000900000000234100007400003900000000234100087400000400000004234100020000003400000004234100020000000500000004234100020000003500000004234100020000000900000008234100707000003900000008234100707000000500000010234100509de8153500000010234100509de81509000000102341004e9be71539000000102341004e9be7150500000014234100509de8153500000014234100509de81509000000142341004e9be71539000000142341004e9be7150900000018234100020200003900000018234100020200000400000020234100fa5c421e3400000020234100fa5c421e0500000020234100fa5a421e3500000020234100fa5a421e0900000020234100fa58421e3900000020234100fa58421e0400000024234100fa5c421e3400000024234100fa5c421e0500000024234100fa5a421e3500000024234100fa5a421e0900000024234100fa58421e3900000024234100fa58421e0000000030234100f30005083000000030234100f30005080100000030234100f30005073100000030234100f3000507040000003423410008040a04340000003423410008040a0401000000342341000b080a0431000000342341000b080a04050000003423410008040a04350000003423410008040a04090000003423410005030a04390000003423410005030a04090000008c23410014101010390000008c2341001410101004000000a423410032232e2e34000000a423410032232e2e05000000a423410032232e2e35000000a423410032232e2e09000000a423410026221c1c39000000a423410026221c1c09000000ac2341001717161639000000ac2341001717161604000000002641004100000034000000002641004100000001000000002641008000000031000000002641008000000005000000002641008100000035000000002641008100000009000000002641008200000039000000002641008200000004000000042641000b00030034000000042641000b00030001000000042641000b0f030031000000042641000b0f030005000000042641000b2c010035000000042641000b2c010009000000042641000b3c000039000000042641000b3c0000040000000c26410087001000340000000c264100870010000100000014264100f4a7ab003100000014264100f4a7ab000500000014264100f5a7ab003500000014264100f5a7ab000900000014264100f6a7ab003900000014264100f6a7ab00010000001c26410000040e00310000001c26410000040e00050000001c26410000041800350000001c26410000041800090000001c26410000042000390000001c2641000004200005000000342941009205000035000000342941009205000001000000402941001e38000131000000402941001e38000105000000402941001e38000135000000402941001e380001090000004829410091a900f0390000004829410091a900f0090000004c294100f99ffff9390000004c294100f99ffff904000000ac2941000200000034000000ac2941000200000005000000ac2941000200000035000000ac2941000200000000000000102341004ea5f31530000000102341004ea5f31504000000102341004ea4f31534000000102341004ea4f31501000000102341005ba6f31531000000102341005ba6f31505000000102341005ba8f31535000000102341005ba8f31509000000102341005ba8f31539000000102341005ba8f31500000000142341004ea5f31530000000142341004ea5f31504000000142341004ea4f31534000000142341004ea4f31501000000142341005ba6f31531000000142341005ba6f31505000000142341005ba8f31535000000142341005ba8f31509000000142341005ba8f31539000000142341005ba8f31500000000182341001010ff0030000000182341001010ff0004000000182341001010ff0034000000182341001010ff0001000000182341001010ff0031000000182341001010ff0005000000182341001010ff0035000000182341001010ff0009000000182341001010ff0039000000182341001010ff000000000020234100f84a360f3000000020234100f84a360f0400000020234100f84836183400000020234100f84836180100000020234100f84a36183100000020234100f84a36180500000020234100f84836183500000020234100f84836180900000020234100f84836183900000020234100f84836180000000024234100f84a360f3000000024234100f84a360f0400000024234100f84836183400000024234100f84836180100000024234100f84a36183100000024234100f84a36180500000024234100f84836183500000024234100f84836180900000024234100f84836183900000024234100f8483618010000006823410004207c00310000006823410004207c0000000000ec234100960e9eba30000000ec234100960e9eba04000000ec234100960e9eba34000000ec234100960e9eba01000000ec234100960e9eba31000000ec234100960e9eba05000000ec234100960e9eba35000000ec234100960e9eba09000000ec234100960e9eba39000000ec234100960e9eba01000000451c0000500000006666060002000000541c0000500000001111090003000000631c000050000000bbbb0b0004000000721c00005000000066660e0005000000811c0000510000001111010006000000901c000051000000bbbb0300070000009f1c0000510000006666060008000000ae1c0000510000001111090009000000bd1c000051000000bbbb0b000a000000cc1c00005100000066660e000b000000db1c000052000000111101000c000000ea1c000052000000bbbb03000d000000f91c000052000000666606000e0000001d1d000052000000cccc0c00220000004c1e000056000000aaaa0200240000005b1e0000560000005555050025000000631e000056000000aaaa0600260000006a1e0000560000000000080027000000721e0000560000005555090028000000791e000056000000aaaa0a0029000000811e00005600000000000c002a000000881e00005600000055550d002b000000901e000056000000aaaa0e002c000000971e000057000000000000002d0000009f1e000057000000555501002e000000a61e000057000000aaaa02002f000000ae1e0000570000000000040030000000b51e0000570000005555050031000000bd1e000057000000aaaa060032000000c41e0000570000000000080033000000cc1e0000570000005555090034000000d31e000057000000aaaa0a0035000000db1e00005700000000000c0036000000e21e00005700000055550d0037000000ea1e000057000000aaaa0e0038000000f11e0000580000000000000039000000f91e000058000000555501003a000000001f000058000000aaaa02003b000000081f000058000000000004003c0000000f1f000058000000555505003d000000171f000058000000aaaa06003e0000001e1f000058000000000008003f000000261f00005800000055550900400000002d1f000058000000aaaa0a0041000000351f00005800000000000c00420000003c1f00005800000055550d0043000000441f000058000000aaaa0e00440000004b1f0000590000000000000045000000531f00005900000055550100460000005a1f000059000000aaaa020047000000621f0000590000000000040048000000691f0000590000005555050049000000711f000059000000aaaa06004a000000781f000059000000000008004b000000801f000059000000555509004c000000871f000059000000aaaa0a004d0000008f1f00005900000000000c004e000000961f00005900000055550d004f0000009e1f000059000000aaaa0e0050000000a51f00005a0000000000000051000000ad1f00005a0000005555010052000000b41f00005a000000aaaa020053000000bc1f00005a0000000000040054000000c31f00005a0000005555050055000000cb1f00005a000000aaaa060056000000d21f00005a0000000000080057000000da1f00005a0000005555090058000000e11f00005a000000aaaa0a0059000000e91f00005a00000000000c005a000000f01f00005a00000055550d005b000000f81f00005a000000aaaa0e005c000000ff1f00005b000000000000005d0000000e2000005b000000aaaa02005e000000162000005b000000000004005f0000001d2000005b0000005555050060000000252000005b000000aaaa0600610000002c2000005b0000000000080062000000342000005b0000005555090063000000441f000058000000aaaa0e00640000003b2000005b000000aaaa0a0065000000432000005b00000000000c00660000004a2000005b00000055550d0067000000522000005b000000aaaa0e0068000000592000005c0000000000000069000000612000005c000000555501006a000000682000005c000000aaaa02006b000000702000005c000000000004006c000000772000005c000000555505006d0000007f2000005c000000aaaa06006e000000862000005c000000000008006f0000008e2000005c0000005555090070000000952000005c000000aaaa0a00710000009d2000005c00000000000c0072000000a42000005c00000055550d0073000000ac2000005c000000aaaa0e0074000000b32000005d0000000000000075000000bb2000005d0000005555010076000000c22000005d000000aaaa020077000000ca2000005d0000000000040078000000d12000005d0000005555050079000000d92000005d000000aaaa06007a000000e02000005d000000000008007b000000e82000005d000000555509007c000000ef2000005d000000aaaa0a007d000000f72000005d00000000000c007e000000fe2000005d00000055550d007f000000062100005d000000aaaa0e00800000000d2100005e0000000000000081000000152100005e00000055550100820000001c2100005e000000aaaa020083000000242100005e00000000000400840000002b2100005e0000005555050085000000332100005e000000aaaa0600860000003a2100005e0000000000080087000000422100005e0000005555090088000000492100005e000000aaaa0a0089000000512100005e00000000000c008a000000582100005e00000055550d008b000000602100005e000000aaaa0e008c000000672100005f000000000000008d0000006f2100005f000000555501008e000000762100005f000000aaaa02008f0000007e2100005f0000000000040090000000852100005f00000055550500910000008d2100005f000000aaaa060092000000942100005f00000000000800930000009c2100005f0000005555090094000000a32100005f000000aaaa0a0095000000ab2100005f00000000000c0096000000b22100005f00000055550d0097000000ba2100005f000000aaaa0e0098000000c1210000600000000000000099000000c921000060000000555501009a000000d021000060000000aaaa02009b000000d821000060000000000004009c000000df21000060000000555505009d000000e721000060000000aaaa06009e000000ee21000060000000000008009f000000f62100006000000055550900a0000000fd21000060000000aaaa0a00a1000000052200006000000000000c00a20000000c2200006000000055550d00a30000001422000060000000aaaa0e00a40000001b2200006100000000000000a5000000232200006100000055550100a7000000322200006100000000000400a90000004122000061000000aaaa0600ab000000502200006100000055550900ad0000005f2200006100000000000c00b7000000ce1c000051000000aaaa0e00b8000000d51c00005200000000000000b9000000dd1c00005200000055550100bb000000ec1c00005200000000000400bc000000f31c00005200000055550500bd000000fb1c000052000000aaaa0600c0000000111d000052000000aaaa0a00c40000002f1d00005300000000000000c80000004d1d00005300000055550500cc0000006b1d000053000000aaaa0a00d0000000891d00005400000000000000d4000000a71d00005400000055550500d8000000c51d000054000000aaaa0a00090008000000471009000c004730c711090010004710000009009c021010103f09006c02577750000000a4025f772a2500005401a11ef6ac00004801007c72a900000803007c72a90000580000607c2f0100a4027e772a2609003401803804200100200383688804042f4100012200800c2f4100aabbccdd102f4100eeff0000d82f410000010000042041004200000008204100000003000c2041000a0300032c2141000180de0f002341000014000004234100010000000823410014140000102341004495e715142341004495e715182341004040000020234100fa5e361824234100fa5e361830234100f30005053423410008040a043823410038200f115c2341002c27000064234100000000806823410005207c006c234100cf000000702341000008000078234100060000007c234100e30f000084234100707000008c234100161511119c234100453e3838a42341002e2a2a2aac234100302b2626cc2341001c1c1616d42341002f2a2626dc23410066544040ec234100960ea2ba002441000304e90208244100aa550000042541003a00000014254100000000001c254100800000000026410040000000042641000b0606000c26410007001000102641000700000014264100f403c00018264100000000001c264100000000003026410073777700002741000800000008274100000004011027410000000000182741000000000020274100140000804027410004000000042541001200000014254100ecc477f900284100e000503d342941009204000038294100110456003c2941001c1bf2c8402941001e58000044294100204007004829410091a900c04c294100f99fffb9502941006e00402660294100160000006429410030f08f898829410044440100942941000000e001ac29410028000000d4294100008a0000f029410000000200502c410003000000c42c4100074f0300082341000e0e0000102341004f9de815142341004f9de815182341000404000020234100fa5c361824234100fa5c36183823410038020f1178234100020000007c234100f30f000084234100787800008c23410016111111cc234100ffffffffd4234100ffffffffdc234100ffffffff0824410000000000042541003a00000014254100000000000c26410008000400102641000600000018264100700000004429410021400700d4294100000a0000102741000800000000284100e000508900000000000000000a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a0a8890989a9c9eb8babcbe0000ffffffffffff000000aabbccddee00000011223344550000a8a88800a0a099009898aa009090bb008b8bbb008787bb00060600000909000009090000080800000a0a00000c0c0000270025006500e500e500e50005000400040004000400040006060000060600000808000005070600070700000707000008080000090900000a0a00000a0a00000b0a0908070600000e0e000008080000060600000a0a00000c0c000000000000060d0c080706000008080000080800000c0c00000a0a00000a0a00000a0a00000c0b0a060807000001010000040400000606000004040000060600000606000008080000080800000a0a00000404000006060000080800000a0a00000c0c0000080800000a0a00000c0c000000000000020200000404000006060000080800000a0a000006060000080800000a0a0000080706000b0a0908070600000d0c0b0a090807060c0b0a09080706050400000060002000401f000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000005050101070000000000000000000000000000000700000000000000000000000000000001000000000000000000000000000000400000000000000000000000000000000d0007000a00e803000004000000000000000000546f000096000000050007000d00e80300000100b80b0000e41100000000000019000000050007006400dc0500000100a00f0000e8260000000000003c000000050007000c00e803000001000000000000000000fa19000023000000080007002800e8030000010000000000000000005d2c0100b4000000040007000500f401000002000000000000000000636c000046000000040007001e00e8030000010000000000000000004e380100c800000002000f000a00e80300000100114e00005a860100000000007800000002000f000a00d00700000100ca3000005a860100000000007800000002000f001500d0070000010084130000f0210000000000003200000002000f007c01b80b000004008413000008270000000000003c00000002000f000a002003000001002dc300009c040100000000001e00000002000f000a002003000001000d41000073c30000000000001e000000ff0000000000000000000000000000000000000000000000000000000100000000000a00080010000600d00705000000540b0000487100000500000000000000000000000000000100000000010046002a007e001400881305000000540b0000487100000a00000000000000000000000000000100000000020064002a00a0001400881319000000540b00007427000014000000000000000000000000000001000000000302c800140096008403980832000000e8030000ffc99a3bc800000000000000ffc99a3b000000100000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000200000000000a000a0012000400ff0f05000000781e0000888a01000500000000000000000000000000000100000000010046002a005a001400ff0f0300000024130000888a01000a00000000000000000000000000000100000000020064002a00a0001400ff0f0500000024130000888a010014000000000000000000000000000001000000000303c80014009600c800ff0f6400000024130000f82a0000c80000000000000000000000000000010000000004080000080011000700460002000000f47e0000340f03000a000000000000000000000000000001000000000400000000000a00080010000400d00705000000540b0000084c010005000000000000000000000000000001000000000100460030007e001400881305000000540b0000084c01000a00000000000000000000000000000100000000020064003000a0001400881319000000540b0000084c010014000000000000000000000000000001000000000302c800140096008403980832000000e8030000ffc99a3bc800000000000000ffc99a3b000000100000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000800000000000a00080010000800d00705000000606d0000084c01000a0000000000000100000000000000000000000001002000180040001400d00705000000606d0000084c01000a00000000000001000000000000000000000000020064002a00a0001400d00719000000606d0000084c01000a00000000000001000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000100000000000800020007006a00960005000000540b0000e43801000500000000000000ffffff7f00004001dc13000001000800020007006a008c0005000000d06b0000fc6c00000500000000000000ffffff7f00004001dd1900000200280004002c006000e00196000000540b0000e43801002800000000000000ffffff7f001c4e0ecc12000003023c000f0030008002200820000000904c0000089d000020000000000000000087930300cf7b058912000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000200000000000800020009006a0096000a00000024130000008701000a00000000000000ffffff7f00004001cc1900000100280004002c0060007c019600000024130000008701002800000000000000ffffff7f00004001cc19000002033c0014002e002c0180025000000024130000742700005000000000000000ffffff7f001c4e0edd19000003080800020009006a0096002000000024130000008704002000000000000000ffffff7f00004001cc15000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000800000000000800020009006a00960014000000f06e0000c82c01001400000000000000ffffff7f00004001cc16000001000000000000000000000000000000000000000000000000000000000000000000000000000000000000000200280004002c006000c80096000000f06e0000c82c01003c00000000000000ffffff7f001c4e0ecc16000003000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000102341004394e515142341004394e51520234100f85e421e24234100f85e421e3423410008040d0438234100382e0f116c234100ec000000ac234100302b2626cc2341001c1c1515102341004394e515142341004394e51520234100f860421e24234100f860421e342341000f040d0438234100382e0f116c234100ec000000ac234100302b2626cc2341001c1c151520234100f85a361824234100f85a3618342341000a040a0438234100382e0f116c234100ec000000ac23410028231e1ecc2341001c1c151520234100f85c361824234100f85c3618342341000d080a0438234100382e0f116c234100ec000000ac23410028231e1ecc2341001c1c151520234100f85a421e24234100f85a421e6c234100ec00000020234100f85a421e24234100f85a421e6823410005207c006c234100ec000000a423410028242424ac234100302b262620234100f85a361824234100f85a3618342341000a080a046c234100ec0000007c234100f30f0000a4234100211d1d1dac23410028231e1e6c234100ec0000006823410006207c006c234100ec000000a4234100322e2e2eac2341002a1c2020342341000b080a046c234100ec0000007c234100d30f0000a4234100211d1d1dac234100302b262609005400003a7a290900580000606c2209009402e303e103090098020003030309009c02101f1f2e09007c02270025000900800224006700090084026500640009008802e700e50009008c02e400e70309009002e503e40309003c00c559b5050900a00214141adc0000a4027f4720200100a4027f4720200900a80228ee0e0009005c00a10ab41409004400162055020c000000060000004000000000000000000000000000000001000000000000000000000000000000000000000000000012e514020100010200000003000000000005000000000000";
+// What the bring-up timer is set for
+#define ONE_WAIT_NONE               0
+#define ONE_WAIT_DELAY              1
+#define ONE_WAIT_UPLOAD             2
 
-// Holds data for asynchronous reads
+struct OnePatch;
+struct OneAddressing;
+class OneWirelessController;
 
-typedef struct WaitSignature
+// A controller going through the pairing handshake
+typedef struct OnePairing
 {
-    unsigned char signature[4];
-    IOLock * lock;
-} WaitSignature;
+    bool active;
+    int step;
+    unsigned char controllerId[6];
+    unsigned char adapterId[6];
+} OnePairing;
+
+// Holds data for asynchronous reads, allocated once per endpoint
+typedef struct OneRead
+{
+    IOUSBPipe *pipe;
+    IOBufferMemoryDescriptor *buffer;
+} OneRead;
+
+// Progress of the firmware block being uploaded
+typedef struct FirmwareUpload
+{
+    IOMemoryDescriptor *firmware;
+    IOByteCount length;
+    IOByteCount segment;        // Bytes per write, a multiple of the max packet size
+    IOByteCount issued;         // Bytes handed to the pipe
+    IOByteCount written;        // Bytes the pipe has confirmed
+    int inFlight;
+    bool issuing;               // Someone is queueing writes, keeps them in order
+    IOReturn status;
+    UInt64 start;
+} FirmwareUpload;
 
 
 class OneWirelessGamingReceiver : public IOService
@@ -56,6 +110,7 @@ class OneWirelessGamingReceiver : public IOService
 public:
     bool start(IOService *provider);
     void stop(IOService *provider);
+    void free(void);
     
     IOReturn message(UInt32 type,IOService *provider,void *argument);
     
@@ -63,56 +118,144 @@ public:
     OSNumber* newLocationIDNumber() const;
     
 private:
-    bool QueueWrite(IOUSBPipe *pipe, IOBufferMemoryDescriptor *outBuffer);
+    typedef void (OneWirelessGamingReceiver::*TransactionHandler)(OnePairing *pairing, IOReturn status, const unsigned char *data);
+    
+    // A request waiting for its response, or a timeout
+    typedef struct Transaction
+    {
+        UInt32 signature;
+        UInt64 deadline;
+        TransactionHandler handler;
+        OnePairing *pairing;
+        int next;               // Next in the bucket or the free list, -1 at the end
+    } Transaction;
+    
+    bool QueueWrite(IOUSBPipe *pipe, IOMemoryDescriptor *outBuffer);
     
 private:
-    bool deviceWriteCompleted;
     bool deviceReadCompleted;
     bool started;
     IOUSBDevice *device;
     IOUSBPipe *outDevicePipe;
     IOUSBPipe *inDevicePipe;
     IOUSBPipe *inCPipe;
-    IOLock* pairingLock;
-    WaitSignature* waitLock = NULL;
+    OneRead reads[ONE_READS];
+    IOLock *controllerLock;
+    OneWirelessController *controllers[WIRELESS_CONNECTIONS];
+    bool controllersStopping;   // Set by ReleaseAll, no more controllers are added
+    IOLock* transactionLock;
+    IOTimerEventSource *transactionTimer;
+    Transaction transactions[ONE_TRANSACTIONS];
+    int transactionHead[ONE_TRANSACTION_BUCKETS], transactionTail[ONE_TRANSACTION_BUCKETS];
+    int transactionFree;
+    UInt64 transactionWake;     // Deadline the timer is set for, 0 if it isn't
+    OnePairing pairings[ONE_PAIRINGS];
+    IOLock* uploadLock;         // Also guards the bring-up state
+    FirmwareUpload upload;
+    int uploadDepth;
+    UInt64 uploadTime;          // Total time spent uploading, absolute time units
+    IOTimerEventSource *bringUpTimer;
+    IOUSBDevRequest bringUpRequest;
+    unsigned char bringUpBuffer[8];
+    unsigned int bringUpStep;   // Index into kOneBringUp
+    int bringUpRepeat, bringUpAttempt;
+    bool bringUpDelayed;        // The current transfer's delay has passed
+    int bringUpWaiting;
+    bool bringUpBusy, bringUpStopping;
+    UInt64 bringUpBegan, bringUpStepBegan;
+    OSData *bringUpTimes;       // Microseconds each step took
+    IOBufferMemoryDescriptor *packetPool[ONE_PACKET_POOL];
+    volatile UInt32 packetPoolBusy;
     unsigned char controllerId[6];
     unsigned char adapterId[6];
     
+    volatile SInt32 unknownMessages;
+    volatile UInt32 unknownPending;     // The count is waiting to be published
+    thread_call_t unknownCall;          // Publishes the count, away from the read completion
     bool received5000c04a = false;
     bool received4400c04a = false;
     
-    void waitWriteCompleted();
     void waitReadCompleted();
     
+    void BringUpStart(void);
+    void BringUpRun(void);
+    bool BringUpResult(IOReturn status);
+    void BringUpComplete(IOReturn status);
+    void BringUpFinish(IOReturn status);
+    bool BringUpStopped(void);
+    void BringUpStop(void);
+    IOReturn BringUpControl(void);
+    void ControlComplete(void *parameter, IOReturn status, UInt32 bufferSizeRemaining);
+    static void BringUpTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender);
+    void BringUpTimerAction(IOTimerEventSource *sender);
+    
+    bool UploadFirmware(IOMemoryDescriptor *firmware);
+    void UploadNext(void);
+    void UploadComplete(void *parameter, IOReturn status, UInt32 bufferSizeRemaining);
+    void UploadFinish(IOMemoryDescriptor *firmware, IOReturn status);
+    
     void ProcessMessage(const unsigned char *data, int length);
+    bool DeliverInput(const unsigned char *data, int length);
+    void UnknownMessage(void);
+    static void UnknownThread(thread_call_param_t param0, thread_call_param_t param1);
     
-    bool QueueRead(IOUSBPipe *pipe);
+    void ReceivedButton(const unsigned char *data, int length);
+    void ReceivedPairing(const unsigned char *data, int length);
+    void Received44000800(const unsigned char *data, int length);
+    void Received5000c04a(const unsigned char *data, int length);
+    void Received5c00c04a(const unsigned char *data, int length);
+    void Received7c00c04a(const unsigned char *data, int length);
+    void Received6c00c04a(const unsigned char *data, int length);
+    void Received4400c04a(const unsigned char *data, int length);
+    void Received4c00c04a(const unsigned char *data, int length);
+    
+    void AddController(const unsigned char *mac);
+    void RemoveControllers(void);
+    
+    void ResetTransactions(void);
+    bool ExpectResponse(UInt32 signature, TransactionHandler handler, OnePairing *pairing);
+    bool CompleteResponse(UInt32 signature, const unsigned char *data);
+    static void TransactionTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender);
+    void TransactionTimerAction(IOTimerEventSource *sender);
+    
+    void PairingStart(const unsigned char *data);
+    void PairingStep(OnePairing *pairing, IOReturn status, const unsigned char *data);
+    
+    bool QueueRead(OneRead *read);
     void ReadComplete(void *parameter, IOReturn status, UInt32 bufferSizeRemaining);
     
     void WriteComplete(void *parameter, IOReturn status, UInt32 bufferSizeRemaining);
     
     void ReleaseAll(void);
+    void FreeResources(void);
     
     bool didTerminate(IOService *provider, IOOptionBits options, bool *defer);
     
-    IOBufferMemoryDescriptor* GetFirmware(int index);
-    IOBufferMemoryDescriptor* GetFirmware(const char input[]);
-    
-    bool controlIn(UInt8 bRequest, UInt16 wValue, UInt16 wIndex, const char checkControlHex[]);
-    bool controlOut(UInt8 bRequest, UInt16 wValue, UInt16 wIndex, const char controlHex[]);
-    
+    IOBufferMemoryDescriptor* NewPacket(const unsigned char *packet, IOByteCount length, const OneAddressing *addressing,
+                                        const unsigned char *controller, const unsigned char *adapter);
+    void ReleasePacket(IOMemoryDescriptor *buffer);
+    static void StampPacket(IOBufferMemoryDescriptor *buffer, const OnePatch &field, const unsigned char *value);
+    bool SendPacket(const unsigned char *packet, IOByteCount length, const OneAddressing *addressing,
+                    const unsigned char *controller, const unsigned char *adapter);
+    // Addressed to the controller that paired last
+    template <size_t N>
+    bool SendPacket(const unsigned char (&packet)[N], const OneAddressing *addressing)
+    {
+        return SendPacket(packet, N, addressing, controllerId, adapterId);
+    }
+    template <size_t N>
+    bool SendPacket(const unsigned char (&packet)[N], const OneAddressing *addressing, const OnePairing *pairing)
+    {
+        return SendPacket(packet, N, addressing, pairing->controllerId, pairing->adapterId);
+    }
     
+
     static void _ReadComplete(void *target, void *parameter, IOReturn status, UInt32 bufferSizeRemaining);
     static void _WriteComplete(void *target, void *parameter, IOReturn status, UInt32 bufferSizeRemaining);
-    
-    static void ProcessPairing(void* parameter, wait_result_t waitResult);
+    static void _UploadComplete(void *target, void *parameter, IOReturn status, UInt32 bufferSizeRemaining);
+    static void _ControlComplete(void *target, void *parameter, IOReturn status, UInt32 bufferSizeRemaining);
 };
 
-typedef struct PairingParam
-{
-    OneWirelessGamingReceiver *parent;
-} PairingParam;
-
 
 
 
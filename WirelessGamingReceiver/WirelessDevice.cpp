@@ -32,10 +32,36 @@ bool WirelessDevice::init(OSDictionary *dictionary)
     if (!super::init(dictionary))
         return false;
     index = -1;
+    slot = -1;
     function = NULL;
+    packetLock = IOLockAlloc();
+    if (packetLock == NULL)
+        return false;
+    packetTarget = NULL;
+    packetFunction = NULL;
+    packetBusy = 0;
+    cachedSerial[0] = '\0';
+    cachedSettings = NULL;
+    cachedLED = -1;
     return true;
 }
 
+// Release the wireless device
+void WirelessDevice::free(void)
+{
+    if (cachedSettings != NULL)
+    {
+        cachedSettings->release();
+        cachedSettings = NULL;
+    }
+    if (packetLock != NULL)
+    {
+        IOLockFree(packetLock);
+        packetLock = NULL;
+    }
+    super::free();
+}
+
 // Checks if there's any data for us
 bool WirelessDevice::IsDataAvailable(void)
 {
@@ -47,15 +73,15 @@ bool WirelessDevice::IsDataAvailable(void)
     return receiver->IsDataQueued(index);
 }
 
-// Gets the next item from our buffer
-IOMemoryDescriptor* WirelessDevice::NextPacket(void)
+// Copies the next item from our buffer, length is the buffer size on entry
+bool WirelessDevice::NextPacket(void *data, int *length)
 {
     if (index == -1)
-        return NULL;
+        return false;
     WirelessGamingReceiver *receiver = OSDynamicCast(WirelessGamingReceiver, getProvider());
     if (receiver == NULL)
-        return NULL;
-    return receiver->ReadBuffer(index);
+        return false;
+    return receiver->ReadBuffer(index, data, length);
 }
 
 // Sends a buffer for this controller
@@ -79,12 +105,140 @@ void WirelessDevice::RegisterWatcher(void *target, WirelessDeviceWatcher functio
         NewData();
 }
 
+// Registers a function to take packets straight from the receiver. Once it
+// returns the old handler isn't running and won't be called again, so its
+// target can go away.
+void WirelessDevice::RegisterPacketHandler(void *target, WirelessDevicePacket function)
+{
+    IOLockLock(packetLock);
+    packetTarget = target;
+    packetFunction = function;
+    while (packetBusy != 0)
+        IOLockSleep(packetLock, &packetBusy, THREAD_UNINT);
+    IOLockUnlock(packetLock);
+}
+
 // For internal use, sets this instances index on the wireless gaming receiver
 void WirelessDevice::SetIndex(int i)
 {
     index = i;
 }
 
+// For internal use, sets this instances slot across all receivers
+void WirelessDevice::SetSlot(int i)
+{
+    slot = i;
+    if (slot == -1)
+        removeProperty("WirelessSlot");
+    else
+        setProperty("WirelessSlot", slot, 32);
+}
+
+// Gets how many of our packets the receiver had to drop
+UInt32 WirelessDevice::GetDroppedPackets(void) const
+{
+    if (index == -1)
+        return 0;
+    WirelessGamingReceiver *receiver = OSDynamicCast(WirelessGamingReceiver, getProvider());
+    if (receiver == NULL)
+        return 0;
+    return receiver->DroppedPackets(index);
+}
+
+// Gets the system-wide slot, or -1 if there wasn't one free
+int WirelessDevice::GetSlot(void) const
+{
+    return slot;
+}
+
+// For internal use, gives this instance the identity a controller had before
+void WirelessDevice::SetIdentity(const char *serial, OSDictionary *settings, int led)
+{
+    strlcpy(cachedSerial, serial, sizeof(cachedSerial));
+    if (settings != NULL)
+        settings->retain();
+    if (cachedSettings != NULL)
+        cachedSettings->release();
+    cachedSettings = settings;
+    cachedLED = led;
+}
+
+// Gets the serial number restored from the cache, empty if there wasn't one
+const char* WirelessDevice::GetCachedSerial(void) const
+{
+    return cachedSerial;
+}
+
+// Gets the settings restored from the cache, or NULL
+OSDictionary* WirelessDevice::GetCachedSettings(void) const
+{
+    return cachedSettings;
+}
+
+// Gets the LED restored from the cache, or -1
+int WirelessDevice::GetCachedLED(void) const
+{
+    return cachedLED;
+}
+
+// Tells the receiver which controller this is
+void WirelessDevice::RememberSerial(const char *serial)
+{
+    if (index == -1)
+        return;
+    WirelessGamingReceiver *receiver = OSDynamicCast(WirelessGamingReceiver, getProvider());
+    if (receiver == NULL)
+        return;
+    receiver->RememberSerial(index, serial);
+}
+
+// Tells the receiver the settings to restore if this controller comes back
+void WirelessDevice::RememberSettings(OSDictionary *settings)
+{
+    if (index == -1)
+        return;
+    WirelessGamingReceiver *receiver = OSDynamicCast(WirelessGamingReceiver, getProvider());
+    if (receiver == NULL)
+        return;
+    receiver->RememberSettings(index, settings);
+}
+
+// Tells the receiver the LED to restore if this controller comes back
+void WirelessDevice::RememberLED(int led)
+{
+    if (index == -1)
+        return;
+    WirelessGamingReceiver *receiver = OSDynamicCast(WirelessGamingReceiver, getProvider());
+    if (receiver == NULL)
+        return;
+    receiver->RememberLED(index, led);
+}
+
+// Adds a record to the telemetry of the controller
+void WirelessDevice::RecordTelemetry(UInt32 type, UInt32 value)
+{
+    if (index == -1)
+        return;
+    WirelessGamingReceiver *receiver = OSDynamicCast(WirelessGamingReceiver, getProvider());
+    if (receiver == NULL)
+        return;
+    receiver->RecordTelemetry(index, type, value);
+}
+
+// Copies the telemetry of the controller oldest first and returns how many
+// records there are. added counts every record ever added, so it changes
+// whenever there's something new.
+int WirelessDevice::CopyTelemetry(WIRELESS_TELEMETRY *records, UInt32 *added) const
+{
+    *added = 0;
+    if (index == -1)
+        return 0;
+    WirelessGamingReceiver *receiver = OSDynamicCast(WirelessGamingReceiver, getProvider());
+    if (receiver == NULL)
+        return 0;
+    return receiver->CopyTelemetry(index, records, added);
+}
+
 // Called when new data arrives
 void WirelessDevice::NewData(void)
 {
@@ -92,7 +246,34 @@ void WirelessDevice::NewData(void)
         function(target, this, parameter);
 }
 
+// Hands a packet to the handler without queueing it, if there is one
+bool WirelessDevice::DeliverPacket(unsigned char *data, int length)
+{
+    WirelessDevicePacket handler;
+    void *handlerTarget;
+
+    IOLockLock(packetLock);
+    handler = packetFunction;
+    handlerTarget = packetTarget;
+    if (handler == NULL)
+    {
+        IOLockUnlock(packetLock);
+        return false;
+    }
+    packetBusy++;
+    IOLockUnlock(packetLock);
+
+    handler(handlerTarget, this, data, length);
+
+    IOLockLock(packetLock);
+    if (--packetBusy == 0)
+        IOLockWakeup(packetLock, &packetBusy, false);
+    IOLockUnlock(packetLock);
+    return true;
+}
+
 // Gets the location ID for this device
+// With a slot the low bits come from it rather than from the index
 OSNumber* WirelessDevice::newLocationIDNumber() const
 {
     OSNumber *owner;
@@ -106,7 +287,10 @@ OSNumber* WirelessDevice::newLocationIDNumber() const
     owner = receiver->newLocationIDNumber();
     if (owner != NULL)
     {
-        location = owner->unsigned32BitValue() + 1 + index;
+        if (slot != -1)
+            location = WirelessSlotLocation(owner->unsigned32BitValue(), slot);
+        else
+            location = owner->unsigned32BitValue() + 1 + index;
         owner->release();
     }
     return OSNumber::withNumber(location, 32);
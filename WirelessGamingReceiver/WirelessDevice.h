@@ -24,10 +24,13 @@
 #define __WIRELESSDEVICE_H__
 
 #include <IOKit/IOService.h>
+#include "devices.h"
+#include "wirelessring.h"
 
 class WirelessDevice;
 
 typedef void (*WirelessDeviceWatcher)(void *target, WirelessDevice *sender, void *parameter);
+typedef void (*WirelessDevicePacket)(void *target, WirelessDevice *sender, unsigned char *data, int length);
 
 class WirelessDevice : public IOService
 {
@@ -35,25 +38,54 @@ class WirelessDevice : public IOService
 
 public:
     bool init(OSDictionary *dictionary = 0);
+    void free(void);
 
     // Controller interface
     bool IsDataAvailable(void);
-    IOMemoryDescriptor* NextPacket(void);
+    bool NextPacket(void *data, int *length);
 
     void SendPacket(const void *data, size_t length);
 
     void RegisterWatcher(void *target, WirelessDeviceWatcher function, void *parameter);
+    void RegisterPacketHandler(void *target, WirelessDevicePacket function);
 
     OSNumber* newLocationIDNumber() const;
+    int GetSlot(void) const;
+    UInt32 GetDroppedPackets(void) const;
+
+    // Identity cache, so a returning controller needn't wait for its info
+    const char* GetCachedSerial(void) const;
+    OSDictionary* GetCachedSettings(void) const;
+    int GetCachedLED(void) const;
+    void RememberSerial(const char *serial);
+    void RememberSettings(OSDictionary *settings);
+    void RememberLED(int led);
+
+    // Telemetry, kept with the identity so it outlives the connection
+    void RecordTelemetry(UInt32 type, UInt32 value);
+    int CopyTelemetry(WIRELESS_TELEMETRY *records, UInt32 *added) const;
 
 private:
     friend class WirelessGamingReceiver;
     void SetIndex(int i);
+    void SetSlot(int i);
+    void SetIdentity(const char *serial, OSDictionary *settings, int led);
     void NewData(void);
+    bool DeliverPacket(unsigned char *data, int length);
     int index;
+    int slot;                   // System-wide, unlike index which is per receiver
+    // restored identity
+    char cachedSerial[10];
+    OSDictionary *cachedSettings;
+    int cachedLED;
     // callback
     void *target, *parameter;
     WirelessDeviceWatcher function;
+    // direct packet handler
+    IOLock *packetLock;
+    void *packetTarget;
+    WirelessDevicePacket packetFunction;
+    int packetBusy;             // Deliveries running, the handler can't change until they're done
 };
 
 #endif // __WIRELESSDEVICE_H__
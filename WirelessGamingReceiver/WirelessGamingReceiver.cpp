@@ -20,6 +20,7 @@
     along with Foobar; if not, write to the Free Software
     Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
+#include <kern/clock.h>
 #include "WirelessGamingReceiver.h"
 #include "WirelessDevice.h"
 #include "devices.h"
@@ -28,12 +29,8 @@
 
 OSDefineMetaClassAndStructors(WirelessGamingReceiver, IOService)
 
-// Holds data for asynchronous reads
-typedef struct WGRREAD
-{
-    int index;
-    IOBufferMemoryDescriptor *buffer;
-} WGRREAD;
+// Controller slots shared by every receiver in the system
+static WirelessDevice * volatile wirelessSlots[WIRELESS_SLOTS];
 
 // Get maximum packet size for a pipe
 static UInt32 GetMaxPacketSize(IOUSBPipe *pipe)
@@ -59,6 +56,41 @@ bool WirelessGamingReceiver::start(IOService *provider)
         return false;
     }
 
+    teardownsActive = 0;
+    maxTeardownGap = 0;
+    teardownLock = IOLockAlloc();
+    teardownQueue = OSArray::withCapacity(WIRELESS_CONNECTIONS);
+    teardownCall = thread_call_allocate(TeardownThread, this);
+    if ((teardownLock == NULL) || (teardownQueue == NULL) || (teardownCall == NULL))
+    {
+        // IOLog("start - failed to allocate teardown\n");
+        goto fail;
+    }
+    dropCall = thread_call_allocate(DropThread, this);
+    if (dropCall == NULL)
+    {
+        // IOLog("start - failed to allocate drop counters\n");
+        goto fail;
+    }
+
+    identityLock = IOLockAlloc();
+    if (identityLock == NULL)
+    {
+        // IOLog("start - failed to allocate identity lock\n");
+        goto fail;
+    }
+    identityClock = 0;
+    for (i = 0; i < WIRELESS_IDENTITIES; i++)
+    {
+        identities[i].serial[0] = '\0';
+        identities[i].settings = NULL;
+        identities[i].led = -1;
+        identities[i].used = 0;
+        identities[i].telemetryNext = 0;
+        identities[i].telemetryCount = 0;
+        identities[i].telemetryAdded = 0;
+    }
+
     device = OSDynamicCast(IOUSBDevice, provider);
     if (device == NULL)
     {
@@ -103,9 +135,19 @@ bool WirelessGamingReceiver::start(IOService *provider)
         connections[i].other = NULL;
         connections[i].otherIn = NULL;
         connections[i].otherOut = NULL;
-        connections[i].inputArray = NULL;
+        for (int j = 0; j < WIRELESS_READS; j++)
+        {
+            connections[i].reads[j].index = i;
+            connections[i].reads[j].buffer = NULL;
+        }
+        WirelessQueueInit(&connections[i].queue);
+        connections[i].link.reset();
         connections[i].service = NULL;
-        connections[i].controllerStarted = false;
+        connections[i].lastInput = 0;
+        connections[i].identity = -1;
+        connections[i].previous = -1;
+        connections[i].confirmed = false;
+        connections[i].dropped = 0;
     }
 
     pipeRequest.interval = 0;
@@ -188,18 +230,26 @@ bool WirelessGamingReceiver::start(IOService *provider)
         IOLog("start - interface mismatch?\n");
     connectionCount = iConnection;
 
+    droppedHID = 0;
+    droppedOther = 0;
+    PublishDropCounters();
+
     for (i = 0; i < connectionCount; i++)
     {
-        connections[i].inputArray = OSArray::withCapacity(5);
-        if (connections[i].inputArray == NULL)
-        {
-            // IOLog("start: Failed to allocate packet buffer %d\n", i);
-            goto fail;
-        }
-        if (!QueueRead(i))
+        // Read buffers are allocated once and reused for every read
+        for (int j = 0; j < WIRELESS_READS; j++)
         {
-            // IOLog("start: Failed to start read %d\n", i);
-            goto fail;
+            connections[i].reads[j].buffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, GetMaxPacketSize(connections[i].controllerIn));
+            if (connections[i].reads[j].buffer == NULL)
+            {
+                // IOLog("start: Failed to allocate read buffer %d\n", i);
+                goto fail;
+            }
+            if (!QueueRead(&connections[i].reads[j]))
+            {
+                // IOLog("start: Failed to start read %d\n", i);
+                goto fail;
+            }
         }
     }
 
@@ -218,6 +268,47 @@ void WirelessGamingReceiver::stop(IOService *provider)
     IOService::stop(provider);
 }
 
+// Free the objects that live as long as the driver
+void WirelessGamingReceiver::free(void)
+{
+    // Every pending teardown holds a reference, so none can be queued now
+    if (teardownCall != NULL)
+    {
+        thread_call_free(teardownCall);
+        teardownCall = NULL;
+    }
+    // Same for publishing the drop counters
+    if (dropCall != NULL)
+    {
+        thread_call_free(dropCall);
+        dropCall = NULL;
+    }
+    if (teardownQueue != NULL)
+    {
+        teardownQueue->release();
+        teardownQueue = NULL;
+    }
+    if (teardownLock != NULL)
+    {
+        IOLockFree(teardownLock);
+        teardownLock = NULL;
+    }
+    if (identityLock != NULL)
+    {
+        for (int i = 0; i < WIRELESS_IDENTITIES; i++)
+        {
+            if (identities[i].settings != NULL)
+            {
+                identities[i].settings->release();
+                identities[i].settings = NULL;
+            }
+        }
+        IOLockFree(identityLock);
+        identityLock = NULL;
+    }
+    IOService::free();
+}
+
 // Handle termination
 bool WirelessGamingReceiver::didTerminate(IOService *provider, IOOptionBits options, bool *defer)
 {
@@ -246,33 +337,23 @@ IOReturn WirelessGamingReceiver::message(UInt32 type,IOService *provider,void *a
 }
 
 // Queue a read on a controller
-bool WirelessGamingReceiver::QueueRead(int index)
+bool WirelessGamingReceiver::QueueRead(WGRREAD *read)
 {
     IOUSBCompletion complete;
     IOReturn err;
-    WGRREAD *data = (WGRREAD*)IOMalloc(sizeof(WGRREAD));
+    IOUSBPipe *pipe = connections[read->index].controllerIn;
 
-    if (data == NULL)
-        return false;
-    data->index = index;
-    data->buffer = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, GetMaxPacketSize(connections[index].controllerIn));
-    if (data->buffer == NULL)
-    {
-        IOFree(data, sizeof(WGRREAD));
+    if ((pipe == NULL) || (read->buffer == NULL))
         return false;
-    }
 
     complete.target = this;
     complete.action = _ReadComplete;
-    complete.parameter = data;
+    complete.parameter = read;
 
-    err = connections[index].controllerIn->Read(data->buffer, 0, 0, data->buffer->getLength(), &complete);
+    err = pipe->Read(read->buffer, 0, 0, read->buffer->getLength(), &complete);
     if (err == kIOReturnSuccess)
         return true;
 
-    data->buffer->release();
-    IOFree(data, sizeof(WGRREAD));
-
     // IOLog("read - failed to start (0x%.8x)\n", err);
     return false;
 }
@@ -290,6 +371,7 @@ void WirelessGamingReceiver::ReadComplete(void *parameter, IOReturn status, UInt
             connections[data->index].controllerIn->ClearStall();
             // fall through
         case kIOReturnSuccess:
+            NoteInput(data->index);
             ProcessMessage(data->index, (unsigned char*)data->buffer->getBytesNoCopy(), (int)data->buffer->getLength() - bufferSizeRemaining);
             break;
 
@@ -301,12 +383,8 @@ void WirelessGamingReceiver::ReadComplete(void *parameter, IOReturn status, UInt
             break;
     }
 
-    int newIndex = data->index;
-    data->buffer->release();
-    IOFree(data, sizeof(WGRREAD));
-
     if (reread)
-        QueueRead(newIndex);
+        QueueRead(data);
 }
 
 // Queue an asynchronous write on a controller
@@ -351,10 +429,13 @@ void WirelessGamingReceiver::WriteComplete(void *parameter,IOReturn status,UInt3
 // Release any allocated objects
 void WirelessGamingReceiver::ReleaseAll(void)
 {
+    if (teardownLock != NULL)
+        TeardownQueued();
     for (int i = 0; i < connectionCount; i++)
     {
         if (connections[i].service != NULL)
         {
+            FreeSlot(connections[i].service);
             connections[i].service->terminate(kIOServiceRequired);
             connections[i].service->detachAll(gIOServicePlane);
             connections[i].service->release();
@@ -394,12 +475,17 @@ void WirelessGamingReceiver::ReleaseAll(void)
             connections[i].other->close(this);
             connections[i].other = NULL;
         }
-        if (connections[i].inputArray != NULL)
+        // Pipes are aborted by now, so no read is using these
+        for (int j = 0; j < WIRELESS_READS; j++)
         {
-            connections[i].inputArray->release();
-            connections[i].inputArray = NULL;
+            if (connections[i].reads[j].buffer != NULL)
+            {
+                connections[i].reads[j].buffer->release();
+                connections[i].reads[j].buffer = NULL;
+            }
         }
-        connections[i].controllerStarted = false;
+        ResetQueue(i);
+        connections[i].link.reset();
     }
     if (device != NULL)
     {
@@ -423,7 +509,7 @@ void WirelessGamingReceiver::_WriteComplete(void *target, void *parameter, IORet
 }
 
 // Processes a message for a controller
-void WirelessGamingReceiver::ProcessMessage(int index, const unsigned char *data, int length)
+void WirelessGamingReceiver::ProcessMessage(int index, unsigned char *data, int length)
 {
 #ifdef PROTOCOL_DEBUG
     char s[1024];
@@ -437,87 +523,178 @@ void WirelessGamingReceiver::ProcessMessage(int index, const unsigned char *data
     s[i * 2] = '\0';
     IOLog("Got data (%d, %d bytes): %s\n", index, length, s);
 #endif
-    // Handle device connections
-    if ((length == 2) && (data[0] == 0x08))
+    WIRELESS_CONNECTION *connection = &connections[index];
+    WirelessLink::PACKET packet = WirelessLink::classify(data, length);
+    unsigned int actions = connection->link.receive(packet);
+
+    if (actions & WirelessLink::acTeardown)
     {
-        if (data[1] == 0x00)
-        {
-            // Device disconnected
+        // Device disconnected
 #ifdef PROTOCOL_DEBUG
-            IOLog("process: Device detached\n");
+        IOLog("process: Device detached\n");
 #endif
-            if (connections[index].service != NULL)
-            {
-                connections[index].service->SetIndex(-1);
-                if (connections[index].controllerStarted)
-                    connections[index].service->terminate(kIOServiceRequired | kIOServiceSynchronous);
-                connections[index].service->detach(this);
-                connections[index].service->release();
-                connections[index].service = NULL;
-                connections[index].controllerStarted = false;
-            }
-        }
-        else
-        {
-            // Device connected
+        RemoveService(index, (actions & WirelessLink::acTerminate) != 0);
+        ForgetIdentity(index);
+        connection->link.disconnected();
+        return;
+    }
+
+    if (actions & WirelessLink::acCreate)
+    {
+        // Device connected
 #ifdef PROTOCOL_DEBUG
-            IOLog("process: Attempting to add new device\n");
+        IOLog("process: Attempting to add new device\n");
 #endif
-            if (connections[index].service == NULL)
-            {
-                bool ready;
-                int i, j;
-                IOMemoryDescriptor *data;
-                char c;
-
-                ready = false;
-                j = connections[index].inputArray->getCount();
-                for (i = 0; !ready && (i < j); i++)
-                {
-                    data = OSDynamicCast(IOMemoryDescriptor, connections[index].inputArray->getObject(i));
-                    data->readBytes(1, &c, 1);
-                    if (c == 0x0f)
-                        ready = true;
-                }
-                InstantiateService(index);
-                if (ready && connections[index].service != NULL)
-                {
+        if (connection->service == NULL)
+            InstantiateService(index);
+        if (connection->service == NULL)
+        {
+            // Start over with the next packet
+            connection->link.reset();
+            actions &= ~WirelessLink::acRegister;
+        }
+        else if ((packet != WirelessLink::pkInfo) && GuessIdentity(index))
+            connection->link.recognised();
+    }
+
+    if ((actions & WirelessLink::acConfirm) && !ConfirmIdentity(index, data, length))
+    {
+        // A different controller came back, so the one registered is wrong
+        // from its serial number down. Start over as if this info packet
+        // were the first, so it's registered under its own identity.
 #ifdef PROTOCOL_DEBUG
-                    IOLog("Registering wireless device");
+        IOLog("process: Controller isn't the one last seen\n");
 #endif
-                    connections[index].controllerStarted = true;
-                    connections[index].service->registerService();
-                }
-            }
-        }
+        RemoveService(index, true);
+        ForgetIdentity(index);
+        connection->link.disconnected();
+        ProcessMessage(index, data, length);
         return;
     }
 
-    // Add anything else to the queue
-    IOMemoryDescriptor *copy = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, length);
-    copy->writeBytes(0, data, length);
-    connections[index].inputArray->setObject(copy);
-    if (connections[index].service == NULL)
-        InstantiateService(index);
-    if (connections[index].service != NULL)
+    // HID reports for a running controller skip the queue, unless it still
+    // holds earlier packets that must be seen first
+    if (actions & WirelessLink::acDispatch)
     {
-        connections[index].service->NewData();
-        if (!connections[index].controllerStarted)
-        {
-            char c;
+        if ((connection->service != NULL) && !IsDataQueued(index) &&
+            connection->service->DeliverPacket(data, length))
+            return;
+        actions |= WirelessLink::acQueue;
+    }
 
-            copy->readBytes(1, &c, 1);
-            if (c == 0x0f)
-            {
+    if (actions & WirelessLink::acQueue)
+    {
+        QueuePacket(index, data, length);
+        if (connection->service != NULL)
+            connection->service->NewData();
+    }
+
+    if ((actions & WirelessLink::acRegister) && (connection->service != NULL))
+    {
 #ifdef PROTOCOL_DEBUG
-                IOLog("Registering wireless device");
+        IOLog("Registering wireless device");
 #endif
-                connections[index].controllerStarted = true;
-                connections[index].service->registerService();
-            }
+        // With the info packet the serial is known, so the HID driver starts
+        // with the right settings. Otherwise it starts with the guessed ones
+        // and the info packet confirms them later.
+        if (packet == WirelessLink::pkInfo)
+            RestoreIdentity(index, data, length);
+        connection->service->registerService();
+    }
+}
+
+// Track how long the other controllers wait for input while one is torn down
+void WirelessGamingReceiver::NoteInput(int index)
+{
+    UInt64 now, gap;
+
+    clock_get_uptime(&now);
+    if ((teardownsActive > 0) && (connections[index].lastInput != 0) && connections[index].link.isRegistered())
+    {
+        gap = now - connections[index].lastInput;
+        if (gap > maxTeardownGap)
+        {
+            // Published from the thread call, like the drop counters
+            maxTeardownGap = gap;
+            QueuePublish();
         }
     }
-    copy->release();
+    connections[index].lastInput = now;
+}
+
+// Hand an unlinked controller to the teardown thread, so the read
+// completion doesn't wait for the HID stack to let go of it
+void WirelessGamingReceiver::QueueTeardown(WirelessDevice *service)
+{
+    bool queued;
+
+    IOLockLock(teardownLock);
+    queued = teardownQueue->setObject(service);
+    IOLockUnlock(teardownLock);
+    if (!queued)
+    {
+        service->terminate(kIOServiceRequired | kIOServiceSynchronous);
+        service->detach(this);
+        return;
+    }
+    OSIncrementAtomic(&teardownsActive);
+    // Keep the receiver around until the call has run
+    retain();
+    if (thread_call_enter(teardownCall))
+        release();
+}
+
+// Terminate every controller waiting for teardown
+void WirelessGamingReceiver::TeardownQueued(void)
+{
+    WirelessDevice *service;
+
+    for (;;)
+    {
+        IOLockLock(teardownLock);
+        service = OSDynamicCast(WirelessDevice, teardownQueue->getObject(0));
+        if (service != NULL)
+        {
+            service->retain();
+            teardownQueue->removeObject(0);
+        }
+        IOLockUnlock(teardownLock);
+        if (service == NULL)
+            break;
+        service->terminate(kIOServiceRequired | kIOServiceSynchronous);
+        service->detach(this);
+        service->release();
+        OSDecrementAtomic(&teardownsActive);
+    }
+}
+
+// Thread call for deferred teardown
+void WirelessGamingReceiver::TeardownThread(thread_call_param_t param0, thread_call_param_t param1)
+{
+    WirelessGamingReceiver *receiver = (WirelessGamingReceiver*)param0;
+
+    receiver->TeardownQueued();
+    receiver->release();
+}
+
+// Take a controller's node off its connection. A registered node has a HID
+// driver, so it's terminated off the read completion.
+void WirelessGamingReceiver::RemoveService(int index, bool terminate)
+{
+    WIRELESS_CONNECTION *connection = &connections[index];
+
+    if (connection->service != NULL)
+    {
+        connection->service->SetIndex(-1);
+        FreeSlot(connection->service);
+        if (terminate)
+            QueueTeardown(connection->service);
+        else
+            connection->service->detach(this);
+        connection->service->release();
+        connection->service = NULL;
+    }
+    ResetQueue(index);
 }
 
 // Create a new node for the attached controller
@@ -537,6 +714,7 @@ void WirelessGamingReceiver::InstantiateService(int index)
         {
             connections[index].service->attach(this);
             connections[index].service->SetIndex(index);
+            connections[index].service->SetSlot(AllocateSlot(connections[index].service));
             // connections[index].service->registerService();
             // IOLog("process: Device attached\n");
             if (IsDataQueued(index))
@@ -552,22 +730,358 @@ void WirelessGamingReceiver::InstantiateService(int index)
     }
 }
 
+// Add a packet to a controller's queue, only the read completion does
+void WirelessGamingReceiver::QueuePacket(int index, const unsigned char *data, int length)
+{
+    int dropped[WIRELESS_RINGS] = { 0, 0 };
+    int i;
+
+    if (!WirelessQueuePush(&connections[index].queue, data, length, dropped))
+    {
+        NoteDrop(index, false);
+        return;
+    }
+    for (i = 0; i < dropped[WIRELESS_RING_HID]; i++)
+        NoteDrop(index, true);
+    for (i = 0; i < dropped[WIRELESS_RING_OTHER]; i++)
+        NoteDrop(index, false);
+}
+
+// Empty a controller's queue
+void WirelessGamingReceiver::ResetQueue(int index)
+{
+    WirelessQueueReset(&connections[index].queue);
+}
+
+// Count a packet lost to a full queue. Called from the read completion, so
+// the counters are published later from a thread call.
+void WirelessGamingReceiver::NoteDrop(int index, bool hid)
+{
+    connections[index].dropped++;
+    if (hid)
+        droppedHID++;
+    else
+        droppedOther++;
+    QueuePublish();
+}
+
+// Have the thread call publish the counters
+void WirelessGamingReceiver::QueuePublish(void)
+{
+    // Keep the receiver around until the call has run
+    retain();
+    if (thread_call_enter(dropCall))
+        release();
+}
+
+// Update the counters of packets lost to a full queue, and the longest wait
+// for input during a teardown
+void WirelessGamingReceiver::PublishDropCounters(void)
+{
+    UInt64 ns;
+
+    setProperty("DroppedHIDPackets", droppedHID, 32);
+    setProperty("DroppedPackets", droppedOther, 32);
+    if (maxTeardownGap != 0)
+    {
+        absolutetime_to_nanoseconds(maxTeardownGap, &ns);
+        setProperty("TeardownInputGap", ns / 1000, 32);
+    }
+}
+
+// Thread call for publishing the counters, one run covers every change
+// since it was entered
+void WirelessGamingReceiver::DropThread(thread_call_param_t param0, thread_call_param_t param1)
+{
+    WirelessGamingReceiver *receiver = (WirelessGamingReceiver*)param0;
+
+    receiver->PublishDropCounters();
+    receiver->release();
+}
+
+// Claim the first free system-wide slot for a controller, or -1 if all are taken
+int WirelessGamingReceiver::AllocateSlot(WirelessDevice *device)
+{
+    for (int i = 0; i < WIRELESS_SLOTS; i++)
+    {
+        if (OSCompareAndSwapPtr(NULL, device, (void * volatile *)&wirelessSlots[i]))
+            return i;
+    }
+    return -1;
+}
+
+// Give a controller's slot back
+void WirelessGamingReceiver::FreeSlot(WirelessDevice *device)
+{
+    int slot = device->GetSlot();
+
+    if (slot == -1)
+        return;
+    device->SetSlot(-1);
+    OSCompareAndSwapPtr(device, NULL, (void * volatile *)&wirelessSlots[slot]);
+}
+
+// Give a new device node the identity of the controller last confirmed on
+// its connection, so it can be registered on its first report. It's only a
+// guess until the info packet confirms it, but it is nearly always the same
+// controller coming back.
+bool WirelessGamingReceiver::GuessIdentity(int index)
+{
+    WIRELESS_CONNECTION *connection = &connections[index];
+    WGRIDENTITY *identity;
+    bool guessed = false;
+
+    IOLockLock(identityLock);
+    // A controller can't be on two connections, so one that's in use elsewhere isn't this one
+    if ((connection->previous != -1) && !IdentityInUse(index, connection->previous))
+    {
+        identity = &identities[connection->previous];
+        connection->service->SetIdentity(identity->serial, identity->settings, identity->led);
+        connection->identity = connection->previous;
+        connection->confirmed = false;
+        guessed = true;
+    }
+    IOLockUnlock(identityLock);
+    return guessed;
+}
+
+// Check the info packet of a controller registered on a guess is from the
+// controller it was guessed to be. Packets without a serial number can't
+// tell, so they leave the guess alone.
+bool WirelessGamingReceiver::ConfirmIdentity(int index, const unsigned char *data, int length)
+{
+    WIRELESS_CONNECTION *connection = &connections[index];
+    char serial[10];
+    bool confirmed = false;
+
+    if (!WirelessLink::serialNumber(data, length, serial, sizeof(serial)))
+        return true;
+    IOLockLock(identityLock);
+    if ((connection->identity != -1) &&
+        (strncmp(identities[connection->identity].serial, serial, sizeof(serial)) == 0))
+    {
+        identities[connection->identity].used = ++identityClock;
+        connection->previous = connection->identity;
+        ConnectIdentity(index);
+        confirmed = true;
+    }
+    IOLockUnlock(identityLock);
+    return confirmed;
+}
+
+// Give a new device node the cached identity of the controller that sent
+// the info packet, before it's registered. If there isn't one it starts
+// afresh, rather than with anything guessed before the packet arrived.
+void WirelessGamingReceiver::RestoreIdentity(int index, const unsigned char *data, int length)
+{
+    WIRELESS_CONNECTION *connection = &connections[index];
+    char serial[10];
+    int i;
+
+    if (!WirelessLink::serialNumber(data, length, serial, sizeof(serial)))
+        return;
+    IOLockLock(identityLock);
+    connection->identity = -1;
+    connection->confirmed = false;
+    for (i = 0; i < WIRELESS_IDENTITIES; i++)
+    {
+        if ((identities[i].used != 0) &&
+            (strncmp(identities[i].serial, serial, sizeof(identities[i].serial)) == 0))
+        {
+            identities[i].used = ++identityClock;
+            connection->identity = i;
+            connection->previous = i;
+            ConnectIdentity(index);
+            break;
+        }
+    }
+    if (connection->identity != -1)
+    {
+        WGRIDENTITY *identity = &identities[connection->identity];
+        connection->service->SetIdentity(identity->serial, identity->settings, identity->led);
+    }
+    else
+        connection->service->SetIdentity("", NULL, -1);
+    IOLockUnlock(identityLock);
+}
+
+// The controller on a connection has gone, its entry stays cached
+// Only a confirmed controller was ever recorded as connected, a wrong guess
+// leaves no trace in the telemetry.
+void WirelessGamingReceiver::ForgetIdentity(int index)
+{
+    IOLockLock(identityLock);
+    if ((connections[index].identity != -1) && connections[index].confirmed)
+        AddTelemetry(&identities[connections[index].identity], kTelemetryDisconnect, 0);
+    connections[index].identity = -1;
+    connections[index].confirmed = false;
+    IOLockUnlock(identityLock);
+}
+
+// The identity of the controller on a connection is confirmed, record it
+// connecting once. Called with identityLock held.
+void WirelessGamingReceiver::ConnectIdentity(int index)
+{
+    if (connections[index].confirmed)
+        return;
+    connections[index].confirmed = true;
+    AddTelemetry(&identities[connections[index].identity], kTelemetryConnect, 0);
+}
+
+// Adds a record to a cached controller's telemetry. Called with identityLock held.
+void WirelessGamingReceiver::AddTelemetry(WGRIDENTITY *identity, UInt32 type, UInt32 value)
+{
+    WIRELESS_TELEMETRY *record = &identity->telemetry[identity->telemetryNext];
+    UInt64 now;
+
+    clock_get_uptime(&now);
+    absolutetime_to_nanoseconds(now, &record->time);
+    record->type = type;
+    record->value = value;
+    identity->telemetryNext = (identity->telemetryNext + 1) % WIRELESS_TELEMETRY_SIZE;
+    if (identity->telemetryCount < WIRELESS_TELEMETRY_SIZE)
+        identity->telemetryCount++;
+    identity->telemetryAdded++;
+}
+
+// Another connection's controller has this entry
+bool WirelessGamingReceiver::IdentityInUse(int index, int entry) const
+{
+    for (int i = 0; i < WIRELESS_CONNECTIONS; i++)
+    {
+        if ((i != index) && (connections[i].identity == entry))
+            return true;
+    }
+    return false;
+}
+
+// Record the serial number of the controller on a connection
+void WirelessGamingReceiver::RememberSerial(int index, const char *serial)
+{
+    int i, entry = -1;
+
+    IOLockLock(identityLock);
+    for (i = 0; i < WIRELESS_IDENTITIES; i++)
+    {
+        if (strncmp(identities[i].serial, serial, sizeof(identities[i].serial)) == 0)
+        {
+            entry = i;
+            break;
+        }
+    }
+    if (entry == -1)
+    {
+        // Entries held by the other connections stay, there are always more
+        // entries than connections so one is free
+        for (i = 0; i < WIRELESS_IDENTITIES; i++)
+        {
+            if (IdentityInUse(index, i))
+                continue;
+            if ((entry == -1) || (identities[i].used < identities[entry].used))
+                entry = i;
+        }
+        // Connections that last saw the evicted controller can't guess it any more
+        for (i = 0; i < WIRELESS_CONNECTIONS; i++)
+        {
+            if (connections[i].previous == entry)
+                connections[i].previous = -1;
+        connections[i].confirmed = false;
+        }
+        strlcpy(identities[entry].serial, serial, sizeof(identities[entry].serial));
+        if (identities[entry].settings != NULL)
+        {
+            identities[entry].settings->release();
+            identities[entry].settings = NULL;
+        }
+        identities[entry].led = -1;
+        identities[entry].telemetryNext = 0;
+        identities[entry].telemetryCount = 0;
+        identities[entry].telemetryAdded = 0;
+    }
+    identities[entry].used = ++identityClock;
+    if (connections[index].identity != entry)
+    {
+        connections[index].identity = entry;
+        connections[index].confirmed = false;
+    }
+    connections[index].previous = entry;
+    ConnectIdentity(index);
+    IOLockUnlock(identityLock);
+}
+
+// Record the settings of the controller on a connection
+void WirelessGamingReceiver::RememberSettings(int index, OSDictionary *settings)
+{
+    WGRIDENTITY *identity;
+
+    IOLockLock(identityLock);
+    if (connections[index].identity != -1)
+    {
+        identity = &identities[connections[index].identity];
+        if (settings != NULL)
+            settings->retain();
+        if (identity->settings != NULL)
+            identity->settings->release();
+        identity->settings = settings;
+    }
+    IOLockUnlock(identityLock);
+}
+
+// Record the LED of the controller on a connection
+void WirelessGamingReceiver::RememberLED(int index, int led)
+{
+    IOLockLock(identityLock);
+    if (connections[index].identity != -1)
+        identities[connections[index].identity].led = led;
+    IOLockUnlock(identityLock);
+}
+
+// Record an event for the controller on a connection, if it's known
+void WirelessGamingReceiver::RecordTelemetry(int index, UInt32 type, UInt32 value)
+{
+    IOLockLock(identityLock);
+    if ((connections[index].identity != -1) && connections[index].confirmed)
+        AddTelemetry(&identities[connections[index].identity], type, value);
+    IOLockUnlock(identityLock);
+}
+
+// Copy the telemetry of the controller on a connection, oldest first
+int WirelessGamingReceiver::CopyTelemetry(int index, WIRELESS_TELEMETRY *records, UInt32 *added)
+{
+    WGRIDENTITY *identity;
+    int i, first, count = 0;
+
+    *added = 0;
+    IOLockLock(identityLock);
+    if ((connections[index].identity != -1) && connections[index].confirmed)
+    {
+        identity = &identities[connections[index].identity];
+        count = identity->telemetryCount;
+        first = (identity->telemetryNext + WIRELESS_TELEMETRY_SIZE - count) % WIRELESS_TELEMETRY_SIZE;
+        for (i = 0; i < count; i++)
+            records[i] = identity->telemetry[(first + i) % WIRELESS_TELEMETRY_SIZE];
+        *added = identity->telemetryAdded;
+    }
+    IOLockUnlock(identityLock);
+    return count;
+}
+
+// Count of packets a controller has lost to a full queue
+UInt32 WirelessGamingReceiver::DroppedPackets(int index)
+{
+    return connections[index].dropped;
+}
+
 // Check a controller's queue
 bool WirelessGamingReceiver::IsDataQueued(int index)
 {
-    return connections[index].inputArray->getCount() > 0;
+    return !WirelessQueueEmpty(&connections[index].queue);
 }
 
-// Read a controller's queue
-IOMemoryDescriptor* WirelessGamingReceiver::ReadBuffer(int index)
+// Read a controller's queue, length is the buffer size on entry
+bool WirelessGamingReceiver::ReadBuffer(int index, void *data, int *length)
 {
-    IOMemoryDescriptor *data;
-
-    data = OSDynamicCast(IOMemoryDescriptor, connections[index].inputArray->getObject(0));
-    if (data != NULL)
-        data->retain();
-    connections[index].inputArray->removeObject(0);
-    return data;
+    return WirelessQueuePop(&connections[index].queue, data, length);
 }
 
 // Get our location ID
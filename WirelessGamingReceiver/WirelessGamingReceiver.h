@@ -25,11 +25,44 @@
 
 #include <IOKit/usb/IOUSBDevice.h>
 #include <IOKit/usb/IOUSBInterface.h>
+#include <IOKit/IOBufferMemoryDescriptor.h>
+#include <kern/thread_call.h>
+#include "WirelessDevice.h"
+#include "devices.h"
+#include "wirelesslink.h"
+#include "wirelessring.h"
+#include "wirelessslot.h"
 
 // This value is defined by the hardware and fixed
 #define WIRELESS_CONNECTIONS        4
 
-class WirelessDevice;
+// Controllers remembered for quick reconnection, more than there are connections
+#define WIRELESS_IDENTITIES         8
+#if WIRELESS_IDENTITIES <= WIRELESS_CONNECTIONS
+#error WIRELESS_IDENTITIES must be more than WIRELESS_CONNECTIONS
+#endif
+
+// Reads kept queued on each controller pipe
+#define WIRELESS_READS              2
+
+// Holds data for asynchronous reads
+typedef struct WGRREAD
+{
+    int index;
+    IOBufferMemoryDescriptor *buffer;
+} WGRREAD;
+
+// Holds what a controller had set last time it was connected
+typedef struct WGRIDENTITY
+{
+    char serial[10];
+    OSDictionary *settings;
+    int led;                                // -1 if never set
+    UInt32 used;                            // Least recently used is replaced first, 0 if empty
+    WIRELESS_TELEMETRY telemetry[WIRELESS_TELEMETRY_SIZE];
+    int telemetryNext, telemetryCount;
+    UInt32 telemetryAdded;                  // Records ever added, so readers can tell there are new ones
+} WGRIDENTITY;
 
 typedef struct WIRELESS_CONNECTION
 {
@@ -42,9 +75,15 @@ typedef struct WIRELESS_CONNECTION
     IOUSBPipe *otherIn, *otherOut;
 
     // Runtime data
-    OSArray *inputArray;
+    WGRREAD reads[WIRELESS_READS];
+    WGRQUEUE queue;
+    WirelessLink link;
     WirelessDevice *service;
-    bool controllerStarted;
+    UInt64 lastInput;                       // Absolute time of the last completed read
+    int identity;                           // Cached identity of the controller on this connection, or -1
+    int previous;                           // Cached identity of the last controller confirmed on this connection, or -1
+    bool confirmed;                         // The identity is from the controller's serial number, not a guess
+    UInt32 dropped;                         // Packets lost to a full queue
 }
 WIRELESS_CONNECTION;
 
@@ -54,6 +93,7 @@ class WirelessGamingReceiver : public IOService
 public:
     bool start(IOService *provider);
     void stop(IOService *provider);
+    void free(void);
 
     IOReturn message(UInt32 type,IOService *provider,void *argument);
 
@@ -63,19 +103,64 @@ public:
 private:
     friend class WirelessDevice;
     bool IsDataQueued(int index);
-    IOMemoryDescriptor* ReadBuffer(int index);
+    bool ReadBuffer(int index, void *data, int *length);
     bool QueueWrite(int index, const void *bytes, UInt32 length);
+    void RememberSerial(int index, const char *serial);
+    void RememberSettings(int index, OSDictionary *settings);
+    void RememberLED(int index, int led);
+    void RecordTelemetry(int index, UInt32 type, UInt32 value);
+    int CopyTelemetry(int index, WIRELESS_TELEMETRY *records, UInt32 *added);
+    UInt32 DroppedPackets(int index);
 
 private:
     IOUSBDevice *device;
     WIRELESS_CONNECTION connections[WIRELESS_CONNECTIONS];
     int connectionCount;
+    UInt32 droppedHID, droppedOther;
+
+    // Unlinked controllers waiting to be terminated
+    IOLock *teardownLock;
+    OSArray *teardownQueue;
+    thread_call_t teardownCall;
+
+    // Publishes the drop counters and teardown gap, away from the read completion
+    thread_call_t dropCall;
+    volatile SInt32 teardownsActive;
+    UInt64 maxTeardownGap;                  // Longest wait for a report while a teardown was running
+
+    // Identity cache
+    IOLock *identityLock;
+    WGRIDENTITY identities[WIRELESS_IDENTITIES];
+    UInt32 identityClock;
+
+    void QueuePacket(int index, const unsigned char *data, int length);
+    void ResetQueue(int index);
+    void PublishDropCounters(void);
+    void NoteDrop(int index, bool hid);
+    void QueuePublish(void);
+    static void DropThread(thread_call_param_t param0, thread_call_param_t param1);
 
     void InstantiateService(int index);
-
-    void ProcessMessage(int index, const unsigned char *data, int length);
-
-    bool QueueRead(int index);
+    void RemoveService(int index, bool terminate);
+    bool GuessIdentity(int index);
+    bool ConfirmIdentity(int index, const unsigned char *data, int length);
+    void RestoreIdentity(int index, const unsigned char *data, int length);
+    void ForgetIdentity(int index);
+    bool IdentityInUse(int index, int entry) const;
+    void ConnectIdentity(int index);
+    static void AddTelemetry(WGRIDENTITY *identity, UInt32 type, UInt32 value);
+
+    static int AllocateSlot(WirelessDevice *device);
+    static void FreeSlot(WirelessDevice *device);
+
+    void ProcessMessage(int index, unsigned char *data, int length);
+    void NoteInput(int index);
+
+    void QueueTeardown(WirelessDevice *service);
+    void TeardownQueued(void);
+    static void TeardownThread(thread_call_param_t param0, thread_call_param_t param1);
+
+    bool QueueRead(WGRREAD *read);
     void ReadComplete(void *parameter, IOReturn status, UInt32 bufferSizeRemaining);
 
     void WriteComplete(void *parameter, IOReturn status, UInt32 bufferSizeRemaining);
@@ -22,10 +22,13 @@
 */
 #include <IOKit/IOLib.h>
 #include <IOKit/IOTimerEventSource.h>
+#include <kern/clock.h>
 #include "WirelessHIDDevice.h"
 #include "WirelessDevice.h"
+#include "wirelesslink.h"
 #include "devices.h"
 
+// Default seconds without input before turning the pad off
 #define POWEROFF_TIMEOUT (15 * 60)
 
 OSDefineMetaClassAndAbstractStructors(WirelessHIDDevice, IOHIDDevice)
@@ -34,16 +37,188 @@ OSDefineMetaClassAndAbstractStructors(WirelessHIDDevice, IOHIDDevice)
 // Some sort of message to send
 const char weirdStart[] = {0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-void WirelessHIDDevice::ChatPadTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender)
+// Initialise the device
+bool WirelessHIDDevice::init(OSDictionary *dictionary)
 {
-	WirelessHIDDevice *device = OSDynamicCast(WirelessHIDDevice, owner);
-
-    // Automatic shutoff
-    device->serialTimerCount++;
-    if (device->serialTimerCount > POWEROFF_TIMEOUT)
-        device->PowerOff();
-    // Reset
-    sender->setTimeoutMS(1000);
+    if (!super::init(dictionary))
+        return false;
+    powerOffTimer = NULL;
+    powerOffTimeout = POWEROFF_TIMEOUT;
+    lastActivity = 0;
+    batteryKnown = false;
+    telemetryTimer = NULL;
+    telemetryArmed = 0;
+    telemetryPublished = 0;
+    rateWindow = 0;
+    rateReports = 0;
+    rateCounted = 0;
+    reportRate = 0;
+    droppedPackets = 0;
+    return true;
+}
+
+void WirelessHIDDevice::PowerOffTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender)
+{
+    WirelessHIDDevice *device = OSDynamicCast(WirelessHIDDevice, owner);
+
+    if (device != NULL)
+        device->PowerOffTimerAction(sender);
+}
+
+// Absolute time the pad turns off if no more input arrives
+UInt64 WirelessHIDDevice::PowerOffDeadline(void)
+{
+    UInt64 interval;
+
+    nanoseconds_to_absolutetime((UInt64)powerOffTimeout * 1000000000ULL, &interval);
+    return lastActivity + interval;
+}
+
+// Automatic shutoff
+// Input only records a timestamp, so this fires once per timeout period at
+// most; if input arrived since it was armed, it just sleeps until the new
+// deadline.
+void WirelessHIDDevice::PowerOffTimerAction(IOTimerEventSource *sender)
+{
+    UInt64 now;
+
+    if (powerOffTimeout == 0)
+        return;
+    clock_get_uptime(&now);
+    if (now >= PowerOffDeadline())
+    {
+        PowerOff();
+        // In case the pad didn't listen, try again after another period
+        lastActivity = now;
+    }
+    sender->wakeAtTime(PowerOffDeadline());
+}
+
+// Changes the idle time before the pad turns off, 0 to never turn it off
+void WirelessHIDDevice::SetPowerOffTimeout(UInt32 seconds)
+{
+    powerOffTimeout = seconds;
+    if (powerOffTimer == NULL)
+        return;
+    powerOffTimer->cancelTimeout();
+    if (powerOffTimeout != 0)
+        powerOffTimer->wakeAtTime(PowerOffDeadline());
+}
+
+void WirelessHIDDevice::TelemetryTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender)
+{
+    WirelessHIDDevice *device = OSDynamicCast(WirelessHIDDevice, owner);
+
+    if (device != NULL)
+        device->TelemetryTimerAction(sender);
+}
+
+// Runs on the workloop every interval while reports arrive. Once a window
+// passes without any it lets the timer lapse, so an idle pad doesn't wake
+// anything up until it sends something again.
+void WirelessHIDDevice::TelemetryTimerAction(IOTimerEventSource *sender)
+{
+    UInt64 now;
+    bool active;
+
+    clock_get_uptime(&now);
+    active = SampleReportRate(now);
+    PublishTelemetry();
+    if (active)
+    {
+        sender->setTimeoutMS(WIRELESS_TELEMETRY_INTERVAL);
+        return;
+    }
+    OSCompareAndSwap(1, 0, &telemetryArmed);
+    // A report that came in meanwhile saw the timer still armed
+    if (rateReports != rateCounted)
+        ArmTelemetry();
+}
+
+// Starts the timer if it isn't running, with a new report rate window.
+// Called from the read completion, so it does no more than that.
+void WirelessHIDDevice::ArmTelemetry(void)
+{
+    if ((telemetryTimer == NULL) || !OSCompareAndSwap(0, 1, &telemetryArmed))
+        return;
+    clock_get_uptime(&rateWindow);
+    rateCounted = rateReports;
+    telemetryTimer->setTimeoutMS(WIRELESS_TELEMETRY_INTERVAL);
+}
+
+// Adds a record to the controller's telemetry, the timer publishes it
+// Only called when something changed, so clients never need to poll
+void WirelessHIDDevice::RecordTelemetry(UInt32 type, UInt32 value)
+{
+    WirelessDevice *device = OSDynamicCast(WirelessDevice, getProvider());
+
+    if (device == NULL)
+        return;
+    device->RecordTelemetry(type, value);
+    ArmTelemetry();
+}
+
+// Publishes the records, oldest first, and tells clients if any were added
+void WirelessHIDDevice::PublishTelemetry(void)
+{
+    WIRELESS_TELEMETRY records[WIRELESS_TELEMETRY_SIZE];
+    WirelessDevice *device = OSDynamicCast(WirelessDevice, getProvider());
+    UInt32 added;
+    int count;
+
+    if (device == NULL)
+        return;
+    count = device->CopyTelemetry(records, &added);
+    if (added == telemetryPublished)
+        return;
+    telemetryPublished = added;
+
+    OSData *data = OSData::withBytes(records, count * sizeof(WIRELESS_TELEMETRY));
+    if (data != NULL)
+    {
+        setProperty(kIOWirelessTelemetry, data);
+        data->release();
+    }
+    messageClients(kIOWirelessTelemetryChanged);
+}
+
+// Called from the timer, records the report rate and drops over the last
+// window and returns whether any reports arrived in it
+// The rate is only recorded when it moves by more than the threshold, so
+// normal jitter doesn't push the other records out of the ring
+bool WirelessHIDDevice::SampleReportRate(UInt64 now)
+{
+    WirelessDevice *device;
+    UInt64 ns;
+    UInt32 rate, dropped, change;
+    SInt32 reports;
+    bool active;
+
+    reports = rateReports;
+    active = (reports != rateCounted);
+    absolutetime_to_nanoseconds(now - rateWindow, &ns);
+    if (ns == 0)
+        return true;
+    rate = (UInt32)((((UInt64)(UInt32)(reports - rateCounted) * 1000000000ULL) / ns + 2) / 5 * 5);
+    change = (rate > reportRate) ? (rate - reportRate) : (reportRate - rate);
+    if ((change >= WIRELESS_RATE_THRESHOLD) || ((rate == 0) != (reportRate == 0)))
+    {
+        reportRate = rate;
+        RecordTelemetry(kTelemetryReportRate, rate);
+    }
+    device = OSDynamicCast(WirelessDevice, getProvider());
+    if (device != NULL)
+    {
+        dropped = device->GetDroppedPackets();
+        if (dropped != droppedPackets)
+        {
+            droppedPackets = dropped;
+            RecordTelemetry(kTelemetryDropped, dropped);
+        }
+    }
+    rateWindow = now;
+    rateCounted = reports;
+    return active;
 }
 
 // Sets the LED with the same format as the wired controller
@@ -56,6 +231,7 @@ void WirelessHIDDevice::SetLEDs(int mode)
     {
         device->SendPacket(buf, sizeof(buf));
         device->SendPacket(weirdStart, sizeof(weirdStart));
+        device->RememberLED(mode);
     }
 }
 
@@ -113,26 +289,57 @@ bool WirelessHIDDevice::handleStart(IOService *provider)
     if (device == NULL)
         goto fail;
 
-    serialTimerCount = 0;
+    clock_get_uptime(&lastActivity);
+
+    report = IOBufferMemoryDescriptor::inTaskWithOptions(kernel_task, 0, WIRELESS_PACKET_SIZE);
+    if (report == NULL)
+    {
+        IOLog("start - failed to allocate report buffer\n");
+        goto fail;
+    }
 
-	serialTimer = IOTimerEventSource::timerEventSource(this, ChatPadTimerActionWrapper);
-	if (serialTimer == NULL)
-	{
-		IOLog("start - failed to create timer for chatpad\n");
-		goto fail;
-	}
+    powerOffTimer = IOTimerEventSource::timerEventSource(this, PowerOffTimerActionWrapper);
+    if (powerOffTimer == NULL)
+    {
+        IOLog("start - failed to create timer for power off\n");
+        goto fail;
+    }
     workloop = getWorkLoop();
-	if ((workloop == NULL) || (workloop->addEventSource(serialTimer) != kIOReturnSuccess))
-	{
-		IOLog("start - failed to connect timer for chatpad\n");
-		goto fail;
-	}
+    if ((workloop == NULL) || (workloop->addEventSource(powerOffTimer) != kIOReturnSuccess))
+    {
+        IOLog("start - failed to connect timer for power off\n");
+        goto fail;
+    }
+
+    telemetryTimer = IOTimerEventSource::timerEventSource(this, TelemetryTimerActionWrapper);
+    if ((telemetryTimer == NULL) || (workloop->addEventSource(telemetryTimer) != kIOReturnSuccess))
+    {
+        IOLog("start - failed to create timer for telemetry\n");
+        goto fail;
+    }
+
+    // A returning controller gets back the settings it had last time, and may
+    // be live before its info packet arrives
+    if (device->GetCachedSerial()[0] != '\0')
+    {
+        strlcpy(serialString, device->GetCachedSerial(), sizeof(serialString));
+        if (device->GetCachedSettings() != NULL)
+            setProperties(device->GetCachedSettings());
+        if (device->GetCachedLED() != -1)
+            SetLEDs(device->GetCachedLED());
+    }
 
     device->RegisterWatcher(this, _receivedData, NULL);
+    device->RegisterPacketHandler(this, _receivedPacket);
 
     device->SendPacket(weirdStart, sizeof(weirdStart));
 
-    serialTimer->setTimeoutMS(1000);
+    // The receiver keeps the records while the controller is away, so a
+    // returning one starts with its history
+    PublishTelemetry();
+
+    if (powerOffTimeout != 0)
+        powerOffTimer->wakeAtTime(PowerOffDeadline());
 
     return true;
 
@@ -146,15 +353,32 @@ void WirelessHIDDevice::handleStop(IOService *provider)
     WirelessDevice *device = OSDynamicCast(WirelessDevice, provider);
 
     if (device != NULL)
+    {
+        device->RegisterPacketHandler(NULL, NULL);
         device->RegisterWatcher(NULL, NULL, NULL);
+    }
 
-    if (serialTimer != NULL) {
-        serialTimer->cancelTimeout();
+    if (telemetryTimer != NULL) {
+        telemetryTimer->cancelTimeout();
         IOWorkLoop *workloop = getWorkLoop();
         if (workloop != NULL)
-            workloop->removeEventSource(serialTimer);
-        serialTimer->release();
-        serialTimer = NULL;
+            workloop->removeEventSource(telemetryTimer);
+        telemetryTimer->release();
+        telemetryTimer = NULL;
+    }
+
+    if (powerOffTimer != NULL) {
+        powerOffTimer->cancelTimeout();
+        IOWorkLoop *workloop = getWorkLoop();
+        if (workloop != NULL)
+            workloop->removeEventSource(powerOffTimer);
+        powerOffTimer->release();
+        powerOffTimer = NULL;
+    }
+
+    if (report != NULL) {
+        report->release();
+        report = NULL;
     }
 
     super::handleStop(provider);
@@ -163,35 +387,32 @@ void WirelessHIDDevice::handleStop(IOService *provider)
 // Handle new data from the device
 void WirelessHIDDevice::receivedData(void)
 {
-    IOMemoryDescriptor *data;
+    unsigned char data[WIRELESS_PACKET_SIZE];
+    int length;
     WirelessDevice *device = OSDynamicCast(WirelessDevice, getProvider());
     if (device == NULL)
         return;
 
-    while ((data = device->NextPacket()) != NULL)
+    for (;;)
     {
-        receivedMessage(data);
-        data->release();
+        length = sizeof(data);
+        if (!device->NextPacket(data, &length))
+            break;
+        receivedMessage(data, length);
     }
 }
 
 const char *HexData = "0123456789ABCDEF";
 
 // Process new data
-void WirelessHIDDevice::receivedMessage(IOMemoryDescriptor *data)
+void WirelessHIDDevice::receivedMessage(unsigned char *buf, int length)
 {
-    unsigned char buf[29];
-
-    if (data->getLength() != 29)
+    if (length != 29)
         return;
 
-    data->readBytes(0, buf, 29);
-
-    switch (buf[1])
+    switch (WirelessLink::classify(buf, length))
     {
-        case 0x0f:  // Initial info
-            if (buf[16] == 0x13)
-                receivedUpdate(0x13, buf + 17);
+        case WirelessLink::pkInfo:      // Initial info
             serialString[0] = HexData[(buf[0x0A] & 0xF0) >> 4];
             serialString[1] = HexData[buf[0x0A] & 0x0F];
             serialString[2] = HexData[(buf[0x0B] & 0xF0) >> 4];
@@ -202,14 +423,23 @@ void WirelessHIDDevice::receivedMessage(IOMemoryDescriptor *data)
             serialString[7] = HexData[buf[0x0D] & 0x0F];
             serialString[8] = '\0';
             IOLog("Got serial number: %s", serialString);
+            {
+                WirelessDevice *device = OSDynamicCast(WirelessDevice, getProvider());
+                if (device != NULL)
+                    device->RememberSerial(serialString);
+            }
+            // The receiver records the connection once it knows the serial
+            ArmTelemetry();
+            if (buf[16] == 0x13)
+                receivedUpdate(0x13, buf + 17);
             break;
 
-        case 0x01:  // HID info update
+        case WirelessLink::pkHID:       // HID info update
             if (buf[3] == 0xf0)
                 receivedHIDupdate(buf + 4, buf[5]);
             break;
 
-        case 0x00:  // Info update
+        case WirelessLink::pkUpdate:    // Info update
             receivedUpdate(buf[3], buf + 4);
             break;
 
@@ -224,6 +454,8 @@ void WirelessHIDDevice::receivedUpdate(unsigned char type, unsigned char *data)
     switch (type)
     {
         case 0x13:  // Battery level
+            if (batteryKnown && (battery == data[0]))
+                break;
             battery = data[0];
             {
                 OSObject *prop = OSNumber::withNumber(battery, 8);
@@ -233,6 +465,22 @@ void WirelessHIDDevice::receivedUpdate(unsigned char type, unsigned char *data)
                     prop->release();
                 }
             }
+            if (!batteryKnown)
+            {
+                batteryKnown = true;
+                batteryFirst = battery;
+                clock_get_uptime(&batteryFirstTime);
+            }
+            else if (battery < batteryFirst)
+            {
+                UInt64 now, ns;
+
+                clock_get_uptime(&now);
+                absolutetime_to_nanoseconds(now - batteryFirstTime, &ns);
+                if (ns != 0)
+                    setProperty(kIOWirelessDrainRate, ((batteryFirst - battery) * 3600000000000ULL) / ns, 32);
+            }
+            RecordTelemetry(kTelemetryBattery, battery);
             break;
 
         default:
@@ -244,12 +492,16 @@ void WirelessHIDDevice::receivedUpdate(unsigned char type, unsigned char *data)
 void WirelessHIDDevice::receivedHIDupdate(unsigned char *data, int length)
 {
     IOReturn err;
-    IOMemoryDescriptor *report;
 
-    serialTimerCount = 0;
-    report = IOMemoryDescriptor::withAddress(data, length, kIODirectionNone);
+    clock_get_uptime(&lastActivity);
+    if (telemetryArmed == 0)
+        ArmTelemetry();
+    OSIncrementAtomic(&rateReports);
+    if ((report == NULL) || (length > WIRELESS_PACKET_SIZE))
+        return;
+    report->setLength(length);
+    report->writeBytes(0, data, length);
     err = handleReport(report);
-    report->release();
     if (err != kIOReturnSuccess)
         IOLog("handleReport return: 0x%.8x\n", err);
 }
@@ -260,6 +512,12 @@ void WirelessHIDDevice::_receivedData(void *target, WirelessDevice *sender, void
     ((WirelessHIDDevice*)target)->receivedData();
 }
 
+// Wrapper for packets delivered straight from the receiver
+void WirelessHIDDevice::_receivedPacket(void *target, WirelessDevice *sender, unsigned char *data, int length)
+{
+    ((WirelessHIDDevice*)target)->receivedMessage(data, length);
+}
+
 // Get a location ID for this device, as some games require it
 OSNumber* WirelessHIDDevice::newLocationIDNumber() const
 {
@@ -24,6 +24,15 @@
 #define __WIRELESSHIDDEVICE_H__
 
 #include <IOKit/hid/IOHIDDevice.h>
+#include <IOKit/IOBufferMemoryDescriptor.h>
+
+#include "devices.h"
+
+// Milliseconds between report rate samples while reports arrive, the
+// telemetry is published at most this often
+#define WIRELESS_TELEMETRY_INTERVAL 5000
+// Smallest change in reports per second that's recorded
+#define WIRELESS_RATE_THRESHOLD 10
 
 class WirelessDevice;
 
@@ -31,6 +40,8 @@ class WirelessHIDDevice : public IOHIDDevice
 {
     OSDeclareDefaultStructors(WirelessHIDDevice);
 public:
+    bool init(OSDictionary *dictionary = 0);
+
     void SetLEDs(int mode);
     void PowerOff(void);
     unsigned char GetBatteryLevel(void);
@@ -43,17 +54,44 @@ protected:
     bool handleStart(IOService *provider);
     void handleStop(IOService *provider);
     virtual void receivedData(void);
-    virtual void receivedMessage(IOMemoryDescriptor *data);
+    virtual void receivedMessage(unsigned char *data, int length);
     virtual void receivedUpdate(unsigned char type, unsigned char *data);
     virtual void receivedHIDupdate(unsigned char *data, int length);
+
+    void SetPowerOffTimeout(UInt32 seconds);
 private:
     static void _receivedData(void *target, WirelessDevice *sender, void *parameter);
-    static void ChatPadTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender);
+    static void _receivedPacket(void *target, WirelessDevice *sender, unsigned char *data, int length);
+    static void PowerOffTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender);
+    void PowerOffTimerAction(IOTimerEventSource *sender);
+    UInt64 PowerOffDeadline(void);
 
-	IOTimerEventSource *serialTimer;
-    int serialTimerCount;
+    static void TelemetryTimerActionWrapper(OSObject *owner, IOTimerEventSource *sender);
+    void TelemetryTimerAction(IOTimerEventSource *sender);
+    void RecordTelemetry(UInt32 type, UInt32 value);
+    void ArmTelemetry(void);
+    void PublishTelemetry(void);
+    bool SampleReportRate(UInt64 now);
+
+    IOTimerEventSource *powerOffTimer;
+    UInt32 powerOffTimeout;             // Seconds without input before turning the pad off, 0 to disable
+    UInt64 lastActivity;                // Absolute time of the last input report
+
+    IOBufferMemoryDescriptor *report;   // Reused for every input report
 
     unsigned char battery;
+    bool batteryKnown;
+    unsigned char batteryFirst;         // First level since connecting, for the drain rate
+    UInt64 batteryFirstTime;
+
+    // Telemetry, the records themselves are kept by the receiver
+    IOTimerEventSource *telemetryTimer; // Samples the report rate and publishes the records
+    volatile UInt32 telemetryArmed;     // The timer is running, it lapses once the pad goes quiet
+    UInt32 telemetryPublished;          // Records added as of the last publish
+    UInt64 rateWindow;                  // Start of the report rate window
+    volatile SInt32 rateReports;        // Reports so far, only ever counts up
+    SInt32 rateCounted;                 // The count at the start of the window
+    UInt32 reportRate, droppedPackets;
     char serialString[10];
 };
 
@@ -23,8 +23,36 @@
 #ifndef __DEVICES_H__
 #define __DEVICES_H__
 
+#include <IOKit/IOMessage.h>
+
 #define kIOWirelessDeviceType   "Wireless360Device"
 
 #define kIOWirelessBatteryLevel "BatteryLevel"
 
+// Recent events, an array of WIRELESS_TELEMETRY oldest first
+// The receiver keeps them for as long as it remembers the controller, so
+// they carry on across reconnections
+#define kIOWirelessTelemetry    "Telemetry"
+// Records kept per controller
+#define WIRELESS_TELEMETRY_SIZE 32
+// Battery level units lost per hour since the pad connected
+#define kIOWirelessDrainRate    "BatteryDrainRate"
+
+// Sent to interested clients when records have been added, at most every few seconds
+#define kIOWirelessTelemetryChanged     iokit_vendor_specific_msg(0x13)
+
+typedef enum WIRELESS_TELEMETRY_TYPE {
+    kTelemetryBattery = 1,      // value: battery level
+    kTelemetryConnect,
+    kTelemetryDisconnect,       // Seen once the controller connects again
+    kTelemetryReportRate,       // value: reports per second, rounded to 5
+    kTelemetryDropped,          // value: packets dropped so far
+} WIRELESS_TELEMETRY_TYPE;
+
+typedef struct WIRELESS_TELEMETRY {
+    UInt64 time;                // Nanoseconds since boot
+    UInt32 type;
+    UInt32 value;
+} WIRELESS_TELEMETRY;
+
 #endif // __DEVICES_H__
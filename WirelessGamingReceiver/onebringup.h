@@ -0,0 +1,967 @@
+/*
+ MICE Xbox 360 Controller driver for Mac OS X
+ Copyright (C) 2006-2013 Colin Munro
+ 
+ onebringup.h - steps that bring up the Xbox One wireless receiver
+ 
+ This file is part of Xbox360Controller.
+ 
+ Xbox360Controller is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+ 
+ Xbox360Controller is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with Foobar; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef __ONEBRINGUP_H__
+#define __ONEBRINGUP_H__
+
+#include "onefirmware.h"
+
+// The receiver is brought up by replaying what the Windows driver was seen to
+// do, in order. Only include from OneWirelessGamingReceiver.cpp and the host
+// test of the table, it defines the data.
+
+// What a step does
+#define ONE_STEP_IN                 0   // Vendor read, a different response is only logged
+#define ONE_STEP_OUT                1   // Vendor write
+#define ONE_STEP_FIRMWARE           2   // Bulk upload, waits until the pipe has taken it all
+#define ONE_STEP_SEND               3   // Bulk message, doesn't wait for it
+#define ONE_STEP_WAIT               4   // Only the delay
+
+// The response differs between receivers, such as their address, so it's not compared
+#define ONE_STEP_UNCHECKED          0x01
+// The response is a status the receiver has to reach, the read is tried again until it does
+#define ONE_STEP_POLL               0x02
+
+typedef struct OneStep
+{
+    UInt8 type;
+    UInt8 flags;
+    UInt8 request;
+    UInt16 value;
+    UInt16 index;
+    const unsigned char *data;      // Written, or expected back
+    UInt16 length;
+    UInt16 delay;                   // Milliseconds to wait before each transfer
+    UInt16 count;                   // Transfers, 0 is the same as 1
+    UInt16 stride;                  // Added to the index for each further transfer
+} OneStep;
+
+#define ONE_BYTES(s)                (const unsigned char*)(s), sizeof(s) - 1
+
+static const OneStep kOneBringUp[] = {
+    // type              flags           request  value   index   data, delay, count, stride
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x09\x88\x30\x81") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x09\x88\x40\xc0") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x14\x88\x40\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x002c, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x14\x88\x40\x80") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x14\x88\x40\xc0") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x14\x88\x40\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0030, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0000, ONE_BYTES("\x44\x00\x32\x76") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x1000, ONE_BYTES("\x00\x30\x62\x76") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0080, ONE_BYTES("\x09\x02\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x014c, ONE_BYTES("\x00\x14\x1f\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0080, ONE_BYTES("\x0f\x02\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x014c, ONE_BYTES("\x00\x14\x1f\x00") },
+    { ONE_STEP_IN,       0,                   71, 0x0000, 0x0230, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x9018, ONE_BYTES("\x18\x38\xe4\x00") },
+    { ONE_STEP_IN,       0,                   71, 0x0000, 0x9018, ONE_BYTES("\x18\x38\xe4\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0800, ONE_BYTES("\x01\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x09a0, ONE_BYTES("\x30\x02\x40\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x09a4, ONE_BYTES("\x01\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x09a8, ONE_BYTES("\x01\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x09c4, ONE_BYTES("\x44\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0a6c, ONE_BYTES("\x03\x00\x00\x00") },
+
+    // write the first chunck of firmware
+    // identifier for the chunck of firmware
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0230, ONE_BYTES("\x40\x00\x08\x00") },
+    // ready to receive firmware?
+    { ONE_STEP_IN,       ONE_STEP_POLL,       71, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x00\x00") },
+    // here comes one big chunk of firmware!
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x00\x38") },
+
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, firmware1, sizeof(firmware1) },
+
+    // write the second chunck of firmware
+    // check that firmware has been received? //this packet type should be checked untill the proper code is received
+    { ONE_STEP_IN,       ONE_STEP_POLL,       71, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x00\xf8") },
+
+    // identifier for the chunck of firmware
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0230, ONE_BYTES("\x40\x38\x08\x00") },
+    // check again that firmware has been received/ready to receive new firmware chunk
+    { ONE_STEP_IN,       ONE_STEP_POLL,       71, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x00\xf8") },
+    // here comes one big chunk of firmware!
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x00\x38") },
+
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, firmware2, sizeof(firmware2) },
+
+    // write third chunck of firmware
+    // check that firmware has been received?
+    { ONE_STEP_IN,       ONE_STEP_POLL,       71, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x00\xf8") },
+    // identifier for the chunck of firmware
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0230, ONE_BYTES("\x40\x70\x08\x00") },
+    // check again that firmware has been received/ready to receive new firmware chunk
+    { ONE_STEP_IN,       ONE_STEP_POLL,       71, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x00\xf8") },
+    // here comes one big chunk of firmware!
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x00\x38") },
+
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, firmware3, sizeof(firmware3) },
+
+    // write fourth chunck of firmware
+    // check that firmware has been received?
+    { ONE_STEP_IN,       ONE_STEP_POLL,       71, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x00\xf8") },
+    // identifier for the chunck of firmware
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0230, ONE_BYTES("\x40\xa8\x08\x00") },
+    // check again that firmware has been received/ready to receive new firmware chunk
+    { ONE_STEP_IN,       ONE_STEP_POLL,       71, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x00\xf8") },
+    // here comes one big chunk of firmware!
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x00\x38") },
+
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, firmware4, sizeof(firmware4) },
+
+    // write fith chunck of firmware
+    // check that firmware has been received?
+    { ONE_STEP_IN,       ONE_STEP_POLL,       71, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x00\xf8") },
+    // identifier for the chunck of firmware
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0230, ONE_BYTES("\x40\xe0\x08\x00") },
+    // check again that firmware has been received/ready to receive new firmware chunk
+    { ONE_STEP_IN,       ONE_STEP_POLL,       71, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x00\xf8") },
+    // why did it change? does it have another function?
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x78\x0d") },
+
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, firmware5, sizeof(firmware5) },
+
+    // write sixth chunck of firmware
+    // check that firmware has been received?
+    { ONE_STEP_IN,       ONE_STEP_POLL,       71, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x78\xcd") },
+    // identifier for the chunck of firmware
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0230, ONE_BYTES("\x00\x08\x11\x00") },
+    // check again that firmware has been received/ready to receive new firmware chunk
+    { ONE_STEP_IN,       ONE_STEP_POLL,       71, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x78\xcd") },
+    // why did it change? does it have another function?
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0234, ONE_BYTES("\x00\x00\xa0\x23") },
+
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, firmware6, sizeof(firmware6) },
+
+    // write seventh chunck of firmware
+    // check that firmware has been received?
+    { ONE_STEP_IN,       ONE_STEP_POLL,       71, 0x0000, 0x0234, ONE_BYTES("\x00\x00\xa0\xe3") },
+    // identifier for the chunck of firmware
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0230, ONE_BYTES("\x00\x00\x08\x00") },
+    // check again that firmware has been received/ready to receive new firmware chunk
+    { ONE_STEP_IN,       ONE_STEP_POLL,       71, 0x0000, 0x0234, ONE_BYTES("\x00\x00\xa0\xe3") },
+    // why did it change? does it have another function?
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x40\x00") },
+
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, ONE_BYTES("\x40\x00\x00\x10\x46\x00\x00\x8e\x58\x00\x05\x34\x4a\x00\x00\x00"
+                                                                            "\x80\x9e\x46\x00\x01\x10\x58\x00\x08\x00\x46\x10\x01\x10\x58\x10"
+                                                                            "\x88\x00\x46\x20\x01\x12\x58\x21\x0b\xa0\x40\x31\x04\x01\x40\x00"
+                                                                            "\x0c\x00\x3a\x10\x04\x1c\x3a\x11\x04\x3c\x50\x31\xff\xfc\x4e\x36"
+                                                                            "\xff\xfa\x64\x00\x00\x00\x00\x00") },
+
+    // not firmware per se (IMHO), but still part of initialization
+    // write eigth chunck of firmware
+    // check that firmware has been received?
+    { ONE_STEP_IN,       ONE_STEP_POLL,       71, 0x0000, 0x0234, ONE_BYTES("\x00\x00\x40\xc0") },
+    // finish writing firmware?
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0230, ONE_BYTES("\x00\x00\x00\x00") },
+
+    // ?? clear something?
+    { ONE_STEP_OUT,      0,                    1, 0x0012, 0x0000, NULL, 0 },
+
+    // ??
+    { ONE_STEP_IN,       0,                   71, 0x0000, 0x0230, ONE_BYTES("\x00\x00\x00\x00") },
+    // ?? (tripple retry)
+    // <- might have solved the need for tripple retry..
+    { ONE_STEP_IN,       ONE_STEP_POLL,       71, 0x0000, 0x0230, ONE_BYTES("\x01\x00\x00\x00"), 100 },
+
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\x11\x50\x01\x00\x00\x00\x01\x00\x00\x00\x00\x00\x00\x00") },
+
+    // write nineth chunck of firmware
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, ONE_BYTES("\x04\x00\x42\x51\x31\x00\x00\x00\x00\x00\x00\x00") },
+
+    // write tenth chunck of firmware
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, ONE_BYTES("\x04\x00\x23\x50\x02\x00\x00\x00\x00\x00\x00\x00") },
+
+    // need to read from endpoint 5.. 3 packets..
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0038, ONE_BYTES("\x98\x02\x3b\x01") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0038, ONE_BYTES("\x98\x02\x3b\x01") },
+
+    // now there are a shitload of packets that I have no idea what are used for..
+    //1.pcap - 212
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1004, ONE_BYTES("\x03\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0238, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1004, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1204, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0070, ONE_BYTES("\x64\x64\x00\x6b") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0208, ONE_BYTES("\x70\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0214, ONE_BYTES("\x73\x22\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0218, ONE_BYTES("\x44\x23\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x021c, ONE_BYTES("\xaa\x34\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0230, ONE_BYTES("\x00\x12\x04\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0250, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0400, ONE_BYTES("\x00\x0c\x08\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0408, ONE_BYTES("\x1f\x1f\xbf\x1f") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0800, ONE_BYTES("\x01\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1004, ONE_BYTES("\x0c\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1404, ONE_BYTES("\x13\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1018, ONE_BYTES("\xff\x3f\x3e\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1030, ONE_BYTES("\x55\x98\xfc\xff") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1034, ONE_BYTES("\xff\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1104, ONE_BYTES("\x09\x01\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1204, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1300, ONE_BYTES("\x20\x43\x06\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1304, ONE_BYTES("\x00\x47\x0a\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1308, ONE_BYTES("\x38\x32\x04\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x130c, ONE_BYTES("\x2f\x21\x03\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1328, ONE_BYTES("\x0f\x0f\x15\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1330, ONE_BYTES("\x01\x10\x10\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1334, ONE_BYTES("\x00\x00\x01\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1340, ONE_BYTES("\x3f\x58\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1344, ONE_BYTES("\x20\x2b\x09\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1348, ONE_BYTES("\x90\x0f\x0a\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x134c, ONE_BYTES("\x0f\x1f\xd0\x47") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1364, ONE_BYTES("\x03\x00\xf4\x03") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1368, ONE_BYTES("\x03\x00\xf4\x03") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x136c, ONE_BYTES("\x04\x20\x74\x01") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1374, ONE_BYTES("\x04\x20\x74\x01") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1378, ONE_BYTES("\x84\x20\xf4\x03") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1380, ONE_BYTES("\xdc\x00\x2c\x00") },
+    //next: 326
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13a0, ONE_BYTES("\x3c\x3c\x3c\x3c") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13a4, ONE_BYTES("\x3c\x3c\x3c\x3c") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13a8, ONE_BYTES("\x00\x0a\x16\x22") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13ac, ONE_BYTES("\x76\x0a\x16\x22") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13b0, ONE_BYTES("\x18\x18\x3f\x3f") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13c0, ONE_BYTES("\x06\x06\x00\x80") },
+    //next: 344
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13e0, ONE_BYTES("\x04\x20\xf5\xe3") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13e4, ONE_BYTES("\x84\x20\xf5\xe3") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13e8, ONE_BYTES("\x04\x21\xf5\xe3") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13ec, ONE_BYTES("\xff\x0f\x06\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1400, ONE_BYTES("\x9f\x5f\x01\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1408, ONE_BYTES("\x7f\x01\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x140c, ONE_BYTES("\x03\x80\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x150c, ONE_BYTES("\x02\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1608, ONE_BYTES("\x02\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13e0, ONE_BYTES("\x04\x20\xf4\xe3") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13e4, ONE_BYTES("\x84\x20\xf4\xe3") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13e8, ONE_BYTES("\x04\x21\xf4\xe3") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1264, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1228, ONE_BYTES("\x00\x00\x00\xee") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x122c, ONE_BYTES("\x00\x00\x00\xee") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13a0, ONE_BYTES("\x3c\x3c\x3c\x0f") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13a4, ONE_BYTES("\x3c\x3c\x3c\x0f") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0404, ONE_BYTES("\xf5\xbc\xfe\x1e") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0a38, ONE_BYTES("\x0a\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0504, ONE_BYTES("\x00\x00\x00\x7f") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x050c, ONE_BYTES("\x00\x00\x80\x1a") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0xa800, ONE_BYTES("\x01\x00\x00\x00"), 10, 256, 4 },
+
+    //next:1175
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x1100, ONE_BYTES("\x0a\x10\xa4\x33") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1100, ONE_BYTES("\x0a\x0e\xa4\x33") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x041c, ONE_BYTES("\x00\x08\x10\x18") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0420, ONE_BYTES("\x20\x28\x30\x38") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0424, ONE_BYTES("\x40\x48\x50\x58") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0428, ONE_BYTES("\x60\x68\x70\x78") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x080c, ONE_BYTES("\x33\x02\xff\x03") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x080c, ONE_BYTES("\x23\x02\xff\x03") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x1344, ONE_BYTES("\x20\x2b\x09\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1344, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x1200, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x7028, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x7010, ONE_BYTES("\x00\x00\x00\x00") },
+
+    { ONE_STEP_WAIT,     0,                    0, 0x0000, 0x0000, NULL, 0, 100 },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1800, ONE_BYTES("\xff\xff\xff\xff\xff\xff\x00\x00"), 10, 254, 8 },
+    // a check?
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x1114, ONE_BYTES("\x40\x06\x00\x00") },
+    //next:1979
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1114, ONE_BYTES("\x40\x06\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x1700, ONE_BYTES("\x02\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x1704, ONE_BYTES("\xa2\x0a\x01\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x1708, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x170c, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x1710, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x1714, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1340, ONE_BYTES("\x3f\x58\x00\x00") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x03\x88\xc0\x81") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x03\x88\xc0\x81") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x03\x88\x00\xc0") },
+
+    // The receiver's address, this is the one the trace was taken from
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x18\x88\x00\x80") },
+    { ONE_STEP_IN,       ONE_STEP_UNCHECKED,   7, 0x0000, 0x002c, ONE_BYTES("\x62\x45\xb4\xea") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x18\x88\x00\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x18\x88\x00\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x18\x88\x00\x80") },
+    { ONE_STEP_IN,       ONE_STEP_UNCHECKED,   7, 0x0000, 0x002c, ONE_BYTES("\x62\x45\xb4\xea") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x18\x88\x00\x80") },
+    //next:2033
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x18\x88\x00\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x18\x88\x00\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0030, ONE_BYTES("\xf7\x58\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x18\x88\x00\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x18\x88\x30\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x15\x88\x30\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x002c, ONE_BYTES("\x12\xff\x02\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x15\x88\x30\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x15\x88\x30\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x15\x88\x30\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x002c, ONE_BYTES("\x12\xff\x02\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x15\x88\x30\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x15\x88\xf0\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0028, ONE_BYTES("\xff\xff\x14\x10") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0028, ONE_BYTES("\xff\xff\x14\x10") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x002c, ONE_BYTES("\x14\x10\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\xc0") },
+    //next:2108
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x002c, ONE_BYTES("\x14\x10\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0030, ONE_BYTES("\x00\xff\xff\xff") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0030, ONE_BYTES("\x00\xff\xff\xff") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0034, ONE_BYTES("\xff\xff\xff\xff") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+    //next:2153
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0034, ONE_BYTES("\xff\xff\xff\xff") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\x30\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x15\x88\x30\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0030, ONE_BYTES("\xff\xff\x27\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x15\x88\x30\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x15\x88\x90\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+    // this diverges!!!! from a 3'rd party scan: 0000002d
+    // from my scan: 00000034
+    // don't know if these are machine based, or different on each scan..
+    // so we'll do nothing if values doesn't match..
+    { ONE_STEP_IN,       ONE_STEP_UNCHECKED,   7, 0x0000, 0x0034, ONE_BYTES("\x00\x00\x00\x34") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+    // same as before
+    { ONE_STEP_IN,       ONE_STEP_UNCHECKED,   7, 0x0000, 0x0034, ONE_BYTES("\x00\x00\x00\x34") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0114, ONE_BYTES("\x00\x00\x00\x00") },
+    // this is specific, needs to be the previous value (just one byte?)
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0114, ONE_BYTES("\x00\x34\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0118, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0118, ONE_BYTES("\x00\x7f\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0020, ONE_BYTES("\xff\xe7\x91\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0020, ONE_BYTES("\xff\xa7\x91\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x50\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x1b\x88\x50\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0030, ONE_BYTES("\x1f\x00\xc1\xc1") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x1b\x88\x50\x80") },
+    //next:2231
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x1b\x88\x50\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x1b\x88\x50\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0030, ONE_BYTES("\x1f\x00\xc1\xc1") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x1b\x88\x50\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x1b\x88\x50\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x1b\x88\x50\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0034, ONE_BYTES("\x00\x00\x26\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x1b\x88\x50\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x1b\x88\x60\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0028, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x002c, ONE_BYTES("\x27\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x002c, ONE_BYTES("\x27\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\x80") },
+    // diverges compared to a 3rd party scan: 00290081
+    { ONE_STEP_IN,       ONE_STEP_UNCHECKED,   7, 0x0000, 0x0030, ONE_BYTES("\x00\x28\x00\x81") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\x80") },
+    { ONE_STEP_IN,       ONE_STEP_UNCHECKED,   7, 0x0000, 0x0030, ONE_BYTES("\x00\x28\x00\x81") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\x80") },
+    //2315
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0034, ONE_BYTES("\x00\x00\x29\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x60\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x13\x88\x70\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0028, ONE_BYTES("\x00\x00\x00\x27") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0028, ONE_BYTES("\x00\x00\x00\x27") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x002c, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\x80") },
+    //next:2363
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0030, ONE_BYTES("\x27\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0030, ONE_BYTES("\x27\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\x80") },
+    // this diverges, 3rd party scan: 00240000
+    { ONE_STEP_IN,       ONE_STEP_UNCHECKED,   7, 0x0000, 0x0034, ONE_BYTES("\x00\x22\x00\x82") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\x80") },
+    // same as before
+    { ONE_STEP_IN,       ONE_STEP_UNCHECKED,   7, 0x0000, 0x0034, ONE_BYTES("\x00\x22\x00\x82") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x70\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x12\x88\x80\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0028, ONE_BYTES("\x00\x00\x27\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\x80") },
+    //next:2423
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x002c, ONE_BYTES("\x00\x00\x00\x2b") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x002c, ONE_BYTES("\x00\x00\x00\x2b") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0030, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0034, ONE_BYTES("\x29\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\x80") },
+    //next:2471
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0034, ONE_BYTES("\x29\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x80\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x90\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0028, ONE_BYTES("\x00\x27\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x11\x88\x90\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0028, ONE_BYTES("\x00\x27\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x002c, ONE_BYTES("\x00\x00\x27\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+    //next:2519
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0030, ONE_BYTES("\x00\x00\x00\x26") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0030, ONE_BYTES("\x00\x00\x00\x26") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+    // diverges, 3rd party scan: 0000002d
+    { ONE_STEP_IN,       ONE_STEP_UNCHECKED,   7, 0x0000, 0x0034, ONE_BYTES("\x00\x00\x00\x34") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x10\x88\x90\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x10\x88\xf0\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0028, ONE_BYTES("\xff\xff\x14\x10") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x002c, ONE_BYTES("\x14\x10\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\xf0\x80") },
+    //next:2579 ->(in test_no_press: 2695)
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x0d\x88\x50\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x1b\x88\x50\x80") },
+    // diverges, 3rd party scan: 22bc0000
+    { ONE_STEP_IN,       ONE_STEP_UNCHECKED,   7, 0x0000, 0x002c, ONE_BYTES("\x22\xb6\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x1b\x88\x50\x80") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0024, ONE_BYTES("\x1b\x88\x50\xc0") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x1b\x88\x50\x80") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0028, ONE_BYTES("\x00\x00\x00\x22") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x2714, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x2714, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x293c, ONE_BYTES("\x1c\x1b\xf2\xc8") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x293c, ONE_BYTES("\x18\x1b\xf2\xc8") },
+    //next:2612
+    // THIS IS NOT ACTUAL FIRMWARE!!!
+    // these section diverges between 3rd party scans!!!!
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, ONE_BYTES("\x0c\x00\x84\x50\x08\x10\x41\x00\x62\x45\xb4\xea\x2d\x59\x00\x00"
+                                                                            "\x00\x00\x00\x00") },
+
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, ONE_BYTES("\x0c\x00\x85\x50\x10\x10\x41\x00\x62\x45\xb4\xea\x2d\x59\x00\x00"
+                                                                            "\x00\x00\x00\x00") },
+
+    //next:2615
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0080, ONE_BYTES("\x0f\x02\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x141c, ONE_BYTES("\xe4\xff\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x141c, ONE_BYTES("\xe4\xf0\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x110c, ONE_BYTES("\x1e\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x110c, ONE_BYTES("\x1e\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                   71, 0x0000, 0x0120, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0120, ONE_BYTES("\x10\x10\x00\x00") },
+    { ONE_STEP_IN,       0,                   71, 0x0000, 0x0128, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x0128, ONE_BYTES("\x00\x10\x00\x00") },
+    { ONE_STEP_IN,       0,                   71, 0x0000, 0x01b8, ONE_BYTES("\xff\xff\xf7\xff") },
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x01b8, ONE_BYTES("\xf5\xff\xf7\xff") },
+
+    // NOT ACTUAL FIRMWARE
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, ONE_BYTES("\x10\x00\xc6\x50\x20\x23\x41\x00\xfa\x5e\x36\x18\x24\x23\x41\x00"
+                                                                            "\xfa\x5e\x36\x18\x00\x00\x00\x00") },
+
+    //next:2651
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x1340, ONE_BYTES("\x3f\x58\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1340, ONE_BYTES("\x3f\x58\x10\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x110c, ONE_BYTES("\x1e\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x110c, ONE_BYTES("\x5f\x01\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x141c, ONE_BYTES("\xe4\xf0\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x2308, ONE_BYTES("\x14\x14\x00\x00") },
+
+    //next:2669
+    // NOT ACTUAL FIRMWARE
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, ONE_BYTES("\x0c\x00\x37\x50\x00\x00\x00\x00\x62\x45\xb4\xea\x2d\x59\x00\x00"
+                                                                            "\x00\x00\x00\x00") },
+
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\x38\x50\x03\x00\x00\x00\x03\x00\x00\x00\x00\x00\x00\x00") },
+
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\x39\x50\x05\x00\x00\x00\x40\x00\x00\x00\x00\x00\x00\x00") },
+
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\x8a\x50\x24\x04\x41\x00\x40\x48\x50\x58\x00\x00\x00\x00") },
+
+    { ONE_STEP_FIRMWARE, 0,                    0, 0x0000, 0x0000, ONE_BYTES("\x3c\x00\x8b\x50\x00\xd4\x41\x00\x00\x00\x00\x20\x03\x00\x24\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x62\x45\xb4\xea\x2d\x59\x62\x45\xb4\xea"
+                                                                            "\x2d\x59\x00\x00\x00\x00\x10\x01\x00\x0f\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00") },
+
+    //next:2678
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x1104, ONE_BYTES("\x09\x01\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1104, ONE_BYTES("\x09\x01\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1004, ONE_BYTES("\x04\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x9018, ONE_BYTES("\x18\x38\xe4\x00") },
+    { ONE_STEP_IN,       0,                   71, 0x0000, 0x9018, ONE_BYTES("\x18\x38\xe4\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x1004, ONE_BYTES("\x04\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1400, ONE_BYTES("\x17\x7f\x01\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1004, ONE_BYTES("\x0c\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                   70, 0x0000, 0x9018, ONE_BYTES("\x18\x38\xe4\x00") },
+    { ONE_STEP_IN,       0,                   71, 0x0000, 0x9018, ONE_BYTES("\x18\x38\xe4\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x1004, ONE_BYTES("\x0c\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1004, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1330, ONE_BYTES("\x01\x10\x10\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1334, ONE_BYTES("\x00\x00\x01\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13a0, ONE_BYTES("\x3c\x3c\x3c\x0f") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13a4, ONE_BYTES("\x3c\x3c\x3c\x0f") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x2378, ONE_BYTES("\x06\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x2378, ONE_BYTES("\x02\x00\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x13c0, ONE_BYTES("\x06\x06\x00\x80") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x13c0, ONE_BYTES("\x06\x06\x00\x00") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x200c, ONE_BYTES("\x0a\x03\x00\x87") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x200c, ONE_BYTES("\x0a\x03\x00\x86") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0504, ONE_BYTES("\x00\x00\x00\x00") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x050c, ONE_BYTES("\x00\x00\x00\x00") },
+
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x1b\x88\x50\x80") },
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x0023, ONE_BYTES("\x1b\x88\x50\xc0") },
+    { ONE_STEP_IN,       0,                    7, 0x0000, 0x0024, ONE_BYTES("\x1b\x88\x50\x80") },
+    // diverges from a 3rd party scan:22bc0000
+    { ONE_STEP_IN,       ONE_STEP_UNCHECKED,   7, 0x0000, 0x002c, ONE_BYTES("\x22\xb6\x00\x00") },
+
+    //next:2763 (2846)
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\xfc\x51\x02\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\xfd\x51\x03\x00\x00\x00\x01\x00\x00\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\xfe\x51\x04\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00") },
+
+    { ONE_STEP_OUT,      0,                    6, 0x0000, 0x1004, ONE_BYTES("\x0c\x00\x00\x00") },
+
+    // this diverges from 3rd party scans
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xe1\x51\x01\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x20\x01\x10\x00\x00\x00\x00") },
+
+    // also diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xe2\x51\x24\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x01\x2a\x01\x10\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xe3\x51\x34\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x01\x2b\x01\x10\x00\x00\x00\x00") },
+
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\xf4\x51\x02\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xe5\x51\x64\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x02\x27\x01\x10\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x10\x00\xa6\x50\xb4\x13\x41\x00\x20\x7b\x3c\xed\xa8\x13\x41\x00"
+                                                                            "\xe0\x85\x20\xf4\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xe7\x51\x78\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x02\x27\x01\x10\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x10\x00\xc8\x50\xb4\x13\x41\x00\x01\x00\xa4\x89\xa8\x13\x41\x00"
+                                                                            "\x01\x04\x0f\x1b\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xe9\x51\x95\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x02\x22\x01\x10\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xea\x51\x01\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x20\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\x3b\x50\x06\x00\x00\x00\x40\x00\x00\x00\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\x8c\x50\x14\x11\x41\x00\x40\x06\x6f\xf7\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x30\x00\x08\x05\xa0\x00\x00\x20\x00\xff\x1c\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x01\xa0\x00\x00\x00\xff\xff\xff\xff"
+                                                                            "\xff\xff\x62\x45\xb4\xea\x2d\x59\x62\x45\xb4\xea\x2d\x59\x10\x00"
+                                                                            "\x02\x00\x01\x00\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\x8d\x50\x14\x11\x41\x00\x40\x06\x6f\xf7\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x30\x00\x08\x05\xa0\x00\x00\x20\x00\xff\x1c\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x01\xa0\x00\x00\x00\xff\xff\xff\xff"
+                                                                            "\xff\xff\x62\x45\xb4\xea\x2d\x59\x62\x45\xb4\xea\x2d\x59\x20\x00"
+                                                                            "\x02\x00\x01\x00\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x0c\x00\x8e\x50\x08\x10\x41\x00\x62\x45\xb4\xea\x2d\x59\x00\x00"
+                                                                            "\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x0c\x00\x81\x50\x10\x10\x41\x00\x62\x45\xb4\xea\x2d\x59\x00\x00"
+                                                                            "\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x0c\x00\x32\x50\x00\x00\x00\x00\x62\x45\xb4\xea\x2d\x59\x00\x00"
+                                                                            "\x00\x00\x00\x00") },
+
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\x83\x50\x00\x14\x41\x00\x13\x4f\x01\x00\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xe4\x51\x01\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x20\x01\x00\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x38\x00\x08\x05\xa0\x00\x00\x20\x00\xff\x24\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x01\x40\x00\x00\x00\xff\xff\xff\xff"
+                                                                            "\xff\xff\x62\x45\xb4\xea\x2d\x59\xff\xff\xff\xff\xff\xff\x30\x00"
+                                                                            "\x00\x00\x01\x08\x0c\x12\x18\x24\x30\x48\x60\x6c\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa5\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\x00\x00\x00\x00\x40\x11\x41\x00\xb8\x1c\x01\x00\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa6\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\x00\x00\x00\x00\x40\x11\x41\x00\xb8\x1c\x01\x00\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xe7\x51\x06\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x22\x01\x00\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x38\x00\x08\x05\xa0\x00\x00\x20\x00\xff\x24\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x01\x40\x00\x00\x00\xff\xff\xff\xff"
+                                                                            "\xff\xff\x62\x45\xb4\xea\x2d\x59\xff\xff\xff\xff\xff\xff\x40\x00"
+                                                                            "\x00\x00\x01\x08\x0c\x12\x18\x24\x30\x48\x60\x6c\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa8\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa9\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+
+    //next:2837 (2919) (we might have missed some reads, was too complicated to track..)
+
+    // diverges
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xea\x51\x0b\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x22\x01\x00\x00\x00\x00\x00") },
+
+    // only for logging
+    // next optimized for smaller code:
+    // consider diverges as default
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x38\x00\x08\x05\xa0\x00\x00\x20\x00\xff\x24\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x01\x40\x00\x00\x00\xff\xff\xff\xff"
+                                                                            "\xff\xff\x62\x45\xb4\xea\x2d\x59\xff\xff\xff\xff\xff\xff\x50\x00"
+                                                                            "\x00\x00\x01\x08\x0c\x12\x18\x24\x30\x48\x60\x6c\x00\x00\x00\x00"), 100 },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xab\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xac\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xed\x51\x24\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x01\x2a\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x38\x00\x08\x05\xa0\x00\x00\x20\x00\xff\x24\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x01\x40\x00\x00\x00\xff\xff\xff\xff"
+                                                                            "\xff\xff\x62\x45\xb4\xea\x2d\x59\xff\xff\xff\xff\xff\xff\x60\x00"
+                                                                            "\x00\x00\x01\x08\x0c\x12\x18\x24\x30\x48\x60\x6c\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xae\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa1\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xe2\x51\x28\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x01\x2a\x00\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x38\x00\x08\x05\xa0\x00\x00\x20\x00\xff\x24\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x01\x40\x00\x00\x00\xff\xff\xff\xff"
+                                                                            "\xff\xff\x62\x45\xb4\xea\x2d\x59\xff\xff\xff\xff\xff\xff\x70\x00"
+                                                                            "\x00\x00\x01\x08\x0c\x12\x18\x24\x30\x48\x60\x6c\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa3\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa4\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xe5\x51\x2c\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x01\x29\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x38\x00\x08\x05\xa0\x00\x00\x20\x00\xff\x24\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x01\x40\x00\x00\x00\xff\xff\xff\xff"
+                                                                            "\xff\xff\x62\x45\xb4\xea\x2d\x59\xff\xff\xff\xff\xff\xff\x80\x00"
+                                                                            "\x00\x00\x01\x08\x0c\x12\x18\x24\x30\x48\x60\x6c\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa6\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa7\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xe8\x51\x30\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x01\x29\x00\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x38\x00\x08\x05\xa0\x00\x00\x20\x00\xff\x24\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x01\x40\x00\x00\x00\xff\xff\xff\xff"
+                                                                            "\xff\xff\x62\x45\xb4\xea\x2d\x59\xff\xff\xff\xff\xff\xff\x90\x00"
+                                                                            "\x00\x00\x01\x08\x0c\x12\x18\x24\x30\x48\x60\x6c\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa9\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xaa\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xeb\x51\x95\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x02\x22\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x38\x00\x08\x05\xa0\x00\x00\x20\x00\xff\x24\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x01\x40\x00\x00\x00\xff\xff\xff\xff"
+                                                                            "\xff\xff\x62\x45\xb4\xea\x2d\x59\xff\xff\xff\xff\xff\xff\xa0\x00"
+                                                                            "\x00\x00\x01\x08\x0c\x12\x18\x24\x30\x48\x60\x6c\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xac\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    // vs 3d party:------>1800a75030114100d0c2b2053411410060c9900d401141000000000000000000
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xad\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xee\x51\x99\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x02\x22\x00\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x38\x00\x08\x05\xa0\x00\x00\x20\x00\xff\x24\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x01\x40\x00\x00\x00\xff\xff\xff\xff"
+                                                                            "\xff\xff\x62\x45\xb4\xea\x2d\x59\xff\xff\xff\xff\xff\xff\xb0\x00"
+                                                                            "\x00\x00\x01\x08\x0c\x12\x18\x24\x30\x48\x60\x6c\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa1\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa2\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    // only for logging:
+    //next: 2881? (double check) (2967)
+    // does not diverge
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\xf3\x51\x02\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"), 100 },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x10\x00\xa4\x50\xb4\x13\x41\x00\xa0\x6c\xef\xe3\xa8\x13\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x10\x00\xc5\x50\xb4\x13\x41\x00\x01\x00\xa4\x89\xa8\x13\x41\x00"
+                                                                            "\x01\x04\x0f\x1b\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xe6\x51\x9d\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x02\x20\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x38\x00\x08\x05\xa0\x00\x00\x20\x00\xff\x24\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x01\x40\x00\x00\x00\xff\xff\xff\xff"
+                                                                            "\xff\xff\x62\x45\xb4\xea\x2d\x59\xff\xff\xff\xff\xff\xff\xc0\x00"
+                                                                            "\x00\x00\x01\x08\x0c\x12\x18\x24\x30\x48\x60\x6c\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa7\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa8\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xe9\x51\xa1\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x02\x20\x00\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x38\x00\x08\x05\xa0\x00\x00\x20\x00\xff\x24\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x01\x40\x00\x00\x00\xff\xff\xff\xff"
+                                                                            "\xff\xff\x62\x45\xb4\xea\x2d\x59\xff\xff\xff\xff\xff\xff\xd0\x00"
+                                                                            "\x00\x00\x01\x08\x0c\x12\x18\x24\x30\x48\x60\x6c\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xaa\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xab\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x38\x00\x08\x05\xa0\x00\x00\x20\x00\xff\x24\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x01\x40\x00\x00\x00\xff\xff\xff\xff"
+                                                                            "\xff\xff\x62\x45\xb4\xea\x2d\x59\xff\xff\xff\xff\xff\xff\xe0\x00"
+                                                                            "\x00\x00\x01\x08\x0c\x12\x18\x24\x30\x48\x60\x6c\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xac\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xad\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x40\x11\x41\x00\x01\x01\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\x8e\x50\x00\x14\x41\x00\x17\x7f\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x14\x00\xe1\x51\x99\x00\x00\x00\x01\x01\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00\x02\x22\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\x82\x50\x1c\x04\x41\x00\x00\xc0\x00\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x50\x00\x83\x50\x00\xc0\x41\x00\x08\x00\x00\x20\x02\x00\x38\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x00\x00\x00"
+                                                                            "\xff\xff\xff\xff\xff\xff\x62\x45\xb4\xea\x2d\x59\x62\x45\xb4\xea"
+                                                                            "\x2d\x59\x00\x00\x88\x00\x6c\xf7\x00\xf8\xff\xff\x64\x00\x31\xc6"
+                                                                            "\x00\x00\xdd\x10\x00\x50\xf2\x11\x01\x10\x00\x28\x9d\x24\x00\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\x84\x50\x14\x11\x41\x00\x40\x06\x5f\xec\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa5\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\x00\x00\x00\x00\x40\x11\x41\x00\xc4\x1c\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x18\x00\xa6\x50\x30\x11\x41\x00\xa0\x6c\xef\xe3\x34\x11\x41\x00"
+                                                                            "\x00\x00\x00\x00\x40\x11\x41\x00\xc4\x1c\x01\x00\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\x87\x50\x24\x04\x41\x00\x40\x48\x50\x58\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x3c\x00\x88\x50\x00\xd2\x41\x00\x00\x00\x00\x20\x02\x00\x22\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x70\x00\x00\x00"
+                                                                            "\xff\xff\xff\xff\xff\xff\x62\x45\xb4\xea\x2d\x59\x62\x45\xb4\xea"
+                                                                            "\x2d\x59\x00\x00\x70\x0f\x10\x00\x28\x9d\x00\x00\x00\x00\x00\x00"
+                                                                            "\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\x89\x50\x24\x04\x41\x00\x40\x48\x50\x58\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x3c\x00\x8a\x50\x00\xd0\x41\x00\x00\x00\x00\x20\x02\x00\x24\x00"
+                                                                            "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x40\x00\x00\x00"
+                                                                            "\xff\xff\xff\xff\xff\xff\x62\x45\xb4\xea\x2d\x59\xff\xff\xff\xff"
+                                                                            "\xff\xff\x00\x00\x00\x00\x01\x08\x0c\x12\x18\x24\x30\x48\x60\x6c"
+                                                                            "\x00\x00\x00\x00") },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x38\x00\x3b\x50\x07\x00\x00\x00\x01\x00\x00\x00\x99\x00\x00\x00"
+                                                                            "\x0a\x00\x00\x00\x01\x00\x00\x00\x06\x00\x00\x00\x0b\x00\x00\x00"
+                                                                            "\x24\x00\x00\x00\x28\x00\x00\x00\x2c\x00\x00\x00\x30\x00\x00\x00"
+                                                                            "\x95\x00\x00\x00\x9d\x00\x00\x00\xa1\x00\x00\x00\x00\x00\x00\x00") },
+    // for some reason needs a 200msec sleep
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x08\x00\xfc\x51\x02\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"), 200 },
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x10\x00\xad\x50\xb4\x13\x41\x00\xa0\x6c\xef\xe3\xa8\x13\x41\x00"
+                                                                            "\xf0\x7a\x20\xf4\x00\x00\x00\x00") },
+    //next:2938 (3021)
+
+    // does not diverge
+    { ONE_STEP_SEND,     0,                    0, 0x0000, 0x0000, ONE_BYTES("\x10\x00\xce\x50\xb4\x13\x41\x00\x01\x00\xa4\x89\xa8\x13\x41\x00"
+                                                                            "\x01\x04\x0f\x1b\x00\x00\x00\x00") },
+    // don't really need this sleep. I think..
+
+    { ONE_STEP_WAIT,     0,                    0, 0x0000, 0x0000, NULL, 0, 100 },
+};
+
+#define ONE_BRINGUP_STEPS           (sizeof(kOneBringUp) / sizeof(kOneBringUp[0]))
+
+#endif // __ONEBRINGUP_H__
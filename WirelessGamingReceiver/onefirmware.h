@@ -0,0 +1,4422 @@
+/*
+ MICE Xbox 360 Controller driver for Mac OS X
+ Copyright (C) 2006-2013 Colin Munro
+ 
+ onefirmware.h - firmware uploaded to the Xbox One wireless receiver
+ 
+ This file is part of Xbox360Controller.
+ 
+ Xbox360Controller is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+ 
+ Xbox360Controller is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with Foobar; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef __ONEFIRMWARE_H__
+#define __ONEFIRMWARE_H__
+
+// Converted from the hex dumps the receiver was reverse engineered with.
+// Only include from OneWirelessGamingReceiver.cpp, it defines the data.
+
+static const unsigned char firmware1[] = {
+    0x00, 0x38, 0x00, 0x10, 0x00, 0x09, 0x46, 0x00, 0x01, 0x10, 0x58, 0x00, 0x08, 0x00, 0x46, 0x20,
+    0x01, 0x10, 0x58, 0x21, 0x08, 0x00, 0x4c, 0x01, 0x00, 0x08, 0x44, 0x10, 0x00, 0x00, 0x1c, 0x10,
+    0x00, 0x01, 0x4c, 0x01, 0x7f, 0xfe, 0x46, 0x00, 0x01, 0x12, 0x58, 0x00, 0x0b, 0xa0, 0x46, 0x20,
+    0x01, 0x1c, 0x58, 0x21, 0x07, 0x10, 0x4c, 0x01, 0x00, 0x08, 0x44, 0x10, 0x00, 0x00, 0x1c, 0x10,
+    0x00, 0x01, 0x4c, 0x01, 0x7f, 0xfe, 0x83, 0xc4, 0x4a, 0x00, 0x78, 0x20, 0x46, 0x20, 0x04, 0x00,
+    0x44, 0x30, 0x00, 0xea, 0x80, 0x22, 0x80, 0x01, 0x14, 0x31, 0x01, 0x04, 0x44, 0x20, 0x00, 0x98,
+    0x14, 0x20, 0x81, 0x06, 0x14, 0x30, 0x01, 0x08, 0xdd, 0x9e, 0x92, 0x00, 0x3b, 0xff, 0xfc, 0xbc,
+    0xef, 0xfc, 0x46, 0x10, 0x04, 0x00, 0x04, 0x20, 0x81, 0x00, 0x80, 0x01, 0x58, 0x21, 0x00, 0x22,
+    0x14, 0x20, 0x81, 0x00, 0x04, 0x10, 0x01, 0x0a, 0x42, 0x10, 0x9c, 0x09, 0x14, 0x10, 0x01, 0x0a,
+    0x46, 0xf0, 0x01, 0x1c, 0x00, 0x57, 0x80, 0x4d, 0x84, 0x21, 0xd1, 0x0c, 0x46, 0xf0, 0x01, 0x12,
+    0x04, 0x57, 0x82, 0xe2, 0xd1, 0x07, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x84, 0x58, 0xf7, 0x8e, 0xac,
+    0xdd, 0x2f, 0xec, 0x04, 0x3b, 0xff, 0xfc, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x9c, 0xbc,
+    0xef, 0xfc, 0x46, 0x10, 0x04, 0x00, 0x04, 0x20, 0x81, 0x00, 0x80, 0x01, 0x58, 0x21, 0x00, 0x11,
+    0x14, 0x20, 0x81, 0x00, 0x04, 0x10, 0x01, 0x06, 0x46, 0x60, 0x01, 0x12, 0x58, 0x63, 0x0b, 0xbc,
+    0x58, 0x10, 0x80, 0x80, 0x14, 0x10, 0x01, 0x06, 0x44, 0x50, 0x03, 0xe8, 0xb4, 0x06, 0x9c, 0x01,
+    0xb6, 0x06, 0xd8, 0x0c, 0x84, 0x02, 0x44, 0x10, 0x00, 0x6d, 0x84, 0x40, 0x46, 0xf0, 0x00, 0x06,
+    0x58, 0xf7, 0x8c, 0x04, 0xdd, 0x2f, 0x84, 0x00, 0xb6, 0x06, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x07,
+    0x82, 0xef, 0x54, 0x00, 0x00, 0x03, 0xc0, 0x03, 0x84, 0x00, 0xd5, 0x07, 0x80, 0x20, 0x46, 0xf0,
+    0x00, 0x82, 0x58, 0xf7, 0x8a, 0xf4, 0xdd, 0x2f, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x27, 0x82, 0xef,
+    0x44, 0x10, 0x01, 0x2c, 0x40, 0x21, 0x04, 0x36, 0xc1, 0x03, 0x84, 0xa1, 0xd8, 0x1f, 0x46, 0xf0,
+    0x01, 0x12, 0x04, 0x07, 0x82, 0xdc, 0xc0, 0x06, 0x84, 0x40, 0x46, 0xf0, 0x01, 0x12, 0x10, 0x27,
+    0x8b, 0x90, 0x46, 0x60, 0x01, 0x12, 0x00, 0x13, 0x0b, 0x90, 0x84, 0xa1, 0xd1, 0x0f, 0x84, 0x20,
+    0x46, 0xf0, 0x00, 0x82, 0x58, 0xf7, 0x82, 0x04, 0xdd, 0x2f, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x07,
+    0x82, 0xdc, 0xc8, 0x04, 0x84, 0x01, 0x10, 0x03, 0x0b, 0x90, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x07,
+    0x85, 0x4c, 0xc0, 0x33, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x77, 0x82, 0xef, 0x84, 0x0a, 0x40, 0x03,
+    0x80, 0xf6, 0xcf, 0x2b, 0x46, 0x60, 0x01, 0x12, 0x58, 0x63, 0x0b, 0xb8, 0xb4, 0x06, 0x84, 0xa3,
+    0x9c, 0x01, 0xb6, 0x06, 0xd8, 0x07, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x85, 0xd8, 0xdd, 0x2f,
+    0xb6, 0xe6, 0x46, 0x00, 0x04, 0x12, 0x04, 0x00, 0x02, 0x81, 0xc0, 0x17, 0x54, 0x10, 0x00, 0x0f,
+    0xc1, 0x0f, 0x96, 0x00, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x84, 0x18, 0xdd, 0x2f, 0x84, 0xa1,
+    0xd8, 0x07, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x85, 0x28, 0xdd, 0x2f, 0x46, 0x00,
+    0x04, 0x12, 0x84, 0x2f, 0x14, 0x10, 0x02, 0x81, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x07, 0x82, 0xdf,
+    0x84, 0xa1, 0xd8, 0x22, 0x46, 0x00, 0x04, 0x10, 0x04, 0x60, 0x01, 0x05, 0x40, 0x03, 0x38, 0x08,
+    0x92, 0x1f, 0xc0, 0x0a, 0x84, 0x02, 0x44, 0x10, 0x00, 0x64, 0x84, 0x40, 0x46, 0xf0, 0x00, 0x06,
+    0x58, 0xf7, 0x8c, 0x04, 0xdd, 0x2f, 0x54, 0x03, 0x00, 0x80, 0xc0, 0x0a, 0x84, 0x02, 0x44, 0x10,
+    0x00, 0x64, 0x84, 0x41, 0x46, 0xf0, 0x00, 0x06, 0x58, 0xf7, 0x8c, 0x04, 0xdd, 0x2f, 0x46, 0x00,
+    0x04, 0x10, 0x14, 0x60, 0x01, 0x05, 0xec, 0x04, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x92, 0x00,
+    0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xfc, 0x46, 0x00, 0x04, 0x10, 0x58, 0x00, 0x08, 0x00, 0x04, 0x60,
+    0x00, 0x78, 0x40, 0x73, 0x40, 0x09, 0x97, 0xf8, 0x54, 0x03, 0x80, 0x02, 0xc0, 0x08, 0x46, 0xf0,
+    0x01, 0x12, 0x04, 0x77, 0x83, 0x12, 0x44, 0x62, 0x00, 0x00, 0xd5, 0x29, 0x96, 0x30, 0x96, 0x44,
+    0xc1, 0x07, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x77, 0x83, 0x01, 0x84, 0xc1, 0xd5, 0x20, 0x54, 0x00,
+    0x00, 0x02, 0xc0, 0x07, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x77, 0x83, 0x02, 0x84, 0xc2, 0xd5, 0x17,
+    0x97, 0xfc, 0xc7, 0x08, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x77, 0x83, 0x11, 0x44, 0x61, 0x00, 0x00,
+    0xd5, 0x0e, 0x80, 0x07, 0x80, 0x27, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0c, 0xa4, 0x44, 0x30,
+    0x00, 0xc9, 0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0x46, 0x00, 0x04, 0x10,
+    0x58, 0x00, 0x08, 0x00, 0x84, 0x20, 0x14, 0x60, 0x00, 0x78, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21,
+    0x0c, 0xa4, 0x40, 0x00, 0x9c, 0x06, 0x44, 0x30, 0x00, 0xd4, 0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7,
+    0x81, 0x3c, 0xdd, 0x2f, 0x46, 0x00, 0x01, 0x1b, 0x58, 0x00, 0x05, 0x80, 0xdd, 0x27, 0xec, 0x04,
+    0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xfc, 0x46, 0x20,
+    0x00, 0x8e, 0x58, 0x21, 0x0c, 0xa4, 0x80, 0xc0, 0x80, 0xe1, 0x5c, 0x00, 0x00, 0x20, 0x84, 0x20,
+    0x44, 0x30, 0x00, 0x96, 0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0x46, 0x00,
+    0x01, 0x12, 0x58, 0x00, 0x0c, 0x04, 0x38, 0x70, 0x1a, 0x0a, 0x46, 0x10, 0x04, 0x10, 0x58, 0x10,
+    0x88, 0x00, 0x04, 0x00, 0x80, 0x78, 0x84, 0x41, 0x40, 0x61, 0x18, 0x0c, 0x40, 0x03, 0x00, 0x04,
+    0x14, 0x00, 0x80, 0x78, 0x04, 0x00, 0x80, 0x7a, 0x40, 0x63, 0x00, 0x04, 0x14, 0x60, 0x80, 0x7a,
+    0xec, 0x04, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa4, 0xbc, 0xef, 0xf4, 0x84, 0x20,
+    0xf1, 0x81, 0x44, 0x10, 0x00, 0x40, 0x10, 0x1f, 0x80, 0x04, 0x10, 0x1f, 0x80, 0x07, 0x46, 0x10,
+    0x04, 0x10, 0x58, 0x10, 0x88, 0x00, 0xb4, 0x41, 0x50, 0x60, 0x05, 0x9c, 0x58, 0x01, 0x00, 0x02,
+    0xb6, 0x01, 0x80, 0x01, 0xf2, 0x01, 0x14, 0x20, 0x80, 0x71, 0x04, 0x70, 0x00, 0x71, 0x46, 0x80,
+    0x04, 0x10, 0x42, 0x13, 0x8c, 0x0b, 0xf7, 0x81, 0x58, 0x84, 0x08, 0x00, 0xc9, 0xf7, 0x42, 0x73,
+    0x84, 0x0b, 0xcf, 0xf4, 0x46, 0x90, 0x00, 0x80, 0x58, 0x94, 0x8a, 0xd4, 0x50, 0x13, 0x7a, 0x64,
+    0x50, 0x23, 0x7e, 0xe4, 0x50, 0x04, 0x01, 0xa0, 0x84, 0x64, 0x4b, 0xe0, 0x24, 0x01, 0x46, 0x00,
+    0x04, 0x10, 0x50, 0x13, 0x7a, 0xa4, 0x50, 0x23, 0x7e, 0xf4, 0x58, 0x00, 0x09, 0xb0, 0x84, 0x64,
+    0x4b, 0xe0, 0x24, 0x01, 0x46, 0x00, 0x04, 0x10, 0x46, 0x90, 0x00, 0x80, 0x58, 0x94, 0x89, 0x7c,
+    0x50, 0x13, 0x7a, 0xe4, 0x50, 0x23, 0x7f, 0x04, 0x58, 0x00, 0x09, 0x80, 0x44, 0x30, 0x00, 0x20,
+    0x4b, 0xe0, 0x24, 0x01, 0x46, 0x00, 0x04, 0x10, 0x50, 0x13, 0x7c, 0xe4, 0x50, 0x23, 0x7f, 0x84,
+    0x44, 0x30, 0x00, 0x20, 0x58, 0x00, 0x09, 0x90, 0x4b, 0xe0, 0x24, 0x01, 0x84, 0x03, 0xaf, 0xf5,
+    0xaf, 0xf4, 0x10, 0x04, 0x01, 0xa8, 0x10, 0x04, 0x01, 0xb8, 0x14, 0x73, 0x00, 0x09, 0xaf, 0xf7,
+    0xaf, 0xf6, 0xa9, 0xf4, 0xa9, 0xf5, 0xa9, 0xf2, 0xa9, 0xf3, 0x50, 0x03, 0x00, 0x1c, 0x46, 0xf0,
+    0x00, 0x81, 0x58, 0xf7, 0x87, 0xb4, 0xdd, 0x2f, 0x04, 0x14, 0x00, 0x71, 0x58, 0x00, 0x80, 0x05,
+    0xf1, 0x81, 0x10, 0x0f, 0x80, 0x04, 0xf0, 0x01, 0x14, 0x04, 0x00, 0x71, 0xec, 0x0c, 0x3a, 0x6f,
+    0xa4, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xf4, 0x80, 0xc0, 0x50, 0x0f, 0x80, 0x04,
+    0x80, 0xe1, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0x04, 0x03, 0x01, 0x6b,
+    0x04, 0x13, 0x01, 0x6c, 0x50, 0x00, 0x00, 0x20, 0x9a, 0x01, 0xe4, 0x02, 0xe9, 0x45, 0x00, 0x13,
+    0x05, 0xa3, 0x50, 0x00, 0x80, 0x28, 0x94, 0x04, 0x98, 0x30, 0xa6, 0x87, 0x54, 0x21, 0x00, 0x80,
+    0xc2, 0x3b, 0x50, 0x20, 0x81, 0x48, 0x38, 0x73, 0x0a, 0x0a, 0x94, 0x4c, 0xa0, 0xba, 0x98, 0x71,
+    0xb6, 0x40, 0xa0, 0xfb, 0x14, 0x30, 0x80, 0xa3, 0x02, 0x23, 0x80, 0x0c, 0xa4, 0x43, 0x54, 0x21,
+    0x3f, 0xff, 0x92, 0x2e, 0x40, 0x10, 0xb8, 0x08, 0x40, 0x10, 0x88, 0x04, 0xac, 0x43, 0xa6, 0x45,
+    0xa6, 0x87, 0x54, 0x10, 0x80, 0x7f, 0x58, 0x21, 0x00, 0x40, 0x54, 0x21, 0x00, 0x7f, 0xae, 0x87,
+    0xae, 0x45, 0x46, 0x00, 0x04, 0x10, 0x00, 0x13, 0x05, 0xa3, 0x04, 0x23, 0x01, 0x6c, 0x9c, 0x49,
+    0x54, 0x10, 0x80, 0x1f, 0x9c, 0x91, 0x58, 0x00, 0x08, 0x00, 0x14, 0x23, 0x01, 0x6c, 0x10, 0x13,
+    0x05, 0xa3, 0x10, 0x10, 0x01, 0x98, 0xf0, 0x01, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x58,
+    0xdd, 0x2f, 0x84, 0x01, 0xd5, 0x08, 0xf0, 0x01, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x58,
+    0xdd, 0x2f, 0x84, 0x00, 0xec, 0x0c, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa0, 0xbc,
+    0xef, 0xf8, 0x80, 0xc0, 0x50, 0x0f, 0x80, 0x04, 0x80, 0xe1, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7,
+    0x8c, 0x2c, 0xdd, 0x2f, 0x04, 0x03, 0x01, 0x69, 0x04, 0x13, 0x01, 0x6a, 0x50, 0x00, 0x00, 0x20,
+    0x9a, 0x01, 0xe4, 0x02, 0xe9, 0x73, 0x00, 0x33, 0x05, 0xa2, 0x50, 0x11, 0x80, 0x08, 0x94, 0x4c,
+    0x98, 0x71, 0x00, 0x80, 0x80, 0x07, 0x54, 0x84, 0x00, 0x80, 0x54, 0x84, 0x00, 0xff, 0x4e, 0x83,
+    0x00, 0x0a, 0xf0, 0x01, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x58, 0xdd, 0x2f, 0x80, 0x08,
+    0xd5, 0x64, 0x50, 0x01, 0x81, 0x28, 0x38, 0x73, 0x02, 0x0a, 0x00, 0x03, 0x80, 0x1c, 0x96, 0x04,
+    0xc0, 0x06, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x05, 0x48, 0xd5, 0x02, 0xa0, 0x3a, 0x50, 0x21,
+    0x80, 0x08, 0xb6, 0x01, 0x94, 0x94, 0x98, 0xb2, 0x02, 0x13, 0x80, 0x0c, 0xa4, 0x13, 0x54, 0x10,
+    0xbf, 0xff, 0x92, 0x0e, 0x40, 0x00, 0x38, 0x08, 0x40, 0x00, 0x04, 0x04, 0xac, 0x13, 0x94, 0x1c,
+    0xa6, 0x57, 0x98, 0x30, 0x50, 0x00, 0x00, 0x88, 0x84, 0x60, 0x58, 0x10, 0x80, 0x40, 0xae, 0x57,
+    0xb6, 0x60, 0xa5, 0x12, 0xa7, 0x57, 0x92, 0x8e, 0x40, 0x42, 0x38, 0x08, 0xad, 0x12, 0x54, 0x52,
+    0x80, 0x7f, 0xa7, 0x15, 0xaf, 0x57, 0x42, 0x42, 0x18, 0x09, 0xaf, 0x15, 0xae, 0xc7, 0xa6, 0xc6,
+    0x44, 0x7f, 0xff, 0xcf, 0x40, 0x31, 0x9c, 0x02, 0x58, 0x31, 0x80, 0x08, 0xae, 0xc6, 0x46, 0x10,
+    0x04, 0x10, 0xa4, 0x93, 0x58, 0x10, 0x88, 0x00, 0x54, 0x21, 0x3f, 0xff, 0xac, 0x82, 0x00, 0x03,
+    0x05, 0xa2, 0x04, 0x23, 0x01, 0x6a, 0x9c, 0x01, 0x54, 0x00, 0x00, 0x1f, 0x9c, 0x91, 0x14, 0x23,
+    0x01, 0x6a, 0x10, 0x03, 0x05, 0xa2, 0x10, 0x00, 0x81, 0x88, 0xf0, 0x01, 0x46, 0xf0, 0x00, 0x01,
+    0x58, 0xf7, 0x8c, 0x58, 0xdd, 0x2f, 0x84, 0x01, 0xd5, 0x08, 0xf0, 0x01, 0x46, 0xf0, 0x00, 0x01,
+    0x58, 0xf7, 0x8c, 0x58, 0xdd, 0x2f, 0x84, 0x00, 0xec, 0x08, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xf4, 0x80, 0xc0, 0x50, 0x0f, 0x80, 0x04, 0x46, 0xf0, 0x00, 0x01,
+    0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0x85, 0x00, 0x47, 0xc0, 0x00, 0x04, 0x59, 0xce, 0x01, 0x3c,
+    0x46, 0xa0, 0x00, 0x81, 0x58, 0xa5, 0x04, 0x88, 0xd5, 0x22, 0xa7, 0x3f, 0x54, 0x42, 0x00, 0x80,
+    0xc4, 0x34, 0x38, 0x93, 0x02, 0x02, 0x38, 0x83, 0x02, 0x0a, 0x40, 0x04, 0x24, 0x06, 0xdd, 0x3c,
+    0x00, 0x04, 0x80, 0x1a, 0x46, 0x20, 0x01, 0x1a, 0x58, 0x21, 0x02, 0x18, 0x94, 0x04, 0x80, 0x29,
+    0x98, 0x02, 0x4b, 0xe0, 0x28, 0x01, 0xa6, 0x3f, 0x44, 0x1f, 0xff, 0xc0, 0x40, 0x00, 0x04, 0x04,
+    0xae, 0x3f, 0x04, 0x03, 0x01, 0x6b, 0x9c, 0x01, 0x14, 0x03, 0x01, 0x6b, 0x04, 0x43, 0x01, 0x6b,
+    0x04, 0x53, 0x01, 0x6c, 0x54, 0x72, 0x00, 0x1f, 0x50, 0x03, 0x81, 0x48, 0x50, 0x73, 0x80, 0x28,
+    0x95, 0xfc, 0x9b, 0x2c, 0x80, 0x28, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0c, 0xc0, 0x44, 0x30,
+    0x01, 0xfa, 0x99, 0xf7, 0x4e, 0x46, 0xff, 0xcb, 0xf0, 0x01, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7,
+    0x8c, 0x58, 0xdd, 0x2f, 0xec, 0x0c, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc,
+    0xef, 0xf4, 0x81, 0x00, 0x50, 0x00, 0x05, 0xc8, 0x85, 0x20, 0xf0, 0x81, 0x46, 0xa0, 0x00, 0x81,
+    0x58, 0xa5, 0x04, 0x88, 0x45, 0xc0, 0x00, 0x50, 0xd5, 0x63, 0xa6, 0x57, 0x54, 0x10, 0x80, 0x80,
+    0xc1, 0x6e, 0x38, 0x64, 0x0e, 0x02, 0x8c, 0xd8, 0x38, 0x94, 0x0e, 0x0a, 0xa6, 0x74, 0x96, 0x8c,
+    0xca, 0x44, 0xa6, 0xb5, 0x54, 0x10, 0x80, 0x02, 0xc2, 0x1d, 0x00, 0x23, 0x7f, 0xfb, 0x80, 0x29,
+    0x5c, 0x01, 0x00, 0x10, 0x44, 0x30, 0x01, 0xbd, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0c, 0xc0,
+    0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0xa6, 0xb4, 0x00, 0x13, 0x7f, 0xfb,
+    0x58, 0x21, 0x00, 0x02, 0x42, 0x10, 0xf0, 0x24, 0xae, 0xb4, 0x50, 0x00, 0x80, 0x40, 0xf1, 0x01,
+    0xd5, 0x1f, 0xc1, 0x14, 0xa6, 0x33, 0x00, 0x13, 0x7f, 0xfb, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7,
+    0x82, 0x68, 0xdd, 0x2f, 0x46, 0x00, 0x00, 0x8e, 0x58, 0x00, 0x0c, 0xdc, 0x50, 0x13, 0x7f, 0xf8,
+    0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x8a, 0x4c, 0xdd, 0x2f, 0xa6, 0x72, 0x84, 0x80, 0xaf, 0x34,
+    0x14, 0x93, 0x7f, 0xfd, 0x94, 0x0c, 0x46, 0x10, 0x01, 0x1a, 0x58, 0x10, 0x82, 0x18, 0x98, 0x01,
+    0x50, 0x13, 0x7f, 0xe8, 0x4b, 0xe0, 0x28, 0x01, 0x50, 0x03, 0x80, 0x08, 0x94, 0x04, 0x88, 0x08,
+    0xa6, 0x87, 0xa6, 0x45, 0x44, 0x3f, 0xff, 0xc0, 0x40, 0x21, 0x0c, 0x04, 0x58, 0x10, 0x80, 0x40,
+    0xae, 0x87, 0xae, 0x45, 0x04, 0x04, 0x01, 0x69, 0x9c, 0x01, 0x14, 0x04, 0x01, 0x69, 0x04, 0x04,
+    0x01, 0x69, 0x04, 0x14, 0x01, 0x6a, 0x54, 0x70, 0x00, 0x1f, 0x50, 0x23, 0x80, 0x08, 0x94, 0x94,
+    0x9a, 0x48, 0x50, 0x33, 0x81, 0x28, 0x88, 0x48, 0x4e, 0x16, 0xff, 0x91, 0xec, 0x0c, 0x3a, 0x6f,
+    0xaa, 0x84, 0xdd, 0x9e, 0x3b, 0xff, 0xfc, 0xbc, 0xef, 0xfc, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7,
+    0x87, 0x28, 0xdd, 0x2f, 0xec, 0x04, 0x3b, 0xff, 0xfc, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc,
+    0xef, 0xe4, 0x84, 0x20, 0x10, 0x1f, 0x80, 0x15, 0x10, 0x1f, 0x80, 0x17, 0x10, 0x1f, 0x80, 0x16,
+    0x46, 0x10, 0x04, 0x10, 0x58, 0x10, 0x88, 0x00, 0x50, 0x30, 0xf8, 0x94, 0xf1, 0x81, 0xf3, 0x82,
+    0x50, 0xaf, 0x80, 0x17, 0x50, 0x9f, 0x80, 0x16, 0x50, 0x8f, 0x80, 0x15, 0x80, 0xe0, 0xf6, 0x01,
+    0x01, 0xc3, 0x85, 0xa1, 0x00, 0x13, 0x01, 0xbc, 0x50, 0x0e, 0x00, 0x04, 0x94, 0x04, 0x80, 0x69,
+    0x98, 0x38, 0x50, 0x5e, 0x01, 0x24, 0x80, 0x88, 0x80, 0x4a, 0x4d, 0xc0, 0x80, 0x63, 0xa6, 0x47,
+    0x54, 0x10, 0x80, 0x80, 0xc1, 0x5e, 0xa4, 0x43, 0xf6, 0x02, 0x54, 0x10, 0xbf, 0xff, 0x38, 0x03,
+    0x96, 0x02, 0xf1, 0x83, 0xb4, 0xa6, 0xb6, 0xbf, 0x46, 0xf0, 0x00, 0x83, 0x58, 0xf7, 0x88, 0x0c,
+    0xdd, 0x2f, 0x80, 0xc0, 0x84, 0x01, 0xb4, 0xbf, 0x4c, 0x60, 0x40, 0x21, 0x00, 0x2f, 0x80, 0x15,
+    0x00, 0x0f, 0x80, 0x17, 0x00, 0x1f, 0x80, 0x16, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x57, 0x82, 0xf0,
+    0x46, 0xf0, 0x00, 0x82, 0x58, 0xf7, 0x83, 0x0c, 0xdd, 0x2f, 0x00, 0x0f, 0x80, 0x17, 0x80, 0x26,
+    0x46, 0xf0, 0x00, 0x82, 0x58, 0xf7, 0x8a, 0xf4, 0xdd, 0x2f, 0x00, 0x0f, 0x80, 0x17, 0xf1, 0x03,
+    0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x80, 0xf4, 0xdd, 0x2f, 0x50, 0x6e, 0x00, 0x04, 0x95, 0xb4,
+    0x99, 0xbe, 0x80, 0x06, 0x84, 0x20, 0x44, 0x20, 0x00, 0x10, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7,
+    0x83, 0xc4, 0xdd, 0x2f, 0xa6, 0x37, 0x50, 0x1e, 0x01, 0x24, 0x38, 0x13, 0x86, 0x02, 0x58, 0x00,
+    0x00, 0x40, 0xa0, 0x4a, 0xae, 0x37, 0xb6, 0x26, 0xa4, 0x33, 0x92, 0x0e, 0x40, 0x00, 0x38, 0x08,
+    0x58, 0x00, 0x06, 0x48, 0xac, 0x33, 0xf3, 0x01, 0x11, 0xc1, 0x81, 0xb8, 0x00, 0x03, 0x85, 0xa1,
+    0x9c, 0x01, 0x54, 0x00, 0x00, 0x03, 0x10, 0x03, 0x85, 0xa1, 0xf6, 0x02, 0xb4, 0x06, 0xd5, 0x90,
+    0xec, 0x1c, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x3b, 0xff, 0xfc, 0xbc, 0xef, 0xfc, 0x46, 0xf0,
+    0x00, 0x80, 0x58, 0xf7, 0x88, 0x48, 0xdd, 0x2f, 0xec, 0x04, 0x3b, 0xff, 0xfc, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xfc, 0xb6, 0x20, 0xa8, 0xc1, 0x80, 0xc1, 0xa0, 0x43, 0x84, 0xe0,
+    0x81, 0x23, 0x81, 0x02, 0xa8, 0x42, 0x47, 0xc0, 0x00, 0x5a, 0x59, 0xce, 0x03, 0xc4, 0x81, 0x47,
+    0xd5, 0x0c, 0xdd, 0x3c, 0xa6, 0x37, 0x44, 0x1f, 0xff, 0xc0, 0x40, 0x00, 0x04, 0x04, 0xae, 0x37,
+    0x1c, 0xa4, 0x00, 0x01, 0x9d, 0xf9, 0x8c, 0xd0, 0x80, 0x06, 0x84, 0x20, 0x44, 0x20, 0x00, 0x10,
+    0xe2, 0xe9, 0xe9, 0xf0, 0xec, 0x04, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc,
+    0xef, 0xf4, 0x46, 0x90, 0x04, 0x10, 0x80, 0xe0, 0x58, 0x94, 0x88, 0x00, 0x46, 0x30, 0x00, 0x82,
+    0x58, 0x31, 0x86, 0xc0, 0x47, 0xc0, 0x00, 0x5a, 0x59, 0xce, 0x03, 0xc4, 0x00, 0x83, 0x85, 0xa0,
+    0x00, 0x54, 0x81, 0xac, 0x40, 0x04, 0x20, 0x00, 0x9c, 0x01, 0x94, 0x03, 0x40, 0x64, 0x10, 0x08,
+    0x98, 0x38, 0x50, 0xa4, 0x01, 0x20, 0x99, 0xbe, 0x4c, 0x82, 0x80, 0x2d, 0xa6, 0x77, 0x54, 0x10,
+    0x80, 0x80, 0xc1, 0x28, 0xa4, 0xb3, 0xa0, 0x01, 0x38, 0x13, 0xaa, 0x02, 0xf3, 0x81, 0x54, 0x21,
+    0x3f, 0xff, 0xdd, 0x23, 0x84, 0x20, 0x80, 0x06, 0x44, 0x20, 0x00, 0x10, 0xdd, 0x3c, 0xa6, 0x37,
+    0x38, 0x13, 0xaa, 0x02, 0x58, 0x00, 0x00, 0x40, 0xa0, 0x4a, 0xae, 0x37, 0xb6, 0x26, 0xa4, 0x33,
+    0x92, 0x0e, 0x40, 0x00, 0x38, 0x08, 0x58, 0x00, 0x06, 0x48, 0xac, 0x33, 0x10, 0x84, 0x81, 0xa8,
+    0x00, 0x03, 0x85, 0xa0, 0x9c, 0x01, 0x54, 0x00, 0x00, 0x03, 0x10, 0x03, 0x85, 0xa0, 0xf3, 0x01,
+    0xd5, 0xc6, 0xec, 0x0c, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x98, 0xbc,
+    0x04, 0x20, 0x01, 0x6d, 0x80, 0xc0, 0x54, 0x21, 0x00, 0x02, 0xca, 0x09, 0x84, 0x02, 0x44, 0x10,
+    0x00, 0x6f, 0x46, 0xf0, 0x00, 0x06, 0x58, 0xf7, 0x8c, 0x04, 0xdd, 0x2f, 0x04, 0x03, 0x01, 0x6d,
+    0x58, 0x00, 0x00, 0x02, 0x14, 0x03, 0x01, 0x6d, 0x3a, 0x6f, 0x98, 0x84, 0xdd, 0x9e, 0x92, 0x00,
+    0x3a, 0x6f, 0x98, 0xbc, 0x04, 0x20, 0x01, 0x6d, 0x80, 0xc0, 0x44, 0x01, 0x00, 0x00, 0x40, 0x21,
+    0x00, 0x02, 0xca, 0x09, 0x84, 0x02, 0x44, 0x10, 0x00, 0x6f, 0x46, 0xf0, 0x00, 0x06, 0x58, 0xf7,
+    0x8c, 0x04, 0xdd, 0x2f, 0x04, 0x03, 0x01, 0x6d, 0x42, 0x00, 0x40, 0x08, 0x14, 0x03, 0x01, 0x6d,
+    0x3a, 0x6f, 0x98, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xf4, 0xb6, 0x20,
+    0x81, 0x43, 0xa8, 0xc1, 0x46, 0x30, 0x04, 0x10, 0x58, 0x31, 0x89, 0xb0, 0x80, 0xc1, 0x40, 0x70,
+    0x0c, 0x03, 0xa0, 0x43, 0x46, 0x40, 0x01, 0x1a, 0x58, 0x42, 0x02, 0x08, 0x46, 0x50, 0x01, 0x1a,
+    0x58, 0x52, 0x81, 0xf8, 0x40, 0x32, 0x9c, 0x1a, 0x40, 0x32, 0x1c, 0x1b, 0xf3, 0x81, 0x81, 0x22,
+    0xa8, 0x42, 0x85, 0x00, 0x45, 0xc0, 0x06, 0x48, 0xd5, 0x2c, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7,
+    0x83, 0xc4, 0xdd, 0x2f, 0xf0, 0x01, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x80, 0xc4, 0xdd, 0x2f,
+    0x80, 0xe0, 0xc8, 0x0d, 0x80, 0x20, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0c, 0xc0, 0x44, 0x30,
+    0x00, 0xd0, 0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0x13, 0xc3, 0x80, 0x08,
+    0xa6, 0x77, 0x8d, 0x01, 0x54, 0x10, 0x80, 0x3f, 0xae, 0x77, 0xa4, 0x73, 0x92, 0x2e, 0x40, 0x10,
+    0xb8, 0x08, 0x58, 0x10, 0x86, 0x48, 0xac, 0x73, 0xa0, 0x7a, 0xaa, 0x74, 0x1c, 0x74, 0x80, 0x01,
+    0x84, 0x20, 0x44, 0x20, 0x00, 0x10, 0x80, 0x06, 0xe3, 0x0a, 0xe9, 0xd0, 0xec, 0x0c, 0x3a, 0x6f,
+    0xaa, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x98, 0xbc, 0x46, 0x00, 0x04, 0x00, 0x58, 0x00, 0x02, 0x00,
+    0xa1, 0x84, 0x40, 0x03, 0x20, 0x09, 0x96, 0x00, 0x54, 0x10, 0x00, 0x10, 0xc1, 0x06, 0x46, 0xf0,
+    0x01, 0x12, 0x04, 0x67, 0x83, 0x2d, 0xd5, 0x2a, 0x54, 0x10, 0x00, 0x20, 0xc1, 0x06, 0x46, 0xf0,
+    0x01, 0x12, 0x04, 0x67, 0x83, 0x2e, 0xd5, 0x22, 0x54, 0x10, 0x00, 0x40, 0xc1, 0x06, 0x46, 0xf0,
+    0x01, 0x12, 0x04, 0x67, 0x83, 0x2f, 0xd5, 0x1a, 0x54, 0x00, 0x00, 0x80, 0xc0, 0x06, 0x46, 0xf0,
+    0x01, 0x12, 0x04, 0x67, 0x83, 0x30, 0xd5, 0x12, 0x92, 0xd0, 0x97, 0xb0, 0x96, 0x34, 0xc0, 0x06,
+    0x46, 0xf0, 0x01, 0x12, 0x04, 0x67, 0x83, 0x31, 0xd5, 0x09, 0x54, 0x63, 0x00, 0x02, 0x97, 0xb0,
+    0xc6, 0x05, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x67, 0x83, 0x32, 0x84, 0x20, 0x40, 0x00, 0x98, 0x06,
+    0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0c, 0xe8, 0x44, 0x30, 0x00, 0x6e, 0x46, 0xf0, 0x00, 0x04,
+    0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0xdd, 0x26, 0x3a, 0x6f, 0x98, 0x84, 0xdd, 0x9e, 0x92, 0x00,
+    0x3a, 0x6f, 0xa0, 0xbc, 0x46, 0x80, 0x00, 0x04, 0x58, 0x84, 0x01, 0x3c, 0x80, 0xe1, 0x80, 0xc0,
+    0x84, 0x20, 0x5c, 0x00, 0x00, 0x20, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0c, 0xe8, 0x44, 0x30,
+    0x00, 0x36, 0x4b, 0xe0, 0x20, 0x01, 0x84, 0x20, 0x40, 0x00, 0x9c, 0x06, 0x46, 0x20, 0x00, 0x8e,
+    0x58, 0x21, 0x0c, 0xe8, 0x44, 0x30, 0x00, 0x37, 0x4b, 0xe0, 0x20, 0x01, 0x46, 0x00, 0x01, 0x12,
+    0x58, 0x00, 0x0c, 0x84, 0x38, 0x70, 0x1a, 0x0a, 0x46, 0x10, 0x04, 0x00, 0x58, 0x10, 0x82, 0x00,
+    0xa0, 0x0d, 0x84, 0x41, 0x40, 0x61, 0x18, 0x0c, 0x40, 0x63, 0x00, 0x04, 0xa9, 0x8d, 0x3a, 0x6f,
+    0xa0, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa0, 0xbc, 0x44, 0x30, 0x00, 0xb3, 0x80, 0xe1, 0x81, 0x02,
+    0x84, 0x20, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x08, 0x80, 0xc0, 0x46, 0xf0, 0x00, 0x04,
+    0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0x84, 0x00, 0x14, 0x83, 0x00, 0x04, 0xa8, 0x31, 0xa9, 0xf5,
+    0xb6, 0x06, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xfc, 0x84, 0x20,
+    0x80, 0xc0, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x08, 0x44, 0x30, 0x00, 0xe3, 0x46, 0x70,
+    0x00, 0x04, 0x58, 0x73, 0x81, 0x3c, 0xdd, 0x27, 0x80, 0x06, 0x84, 0x20, 0x46, 0x20, 0x00, 0x8e,
+    0x58, 0x21, 0x0d, 0x24, 0x44, 0x30, 0x00, 0xd5, 0xdd, 0x27, 0xb4, 0x06, 0xc0, 0x2c, 0x84, 0x20,
+    0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x08, 0x44, 0x30, 0x00, 0xe6, 0x46, 0x00, 0x01, 0x1a,
+    0x58, 0x00, 0x01, 0xe4, 0xdd, 0x27, 0x80, 0x06, 0x84, 0x20, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21,
+    0x0d, 0x08, 0x44, 0x30, 0x00, 0xe6, 0xdd, 0x27, 0xa0, 0x71, 0xb4, 0x46, 0x84, 0x00, 0xa8, 0x51,
+    0xb6, 0x41, 0xa8, 0x31, 0xb6, 0x06, 0x46, 0x50, 0x01, 0x1a, 0x58, 0x52, 0x81, 0xe4, 0xa0, 0xaa,
+    0xb4, 0x25, 0x9e, 0x91, 0xa8, 0xaa, 0xd9, 0x07, 0xa0, 0x0b, 0x46, 0xf0, 0x00, 0x02, 0x58, 0xf7,
+    0x8b, 0xb8, 0xdd, 0x2f, 0xec, 0x04, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x9c, 0xbc,
+    0xef, 0xfc, 0x46, 0xf0, 0x01, 0x1a, 0x04, 0x17, 0x80, 0x7c, 0x80, 0xe0, 0xc1, 0x18, 0x80, 0x01,
+    0x46, 0xf0, 0x00, 0x02, 0x58, 0xf7, 0x8b, 0xb8, 0xdd, 0x2f, 0x44, 0x10, 0x03, 0xe8, 0x42, 0x13,
+    0x84, 0x24, 0x44, 0x20, 0x7f, 0xff, 0x98, 0x4a, 0x46, 0xf0, 0x01, 0x1a, 0x04, 0x07, 0x80, 0x7c,
+    0x92, 0x2f, 0x46, 0xf0, 0x00, 0x02, 0x58, 0xf7, 0x8f, 0xf0, 0xdd, 0x2f, 0xec, 0x04, 0x3a, 0x6f,
+    0x9c, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xf4, 0x46, 0xf0, 0x00, 0x02, 0x58, 0xf7,
+    0x87, 0x3c, 0xdd, 0x2f, 0x81, 0x20, 0x46, 0x07, 0xff, 0xff, 0x58, 0x00, 0x0f, 0xff, 0x46, 0x10,
+    0x01, 0x1a, 0x58, 0x10, 0x81, 0xe4, 0x41, 0xc4, 0x80, 0x00, 0x15, 0xc0, 0x80, 0x04, 0x80, 0xe1,
+    0xb4, 0xc1, 0x46, 0x10, 0x01, 0xe0, 0x88, 0x29, 0x46, 0xa0, 0x00, 0x04, 0x58, 0xa5, 0x01, 0x3c,
+    0xf1, 0x81, 0xd5, 0x4a, 0x80, 0x06, 0x84, 0x20, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x08,
+    0x44, 0x30, 0x01, 0x4e, 0x4b, 0xe0, 0x28, 0x01, 0xa0, 0x32, 0x40, 0x14, 0x80, 0x01, 0x4e, 0x15,
+    0x00, 0x34, 0x80, 0x06, 0x84, 0x20, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x24, 0x44, 0x30,
+    0x00, 0xd5, 0x4b, 0xe0, 0x28, 0x01, 0xb4, 0x06, 0x84, 0x20, 0x40, 0x00, 0x80, 0x06, 0x46, 0x20,
+    0x00, 0x8e, 0x58, 0x21, 0x0d, 0x08, 0x44, 0x30, 0x01, 0x52, 0x4b, 0xe0, 0x28, 0x01, 0x80, 0x06,
+    0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x8c, 0xb4, 0xdd, 0x2f, 0xa4, 0x36, 0xc0, 0x0e, 0x9e, 0x01,
+    0xac, 0x36, 0xf0, 0x01, 0xa8, 0x32, 0xa0, 0x39, 0xa9, 0xb9, 0xb6, 0xe6, 0xa8, 0x31, 0xb6, 0xc0,
+    0xa0, 0x3a, 0x9c, 0x01, 0xa8, 0x3a, 0xd5, 0x05, 0xa0, 0x75, 0xc1, 0x03, 0xa0, 0x34, 0xdd, 0x21,
+    0x15, 0xc3, 0x80, 0x04, 0xd5, 0x08, 0xa0, 0x7c, 0x9a, 0x41, 0x4e, 0x15, 0x00, 0x03, 0xd5, 0x02,
+    0xa8, 0x3c, 0x81, 0x06, 0xb4, 0xc8, 0x46, 0x80, 0x01, 0x1a, 0x58, 0x84, 0x01, 0xe4, 0x4c, 0x64,
+    0x7f, 0xb3, 0xb4, 0xa6, 0xd6, 0x18, 0xa0, 0x34, 0x84, 0x20, 0x40, 0x04, 0x80, 0x01, 0x92, 0x1f,
+    0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x08, 0x44, 0x30, 0x01, 0x72, 0x46, 0xf0, 0x00, 0x04,
+    0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0xa0, 0x34, 0x8a, 0x09, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7,
+    0x8d, 0x48, 0xdd, 0x2f, 0xec, 0x0c, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa4, 0xbc,
+    0xef, 0xfc, 0x44, 0x80, 0xea, 0x60, 0x80, 0xe1, 0x46, 0x90, 0x00, 0x04, 0x58, 0x94, 0x81, 0x3c,
+    0x84, 0x20, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x08, 0x44, 0x30, 0x01, 0x06, 0x80, 0xc0,
+    0x4b, 0xe0, 0x24, 0x01, 0xe3, 0x07, 0xe8, 0x1d, 0x46, 0x0e, 0xa5, 0xf1, 0x58, 0x00, 0x05, 0xa1,
+    0x40, 0x03, 0x80, 0x06, 0x84, 0x20, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x08, 0x44, 0x30,
+    0x01, 0x0e, 0x4b, 0xe0, 0x24, 0x01, 0x40, 0x03, 0xa0, 0x37, 0x44, 0x1f, 0x15, 0xa0, 0x96, 0x01,
+    0x42, 0x70, 0x04, 0x73, 0xac, 0x36, 0xcf, 0x07, 0x9e, 0x01, 0xac, 0x36, 0x80, 0xe8, 0xd5, 0x03,
+    0x84, 0x00, 0xac, 0x36, 0x44, 0x00, 0xff, 0xff, 0x40, 0x03, 0x80, 0x06, 0x84, 0x20, 0x46, 0x20,
+    0x00, 0x8e, 0x58, 0x21, 0x0d, 0x08, 0x44, 0x30, 0x01, 0x1c, 0x40, 0x93, 0xbc, 0x08, 0x46, 0xf0,
+    0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0x50, 0x94, 0x83, 0xe7, 0x44, 0x00, 0x03, 0xe8,
+    0x40, 0x94, 0x80, 0x17, 0x46, 0x70, 0x01, 0x1a, 0x58, 0x73, 0x81, 0xe4, 0x46, 0xf0, 0x00, 0x02,
+    0x58, 0xf7, 0x87, 0x3c, 0xdd, 0x2f, 0x40, 0x84, 0x80, 0x00, 0xb4, 0xa7, 0xd7, 0x06, 0xa0, 0x3c,
+    0x40, 0x04, 0x00, 0x01, 0x4e, 0x04, 0x00, 0x0c, 0x46, 0xf0, 0x01, 0x1a, 0x14, 0x87, 0x80, 0x7d,
+    0x80, 0x09, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x8d, 0x48, 0xdd, 0x2f, 0x14, 0x83, 0x00, 0x02,
+    0x84, 0x20, 0x80, 0x06, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x24, 0x44, 0x30, 0x00, 0xd5,
+    0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0xb4, 0x26, 0xc9, 0x0c, 0x46, 0xf0,
+    0x01, 0x1a, 0x04, 0x07, 0x80, 0x7a, 0xa9, 0xb9, 0xb6, 0xe6, 0xa8, 0x31, 0xb6, 0xc0, 0xa0, 0x3a,
+    0x9c, 0x01, 0xa8, 0x3a, 0xec, 0x04, 0x3a, 0x6f, 0xa4, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x9c, 0xbc,
+    0xef, 0xf4, 0x46, 0x60, 0x01, 0x01, 0x58, 0x63, 0x0a, 0xd0, 0x80, 0xe0, 0x50, 0x0f, 0x80, 0x04,
+    0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0xb4, 0x46, 0xa0, 0x31, 0xa0, 0x72,
+    0x9a, 0x90, 0x40, 0x01, 0x04, 0x06, 0x44, 0x30, 0x00, 0x84, 0x84, 0x20, 0x46, 0x20, 0x00, 0x8e,
+    0x58, 0x21, 0x0d, 0x08, 0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0xb4, 0x46,
+    0xa0, 0x72, 0xf0, 0x01, 0x9e, 0x49, 0x40, 0x10, 0x88, 0x02, 0x9c, 0x4a, 0x94, 0x4a, 0x98, 0x71,
+    0xa9, 0xc9, 0xb4, 0x26, 0x9c, 0x49, 0xb6, 0x26, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x58,
+    0xdd, 0x2f, 0xec, 0x0c, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x9c, 0xbc,
+    0xef, 0xfc, 0x46, 0x60, 0x01, 0x1a, 0x58, 0x63, 0x01, 0xe4, 0x84, 0xe0, 0xa0, 0x33, 0x80, 0x27,
+    0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x08, 0x44, 0x30, 0x00, 0x9c, 0xb6, 0xc6, 0xa9, 0xb1,
+    0xa9, 0xf2, 0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0xa0, 0x33, 0x46, 0xf0,
+    0x00, 0x80, 0x58, 0xf7, 0x8f, 0xb8, 0xdd, 0x2f, 0xa9, 0xf3, 0xec, 0x04, 0x3a, 0x6f, 0x9c, 0x84,
+    0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xfc, 0x46, 0x60, 0x01, 0x1a, 0x58, 0x63,
+    0x01, 0xe4, 0xa1, 0xf3, 0x84, 0x20, 0xa8, 0x72, 0xb6, 0xc6, 0xa9, 0xb1, 0xcf, 0x14, 0x46, 0xf0,
+    0x00, 0x02, 0x58, 0xf7, 0x89, 0xb8, 0xdd, 0x2f, 0x80, 0x27, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21,
+    0x0d, 0x08, 0x44, 0x30, 0x00, 0x5c, 0xa8, 0x33, 0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c,
+    0xdd, 0x2f, 0xd5, 0x07, 0x80, 0x07, 0x46, 0xf0, 0x00, 0x02, 0x58, 0xf7, 0x8b, 0xb8, 0xdd, 0x2f,
+    0xec, 0x04, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x98, 0xbc, 0xef, 0xf8, 0x84, 0x20,
+    0x80, 0xc0, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x40, 0x40, 0x00, 0x80, 0x06, 0x44, 0x30,
+    0x00, 0xa9, 0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0x50, 0x0f, 0x80, 0x04,
+    0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0xa0, 0x32, 0xc8, 0x02, 0xd5, 0x09,
+    0x9e, 0x01, 0xa8, 0x32, 0x80, 0x06, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x86, 0x58, 0xdd, 0x2f,
+    0x80, 0xc0, 0xf0, 0x01, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x58, 0xdd, 0x2f, 0x80, 0x06,
+    0xec, 0x08, 0x3a, 0x6f, 0x98, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xf4, 0x84, 0x40,
+    0x80, 0xc0, 0x44, 0x30, 0x00, 0x8e, 0x40, 0x01, 0x00, 0x06, 0x80, 0xe1, 0x80, 0x22, 0x46, 0x20,
+    0x00, 0x8e, 0x58, 0x21, 0x0d, 0x40, 0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f,
+    0x50, 0x0f, 0x80, 0x04, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0xa0, 0x72,
+    0x80, 0x06, 0x9c, 0x49, 0xa8, 0x72, 0x80, 0x27, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x87, 0x04,
+    0xdd, 0x2f, 0xf0, 0x01, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x58, 0xdd, 0x2f, 0xec, 0x0c,
+    0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xa0, 0xbc, 0x46, 0x00, 0x01, 0x1a,
+    0x58, 0x00, 0x01, 0xf8, 0x84, 0x40, 0xa8, 0x82, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x87, 0xb4,
+    0xdd, 0x2f, 0x46, 0x70, 0x01, 0x12, 0x58, 0x73, 0x8d, 0x04, 0x46, 0x60, 0x01, 0x15, 0x58, 0x63,
+    0x0f, 0x44, 0x46, 0x80, 0x00, 0x81, 0x58, 0x84, 0x01, 0x24, 0xa9, 0xf2, 0x80, 0x26, 0x46, 0x00,
+    0x01, 0x1a, 0x58, 0x00, 0x01, 0xf8, 0x4b, 0xe0, 0x20, 0x01, 0x50, 0x73, 0x86, 0x48, 0x46, 0x50,
+    0x01, 0x14, 0x58, 0x52, 0x86, 0x24, 0x8c, 0xd4, 0xdf, 0xf1, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00,
+    0x02, 0x08, 0x84, 0x40, 0xa8, 0x82, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x87, 0xb4, 0xdd, 0x2f,
+    0x46, 0x70, 0x01, 0x14, 0x58, 0x73, 0x86, 0x24, 0x46, 0x60, 0x01, 0x15, 0x58, 0x63, 0x0f, 0x94,
+    0x46, 0x80, 0x00, 0x81, 0x58, 0x84, 0x01, 0x24, 0xa9, 0xf2, 0x80, 0x26, 0x46, 0x00, 0x01, 0x1a,
+    0x58, 0x00, 0x02, 0x08, 0x4b, 0xe0, 0x20, 0x01, 0x50, 0x73, 0x86, 0x48, 0x46, 0x50, 0x01, 0x15,
+    0x58, 0x52, 0x8f, 0x44, 0x8c, 0xd4, 0xdf, 0xf1, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e, 0x92, 0x00,
+    0x3a, 0x6f, 0x98, 0xbc, 0xef, 0xf8, 0x5c, 0xf0, 0x00, 0x80, 0xe8, 0x06, 0x46, 0x60, 0x01, 0x1a,
+    0x58, 0x63, 0x02, 0x18, 0xd5, 0x0d, 0x46, 0x10, 0x01, 0x1a, 0x58, 0x10, 0x82, 0x28, 0x5c, 0x00,
+    0x02, 0x58, 0x50, 0x20, 0x80, 0x10, 0x40, 0x60, 0x80, 0x1b, 0x40, 0x61, 0x00, 0x1a, 0x84, 0x01,
+    0x84, 0x20, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x5c, 0x44, 0x30, 0x01, 0x9b, 0x46, 0xf0,
+    0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0x50, 0x0f, 0x80, 0x04, 0x46, 0xf0, 0x00, 0x01,
+    0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0xa0, 0x32, 0xc8, 0x02, 0xd5, 0x09, 0x9e, 0x01, 0xa8, 0x32,
+    0x80, 0x06, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x86, 0x58, 0xdd, 0x2f, 0x80, 0xc0, 0xf0, 0x01,
+    0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x58, 0xdd, 0x2f, 0x80, 0x06, 0xec, 0x08, 0x3a, 0x6f,
+    0x98, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x98, 0xbc, 0xef, 0xf8, 0x84, 0x20, 0x80, 0xc0, 0x46, 0x20,
+    0x00, 0x8e, 0x58, 0x21, 0x0d, 0x5c, 0x40, 0x00, 0x80, 0x06, 0x44, 0x30, 0x01, 0x50, 0x46, 0xf0,
+    0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0x50, 0x0f, 0x80, 0x04, 0x46, 0xf0, 0x00, 0x01,
+    0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0xa0, 0x32, 0xc8, 0x02, 0xd5, 0x09, 0x9e, 0x01, 0xa8, 0x32,
+    0x80, 0x06, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x86, 0x58, 0xdd, 0x2f, 0x80, 0xc0, 0xf0, 0x01,
+    0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x58, 0xdd, 0x2f, 0x80, 0x06, 0xec, 0x08, 0x3a, 0x6f,
+    0x98, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa0, 0xbc, 0xef, 0xf8, 0x84, 0x40, 0x80, 0xc0, 0x54, 0x80,
+    0x80, 0xff, 0x40, 0x01, 0x00, 0x06, 0x80, 0x22, 0x44, 0x30, 0x01, 0x24, 0x46, 0x20, 0x00, 0x8e,
+    0x58, 0x21, 0x0d, 0x5c, 0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0xa0, 0x32,
+    0xc0, 0x22, 0xb4, 0x46, 0xd5, 0x1e, 0x00, 0x51, 0x00, 0x12, 0x80, 0xe2, 0x4c, 0x54, 0x40, 0x19,
+    0x50, 0x0f, 0x80, 0x04, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0xa0, 0x72,
+    0x80, 0x07, 0x9e, 0x49, 0xa8, 0x72, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x86, 0x24, 0xdd, 0x2f,
+    0xf0, 0x01, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x58, 0xdd, 0x2f, 0xd5, 0x05, 0xb4, 0x42,
+    0x4c, 0x23, 0x7f, 0xe3, 0x84, 0xe0, 0x80, 0x07, 0xec, 0x08, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0xa0, 0xbc, 0xef, 0xf8, 0x84, 0x40, 0x80, 0xc0, 0x54, 0x80, 0x80, 0xff, 0x40, 0x01,
+    0x00, 0x06, 0x80, 0x22, 0x44, 0x30, 0x00, 0xfb, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x5c,
+    0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0xa0, 0x32, 0xc0, 0x22, 0xb4, 0x46,
+    0xd5, 0x1e, 0x00, 0x51, 0x00, 0x1b, 0x80, 0xe2, 0x4c, 0x54, 0x40, 0x19, 0x50, 0x0f, 0x80, 0x04,
+    0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0xa0, 0x72, 0x80, 0x07, 0x9e, 0x49,
+    0xa8, 0x72, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x86, 0x24, 0xdd, 0x2f, 0xf0, 0x01, 0x46, 0xf0,
+    0x00, 0x01, 0x58, 0xf7, 0x8c, 0x58, 0xdd, 0x2f, 0xd5, 0x05, 0xb4, 0x42, 0x4c, 0x23, 0x7f, 0xe3,
+    0x84, 0xe0, 0x80, 0x07, 0xec, 0x08, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x9c, 0xbc,
+    0xef, 0xf4, 0x80, 0xe1, 0x00, 0x10, 0x80, 0x1a, 0x80, 0xc0, 0xe6, 0x23, 0xe9, 0x0e, 0x84, 0x00,
+    0x80, 0x20, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x5c, 0x44, 0x30, 0x00, 0xde, 0x46, 0xf0,
+    0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0x84, 0x20, 0x44, 0x30, 0x00, 0xe4, 0x40, 0x00,
+    0x98, 0x06, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x5c, 0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7,
+    0x81, 0x3c, 0xdd, 0x2f, 0x50, 0x0f, 0x80, 0x04, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x2c,
+    0xdd, 0x2f, 0xa0, 0x72, 0x80, 0x06, 0x9c, 0x49, 0xa8, 0x72, 0x80, 0x27, 0x46, 0xf0, 0x00, 0x81,
+    0x58, 0xf7, 0x87, 0x5c, 0xdd, 0x2f, 0xf0, 0x01, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x58,
+    0xdd, 0x2f, 0xec, 0x0c, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x9c, 0xbc,
+    0xef, 0xf4, 0x80, 0xe1, 0x00, 0x10, 0x80, 0x1a, 0x80, 0xc0, 0xe6, 0x23, 0xe9, 0x0e, 0x84, 0x00,
+    0x80, 0x20, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x5c, 0x44, 0x30, 0x00, 0xc1, 0x46, 0xf0,
+    0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0x84, 0x20, 0x44, 0x30, 0x00, 0xc7, 0x40, 0x00,
+    0x98, 0x06, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x5c, 0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7,
+    0x81, 0x3c, 0xdd, 0x2f, 0x50, 0x0f, 0x80, 0x04, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x2c,
+    0xdd, 0x2f, 0xa0, 0x72, 0x80, 0x06, 0x9c, 0x49, 0xa8, 0x72, 0x80, 0x27, 0x46, 0xf0, 0x00, 0x81,
+    0x58, 0xf7, 0x87, 0x04, 0xdd, 0x2f, 0xf0, 0x01, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x58,
+    0xdd, 0x2f, 0xec, 0x0c, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xa4, 0xbc,
+    0xef, 0xfc, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x02, 0x18, 0x85, 0x20, 0x14, 0x90, 0x00, 0x02,
+    0x46, 0x70, 0x01, 0x15, 0x58, 0x73, 0x8f, 0xe4, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x87, 0xb4,
+    0xdd, 0x2f, 0x46, 0x60, 0x01, 0x17, 0x58, 0x63, 0x0f, 0xe4, 0x46, 0x80, 0x00, 0x81, 0x58, 0x84,
+    0x04, 0x88, 0xa9, 0xf2, 0x10, 0x93, 0x00, 0x1a, 0x80, 0x26, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00,
+    0x02, 0x18, 0x4b, 0xe0, 0x20, 0x01, 0x50, 0x73, 0x80, 0x80, 0x46, 0x50, 0x01, 0x17, 0x58, 0x52,
+    0x8f, 0xe4, 0x50, 0x63, 0x00, 0x20, 0xdf, 0xee, 0x46, 0x10, 0x01, 0x1a, 0x58, 0x10, 0x82, 0x18,
+    0x84, 0x40, 0xa8, 0x8e, 0x50, 0x00, 0x80, 0x10, 0x46, 0x60, 0x01, 0x06, 0x58, 0x63, 0x0d, 0x60,
+    0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x87, 0xb4, 0xdd, 0x2f, 0x46, 0x70, 0x01, 0x18, 0x58, 0x73,
+    0x87, 0xe4, 0x85, 0x21, 0x46, 0x80, 0x00, 0x81, 0x58, 0x84, 0x04, 0x88, 0xa9, 0xba, 0x10, 0x93,
+    0x80, 0x1a, 0x80, 0x27, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x02, 0x28, 0x4b, 0xe0, 0x20, 0x01,
+    0x46, 0x00, 0x01, 0x0c, 0x50, 0x63, 0x02, 0x58, 0x58, 0x50, 0x0b, 0x20, 0x50, 0x73, 0x80, 0x20,
+    0xde, 0xee, 0x46, 0x10, 0x01, 0x1a, 0x58, 0x10, 0x82, 0x18, 0x84, 0x40, 0x14, 0x20, 0x80, 0x0a,
+    0x50, 0x00, 0x80, 0x20, 0x46, 0x60, 0x00, 0x90, 0x58, 0x63, 0x02, 0x08, 0x46, 0xf0, 0x00, 0x81,
+    0x58, 0xf7, 0x87, 0xb4, 0xdd, 0x2f, 0x46, 0x70, 0x01, 0x18, 0x58, 0x73, 0x8c, 0xe4, 0x85, 0x22,
+    0x46, 0x80, 0x00, 0x81, 0x58, 0x84, 0x04, 0x88, 0xa9, 0xba, 0x10, 0x93, 0x80, 0x1a, 0x80, 0x27,
+    0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x02, 0x38, 0x4b, 0xe0, 0x20, 0x01, 0x46, 0x00, 0x00, 0x9b,
+    0x50, 0x63, 0x06, 0x4c, 0x58, 0x50, 0x0e, 0xf0, 0x50, 0x73, 0x80, 0x20, 0xde, 0xee, 0xec, 0x04,
+    0x3a, 0x6f, 0xa4, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x98, 0xbc, 0x84, 0x20, 0x80, 0xc0,
+    0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x78, 0x40, 0x00, 0x80, 0x06, 0x44, 0x30, 0x00, 0x7f,
+    0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0xa0, 0x31, 0xb4, 0x26, 0xb6, 0x20,
+    0xb4, 0x06, 0xa1, 0xb1, 0xa9, 0x81, 0x3a, 0x6f, 0x98, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa0, 0xbc,
+    0x84, 0xe0, 0x81, 0x00, 0x80, 0x27, 0x40, 0x03, 0x80, 0x06, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21,
+    0x0d, 0x78, 0x44, 0x30, 0x00, 0x91, 0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f,
+    0xb4, 0xc8, 0x4c, 0x64, 0x40, 0x04, 0x80, 0xc7, 0xd5, 0x07, 0x80, 0x06, 0x46, 0xf0, 0x00, 0x81,
+    0x58, 0xf7, 0x86, 0x24, 0xdd, 0x2f, 0x80, 0x06, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e, 0x92, 0x00,
+    0x3a, 0x6f, 0xa8, 0xbc, 0x84, 0xc0, 0x80, 0xe0, 0x81, 0x21, 0x81, 0x02, 0x46, 0xa0, 0x00, 0x04,
+    0x58, 0xa5, 0x01, 0x3c, 0x40, 0x03, 0x00, 0x06, 0x80, 0x26, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21,
+    0x0d, 0x78, 0x44, 0x30, 0x00, 0x49, 0x4b, 0xe0, 0x28, 0x01, 0x40, 0x03, 0x24, 0x06, 0x80, 0x26,
+    0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x78, 0x44, 0x30, 0x00, 0x4a, 0x4b, 0xe0, 0x28, 0x01,
+    0x40, 0x03, 0x20, 0x06, 0x80, 0x26, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x78, 0x44, 0x30,
+    0x00, 0x4b, 0x4b, 0xe0, 0x28, 0x01, 0x14, 0x93, 0x80, 0x01, 0xb7, 0x07, 0xb6, 0xe9, 0x14, 0x74,
+    0x00, 0x01, 0x3a, 0x6f, 0xa8, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa4, 0xbc, 0xef, 0xfc, 0x84, 0xc0,
+    0x80, 0xe0, 0x81, 0x01, 0x40, 0x03, 0x00, 0x06, 0x46, 0x90, 0x00, 0x04, 0x58, 0x94, 0x81, 0x3c,
+    0x80, 0x26, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x78, 0x44, 0x30, 0x00, 0x6f, 0x4b, 0xe0,
+    0x24, 0x01, 0x40, 0x03, 0x20, 0x06, 0x80, 0x26, 0x44, 0x30, 0x00, 0x70, 0x46, 0x20, 0x00, 0x8e,
+    0x58, 0x21, 0x0d, 0x78, 0x4b, 0xe0, 0x24, 0x01, 0xa0, 0x79, 0x80, 0x08, 0x80, 0x47, 0x46, 0xf0,
+    0x00, 0x81, 0x58, 0xf7, 0x86, 0x9c, 0xdd, 0x2f, 0xec, 0x04, 0x3a, 0x6f, 0xa4, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0xa4, 0xbc, 0xef, 0xfc, 0x84, 0xc0, 0x80, 0xe0, 0x81, 0x01, 0x40, 0x03, 0x00, 0x06,
+    0x46, 0x90, 0x00, 0x04, 0x58, 0x94, 0x81, 0x3c, 0x80, 0x26, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21,
+    0x0d, 0x78, 0x44, 0x30, 0x00, 0x5e, 0x4b, 0xe0, 0x24, 0x01, 0x40, 0x03, 0x20, 0x06, 0x80, 0x26,
+    0x44, 0x30, 0x00, 0x5f, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x78, 0x4b, 0xe0, 0x24, 0x01,
+    0xb4, 0x47, 0x80, 0x08, 0x80, 0x27, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x86, 0x9c, 0xdd, 0x2f,
+    0xec, 0x04, 0x3a, 0x6f, 0xa4, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x98, 0xbc, 0x84, 0x20, 0x80, 0xc0,
+    0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x78, 0x40, 0x00, 0x80, 0x06, 0x44, 0x30, 0x00, 0x29,
+    0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x81, 0x3c, 0xdd, 0x2f, 0xa9, 0xb1, 0xb6, 0xc6, 0x3a, 0x6f,
+    0x98, 0x84, 0xdd, 0x9e, 0x46, 0x00, 0x04, 0x11, 0x58, 0x00, 0x03, 0xb4, 0xb4, 0x40, 0x46, 0x30,
+    0x0a, 0x00, 0x40, 0x21, 0x0c, 0x04, 0x46, 0x10, 0x04, 0x00, 0xb6, 0x40, 0xb4, 0x21, 0x54, 0x10,
+    0x80, 0x0f, 0xe6, 0x24, 0xe9, 0x0d, 0xb4, 0x40, 0x42, 0x21, 0x50, 0x09, 0xb6, 0x40, 0x46, 0x10,
+    0x04, 0x11, 0x04, 0x00, 0x80, 0xcb, 0x58, 0x00, 0x00, 0x01, 0x14, 0x00, 0x80, 0xcb, 0x46, 0x00,
+    0x01, 0x19, 0x58, 0x00, 0x00, 0xa4, 0xa7, 0x01, 0xa6, 0x82, 0xa6, 0x40, 0xa6, 0xc3, 0x40, 0x42,
+    0x20, 0x08, 0x40, 0x21, 0x40, 0x08, 0x40, 0x22, 0x08, 0x04, 0x40, 0x21, 0x04, 0x04, 0x40, 0x31,
+    0xe0, 0x08, 0x46, 0x10, 0x04, 0x11, 0x40, 0x21, 0x0c, 0x04, 0x14, 0x20, 0x80, 0x28, 0x46, 0x10,
+    0x04, 0x11, 0xa6, 0xc5, 0xa6, 0x84, 0x40, 0x01, 0xa0, 0x08, 0x58, 0x10, 0x80, 0xa4, 0x40, 0x00,
+    0x08, 0x04, 0xb6, 0x01, 0x46, 0x20, 0x04, 0x10, 0xb4, 0x01, 0x42, 0x00, 0x7c, 0x08, 0xb6, 0x01,
+    0x46, 0x00, 0x04, 0x10, 0x04, 0x11, 0x02, 0x04, 0x58, 0x00, 0x08, 0x18, 0x42, 0x10, 0xc4, 0x08,
+    0x14, 0x11, 0x02, 0x04, 0x84, 0x93, 0xb4, 0x60, 0x46, 0x10, 0x04, 0x11, 0x40, 0x31, 0x90, 0x02,
+    0xb6, 0x60, 0x46, 0x20, 0x10, 0x10, 0xb4, 0x60, 0x58, 0x21, 0x02, 0x02, 0x58, 0x31, 0x80, 0x04,
+    0xb6, 0x60, 0x14, 0x20, 0x80, 0xf3, 0x04, 0x20, 0x80, 0xf4, 0x80, 0x01, 0x58, 0x21, 0x00, 0x01,
+    0x14, 0x20, 0x80, 0xf4, 0x04, 0x20, 0x00, 0xed, 0x42, 0x21, 0x58, 0x09, 0x14, 0x20, 0x00, 0xed,
+    0x80, 0x20, 0x04, 0x20, 0x80, 0xc0, 0x46, 0x4f, 0xff, 0x00, 0x40, 0x21, 0x10, 0x02, 0x58, 0x21,
+    0x01, 0x00, 0x14, 0x20, 0x80, 0xc0, 0x04, 0x20, 0x00, 0xc1, 0x80, 0x20, 0x40, 0x21, 0x10, 0x02,
+    0x58, 0x21, 0x01, 0x00, 0x14, 0x20, 0x00, 0xc1, 0x04, 0x20, 0x80, 0xc2, 0x40, 0x21, 0x10, 0x02,
+    0x58, 0x21, 0x01, 0x00, 0x14, 0x20, 0x80, 0xc2, 0x04, 0x30, 0x00, 0xc3, 0x80, 0x20, 0x40, 0x31,
+    0x90, 0x02, 0x46, 0x24, 0x32, 0x10, 0x58, 0x31, 0x81, 0x00, 0x14, 0x30, 0x00, 0xc3, 0x14, 0x20,
+    0x80, 0xd5, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xdc, 0x46, 0x30, 0x01, 0x19, 0x58, 0x31,
+    0x80, 0xec, 0x96, 0x00, 0x39, 0xc1, 0x81, 0x01, 0x44, 0x30, 0x0f, 0xff, 0x50, 0x4e, 0x00, 0x01,
+    0x97, 0x21, 0x40, 0x32, 0x0c, 0xb7, 0x46, 0x60, 0x01, 0x1a, 0x58, 0x63, 0x05, 0x48, 0x50, 0x73,
+    0x00, 0x14, 0x01, 0xe3, 0x00, 0x03, 0x54, 0x9e, 0x00, 0x0f, 0x40, 0x94, 0x90, 0x08, 0x96, 0x48,
+    0x00, 0xa3, 0x00, 0x02, 0x46, 0x30, 0x01, 0x19, 0x58, 0x31, 0x81, 0xf0, 0x94, 0x4d, 0x55, 0xef,
+    0x00, 0x1f, 0x38, 0x41, 0x82, 0x02, 0x41, 0xef, 0x04, 0x04, 0x54, 0x21, 0x00, 0x7f, 0x93, 0x47,
+    0x40, 0xa5, 0x1c, 0x08, 0x40, 0xa5, 0x08, 0x04, 0xa6, 0xf1, 0x44, 0x1f, 0xff, 0xb7, 0x40, 0x22,
+    0x20, 0x09, 0x41, 0xce, 0x10, 0x09, 0xf5, 0x87, 0x46, 0x50, 0x01, 0x19, 0x58, 0x52, 0x82, 0x30,
+    0x00, 0x83, 0x80, 0x16, 0x38, 0x52, 0x82, 0x02, 0x15, 0xef, 0x80, 0x03, 0xf5, 0x84, 0x54, 0x54,
+    0x00, 0x0f, 0x40, 0x52, 0xa4, 0x04, 0xb6, 0xbf, 0xa7, 0x74, 0x05, 0xef, 0x80, 0x04, 0x58, 0x52,
+    0x80, 0x01, 0x14, 0xaf, 0x80, 0x05, 0xf5, 0x86, 0x40, 0xa2, 0x60, 0x09, 0x40, 0x5f, 0x20, 0x09,
+    0x05, 0xef, 0x80, 0x07, 0x14, 0xaf, 0x80, 0x01, 0x58, 0x81, 0x80, 0x03, 0x46, 0xa0, 0x01, 0x19,
+    0x58, 0xa5, 0x00, 0xec, 0x39, 0xe5, 0x01, 0x09, 0x40, 0x94, 0x04, 0x02, 0x9c, 0xc1, 0x50, 0x80,
+    0x7f, 0xc8, 0x84, 0x00, 0xae, 0x3b, 0xae, 0xf5, 0xf0, 0x03, 0xf3, 0x05, 0x04, 0xaf, 0x80, 0x06,
+    0x40, 0x12, 0x40, 0x09, 0xae, 0x33, 0x10, 0x93, 0x00, 0x01, 0xae, 0xf2, 0x10, 0xa3, 0x00, 0x04,
+    0x10, 0x83, 0x00, 0x13, 0xae, 0x7e, 0xae, 0xbd, 0x05, 0xef, 0x80, 0x01, 0x10, 0x53, 0x80, 0x09,
+    0x11, 0xe3, 0x80, 0x07, 0xb4, 0x1f, 0x10, 0x03, 0x80, 0x16, 0x44, 0x00, 0x00, 0x64, 0x11, 0xc3,
+    0x80, 0x17, 0xae, 0x3a, 0xaf, 0x3c, 0xf1, 0x04, 0x10, 0x13, 0x80, 0x08, 0xec, 0x24, 0x3a, 0x6f,
+    0xaa, 0x84, 0xdd, 0x9e, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x17, 0x82, 0xda, 0x84, 0x41, 0x40, 0x01,
+    0x00, 0x0c, 0x40, 0x00, 0x04, 0x02, 0x84, 0x20, 0x40, 0x00, 0x80, 0x06, 0xdd, 0x9e, 0x92, 0x00,
+    0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x98, 0x3c, 0x96, 0x00, 0x9e, 0x01, 0x84, 0x86, 0x42, 0x40,
+    0x10, 0x24, 0x46, 0x30, 0x01, 0x1a, 0x58, 0x31, 0x82, 0x48, 0x99, 0x23, 0x96, 0x48, 0x96, 0x90,
+    0xa7, 0x61, 0x46, 0x30, 0x01, 0x19, 0x58, 0x31, 0x81, 0xa0, 0xc9, 0x28, 0x38, 0x41, 0x88, 0x00,
+    0xe6, 0x82, 0xe8, 0x04, 0x9d, 0x21, 0x38, 0x41, 0x88, 0x08, 0x84, 0x66, 0x42, 0x30, 0x0c, 0x24,
+    0x46, 0x40, 0x01, 0x1a, 0x58, 0x42, 0x02, 0x48, 0x98, 0xdc, 0xa6, 0xda, 0xc3, 0x0c, 0x46, 0x30,
+    0x01, 0x19, 0x58, 0x31, 0x81, 0xb0, 0x38, 0x41, 0x88, 0x00, 0xe6, 0x86, 0xe8, 0x04, 0x9d, 0x21,
+    0x38, 0x41, 0x88, 0x08, 0x46, 0x30, 0x04, 0x00, 0x04, 0x41, 0x80, 0x25, 0x46, 0x30, 0x01, 0x19,
+    0x58, 0x31, 0x81, 0x60, 0x38, 0x41, 0x8a, 0x0a, 0xd5, 0x0c, 0xa7, 0xa2, 0x84, 0x80, 0x38, 0x41,
+    0x88, 0x08, 0xc6, 0x07, 0x46, 0x30, 0x01, 0x19, 0x58, 0x31, 0x81, 0xb0, 0x38, 0x41, 0x88, 0x08,
+    0x84, 0x66, 0x42, 0x00, 0x0c, 0x24, 0x46, 0x30, 0x01, 0x1a, 0x58, 0x31, 0x82, 0x48, 0x98, 0x03,
+    0xa6, 0x00, 0xe6, 0x02, 0xe9, 0x15, 0xc9, 0x03, 0xe6, 0xa2, 0xe9, 0x07, 0x84, 0x20, 0x46, 0x00,
+    0x01, 0x19, 0x58, 0x00, 0x01, 0xc0, 0xd5, 0x0a, 0x46, 0x00, 0x01, 0x19, 0x58, 0x00, 0x01, 0xc0,
+    0x38, 0x10, 0x08, 0x00, 0xe6, 0x22, 0xe8, 0x04, 0x9c, 0x49, 0x38, 0x10, 0x08, 0x08, 0x3a, 0x6f,
+    0x98, 0x04, 0xdd, 0x9e, 0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x81, 0xc0, 0x96, 0x00, 0x38, 0x00,
+    0x80, 0x00, 0x84, 0x21, 0x40, 0x00, 0x80, 0x06, 0xdd, 0x9e, 0x92, 0x00, 0x46, 0x10, 0x01, 0x19,
+    0x58, 0x10, 0x81, 0xa0, 0x96, 0x00, 0x38, 0x10, 0x80, 0x00, 0xe6, 0x22, 0xe9, 0x03, 0x84, 0x01,
+    0xd5, 0x0a, 0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x81, 0xb0, 0x38, 0x00, 0x80, 0x00, 0x84, 0x25,
+    0x40, 0x00, 0x80, 0x06, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xfc, 0x80, 0xe0,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x63, 0x80, 0x13, 0xe6, 0x02, 0xe9, 0x2c, 0x80, 0x06, 0x46, 0xf0,
+    0x00, 0x81, 0x58, 0xf7, 0x8b, 0x20, 0xdd, 0x2f, 0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x81, 0x40,
+    0xc0, 0x13, 0x84, 0x00, 0x10, 0x03, 0x80, 0x1d, 0x38, 0x00, 0x98, 0x00, 0xc0, 0x03, 0x84, 0x00,
+    0xd5, 0x50, 0x46, 0x20, 0x04, 0x11, 0x84, 0x61, 0x38, 0x30, 0x98, 0x08, 0x44, 0x10, 0x02, 0x02,
+    0x14, 0x11, 0x00, 0xf3, 0xd5, 0x46, 0x38, 0x20, 0x98, 0x00, 0x84, 0xa1, 0xda, 0x0b, 0x46, 0x20,
+    0x04, 0x11, 0x46, 0x30, 0x10, 0x10, 0x58, 0x31, 0x82, 0x02, 0x38, 0x00, 0x98, 0x08, 0x14, 0x31,
+    0x00, 0xf3, 0x80, 0x06, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x8b, 0x38, 0xdd, 0x2f, 0xc0, 0x13,
+    0x46, 0x00, 0x01, 0x12, 0x58, 0x00, 0x01, 0x14, 0x38, 0x10, 0x18, 0x00, 0xc1, 0x04, 0x9e, 0x49,
+    0x38, 0x10, 0x18, 0x08, 0x84, 0x21, 0x46, 0x00, 0x01, 0x19, 0x58, 0x00, 0x01, 0x50, 0x38, 0x10,
+    0x18, 0x08, 0xd5, 0x19, 0x46, 0x20, 0x01, 0x19, 0x58, 0x21, 0x01, 0x50, 0x38, 0x11, 0x18, 0x00,
+    0x84, 0xa1, 0xd9, 0x11, 0x46, 0x10, 0x04, 0x00, 0x04, 0x30, 0x80, 0x25, 0x46, 0x10, 0x01, 0x19,
+    0x58, 0x10, 0x81, 0x60, 0x38, 0x10, 0x9a, 0x02, 0x9a, 0x59, 0x5c, 0xf0, 0x80, 0x33, 0xe9, 0x03,
+    0x38, 0x01, 0x18, 0x08, 0x46, 0x00, 0x01, 0x12, 0x58, 0x00, 0x01, 0x14, 0x38, 0x00, 0x18, 0x00,
+    0xec, 0x04, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xe4, 0x46, 0x30,
+    0x01, 0x12, 0x96, 0x00, 0x00, 0x51, 0x8b, 0xa0, 0xf0, 0x83, 0x96, 0x48, 0x84, 0x01, 0x80, 0xe2,
+    0xf1, 0x85, 0xd8, 0x06, 0x84, 0x00, 0x10, 0x01, 0x8b, 0xa0, 0x48, 0x00, 0x01, 0x11, 0xf1, 0x03,
+    0x44, 0x30, 0x00, 0x50, 0x42, 0x30, 0x8c, 0x24, 0x46, 0x20, 0x01, 0x1b, 0x58, 0x21, 0x05, 0x80,
+    0x98, 0xda, 0x04, 0x41, 0x81, 0x74, 0xcc, 0x04, 0x04, 0x51, 0x81, 0x78, 0xc5, 0x1f, 0xf0, 0x03,
+    0x44, 0x30, 0x00, 0x50, 0x42, 0x30, 0x0c, 0x24, 0x85, 0x20, 0x46, 0x20, 0x0f, 0xff, 0x46, 0x10,
+    0x01, 0x1b, 0x58, 0x10, 0x8b, 0x48, 0x83, 0x89, 0x14, 0x9f, 0x80, 0x02, 0x14, 0x9f, 0x80, 0x01,
+    0x80, 0xc9, 0x14, 0x9f, 0x80, 0x04, 0x40, 0x81, 0x84, 0x00, 0x58, 0x21, 0x0f, 0xfe, 0x46, 0xa0,
+    0x01, 0x19, 0x58, 0xa5, 0x01, 0x0c, 0x81, 0x27, 0xd5, 0x1e, 0x04, 0x21, 0x81, 0x7c, 0xca, 0xe0,
+    0x04, 0x41, 0x81, 0x80, 0xcc, 0xdd, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42, 0x01, 0x0c, 0xb4, 0xa4,
+    0xcd, 0xd7, 0xa0, 0x21, 0xc8, 0xd5, 0xa0, 0x62, 0xc9, 0xd3, 0xa1, 0x23, 0xcc, 0xd1, 0x04, 0x31,
+    0x81, 0x84, 0xcb, 0xce, 0x46, 0xf0, 0x01, 0x19, 0x04, 0x37, 0x80, 0x47, 0x4e, 0x32, 0x00, 0xc8,
+    0xd5, 0xc7, 0x80, 0xc0, 0xb4, 0x6a, 0xcb, 0x2b, 0x80, 0xe6, 0x80, 0xc2, 0x80, 0x08, 0x46, 0xf0,
+    0x00, 0x81, 0x58, 0xf7, 0x82, 0xb0, 0xdd, 0x2f, 0xb6, 0x0a, 0xc0, 0x1f, 0xa0, 0xc5, 0x40, 0x14,
+    0x8c, 0x01, 0xe2, 0x69, 0xe8, 0x18, 0xe2, 0xc1, 0xe9, 0x16, 0x00, 0x30, 0x00, 0x12, 0xc3, 0x13,
+    0x84, 0xa1, 0x80, 0x20, 0xd3, 0x10, 0x00, 0x30, 0x00, 0x1a, 0x46, 0x20, 0x01, 0x1a, 0x58, 0x21,
+    0x02, 0x18, 0x94, 0xdc, 0x98, 0x1a, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x84, 0x88, 0xdd, 0x2f,
+    0x84, 0x80, 0xb6, 0x8a, 0xb4, 0xaa, 0xc5, 0xdb, 0x80, 0x46, 0x80, 0xc7, 0xb4, 0x0a, 0xc0, 0x21,
+    0xf3, 0x01, 0x84, 0xa1, 0x9c, 0x59, 0x96, 0x48, 0xf1, 0x81, 0xd1, 0x1d, 0xa1, 0x35, 0xa0, 0xc5,
+    0xe2, 0x64, 0xe8, 0x17, 0x9a, 0xe3, 0xe2, 0x43, 0xe9, 0x14, 0xf5, 0x03, 0x46, 0x30, 0x01, 0x12,
+    0x58, 0x31, 0x80, 0xd0, 0x38, 0x31, 0x96, 0x02, 0x88, 0x69, 0xe2, 0x83, 0xe8, 0x0c, 0x9a, 0x5c,
+    0x40, 0x41, 0x04, 0x06, 0xf1, 0x02, 0x84, 0x61, 0x40, 0x11, 0x90, 0x1a, 0xf1, 0x82, 0xd5, 0x03,
+    0x80, 0x06, 0xd5, 0x03, 0x15, 0xcf, 0x80, 0x04, 0x51, 0xce, 0x00, 0x01, 0x55, 0xce, 0x00, 0xff,
+    0x84, 0xa5, 0x8d, 0x44, 0x8d, 0x10, 0x4d, 0xc2, 0xff, 0xa6, 0xf4, 0x01, 0x04, 0x9f, 0x80, 0x04,
+    0xc4, 0x66, 0x84, 0x60, 0x46, 0x20, 0x01, 0x19, 0x58, 0x21, 0x01, 0x0c, 0x38, 0x31, 0x26, 0x0a,
+    0xa0, 0xc2, 0x00, 0x70, 0x00, 0x12, 0xa6, 0x99, 0x97, 0x7c, 0x95, 0x6b, 0x42, 0x21, 0x0c, 0x09,
+    0x40, 0x21, 0x14, 0x04, 0xae, 0x99, 0x00, 0x50, 0x00, 0x12, 0x42, 0x61, 0x18, 0x09, 0x42, 0x52,
+    0x84, 0x0b, 0x95, 0x6e, 0x40, 0x53, 0x14, 0x04, 0xaf, 0x59, 0x84, 0x21, 0xf5, 0x01, 0x50, 0x21,
+    0x80, 0x14, 0xd9, 0x13, 0xf5, 0x03, 0x80, 0x89, 0x42, 0x42, 0xf0, 0x73, 0x46, 0x10, 0x01, 0x1b,
+    0x58, 0x10, 0x85, 0x80, 0x50, 0x42, 0x00, 0x5d, 0x95, 0x24, 0x99, 0x21, 0xb4, 0x84, 0xcc, 0x05,
+    0xa6, 0x51, 0x42, 0x10, 0x94, 0x09, 0xd5, 0x21, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x47, 0x8b, 0x97,
+    0xf1, 0x05, 0x9f, 0x21, 0xe0, 0x24, 0xe9, 0x15, 0xf4, 0x02, 0xcc, 0x13, 0xa6, 0x51, 0x42, 0x10,
+    0x94, 0x09, 0xae, 0x51, 0x44, 0x1f, 0xff, 0xa0, 0xaf, 0x13, 0xae, 0x52, 0x84, 0x41, 0xa6, 0x59,
+    0x58, 0x10, 0x80, 0x03, 0xae, 0x59, 0x46, 0xf0, 0x01, 0x12, 0x10, 0x27, 0x8b, 0xa0, 0xd5, 0x0e,
+    0xa6, 0x51, 0x84, 0x80, 0x58, 0x10, 0x80, 0x20, 0xae, 0x51, 0x44, 0x1f, 0xff, 0xa0, 0xaf, 0x13,
+    0xae, 0x52, 0xa6, 0x59, 0x58, 0x10, 0x80, 0x03, 0xae, 0x59, 0x84, 0xa4, 0x4c, 0x92, 0xc0, 0x09,
+    0x00, 0x10, 0x00, 0x1d, 0x9e, 0x49, 0x10, 0x10, 0x00, 0x1d, 0xd5, 0x02, 0x84, 0x00, 0xec, 0x1c,
+    0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xa8, 0xbc, 0x46, 0x80, 0x01, 0x1b,
+    0x58, 0x84, 0x0b, 0x90, 0x54, 0xa0, 0x00, 0xff, 0x84, 0xe0, 0x46, 0x90, 0x00, 0x81, 0x58, 0x94,
+    0x83, 0x8c, 0xb4, 0x08, 0xc0, 0x22, 0x50, 0x04, 0x7f, 0xf8, 0x80, 0x2a, 0x4b, 0xe0, 0x24, 0x01,
+    0x80, 0xc0, 0xc0, 0x1b, 0x00, 0x00, 0x00, 0x1a, 0x84, 0x20, 0x10, 0x13, 0x00, 0x1c, 0x94, 0x04,
+    0x46, 0x10, 0x01, 0x1a, 0x58, 0x10, 0x82, 0x18, 0x98, 0x01, 0x80, 0x26, 0x46, 0xf0, 0x00, 0x81,
+    0x58, 0xf7, 0x84, 0x88, 0xdd, 0x2f, 0x80, 0x06, 0x84, 0x24, 0x84, 0x40, 0x46, 0xf0, 0x00, 0x85,
+    0x58, 0xf7, 0x83, 0xd8, 0xdd, 0x2f, 0xd5, 0x08, 0x9d, 0xf9, 0x97, 0xf8, 0x44, 0x50, 0x00, 0x10,
+    0x50, 0x84, 0x00, 0x50, 0xdf, 0xd7, 0x80, 0x07, 0x3a, 0x6f, 0xa8, 0x84, 0xdd, 0x9e, 0x92, 0x00,
+    0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xdc, 0x46, 0x00, 0x04, 0x11, 0x58, 0x00, 0x07, 0x98, 0x50, 0x10,
+    0x7f, 0x80, 0x84, 0x40, 0xf0, 0x84, 0xf1, 0x85, 0xf2, 0x82, 0x46, 0x50, 0x01, 0x19, 0x58, 0x52,
+    0x80, 0xac, 0x51, 0xcf, 0x80, 0x1c, 0xf3, 0x04, 0xf4, 0x05, 0xb5, 0x43, 0xb4, 0x24, 0x96, 0x8c,
+    0x4e, 0x22, 0x01, 0x60, 0x40, 0x20, 0xa0, 0x09, 0x96, 0x90, 0xf2, 0x83, 0x9e, 0x91, 0x97, 0xd0,
+    0xe6, 0xf0, 0x4e, 0xf2, 0x01, 0x46, 0x40, 0x35, 0x20, 0x09, 0x54, 0x81, 0x80, 0xff, 0x50, 0x64,
+    0x00, 0x24, 0x97, 0xb0, 0x42, 0x90, 0x94, 0x0b, 0x5c, 0xf3, 0x00, 0x20, 0xe8, 0x1d, 0x50, 0x34,
+    0x7f, 0x24, 0x46, 0x60, 0x01, 0x12, 0x84, 0x81, 0x04, 0x83, 0x02, 0xf1, 0x40, 0x42, 0x0c, 0x0c,
+    0x40, 0x32, 0x10, 0x05, 0x40, 0x31, 0xa0, 0x02, 0x84, 0x01, 0x14, 0x33, 0x02, 0xf1, 0x4c, 0x90,
+    0x40, 0x35, 0x84, 0x60, 0x38, 0x32, 0x9d, 0x09, 0x84, 0x62, 0x80, 0x3c, 0x84, 0x42, 0x84, 0x06,
+    0x10, 0x3e, 0x00, 0x00, 0xd5, 0x1e, 0x50, 0x64, 0x00, 0x6a, 0x97, 0xb0, 0xe6, 0xd0, 0xe8, 0x2c,
+    0x84, 0x81, 0x4c, 0x92, 0x40, 0x23, 0x46, 0x30, 0x01, 0x19, 0x58, 0x31, 0x80, 0xdc, 0x38, 0x01,
+    0x9c, 0x00, 0xf5, 0x81, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x8e, 0x94, 0xdd, 0x2f, 0xf5, 0x01,
+    0x84, 0x60, 0x38, 0x32, 0x9d, 0x09, 0x10, 0x9e, 0x00, 0x00, 0x80, 0x3c, 0x84, 0x42, 0x84, 0x06,
+    0xf3, 0x03, 0x10, 0x3e, 0x00, 0x01, 0xf5, 0x81, 0x46, 0xf0, 0x00, 0x84, 0x58, 0xf7, 0x87, 0x14,
+    0xdd, 0x2f, 0xf5, 0x01, 0x48, 0x00, 0x00, 0xf5, 0x38, 0x32, 0x9d, 0x01, 0x9c, 0xd9, 0x38, 0x32,
+    0x9d, 0x09, 0x48, 0x00, 0x00, 0xee, 0x50, 0x24, 0x00, 0x38, 0x96, 0x90, 0xe6, 0x50, 0xe8, 0x46,
+    0x46, 0x40, 0x01, 0x12, 0x58, 0x42, 0x01, 0x24, 0x40, 0x34, 0x10, 0x00, 0x84, 0x21, 0x00, 0x01,
+    0xff, 0x38, 0x4c, 0x90, 0xc0, 0x0a, 0x84, 0x20, 0x54, 0x45, 0x00, 0xff, 0x38, 0x12, 0x9d, 0x09,
+    0xc4, 0x0a, 0x48, 0x00, 0x00, 0xdf, 0x38, 0x32, 0x9d, 0x01, 0x9c, 0xd9, 0x38, 0x32, 0x9d, 0x09,
+    0x48, 0x00, 0x00, 0xd8, 0xe6, 0x07, 0xe8, 0x22, 0x46, 0x30, 0x01, 0x19, 0x58, 0x31, 0x81, 0x30,
+    0x38, 0x41, 0x9c, 0x00, 0xe6, 0x8b, 0xe9, 0x0c, 0x9d, 0x01, 0x46, 0x20, 0x01, 0x12, 0x58, 0x21,
+    0x01, 0x14, 0x38, 0x11, 0x9c, 0x08, 0x38, 0x41, 0x1c, 0x08, 0x48, 0x00, 0x00, 0xba, 0x9d, 0x21,
+    0x38, 0x41, 0x9c, 0x08, 0x46, 0x30, 0x01, 0x12, 0x58, 0x31, 0x81, 0x14, 0x38, 0x01, 0x9c, 0x08,
+    0x48, 0x00, 0x00, 0xaf, 0x9e, 0xc1, 0x84, 0xc0, 0xd5, 0x7e, 0x46, 0x10, 0x01, 0x12, 0x58, 0x10,
+    0x81, 0x14, 0x38, 0x00, 0x9c, 0x08, 0x48, 0x00, 0x00, 0xa4, 0x50, 0x64, 0x7f, 0xff, 0x96, 0xb2,
+    0x4e, 0x25, 0x00, 0x9f, 0x46, 0x30, 0x01, 0x19, 0x58, 0x31, 0x81, 0x20, 0x38, 0x41, 0x9c, 0x00,
+    0x46, 0x30, 0x01, 0x19, 0x58, 0x31, 0x80, 0xcc, 0x38, 0x41, 0x9c, 0x08, 0x80, 0x08, 0x80, 0x29,
+    0x80, 0x47, 0xf5, 0x81, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x8a, 0x50, 0xdd, 0x2f, 0x84, 0x81,
+    0xf5, 0x01, 0x4c, 0x92, 0x40, 0x22, 0x84, 0x40, 0x38, 0x22, 0x9d, 0x09, 0x80, 0x08, 0xf5, 0x81,
+    0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x8e, 0x94, 0xdd, 0x2f, 0x84, 0x26, 0x42, 0x13, 0x04, 0x24,
+    0x46, 0x20, 0x01, 0x1a, 0x58, 0x21, 0x02, 0x48, 0x99, 0x8a, 0xa4, 0xb2, 0x54, 0x05, 0x00, 0xff,
+    0x80, 0x27, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x83, 0x20, 0xdd, 0x2f, 0x54, 0x45, 0x00, 0xff,
+    0xf5, 0x01, 0xc4, 0x73, 0xd5, 0x1d, 0x38, 0x22, 0x9d, 0x01, 0x80, 0x08, 0x9c, 0x91, 0x38, 0x22,
+    0x9d, 0x09, 0x80, 0x27, 0xf5, 0x81, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x82, 0xc4, 0xdd, 0x2f,
+    0x46, 0x40, 0x01, 0x19, 0x58, 0x42, 0x01, 0x20, 0x38, 0x32, 0x1c, 0x00, 0xf5, 0x01, 0xc3, 0x08,
+    0x9f, 0x19, 0x46, 0x00, 0x01, 0x19, 0x58, 0x00, 0x00, 0xcc, 0x38, 0x40, 0x1c, 0x08, 0x50, 0x64,
+    0x7f, 0xff, 0x84, 0x86, 0x42, 0x43, 0x10, 0x24, 0x46, 0x10, 0x01, 0x1a, 0x58, 0x10, 0x82, 0x48,
+    0x99, 0x21, 0xa6, 0xe1, 0xcb, 0x1d, 0xd5, 0x2b, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42, 0x01, 0x30,
+    0x38, 0x02, 0x1c, 0x00, 0xe6, 0x0b, 0xe9, 0x06, 0x84, 0xc0, 0x9c, 0xd9, 0x38, 0x62, 0x1c, 0x08,
+    0xd5, 0x29, 0x9d, 0x81, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42, 0x01, 0x30, 0x38, 0x62, 0x1c, 0x08,
+    0x46, 0x40, 0x01, 0x12, 0x58, 0x42, 0x01, 0x14, 0x38, 0x32, 0x1c, 0x08, 0xd5, 0x21, 0x9e, 0xd9,
+    0x84, 0xc0, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42, 0x01, 0x30, 0x46, 0x00, 0x01, 0x12, 0x58, 0x00,
+    0x01, 0x14, 0x38, 0x62, 0x1c, 0x08, 0x38, 0x30, 0x1c, 0x08, 0xd5, 0x12, 0x50, 0x34, 0x7f, 0xff,
+    0x84, 0x86, 0x42, 0x31, 0x90, 0x24, 0x46, 0x10, 0x01, 0x1a, 0x58, 0x10, 0x82, 0x48, 0x98, 0xd9,
+    0xa6, 0xd9, 0x46, 0x20, 0x01, 0x12, 0x58, 0x21, 0x01, 0x14, 0x38, 0x31, 0x1c, 0x08, 0xf3, 0x02,
+    0x44, 0x40, 0x00, 0x20, 0x9c, 0x19, 0x96, 0x00, 0xf0, 0x82, 0x4c, 0x02, 0x7e, 0xa6, 0xd5, 0x09,
+    0x4e, 0x03, 0xff, 0x4a, 0x48, 0xff, 0xff, 0x4b, 0xa6, 0xf1, 0xe6, 0x67, 0xe9, 0xb6, 0xd5, 0xdf,
+    0xec, 0x24, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa0, 0xbc, 0x80, 0xe0, 0x44, 0x00,
+    0x00, 0x10, 0x81, 0x01, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x82, 0x2c, 0xdd, 0x2f, 0x80, 0xc0,
+    0xc0, 0x31, 0xa0, 0x82, 0x44, 0x00, 0x00, 0x10, 0x12, 0x03, 0x00, 0x0c, 0x14, 0x81, 0x00, 0x01,
+    0xb6, 0xe2, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x17, 0x8b, 0x96, 0x46, 0x25, 0x8e, 0x08, 0x54, 0x10,
+    0x80, 0x03, 0x40, 0x10, 0xe4, 0x08, 0x58, 0x21, 0x00, 0x10, 0x40, 0x10, 0x88, 0x04, 0xa8, 0x73,
+    0x46, 0x00, 0x01, 0x1b, 0x58, 0x00, 0x05, 0x80, 0x80, 0x26, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7,
+    0x84, 0x90, 0xdd, 0x2f, 0xc8, 0x0f, 0x00, 0x03, 0x00, 0x1a, 0x46, 0x20, 0x01, 0x1a, 0x58, 0x21,
+    0x02, 0x18, 0x94, 0x04, 0x80, 0x26, 0x98, 0x02, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x84, 0x88,
+    0xdd, 0x2f, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e, 0x3b, 0xff, 0xfc, 0xbc, 0xef, 0xfc, 0x96, 0x48,
+    0x96, 0x00, 0xc1, 0x15, 0xe6, 0x08, 0xe8, 0x06, 0x46, 0x10, 0x04, 0x1c, 0x58, 0x10, 0x80, 0x4a,
+    0xd5, 0x06, 0x46, 0x10, 0x04, 0x1c, 0x58, 0x10, 0x80, 0x4b, 0x8e, 0x08, 0xa6, 0x88, 0x84, 0x61,
+    0x40, 0x01, 0x80, 0x0c, 0x40, 0x00, 0x08, 0x04, 0xae, 0x08, 0xd5, 0x27, 0xe6, 0x08, 0xe8, 0x09,
+    0x46, 0x10, 0x04, 0x1c, 0x84, 0x41, 0x58, 0x10, 0x80, 0x4a, 0x40, 0x21, 0x00, 0x0c, 0xd5, 0x0a,
+    0x46, 0x10, 0x04, 0x1c, 0x50, 0x20, 0x7f, 0xf8, 0x84, 0x61, 0x58, 0x10, 0x80, 0x4b, 0x40, 0x21,
+    0x88, 0x0c, 0xa6, 0xc8, 0x40, 0x21, 0x08, 0x05, 0x40, 0x21, 0x0c, 0x02, 0xae, 0x88, 0x46, 0x10,
+    0x01, 0x19, 0x58, 0x10, 0x82, 0xec, 0x38, 0x10, 0x80, 0x00, 0x84, 0xa1, 0xd9, 0x06, 0x46, 0xf0,
+    0x00, 0x82, 0x58, 0xf7, 0x82, 0x04, 0xdd, 0x2f, 0xec, 0x04, 0x3b, 0xff, 0xfc, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xdc, 0x96, 0x90, 0x96, 0x48, 0xf2, 0x81, 0xf1, 0x82, 0x46, 0x30,
+    0x04, 0x11, 0x04, 0x31, 0x80, 0x47, 0x54, 0xa0, 0x00, 0xff, 0xf3, 0x83, 0x46, 0xf0, 0x00, 0x81,
+    0x58, 0xf7, 0x8f, 0x0c, 0xdd, 0x2f, 0x05, 0xcf, 0x80, 0x01, 0xf0, 0x02, 0x54, 0x1e, 0x00, 0x7f,
+    0x94, 0x05, 0x50, 0x25, 0x00, 0x01, 0x50, 0x35, 0x7f, 0x96, 0x84, 0xe0, 0xf0, 0x84, 0xf1, 0x85,
+    0xf2, 0x86, 0xf3, 0x87, 0x15, 0xcf, 0x80, 0x00, 0x83, 0x87, 0xf2, 0x03, 0x80, 0x0a, 0x54, 0x1e,
+    0x00, 0xff, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x8c, 0x44, 0xdd, 0x2f, 0x81, 0x00, 0x4e, 0x02,
+    0x01, 0x36, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x37, 0x8b, 0x91, 0x04, 0x74, 0x00, 0x02, 0xcb, 0x46,
+    0x00, 0x34, 0x00, 0x10, 0xcb, 0x43, 0xa7, 0x3b, 0xf1, 0x04, 0x54, 0x42, 0x00, 0x1f, 0x40, 0x42,
+    0x04, 0x04, 0xaf, 0x3b, 0xa6, 0xfa, 0x00, 0x44, 0x00, 0x1c, 0x54, 0x42, 0x00, 0x02, 0xc4, 0x0e,
+    0x46, 0x40, 0x01, 0x19, 0x58, 0x42, 0x00, 0xcc, 0x38, 0x42, 0x28, 0x00, 0x92, 0x67, 0x94, 0xdf,
+    0x54, 0x42, 0x00, 0x7f, 0x40, 0x31, 0x90, 0x04, 0xd5, 0x06, 0xf1, 0x05, 0x92, 0x67, 0x94, 0xdf,
+    0x40, 0x31, 0x84, 0x04, 0xae, 0xfa, 0xf2, 0x01, 0xca, 0x11, 0x00, 0x34, 0x00, 0x12, 0xe6, 0x62,
+    0xe9, 0x0d, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x47, 0x8b, 0x92, 0xa6, 0xfa, 0x54, 0x42, 0x00, 0x7f,
+    0x92, 0x67, 0x94, 0xdf, 0x40, 0x31, 0x90, 0x04, 0xae, 0xfa, 0xf1, 0x01, 0x80, 0x08, 0x46, 0xf0,
+    0x00, 0x81, 0x58, 0xf7, 0x8b, 0x64, 0xdd, 0x2f, 0xb6, 0x1f, 0xa6, 0xfa, 0x54, 0x40, 0x00, 0x7f,
+    0x92, 0x67, 0x94, 0xdf, 0x40, 0x31, 0x90, 0x04, 0xae, 0xfa, 0x00, 0x44, 0x00, 0x1b, 0x84, 0xc6,
+    0x9f, 0x21, 0x42, 0x52, 0x18, 0x24, 0xa7, 0x3a, 0x46, 0x20, 0x01, 0x1a, 0x58, 0x21, 0x02, 0x48,
+    0x54, 0x42, 0x00, 0x7f, 0x99, 0x6a, 0xaf, 0x29, 0x00, 0x44, 0x00, 0x1b, 0x4f, 0xc3, 0x00, 0x09,
+    0x9f, 0x21, 0x42, 0x32, 0x18, 0x24, 0x84, 0x81, 0x98, 0xda, 0xaf, 0x1a, 0xd5, 0x09, 0x80, 0x64,
+    0x9e, 0xd9, 0x42, 0x31, 0x98, 0x24, 0x80, 0x02, 0x99, 0x18, 0x84, 0x60, 0xae, 0xe2, 0xf1, 0x06,
+    0xae, 0x7d, 0x00, 0x34, 0x00, 0x10, 0xcb, 0x06, 0x00, 0x24, 0x00, 0x1b, 0x10, 0x23, 0x80, 0x13,
+    0xd5, 0x4b, 0x84, 0xa1, 0xdb, 0x3c, 0x84, 0x60, 0x10, 0x34, 0x00, 0x1d, 0x10, 0x33, 0x80, 0x13,
+    0x46, 0xf0, 0x01, 0x12, 0x04, 0x97, 0x82, 0xf1, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x57, 0x82, 0xf2,
+    0x84, 0xc0, 0x84, 0x21, 0x40, 0x00, 0x94, 0x0c, 0x40, 0x00, 0x24, 0x02, 0x98, 0x69, 0x9d, 0xb1,
+    0xc8, 0x1b, 0x50, 0x32, 0xff, 0xdc, 0x46, 0x60, 0x01, 0x12, 0x58, 0x63, 0x0b, 0xc8, 0xb6, 0xa6,
+    0x10, 0x33, 0x80, 0x13, 0x46, 0x70, 0x01, 0x12, 0xb4, 0xa6, 0x04, 0x93, 0x82, 0xf1, 0x84, 0x41,
+    0x9d, 0x29, 0x40, 0x31, 0x14, 0x0c, 0x40, 0x31, 0xa4, 0x04, 0x54, 0x42, 0x00, 0x1f, 0x14, 0x33,
+    0x82, 0xf1, 0xb6, 0x86, 0xd5, 0x19, 0x44, 0x30, 0x00, 0x20, 0x54, 0x50, 0x80, 0x1f, 0x4c, 0x61,
+    0xff, 0xda, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x57, 0x82, 0xf2, 0xd5, 0x0e, 0x84, 0xa2, 0xdb, 0x0c,
+    0xf1, 0x07, 0x46, 0x30, 0x01, 0x19, 0x58, 0x31, 0x80, 0xdc, 0x10, 0x13, 0x80, 0x13, 0x00, 0x24,
+    0x00, 0x1b, 0x38, 0x21, 0xa8, 0x08, 0x00, 0x34, 0x00, 0x1c, 0x42, 0x31, 0x80, 0x09, 0x10, 0x34,
+    0x00, 0x1c, 0x04, 0x54, 0x00, 0x02, 0x46, 0x60, 0x01, 0x19, 0x58, 0x63, 0x00, 0xec, 0x38, 0x43,
+    0x29, 0x00, 0x50, 0x52, 0x80, 0x24, 0xa6, 0xee, 0x54, 0x42, 0x00, 0x0f, 0x95, 0x24, 0x54, 0x31,
+    0x80, 0x0f, 0x40, 0x31, 0x90, 0x04, 0xae, 0xee, 0x44, 0x70, 0x0f, 0xff, 0x38, 0x43, 0x29, 0x01,
+    0x46, 0x00, 0x01, 0x1b, 0x58, 0x00, 0x05, 0x80, 0x92, 0x84, 0xaf, 0x2f, 0x80, 0x28, 0x38, 0x43,
+    0x29, 0x01, 0x9d, 0x21, 0x96, 0xe1, 0x40, 0x41, 0x9c, 0x77, 0x38, 0x33, 0x29, 0x09, 0x46, 0xf0,
+    0x00, 0x80, 0x58, 0xf7, 0x85, 0x58, 0xdd, 0x2f, 0xc0, 0x04, 0x51, 0xce, 0x00, 0x01, 0xd5, 0x0f,
+    0x00, 0x34, 0x00, 0x1a, 0x46, 0x20, 0x01, 0x1a, 0x58, 0x21, 0x02, 0x18, 0x94, 0xdc, 0x80, 0x28,
+    0x98, 0x1a, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x84, 0x88, 0xdd, 0x2f, 0x84, 0x40, 0x80, 0x08,
+    0x84, 0x22, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x83, 0xd8, 0xdd, 0x2f, 0xb4, 0x1f, 0x80, 0x2a,
+    0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x81, 0xec, 0xdd, 0x2f, 0x00, 0x14, 0x00, 0x12, 0x02, 0x24,
+    0x00, 0x0c, 0x80, 0x0a, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x84, 0xd4, 0xdd, 0x2f, 0x00, 0x34,
+    0x00, 0x1b, 0x84, 0x86, 0x9e, 0xd9, 0x42, 0x31, 0x90, 0x24, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00,
+    0x02, 0x48, 0x02, 0x84, 0x00, 0x0c, 0x98, 0xd8, 0x12, 0x81, 0x80, 0x02, 0x5c, 0xfe, 0x00, 0x20,
+    0x4e, 0xf3, 0xfe, 0xc5, 0x05, 0xcf, 0x80, 0x00, 0xd5, 0x05, 0x80, 0xfc, 0x05, 0xcf, 0x80, 0x00,
+    0xc7, 0x15, 0x44, 0x70, 0x00, 0x50, 0x42, 0x75, 0x1c, 0x24, 0x84, 0x60, 0x46, 0x10, 0x01, 0x1b,
+    0x58, 0x10, 0x8b, 0x48, 0x99, 0xf9, 0x46, 0x60, 0x01, 0x19, 0x58, 0x63, 0x01, 0x0c, 0x46, 0x90,
+    0x00, 0x81, 0x58, 0x94, 0x84, 0x08, 0x81, 0x03, 0xd5, 0x34, 0x46, 0x20, 0x01, 0x12, 0x58, 0x21,
+    0x01, 0x14, 0x39, 0xc1, 0x28, 0x00, 0x46, 0x40, 0x01, 0x12, 0x58, 0x42, 0x01, 0x24, 0xf1, 0x02,
+    0x39, 0xc2, 0x28, 0x08, 0x80, 0x5c, 0x80, 0x0a, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x89, 0x10,
+    0xdd, 0x2f, 0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x82, 0x70, 0x00, 0x50, 0x80, 0x1c, 0x44, 0x60,
+    0x00, 0x2e, 0x58, 0x52, 0x80, 0x01, 0x12, 0x60, 0x80, 0x0c, 0x10, 0x50, 0x80, 0x1c, 0x46, 0x00,
+    0x01, 0x1b, 0x58, 0x00, 0x05, 0x80, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x85, 0x58, 0xdd, 0x2f,
+    0x80, 0x0a, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x80, 0xcc, 0xdd, 0x2f, 0x80, 0x67, 0xd5, 0x10,
+    0xb4, 0x46, 0x80, 0x07, 0x80, 0x22, 0xc2, 0x04, 0x4b, 0xe0, 0x24, 0x01, 0x84, 0x61, 0x1c, 0x83,
+    0x00, 0x01, 0x46, 0x50, 0x01, 0x19, 0x58, 0x52, 0x81, 0x20, 0x8c, 0xf0, 0xde, 0xf2, 0x46, 0x40,
+    0x01, 0x19, 0x58, 0x42, 0x01, 0x20, 0x39, 0xc2, 0x28, 0x08, 0xcb, 0x08, 0x80, 0x0a, 0x80, 0x23,
+    0x46, 0xf0, 0x00, 0x82, 0x58, 0xf7, 0x82, 0x84, 0xdd, 0x2f, 0x46, 0x00, 0x01, 0x1b, 0x58, 0x00,
+    0x05, 0x80, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x87, 0x28, 0xdd, 0x2f, 0xec, 0x24, 0x3a, 0x6f,
+    0xaa, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xfc, 0x81, 0x20, 0x80, 0x02, 0x80, 0xe2,
+    0x83, 0x81, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x82, 0x2c, 0xdd, 0x2f, 0x50, 0x60, 0x00, 0x0c,
+    0xc8, 0x0b, 0x80, 0x47, 0x44, 0x10, 0x03, 0x73, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x81, 0x60,
+    0xdd, 0x2f, 0x48, 0x00, 0x01, 0x6b, 0x40, 0x84, 0xc0, 0x09, 0x54, 0x84, 0x07, 0xf0, 0x46, 0xa0,
+    0x00, 0x5a, 0x58, 0xa5, 0x03, 0x84, 0x4e, 0x82, 0x00, 0x11, 0xb9, 0x02, 0xa0, 0x02, 0x80, 0x47,
+    0x4b, 0xe0, 0x28, 0x01, 0xb7, 0x26, 0xad, 0xf6, 0x50, 0x13, 0x7f, 0xf4, 0x46, 0x00, 0x01, 0x1b,
+    0x58, 0x00, 0x0b, 0x38, 0x48, 0x00, 0x01, 0x4d, 0xb9, 0x02, 0x84, 0x48, 0x8c, 0x10, 0x4b, 0xe0,
+    0x28, 0x01, 0xb9, 0x02, 0x8e, 0xe8, 0x04, 0x03, 0x7f, 0xff, 0x80, 0x47, 0x8c, 0x28, 0x4b, 0xe0,
+    0x28, 0x01, 0xa6, 0x36, 0xb7, 0x26, 0xad, 0xf6, 0x5c, 0x00, 0x00, 0x04, 0x46, 0x70, 0x00, 0x04,
+    0x58, 0x73, 0x81, 0x3c, 0x80, 0x28, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0x8c, 0x44, 0x30,
+    0x03, 0x8c, 0x4b, 0xe0, 0x1c, 0x01, 0xa6, 0x37, 0x80, 0x28, 0x5c, 0x00, 0x00, 0x10, 0x46, 0x20,
+    0x00, 0x8e, 0x58, 0x21, 0x0d, 0x8c, 0x44, 0x30, 0x03, 0x8d, 0x4b, 0xe0, 0x1c, 0x01, 0x00, 0x93,
+    0x00, 0x06, 0xe7, 0x24, 0xe8, 0x04, 0xa7, 0xf7, 0xe6, 0xf0, 0xe9, 0x25, 0x00, 0x03, 0x00, 0x0e,
+    0x46, 0x20, 0x01, 0x1a, 0x58, 0x21, 0x02, 0x18, 0x94, 0x04, 0x98, 0x02, 0x50, 0x13, 0x7f, 0xf4,
+    0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x84, 0x88, 0xdd, 0x2f, 0xa6, 0xb6, 0x46, 0x30, 0x00, 0x85,
+    0x58, 0x31, 0x81, 0x60, 0xe6, 0x44, 0xe9, 0x06, 0x44, 0x00, 0x01, 0x01, 0x44, 0x10, 0x03, 0x94,
+    0xd5, 0x06, 0xa6, 0xb7, 0x44, 0x00, 0x01, 0x00, 0x44, 0x10, 0x03, 0x96, 0x4b, 0xe0, 0x0c, 0x01,
+    0x48, 0x00, 0x00, 0xfc, 0x80, 0x07, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x8a, 0x30, 0xdd, 0x2f,
+    0x84, 0xa1, 0x4c, 0x02, 0xc0, 0xd0, 0x84, 0x25, 0x80, 0x49, 0x42, 0x23, 0x84, 0x73, 0x50, 0x11,
+    0x00, 0x5d, 0x94, 0x4c, 0x46, 0x20, 0x01, 0x1b, 0x58, 0x21, 0x05, 0x80, 0x98, 0x4a, 0xb4, 0x21,
+    0xe6, 0x31, 0x4e, 0xf2, 0x00, 0xc7, 0x46, 0x70, 0x01, 0x12, 0x58, 0x73, 0x8b, 0x74, 0xb4, 0x87,
+    0x46, 0x10, 0x04, 0x11, 0x9c, 0xa1, 0x5c, 0x51, 0x00, 0x81, 0x40, 0x31, 0x14, 0x1b, 0x40, 0x30,
+    0x14, 0x1a, 0x10, 0x43, 0x00, 0x0f, 0xb6, 0x67, 0xa6, 0xf6, 0x46, 0x20, 0x01, 0x10, 0x58, 0x21,
+    0x08, 0x00, 0x38, 0x31, 0x0d, 0x01, 0x04, 0x20, 0x80, 0x47, 0x80, 0x20, 0x98, 0x1a, 0xa8, 0x32,
+    0x80, 0x48, 0x50, 0x03, 0x7f, 0xf4, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x83, 0xd8, 0xdd, 0x2f,
+    0xb4, 0x27, 0x84, 0x06, 0x42, 0x00, 0x80, 0x24, 0xa6, 0xb6, 0x46, 0x10, 0x01, 0x1a, 0x58, 0x10,
+    0x82, 0x48, 0x98, 0x01, 0x10, 0x20, 0x7f, 0xfa, 0x84, 0xa2, 0xa6, 0x34, 0xd8, 0x06, 0x46, 0xf0,
+    0x01, 0x12, 0x00, 0x07, 0x8b, 0x93, 0xd5, 0x08, 0xa6, 0x36, 0x46, 0x10, 0x01, 0x12, 0x58, 0x10,
+    0x81, 0x10, 0x38, 0x00, 0x80, 0x00, 0x10, 0x03, 0x00, 0x11, 0xa6, 0x36, 0x84, 0xa1, 0xd8, 0x60,
+    0xa6, 0x37, 0x44, 0x10, 0x00, 0x50, 0x42, 0x10, 0x04, 0x24, 0x46, 0x20, 0x01, 0x1b, 0x58, 0x21,
+    0x05, 0x80, 0x98, 0x4a, 0x04, 0x10, 0x81, 0x78, 0xc1, 0x1c, 0x84, 0x25, 0x42, 0x00, 0x04, 0x24,
+    0x50, 0x11, 0x05, 0xd8, 0x94, 0x04, 0x98, 0x01, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x82, 0xb0,
+    0xdd, 0x2f, 0x80, 0x20, 0xc0, 0x0e, 0x00, 0x00, 0x00, 0x1a, 0x46, 0x20, 0x01, 0x1a, 0x58, 0x21,
+    0x02, 0x18, 0x94, 0x04, 0x98, 0x02, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x84, 0x88, 0xdd, 0x2f,
+    0xa6, 0x77, 0x44, 0x00, 0x00, 0x50, 0x42, 0x00, 0x80, 0x24, 0x46, 0x20, 0x01, 0x1b, 0x58, 0x21,
+    0x05, 0x80, 0x98, 0x42, 0x04, 0x10, 0x81, 0x84, 0xc1, 0x2b, 0x50, 0x11, 0x06, 0x08, 0x98, 0x01,
+    0x84, 0x21, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x83, 0x10, 0xdd, 0x2f, 0x80, 0x20, 0xc0, 0x20,
+    0x00, 0x00, 0x00, 0x1a, 0x84, 0x40, 0x10, 0x20, 0x80, 0x1c, 0x94, 0x04, 0x46, 0x20, 0x01, 0x1a,
+    0x58, 0x21, 0x02, 0x18, 0x98, 0x02, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x84, 0x88, 0xdd, 0x2f,
+    0xa6, 0xb7, 0xa6, 0x36, 0x40, 0x21, 0x40, 0x08, 0x40, 0x21, 0x00, 0x04, 0x44, 0x10, 0x03, 0xbf,
+    0x44, 0x00, 0x02, 0x01, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x81, 0x60, 0xdd, 0x2f, 0xa6, 0xb7,
+    0xa6, 0x36, 0x84, 0x25, 0x42, 0x01, 0x04, 0x73, 0x46, 0x20, 0x01, 0x1b, 0x58, 0x21, 0x0b, 0x48,
+    0x94, 0x04, 0x50, 0x13, 0x7f, 0xf4, 0x98, 0x02, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x84, 0x88,
+    0xdd, 0x2f, 0xa6, 0x37, 0x84, 0x21, 0x46, 0xf0, 0x00, 0x82, 0x58, 0xf7, 0x82, 0x84, 0xdd, 0x2f,
+    0xd5, 0x24, 0xc8, 0x07, 0x80, 0x47, 0x44, 0x00, 0x02, 0x00, 0x44, 0x10, 0x03, 0xcd, 0xd5, 0x09,
+    0x40, 0x23, 0xc0, 0x08, 0x40, 0x21, 0x24, 0x04, 0x44, 0x00, 0x02, 0x01, 0x44, 0x10, 0x03, 0xcf,
+    0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x81, 0x60, 0xdd, 0x2f, 0x00, 0x03, 0x00, 0x0e, 0x46, 0x20,
+    0x01, 0x1a, 0x58, 0x21, 0x02, 0x18, 0x94, 0x04, 0x50, 0x13, 0x7f, 0xf4, 0x98, 0x02, 0x46, 0xf0,
+    0x00, 0x81, 0x58, 0xf7, 0x84, 0x88, 0xdd, 0x2f, 0xec, 0x04, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xfc, 0x97, 0x80, 0x96, 0x48, 0xc2, 0x07, 0x46, 0x00, 0x01, 0x12,
+    0x58, 0x00, 0x00, 0xd0, 0x38, 0x20, 0x1a, 0x0a, 0x84, 0x5f, 0x46, 0x00, 0x01, 0x19, 0x58, 0x00,
+    0x01, 0xd0, 0x84, 0xa1, 0x38, 0x20, 0x19, 0x09, 0x46, 0x30, 0x01, 0x19, 0x58, 0x31, 0x81, 0xf0,
+    0x46, 0x20, 0x01, 0x12, 0x58, 0x21, 0x0b, 0x68, 0x46, 0x00, 0x01, 0x19, 0x58, 0x00, 0x02, 0x30,
+    0xd9, 0x21, 0xb4, 0x82, 0x40, 0x10, 0x98, 0x0c, 0x40, 0x10, 0x90, 0x04, 0xb6, 0x22, 0x46, 0x20,
+    0x00, 0x82, 0x58, 0x21, 0x03, 0x01, 0x98, 0x72, 0x94, 0x4b, 0xb4, 0x41, 0x46, 0x40, 0x04, 0x11,
+    0x38, 0x21, 0x9a, 0x0a, 0x94, 0x73, 0x58, 0x42, 0x08, 0x0c, 0x98, 0x4c, 0xb4, 0x21, 0x38, 0x10,
+    0x1a, 0x0a, 0x84, 0x20, 0x00, 0x20, 0x80, 0x13, 0x44, 0x00, 0x02, 0x03, 0x44, 0x10, 0x02, 0x5c,
+    0xd5, 0x4a, 0x84, 0x81, 0xb4, 0x22, 0x40, 0x42, 0x18, 0x0c, 0x40, 0x42, 0x10, 0x05, 0x40, 0x42,
+    0x04, 0x02, 0x44, 0x80, 0x00, 0x50, 0x84, 0x20, 0x42, 0x83, 0x20, 0x24, 0x38, 0x10, 0x1a, 0x0a,
+    0x46, 0x00, 0x01, 0x19, 0x58, 0x00, 0x00, 0xec, 0x38, 0x10, 0x19, 0x09, 0xb6, 0x82, 0x46, 0x00,
+    0x01, 0x1b, 0x58, 0x00, 0x0b, 0x48, 0x38, 0x11, 0x9a, 0x0a, 0x89, 0x00, 0x81, 0x21, 0x47, 0xc0,
+    0x00, 0x81, 0x59, 0xce, 0x02, 0xb0, 0x46, 0xa0, 0x00, 0x81, 0x58, 0xa5, 0x04, 0x88, 0x80, 0x08,
+    0xdd, 0x3c, 0x80, 0xe0, 0x80, 0x20, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x1a, 0x46, 0x20, 0x01, 0x1a,
+    0x58, 0x21, 0x02, 0x18, 0x94, 0x04, 0x98, 0x02, 0x4b, 0xe0, 0x28, 0x01, 0xd5, 0xf1, 0x8d, 0x21,
+    0x54, 0x94, 0x80, 0xff, 0x84, 0xa5, 0x8d, 0x10, 0x4c, 0x92, 0xff, 0xeb, 0x80, 0x06, 0x46, 0xf0,
+    0x00, 0x85, 0x58, 0xf7, 0x85, 0x44, 0xdd, 0x2f, 0x00, 0x23, 0x80, 0x13, 0x44, 0x00, 0x02, 0x02,
+    0x44, 0x10, 0x02, 0x70, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x81, 0x60, 0xdd, 0x2f, 0xec, 0x04,
+    0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xe4, 0x46, 0xf0,
+    0x01, 0x12, 0x04, 0x37, 0x82, 0xda, 0x96, 0x00, 0x96, 0x48, 0x4e, 0x32, 0x00, 0xf1, 0x84, 0xa1,
+    0x46, 0x30, 0x01, 0x19, 0x58, 0x31, 0x81, 0xd0, 0xd9, 0x06, 0x84, 0x20, 0x38, 0x11, 0x81, 0x09,
+    0x48, 0x00, 0x00, 0xe6, 0x46, 0x00, 0x01, 0x19, 0x58, 0x00, 0x00, 0xac, 0x46, 0x10, 0x01, 0x12,
+    0x58, 0x10, 0x80, 0xd0, 0xf3, 0x81, 0xf0, 0x82, 0xf1, 0x83, 0x85, 0x40, 0x50, 0x8f, 0x80, 0x14,
+    0x47, 0xc0, 0x00, 0x01, 0x59, 0xce, 0x0c, 0x58, 0x46, 0x90, 0x01, 0x12, 0x58, 0x94, 0x8b, 0x70,
+    0x46, 0xf0, 0x01, 0x12, 0x04, 0x17, 0x82, 0xda, 0x84, 0x61, 0x40, 0x71, 0xa8, 0x0c, 0x40, 0x13,
+    0x84, 0x02, 0x4e, 0x12, 0x00, 0xaa, 0xf4, 0x01, 0x44, 0x50, 0xff, 0xff, 0xa4, 0x60, 0x4c, 0x12,
+    0x80, 0xa4, 0x80, 0x08, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0xf2, 0x01,
+    0xf0, 0x05, 0xa4, 0x50, 0x9c, 0x49, 0xac, 0x50, 0xdd, 0x3c, 0x46, 0x30, 0x01, 0x19, 0x58, 0x31,
+    0x82, 0xec, 0x40, 0x15, 0x0c, 0x00, 0xf4, 0x01, 0xa7, 0x88, 0xa4, 0x20, 0xce, 0x39, 0xf1, 0x03,
+    0x44, 0x20, 0x0f, 0xa0, 0xb4, 0x81, 0x40, 0x22, 0x08, 0x97, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x47,
+    0x82, 0xd7, 0x42, 0x21, 0x10, 0x24, 0xe2, 0x40, 0xe8, 0x15, 0x80, 0x08, 0x46, 0xf0, 0x00, 0x01,
+    0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0xb4, 0x49, 0x80, 0x0a, 0x40, 0x33, 0x88, 0x04, 0x80, 0x26,
+    0x80, 0x46, 0xb6, 0x69, 0x46, 0xf0, 0x00, 0x82, 0x58, 0xf7, 0x89, 0xcc, 0xdd, 0x2f, 0xf0, 0x05,
+    0xdd, 0x3c, 0xf3, 0x02, 0xa4, 0x58, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x27, 0x82, 0xd9, 0xe2, 0x41,
+    0xe8, 0x08, 0x80, 0x08, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0xd5, 0x41,
+    0x80, 0x08, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0xd5, 0x49, 0x46, 0x40,
+    0x01, 0x12, 0x58, 0x42, 0x01, 0x34, 0x46, 0x30, 0x01, 0x12, 0x58, 0x31, 0x81, 0x44, 0x40, 0x25,
+    0x10, 0x00, 0x40, 0x15, 0x0c, 0x00, 0xa7, 0x08, 0xa6, 0x50, 0x80, 0x40, 0x42, 0x12, 0x04, 0x24,
+    0x44, 0x00, 0x00, 0x19, 0x42, 0x10, 0x80, 0x24, 0xe0, 0x22, 0xe8, 0x15, 0x80, 0x08, 0x46, 0xf0,
+    0x00, 0x01, 0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0xb4, 0x49, 0x84, 0x20, 0x40, 0x33, 0x88, 0x04,
+    0x80, 0x0a, 0x80, 0x41, 0xb6, 0x69, 0x46, 0xf0, 0x00, 0x82, 0x58, 0xf7, 0x89, 0xcc, 0xdd, 0x2f,
+    0xf0, 0x05, 0xdd, 0x3c, 0xf2, 0x02, 0xa4, 0x50, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x27, 0x82, 0xd9,
+    0xe2, 0x41, 0xe8, 0x10, 0x80, 0x08, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f,
+    0xb4, 0x29, 0x44, 0x21, 0x00, 0x00, 0x40, 0x21, 0x28, 0x0c, 0xf0, 0x05, 0x40, 0x11, 0x04, 0x04,
+    0xd5, 0x11, 0x80, 0x08, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0x44, 0x11,
+    0x00, 0x00, 0x40, 0x10, 0xa8, 0x0c, 0xb4, 0x49, 0x40, 0x10, 0x84, 0x05, 0xf0, 0x05, 0x40, 0x10,
+    0x88, 0x02, 0xb6, 0x29, 0xdd, 0x3c, 0xf2, 0x01, 0xf3, 0x02, 0xf4, 0x03, 0x9c, 0x92, 0x9c, 0xda,
+    0x9d, 0x24, 0x8d, 0x41, 0x44, 0x50, 0x00, 0x10, 0xf2, 0x81, 0xf3, 0x82, 0xf4, 0x83, 0x4c, 0xa2,
+    0xff, 0x41, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x17, 0x82, 0xdc, 0x46, 0x00, 0x01, 0x12, 0x04, 0x50,
+    0x02, 0xdb, 0xd1, 0x05, 0x14, 0x10, 0x02, 0xdb, 0x84, 0x01, 0xd5, 0x02, 0x84, 0x00, 0xec, 0x1c,
+    0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xcc, 0x46, 0x80,
+    0x00, 0x5a, 0x58, 0x84, 0x03, 0x84, 0x80, 0xc1, 0x84, 0x44, 0x80, 0x20, 0x46, 0x00, 0x01, 0x19,
+    0x58, 0x00, 0x00, 0xa4, 0xdd, 0x28, 0x80, 0x26, 0x84, 0x42, 0x50, 0x6f, 0x80, 0x1c, 0x46, 0x00,
+    0x01, 0x19, 0x58, 0x00, 0x00, 0xa8, 0xdd, 0x28, 0x46, 0x90, 0x00, 0x5a, 0x58, 0x94, 0x83, 0xc4,
+    0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x87, 0xe0, 0xdd, 0x2f, 0x84, 0x20, 0x44, 0x20, 0x00, 0x14,
+    0x80, 0x06, 0xdd, 0x29, 0x00, 0xa3, 0x00, 0x03, 0xa5, 0x73, 0xa7, 0x34, 0x01, 0xc3, 0x00, 0x02,
+    0x00, 0x33, 0x00, 0x12, 0x54, 0xa5, 0x00, 0x1f, 0x92, 0xae, 0x40, 0x52, 0xb8, 0x08, 0x58, 0xa5,
+    0x00, 0x40, 0x54, 0x42, 0x00, 0x03, 0x58, 0x52, 0x80, 0x1a, 0x92, 0x64, 0x94, 0xdc, 0x41, 0xce,
+    0x1c, 0x09, 0x41, 0xce, 0x1c, 0x08, 0x58, 0x42, 0x00, 0x1c, 0x10, 0xa3, 0x00, 0x03, 0x85, 0x40,
+    0xad, 0x73, 0x50, 0x7f, 0x80, 0x04, 0xaf, 0x34, 0x10, 0x33, 0x00, 0x12, 0x11, 0xc3, 0x00, 0x02,
+    0x10, 0xa3, 0x00, 0x05, 0x84, 0x20, 0x44, 0x20, 0x00, 0x18, 0x80, 0x07, 0xdd, 0x29, 0xa7, 0x38,
+    0xa6, 0xf9, 0x44, 0x0f, 0xff, 0xc8, 0x54, 0x42, 0x00, 0x03, 0x58, 0x31, 0x80, 0x02, 0x40, 0x42,
+    0x00, 0x04, 0x42, 0x31, 0x94, 0x09, 0x84, 0x46, 0x84, 0x20, 0x50, 0x0f, 0x80, 0x08, 0xaf, 0x38,
+    0xae, 0xf9, 0xdd, 0x29, 0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x80, 0xa4, 0x84, 0x46, 0x50, 0x0f,
+    0x80, 0x0e, 0xdd, 0x28, 0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x80, 0xa4, 0x84, 0x46, 0x50, 0x0f,
+    0x80, 0x14, 0xdd, 0x28, 0x84, 0x20, 0x44, 0x20, 0x00, 0x2e, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00,
+    0x05, 0x48, 0xdd, 0x29, 0x80, 0x26, 0x44, 0x20, 0x00, 0x14, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00,
+    0x05, 0x48, 0xdd, 0x28, 0x80, 0x27, 0x44, 0x20, 0x00, 0x18, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00,
+    0x05, 0x5c, 0xdd, 0x28, 0xec, 0x34, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x98, 0x3c,
+    0xa6, 0xc8, 0x84, 0x40, 0xa7, 0x42, 0x9d, 0x11, 0xdb, 0x10, 0xa7, 0x83, 0xa7, 0x49, 0xde, 0x0d,
+    0xa7, 0x84, 0xa7, 0x4a, 0xde, 0x0a, 0xa7, 0x85, 0xa7, 0x4b, 0xde, 0x07, 0xa7, 0x86, 0xa7, 0x4c,
+    0xde, 0x04, 0xa7, 0x87, 0xa7, 0x4d, 0xd6, 0x06, 0x96, 0xa0, 0x84, 0x8a, 0x8c, 0x09, 0x4c, 0x22,
+    0x7f, 0xeb, 0x80, 0x02, 0x3a, 0x6f, 0x98, 0x04, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc,
+    0xef, 0xe4, 0x97, 0xc8, 0x81, 0x20, 0xc7, 0x66, 0x46, 0x20, 0x04, 0x11, 0x46, 0x00, 0x01, 0x19,
+    0x58, 0x00, 0x00, 0xa4, 0x85, 0x40, 0x44, 0x30, 0x00, 0xff, 0x08, 0x10, 0x00, 0x01, 0x04, 0x41,
+    0x00, 0x47, 0x40, 0x11, 0x84, 0x1a, 0x40, 0x42, 0x04, 0x37, 0x89, 0x41, 0x46, 0x50, 0x01, 0x19,
+    0x58, 0x52, 0x80, 0xaa, 0xd8, 0xf3, 0x81, 0x07, 0x84, 0x85, 0x50, 0x6f, 0x80, 0x10, 0x47, 0xc0,
+    0x00, 0x5a, 0x59, 0xce, 0x03, 0x84, 0xd5, 0x11, 0x40, 0x15, 0x1c, 0x77, 0x80, 0x29, 0xf4, 0x82,
+    0x8f, 0x01, 0x54, 0x84, 0x00, 0xff, 0x42, 0x11, 0x90, 0x73, 0xf1, 0x81, 0xdd, 0x3c, 0xf0, 0x01,
+    0x80, 0x26, 0x84, 0x45, 0xdd, 0x3c, 0xf4, 0x02, 0x84, 0x45, 0x80, 0x06, 0xe7, 0x02, 0xe8, 0xed,
+    0x9f, 0xf9, 0x97, 0xf8, 0x85, 0x00, 0x80, 0x62, 0x50, 0x6f, 0x80, 0x10, 0x46, 0xa0, 0x00, 0x5a,
+    0x58, 0xa5, 0x03, 0x84, 0xd5, 0x19, 0x00, 0x5e, 0x00, 0x00, 0xe6, 0xaf, 0xe8, 0x13, 0xf3, 0x81,
+    0x9f, 0xf9, 0x4b, 0xe0, 0x28, 0x01, 0xf1, 0x03, 0x84, 0x45, 0x80, 0x1c, 0x4b, 0xe0, 0x28, 0x01,
+    0xf0, 0x03, 0x80, 0x26, 0x84, 0x45, 0x97, 0xf8, 0x4b, 0xe0, 0x28, 0x01, 0xf3, 0x01, 0xcf, 0x04,
+    0xd5, 0x11, 0x54, 0x82, 0x00, 0xff, 0x80, 0x09, 0x83, 0x89, 0x42, 0x03, 0x8c, 0x73, 0x43, 0xc4,
+    0x0c, 0x73, 0xf0, 0x83, 0x84, 0x45, 0x80, 0x06, 0x50, 0x44, 0x00, 0x01, 0x80, 0x3c, 0xe3, 0x07,
+    0xe9, 0xdb, 0xec, 0x1c, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xa8, 0xbc,
+    0x80, 0xa0, 0x80, 0xc2, 0x81, 0x41, 0x50, 0x10, 0x00, 0x30, 0x80, 0x02, 0x84, 0x46, 0x80, 0xe3,
+    0x81, 0x04, 0x50, 0x92, 0x80, 0x20, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84, 0xdd, 0x2f,
+    0xa6, 0x30, 0x44, 0x50, 0x00, 0x62, 0xd8, 0x0c, 0xa6, 0x31, 0x8e, 0xbd, 0xd8, 0x09, 0xa6, 0x32,
+    0x44, 0x50, 0x00, 0xb0, 0x54, 0x00, 0x00, 0xf0, 0xd8, 0x03, 0x84, 0x00, 0xd5, 0x02, 0x84, 0x01,
+    0xae, 0x38, 0x84, 0x00, 0x10, 0x04, 0x00, 0x00, 0x84, 0xa0, 0x50, 0x04, 0x80, 0x18, 0x44, 0x20,
+    0x00, 0x18, 0xd5, 0x15, 0x5e, 0xf1, 0x81, 0x7e, 0xe8, 0x18, 0xa6, 0x40, 0x44, 0x30, 0x00, 0xdd,
+    0x4c, 0x11, 0xc0, 0x08, 0xa6, 0x78, 0xc9, 0x05, 0x00, 0x10, 0x00, 0x0c, 0x10, 0x14, 0x00, 0x00,
+    0xa6, 0xc1, 0x9c, 0xda, 0x99, 0x6b, 0x98, 0x03, 0x97, 0x68, 0x98, 0x93, 0xa6, 0xc1, 0x9c, 0x5a,
+    0x98, 0x4a, 0x98, 0xeb, 0xe3, 0x41, 0xe8, 0xe7, 0x84, 0x01, 0x3a, 0x6f, 0xa8, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0xaa, 0xbc, 0x51, 0xff, 0xfc, 0x14, 0x50, 0x7f, 0x82, 0xa0, 0xf0, 0x87, 0x46, 0x60,
+    0x00, 0x5a, 0x58, 0x63, 0x03, 0xc4, 0x84, 0x20, 0x44, 0x20, 0x00, 0xa0, 0x50, 0x8f, 0x82, 0x00,
+    0x80, 0x07, 0xdd, 0x26, 0x50, 0x9f, 0x81, 0x60, 0x84, 0x20, 0x44, 0x20, 0x00, 0xa0, 0x80, 0x08,
+    0xdd, 0x26, 0x50, 0xaf, 0x80, 0xc0, 0x84, 0x20, 0x44, 0x20, 0x00, 0xa0, 0x80, 0x09, 0xdd, 0x26,
+    0x51, 0xcf, 0x80, 0x20, 0x84, 0x20, 0x44, 0x20, 0x00, 0xa0, 0x80, 0x0a, 0xdd, 0x26, 0x80, 0x1c,
+    0x84, 0x20, 0x44, 0x20, 0x00, 0xa0, 0xdd, 0x26, 0x84, 0x00, 0xf0, 0x86, 0xf0, 0x83, 0xf0, 0x84,
+    0xf0, 0x85, 0x81, 0x20, 0x44, 0xa0, 0x00, 0x46, 0x87, 0x85, 0x80, 0xc0, 0x80, 0xe0, 0x81, 0x00,
+    0xd5, 0x78, 0xf0, 0x03, 0x44, 0x10, 0x00, 0x23, 0xf3, 0x07, 0x42, 0x20, 0x04, 0x24, 0x42, 0x30,
+    0x28, 0x73, 0xf4, 0x07, 0x9c, 0x91, 0xa6, 0x5a, 0x98, 0x92, 0x98, 0xa2, 0xa6, 0x1c, 0x00, 0x51,
+    0x80, 0x0a, 0xa7, 0x19, 0x01, 0xe1, 0x80, 0x05, 0xa6, 0x96, 0xf1, 0x82, 0xa6, 0xdb, 0xc8, 0x15,
+    0x4f, 0xe3, 0x00, 0x14, 0xe6, 0x65, 0xe8, 0x11, 0xc4, 0x10, 0x50, 0x2f, 0x82, 0xa0, 0x42, 0x24,
+    0xf0, 0x73, 0x8d, 0x21, 0xae, 0xd2, 0xaf, 0x10, 0x11, 0xe1, 0x00, 0x04, 0xae, 0x51, 0x11, 0xe1,
+    0x00, 0x03, 0x54, 0x94, 0x80, 0xff, 0xd5, 0x49, 0xcd, 0x02, 0xc2, 0x13, 0xe6, 0x65, 0xe8, 0x11,
+    0xc4, 0x10, 0x50, 0x2f, 0x82, 0x00, 0x42, 0x24, 0x70, 0x73, 0x8d, 0x01, 0xae, 0xd2, 0xaf, 0x10,
+    0xae, 0x13, 0x11, 0xe1, 0x00, 0x04, 0x54, 0x84, 0x00, 0xff, 0xf3, 0x02, 0xae, 0xd1, 0xd5, 0x35,
+    0xe6, 0x04, 0xe8, 0x12, 0xe6, 0x74, 0xe8, 0x10, 0xc4, 0x30, 0x50, 0x2f, 0x81, 0x60, 0x42, 0x23,
+    0xf0, 0x73, 0x9d, 0xf9, 0xae, 0xd2, 0xaf, 0x10, 0xae, 0x13, 0x11, 0xe1, 0x00, 0x04, 0x97, 0xf8,
+    0xf4, 0x02, 0xaf, 0x11, 0xd5, 0x22, 0xe6, 0x79, 0xe8, 0x10, 0xc4, 0x1f, 0x50, 0x2f, 0x80, 0xc0,
+    0x42, 0x23, 0x70, 0x73, 0x9d, 0xb1, 0xae, 0xd2, 0xaf, 0x10, 0xae, 0x13, 0x11, 0xe1, 0x00, 0x04,
+    0x97, 0xb0, 0xf5, 0x02, 0xaf, 0x51, 0xd5, 0x11, 0xc4, 0x10, 0xf1, 0x06, 0x50, 0x2f, 0x80, 0x20,
+    0x42, 0x20, 0xf0, 0x73, 0x9d, 0x49, 0xae, 0xd2, 0xaf, 0x10, 0xae, 0x13, 0x11, 0xe1, 0x00, 0x04,
+    0x97, 0x68, 0xf3, 0x02, 0xae, 0xd1, 0xf5, 0x86, 0xf4, 0x03, 0x9c, 0x21, 0x96, 0x00, 0xf0, 0x83,
+    0xf5, 0x07, 0xf0, 0x03, 0xa6, 0xa8, 0xe2, 0x02, 0xe9, 0x85, 0xf7, 0x84, 0x84, 0x20, 0x44, 0x20,
+    0x00, 0x32, 0x50, 0x7f, 0x82, 0xa0, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0e, 0x3c, 0xf6, 0x83,
+    0x14, 0x8f, 0x80, 0x05, 0x84, 0xc0, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0xc4, 0xdd, 0x2f,
+    0x80, 0x07, 0x80, 0x29, 0x46, 0xf0, 0x00, 0x82, 0x58, 0xf7, 0x8e, 0x58, 0xdd, 0x2f, 0x46, 0x80,
+    0x00, 0x5a, 0x58, 0x84, 0x03, 0x84, 0xf6, 0x82, 0x81, 0x46, 0xd5, 0x0d, 0x38, 0x33, 0x98, 0x00,
+    0x9d, 0xb5, 0xc3, 0x12, 0x84, 0xaa, 0x4c, 0xa2, 0x80, 0x10, 0x8d, 0x41, 0x4b, 0xe0, 0x20, 0x01,
+    0x54, 0xa5, 0x00, 0xff, 0x46, 0x40, 0x01, 0x1a, 0x58, 0x42, 0x0e, 0x3c, 0x98, 0x34, 0x98, 0x7e,
+    0x84, 0x45, 0xe3, 0x49, 0xe9, 0xec, 0xf1, 0x05, 0x50, 0x0f, 0x82, 0x00, 0x50, 0x6f, 0x83, 0x40,
+    0x50, 0x8f, 0x82, 0x04, 0x14, 0xaf, 0x80, 0x02, 0x46, 0xf0, 0x00, 0x82, 0x58, 0xf7, 0x8e, 0x58,
+    0xdd, 0x2f, 0x44, 0x20, 0x00, 0x32, 0x80, 0x06, 0x84, 0x20, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7,
+    0x83, 0xc4, 0xdd, 0x2f, 0x85, 0x45, 0x80, 0xa8, 0x42, 0x54, 0xa8, 0x73, 0x80, 0xe8, 0x80, 0x88,
+    0x85, 0x20, 0x47, 0xc0, 0x00, 0x5a, 0x59, 0xce, 0x03, 0x84, 0x81, 0x05, 0xd5, 0x0a, 0xa6, 0xf8,
+    0x9d, 0xfd, 0xcb, 0x07, 0xb6, 0x9f, 0x8d, 0x21, 0xdd, 0x3c, 0xb4, 0x9f, 0x54, 0x94, 0x80, 0xff,
+    0x80, 0x06, 0x42, 0x04, 0xa8, 0x73, 0x9e, 0x7c, 0x84, 0x45, 0x4c, 0x74, 0x7f, 0xf2, 0x51, 0xcf,
+    0x83, 0x40, 0x81, 0x04, 0x80, 0xfc, 0x80, 0x9c, 0x84, 0xc0, 0x83, 0x88, 0x80, 0x62, 0x81, 0x07,
+    0x46, 0xa0, 0x00, 0x5a, 0x58, 0xa5, 0x03, 0x84, 0xf7, 0x02, 0xd5, 0x0c, 0xf3, 0x81, 0xb6, 0x9f,
+    0x9d, 0xb1, 0x4b, 0xe0, 0x28, 0x01, 0x9c, 0x39, 0xb4, 0x9f, 0xf3, 0x01, 0x97, 0xc0, 0x97, 0xb0,
+    0x8d, 0x05, 0x42, 0x23, 0x8c, 0x24, 0x46, 0x50, 0x01, 0x1a, 0x58, 0x52, 0x8e, 0x3c, 0x98, 0x15,
+    0x80, 0x28, 0x84, 0x45, 0xe2, 0xc9, 0xe8, 0x03, 0xe6, 0xea, 0xe9, 0xe9, 0x50, 0x6f, 0x83, 0x40,
+    0x44, 0x20, 0x00, 0x32, 0x80, 0x06, 0x84, 0x20, 0x81, 0x1c, 0xf7, 0x82, 0x83, 0x84, 0x46, 0xf0,
+    0x00, 0x5a, 0x58, 0xf7, 0x83, 0xc4, 0xdd, 0x2f, 0xf0, 0x05, 0x84, 0x45, 0x81, 0x48, 0x42, 0xa0,
+    0x08, 0x73, 0x84, 0x60, 0x15, 0xcf, 0x80, 0x05, 0x81, 0x22, 0x83, 0x8a, 0x46, 0x70, 0x00, 0x5a,
+    0x58, 0x73, 0x83, 0x84, 0x81, 0x43, 0xd5, 0x0b, 0x00, 0x44, 0x00, 0x00, 0x8d, 0x05, 0xc4, 0x07,
+    0x4b, 0xe0, 0x1c, 0x01, 0x50, 0x35, 0x00, 0x01, 0x54, 0xa1, 0x80, 0xff, 0x80, 0x06, 0x42, 0x05,
+    0x24, 0x73, 0x50, 0x14, 0x7f, 0xfc, 0x84, 0x45, 0x4c, 0x8e, 0x7f, 0xf0, 0x84, 0x00, 0x50, 0x9f,
+    0x83, 0xe0, 0x80, 0x6a, 0x10, 0x04, 0x80, 0x04, 0xb6, 0x09, 0x84, 0x01, 0x81, 0x40, 0x83, 0x83,
+    0xd5, 0x33, 0xa7, 0x71, 0xa7, 0x39, 0xe2, 0x85, 0xe8, 0x16, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7,
+    0x83, 0x84, 0xdd, 0x2f, 0x80, 0x27, 0x84, 0x45, 0x80, 0x06, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7,
+    0x83, 0x84, 0xdd, 0x2f, 0x80, 0x07, 0x80, 0x29, 0x84, 0x45, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7,
+    0x83, 0x84, 0xdd, 0x2f, 0x8d, 0x01, 0x54, 0x84, 0x00, 0xff, 0x84, 0x45, 0x50, 0x6f, 0x83, 0x40,
+    0x42, 0x64, 0x08, 0x73, 0x50, 0x04, 0x00, 0x01, 0x50, 0x7f, 0x83, 0x40, 0x42, 0x70, 0x08, 0x73,
+    0x80, 0x09, 0x80, 0x26, 0xe1, 0x0a, 0xe9, 0xd6, 0x81, 0x5c, 0x50, 0x05, 0x00, 0x01, 0x05, 0xcf,
+    0x80, 0x07, 0x54, 0xa0, 0x00, 0xff, 0xe3, 0x5c, 0xe9, 0x10, 0x80, 0x7c, 0x05, 0xcf, 0x80, 0x05,
+    0x84, 0xc0, 0x80, 0xfc, 0x80, 0x9c, 0x85, 0x25, 0x46, 0x80, 0x00, 0x5a, 0x58, 0x84, 0x03, 0x84,
+    0x83, 0x83, 0x04, 0xaf, 0x80, 0x02, 0xd5, 0x13, 0x40, 0x3e, 0x28, 0x01, 0x15, 0xcf, 0x80, 0x07,
+    0x85, 0x00, 0x83, 0x8a, 0x81, 0x43, 0xd5, 0xd2, 0xb6, 0x9f, 0x8d, 0x41, 0x4b, 0xe0, 0x20, 0x01,
+    0x9d, 0xb1, 0xb4, 0x9f, 0x54, 0xa5, 0x00, 0xff, 0x97, 0xb0, 0x9d, 0xfd, 0x42, 0x05, 0x24, 0x24,
+    0x46, 0x20, 0x01, 0x1a, 0x58, 0x21, 0x0e, 0x3c, 0x98, 0x02, 0x80, 0x27, 0x84, 0x45, 0xe2, 0xdc,
+    0xe8, 0x03, 0xe7, 0x4a, 0xe9, 0xea, 0xf1, 0x04, 0x50, 0x6f, 0x83, 0x40, 0x50, 0x0f, 0x81, 0x60,
+    0x83, 0x84, 0x14, 0xaf, 0x80, 0x02, 0x46, 0xf0, 0x00, 0x82, 0x58, 0xf7, 0x8e, 0x58, 0xdd, 0x2f,
+    0x80, 0x06, 0x44, 0x20, 0x00, 0x32, 0x84, 0x20, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0xc4,
+    0xdd, 0x2f, 0x50, 0x8f, 0x81, 0x64, 0xf4, 0x04, 0x84, 0x45, 0x80, 0x68, 0x42, 0x32, 0x08, 0x73,
+    0x80, 0xa6, 0xf3, 0x84, 0x80, 0xc2, 0x80, 0xe8, 0x85, 0x20, 0x46, 0xa0, 0x00, 0x5a, 0x58, 0xa5,
+    0x03, 0x84, 0xd5, 0x0b, 0xa6, 0xf8, 0x9d, 0xfd, 0xcb, 0x08, 0xf5, 0x81, 0x8d, 0x21, 0x4b, 0xe0,
+    0x28, 0x01, 0xf5, 0x01, 0x54, 0x94, 0x80, 0xff, 0xf3, 0x04, 0x80, 0x05, 0x42, 0x04, 0x98, 0x73,
+    0x9e, 0x7c, 0x84, 0x45, 0x4c, 0x71, 0xff, 0xf0, 0x80, 0xfc, 0x80, 0x9c, 0x84, 0xc0, 0x83, 0x88,
+    0x80, 0x62, 0x81, 0x07, 0x46, 0xa0, 0x00, 0x5a, 0x58, 0xa5, 0x03, 0x84, 0xf7, 0x02, 0xd5, 0x0c,
+    0xf3, 0x81, 0xb6, 0x9f, 0x9d, 0xb1, 0x4b, 0xe0, 0x28, 0x01, 0x9c, 0x39, 0xb4, 0x9f, 0xf3, 0x01,
+    0x97, 0xc0, 0x97, 0xb0, 0x8d, 0x05, 0x42, 0x03, 0x8c, 0x24, 0x46, 0x50, 0x01, 0x1a, 0x58, 0x52,
+    0x8e, 0x3c, 0x80, 0x28, 0x98, 0x05, 0x84, 0x45, 0xe2, 0xc9, 0xe8, 0x03, 0xe6, 0xea, 0xe9, 0xe9,
+    0x50, 0x6f, 0x83, 0x40, 0x80, 0x06, 0x84, 0x20, 0x44, 0x20, 0x00, 0x32, 0xf7, 0x82, 0x81, 0x1c,
+    0x83, 0x84, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0xc4, 0xdd, 0x2f, 0x84, 0xa0, 0x85, 0x25,
+    0x46, 0x70, 0x00, 0x5a, 0x58, 0x73, 0x83, 0x84, 0x81, 0x45, 0xd5, 0x0e, 0x00, 0x34, 0x00, 0x00,
+    0x8d, 0x05, 0x9e, 0xd9, 0x96, 0xd8, 0xe6, 0x63, 0xe8, 0x07, 0x4b, 0xe0, 0x1c, 0x01, 0x50, 0x55,
+    0x00, 0x01, 0x54, 0xa2, 0x80, 0xff, 0xf3, 0x04, 0x80, 0x06, 0x42, 0x05, 0x24, 0x73, 0x50, 0x14,
+    0x7f, 0xfc, 0x84, 0x45, 0x4c, 0x81, 0xff, 0xec, 0x80, 0xaa, 0x84, 0x01, 0x15, 0xcf, 0x80, 0x04,
+    0x50, 0x9f, 0x83, 0xe0, 0x81, 0x40, 0x83, 0x85, 0xd5, 0x33, 0xa7, 0x31, 0xa6, 0xf9, 0xe2, 0x64,
+    0xe8, 0x16, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84, 0xdd, 0x2f, 0x80, 0x27, 0x84, 0x45,
+    0x80, 0x06, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84, 0xdd, 0x2f, 0x80, 0x07, 0x80, 0x29,
+    0x84, 0x45, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84, 0xdd, 0x2f, 0x8d, 0x01, 0x54, 0x84,
+    0x00, 0xff, 0x84, 0x45, 0x50, 0x6f, 0x83, 0x40, 0x42, 0x64, 0x08, 0x73, 0x50, 0x04, 0x00, 0x01,
+    0x50, 0x7f, 0x83, 0x40, 0x42, 0x70, 0x08, 0x73, 0x80, 0x09, 0x80, 0x26, 0xe1, 0x0a, 0xe9, 0xd6,
+    0x81, 0x5c, 0x50, 0x05, 0x00, 0x01, 0x05, 0xcf, 0x80, 0x05, 0x54, 0xa0, 0x00, 0xff, 0xe3, 0x5c,
+    0xe9, 0x10, 0x80, 0xbc, 0x05, 0xcf, 0x80, 0x04, 0x84, 0xc0, 0x80, 0xfc, 0x80, 0x7c, 0x85, 0x25,
+    0x46, 0x80, 0x00, 0x5a, 0x58, 0x84, 0x03, 0x84, 0x83, 0x85, 0x04, 0xaf, 0x80, 0x02, 0xd5, 0x13,
+    0x40, 0x5e, 0x28, 0x01, 0x15, 0xcf, 0x80, 0x05, 0x85, 0x00, 0x83, 0x8a, 0x81, 0x45, 0xd5, 0xd2,
+    0xf3, 0x81, 0x8d, 0x41, 0x4b, 0xe0, 0x20, 0x01, 0x9d, 0xb1, 0xf3, 0x01, 0x54, 0xa5, 0x00, 0xff,
+    0x97, 0xb0, 0x9d, 0xfd, 0x42, 0x05, 0x24, 0x24, 0x46, 0x50, 0x01, 0x1a, 0x58, 0x52, 0x8e, 0x3c,
+    0x80, 0x27, 0x98, 0x05, 0x84, 0x45, 0xe2, 0xdc, 0xe8, 0x03, 0xe7, 0x4a, 0xe9, 0xea, 0x50, 0x6f,
+    0x80, 0xc0, 0xf1, 0x03, 0x50, 0x7f, 0x83, 0x40, 0x80, 0x06, 0x83, 0x83, 0x14, 0xaf, 0x80, 0x02,
+    0x46, 0xf0, 0x00, 0x82, 0x58, 0xf7, 0x8e, 0x58, 0xdd, 0x2f, 0x80, 0x07, 0x44, 0x20, 0x00, 0x32,
+    0x84, 0x20, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0xc4, 0xdd, 0x2f, 0xf0, 0x03, 0x84, 0x45,
+    0x81, 0x46, 0x80, 0xa7, 0x42, 0xa0, 0x08, 0x73, 0x80, 0xe2, 0x85, 0x00, 0x46, 0x90, 0x00, 0x5a,
+    0x58, 0x94, 0x83, 0x84, 0xd5, 0x0b, 0xa6, 0xf0, 0x9d, 0xb5, 0xc3, 0x08, 0xf5, 0x81, 0x8d, 0x01,
+    0x4b, 0xe0, 0x24, 0x01, 0xf5, 0x01, 0x54, 0x84, 0x00, 0xff, 0x80, 0x05, 0x42, 0x04, 0x1c, 0x73,
+    0x80, 0x26, 0x84, 0x45, 0x4c, 0x65, 0x7f, 0xf1, 0x84, 0xa1, 0x50, 0x9f, 0x83, 0xe0, 0x81, 0x45,
+    0x15, 0xcf, 0x80, 0x04, 0xd5, 0x30, 0xa7, 0x34, 0xa6, 0xfc, 0xe2, 0x64, 0xe8, 0x16, 0x46, 0xf0,
+    0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84, 0xdd, 0x2f, 0x80, 0x27, 0x84, 0x45, 0x80, 0x06, 0x46, 0xf0,
+    0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84, 0xdd, 0x2f, 0x80, 0x07, 0x80, 0x29, 0x84, 0x45, 0x46, 0xf0,
+    0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84, 0xdd, 0x2f, 0x8d, 0x01, 0x54, 0x84, 0x00, 0xff, 0x84, 0x45,
+    0x50, 0x6f, 0x83, 0x40, 0x42, 0x64, 0x08, 0x73, 0x50, 0x04, 0x00, 0x01, 0x50, 0x7f, 0x83, 0x40,
+    0x42, 0x70, 0x08, 0x73, 0x80, 0x09, 0x80, 0x26, 0xe1, 0x1c, 0xe9, 0xd6, 0x50, 0x55, 0x00, 0x01,
+    0x54, 0xa2, 0x80, 0xff, 0xf2, 0x03, 0xe3, 0x42, 0xe9, 0x0c, 0x05, 0xcf, 0x80, 0x04, 0x84, 0xc0,
+    0x85, 0x05, 0x46, 0x70, 0x00, 0x5a, 0x58, 0x73, 0x83, 0x84, 0x04, 0x9f, 0x80, 0x02, 0xd5, 0x18,
+    0xf3, 0x03, 0x85, 0x00, 0x41, 0xc1, 0xa8, 0x01, 0xd5, 0xdb, 0x00, 0x3e, 0x00, 0x00, 0xc3, 0x1c,
+    0x00, 0x3e, 0x00, 0x04, 0x51, 0xce, 0x00, 0x05, 0xe6, 0x64, 0xe8, 0x16, 0xe7, 0x2a, 0xe8, 0x14,
+    0x8d, 0x21, 0x9d, 0xb1, 0x4b, 0xe0, 0x1c, 0x01, 0x54, 0x94, 0x80, 0xff, 0x97, 0xb0, 0x42, 0x04,
+    0xa0, 0x24, 0xf5, 0x03, 0x46, 0x40, 0x01, 0x1a, 0x58, 0x42, 0x0e, 0x3c, 0x80, 0x3c, 0x98, 0x04,
+    0x84, 0x45, 0xe2, 0xc5, 0xe9, 0xe3, 0x50, 0x6f, 0x80, 0x20, 0xf1, 0x06, 0x80, 0x06, 0x14, 0x9f,
+    0x80, 0x02, 0x84, 0xe0, 0x46, 0xf0, 0x00, 0x82, 0x58, 0xf7, 0x8e, 0x58, 0xdd, 0x2f, 0x85, 0x25,
+    0x46, 0x80, 0x00, 0x5a, 0x58, 0x84, 0x03, 0x84, 0x04, 0xaf, 0x80, 0x02, 0xd5, 0x0d, 0xa6, 0xf0,
+    0x9d, 0xb5, 0xc3, 0x16, 0xe7, 0x4a, 0xe8, 0x14, 0x8d, 0x41, 0x9d, 0xf9, 0x4b, 0xe0, 0x20, 0x01,
+    0x54, 0xa5, 0x00, 0xff, 0x97, 0xf8, 0x42, 0x05, 0x24, 0x24, 0xf3, 0x06, 0x46, 0x20, 0x01, 0x1a,
+    0x58, 0x21, 0x0e, 0x3c, 0x98, 0x02, 0x80, 0x26, 0x84, 0x45, 0xe2, 0xe3, 0xe9, 0xe9, 0x14, 0xaf,
+    0x80, 0x02, 0x46, 0xf0, 0x01, 0x12, 0x10, 0xa7, 0x8b, 0x95, 0x51, 0xff, 0x83, 0xec, 0x3a, 0x6f,
+    0xaa, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xfc, 0x80, 0xc2, 0x80, 0xe0, 0x54, 0x80,
+    0x80, 0xff, 0x80, 0x02, 0x84, 0x20, 0x44, 0x20, 0x00, 0x46, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7,
+    0x83, 0xc4, 0xdd, 0x2f, 0xa6, 0x39, 0xae, 0x30, 0x4e, 0x82, 0x00, 0x04, 0x10, 0x83, 0x00, 0x02,
+    0x84, 0x20, 0x87, 0x89, 0x50, 0xa3, 0x00, 0x0a, 0x85, 0x03, 0x84, 0xa1, 0x50, 0x93, 0x00, 0x28,
+    0xd5, 0x50, 0x80, 0x07, 0x42, 0x00, 0xf0, 0x73, 0x84, 0x81, 0x00, 0x30, 0x00, 0x08, 0x20, 0x20,
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x4c, 0x32, 0x40, 0x1f, 0x5e, 0xf1, 0x7f, 0xba, 0xe8, 0x17,
+    0x00, 0x33, 0x00, 0x09, 0x80, 0x09, 0x98, 0xdc, 0x10, 0x33, 0x00, 0x09, 0x84, 0x60, 0xa7, 0x00,
+    0x9c, 0x03, 0xc4, 0x06, 0x9c, 0xd9, 0x87, 0xca, 0x4c, 0x3f, 0x7f, 0xfb, 0xd5, 0x08, 0x80, 0x06,
+    0x42, 0x01, 0xa0, 0x73, 0x10, 0x20, 0x00, 0x2a, 0x10, 0x50, 0x00, 0x28, 0xa6, 0x33, 0x9c, 0x01,
+    0xae, 0x33, 0xd5, 0x25, 0xcb, 0x24, 0x5e, 0xf1, 0x7f, 0xba, 0xe8, 0x1b, 0x5c, 0xf0, 0x00, 0x32,
+    0xe8, 0x18, 0xa7, 0x37, 0x9d, 0x21, 0xaf, 0x37, 0x80, 0x8a, 0x01, 0xe2, 0x00, 0x00, 0x9d, 0x23,
+    0x4f, 0xe2, 0x00, 0x07, 0x9c, 0xd9, 0x87, 0xca, 0x4c, 0x3f, 0x7f, 0xf9, 0xd5, 0x0a, 0x80, 0x86,
+    0x42, 0x41, 0xa0, 0x73, 0x10, 0x22, 0x00, 0x0c, 0x10, 0x02, 0x00, 0x0b, 0x10, 0x52, 0x00, 0x0a,
+    0xa6, 0xf1, 0xa6, 0xb4, 0x98, 0x03, 0x9c, 0x91, 0xae, 0x31, 0xae, 0xb4, 0x9c, 0x49, 0x96, 0x48,
+    0xa6, 0x38, 0xe2, 0x20, 0xe9, 0xaf, 0xec, 0x04, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x92, 0x00,
+    0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xd4, 0x04, 0xa0, 0x00, 0x02, 0x80, 0xa0, 0x46, 0xf0, 0x01, 0x12,
+    0x04, 0x07, 0x82, 0xdf, 0x51, 0xcf, 0x80, 0x18, 0x84, 0xc0, 0x81, 0x01, 0x84, 0x21, 0xb6, 0xdc,
+    0x12, 0x6e, 0x00, 0x02, 0x50, 0x95, 0x00, 0x04, 0x4c, 0x00, 0xc0, 0xbc, 0x46, 0x30, 0x01, 0x1b,
+    0x58, 0x31, 0x85, 0x80, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char firmware2[] = {
+    0x00, 0x38, 0x00, 0x10, 0x00, 0x01, 0x8a, 0xc8, 0xc8, 0x4b, 0x80, 0x08, 0xf3, 0x81, 0xf5, 0x82,
+    0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x82, 0x2c, 0xdd, 0x2f, 0x80, 0xe0, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x07, 0x8b, 0xb5, 0xa0, 0x7a, 0x80, 0x48, 0xb6, 0x01, 0x8d, 0x04, 0xf5, 0x02, 0xa0, 0x3a,
+    0xa0, 0x6a, 0x40, 0x84, 0x00, 0x13, 0x9c, 0x04, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84,
+    0xdd, 0x2f, 0x12, 0x83, 0x80, 0x0c, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x07, 0x8b, 0x96, 0x46, 0x15,
+    0x8c, 0x10, 0x54, 0x84, 0x3f, 0xff, 0x54, 0x00, 0x00, 0x03, 0x40, 0x00, 0x64, 0x08, 0x40, 0x84,
+    0x04, 0x04, 0x40, 0x84, 0x00, 0x04, 0x14, 0x83, 0x80, 0x03, 0x80, 0x27, 0xf0, 0x01, 0x46, 0xf0,
+    0x00, 0x80, 0x58, 0xf7, 0x84, 0x90, 0xdd, 0x2f, 0x80, 0xc0, 0x4e, 0x03, 0x01, 0x88, 0x00, 0x03,
+    0x80, 0x1a, 0x46, 0x20, 0x01, 0x1a, 0x58, 0x21, 0x02, 0x18, 0x94, 0x04, 0x80, 0x27, 0x98, 0x02,
+    0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x84, 0x88, 0xdd, 0x2f, 0x48, 0x00, 0x01, 0x79, 0x00, 0x14,
+    0x80, 0x03, 0x00, 0x04, 0x80, 0x02, 0x54, 0x10, 0x80, 0x3f, 0x40, 0x10, 0xa0, 0x08, 0x40, 0x10,
+    0x80, 0x04, 0x80, 0x5c, 0x50, 0x3f, 0x80, 0x27, 0x50, 0x4f, 0x80, 0x26, 0x80, 0x0a, 0x46, 0xf0,
+    0x00, 0x82, 0x58, 0xf7, 0x8f, 0x38, 0xdd, 0x2f, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x37, 0x8b, 0xb5,
+    0x46, 0x70, 0x01, 0x19, 0x58, 0x73, 0x82, 0x90, 0x8d, 0x4c, 0x3a, 0xa5, 0x28, 0x00, 0xae, 0xf9,
+    0x00, 0x3f, 0x80, 0x26, 0x46, 0x20, 0x00, 0x82, 0x58, 0x21, 0x0e, 0x18, 0x50, 0x8f, 0x80, 0x10,
+    0xb6, 0xc8, 0x12, 0x64, 0x00, 0x02, 0xf3, 0x83, 0xf2, 0x82, 0x80, 0x3c, 0x80, 0x07, 0x00, 0x9f,
+    0x80, 0x27, 0xdd, 0x22, 0x84, 0x2a, 0x40, 0xa5, 0x00, 0x10, 0xf2, 0x02, 0x4c, 0x00, 0x80, 0x0f,
+    0x84, 0x29, 0x42, 0x00, 0x04, 0x24, 0xf2, 0x03, 0x98, 0x07, 0x10, 0x20, 0x00, 0x09, 0x10, 0x90,
+    0x00, 0x08, 0x10, 0xa0, 0x00, 0x0a, 0x48, 0x00, 0x01, 0x33, 0x80, 0x28, 0x80, 0x07, 0xdd, 0x22,
+    0xe6, 0x0a, 0x4e, 0xf2, 0x01, 0x2c, 0x85, 0x09, 0x42, 0x80, 0x20, 0x24, 0x46, 0x30, 0x01, 0x19,
+    0x58, 0x31, 0x82, 0x90, 0x89, 0x03, 0x80, 0x3c, 0x50, 0x04, 0x00, 0x02, 0x84, 0x46, 0x46, 0xf0,
+    0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84, 0xdd, 0x2f, 0xf0, 0x03, 0x10, 0x94, 0x00, 0x08, 0x10, 0x04,
+    0x00, 0x09, 0x10, 0xa4, 0x00, 0x0a, 0xa6, 0x38, 0x9c, 0x01, 0xae, 0x38, 0x48, 0x00, 0x01, 0x10,
+    0x50, 0x75, 0x00, 0x20, 0xa6, 0x38, 0x84, 0x28, 0x54, 0x00, 0x00, 0x0c, 0x4c, 0x00, 0xc0, 0x13,
+    0x00, 0x04, 0x80, 0x00, 0x9e, 0x01, 0xae, 0x10, 0x00, 0x04, 0x80, 0x07, 0x92, 0x05, 0xae, 0x18,
+    0x00, 0x04, 0x80, 0x06, 0x54, 0x00, 0x00, 0x7f, 0xae, 0x20, 0x00, 0x63, 0x80, 0x10, 0x42, 0x63,
+    0x04, 0x0b, 0xa6, 0x38, 0x54, 0x10, 0x00, 0x0c, 0xc1, 0x0d, 0x84, 0x48, 0x4c, 0x11, 0x40, 0x9d,
+    0x54, 0x10, 0x00, 0xf0, 0x44, 0x30, 0x00, 0xc0, 0x4c, 0x11, 0x80, 0x97, 0x94, 0x93, 0x4c, 0x11,
+    0x00, 0x94, 0x55, 0xc0, 0x00, 0xf0, 0x4f, 0xc3, 0x00, 0x3f, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x07,
+    0x80, 0x48, 0xc0, 0x39, 0x46, 0x00, 0x01, 0x19, 0x58, 0x00, 0x00, 0xa4, 0xa6, 0x80, 0x00, 0x13,
+    0x80, 0x10, 0x4c, 0x20, 0xc0, 0x31, 0xa6, 0x81, 0x00, 0x13, 0x80, 0x11, 0x4c, 0x20, 0xc0, 0x2c,
+    0xa6, 0x42, 0x00, 0x03, 0x80, 0x12, 0x4c, 0x10, 0x40, 0x27, 0x46, 0xf0, 0x01, 0x0e, 0x04, 0x07,
+    0x80, 0x99, 0xc0, 0x21, 0x46, 0x00, 0x01, 0x1b, 0x58, 0x00, 0x05, 0x68, 0x46, 0xf0, 0x00, 0x80,
+    0x58, 0xf7, 0x8c, 0xb4, 0xdd, 0x2f, 0x50, 0x03, 0x80, 0x0a, 0x46, 0xf0, 0x00, 0x84, 0x58, 0xf7,
+    0x8a, 0x4c, 0xdd, 0x2f, 0x80, 0x0a, 0x46, 0xf0, 0x00, 0x84, 0x58, 0xf7, 0x89, 0x78, 0xdd, 0x2f,
+    0x84, 0x03, 0x84, 0x21, 0x46, 0xf0, 0x00, 0x56, 0x58, 0xf7, 0x8f, 0xa4, 0xdd, 0x2f, 0x80, 0xdc,
+    0x48, 0x00, 0x00, 0xa6, 0x46, 0xa0, 0x01, 0x1b, 0x58, 0xa5, 0x05, 0x80, 0x00, 0x05, 0x0a, 0xc8,
+    0x4e, 0x03, 0x00, 0x9d, 0x80, 0x08, 0xf5, 0x82, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x82, 0x2c,
+    0xdd, 0x2f, 0x80, 0xe0, 0xf5, 0x02, 0xc8, 0x0b, 0x80, 0x48, 0x44, 0x10, 0x03, 0x9f, 0x46, 0xf0,
+    0x00, 0x85, 0x58, 0xf7, 0x81, 0x60, 0xdd, 0x2f, 0x48, 0x00, 0x00, 0x8a, 0xa0, 0x6a, 0xa0, 0x02,
+    0x80, 0x48, 0x40, 0x84, 0x00, 0x13, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84, 0xdd, 0x2f,
+    0x12, 0x83, 0x80, 0x0c, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x07, 0x8b, 0x96, 0x46, 0x35, 0x8c, 0x00,
+    0x54, 0x84, 0x3f, 0xff, 0x54, 0x00, 0x00, 0x03, 0x40, 0x00, 0x64, 0x08, 0x40, 0x84, 0x0c, 0x04,
+    0x40, 0x84, 0x00, 0x04, 0x14, 0x83, 0x80, 0x03, 0x80, 0x0a, 0x80, 0x27, 0x46, 0xf0, 0x00, 0x80,
+    0x58, 0xf7, 0x84, 0x90, 0xdd, 0x2f, 0xc8, 0x11, 0x00, 0x03, 0x80, 0x1a, 0x46, 0x20, 0x01, 0x1a,
+    0x58, 0x21, 0x02, 0x18, 0x94, 0x04, 0x80, 0x27, 0x98, 0x02, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7,
+    0x84, 0x88, 0xdd, 0x2f, 0xd5, 0x02, 0x84, 0xe0, 0x00, 0xa4, 0x80, 0x00, 0x8f, 0x41, 0x54, 0xa5,
+    0x00, 0xff, 0x80, 0x0a, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x8a, 0x30, 0xdd, 0x2f, 0x83, 0x80,
+    0xc8, 0x38, 0x46, 0x80, 0x01, 0x12, 0x58, 0x84, 0x0b, 0x70, 0x85, 0x21, 0xb4, 0x08, 0x40, 0x14,
+    0xa8, 0x0c, 0x40, 0x00, 0x80, 0x02, 0xc0, 0x21, 0xc6, 0x20, 0x50, 0x0f, 0x80, 0x20, 0xf1, 0x82,
+    0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x2c, 0xdd, 0x2f, 0xf1, 0x02, 0xb4, 0x68, 0x40, 0x10,
+    0x84, 0x05, 0x40, 0x30, 0x8c, 0x02, 0xb6, 0x68, 0x80, 0x0a, 0x80, 0x5c, 0x80, 0x29, 0x46, 0xf0,
+    0x00, 0x82, 0x58, 0xf7, 0x89, 0xcc, 0xdd, 0x2f, 0xf0, 0x08, 0x80, 0xc9, 0x46, 0xf0, 0x00, 0x01,
+    0x58, 0xf7, 0x8c, 0x58, 0xdd, 0x2f, 0xd5, 0x1b, 0x00, 0x23, 0x80, 0x13, 0x44, 0x00, 0x02, 0x00,
+    0x44, 0x10, 0x03, 0xc7, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x81, 0x60, 0xdd, 0x2f, 0xd5, 0x0e,
+    0x46, 0xf0, 0x01, 0x12, 0x00, 0x07, 0x8b, 0x98, 0xc0, 0x0a, 0x46, 0x00, 0x01, 0x12, 0x00, 0x10,
+    0x0b, 0xa1, 0x9c, 0x49, 0x10, 0x10, 0x0b, 0xa1, 0xd5, 0x02, 0x84, 0xc0, 0x80, 0x06, 0xec, 0x2c,
+    0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x96, 0x49, 0xe6, 0x24, 0xe8, 0x03, 0x84, 0x21,
+    0xd5, 0x3d, 0xb4, 0x20, 0x84, 0x45, 0x4c, 0x11, 0x00, 0x22, 0xe6, 0x26, 0xe8, 0x06, 0x84, 0xa1,
+    0xd1, 0x09, 0x84, 0xa2, 0xd9, 0x32, 0xd5, 0x12, 0x84, 0xa7, 0xd1, 0x1f, 0x84, 0xa8, 0xd9, 0x2d,
+    0xd5, 0x23, 0x9c, 0x04, 0xb4, 0x20, 0x46, 0x00, 0x01, 0x12, 0x58, 0x00, 0x0b, 0x96, 0x96, 0x48,
+    0xae, 0x40, 0xe6, 0x22, 0xe9, 0x22, 0x84, 0x20, 0xd5, 0x1f, 0x9c, 0x04, 0xb4, 0x20, 0x46, 0x00,
+    0x01, 0x12, 0x58, 0x00, 0x0b, 0x91, 0x96, 0x4c, 0xd5, 0x17, 0x9c, 0x04, 0xb4, 0x20, 0x46, 0x00,
+    0x01, 0x12, 0x58, 0x00, 0x0b, 0x9d, 0xd5, 0x10, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x27, 0x82, 0xe3,
+    0x84, 0x20, 0xb6, 0x40, 0xd5, 0x0b, 0x9c, 0x04, 0xb4, 0x20, 0x46, 0x00, 0x01, 0x12, 0x58, 0x00,
+    0x0b, 0x92, 0x54, 0x10, 0x80, 0x07, 0xae, 0x40, 0x84, 0x20, 0x80, 0x01, 0xdd, 0x9e, 0x92, 0x00,
+    0xb4, 0x40, 0x84, 0x01, 0x4c, 0x20, 0x00, 0x14, 0xc2, 0x04, 0x84, 0xa2, 0xda, 0x38, 0xd5, 0x20,
+    0x46, 0x10, 0x04, 0x00, 0x58, 0x10, 0x82, 0x8c, 0xb4, 0x01, 0xb6, 0x41, 0x46, 0x43, 0x23, 0x2f,
+    0xb4, 0x61, 0x50, 0x00, 0xff, 0xe4, 0x58, 0x42, 0x0f, 0xff, 0xd5, 0x20, 0x46, 0x00, 0x04, 0x00,
+    0x84, 0x20, 0x04, 0x20, 0x00, 0xa3, 0x14, 0x10, 0x00, 0xa3, 0x46, 0x00, 0x04, 0x00, 0x58, 0x00,
+    0x02, 0x70, 0xb4, 0x40, 0xb6, 0x20, 0xb4, 0x20, 0x42, 0x10, 0xdc, 0x08, 0xd5, 0x17, 0x46, 0x10,
+    0x04, 0x00, 0x58, 0x10, 0x82, 0x8c, 0x84, 0x40, 0xb4, 0x01, 0xb6, 0x41, 0x46, 0x40, 0x0f, 0xff,
+    0xb4, 0x61, 0x50, 0x00, 0xff, 0xe4, 0x58, 0x42, 0x0f, 0xff, 0x40, 0x31, 0x90, 0x04, 0xb6, 0x61,
+    0xb4, 0x20, 0xb6, 0x40, 0xb4, 0x20, 0x42, 0x10, 0xdc, 0x08, 0xb6, 0x20, 0x84, 0x00, 0xdd, 0x9e,
+    0x96, 0x49, 0x54, 0x20, 0x80, 0x03, 0x92, 0x22, 0xca, 0x0f, 0xb4, 0x60, 0x54, 0x21, 0x80, 0x03,
+    0xca, 0x0b, 0x84, 0x41, 0xd5, 0x04, 0xb4, 0x80, 0x9c, 0x91, 0xab, 0x19, 0x9c, 0x04, 0xe2, 0x41,
+    0xe9, 0xfb, 0x84, 0x00, 0xd5, 0x02, 0x84, 0x01, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x9c, 0x3c,
+    0x96, 0x89, 0x84, 0x2c, 0x40, 0x31, 0x04, 0x37, 0x92, 0x42, 0xc9, 0x1b, 0xd5, 0x16, 0xa2, 0xc3,
+    0x54, 0x61, 0x80, 0x03, 0x9c, 0x4b, 0x50, 0x40, 0x7f, 0xf8, 0x9f, 0x44, 0x40, 0x31, 0xa0, 0x08,
+    0x92, 0x68, 0xce, 0x0f, 0xb4, 0xc3, 0xb4, 0x84, 0xb4, 0xa5, 0x40, 0x42, 0x10, 0x05, 0x40, 0x42,
+    0x18, 0x02, 0x40, 0x42, 0x14, 0x04, 0xb6, 0x83, 0xe2, 0x22, 0xe9, 0xea, 0x84, 0x00, 0xd5, 0x02,
+    0x84, 0x01, 0x3a, 0x6f, 0x9c, 0x04, 0xdd, 0x9e, 0x3a, 0x6f, 0x98, 0x3c, 0x96, 0x49, 0x54, 0x20,
+    0x80, 0x07, 0x92, 0x22, 0xca, 0x11, 0xd5, 0x0c, 0xa2, 0xc2, 0x54, 0x51, 0x80, 0x03, 0x9c, 0x92,
+    0x9f, 0x04, 0x40, 0x31, 0xa0, 0x08, 0x92, 0x68, 0xcd, 0x07, 0xb4, 0x84, 0xb6, 0x83, 0xe2, 0x41,
+    0xe9, 0xf4, 0x84, 0x00, 0xd5, 0x02, 0x84, 0x01, 0x3a, 0x6f, 0x98, 0x04, 0xdd, 0x9e, 0x92, 0x00,
+    0x3a, 0x6f, 0x98, 0x3c, 0x96, 0x49, 0x54, 0x20, 0x80, 0x07, 0x92, 0x22, 0xca, 0x11, 0xd5, 0x0c,
+    0xa2, 0xc2, 0x54, 0x51, 0x80, 0x03, 0x9c, 0x92, 0x9f, 0x04, 0x40, 0x31, 0xa0, 0x08, 0x92, 0x68,
+    0xcd, 0x07, 0xb4, 0x63, 0xb6, 0x64, 0xe2, 0x41, 0xe9, 0xf4, 0x84, 0x00, 0xd5, 0x02, 0x84, 0x01,
+    0x3a, 0x6f, 0x98, 0x04, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x98, 0x3c, 0xa4, 0x88, 0x5c, 0xf1,
+    0x06, 0x48, 0xe8, 0x18, 0x80, 0x80, 0xa2, 0xa1, 0x54, 0x31, 0x00, 0x03, 0xb4, 0xa4, 0xcb, 0x12,
+    0x5c, 0xf2, 0x80, 0x40, 0xe8, 0x0f, 0xd5, 0x04, 0xa3, 0x91, 0x80, 0x64, 0xb6, 0xc0, 0x40, 0x21,
+    0x20, 0x08, 0x92, 0x48, 0x9c, 0x04, 0x9d, 0x19, 0xdb, 0xf8, 0x95, 0x22, 0xad, 0x08, 0x84, 0x00,
+    0xd5, 0x02, 0x84, 0x01, 0x3a, 0x6f, 0x98, 0x04, 0xdd, 0x9e, 0x92, 0x00, 0x46, 0x00, 0x04, 0x11,
+    0xa0, 0x41, 0x58, 0x10, 0x80, 0x0c, 0xa8, 0x41, 0xdd, 0x9e, 0x92, 0x00, 0x3b, 0xff, 0xfc, 0xbc,
+    0xef, 0xfc, 0x02, 0x10, 0x00, 0x0c, 0xe6, 0x24, 0xe8, 0x03, 0x84, 0x01, 0xd5, 0x14, 0xa0, 0x02,
+    0x84, 0x42, 0xb4, 0xa0, 0xd2, 0x02, 0xd5, 0x0e, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x27, 0x82, 0xf5,
+    0x46, 0x10, 0x01, 0x1a, 0x58, 0x10, 0x8f, 0x20, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84,
+    0xdd, 0x2f, 0x84, 0x0b, 0xec, 0x04, 0x3b, 0xff, 0xfc, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x9c, 0xbc,
+    0xef, 0xfc, 0x80, 0x20, 0xa2, 0x89, 0x84, 0x61, 0xb4, 0x21, 0x4c, 0x21, 0xc0, 0x20, 0x96, 0xc8,
+    0x46, 0x20, 0x01, 0x1b, 0x58, 0x21, 0x05, 0x80, 0x54, 0x41, 0x80, 0x02, 0x92, 0x28, 0x10, 0x41,
+    0x0a, 0xc9, 0x10, 0x31, 0x0a, 0xc8, 0x10, 0x11, 0x0a, 0xcb, 0x8c, 0x08, 0x46, 0x10, 0x01, 0x1a,
+    0x58, 0x10, 0x8e, 0x3c, 0x08, 0x20, 0x00, 0x01, 0x46, 0x50, 0x01, 0x1a, 0x58, 0x52, 0x8e, 0x6e,
+    0x18, 0x20, 0x80, 0x05, 0xd9, 0xf8, 0x48, 0x00, 0x00, 0x95, 0x84, 0x03, 0x4c, 0x20, 0x40, 0x92,
+    0x96, 0x48, 0x46, 0x70, 0x01, 0x1b, 0x58, 0x73, 0x85, 0x80, 0x10, 0x13, 0x8a, 0xce, 0x46, 0x00,
+    0x04, 0x10, 0x58, 0x00, 0x08, 0x0c, 0xb4, 0x40, 0x42, 0x21, 0x60, 0x09, 0x42, 0x21, 0x64, 0x09,
+    0xc9, 0x07, 0x46, 0x10, 0x30, 0x00, 0x40, 0x21, 0x04, 0x04, 0xb6, 0x40, 0xd5, 0x7a, 0x42, 0x21,
+    0x60, 0x08, 0xb6, 0x40, 0x46, 0x00, 0x04, 0x11, 0x58, 0x00, 0x00, 0x18, 0xb4, 0x20, 0x92, 0x2c,
+    0x40, 0x10, 0xb0, 0x08, 0xb6, 0x20, 0x84, 0xc0, 0xb4, 0x60, 0x80, 0x26, 0x58, 0x31, 0x86, 0x1c,
+    0xb6, 0x60, 0x84, 0x60, 0x10, 0x33, 0x8a, 0xcd, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x67, 0x82, 0xf5,
+    0x44, 0x20, 0x06, 0x48, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0f, 0x20, 0x46, 0xf0, 0x00, 0x5a,
+    0x58, 0xf7, 0x83, 0xc4, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x84, 0x58, 0xf7, 0x88, 0x84, 0xdd, 0x2f,
+    0x46, 0xf0, 0x01, 0x12, 0x14, 0x67, 0x82, 0xe2, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x67, 0x82, 0xdf,
+    0x46, 0xf0, 0x01, 0x12, 0x14, 0x67, 0x82, 0xe0, 0x00, 0x03, 0x8a, 0xcb, 0x46, 0xf0, 0x01, 0x12,
+    0x14, 0x67, 0x82, 0xf6, 0x80, 0x26, 0x80, 0x46, 0x46, 0xf0, 0x00, 0x8a, 0x58, 0xf7, 0x87, 0x50,
+    0xdd, 0x2f, 0x00, 0x03, 0x8a, 0xcb, 0xe6, 0x0f, 0xe8, 0x08, 0x80, 0x06, 0x46, 0xf0, 0x00, 0x8b,
+    0x58, 0xf7, 0x85, 0x84, 0xdd, 0x2f, 0xd5, 0x0d, 0x46, 0x10, 0x00, 0x8b, 0x58, 0x10, 0x85, 0x84,
+    0x5c, 0xf0, 0x00, 0x64, 0xe8, 0x03, 0x84, 0x01, 0xd5, 0x02, 0x84, 0x02, 0x4b, 0xe0, 0x04, 0x01,
+    0x46, 0x00, 0x01, 0x1b, 0x58, 0x00, 0x05, 0x68, 0x46, 0x60, 0x00, 0x80, 0x58, 0x63, 0x0e, 0xa8,
+    0x84, 0x20, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x07, 0x80, 0x49, 0xc8, 0x11,
+    0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0e, 0x70, 0x44, 0x14, 0x93, 0xe0, 0x4b, 0xe0, 0x18, 0x01,
+    0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0e, 0x88, 0x44, 0x14, 0x9f, 0x98, 0x4b, 0xe0, 0x18, 0x01,
+    0x84, 0x00, 0xec, 0x04, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xa4, 0xbc,
+    0xef, 0xfc, 0x46, 0x00, 0x04, 0x11, 0xa0, 0x41, 0x84, 0x53, 0x40, 0x10, 0x88, 0x02, 0x80, 0xe0,
+    0xa8, 0x41, 0x84, 0xc0, 0x46, 0x80, 0x00, 0x02, 0x58, 0x84, 0x07, 0x50, 0x04, 0x93, 0x80, 0x80,
+    0x84, 0x01, 0x4b, 0xe0, 0x20, 0x01, 0x54, 0x04, 0x80, 0x03, 0x9d, 0xb1, 0xc0, 0x04, 0x44, 0x50,
+    0x03, 0xe8, 0xde, 0xf5, 0xec, 0x04, 0x3a, 0x6f, 0xa4, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc,
+    0xef, 0xb4, 0x84, 0xa0, 0x46, 0xf0, 0x01, 0x12, 0x10, 0x57, 0x8b, 0x98, 0x46, 0x40, 0x04, 0x11,
+    0x04, 0x62, 0x00, 0xd4, 0x80, 0xa4, 0x58, 0x63, 0x04, 0x00, 0x14, 0x62, 0x00, 0xd4, 0x04, 0x72,
+    0x81, 0x07, 0x44, 0x8f, 0x1f, 0xff, 0x46, 0x40, 0x04, 0x11, 0x46, 0x61, 0x00, 0x00, 0x58, 0x42,
+    0x03, 0x40, 0x40, 0x73, 0xa0, 0x02, 0x58, 0x63, 0x00, 0x3f, 0x14, 0x72, 0x81, 0x07, 0xb6, 0xc4,
+    0x80, 0xe3, 0xb4, 0x64, 0xb4, 0x64, 0x97, 0x80, 0x42, 0x01, 0xd0, 0x09, 0xb6, 0x04, 0x55, 0xc0,
+    0x80, 0xff, 0x54, 0xa1, 0x00, 0xff, 0x46, 0xf0, 0x00, 0x83, 0x58, 0xf7, 0x8f, 0xd8, 0xdd, 0x2f,
+    0x46, 0x40, 0x04, 0x12, 0x58, 0x42, 0x00, 0x10, 0xb4, 0x24, 0x58, 0x10, 0x80, 0x03, 0xb6, 0x24,
+    0x80, 0x06, 0xb4, 0x24, 0x54, 0x93, 0x80, 0xff, 0x92, 0x22, 0x94, 0x4a, 0xb6, 0x24, 0x40, 0x83,
+    0xf0, 0x09, 0x46, 0xf0, 0x00, 0x8a, 0x58, 0xf7, 0x8d, 0x38, 0xdd, 0x2f, 0x80, 0x06, 0x46, 0xf0,
+    0x00, 0x8a, 0x58, 0xf7, 0x8f, 0xc4, 0xdd, 0x2f, 0x40, 0x03, 0xc0, 0x09, 0x96, 0x00, 0xc0, 0x0a,
+    0x40, 0x03, 0xa0, 0x09, 0x96, 0x02, 0x80, 0x29, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x85, 0xa4,
+    0xdd, 0x2f, 0x80, 0x3c, 0x80, 0x4a, 0x80, 0x06, 0x46, 0xf0, 0x00, 0x8a, 0x58, 0xf7, 0x87, 0x50,
+    0xdd, 0x2f, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x82, 0xe4, 0xdd, 0x2f, 0x80, 0x06,
+    0x80, 0x29, 0x80, 0x48, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x84, 0xa8, 0xdd, 0x2f, 0x46, 0xf0,
+    0x00, 0x83, 0x58, 0xf7, 0x8f, 0xd8, 0xdd, 0x2f, 0x80, 0x06, 0x46, 0xf0, 0x00, 0x8e, 0x58, 0xf7,
+    0x85, 0x0c, 0xdd, 0x2f, 0x84, 0xa1, 0x4c, 0x82, 0xc0, 0x34, 0xe6, 0xcf, 0xe9, 0x18, 0x92, 0xf8,
+    0x54, 0x73, 0x80, 0x0f, 0xcf, 0x06, 0x46, 0xf0, 0x00, 0x8e, 0x58, 0xf7, 0x84, 0xe8, 0xdd, 0x2f,
+    0x84, 0x01, 0x46, 0xf0, 0x00, 0x8e, 0x58, 0xf7, 0x84, 0x4c, 0xdd, 0x2f, 0x84, 0x01, 0x46, 0xf0,
+    0x00, 0x8e, 0x58, 0xf7, 0x84, 0x80, 0xdd, 0x2f, 0x84, 0x01, 0xd5, 0x0e, 0x84, 0x00, 0x46, 0xf0,
+    0x00, 0x8e, 0x58, 0xf7, 0x84, 0x4c, 0xdd, 0x2f, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x8e, 0x58, 0xf7,
+    0x84, 0x80, 0xdd, 0x2f, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x8e, 0x58, 0xf7, 0x84, 0xb4, 0xdd, 0x2f,
+    0x80, 0x06, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x85, 0xfc, 0xdd, 0x2f, 0xd5, 0x07, 0x80, 0x06,
+    0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x88, 0x2c, 0xdd, 0x2f, 0x50, 0x6f, 0x80, 0x04, 0x46, 0xf0,
+    0x00, 0x83, 0x58, 0xf7, 0x8e, 0x08, 0xdd, 0x2f, 0x80, 0x06, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7,
+    0x82, 0x8c, 0xdd, 0x2f, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x07, 0x8b, 0xb7, 0x85, 0x02, 0x4c, 0x04,
+    0x40, 0x08, 0x80, 0x06, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x85, 0x30, 0xdd, 0x2f, 0x46, 0xf0,
+    0x01, 0x12, 0x00, 0x07, 0x8b, 0xb7, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x82, 0xe4, 0xdd, 0x2f,
+    0x84, 0x21, 0x46, 0xf0, 0x01, 0x12, 0x10, 0x17, 0x8b, 0x98, 0xec, 0x4c, 0x3a, 0x6f, 0xaa, 0x84,
+    0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x98, 0xbc, 0xb4, 0x20, 0x84, 0xa5, 0x4c, 0x12, 0x80, 0x90,
+    0xe6, 0x26, 0xe8, 0x10, 0x84, 0xa2, 0xd1, 0x53, 0xe6, 0x23, 0xe8, 0x06, 0xc1, 0x1f, 0x84, 0xa1,
+    0x4c, 0x12, 0xc1, 0x40, 0xd5, 0x25, 0x84, 0xa3, 0xd1, 0x68, 0x84, 0xa4, 0x4c, 0x12, 0xc1, 0x3a,
+    0xd5, 0x6c, 0x84, 0xa8, 0x4c, 0x12, 0x81, 0x07, 0xe6, 0x29, 0xe8, 0x08, 0x84, 0xa6, 0xd1, 0x7f,
+    0x84, 0xa7, 0x4c, 0x12, 0xc1, 0x2f, 0x48, 0x00, 0x00, 0x83, 0x84, 0xa9, 0x4c, 0x12, 0x81, 0x19,
+    0x84, 0xaa, 0x4c, 0x12, 0xc1, 0x27, 0x48, 0x00, 0x01, 0x1e, 0x50, 0x10, 0x00, 0x08, 0x9c, 0x04,
+    0x46, 0xf0, 0x00, 0x82, 0x58, 0xf7, 0x8c, 0xf4, 0xdd, 0x2f, 0x48, 0x00, 0x01, 0x1b, 0x50, 0x20,
+    0x00, 0x08, 0x9c, 0x04, 0xb4, 0xc0, 0xb4, 0x42, 0x97, 0xb0, 0x46, 0x30, 0x00, 0x82, 0x58, 0x31,
+    0x89, 0xcc, 0xc2, 0x03, 0x80, 0x06, 0xd5, 0x04, 0x80, 0x06, 0x44, 0x20, 0x1f, 0x40, 0x4b, 0xe0,
+    0x0c, 0x01, 0x46, 0x00, 0x01, 0x12, 0x58, 0x00, 0x0b, 0x70, 0x84, 0x21, 0xb4, 0x40, 0x40, 0x10,
+    0x98, 0x0c, 0x40, 0x10, 0x84, 0x05, 0x40, 0x10, 0x88, 0x02, 0x84, 0x60, 0x46, 0x20, 0x01, 0x19,
+    0x58, 0x21, 0x00, 0xac, 0x38, 0x31, 0x19, 0x09, 0x48, 0x00, 0x00, 0xf3, 0x9c, 0x44, 0xb4, 0xc1,
+    0x50, 0x30, 0x00, 0x08, 0x97, 0xb0, 0x80, 0x06, 0x84, 0x20, 0x44, 0x20, 0x1f, 0x40, 0xb4, 0x63,
+    0x46, 0xf0, 0x00, 0x82, 0x58, 0xf7, 0x89, 0xcc, 0xdd, 0x2f, 0x46, 0x10, 0x01, 0x12, 0x84, 0x01,
+    0x40, 0x60, 0x18, 0x0c, 0x04, 0x00, 0x82, 0xdc, 0x40, 0x63, 0x18, 0x05, 0x40, 0x63, 0x00, 0x02,
+    0x14, 0x60, 0x82, 0xdc, 0x48, 0x00, 0x00, 0xd6, 0x9c, 0x04, 0xb4, 0x20, 0x46, 0x00, 0x01, 0x12,
+    0x58, 0x00, 0x0b, 0x97, 0x48, 0x00, 0x00, 0xc5, 0x9c, 0x04, 0xb4, 0x40, 0x46, 0x10, 0x01, 0x12,
+    0x58, 0x10, 0x81, 0x10, 0x92, 0x58, 0xae, 0x88, 0xb4, 0x40, 0x92, 0x50, 0xae, 0x89, 0xb4, 0x40,
+    0x92, 0x48, 0xae, 0x8a, 0xb4, 0x00, 0xae, 0x0b, 0x48, 0x00, 0x00, 0xbc, 0x9c, 0x04, 0xb4, 0x20,
+    0x46, 0x00, 0x01, 0x12, 0x58, 0x00, 0x0b, 0x5c, 0x48, 0x00, 0x00, 0xb3, 0x9c, 0x04, 0xb4, 0x20,
+    0x46, 0x00, 0x01, 0x12, 0x58, 0x00, 0x0b, 0x60, 0x48, 0x00, 0x00, 0xab, 0x46, 0xf0, 0x01, 0x12,
+    0x04, 0x17, 0x82, 0xda, 0x4e, 0x13, 0x00, 0xa6, 0x50, 0x10, 0x00, 0x08, 0xb4, 0x41, 0x46, 0xf0,
+    0x01, 0x12, 0x14, 0x27, 0x82, 0xf3, 0x50, 0x10, 0x00, 0x0c, 0xb4, 0x41, 0x46, 0x10, 0x01, 0x12,
+    0x14, 0x20, 0x82, 0xf4, 0x5c, 0xf1, 0x00, 0x21, 0xe9, 0x05, 0x44, 0x20, 0x00, 0x20, 0x14, 0x20,
+    0x82, 0xf4, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x37, 0x82, 0xf4, 0x46, 0x20, 0x01, 0x1a, 0x58, 0x21,
+    0x0e, 0xa0, 0x84, 0x20, 0xd5, 0x05, 0xb4, 0xa5, 0x38, 0x51, 0x06, 0x0a, 0x96, 0x60, 0x9d, 0x4c,
+    0x95, 0x6a, 0x99, 0x45, 0x9d, 0x09, 0xe2, 0x23, 0xe9, 0xf7, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x17,
+    0x80, 0x48, 0x84, 0x60, 0x46, 0xf0, 0x01, 0x12, 0x10, 0x37, 0x8b, 0xa2, 0xc9, 0x0f, 0x46, 0x10,
+    0x04, 0x10, 0x58, 0x10, 0x88, 0x0c, 0xb4, 0x41, 0x42, 0x21, 0x60, 0x09, 0x42, 0x21, 0x64, 0x09,
+    0xb6, 0x41, 0xb4, 0x41, 0x42, 0x21, 0x60, 0x08, 0xb6, 0x41, 0x46, 0x10, 0x04, 0x11, 0x58, 0x10,
+    0x81, 0x28, 0xb4, 0x41, 0x92, 0x50, 0x40, 0x21, 0x40, 0x08, 0xb6, 0x41, 0x46, 0x40, 0x04, 0x11,
+    0xb4, 0x41, 0x58, 0x21, 0x00, 0x1e, 0xb6, 0x41, 0x46, 0x30, 0x04, 0x10, 0x04, 0x12, 0x00, 0x4b,
+    0x58, 0x10, 0x80, 0x01, 0x14, 0x12, 0x00, 0x4b, 0x44, 0x5f, 0xff, 0x1f, 0x04, 0x41, 0x81, 0x01,
+    0x80, 0x43, 0x40, 0x42, 0x14, 0x02, 0x14, 0x41, 0x81, 0x01, 0x04, 0x31, 0x01, 0x05, 0x80, 0x22,
+    0x14, 0x31, 0x01, 0x05, 0x04, 0x20, 0x81, 0x06, 0x44, 0x32, 0x00, 0x80, 0x40, 0x21, 0x0c, 0x04,
+    0x14, 0x20, 0x81, 0x06, 0x9c, 0x04, 0xb4, 0x20, 0x46, 0x00, 0x01, 0x12, 0x58, 0x00, 0x0b, 0x7c,
+    0xd5, 0x2f, 0x9c, 0x04, 0xb4, 0x20, 0xb4, 0x60, 0x92, 0x38, 0x54, 0x10, 0x80, 0x0f, 0x42, 0x31,
+    0xc0, 0x0b, 0x46, 0x20, 0x01, 0x19, 0x58, 0x21, 0x02, 0xec, 0x38, 0x31, 0x04, 0x08, 0x46, 0x20,
+    0x01, 0x12, 0x58, 0x21, 0x01, 0x34, 0xb4, 0x60, 0x92, 0x68, 0x38, 0x31, 0x04, 0x08, 0xb4, 0x40,
+    0x46, 0x00, 0x01, 0x12, 0x58, 0x00, 0x01, 0x44, 0x38, 0x20, 0x04, 0x08, 0xd5, 0x12, 0x9c, 0x04,
+    0xb4, 0x20, 0x46, 0x00, 0x01, 0x12, 0x58, 0x00, 0x0b, 0x93, 0x54, 0x10, 0x80, 0x0f, 0xae, 0x40,
+    0xd5, 0x08, 0x9c, 0x04, 0xb4, 0x20, 0x46, 0x00, 0x01, 0x12, 0x58, 0x00, 0x0b, 0x64, 0xb6, 0x20,
+    0x84, 0x00, 0x3a, 0x6f, 0x98, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa0, 0xbc, 0xef, 0xf8, 0x46, 0x20,
+    0x01, 0x12, 0x04, 0x31, 0x02, 0xde, 0x80, 0xc1, 0x9c, 0x59, 0x14, 0x11, 0x02, 0xde, 0x84, 0x40,
+    0xa1, 0xf3, 0x81, 0x00, 0x40, 0x13, 0xd0, 0x09, 0xf2, 0x81, 0x54, 0x10, 0x80, 0x7f, 0x84, 0x44,
+    0x84, 0x0b, 0x12, 0x2f, 0x80, 0x02, 0x4c, 0x10, 0x00, 0x71, 0xe4, 0x2c, 0xe8, 0x15, 0x4c, 0x11,
+    0x00, 0x46, 0xe4, 0x25, 0xe8, 0x0a, 0x84, 0xa2, 0x4c, 0x12, 0x80, 0xc5, 0xe4, 0x23, 0xe8, 0x34,
+    0x84, 0xa1, 0xd9, 0x25, 0x48, 0x00, 0x00, 0xa2, 0x84, 0xa9, 0xd1, 0x4c, 0xe4, 0x2a, 0xe8, 0x54,
+    0x84, 0xa8, 0xd9, 0x1d, 0xd5, 0x3d, 0x44, 0x50, 0x00, 0x15, 0x4c, 0x12, 0x80, 0x84, 0xe4, 0x36,
+    0xe8, 0x08, 0x9d, 0x45, 0xd1, 0x17, 0x9d, 0x6c, 0xd1, 0x6b, 0x84, 0xac, 0xd9, 0x10, 0xd5, 0x5f,
+    0x9d, 0x6c, 0x4c, 0x12, 0x80, 0xb1, 0xe4, 0x3a, 0xe8, 0x04, 0x9f, 0x69, 0xd9, 0x08, 0xd5, 0x69,
+    0x9d, 0x6d, 0x4c, 0x12, 0x80, 0x97, 0x9d, 0x69, 0x4c, 0x12, 0x80, 0x8b, 0x84, 0x00, 0x48, 0x00,
+    0x00, 0xb6, 0xa0, 0x32, 0x02, 0x13, 0x00, 0x0c, 0x46, 0xf0, 0x00, 0x83, 0x58, 0xf7, 0x8c, 0x5c,
+    0xdd, 0x2f, 0x48, 0x00, 0x00, 0xac, 0xa0, 0x32, 0x02, 0x13, 0x00, 0x0c, 0x46, 0xf0, 0x00, 0x84,
+    0x58, 0xf7, 0x81, 0xe0, 0xdd, 0x2f, 0x48, 0x00, 0x00, 0xa2, 0xa0, 0x32, 0x02, 0x13, 0x00, 0x0c,
+    0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x87, 0xc4, 0xdd, 0x2f, 0x48, 0x00, 0x00, 0x98, 0xa0, 0x32,
+    0x02, 0x13, 0x00, 0x0c, 0x46, 0xf0, 0x00, 0x83, 0x58, 0xf7, 0x8c, 0xdc, 0xdd, 0x2f, 0x48, 0x00,
+    0x00, 0x8e, 0xa0, 0x32, 0x02, 0x13, 0x00, 0x0c, 0x46, 0xf0, 0x00, 0x83, 0x58, 0xf7, 0x8d, 0x08,
+    0xdd, 0x2f, 0x48, 0x00, 0x00, 0x84, 0xa0, 0x32, 0x02, 0x13, 0x00, 0x0c, 0x46, 0xf0, 0x00, 0x83,
+    0x58, 0xf7, 0x8d, 0x8c, 0xdd, 0x2f, 0xd5, 0x6f, 0xa0, 0x32, 0x50, 0x13, 0x00, 0x18, 0x46, 0xf0,
+    0x00, 0x83, 0x58, 0xf7, 0x8d, 0xc4, 0xdd, 0x2f, 0x02, 0x13, 0x00, 0x0c, 0x02, 0x2f, 0x80, 0x02,
+    0x92, 0x4e, 0x40, 0x21, 0x38, 0x08, 0x54, 0x10, 0xbf, 0xff, 0xd5, 0x64, 0xa0, 0x32, 0x02, 0x13,
+    0x00, 0x0c, 0x46, 0xf0, 0x00, 0x83, 0x58, 0xf7, 0x8d, 0x54, 0xdd, 0x2f, 0xd5, 0x5f, 0xa0, 0x32,
+    0x02, 0x13, 0x00, 0x0c, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x8e, 0x0c, 0xdd, 0x2f, 0xd5, 0x56,
+    0xa0, 0x32, 0x02, 0x13, 0x00, 0x0c, 0x46, 0xf0, 0x00, 0x83, 0x58, 0xf7, 0x8e, 0x58, 0xdd, 0x2f,
+    0xd5, 0x4d, 0x40, 0x23, 0xc0, 0x09, 0x54, 0x21, 0x00, 0x0f, 0x80, 0x3f, 0x80, 0x06, 0x46, 0xf0,
+    0x00, 0x83, 0x58, 0xf7, 0x8e, 0x18, 0xdd, 0x2f, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x27, 0x82, 0xf5,
+    0x9c, 0x94, 0x54, 0x21, 0x3f, 0xff, 0xd5, 0x31, 0xa0, 0x32, 0x02, 0x13, 0x00, 0x0c, 0x50, 0x2f,
+    0x80, 0x04, 0x46, 0xf0, 0x00, 0x83, 0x58, 0xf7, 0x8b, 0xd4, 0xdd, 0x2f, 0xd5, 0x2f, 0xa0, 0x32,
+    0x02, 0x13, 0x00, 0x0c, 0x46, 0xf0, 0x00, 0x8e, 0x58, 0xf7, 0x82, 0x64, 0xdd, 0x2f, 0xd5, 0x26,
+    0xa0, 0x32, 0x02, 0x13, 0x00, 0x0c, 0x46, 0xf0, 0x00, 0x8c, 0x58, 0xf7, 0x80, 0x00, 0xdd, 0x2f,
+    0xd5, 0x12, 0xa0, 0x32, 0x02, 0x13, 0x00, 0x0c, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x8d, 0xf4,
+    0xdd, 0x2f, 0xd5, 0x14, 0xa0, 0x32, 0x02, 0x13, 0x00, 0x0c, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7,
+    0x87, 0x40, 0xdd, 0x2f, 0x54, 0x23, 0xbf, 0xff, 0x02, 0x1f, 0x80, 0x02, 0x92, 0x2e, 0x40, 0x10,
+    0xb8, 0x08, 0x40, 0x10, 0x88, 0x04, 0x12, 0x1f, 0x80, 0x02, 0x46, 0x10, 0x04, 0x00, 0x04, 0x30,
+    0x80, 0x8c, 0x92, 0xf0, 0x42, 0x31, 0xfc, 0x08, 0x54, 0x73, 0x80, 0x0f, 0x14, 0x30, 0x80, 0x8c,
+    0xcf, 0x03, 0x80, 0x07, 0xd5, 0x36, 0x00, 0x1f, 0x80, 0x05, 0x94, 0x04, 0x54, 0x10, 0x80, 0x7f,
+    0x10, 0x1f, 0x80, 0x05, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x27, 0x8b, 0x96, 0x02, 0x1f, 0x80, 0x02,
+    0x54, 0x21, 0x00, 0x03, 0x98, 0x92, 0x40, 0x73, 0x80, 0x04, 0x58, 0x21, 0x00, 0x58, 0x54, 0x30,
+    0xbf, 0xff, 0x10, 0x7f, 0x80, 0x06, 0x10, 0x2f, 0x80, 0x07, 0xe4, 0x68, 0xe8, 0x08, 0x92, 0x2e,
+    0x40, 0x10, 0xb8, 0x08, 0x58, 0x10, 0x80, 0x08, 0x12, 0x1f, 0x80, 0x02, 0x02, 0x0f, 0x80, 0x02,
+    0xf1, 0x01, 0x54, 0x00, 0x3f, 0xff, 0xa8, 0x73, 0x12, 0x03, 0x00, 0x0c, 0x80, 0x26, 0x80, 0x08,
+    0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x84, 0x90, 0xdd, 0x2f, 0x84, 0x20, 0x40, 0x00, 0x80, 0x06,
+    0xec, 0x08, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa4, 0xbc, 0xef, 0xfc, 0x81, 0x00,
+    0x9c, 0x14, 0x80, 0xe2, 0x81, 0x21, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x82, 0x2c, 0xdd, 0x2f,
+    0x80, 0xc0, 0xc8, 0x03, 0x84, 0x01, 0xd5, 0x44, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x17, 0x8b, 0x96,
+    0x5c, 0x33, 0x86, 0x49, 0x44, 0x00, 0x06, 0x48, 0x40, 0x23, 0x8c, 0x1b, 0x40, 0x20, 0x0c, 0x1a,
+    0x54, 0x84, 0x00, 0x0f, 0x54, 0x00, 0x80, 0x03, 0x46, 0x15, 0x80, 0x00, 0x40, 0x84, 0x50, 0x08,
+    0x9d, 0xd4, 0x40, 0x00, 0x64, 0x08, 0x40, 0x84, 0x04, 0x04, 0x54, 0x73, 0xbf, 0xff, 0x40, 0x84,
+    0x00, 0x04, 0xa0, 0x32, 0x40, 0x84, 0x1c, 0x04, 0x80, 0x29, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7,
+    0x83, 0x84, 0xdd, 0x2f, 0x12, 0x73, 0x00, 0x0c, 0x14, 0x83, 0x00, 0x03, 0x46, 0x00, 0x01, 0x1b,
+    0x58, 0x00, 0x05, 0x80, 0x80, 0x26, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x84, 0x90, 0xdd, 0x2f,
+    0x80, 0xe0, 0xc0, 0x03, 0x84, 0x00, 0xd5, 0x0c, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x02, 0x08,
+    0x80, 0x26, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x84, 0x88, 0xdd, 0x2f, 0x80, 0x07, 0xec, 0x04,
+    0x3a, 0x6f, 0xa4, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x84, 0x23, 0x42, 0x00, 0x04, 0x24, 0x84, 0x20,
+    0xd5, 0x08, 0x84, 0x40, 0x92, 0x00, 0x84, 0x67, 0x9c, 0x91, 0x4c, 0x21, 0xff, 0xfd, 0x9c, 0x49,
+    0xe2, 0x20, 0xe9, 0xf8, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xa4, 0xbc, 0xef, 0xfc, 0x46, 0x70,
+    0x04, 0x10, 0x84, 0x21, 0x84, 0xc0, 0x46, 0x90, 0x00, 0x84, 0x58, 0x94, 0x87, 0xc4, 0x04, 0x83,
+    0x82, 0x8c, 0x9d, 0xb1, 0x54, 0x84, 0x00, 0xff, 0x44, 0x00, 0x00, 0x14, 0x4e, 0x82, 0x00, 0x0a,
+    0x4b, 0xe0, 0x24, 0x01, 0x44, 0x00, 0x00, 0x64, 0x84, 0x20, 0x4c, 0x60, 0x7f, 0xf2, 0xd5, 0x2f,
+    0xc1, 0x2e, 0x46, 0x60, 0x04, 0x10, 0x84, 0x21, 0x46, 0x90, 0x00, 0x84, 0x58, 0x94, 0x87, 0xc4,
+    0x04, 0x73, 0x01, 0x0e, 0x8d, 0x01, 0x44, 0x00, 0x00, 0x32, 0xc7, 0x09, 0x4b, 0xe0, 0x24, 0x01,
+    0x44, 0x00, 0x01, 0xf4, 0x84, 0x20, 0x4c, 0x80, 0x7f, 0xf5, 0xd5, 0x19, 0xc1, 0x18, 0x46, 0x60,
+    0x04, 0x11, 0x84, 0x21, 0x46, 0x80, 0x00, 0x84, 0x58, 0x84, 0x07, 0xc4, 0x04, 0x23, 0x00, 0x80,
+    0x9d, 0xf9, 0x96, 0x94, 0x44, 0x00, 0x00, 0x32, 0xc2, 0x08, 0x4b, 0xe0, 0x20, 0x01, 0x44, 0x00,
+    0x00, 0x64, 0x84, 0x20, 0x4c, 0x70, 0x7f, 0xf4, 0x80, 0x01, 0xd5, 0x02, 0x84, 0x00, 0xec, 0x04,
+    0x3a, 0x6f, 0xa4, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x46, 0x00, 0x04, 0x11, 0x58, 0x00, 0x00, 0x04,
+    0xb4, 0x20, 0x58, 0x10, 0x80, 0x0c, 0xb6, 0x20, 0xb4, 0x00, 0xdd, 0x9e, 0x3a, 0x6f, 0x9c, 0x3c,
+    0x46, 0x10, 0x01, 0x1a, 0x58, 0x10, 0x8e, 0x3c, 0xa6, 0x08, 0xc0, 0x1b, 0x84, 0x00, 0xa6, 0x88,
+    0x9c, 0x4d, 0xc2, 0x11, 0x46, 0x70, 0x04, 0x1c, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x67, 0x80, 0x4b,
+    0x58, 0x73, 0x80, 0x43, 0x9d, 0x41, 0x99, 0x07, 0x4c, 0x61, 0x00, 0x06, 0x96, 0x28, 0xae, 0xa0,
+    0xe6, 0x03, 0xe8, 0x07, 0x46, 0x20, 0x01, 0x1a, 0x58, 0x21, 0x0e, 0x6e, 0x4c, 0x11, 0x7f, 0xe9,
+    0x3a, 0x6f, 0x9c, 0x04, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xfc, 0x46, 0x70,
+    0x00, 0x5a, 0x58, 0x73, 0x83, 0xc4, 0x84, 0x20, 0x84, 0x45, 0x46, 0x00, 0x01, 0x1c, 0x58, 0x00,
+    0x00, 0x48, 0x4b, 0xe0, 0x1c, 0x01, 0x46, 0x60, 0x00, 0x80, 0x58, 0x63, 0x0c, 0x80, 0x46, 0x00,
+    0x01, 0x1b, 0x58, 0x00, 0x05, 0x68, 0x46, 0x10, 0x00, 0x84, 0x58, 0x10, 0x8e, 0xac, 0x84, 0x40,
+    0x4b, 0xe0, 0x18, 0x01, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0e, 0x70, 0x46, 0x10, 0x00, 0x84,
+    0x58, 0x10, 0x8c, 0x90, 0x84, 0x40, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00,
+    0x0e, 0x88, 0x46, 0x10, 0x00, 0x84, 0x58, 0x10, 0x8b, 0x18, 0x84, 0x40, 0x4b, 0xe0, 0x18, 0x01,
+    0x84, 0x80, 0x46, 0xf0, 0x01, 0x1c, 0x10, 0x47, 0x80, 0x48, 0x46, 0xf0, 0x01, 0x1c, 0x10, 0x47,
+    0x80, 0x4d, 0x84, 0x20, 0x44, 0x20, 0x06, 0x48, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0f, 0x20,
+    0x4b, 0xe0, 0x1c, 0x01, 0xec, 0x04, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa0, 0xbc,
+    0x84, 0x20, 0x80, 0xc0, 0x44, 0x20, 0x06, 0x48, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0f, 0x20,
+    0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0xc4, 0xdd, 0x2f, 0x9c, 0x34, 0xa6, 0x83, 0xa6, 0x02,
+    0x54, 0x21, 0x00, 0x3f, 0x40, 0x21, 0x20, 0x08, 0x40, 0x21, 0x00, 0x04, 0x46, 0xf0, 0x01, 0x12,
+    0x14, 0x27, 0x82, 0xf5, 0x50, 0x73, 0x00, 0x20, 0xa6, 0x31, 0x54, 0x10, 0x00, 0x40, 0xc1, 0x2b,
+    0xa6, 0xf8, 0x44, 0x10, 0x00, 0x1a, 0x92, 0x64, 0x54, 0x31, 0x80, 0x08, 0x9e, 0x8a, 0x54, 0x00,
+    0x00, 0x10, 0x40, 0x61, 0x0c, 0x1a, 0x40, 0x60, 0x8c, 0x1b, 0xc0, 0x02, 0x9d, 0xb4, 0x80, 0x27,
+    0x80, 0x46, 0x46, 0x80, 0x00, 0x5a, 0x58, 0x84, 0x03, 0x84, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00,
+    0x0f, 0x20, 0x4b, 0xe0, 0x20, 0x01, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x27, 0x82, 0xf5, 0x9c, 0x72,
+    0x46, 0x30, 0x01, 0x1a, 0x58, 0x31, 0x8f, 0x20, 0x98, 0x79, 0x9a, 0x96, 0x98, 0x33, 0x4b, 0xe0,
+    0x20, 0x01, 0xd5, 0x0b, 0x80, 0x27, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0f, 0x20, 0x46, 0xf0,
+    0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84, 0xdd, 0x2f, 0x46, 0x10, 0x01, 0x12, 0x04, 0x00, 0x82, 0xf5,
+    0x9c, 0x81, 0x14, 0x20, 0x82, 0xf5, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x27, 0x80, 0x4b, 0x46, 0x10,
+    0x01, 0x1a, 0x58, 0x10, 0x8f, 0x20, 0x38, 0x20, 0x80, 0x08, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0xa0, 0xbc, 0xa6, 0xc3, 0xa6, 0x42, 0x80, 0xc0, 0x40, 0x31, 0xe0, 0x08, 0xa6, 0x00,
+    0xa6, 0xb1, 0x40, 0x10, 0xc0, 0x08, 0x40, 0x11, 0x84, 0x04, 0x40, 0x10, 0x80, 0x04, 0x40, 0x21,
+    0x20, 0x08, 0x46, 0x00, 0x04, 0x11, 0x40, 0x10, 0x88, 0x04, 0x14, 0x10, 0x02, 0x02, 0xa6, 0x75,
+    0xa6, 0xb4, 0x40, 0x10, 0xa0, 0x08, 0x40, 0x10, 0x88, 0x04, 0x14, 0x10, 0x02, 0x03, 0x44, 0x20,
+    0x1f, 0x40, 0x84, 0x00, 0x84, 0x21, 0x46, 0xf0, 0x00, 0x82, 0x58, 0xf7, 0x89, 0xcc, 0xdd, 0x2f,
+    0x46, 0x00, 0x04, 0x1d, 0x80, 0x26, 0x84, 0x46, 0x46, 0x60, 0x00, 0x5a, 0x58, 0x63, 0x03, 0x84,
+    0x58, 0x00, 0x04, 0x18, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x00, 0x04, 0x1d, 0x46, 0x10, 0x01, 0x19,
+    0x58, 0x10, 0x80, 0xa4, 0x84, 0x46, 0x58, 0x00, 0x04, 0x1e, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x00,
+    0x04, 0x1d, 0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x80, 0xa4, 0x58, 0x00, 0x04, 0x24, 0x84, 0x46,
+    0x4b, 0xe0, 0x18, 0x01, 0x46, 0x00, 0x04, 0x10, 0x58, 0x00, 0x04, 0x10, 0xb4, 0x20, 0x81, 0x00,
+    0x58, 0x10, 0x81, 0x00, 0xb6, 0x20, 0x84, 0xc0, 0x46, 0x70, 0x00, 0x02, 0x58, 0x73, 0x87, 0x50,
+    0xb4, 0x28, 0x9d, 0xb1, 0x54, 0x10, 0x81, 0x00, 0x84, 0x01, 0xc1, 0x06, 0x4b, 0xe0, 0x1c, 0x01,
+    0x44, 0x50, 0x01, 0x5e, 0xde, 0xf6, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa0, 0xbc,
+    0xef, 0xf8, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x17, 0x8b, 0x99, 0x84, 0x41, 0x46, 0x00, 0x01, 0x12,
+    0x14, 0x20, 0x02, 0xe1, 0x4e, 0x13, 0x00, 0xac, 0x14, 0x10, 0x02, 0xe1, 0x46, 0x60, 0x04, 0x11,
+    0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x8f, 0x9c, 0xdd, 0x2f, 0x44, 0x00, 0x06, 0x40, 0x04, 0x13,
+    0x00, 0x50, 0x46, 0xf0, 0x00, 0x02, 0x58, 0xf7, 0x87, 0x50, 0xdd, 0x2f, 0x04, 0x63, 0x00, 0x50,
+    0xc6, 0x0a, 0x44, 0x00, 0x00, 0x64, 0x42, 0x63, 0x00, 0x24, 0x44, 0x00, 0xc8, 0x00, 0x40, 0x63,
+    0x00, 0x17, 0x97, 0xb0, 0x46, 0x10, 0x01, 0x1b, 0x58, 0x10, 0x85, 0x80, 0x00, 0x20, 0x8a, 0xcc,
+    0x84, 0x09, 0x42, 0x21, 0x00, 0x24, 0x84, 0x0a, 0x40, 0x21, 0x00, 0x76, 0x40, 0x03, 0x00, 0x77,
+    0x98, 0x02, 0x96, 0x00, 0x10, 0x00, 0x8a, 0xcc, 0xe6, 0x1f, 0xe9, 0x5c, 0x46, 0x00, 0x01, 0x1a,
+    0x58, 0x00, 0x0e, 0x3c, 0xa6, 0x80, 0xc2, 0x56, 0x84, 0x60, 0x10, 0x30, 0x8a, 0xcc, 0x00, 0x30,
+    0x8a, 0xcb, 0xa6, 0x40, 0x9c, 0x05, 0xc1, 0x06, 0x46, 0xf0, 0x01, 0x1c, 0x10, 0x17, 0x80, 0x4b,
+    0xd5, 0x06, 0x46, 0x50, 0x01, 0x1a, 0x58, 0x52, 0x8e, 0x6e, 0xd8, 0xf4, 0x46, 0xf0, 0x01, 0x1c,
+    0x00, 0x57, 0x80, 0x4b, 0xdb, 0x05, 0x46, 0xf0, 0x01, 0x1c, 0x10, 0x27, 0x80, 0x4b, 0x46, 0xf0,
+    0x01, 0x1c, 0x00, 0x07, 0x80, 0x4b, 0xe6, 0x0f, 0xe8, 0x03, 0x84, 0x60, 0xd5, 0x09, 0x5c, 0x40,
+    0x00, 0x64, 0x84, 0x22, 0x84, 0x41, 0x40, 0x31, 0x10, 0x1b, 0x40, 0x30, 0x90, 0x1a, 0x84, 0x21,
+    0x84, 0x40, 0x46, 0xf0, 0x00, 0x84, 0x58, 0xf7, 0x80, 0x18, 0xdd, 0x2f, 0x46, 0x70, 0x00, 0x5a,
+    0x58, 0x73, 0x83, 0x84, 0x46, 0x10, 0x01, 0x1a, 0x58, 0x10, 0x8e, 0x3c, 0x84, 0x45, 0x80, 0x1f,
+    0x4b, 0xe0, 0x1c, 0x01, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0e, 0x3c, 0x9c, 0x45, 0x44, 0x20,
+    0x00, 0x2d, 0x4b, 0xe0, 0x1c, 0x01, 0x80, 0x3f, 0x84, 0x45, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00,
+    0x0e, 0x69, 0x81, 0x1f, 0x4b, 0xe0, 0x1c, 0x01, 0x46, 0xf0, 0x00, 0x84, 0x58, 0xf7, 0x88, 0x98,
+    0xdd, 0x2f, 0x46, 0x00, 0x04, 0x1c, 0x58, 0x00, 0x00, 0x49, 0xaf, 0x80, 0x44, 0x14, 0xb7, 0x08,
+    0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0e, 0x88, 0x46, 0x60, 0x00, 0x80, 0x58, 0x63, 0x0e, 0xa8,
+    0x4b, 0xe0, 0x18, 0x01, 0x84, 0x60, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x37, 0x82, 0xf6, 0x46, 0x00,
+    0x01, 0x1b, 0x58, 0x00, 0x05, 0x68, 0x84, 0x21, 0x4b, 0xe0, 0x18, 0x01, 0xec, 0x08, 0x3a, 0x6f,
+    0xa0, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x98, 0xbc, 0xef, 0x70, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x47,
+    0x8b, 0x99, 0x46, 0x30, 0x01, 0x12, 0x84, 0x41, 0x14, 0x21, 0x82, 0xe0, 0xcc, 0x36, 0x46, 0xf0,
+    0x01, 0x12, 0x04, 0x07, 0x82, 0xf4, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x67, 0x80, 0x4b, 0x95, 0x42,
+    0x14, 0x41, 0x82, 0xe0, 0x46, 0x10, 0x01, 0x1a, 0x58, 0x10, 0x8e, 0xa0, 0x84, 0x67, 0xb6, 0x7f,
+    0xf2, 0x81, 0xf6, 0x82, 0xf0, 0x83, 0x98, 0xe9, 0x50, 0x2f, 0x80, 0x10, 0xd5, 0x03, 0xa3, 0x09,
+    0xab, 0x11, 0x4c, 0x11, 0xff, 0xfe, 0x9c, 0x04, 0x94, 0x42, 0x44, 0x00, 0xff, 0xfc, 0x40, 0x10,
+    0x80, 0x02, 0x80, 0x1f, 0x46, 0xf0, 0x00, 0x84, 0x58, 0xf7, 0x81, 0xe0, 0xdd, 0x2f, 0x46, 0x10,
+    0x00, 0xdb, 0x58, 0x10, 0x8b, 0xa0, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0e, 0x70, 0x46, 0xf0,
+    0x00, 0x80, 0x58, 0xf7, 0x8e, 0xa8, 0xdd, 0x2f, 0xec, 0x90, 0x3a, 0x6f, 0x98, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xf4, 0x46, 0xf0, 0x00, 0x84, 0x58, 0xf7, 0x87, 0xe4, 0xdd, 0x2f,
+    0x84, 0xa1, 0xd8, 0x07, 0x46, 0x00, 0x04, 0x11, 0xa0, 0x41, 0x42, 0x10, 0x88, 0x09, 0xa8, 0x41,
+    0x46, 0x00, 0x04, 0x11, 0xa0, 0xc1, 0x80, 0x20, 0x46, 0x20, 0x00, 0x92, 0x42, 0x31, 0x8c, 0x09,
+    0x58, 0x21, 0x0b, 0x00, 0xa8, 0xc1, 0x81, 0x00, 0x46, 0x70, 0x04, 0x12, 0x14, 0x20, 0x80, 0xd1,
+    0x84, 0xc0, 0x46, 0x90, 0x00, 0x02, 0x58, 0x94, 0x87, 0x50, 0x05, 0xc4, 0x00, 0x80, 0x84, 0x01,
+    0x99, 0xb0, 0x04, 0xa3, 0x80, 0x4c, 0x4b, 0xe0, 0x24, 0x01, 0x54, 0x0e, 0x00, 0x01, 0xc8, 0x03,
+    0x4e, 0xa2, 0x00, 0x05, 0x44, 0x50, 0x01, 0x2c, 0xde, 0xf1, 0x44, 0x20, 0x00, 0x30, 0x50, 0x0f,
+    0x80, 0x04, 0x84, 0x24, 0xf2, 0x81, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x8e, 0x0c, 0xdd, 0x2f,
+    0xec, 0x0c, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xfc, 0x46, 0xf0,
+    0x01, 0x12, 0x00, 0x17, 0x8b, 0xa3, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x03, 0x58, 0xf7, 0x81, 0x20,
+    0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x8b, 0x88, 0xdd, 0x2f, 0x46, 0xf0, 0x01, 0x1c,
+    0x00, 0x17, 0x80, 0x4d, 0xc9, 0x1b, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x07, 0x80, 0x4b, 0x5c, 0xf0,
+    0x00, 0x64, 0xe8, 0x0d, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x07, 0x82, 0xe0, 0xc8, 0x08, 0x84, 0x21,
+    0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x8c, 0xe4, 0xdd, 0x2f, 0xd5, 0x12, 0x46, 0x60, 0x00, 0x85,
+    0x58, 0x63, 0x0c, 0xe4, 0x84, 0x00, 0x84, 0x21, 0xd5, 0x07, 0x84, 0x00, 0x84, 0x21, 0x46, 0x60,
+    0x00, 0x85, 0x58, 0x63, 0x0c, 0xe4, 0xdd, 0x26, 0x84, 0x01, 0x80, 0x20, 0xdd, 0x26, 0x46, 0xf0,
+    0x01, 0x00, 0x04, 0x27, 0x80, 0x51, 0x84, 0x21, 0x84, 0x03, 0xdd, 0x22, 0x84, 0x20, 0x46, 0xf0,
+    0x01, 0x12, 0x10, 0x17, 0x8b, 0x99, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x89, 0xfc, 0xdd, 0x2f,
+    0x84, 0x02, 0x46, 0xf0, 0x00, 0x02, 0x58, 0xf7, 0x87, 0x50, 0xdd, 0x2f, 0x46, 0xf0, 0x01, 0x1c,
+    0x00, 0x07, 0x80, 0x4b, 0xe6, 0x0f, 0xe8, 0x03, 0x84, 0x60, 0xd5, 0x09, 0x5c, 0x40, 0x00, 0x64,
+    0x84, 0x22, 0x84, 0x41, 0x40, 0x31, 0x10, 0x1b, 0x40, 0x30, 0x90, 0x1a, 0x84, 0x40, 0x84, 0x21,
+    0x46, 0xf0, 0x00, 0x84, 0x58, 0xf7, 0x80, 0x18, 0xdd, 0x2f, 0x46, 0x60, 0x04, 0x10, 0x80, 0x26,
+    0x46, 0x00, 0x60, 0x00, 0x84, 0xe0, 0x14, 0x70, 0x81, 0x43, 0x14, 0x03, 0x01, 0x41, 0x84, 0x05,
+    0x46, 0xf0, 0x00, 0x02, 0x58, 0xf7, 0x87, 0x50, 0xdd, 0x2f, 0x46, 0x00, 0x04, 0x11, 0x84, 0x2c,
+    0x14, 0x73, 0x01, 0x41, 0xa8, 0x41, 0xec, 0x04, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x92, 0x00,
+    0x3a, 0x6f, 0xa0, 0xbc, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x57, 0x80, 0x4d, 0x84, 0x21, 0x4c, 0x50,
+    0x80, 0xda, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x57, 0x82, 0xe2, 0xd9, 0x6e, 0x84, 0x00, 0x46, 0xf0,
+    0x00, 0x84, 0x58, 0xf7, 0x8d, 0xa4, 0xdd, 0x2f, 0x46, 0x00, 0x04, 0x11, 0x04, 0x20, 0x00, 0x83,
+    0x42, 0x21, 0x00, 0x09, 0x14, 0x20, 0x00, 0x83, 0x46, 0x10, 0x04, 0x00, 0x04, 0x20, 0x80, 0x4c,
+    0x42, 0x21, 0x4c, 0x09, 0x14, 0x20, 0x80, 0x4c, 0x04, 0x10, 0x00, 0x45, 0x80, 0xe0, 0x42, 0x10,
+    0xd0, 0x08, 0x14, 0x10, 0x00, 0x45, 0x84, 0xc0, 0x46, 0x80, 0x00, 0x02, 0x58, 0x84, 0x07, 0x50,
+    0x04, 0x13, 0x81, 0xc3, 0x9d, 0xb1, 0x84, 0x0a, 0xc9, 0x06, 0x4b, 0xe0, 0x20, 0x01, 0x44, 0x50,
+    0x00, 0xa0, 0xde, 0xf7, 0x84, 0x20, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x17, 0x82, 0xe2, 0x46, 0xf0,
+    0x01, 0x12, 0x04, 0x07, 0x82, 0xe0, 0xc8, 0x22, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x07, 0x82, 0xe1,
+    0xc8, 0x28, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x07, 0x80, 0x4b, 0x5c, 0xf0, 0x00, 0x64, 0xe8, 0x08,
+    0x46, 0x00, 0x04, 0x00, 0x58, 0x00, 0x04, 0x20, 0x44, 0x10, 0x04, 0x92, 0xd5, 0x07, 0x46, 0x00,
+    0x04, 0x00, 0x58, 0x00, 0x04, 0x20, 0x44, 0x10, 0x03, 0xb2, 0xb6, 0x20, 0x46, 0x00, 0x04, 0x00,
+    0x44, 0x10, 0x00, 0xa8, 0x14, 0x10, 0x01, 0x0a, 0xd5, 0x7d, 0x46, 0x10, 0x04, 0x10, 0x04, 0x20,
+    0x81, 0x05, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0e, 0x70, 0x14, 0x20, 0x81, 0x05, 0xd5, 0x05,
+    0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0e, 0x88, 0x84, 0x21, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7,
+    0x8e, 0xa8, 0xdd, 0x2f, 0xd5, 0x67, 0x46, 0x00, 0x04, 0x11, 0x04, 0x10, 0x00, 0xd0, 0x42, 0x10,
+    0xd0, 0x09, 0x14, 0x10, 0x00, 0xd0, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x67, 0x82, 0xf6, 0xce, 0x23,
+    0x46, 0x00, 0x04, 0x11, 0x46, 0x10, 0x04, 0x11, 0x58, 0x00, 0x07, 0x0c, 0xb4, 0x40, 0x04, 0x20,
+    0x80, 0x45, 0x81, 0x00, 0x42, 0x21, 0x50, 0x08, 0x14, 0x20, 0x80, 0x45, 0x46, 0x70, 0x00, 0x02,
+    0x58, 0x73, 0x87, 0x50, 0xb4, 0x28, 0x9d, 0xb1, 0x84, 0x0a, 0xc9, 0x06, 0x4b, 0xe0, 0x1c, 0x01,
+    0x44, 0x50, 0x00, 0x14, 0xde, 0xf8, 0x46, 0x00, 0x01, 0x12, 0x04, 0x10, 0x02, 0xf6, 0x9c, 0x49,
+    0x14, 0x10, 0x02, 0xf6, 0x46, 0x00, 0x04, 0x00, 0x04, 0x20, 0x00, 0x4c, 0x46, 0x10, 0x04, 0x11,
+    0x42, 0x21, 0x4c, 0x08, 0x14, 0x20, 0x00, 0x4c, 0x04, 0x20, 0x80, 0x83, 0x46, 0x00, 0x04, 0x10,
+    0x58, 0x21, 0x00, 0x01, 0x14, 0x20, 0x80, 0x83, 0x04, 0x20, 0x01, 0x05, 0x14, 0x20, 0x01, 0x05,
+    0x04, 0x60, 0x80, 0x49, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x84, 0x58, 0xf7, 0x8d, 0x1c, 0xdd, 0x2f,
+    0x95, 0xb6, 0x84, 0x21, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x17, 0x82, 0xe2, 0x46, 0x20, 0x00, 0x80,
+    0x58, 0x21, 0x0e, 0xa8, 0x5c, 0xf3, 0x1d, 0xed, 0xe9, 0x07, 0x50, 0x63, 0x62, 0x14, 0x44, 0x00,
+    0x03, 0xe8, 0x40, 0x13, 0x00, 0xd7, 0x46, 0x00, 0x01, 0x1b, 0x58, 0x00, 0x05, 0x68, 0x4b, 0xe0,
+    0x08, 0x01, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e, 0x84, 0xa1, 0xd0, 0x0a, 0xc0, 0x06, 0x84, 0xa2,
+    0xd0, 0x0c, 0x84, 0xa3, 0xd8, 0x24, 0xd5, 0x0e, 0x46, 0x00, 0x04, 0x20, 0xd5, 0x0f, 0x46, 0x00,
+    0x04, 0x20, 0x58, 0x00, 0x00, 0x10, 0xd5, 0x0a, 0x46, 0x00, 0x04, 0x20, 0x58, 0x00, 0x00, 0x20,
+    0xd5, 0x05, 0x46, 0x00, 0x04, 0x20, 0x58, 0x00, 0x00, 0x30, 0xa0, 0x82, 0xe2, 0x41, 0xe8, 0x02,
+    0xa8, 0x42, 0xa0, 0x83, 0xe2, 0x22, 0xe8, 0x02, 0xa8, 0x43, 0xb4, 0x20, 0xa0, 0x81, 0x9c, 0x49,
+    0x42, 0x20, 0x88, 0x24, 0xb6, 0x20, 0x40, 0x11, 0x04, 0x57, 0xa8, 0x41, 0xdd, 0x9e, 0x92, 0x00,
+    0x46, 0x10, 0x04, 0x20, 0x96, 0x00, 0x50, 0x20, 0x00, 0x10, 0x38, 0x30, 0x8a, 0x02, 0x50, 0x00,
+    0x02, 0x30, 0x9c, 0xd9, 0x38, 0x30, 0x8a, 0x0a, 0x38, 0x20, 0x82, 0x02, 0x50, 0x21, 0x00, 0x2e,
+    0x38, 0x20, 0x82, 0x0a, 0xdd, 0x9e, 0x92, 0x00, 0x46, 0x20, 0x04, 0x20, 0x96, 0x00, 0x50, 0x30,
+    0x02, 0x40, 0x38, 0x41, 0x0e, 0x02, 0x50, 0x00, 0x02, 0x90, 0x98, 0x61, 0x38, 0x11, 0x0e, 0x0a,
+    0x38, 0x11, 0x02, 0x02, 0x9c, 0x49, 0x38, 0x11, 0x02, 0x0a, 0xdd, 0x9e, 0x96, 0x48, 0x96, 0x00,
+    0xe6, 0x30, 0xe8, 0x20, 0x84, 0xa1, 0xd8, 0x06, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x81, 0xb0,
+    0xd5, 0x14, 0xc8, 0x06, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x81, 0xc0, 0xd5, 0x0e, 0x84, 0xa2,
+    0xd8, 0x06, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x81, 0xd0, 0xd5, 0x07, 0x84, 0xa3, 0xd8, 0x0a,
+    0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x81, 0xe0, 0x38, 0x20, 0x06, 0x02, 0x9c, 0x91, 0x38, 0x20,
+    0x06, 0x0a, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xfc, 0x46, 0x40, 0x01, 0x12, 0x04, 0xa2,
+    0x02, 0xf7, 0x46, 0x30, 0x04, 0x11, 0x96, 0x01, 0x05, 0xc1, 0x80, 0x47, 0x50, 0x75, 0x00, 0x01,
+    0x40, 0x30, 0x40, 0x08, 0x96, 0x49, 0x9d, 0xb9, 0x40, 0x11, 0x84, 0x04, 0x46, 0x30, 0x04, 0x25,
+    0x58, 0x31, 0x88, 0x00, 0x9d, 0x71, 0x40, 0xa5, 0x08, 0x08, 0x95, 0xfa, 0x50, 0x92, 0x80, 0x01,
+    0x89, 0x43, 0x99, 0xfb, 0x95, 0xb2, 0x95, 0x6a, 0x45, 0xe0, 0xff, 0x00, 0x15, 0xc5, 0x00, 0x00,
+    0x99, 0xb3, 0xb6, 0x27, 0x99, 0x6b, 0x54, 0x94, 0x81, 0xff, 0x84, 0x60, 0x40, 0x80, 0x78, 0x02,
+    0x44, 0x10, 0x02, 0x00, 0xb6, 0x66, 0xb6, 0x65, 0x14, 0x92, 0x02, 0xf7, 0x4c, 0x80, 0xc0, 0x0e,
+    0x96, 0x00, 0x84, 0xa1, 0xd8, 0x0a, 0x40, 0x11, 0x40, 0x09, 0x96, 0x10, 0x96, 0x48, 0x46, 0xf0,
+    0x00, 0x85, 0x58, 0xf7, 0x81, 0x18, 0xdd, 0x2f, 0xec, 0x04, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e,
+    0x96, 0x00, 0x96, 0x48, 0xc8, 0x06, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x81, 0x30, 0xd5, 0x31,
+    0x84, 0xa1, 0xd8, 0x06, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x81, 0x40, 0xd5, 0x2a, 0x84, 0xa2,
+    0xd8, 0x06, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x81, 0x50, 0xd5, 0x23, 0x84, 0xa3, 0xd8, 0x06,
+    0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x81, 0x60, 0xd5, 0x1c, 0x84, 0xa4, 0xd8, 0x06, 0x46, 0x00,
+    0x04, 0x20, 0x50, 0x10, 0x81, 0x70, 0xd5, 0x15, 0x84, 0xa5, 0xd8, 0x06, 0x46, 0x00, 0x04, 0x20,
+    0x50, 0x10, 0x81, 0x80, 0xd5, 0x0e, 0x84, 0xa6, 0xd8, 0x06, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10,
+    0x81, 0x90, 0xd5, 0x07, 0x84, 0xa7, 0xd8, 0x0a, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x81, 0xa0,
+    0x38, 0x20, 0x06, 0x02, 0x9c, 0x91, 0x38, 0x20, 0x06, 0x0a, 0xdd, 0x9e, 0x96, 0x00, 0x84, 0x46,
+    0x9e, 0x01, 0x42, 0x00, 0x08, 0x24, 0x46, 0x20, 0x01, 0x1a, 0x58, 0x21, 0x02, 0x48, 0x98, 0x02,
+    0xa6, 0x00, 0x84, 0x41, 0x96, 0x48, 0x4c, 0x01, 0x40, 0x07, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10,
+    0x80, 0x60, 0xd5, 0x14, 0xc8, 0x06, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x80, 0x70, 0xd5, 0x0e,
+    0x84, 0xa2, 0xd8, 0x06, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x80, 0x80, 0xd5, 0x07, 0x84, 0xa3,
+    0xd8, 0x0a, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x80, 0x90, 0x38, 0x20, 0x06, 0x02, 0x9c, 0x91,
+    0x38, 0x20, 0x06, 0x0a, 0xdd, 0x9e, 0x92, 0x00, 0x96, 0x00, 0x84, 0x46, 0x9e, 0x01, 0x42, 0x00,
+    0x08, 0x24, 0x46, 0x20, 0x01, 0x1a, 0x58, 0x21, 0x02, 0x48, 0x98, 0x02, 0xa6, 0x00, 0x84, 0x41,
+    0x96, 0x48, 0x4c, 0x01, 0x40, 0x07, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x80, 0x20, 0xd5, 0x14,
+    0xc8, 0x06, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x80, 0x30, 0xd5, 0x0e, 0x84, 0xa2, 0xd8, 0x06,
+    0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x80, 0x40, 0xd5, 0x07, 0x84, 0xa3, 0xd8, 0x0a, 0x46, 0x00,
+    0x04, 0x20, 0x50, 0x10, 0x80, 0x50, 0x38, 0x20, 0x06, 0x02, 0x9c, 0x91, 0x38, 0x20, 0x06, 0x0a,
+    0xdd, 0x9e, 0x92, 0x00, 0x84, 0x61, 0x96, 0x00, 0x96, 0x48, 0x96, 0x91, 0x4c, 0x01, 0xc0, 0x0b,
+    0x46, 0x00, 0x04, 0x20, 0x50, 0x30, 0x80, 0xa0, 0x38, 0x40, 0x0e, 0x02, 0x50, 0x10, 0x82, 0xa0,
+    0xd5, 0x16, 0x84, 0xa2, 0xd8, 0x0a, 0x46, 0x00, 0x04, 0x20, 0x50, 0x30, 0x80, 0xb0, 0x38, 0x40,
+    0x0e, 0x02, 0x50, 0x10, 0x82, 0xb0, 0xd5, 0x0b, 0xe6, 0x03, 0xe9, 0x11, 0x46, 0x00, 0x04, 0x20,
+    0x50, 0x30, 0x80, 0xc0, 0x38, 0x40, 0x0e, 0x02, 0x50, 0x10, 0x82, 0xc0, 0x9d, 0x21, 0x38, 0x40,
+    0x0e, 0x0a, 0x38, 0x30, 0x06, 0x02, 0x98, 0x93, 0x38, 0x20, 0x06, 0x0a, 0xdd, 0x9e, 0x92, 0x00,
+    0x96, 0x00, 0x84, 0x46, 0x9e, 0x01, 0x42, 0x00, 0x08, 0x24, 0x46, 0x20, 0x01, 0x1a, 0x58, 0x21,
+    0x02, 0x48, 0x98, 0x02, 0xa6, 0x00, 0x84, 0x41, 0x96, 0x48, 0x4c, 0x01, 0x40, 0x07, 0x46, 0x00,
+    0x04, 0x20, 0x50, 0x10, 0x80, 0xf0, 0xd5, 0x14, 0xc8, 0x06, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10,
+    0x81, 0x00, 0xd5, 0x0e, 0x84, 0xa2, 0xd8, 0x06, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x81, 0x10,
+    0xd5, 0x07, 0x84, 0xa3, 0xd8, 0x0a, 0x46, 0x00, 0x04, 0x20, 0x50, 0x10, 0x81, 0x20, 0x38, 0x20,
+    0x06, 0x02, 0x9c, 0x91, 0x38, 0x20, 0x06, 0x0a, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x98, 0xbc,
+    0x50, 0x60, 0x00, 0x14, 0x00, 0x23, 0x7f, 0xff, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x33, 0x7f, 0xfe,
+    0x40, 0x40, 0x40, 0x08, 0x40, 0x21, 0x20, 0x08, 0x40, 0x22, 0x08, 0x04, 0x40, 0x21, 0x0c, 0x04,
+    0x46, 0x30, 0x04, 0x23, 0x94, 0x06, 0x58, 0x31, 0x87, 0xc0, 0x98, 0x03, 0xb6, 0x40, 0x96, 0x48,
+    0x84, 0xa2, 0xd1, 0x1e, 0xe6, 0x23, 0xe8, 0x04, 0x84, 0xa1, 0xd9, 0x5c, 0xd5, 0x06, 0x84, 0xa3,
+    0xd1, 0x21, 0x84, 0xa4, 0xd9, 0x57, 0xd5, 0x2f, 0xa6, 0xb7, 0x46, 0x00, 0x04, 0x11, 0x04, 0x10,
+    0x00, 0x47, 0x94, 0x16, 0x80, 0x43, 0x98, 0x02, 0xa8, 0x41, 0x84, 0x20, 0xa6, 0x37, 0xb4, 0x66,
+    0x94, 0x06, 0x98, 0x02, 0xa8, 0xc2, 0xa6, 0x37, 0x94, 0x06, 0x98, 0x02, 0xd5, 0x09, 0xa6, 0xb7,
+    0x46, 0x00, 0x04, 0x11, 0x04, 0x10, 0x00, 0x47, 0x94, 0x16, 0x80, 0x43, 0x98, 0x02, 0xa8, 0x43,
+    0xd5, 0x39, 0xa6, 0xf7, 0x46, 0x00, 0x04, 0x11, 0x04, 0x20, 0x00, 0x47, 0x94, 0x1e, 0x46, 0x30,
+    0x04, 0x23, 0x58, 0x31, 0x87, 0xc0, 0x98, 0x03, 0xa8, 0x83, 0xa6, 0x37, 0x94, 0x06, 0x98, 0x03,
+    0xa8, 0x44, 0xd5, 0x28, 0xa6, 0x37, 0x80, 0x43, 0x94, 0x46, 0x98, 0x4a, 0xa0, 0xca, 0xa0, 0x8b,
+    0xe2, 0x62, 0xe9, 0x08, 0x46, 0x10, 0x0f, 0xff, 0x9a, 0x9a, 0x58, 0x10, 0x8f, 0xff, 0xe2, 0x22,
+    0xe8, 0x08, 0x00, 0x13, 0x7f, 0xff, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x83, 0x7c, 0xdd, 0x2f,
+    0xa6, 0xb7, 0x46, 0x30, 0x04, 0x23, 0x58, 0x31, 0x87, 0xc0, 0x94, 0x96, 0x98, 0x93, 0xa0, 0xd3,
+    0xa0, 0x51, 0x00, 0x03, 0x7f, 0xfe, 0x9a, 0x59, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x80, 0x74,
+    0xdd, 0x2f, 0x3a, 0x6f, 0x98, 0x84, 0xdd, 0x9e, 0x84, 0x61, 0x96, 0x48, 0x96, 0x00, 0x96, 0x91,
+    0x4c, 0x11, 0xc0, 0x0b, 0x46, 0x10, 0x04, 0x20, 0x50, 0x30, 0x01, 0xf0, 0x38, 0x40, 0x8e, 0x02,
+    0x50, 0x00, 0x02, 0x50, 0xd5, 0x20, 0xc9, 0x0a, 0x46, 0x10, 0x04, 0x20, 0x50, 0x30, 0x02, 0x00,
+    0x38, 0x40, 0x8e, 0x02, 0x50, 0x00, 0x02, 0x60, 0xd5, 0x16, 0x84, 0xa2, 0xd9, 0x0a, 0x46, 0x10,
+    0x04, 0x20, 0x50, 0x30, 0x02, 0x10, 0x38, 0x40, 0x8e, 0x02, 0x50, 0x00, 0x02, 0x70, 0xd5, 0x0b,
+    0x84, 0xa3, 0xd9, 0x11, 0x46, 0x10, 0x04, 0x20, 0x50, 0x30, 0x02, 0x20, 0x38, 0x40, 0x8e, 0x02,
+    0x50, 0x00, 0x02, 0x80, 0x98, 0x94, 0x38, 0x20, 0x8e, 0x0a, 0x38, 0x20, 0x82, 0x02, 0x9c, 0x91,
+    0x38, 0x20, 0x82, 0x0a, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0x74, 0x96, 0x00,
+    0x50, 0x30, 0x00, 0x60, 0xf3, 0x81, 0x50, 0x30, 0x00, 0x70, 0xf3, 0x82, 0x50, 0x30, 0x00, 0x80,
+    0xf3, 0x83, 0x50, 0x30, 0x00, 0x90, 0xf3, 0x84, 0x50, 0x30, 0x00, 0xa0, 0xf3, 0x85, 0x50, 0x30,
+    0x00, 0xb0, 0xf3, 0x86, 0x50, 0x30, 0x00, 0xc0, 0xf3, 0x87, 0x50, 0x30, 0x00, 0xd0, 0xf3, 0x88,
+    0x50, 0x30, 0x00, 0xe0, 0xf3, 0x89, 0x50, 0x30, 0x00, 0xf0, 0xf3, 0x8a, 0x50, 0x30, 0x01, 0x00,
+    0xf3, 0x8b, 0x50, 0x30, 0x01, 0x10, 0xf3, 0x8c, 0x50, 0x30, 0x01, 0x20, 0xf3, 0x8d, 0x50, 0x30,
+    0x01, 0x30, 0xf3, 0x8e, 0x50, 0x30, 0x01, 0x40, 0xf3, 0x8f, 0x50, 0x30, 0x01, 0x50, 0xf3, 0x90,
+    0x50, 0x30, 0x01, 0x60, 0xf3, 0x91, 0x50, 0x30, 0x01, 0x70, 0xf3, 0x92, 0x50, 0x30, 0x01, 0x80,
+    0xf3, 0x93, 0x50, 0x30, 0x01, 0x90, 0xf3, 0x94, 0x50, 0x30, 0x01, 0xa0, 0xf3, 0x95, 0x50, 0x30,
+    0x01, 0xb0, 0xf3, 0x96, 0x50, 0x30, 0x01, 0xc0, 0xf3, 0x97, 0x50, 0x30, 0x01, 0xd0, 0xf3, 0x98,
+    0x50, 0x30, 0x01, 0xe0, 0xf3, 0x99, 0x50, 0x30, 0x01, 0xf0, 0xf3, 0x9a, 0x50, 0x30, 0x02, 0x00,
+    0xf3, 0x9b, 0x50, 0x30, 0x02, 0x10, 0xf3, 0x9c, 0x50, 0x30, 0x02, 0x20, 0xf3, 0x9d, 0x50, 0x30,
+    0x02, 0x30, 0x50, 0x20, 0x02, 0xc0, 0xf3, 0x9e, 0x46, 0x10, 0x04, 0x20, 0x50, 0x30, 0x02, 0x40,
+    0xf2, 0xa1, 0x50, 0x40, 0x00, 0x10, 0x84, 0x40, 0x50, 0x60, 0x00, 0x20, 0x50, 0x80, 0x00, 0x30,
+    0x50, 0xa0, 0x00, 0x40, 0x51, 0xe0, 0x00, 0x50, 0xf3, 0x9f, 0x50, 0x30, 0x02, 0x50, 0xf3, 0xa0,
+    0x38, 0x20, 0x92, 0x0a, 0x38, 0x20, 0x9a, 0x0a, 0x38, 0x20, 0xa2, 0x0a, 0x38, 0x20, 0xaa, 0x0a,
+    0x38, 0x20, 0xfa, 0x0a, 0x51, 0xc0, 0x02, 0x60, 0xf4, 0x01, 0x50, 0x90, 0x02, 0x70, 0x38, 0x20,
+    0x92, 0x0a, 0x50, 0x70, 0x02, 0x80, 0xf4, 0x02, 0x50, 0x50, 0x02, 0x90, 0x38, 0x20, 0x92, 0x0a,
+    0x50, 0x30, 0x02, 0xa0, 0xf4, 0x03, 0x50, 0x00, 0x02, 0xb0, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x04,
+    0x38, 0x20, 0x92, 0x0a, 0xf4, 0x05, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x06, 0x38, 0x20, 0x92, 0x0a,
+    0xf4, 0x07, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x08, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x09, 0x38, 0x20,
+    0x92, 0x0a, 0xf4, 0x0a, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x0b, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x0c,
+    0x38, 0x20, 0x92, 0x0a, 0xf4, 0x0d, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x0e, 0x38, 0x20, 0x92, 0x0a,
+    0xf4, 0x0f, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x10, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x11, 0x38, 0x20,
+    0x92, 0x0a, 0xf4, 0x12, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x13, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x14,
+    0x38, 0x20, 0x92, 0x0a, 0xf4, 0x15, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x16, 0x38, 0x20, 0x92, 0x0a,
+    0xf4, 0x17, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x18, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x19, 0x38, 0x20,
+    0x92, 0x0a, 0xf4, 0x1a, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x1b, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x1c,
+    0x38, 0x20, 0x92, 0x0a, 0xf4, 0x1d, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x1e, 0x38, 0x20, 0x92, 0x0a,
+    0xf4, 0x1f, 0x38, 0x20, 0x92, 0x0a, 0xf4, 0x20, 0x38, 0x20, 0x92, 0x0a, 0x38, 0x20, 0xf2, 0x0a,
+    0x38, 0x20, 0xa6, 0x0a, 0x38, 0x20, 0x9e, 0x0a, 0x38, 0x20, 0x96, 0x0a, 0x38, 0x20, 0x8e, 0x0a,
+    0x38, 0x20, 0x82, 0x0a, 0xf0, 0x21, 0x38, 0x20, 0x82, 0x0a, 0xec, 0x8c, 0x3a, 0x6f, 0xaa, 0x84,
+    0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xe4, 0x96, 0x49, 0x50, 0x20, 0x00, 0x78,
+    0x5c, 0xf0, 0x84, 0x00, 0x4e, 0xf3, 0x01, 0x51, 0x80, 0x80, 0xa2, 0xe1, 0xb4, 0x24, 0x97, 0xd8,
+    0x96, 0x48, 0x4e, 0x73, 0x01, 0x37, 0xe6, 0x30, 0x4e, 0xf2, 0x01, 0x47, 0xb6, 0x20, 0x46, 0x30,
+    0x04, 0x20, 0x50, 0x50, 0x80, 0x10, 0x38, 0x51, 0x96, 0x02, 0x50, 0x60, 0x81, 0x00, 0xb6, 0xa4,
+    0x50, 0x40, 0x80, 0x20, 0x38, 0x41, 0x92, 0x02, 0x50, 0x50, 0x81, 0x10, 0xa9, 0x02, 0x50, 0x40,
+    0x80, 0x30, 0x38, 0x41, 0x92, 0x02, 0x50, 0x80, 0x82, 0x00, 0xa9, 0x03, 0x50, 0x40, 0x80, 0x40,
+    0x38, 0x41, 0x92, 0x02, 0x51, 0xe0, 0x82, 0x50, 0xa9, 0x04, 0x50, 0x40, 0x80, 0x50, 0x38, 0x41,
+    0x92, 0x02, 0x51, 0xc0, 0x82, 0x60, 0xa9, 0x05, 0x50, 0x40, 0x80, 0x60, 0x38, 0x41, 0x92, 0x02,
+    0x50, 0xa0, 0x82, 0x70, 0xa9, 0x06, 0x50, 0x40, 0x80, 0x70, 0x38, 0x41, 0x92, 0x02, 0xa9, 0x07,
+    0x50, 0x40, 0x80, 0x80, 0x38, 0x41, 0x92, 0x02, 0x14, 0x40, 0x00, 0x08, 0x50, 0x40, 0x80, 0x90,
+    0x38, 0x41, 0x92, 0x02, 0x14, 0x40, 0x00, 0x09, 0x50, 0x40, 0x80, 0xa0, 0x38, 0x41, 0x92, 0x02,
+    0x14, 0x40, 0x00, 0x0a, 0x50, 0x40, 0x80, 0xb0, 0x38, 0x41, 0x92, 0x02, 0x14, 0x40, 0x00, 0x0b,
+    0x50, 0x40, 0x80, 0xc0, 0x38, 0x41, 0x92, 0x02, 0x14, 0x40, 0x00, 0x0c, 0x50, 0x40, 0x80, 0xd0,
+    0x38, 0x41, 0x92, 0x02, 0x14, 0x40, 0x00, 0x0d, 0x50, 0x40, 0x80, 0xe0, 0x38, 0x41, 0x92, 0x02,
+    0x14, 0x40, 0x00, 0x0e, 0x50, 0x40, 0x80, 0xf0, 0x38, 0x41, 0x92, 0x02, 0x14, 0x40, 0x00, 0x0f,
+    0x50, 0x40, 0x81, 0x20, 0x38, 0x61, 0x9a, 0x02, 0x14, 0x60, 0x00, 0x10, 0x50, 0x60, 0x81, 0xf0,
+    0x38, 0x51, 0x96, 0x02, 0x14, 0x50, 0x00, 0x11, 0x38, 0x41, 0x92, 0x02, 0x50, 0x50, 0x82, 0x90,
+    0x14, 0x40, 0x00, 0x12, 0x50, 0x40, 0x81, 0x30, 0x38, 0x41, 0x92, 0x02, 0x14, 0x40, 0x00, 0x13,
+    0x50, 0x40, 0x81, 0x40, 0x38, 0x41, 0x92, 0x02, 0x14, 0x40, 0x00, 0x14, 0x50, 0x40, 0x81, 0x50,
+    0x38, 0x41, 0x92, 0x02, 0x14, 0x40, 0x00, 0x15, 0x50, 0x40, 0x81, 0x60, 0x38, 0x41, 0x92, 0x02,
+    0x14, 0x40, 0x00, 0x16, 0x50, 0x40, 0x81, 0x70, 0x38, 0x41, 0x92, 0x02, 0x14, 0x40, 0x00, 0x17,
+    0x50, 0x40, 0x81, 0x80, 0x38, 0x41, 0x92, 0x02, 0x14, 0x40, 0x00, 0x18, 0x50, 0x40, 0x81, 0x90,
+    0x38, 0x41, 0x92, 0x02, 0x14, 0x40, 0x00, 0x19, 0x50, 0x40, 0x81, 0xa0, 0x38, 0x41, 0x92, 0x02,
+    0x14, 0x40, 0x00, 0x1a, 0x50, 0x40, 0x81, 0xb0, 0x38, 0x41, 0x92, 0x02, 0x14, 0x40, 0x00, 0x1b,
+    0x50, 0x40, 0x81, 0xc0, 0x38, 0x41, 0x92, 0x02, 0x14, 0x40, 0x00, 0x1c, 0x50, 0x40, 0x81, 0xd0,
+    0x38, 0x41, 0x92, 0x02, 0x14, 0x40, 0x00, 0x1d, 0x50, 0x40, 0x81, 0xe0, 0x38, 0x41, 0x92, 0x02,
+    0x14, 0x40, 0x00, 0x1e, 0x50, 0x40, 0x82, 0xa0, 0x38, 0x01, 0x9a, 0x02, 0xa8, 0x11, 0x50, 0x00,
+    0x82, 0x10, 0x38, 0x91, 0xa2, 0x02, 0x14, 0x91, 0x00, 0x02, 0xf0, 0x82, 0x50, 0x90, 0x82, 0x20,
+    0x50, 0x00, 0x82, 0x30, 0x14, 0x9f, 0x80, 0x03, 0xf0, 0x84, 0x04, 0x9f, 0x80, 0x02, 0x38, 0x91,
+    0xa6, 0x02, 0x14, 0x91, 0x00, 0x03, 0xf0, 0x03, 0x38, 0x01, 0x82, 0x02, 0xa8, 0x14, 0x50, 0x00,
+    0x82, 0x40, 0x04, 0x9f, 0x80, 0x04, 0x38, 0x91, 0xa6, 0x02, 0x14, 0x91, 0x00, 0x05, 0xf0, 0x85,
+    0x38, 0x91, 0x82, 0x02, 0x14, 0x91, 0x00, 0x06, 0x38, 0x01, 0xfa, 0x02, 0xa8, 0x17, 0x38, 0x91,
+    0xf2, 0x02, 0x14, 0x91, 0x00, 0x08, 0x50, 0x90, 0x82, 0x80, 0x38, 0x01, 0xaa, 0x02, 0x14, 0x01,
+    0x00, 0x09, 0x14, 0x9f, 0x80, 0x01, 0x38, 0x01, 0xa6, 0x02, 0x14, 0x01, 0x00, 0x0a, 0x38, 0x91,
+    0x96, 0x02, 0x14, 0x91, 0x00, 0x0b, 0x38, 0x01, 0x92, 0x02, 0x14, 0x01, 0x00, 0x0c, 0x50, 0x00,
+    0x82, 0xb0, 0x38, 0x91, 0x82, 0x02, 0x50, 0x10, 0x82, 0xc0, 0x14, 0x91, 0x00, 0x0d, 0x38, 0x91,
+    0x86, 0x02, 0x14, 0x91, 0x00, 0x0e, 0x38, 0x71, 0x9a, 0x0a, 0x38, 0x71, 0xa2, 0x0a, 0xf2, 0x02,
+    0x38, 0x71, 0x8a, 0x0a, 0x04, 0x9f, 0x80, 0x03, 0x38, 0x71, 0xa6, 0x0a, 0xf2, 0x04, 0x38, 0x71,
+    0x8a, 0x0a, 0x04, 0x9f, 0x80, 0x05, 0x38, 0x71, 0xa6, 0x0a, 0x38, 0x71, 0xfa, 0x0a, 0x38, 0x71,
+    0xf2, 0x0a, 0x38, 0x71, 0xaa, 0x0a, 0xf2, 0x01, 0x38, 0x71, 0x8a, 0x0a, 0x38, 0x71, 0x96, 0x0a,
+    0x38, 0x71, 0x92, 0x0a, 0x38, 0x71, 0x82, 0x0a, 0x38, 0x71, 0x86, 0x0a, 0x80, 0x07, 0xd5, 0x15,
+    0x84, 0xa1, 0xd7, 0x02, 0xd5, 0x0f, 0x46, 0x20, 0x04, 0x25, 0x58, 0x21, 0x08, 0x00, 0x40, 0x10,
+    0xa0, 0x08, 0x98, 0x4a, 0x44, 0x20, 0x04, 0x00, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84,
+    0xdd, 0x2f, 0x84, 0x00, 0xd5, 0x02, 0x84, 0x01, 0xec, 0x1c, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0x98, 0xbc, 0x46, 0x00, 0x04, 0x25, 0x46, 0x60, 0x00, 0x5a, 0x58, 0x63, 0x03, 0xc4,
+    0x84, 0x20, 0x44, 0x20, 0x20, 0x00, 0x58, 0x00, 0x08, 0x00, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x00,
+    0x04, 0x23, 0x84, 0x20, 0x44, 0x20, 0x20, 0x00, 0x58, 0x00, 0x08, 0x00, 0x4b, 0xe0, 0x18, 0x01,
+    0x46, 0x00, 0x04, 0x20, 0x84, 0x20, 0x44, 0x20, 0x38, 0x00, 0x4b, 0xe0, 0x18, 0x01, 0x3a, 0x6f,
+    0x98, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xf4, 0x46, 0x70, 0x00, 0x80, 0x58, 0x73,
+    0x83, 0x34, 0x44, 0x00, 0x00, 0x10, 0x46, 0x10, 0x00, 0x80, 0x58, 0x10, 0x8a, 0x9c, 0xdd, 0x27,
+    0x44, 0x00, 0x00, 0x11, 0x46, 0x10, 0x00, 0x80, 0x58, 0x10, 0x89, 0x64, 0xdd, 0x27, 0x84, 0x00,
+    0x46, 0x10, 0x00, 0x80, 0x58, 0x10, 0x88, 0x30, 0xdd, 0x27, 0x84, 0xc0, 0x84, 0x01, 0x46, 0x10,
+    0x00, 0x80, 0x58, 0x10, 0x8a, 0x68, 0xdd, 0x27, 0x81, 0x06, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7,
+    0x81, 0x84, 0xdd, 0x2f, 0x87, 0x85, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x85, 0x08, 0xdd, 0x2f,
+    0x46, 0xa0, 0x00, 0x81, 0x58, 0xa5, 0x07, 0xb4, 0xd5, 0x16, 0x98, 0x39, 0x94, 0x04, 0x46, 0x20,
+    0x01, 0x1b, 0x58, 0x21, 0x05, 0x80, 0x1c, 0x84, 0x80, 0x04, 0x50, 0x00, 0x05, 0xc8, 0x98, 0x02,
+    0xf1, 0x81, 0x9d, 0xf9, 0x4b, 0xe0, 0x28, 0x01, 0x84, 0xa5, 0xf1, 0x01, 0xdf, 0xef, 0x9d, 0xb1,
+    0x8c, 0xab, 0xd6, 0x10, 0x44, 0x00, 0x00, 0x50, 0x42, 0x93, 0x00, 0x24, 0x46, 0x20, 0x01, 0x1b,
+    0x58, 0x21, 0x05, 0x80, 0x50, 0x94, 0x85, 0xd0, 0x84, 0xe0, 0x89, 0x22, 0x42, 0x13, 0x70, 0x24,
+    0xd5, 0xdd, 0x46, 0x00, 0x01, 0x1b, 0x58, 0x00, 0x05, 0x80, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7,
+    0x83, 0x94, 0xdd, 0x2f, 0x46, 0x00, 0x04, 0x10, 0x58, 0x00, 0x08, 0x00, 0x46, 0xf0, 0x01, 0x1b,
+    0x14, 0x87, 0x82, 0xcd, 0x14, 0x80, 0x00, 0x04, 0x46, 0x20, 0x30, 0x00, 0xa0, 0x43, 0x40, 0x10,
+    0x88, 0x04, 0xa8, 0x43, 0x46, 0xf0, 0x00, 0x84, 0x58, 0xf7, 0x88, 0xe4, 0xdd, 0x2f, 0xec, 0x0c,
+    0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x84, 0x23, 0x42, 0x00, 0x04, 0x24, 0x84, 0x20,
+    0xd5, 0x08, 0x84, 0x40, 0x92, 0x00, 0x84, 0x67, 0x9c, 0x91, 0x4c, 0x21, 0xff, 0xfd, 0x9c, 0x49,
+    0xe2, 0x20, 0xe9, 0xf8, 0xdd, 0x9e, 0x92, 0x00, 0x46, 0x10, 0x04, 0x00, 0x04, 0x20, 0x80, 0x53,
+    0x42, 0x21, 0x4c, 0x09, 0x42, 0x21, 0x50, 0x09, 0x14, 0x20, 0x80, 0x53, 0x46, 0x00, 0x04, 0x00,
+    0x58, 0x00, 0x01, 0x30, 0xb4, 0x20, 0x44, 0x2c, 0xff, 0xff, 0x40, 0x10, 0x88, 0x02, 0xb6, 0x20,
+    0xb4, 0x20, 0x58, 0x10, 0x80, 0x01, 0xb6, 0x20, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xa0, 0xbc,
+    0x46, 0x00, 0x04, 0x00, 0x58, 0x00, 0x01, 0x48, 0xb4, 0x20, 0x81, 0x00, 0x58, 0x10, 0x80, 0x01,
+    0xb6, 0x20, 0x84, 0xc0, 0x46, 0x70, 0x00, 0x85, 0x58, 0x73, 0x8b, 0x34, 0xb4, 0x08, 0x40, 0x10,
+    0x30, 0x09, 0x42, 0x20, 0x70, 0x0b, 0x9d, 0xb1, 0x54, 0x10, 0x80, 0x03, 0x84, 0x0a, 0xc2, 0x03,
+    0x84, 0xa3, 0xd1, 0x06, 0x4b, 0xe0, 0x1c, 0x01, 0x44, 0x50, 0x00, 0x64, 0xde, 0xf0, 0x46, 0x60,
+    0x04, 0x00, 0x58, 0x63, 0x01, 0x48, 0xb4, 0x06, 0x46, 0x1f, 0xf8, 0x0f, 0x58, 0x10, 0x8f, 0xff,
+    0x40, 0x00, 0x04, 0x02, 0xb6, 0x06, 0x46, 0x70, 0x00, 0x85, 0x58, 0x73, 0x8b, 0x34, 0x84, 0x01,
+    0x4b, 0xe0, 0x1c, 0x01, 0xb4, 0x26, 0x46, 0x2f, 0x0f, 0xff, 0x58, 0x21, 0x0f, 0xff, 0x40, 0x10,
+    0x88, 0x02, 0xb6, 0x26, 0x84, 0x01, 0x4b, 0xe0, 0x1c, 0x01, 0xb4, 0x06, 0x46, 0x30, 0xf0, 0x00,
+    0x40, 0x00, 0x0c, 0x04, 0xb6, 0x06, 0xb4, 0x06, 0x46, 0x20, 0x04, 0x01, 0x92, 0x0c, 0x40, 0x00,
+    0x30, 0x08, 0xb6, 0x06, 0x04, 0x31, 0x00, 0x81, 0x42, 0x31, 0x8c, 0x09, 0x14, 0x31, 0x00, 0x81,
+    0x46, 0x10, 0x04, 0x00, 0x04, 0x20, 0x80, 0x20, 0x80, 0x01, 0x58, 0x21, 0x00, 0x01, 0x14, 0x20,
+    0x80, 0x20, 0x04, 0x10, 0x00, 0x19, 0x42, 0x10, 0xc8, 0x09, 0x14, 0x10, 0x00, 0x19, 0x3a, 0x6f,
+    0xa0, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xfc, 0x46, 0x60, 0x04, 0x00, 0x58, 0x63,
+    0x01, 0x30, 0xb4, 0x06, 0x44, 0x11, 0x00, 0x01, 0x40, 0x00, 0x04, 0x04, 0xb6, 0x06, 0x46, 0x70,
+    0x00, 0x58, 0x58, 0x73, 0x81, 0x1c, 0x44, 0x00, 0x00, 0x64, 0x4b, 0xe0, 0x1c, 0x01, 0x46, 0x00,
+    0x04, 0x00, 0x58, 0x00, 0x00, 0x1c, 0xb4, 0x40, 0x92, 0x48, 0x40, 0x21, 0x20, 0x08, 0xb6, 0x40,
+    0x46, 0x10, 0x04, 0x00, 0xb4, 0x40, 0x58, 0x21, 0x00, 0x30, 0xb6, 0x40, 0x44, 0x00, 0x48, 0x4f,
+    0xa8, 0x0d, 0x84, 0x01, 0x4b, 0xe0, 0x1c, 0x01, 0xb4, 0x06, 0x46, 0x70, 0x00, 0x58, 0x58, 0x73,
+    0x81, 0x28, 0x42, 0x00, 0x44, 0x08, 0xb6, 0x06, 0x84, 0x05, 0x4b, 0xe0, 0x1c, 0x01, 0xb4, 0x26,
+    0x42, 0x10, 0xc0, 0x09, 0xb6, 0x26, 0x84, 0x02, 0x4b, 0xe0, 0x1c, 0x01, 0x46, 0x00, 0x04, 0x00,
+    0x04, 0x10, 0x00, 0x53, 0x46, 0x30, 0x01, 0x80, 0x40, 0x10, 0x8c, 0x04, 0x14, 0x10, 0x00, 0x53,
+    0xec, 0x04, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xfc, 0x96, 0x00,
+    0x96, 0x48, 0xc8, 0x3d, 0x84, 0x01, 0x46, 0x70, 0x00, 0x85, 0x58, 0x73, 0x8b, 0x34, 0x4c, 0x10,
+    0x40, 0x17, 0x46, 0x60, 0x04, 0x00, 0x58, 0x63, 0x01, 0x30, 0xb4, 0x26, 0x84, 0x0a, 0x58, 0x10,
+    0x80, 0x01, 0xb6, 0x26, 0x4b, 0xe0, 0x1c, 0x01, 0xb4, 0x26, 0x84, 0x0a, 0x58, 0x10, 0x80, 0x3a,
+    0xb6, 0x26, 0x4b, 0xe0, 0x1c, 0x01, 0xb4, 0x06, 0x84, 0x3b, 0xd5, 0x3c, 0x46, 0x60, 0x04, 0x00,
+    0x58, 0x63, 0x01, 0x30, 0xb4, 0x26, 0x84, 0x05, 0x58, 0x10, 0x80, 0x04, 0xb6, 0x26, 0x4b, 0xe0,
+    0x1c, 0x01, 0x46, 0x00, 0x04, 0x10, 0x04, 0x10, 0x01, 0x4c, 0x92, 0x24, 0x94, 0x4c, 0x14, 0x10,
+    0x01, 0x4c, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x8b, 0x54, 0xdd, 0x2f, 0xb4, 0x06, 0x44, 0x1f,
+    0xff, 0xc5, 0x58, 0x00, 0x00, 0x01, 0xb6, 0x06, 0xb4, 0x06, 0xd5, 0x4c, 0x84, 0xa1, 0x46, 0x70,
+    0x00, 0x85, 0x58, 0x73, 0x8b, 0x34, 0xd9, 0x27, 0x46, 0x60, 0x04, 0x00, 0x58, 0x63, 0x01, 0x30,
+    0xb4, 0x26, 0x84, 0x0a, 0x58, 0x10, 0x81, 0x00, 0xb6, 0x26, 0x4b, 0xe0, 0x1c, 0x01, 0xb4, 0x26,
+    0x84, 0x0a, 0x58, 0x10, 0xba, 0x00, 0xb6, 0x26, 0x4b, 0xe0, 0x1c, 0x01, 0xb4, 0x06, 0x44, 0x1f,
+    0xfb, 0xff, 0x40, 0x00, 0x04, 0x02, 0xb6, 0x06, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x8c, 0x50,
+    0xdd, 0x2f, 0x46, 0x00, 0x04, 0x10, 0x04, 0x10, 0x01, 0x4c, 0x58, 0x10, 0x80, 0x0f, 0x14, 0x10,
+    0x01, 0x4c, 0xd5, 0x23, 0x46, 0x60, 0x04, 0x00, 0x58, 0x63, 0x01, 0x30, 0xb4, 0x26, 0x84, 0x05,
+    0x58, 0x10, 0x84, 0x00, 0xb6, 0x26, 0x4b, 0xe0, 0x1c, 0x01, 0x46, 0x00, 0x04, 0x10, 0x04, 0x10,
+    0x01, 0x4c, 0x92, 0x24, 0x94, 0x4c, 0x14, 0x10, 0x01, 0x4c, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7,
+    0x8b, 0x54, 0xdd, 0x2f, 0xb4, 0x06, 0x44, 0x1f, 0xc5, 0xff, 0x58, 0x00, 0x01, 0x00, 0xb6, 0x06,
+    0xb4, 0x06, 0x40, 0x00, 0x04, 0x02, 0xb6, 0x06, 0xec, 0x04, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0xa0, 0xbc, 0x96, 0x49, 0xe6, 0x24, 0xe8, 0x04, 0x84, 0x01, 0x48, 0x00, 0x00, 0x92,
+    0xb4, 0x00, 0x44, 0x10, 0x00, 0x30, 0x4c, 0x00, 0xc0, 0x61, 0x46, 0xf0, 0x01, 0x00, 0x04, 0x27,
+    0x80, 0x51, 0x84, 0x20, 0x84, 0x03, 0xdd, 0x22, 0x84, 0x00, 0x80, 0x20, 0x46, 0x60, 0x00, 0x85,
+    0x58, 0x63, 0x0c, 0xe4, 0x4b, 0xe0, 0x18, 0x01, 0x84, 0x01, 0x84, 0x20, 0x4b, 0xe0, 0x18, 0x01,
+    0x46, 0x00, 0x04, 0x00, 0x58, 0x00, 0x01, 0x48, 0xb4, 0x20, 0x46, 0x2f, 0xf8, 0x0f, 0x46, 0x30,
+    0x05, 0xf0, 0x40, 0x10, 0x88, 0x02, 0x58, 0x31, 0x80, 0x02, 0x40, 0x10, 0x8c, 0x04, 0xb6, 0x20,
+    0x81, 0x00, 0x84, 0xc0, 0x46, 0x70, 0x00, 0x85, 0x58, 0x73, 0x8b, 0x34, 0xb4, 0x08, 0x9d, 0xb1,
+    0x40, 0x10, 0x30, 0x09, 0x40, 0x20, 0x70, 0x09, 0x54, 0x10, 0x80, 0x03, 0x84, 0x0a, 0xca, 0x02,
+    0xc1, 0x06, 0x4b, 0xe0, 0x1c, 0x01, 0x44, 0x50, 0x00, 0x64, 0xde, 0xf1, 0x46, 0x00, 0x04, 0x00,
+    0x04, 0x20, 0x00, 0x52, 0x92, 0x4c, 0x40, 0x21, 0x30, 0x08, 0x14, 0x20, 0x00, 0x52, 0x80, 0x20,
+    0x04, 0x20, 0x80, 0x20, 0x42, 0x21, 0x00, 0x09, 0x14, 0x20, 0x80, 0x20, 0x04, 0x10, 0x00, 0x19,
+    0x84, 0x61, 0x42, 0x10, 0xc8, 0x08, 0x14, 0x10, 0x00, 0x19, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x17,
+    0x8b, 0xa3, 0x46, 0xf0, 0x01, 0x12, 0x10, 0x37, 0x8b, 0x99, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x03,
+    0x58, 0xf7, 0x81, 0x84, 0xdd, 0x2f, 0xd5, 0x2c, 0x44, 0x50, 0x00, 0x31, 0xd0, 0x02, 0xd5, 0x28,
+    0x46, 0xf0, 0x01, 0x12, 0x00, 0x17, 0x8b, 0xa3, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x03, 0x58, 0xf7,
+    0x81, 0x20, 0xdd, 0x2f, 0x46, 0x60, 0x00, 0x85, 0x58, 0x63, 0x0c, 0xe4, 0x46, 0xf0, 0x00, 0x85,
+    0x58, 0xf7, 0x8b, 0x88, 0xdd, 0x2f, 0x84, 0x00, 0x84, 0x21, 0x4b, 0xe0, 0x18, 0x01, 0x84, 0x01,
+    0x80, 0x20, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0xf0, 0x01, 0x00, 0x04, 0x27, 0x80, 0x51, 0x84, 0x21,
+    0x84, 0x03, 0xdd, 0x22, 0x84, 0x20, 0x46, 0xf0, 0x01, 0x12, 0x10, 0x17, 0x8b, 0x99, 0x84, 0x00,
+    0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x46, 0x00, 0x04, 0x00, 0x04, 0x10, 0x00, 0x97,
+    0x14, 0x10, 0x00, 0x97, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xa0, 0xbc, 0x46, 0x10, 0x04, 0x1d,
+    0x58, 0x10, 0x82, 0x35, 0xae, 0x08, 0x46, 0x00, 0x04, 0x10, 0x58, 0x00, 0x04, 0x10, 0xb4, 0x20,
+    0x81, 0x00, 0x58, 0x10, 0x80, 0x08, 0xb6, 0x20, 0x84, 0xc0, 0x46, 0x70, 0x00, 0x02, 0x58, 0x73,
+    0x87, 0x50, 0xb4, 0x28, 0x9d, 0xb1, 0x54, 0x10, 0x80, 0x08, 0x84, 0x01, 0xc1, 0x06, 0x4b, 0xe0,
+    0x1c, 0x01, 0x44, 0x50, 0x01, 0x5e, 0xde, 0xf6, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e, 0x92, 0x00,
+    0x3a, 0x6f, 0xa0, 0xbc, 0x46, 0x00, 0x04, 0x10, 0x58, 0x00, 0x04, 0x10, 0xb4, 0x20, 0x81, 0x00,
+    0x58, 0x10, 0x80, 0x04, 0xb6, 0x20, 0x84, 0xc0, 0x46, 0x70, 0x00, 0x02, 0x58, 0x73, 0x87, 0x50,
+    0xb4, 0x28, 0x9d, 0xb1, 0x54, 0x10, 0x80, 0x04, 0x84, 0x01, 0xc1, 0x06, 0x4b, 0xe0, 0x1c, 0x01,
+    0x44, 0x50, 0x01, 0x5e, 0xde, 0xf6, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa0, 0xbc,
+    0x46, 0x70, 0x01, 0x12, 0x58, 0x73, 0x8b, 0xd0, 0xb4, 0x07, 0x85, 0x0c, 0x42, 0x00, 0x20, 0x24,
+    0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x82, 0x2c, 0xdd, 0x2f, 0x80, 0xc0, 0xc0, 0x41, 0xb4, 0x47,
+    0xa0, 0x02, 0x42, 0x21, 0x20, 0x24, 0x46, 0x10, 0x01, 0x1c, 0x58, 0x10, 0x80, 0x50, 0x12, 0x23,
+    0x00, 0x0c, 0xb4, 0x47, 0x42, 0x21, 0x20, 0x24, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84,
+    0xdd, 0x2f, 0xb4, 0x07, 0x46, 0x15, 0x8a, 0x08, 0x42, 0x80, 0x20, 0x24, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x07, 0x8b, 0x96, 0x54, 0x84, 0x3f, 0xfc, 0x54, 0x00, 0x00, 0x03, 0x40, 0x00, 0x64, 0x08,
+    0x40, 0x84, 0x04, 0x04, 0x40, 0x84, 0x00, 0x04, 0x14, 0x83, 0x00, 0x03, 0x46, 0x00, 0x01, 0x1b,
+    0x58, 0x00, 0x05, 0x80, 0x80, 0x26, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x84, 0x90, 0xdd, 0x2f,
+    0xc8, 0x0f, 0x00, 0x03, 0x00, 0x1a, 0x46, 0x20, 0x01, 0x1a, 0x58, 0x21, 0x02, 0x18, 0x94, 0x04,
+    0x80, 0x26, 0x98, 0x02, 0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x84, 0x88, 0xdd, 0x2f, 0x3a, 0x6f,
+    0xa0, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x98, 0xbc, 0x84, 0x41, 0x46, 0xf0, 0x01, 0x1c, 0x10, 0x27,
+    0x80, 0x4d, 0x46, 0x60, 0x00, 0x80, 0x58, 0x63, 0x0c, 0xb4, 0x46, 0x00, 0x01, 0x1b, 0x58, 0x00,
+    0x05, 0x68, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0e, 0x88, 0x4b, 0xe0,
+    0x18, 0x01, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0e, 0x70, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0xf0,
+    0x01, 0x0e, 0x00, 0x17, 0x82, 0xc9, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x03, 0x58, 0xf7, 0x81, 0x20,
+    0xdd, 0x2f, 0x3a, 0x6f, 0x98, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xfc, 0x84, 0x21,
+    0x46, 0x60, 0x00, 0x80, 0x58, 0x63, 0x0c, 0xb4, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0e, 0x88,
+    0x46, 0xf0, 0x01, 0x1c, 0x10, 0x17, 0x80, 0x4d, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x00, 0x01, 0x1a,
+    0x58, 0x00, 0x0e, 0x70, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x00, 0x01, 0x1b, 0x58, 0x00, 0x05, 0x68,
+    0x4b, 0xe0, 0x18, 0x01, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x07, 0x8b, 0x99, 0xc8, 0x08, 0x46, 0xf0,
+    0x01, 0x1c, 0x00, 0x07, 0x80, 0x4b, 0x5c, 0xf0, 0x00, 0x64, 0xe8, 0x07, 0x84, 0x00, 0x46, 0xf0,
+    0x00, 0x84, 0x58, 0xf7, 0x8d, 0xa4, 0xdd, 0x2f, 0x46, 0x00, 0x04, 0x11, 0x04, 0x20, 0x00, 0x83,
+    0x42, 0x21, 0x00, 0x09, 0x14, 0x20, 0x00, 0x83, 0x46, 0x10, 0x04, 0x00, 0x04, 0x20, 0x80, 0x4c,
+    0x42, 0x21, 0x4c, 0x09, 0x14, 0x20, 0x80, 0x4c, 0x04, 0x10, 0x00, 0xd0, 0x42, 0x10, 0xd0, 0x08,
+    0x14, 0x10, 0x00, 0xd0, 0xec, 0x04, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x9c, 0xbc,
+    0xef, 0xf4, 0x44, 0x00, 0x00, 0x3a, 0x50, 0x1f, 0x80, 0x07, 0x84, 0x41, 0x46, 0xf0, 0x00, 0x51,
+    0x58, 0xf7, 0x80, 0xf0, 0xdd, 0x2f, 0x00, 0x0f, 0x80, 0x07, 0x96, 0x42, 0x4e, 0x15, 0x00, 0x16,
+    0x46, 0x40, 0x04, 0x00, 0x46, 0x10, 0x00, 0xa0, 0x80, 0x64, 0x80, 0x43, 0x9f, 0x41, 0x58, 0x10,
+    0x8a, 0x3f, 0x97, 0x68, 0x14, 0x12, 0x00, 0x41, 0x14, 0x11, 0x80, 0x42, 0x14, 0x11, 0x00, 0x43,
+    0x5c, 0xf2, 0x80, 0xfe, 0xe8, 0x53, 0xd5, 0x23, 0x46, 0x10, 0x04, 0x00, 0x04, 0x10, 0x80, 0x19,
+    0x42, 0x10, 0xf4, 0x0b, 0x9f, 0xc1, 0xc1, 0x26, 0x46, 0x50, 0x04, 0x00, 0x46, 0x60, 0x00, 0x80,
+    0x80, 0x65, 0x46, 0x40, 0x00, 0x90, 0x80, 0x43, 0x46, 0x10, 0x00, 0xa1, 0x58, 0x63, 0x00, 0x0f,
+    0x58, 0x42, 0x0a, 0x1e, 0x58, 0x10, 0x8e, 0x7f, 0x97, 0xf8, 0x14, 0x62, 0x80, 0x41, 0x14, 0x41,
+    0x80, 0x42, 0x14, 0x11, 0x00, 0x43, 0x5c, 0xf3, 0x80, 0xfe, 0xe8, 0x30, 0x54, 0x10, 0x00, 0x7f,
+    0x46, 0x00, 0x00, 0xb8, 0x40, 0x10, 0xa0, 0x08, 0x58, 0x00, 0x00, 0x7f, 0x40, 0x10, 0x80, 0x04,
+    0xd5, 0x25, 0x46, 0x50, 0x04, 0x00, 0x46, 0x60, 0x00, 0x80, 0x80, 0x65, 0x46, 0x40, 0x00, 0x90,
+    0x80, 0x43, 0x46, 0x10, 0x00, 0xa1, 0x58, 0x63, 0x00, 0x1e, 0x58, 0x42, 0x0a, 0x3c, 0x58, 0x10,
+    0x8e, 0x7f, 0x97, 0xf8, 0x14, 0x62, 0x80, 0x41, 0x14, 0x41, 0x80, 0x42, 0x14, 0x11, 0x00, 0x43,
+    0x5c, 0xf3, 0x80, 0xfe, 0xe8, 0x0b, 0x54, 0x10, 0x00, 0x7f, 0x46, 0x20, 0x00, 0xb8, 0x40, 0x10,
+    0xa0, 0x08, 0x58, 0x21, 0x00, 0xe0, 0x40, 0x10, 0x88, 0x04, 0x46, 0x20, 0x04, 0x00, 0x14, 0x11,
+    0x00, 0x44, 0xec, 0x0c, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3b, 0xff, 0xfc, 0xbc,
+    0xef, 0xfc, 0x46, 0x00, 0x04, 0x10, 0x04, 0x30, 0x00, 0x53, 0x80, 0x20, 0x46, 0x20, 0x08, 0x5f,
+    0x42, 0x31, 0xe8, 0x09, 0x58, 0x21, 0x09, 0x10, 0x14, 0x30, 0x00, 0x53, 0x14, 0x20, 0x80, 0x19,
+    0x46, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x84, 0xa3, 0x92, 0x14, 0x54, 0x00, 0x00, 0x03,
+    0xd8, 0x08, 0x80, 0x01, 0x46, 0x10, 0x20, 0xc0, 0x58, 0x10, 0x84, 0x05, 0x14, 0x10, 0x00, 0x4c,
+    0x46, 0xf0, 0x00, 0x86, 0x58, 0xf7, 0x81, 0x68, 0xdd, 0x2f, 0x46, 0x00, 0x04, 0x10, 0x84, 0x25,
+    0x14, 0x10, 0x00, 0x40, 0x04, 0x10, 0x00, 0x40, 0x40, 0x10, 0xbc, 0x08, 0x92, 0x3f, 0xc1, 0xfb,
+    0x04, 0x10, 0x00, 0x40, 0x44, 0x41, 0x00, 0x00, 0x40, 0x10, 0x90, 0x02, 0xc9, 0xfa, 0x46, 0xf0,
+    0x01, 0x12, 0x00, 0x07, 0x8b, 0x9a, 0x46, 0xf0, 0x01, 0x00, 0x10, 0x17, 0x82, 0xf4, 0x84, 0xa1,
+    0xd8, 0x10, 0x46, 0x10, 0x04, 0x00, 0x04, 0x20, 0x81, 0x00, 0x80, 0x01, 0x58, 0x21, 0x00, 0x11,
+    0x14, 0x20, 0x81, 0x00, 0x04, 0x10, 0x01, 0x06, 0x58, 0x10, 0x80, 0x80, 0x14, 0x10, 0x01, 0x06,
+    0x46, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x97, 0x40, 0x00, 0x40, 0x08, 0x92, 0x1f, 0xc0, 0x0b,
+    0x46, 0xf0, 0x01, 0x0e, 0x00, 0x17, 0x82, 0xc9, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x03, 0x58, 0xf7,
+    0x81, 0x20, 0xdd, 0x2f, 0x46, 0x00, 0x04, 0x00, 0x04, 0x10, 0x00, 0x96, 0x42, 0x10, 0xf8, 0x09,
+    0x42, 0x10, 0xfc, 0x09, 0x14, 0x10, 0x00, 0x96, 0xec, 0x04, 0x3b, 0xff, 0xfc, 0x84, 0xdd, 0x9e,
+    0x3b, 0xff, 0xfc, 0xbc, 0xef, 0xf4, 0x44, 0x00, 0x00, 0x3a, 0x50, 0x1f, 0x80, 0x07, 0x84, 0x41,
+    0x46, 0xf0, 0x00, 0x51, 0x58, 0xf7, 0x80, 0xf0, 0xdd, 0x2f, 0x20, 0x0f, 0x80, 0x07, 0x4e, 0x05,
+    0x00, 0x12, 0x46, 0x40, 0x04, 0x00, 0x80, 0x64, 0x80, 0x43, 0x80, 0x22, 0x44, 0x06, 0x0a, 0x3f,
+    0x14, 0x02, 0x00, 0x41, 0x14, 0x01, 0x80, 0x42, 0x14, 0x01, 0x00, 0x43, 0x14, 0x00, 0x80, 0x44,
+    0xd5, 0x36, 0x46, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x19, 0x42, 0x00, 0x74, 0x0b, 0xc0, 0x18,
+    0x46, 0x30, 0x04, 0x00, 0x80, 0x43, 0x44, 0x46, 0x9e, 0x3f, 0x14, 0x41, 0x80, 0x41, 0x80, 0x22,
+    0x44, 0x35, 0x94, 0x2f, 0x14, 0x31, 0x00, 0x42, 0x46, 0x00, 0x04, 0x00, 0x44, 0x24, 0x8a, 0x0f,
+    0x14, 0x20, 0x80, 0x43, 0x58, 0x00, 0x01, 0x10, 0x44, 0x14, 0x00, 0x07, 0xd5, 0x17, 0x46, 0x30,
+    0x04, 0x00, 0x80, 0x43, 0x44, 0x46, 0x9e, 0xe0, 0x14, 0x41, 0x80, 0x41, 0x80, 0x22, 0x44, 0x35,
+    0x94, 0x7f, 0x14, 0x31, 0x00, 0x42, 0x46, 0x00, 0x04, 0x00, 0x44, 0x24, 0x8a, 0x3f, 0x14, 0x20,
+    0x80, 0x43, 0x58, 0x00, 0x01, 0x10, 0x44, 0x14, 0x00, 0x0f, 0xb6, 0x20, 0xec, 0x0c, 0x3b, 0xff,
+    0xfc, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa0, 0xbc, 0x46, 0x00, 0x04, 0x00, 0x58, 0x00, 0x04, 0x18,
+    0xb4, 0x20, 0x46, 0x20, 0x01, 0x12, 0x58, 0x21, 0x0b, 0x9a, 0x54, 0x10, 0x80, 0x80, 0xc1, 0x12,
+    0x46, 0x10, 0x04, 0x00, 0x58, 0x10, 0x84, 0x00, 0xb4, 0x61, 0x58, 0x31, 0x80, 0x11, 0xb6, 0x61,
+    0x44, 0x3f, 0xff, 0x7f, 0xb4, 0x20, 0x40, 0x10, 0x8c, 0x02, 0xb6, 0x20, 0x84, 0x01, 0xae, 0x10,
+    0xd5, 0x02, 0xae, 0x50, 0x46, 0xf0, 0x00, 0x00, 0x58, 0xf7, 0x80, 0x44, 0xdd, 0x2f, 0x84, 0x21,
+    0x46, 0x00, 0x01, 0x00, 0x58, 0x00, 0x02, 0xf4, 0xae, 0x40, 0x46, 0x00, 0x04, 0x00, 0x58, 0x00,
+    0x02, 0x08, 0xb4, 0x40, 0x44, 0x3f, 0xef, 0xff, 0x40, 0x21, 0x0c, 0x02, 0x46, 0x10, 0x04, 0x00,
+    0xb6, 0x40, 0x58, 0x10, 0x80, 0x38, 0xb4, 0x01, 0x84, 0x23, 0x92, 0x14, 0x54, 0x00, 0x00, 0x03,
+    0x4c, 0x00, 0xc0, 0x69, 0x46, 0x60, 0x04, 0x05, 0x46, 0x40, 0x04, 0x05, 0x46, 0x50, 0x01, 0x20,
+    0x46, 0x20, 0x04, 0x05, 0x46, 0x30, 0x20, 0x20, 0x58, 0x21, 0x07, 0xbc, 0x46, 0x00, 0x04, 0x05,
+    0x58, 0x63, 0x07, 0xb0, 0x58, 0x42, 0x07, 0xb4, 0x58, 0x52, 0x80, 0x12, 0x58, 0x31, 0x82, 0x02,
+    0x84, 0xef, 0xb6, 0xe6, 0x58, 0x00, 0x07, 0xc0, 0xb6, 0xa4, 0x46, 0x10, 0x04, 0x05, 0xb6, 0x62,
+    0x84, 0x45, 0xb6, 0x40, 0x58, 0x10, 0x87, 0xc4, 0x84, 0x00, 0xd5, 0x05, 0x44, 0x20, 0x03, 0xe9,
+    0x4c, 0x01, 0x00, 0x0a, 0xb4, 0x41, 0x44, 0x30, 0x00, 0x90, 0x54, 0x21, 0x00, 0x90, 0x9c, 0x01,
+    0x4c, 0x21, 0xff, 0xf6, 0x46, 0x00, 0x04, 0x10, 0x58, 0x00, 0x00, 0x80, 0x84, 0x2e, 0xb6, 0x20,
+    0x46, 0xf0, 0x00, 0x86, 0x58, 0xf7, 0x83, 0x4c, 0xdd, 0x2f, 0x46, 0x00, 0x04, 0x10, 0x58, 0x00,
+    0x01, 0x00, 0x84, 0x25, 0xb6, 0x20, 0x84, 0x27, 0xb6, 0x20, 0xb4, 0x20, 0x44, 0x25, 0x00, 0x00,
+    0x40, 0x10, 0x88, 0x02, 0x4c, 0x11, 0x7f, 0xfb, 0x46, 0x00, 0x04, 0x10, 0x58, 0x00, 0x01, 0x00,
+    0xb4, 0x20, 0x44, 0x34, 0x00, 0x00, 0x40, 0x10, 0x8c, 0x02, 0xc1, 0xfb, 0x46, 0x20, 0x04, 0x10,
+    0x46, 0x30, 0x20, 0xc0, 0x46, 0x00, 0x04, 0x10, 0x46, 0x10, 0x08, 0x40, 0x58, 0x21, 0x01, 0x30,
+    0x58, 0x31, 0x84, 0x04, 0x58, 0x00, 0x00, 0x64, 0x58, 0x10, 0x81, 0x30, 0xb6, 0x62, 0xb6, 0x20,
+    0xd5, 0x3e, 0x46, 0x70, 0x04, 0x10, 0x46, 0x80, 0x00, 0xe9, 0x46, 0x50, 0x04, 0x10, 0x46, 0x60,
+    0x00, 0xd8, 0x46, 0x30, 0x04, 0x10, 0x46, 0x40, 0x00, 0xc8, 0x46, 0x10, 0x04, 0x10, 0x46, 0x20,
+    0x00, 0xc0, 0x58, 0x10, 0x81, 0x10, 0x46, 0x00, 0x04, 0x10, 0x58, 0x73, 0x81, 0x04, 0x58, 0x84,
+    0x0f, 0xe0, 0x58, 0x52, 0x81, 0x08, 0x58, 0x63, 0x0f, 0x7f, 0x58, 0x31, 0x81, 0x0c, 0x58, 0x42,
+    0x07, 0x3f, 0x58, 0x21, 0x03, 0x1f, 0xb7, 0x07, 0x58, 0x00, 0x01, 0x00, 0xb6, 0xc5, 0xb6, 0x83,
+    0xb6, 0x41, 0x84, 0x25, 0xb6, 0x20, 0x84, 0x27, 0xb6, 0x20, 0xb4, 0x20, 0x44, 0x25, 0x00, 0x00,
+    0x40, 0x10, 0x88, 0x02, 0x4c, 0x11, 0x7f, 0xfb, 0x46, 0x00, 0x04, 0x10, 0x58, 0x00, 0x01, 0x00,
+    0xb4, 0x20, 0x44, 0x34, 0x00, 0x00, 0x40, 0x10, 0x8c, 0x02, 0xc1, 0xfb, 0x46, 0x10, 0x04, 0x10,
+    0x58, 0x10, 0x81, 0x40, 0xb4, 0x41, 0x44, 0x3f, 0xf0, 0x00, 0x40, 0x21, 0x0c, 0x02, 0x58, 0x21,
+    0x01, 0x31, 0xb6, 0x41, 0x46, 0x00, 0x04, 0x10, 0x58, 0x00, 0x01, 0x4c, 0xb4, 0x20, 0x42, 0x10,
+    0xe8, 0x08, 0xb6, 0x20, 0x46, 0xf0, 0x00, 0x00, 0x58, 0xf7, 0x80, 0x54, 0xdd, 0x2f, 0x46, 0x00,
+    0x04, 0x00, 0x58, 0x00, 0x02, 0x58, 0xb4, 0x20, 0x42, 0x10, 0xf8, 0x08, 0xb6, 0x20, 0x64, 0x00,
+    0x00, 0x20, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x98, 0xbc, 0xef, 0xf8, 0x46, 0x60,
+    0x01, 0x1b, 0x58, 0x63, 0x05, 0x80, 0x50, 0x0f, 0x80, 0x04, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7,
+    0x8c, 0x2c, 0xdd, 0x2f, 0x04, 0x13, 0x01, 0x6d, 0xf0, 0x01, 0xb6, 0x3f, 0x84, 0x20, 0x14, 0x13,
+    0x01, 0x6d, 0x46, 0xf0, 0x00, 0x01, 0x58, 0xf7, 0x8c, 0x58, 0xdd, 0x2f, 0xb4, 0x1f, 0x54, 0x00,
+    0x00, 0x02, 0xc0, 0x07, 0x80, 0x06, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x86, 0x7c, 0xdd, 0x2f,
+    0xb4, 0x1f, 0x40, 0x00, 0x3c, 0x08, 0x92, 0x1f, 0xc0, 0x0a, 0x46, 0x00, 0x01, 0x1b, 0x58, 0x00,
+    0x05, 0x80, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x89, 0xc8, 0xdd, 0x2f, 0xec, 0x08, 0x3a, 0x6f,
+    0x98, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xdc, 0x84, 0x20, 0xa4, 0xc0, 0xd5, 0x04,
+    0x84, 0xa7, 0x4c, 0x12, 0x81, 0x05, 0x40, 0x21, 0x84, 0x0e, 0x96, 0x94, 0x9c, 0x49, 0xc2, 0xf9,
+    0x46, 0x10, 0x01, 0x1c, 0x58, 0x10, 0x81, 0xd0, 0x00, 0x70, 0x83, 0x72, 0x00, 0x60, 0x83, 0x73,
+    0x00, 0x50, 0x83, 0x74, 0x00, 0x40, 0x83, 0x78, 0x00, 0x20, 0x83, 0x77, 0x54, 0x73, 0x80, 0x0f,
+    0x95, 0xb4, 0x40, 0x63, 0x98, 0x04, 0x97, 0xb0, 0x40, 0x21, 0x20, 0x08, 0x40, 0x52, 0xc0, 0x08,
+    0x40, 0x42, 0x30, 0x08, 0x40, 0x53, 0x14, 0x04, 0x40, 0x42, 0x08, 0x04, 0x46, 0x20, 0x04, 0x12,
+    0x40, 0x42, 0x14, 0x04, 0x46, 0xf0, 0x01, 0x19, 0x14, 0x37, 0x80, 0xbf, 0x14, 0x41, 0x02, 0x82,
+    0x00, 0x30, 0x83, 0x76, 0x00, 0x40, 0x83, 0x75, 0x40, 0x31, 0xc0, 0x08, 0x40, 0x31, 0x90, 0x04,
+    0x80, 0x22, 0x14, 0x31, 0x02, 0x83, 0x44, 0x24, 0x00, 0x71, 0x14, 0x20, 0x82, 0xa0, 0x46, 0x10,
+    0x04, 0x12, 0x58, 0x10, 0x83, 0x20, 0xb4, 0x61, 0x54, 0x31, 0xfe, 0x00, 0x50, 0x20, 0xff, 0xf0,
+    0x92, 0x69, 0xb4, 0x82, 0x9c, 0xd9, 0x46, 0x5e, 0x0f, 0xff, 0x58, 0x52, 0x8f, 0xff, 0x92, 0x61,
+    0x40, 0x42, 0x14, 0x02, 0x40, 0x31, 0xe0, 0x08, 0x98, 0xdc, 0xb6, 0x62, 0x46, 0x30, 0x04, 0x12,
+    0xb4, 0x82, 0xb4, 0xa1, 0xb4, 0x41, 0x40, 0x42, 0x28, 0x08, 0x54, 0x12, 0xfe, 0x00, 0x92, 0x9a,
+    0x92, 0x29, 0x54, 0x21, 0x00, 0x38, 0x92, 0x43, 0x98, 0x4c, 0x9a, 0x4a, 0x40, 0x10, 0xc0, 0x08,
+    0x58, 0x10, 0x83, 0x07, 0x80, 0x43, 0x80, 0xa2, 0x14, 0x11, 0x82, 0x9f, 0xf2, 0x81, 0xf5, 0x82,
+    0x80, 0xa2, 0xf2, 0x84, 0xf5, 0x85, 0xf2, 0x01, 0xf5, 0x02, 0x80, 0x23, 0xf1, 0x83, 0x58, 0x21,
+    0x0a, 0x00, 0x58, 0x52, 0x8a, 0x10, 0xf1, 0x86, 0xf2, 0x81, 0xf1, 0x03, 0xf2, 0x04, 0xf5, 0x82,
+    0xf5, 0x05, 0x58, 0x10, 0x8a, 0x14, 0x58, 0x21, 0x0a, 0x1c, 0x58, 0x52, 0x8a, 0x24, 0xf1, 0x83,
+    0xf2, 0x84, 0xf5, 0x85, 0xf1, 0x06, 0x47, 0xc0, 0x04, 0x12, 0x58, 0x10, 0x8a, 0x2c, 0x59, 0xce,
+    0x0a, 0x38, 0x83, 0xc3, 0xf1, 0x86, 0x15, 0xcf, 0x80, 0x07, 0x50, 0x90, 0x00, 0x14, 0x50, 0x80,
+    0x00, 0x20, 0x50, 0x60, 0x00, 0x24, 0x50, 0x70, 0x00, 0x0e, 0x85, 0x40, 0xf2, 0x01, 0x80, 0xbe,
+    0xb7, 0x42, 0xa4, 0x43, 0xa6, 0x85, 0x54, 0x10, 0x81, 0xff, 0x54, 0x21, 0x00, 0x0f, 0x40, 0x10,
+    0xc0, 0x08, 0x40, 0x10, 0x88, 0x04, 0xf2, 0x02, 0x80, 0x85, 0xb6, 0x22, 0xa4, 0x85, 0xa4, 0x44,
+    0x54, 0x21, 0x0f, 0xff, 0x40, 0x21, 0x40, 0x08, 0x54, 0x10, 0x8f, 0xff, 0x40, 0x11, 0x04, 0x04,
+    0xf2, 0x03, 0x80, 0x64, 0xb6, 0x22, 0xb4, 0x29, 0xf2, 0x04, 0x47, 0xc0, 0x04, 0x12, 0xb6, 0x22,
+    0x8d, 0x41, 0x04, 0x14, 0x80, 0x01, 0xf2, 0x05, 0x59, 0xce, 0x0a, 0x00, 0xb6, 0x22, 0x50, 0x94,
+    0x80, 0x2c, 0xb4, 0x28, 0xf2, 0x06, 0xb6, 0x22, 0xb4, 0x26, 0x14, 0x1f, 0x02, 0x8d, 0xa4, 0xb8,
+    0x02, 0x13, 0xff, 0xff, 0x54, 0x21, 0x0f, 0xff, 0x40, 0x21, 0x40, 0x08, 0x54, 0x10, 0x8f, 0xff,
+    0x40, 0x11, 0x04, 0x04, 0xf2, 0x07, 0xb6, 0x22, 0xa6, 0x7a, 0x00, 0x24, 0x7f, 0xfc, 0x40, 0x10,
+    0xc0, 0x08, 0x40, 0x10, 0x88, 0x04, 0x14, 0x12, 0x82, 0x8f, 0x84, 0xa4, 0xa0, 0x71, 0x50, 0x84,
+    0x00, 0x2c, 0x14, 0x12, 0x02, 0x91, 0x50, 0x73, 0x80, 0x2c, 0x02, 0x10, 0x00, 0x16, 0x50, 0x63,
+    0x00, 0x2c, 0x50, 0x00, 0x00, 0x2c, 0x14, 0x11, 0x82, 0x9e, 0x4c, 0xa2, 0xff, 0xa9, 0x46, 0xf0,
+    0x01, 0x1c, 0x02, 0x27, 0x82, 0xa0, 0x80, 0x23, 0x80, 0x01, 0x14, 0x20, 0x82, 0x81, 0x40, 0x31,
+    0x40, 0x08, 0x84, 0x23, 0x14, 0x10, 0x02, 0xa4, 0xb6, 0x7c, 0x81, 0x5c, 0xec, 0x24, 0x3a, 0x6f,
+    0xaa, 0x84, 0xdd, 0x9e, 0x84, 0xaf, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x27, 0x85, 0x4d, 0x46, 0x00,
+    0x01, 0x1c, 0x58, 0x00, 0x01, 0xd0, 0x10, 0x50, 0x03, 0x77, 0x84, 0xa3, 0x10, 0x50, 0x03, 0x78,
+    0x84, 0xaf, 0x84, 0x60, 0x84, 0x9f, 0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x83, 0x08, 0x12, 0x50,
+    0x01, 0xb8, 0x84, 0xa2, 0x10, 0x30, 0x03, 0x73, 0x10, 0x50, 0x03, 0x72, 0x10, 0x40, 0x80, 0x10,
+    0x10, 0x30, 0x03, 0x74, 0x10, 0x30, 0x03, 0x75, 0x10, 0x40, 0x03, 0x76, 0xca, 0x09, 0x46, 0x00,
+    0x00, 0xb8, 0x58, 0x00, 0x01, 0x28, 0xa8, 0x09, 0x94, 0x2b, 0xac, 0x08, 0xd5, 0x0d, 0x84, 0x04,
+    0xac, 0x08, 0x84, 0xa1, 0xda, 0x04, 0x44, 0x01, 0xc6, 0x38, 0xd5, 0x05, 0x84, 0xa2, 0xda, 0x04,
+    0x44, 0x04, 0xe9, 0xd0, 0xa8, 0x09, 0x84, 0x00, 0x84, 0x7f, 0xd5, 0x0b, 0x9c, 0x49, 0x44, 0x50,
+    0x00, 0x20, 0x1a, 0x31, 0x00, 0x08, 0xd9, 0xfb, 0x9c, 0x01, 0x84, 0x22, 0x4c, 0x00, 0x80, 0x0b,
+    0x40, 0x20, 0x24, 0x08, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42, 0x03, 0x52, 0x98, 0x94, 0x84, 0x20,
+    0xd5, 0xee, 0x46, 0x00, 0x01, 0x19, 0x58, 0x00, 0x03, 0x08, 0x84, 0x20, 0x9e, 0xa9, 0x46, 0xf0,
+    0x01, 0x19, 0x10, 0x17, 0x83, 0x05, 0x14, 0x20, 0x00, 0x09, 0x14, 0x10, 0x00, 0x0b, 0x14, 0x20,
+    0x00, 0x08, 0x14, 0x10, 0x00, 0x0a, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xc4, 0x96, 0x01,
+    0x50, 0x20, 0x00, 0x08, 0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x83, 0x08, 0x38, 0x10, 0x8a, 0x02,
+    0xf0, 0x81, 0x9c, 0x89, 0x5c, 0xf1, 0x00, 0x20, 0xe8, 0x02, 0xd5, 0x03, 0x50, 0x20, 0xff, 0xe1,
+    0xf0, 0x01, 0x46, 0x30, 0x01, 0x19, 0x58, 0x31, 0x83, 0x08, 0x50, 0x40, 0x00, 0x0a, 0x38, 0x31,
+    0x92, 0x02, 0x96, 0x91, 0x4c, 0x21, 0xc0, 0x04, 0x48, 0x00, 0x04, 0x82, 0xe2, 0x43, 0xe8, 0x02,
+    0xd5, 0x03, 0x50, 0x31, 0x80, 0x20, 0x9a, 0x9a, 0x96, 0x91, 0x5c, 0xf1, 0x00, 0x21, 0xe9, 0x12,
+    0x50, 0x20, 0x80, 0x10, 0x5c, 0xf1, 0x00, 0x20, 0xe9, 0x03, 0x50, 0x20, 0xff, 0xf0, 0xf0, 0x01,
+    0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x83, 0x08, 0x50, 0x30, 0x00, 0x0c, 0x38, 0x20, 0x8e, 0x0a,
+    0xd5, 0x10, 0x98, 0x51, 0x5c, 0xf0, 0x80, 0x20, 0xe9, 0x03, 0x50, 0x10, 0xff, 0xe0, 0xf2, 0x01,
+    0x50, 0x31, 0x00, 0x0c, 0x46, 0x20, 0x01, 0x19, 0x58, 0x21, 0x03, 0x08, 0x38, 0x11, 0x0e, 0x0a,
+    0xf3, 0x01, 0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x83, 0x08, 0x50, 0x21, 0x80, 0x0c, 0x38, 0x10,
+    0x8a, 0x02, 0x9c, 0x89, 0x5c, 0xf1, 0x00, 0x20, 0xe8, 0x03, 0xf2, 0x86, 0xd5, 0x04, 0x50, 0x40,
+    0xff, 0xe1, 0xf4, 0x86, 0xf6, 0x01, 0x46, 0x00, 0x01, 0x19, 0x58, 0x00, 0x03, 0x48, 0x95, 0xb5,
+    0x98, 0xf1, 0x94, 0xdc, 0xf2, 0x06, 0x98, 0x18, 0xf6, 0x84, 0xf0, 0x88, 0xf1, 0x82, 0xe0, 0x22,
+    0xe8, 0x04, 0x50, 0x30, 0x80, 0x20, 0xf3, 0x82, 0xf6, 0x01, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x37,
+    0x85, 0x4d, 0x46, 0x20, 0x01, 0x19, 0x58, 0x21, 0x03, 0x08, 0x50, 0x43, 0x00, 0x08, 0x38, 0x11,
+    0x12, 0x0a, 0xcb, 0x0c, 0x44, 0x10, 0x01, 0x80, 0x83, 0x82, 0x42, 0x83, 0x04, 0x24, 0xf0, 0x02,
+    0x51, 0xe3, 0x00, 0x1c, 0x81, 0x26, 0x48, 0x00, 0x03, 0x5f, 0x46, 0x10, 0x01, 0x19, 0x58, 0x10,
+    0x82, 0xfc, 0xb4, 0xa1, 0x44, 0x30, 0xde, 0xa8, 0x56, 0x52, 0x80, 0x08, 0x44, 0x40, 0x17, 0x70,
+    0x40, 0x12, 0x14, 0x1b, 0x40, 0x11, 0x94, 0x1a, 0x92, 0x21, 0x9e, 0x4a, 0xf0, 0x01, 0xf1, 0x83,
+    0x44, 0x10, 0x01, 0x80, 0x42, 0x80, 0x04, 0x24, 0x04, 0x9f, 0x80, 0x01, 0x83, 0x82, 0xf0, 0x02,
+    0x51, 0xe4, 0x80, 0x1c, 0x48, 0x00, 0x00, 0xd8, 0xf3, 0x04, 0x54, 0x10, 0x00, 0x1f, 0x98, 0x8b,
+    0x94, 0x94, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42, 0x03, 0x48, 0xf6, 0x08, 0x99, 0x54, 0xb4, 0x45,
+    0xb4, 0xc6, 0x4c, 0x23, 0x00, 0x17, 0xf0, 0x01, 0x44, 0x10, 0x01, 0x80, 0x42, 0x10, 0x04, 0x24,
+    0x84, 0xa0, 0xf1, 0x87, 0x46, 0xf0, 0x01, 0x19, 0x02, 0x17, 0x81, 0x84, 0xf1, 0x8b, 0x46, 0xf0,
+    0x01, 0x19, 0x04, 0x17, 0x80, 0xbf, 0xf1, 0x85, 0xf1, 0x07, 0xf1, 0x83, 0x48, 0x00, 0x02, 0x2f,
+    0x84, 0x5f, 0xac, 0xad, 0x9f, 0xc1, 0xf1, 0x85, 0x84, 0xcc, 0x85, 0x40, 0xf0, 0x87, 0x48, 0x00,
+    0x00, 0xa5, 0xf3, 0x04, 0x54, 0x13, 0x80, 0x1f, 0x98, 0x4b, 0x94, 0x4c, 0x46, 0x40, 0x01, 0x19,
+    0x58, 0x42, 0x03, 0x48, 0x98, 0x0c, 0xb4, 0x20, 0xb4, 0x45, 0x9c, 0x4a, 0xe2, 0x22, 0x4e, 0xf3,
+    0x00, 0x99, 0xa4, 0x6c, 0xa4, 0x84, 0x98, 0x4a, 0x96, 0x49, 0x4e, 0x93, 0x00, 0x07, 0x5c, 0xf0,
+    0x82, 0x58, 0xe8, 0x0a, 0x84, 0x28, 0xd5, 0x09, 0x84, 0x41, 0x4c, 0x91, 0x40, 0x03, 0xd5, 0x04,
+    0x84, 0x62, 0x4c, 0x91, 0xc0, 0x05, 0x92, 0x23, 0x12, 0x1e, 0x00, 0x04, 0xa4, 0x44, 0xa4, 0xac,
+    0xe2, 0x22, 0xe9, 0x05, 0x02, 0x3e, 0x00, 0x04, 0x9a, 0x4a, 0xd5, 0x04, 0x02, 0x3e, 0x00, 0x04,
+    0x9a, 0x51, 0x40, 0x11, 0x84, 0x07, 0x56, 0x10, 0x80, 0x01, 0xc1, 0x6e, 0xa0, 0xc1, 0xa0, 0xa9,
+    0xe2, 0x62, 0xe9, 0x06, 0x46, 0x40, 0x04, 0x00, 0x98, 0x54, 0x9a, 0xcb, 0xd5, 0x02, 0x9a, 0xd3,
+    0xf1, 0x03, 0xe2, 0x61, 0xe9, 0x5c, 0xbc, 0x01, 0x40, 0x12, 0x04, 0x09, 0xe2, 0x23, 0xe9, 0x57,
+    0x38, 0x4e, 0x79, 0x01, 0x80, 0x28, 0x42, 0x12, 0x18, 0x73, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42,
+    0x03, 0x08, 0x98, 0x4c, 0xf4, 0x05, 0x54, 0x23, 0x80, 0x1f, 0x12, 0x40, 0x82, 0x20, 0x80, 0x88,
+    0x38, 0x1e, 0x79, 0x01, 0x42, 0x40, 0x98, 0x73, 0x80, 0x24, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42,
+    0x03, 0x08, 0x98, 0x4c, 0xa5, 0x2c, 0x12, 0x40, 0x82, 0x21, 0x80, 0x88, 0x38, 0x1e, 0x79, 0x01,
+    0x42, 0x40, 0x98, 0x73, 0x80, 0x24, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42, 0x03, 0x08, 0x98, 0x4c,
+    0x12, 0x20, 0x82, 0x22, 0x80, 0x48, 0x38, 0x1e, 0x79, 0x01, 0xa4, 0x04, 0x42, 0x20, 0x98, 0x73,
+    0x98, 0x54, 0x12, 0x00, 0x82, 0x23, 0x80, 0x88, 0x38, 0x1e, 0x79, 0x01, 0x46, 0x00, 0x01, 0x19,
+    0x58, 0x00, 0x03, 0x08, 0x42, 0x40, 0x98, 0x73, 0x44, 0x20, 0xff, 0xff, 0x98, 0x60, 0x14, 0x30,
+    0x81, 0x12, 0xa4, 0x6d, 0x4c, 0x11, 0x40, 0x05, 0x38, 0x3e, 0x79, 0x01, 0xac, 0xed, 0x38, 0x4e,
+    0x79, 0x01, 0xad, 0x2e, 0x38, 0x1e, 0x79, 0x01, 0x9c, 0x49, 0x96, 0x49, 0x38, 0x1e, 0x79, 0x09,
+    0x5c, 0xf0, 0x80, 0x20, 0xe9, 0x09, 0x38, 0xae, 0x79, 0x09, 0xd5, 0x06, 0xbc, 0x01, 0x40, 0x12,
+    0x04, 0x09, 0xe2, 0x23, 0xe9, 0x06, 0x9f, 0xf9, 0xf0, 0x06, 0xe0, 0x07, 0x4e, 0xf3, 0xff, 0x5b,
+    0xf0, 0x07, 0x9e, 0x01, 0xf1, 0x06, 0xe0, 0x20, 0x4e, 0xf3, 0xff, 0x28, 0x48, 0xff, 0xff, 0x35,
+    0xf2, 0x02, 0xf3, 0x04, 0x54, 0x01, 0x00, 0x1f, 0x98, 0x03, 0x94, 0x04, 0x46, 0x40, 0x01, 0x19,
+    0x58, 0x42, 0x03, 0x48, 0xf6, 0x08, 0x98, 0x04, 0xb4, 0x20, 0xb4, 0xc6, 0x4c, 0x13, 0x41, 0x6c,
+    0xa4, 0x45, 0x44, 0x20, 0xff, 0xff, 0x4c, 0x11, 0x01, 0x5f, 0xf2, 0x07, 0x84, 0x6c, 0x42, 0x20,
+    0x8c, 0x73, 0x50, 0x42, 0x04, 0x04, 0xa4, 0x06, 0x41, 0xe1, 0x10, 0x00, 0x50, 0x40, 0x80, 0x1f,
+    0xf0, 0x89, 0x83, 0x84, 0x48, 0x00, 0x01, 0x4a, 0x02, 0x0f, 0x00, 0x00, 0xf6, 0x04, 0x46, 0x10,
+    0x01, 0x19, 0x58, 0x10, 0x83, 0x48, 0x98, 0x30, 0x94, 0x04, 0x98, 0x01, 0xa4, 0x45, 0x44, 0x20,
+    0xff, 0xff, 0x4c, 0x11, 0x01, 0x37, 0xa4, 0x06, 0xf2, 0x07, 0x84, 0x6c, 0x42, 0x20, 0x8c, 0x73,
+    0xf0, 0x8a, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42, 0x07, 0x4c, 0x04, 0x9f, 0x00, 0x01, 0x80, 0xe1,
+    0x15, 0xef, 0x80, 0x0c, 0x15, 0xcf, 0x80, 0x0d, 0x83, 0xc8, 0x40, 0xa1, 0x10, 0x00, 0x83, 0x85,
+    0x04, 0x8f, 0x80, 0x0b, 0xd5, 0x7d, 0x02, 0x05, 0x00, 0x00, 0x4d, 0xe3, 0x80, 0x78, 0xf6, 0x04,
+    0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x83, 0x48, 0x98, 0x30, 0x94, 0x04, 0x98, 0x01, 0xa4, 0x05,
+    0x44, 0x20, 0xff, 0xff, 0x4c, 0x01, 0x00, 0x6b, 0x04, 0x45, 0x00, 0x01, 0xe3, 0x24, 0xe9, 0x04,
+    0x40, 0x04, 0x90, 0x01, 0xd5, 0x03, 0x40, 0x02, 0x24, 0x01, 0x40, 0x04, 0x00, 0x06, 0x56, 0x00,
+    0x00, 0x01, 0xc0, 0x5c, 0xf3, 0x01, 0xe6, 0x63, 0xe8, 0x59, 0x50, 0x63, 0x80, 0x1f, 0x84, 0xa0,
+    0x84, 0x61, 0xe2, 0xe3, 0xe8, 0x03, 0x80, 0x06, 0xd5, 0x02, 0x9a, 0x3b, 0xf1, 0x03, 0x84, 0x4c,
+    0x42, 0x10, 0x08, 0x73, 0x80, 0x01, 0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x83, 0x08, 0x98, 0x01,
+    0x04, 0x00, 0x01, 0x12, 0x9a, 0x84, 0x9a, 0x60, 0x40, 0x24, 0x08, 0x06, 0x40, 0x14, 0x04, 0x06,
+    0xe2, 0x04, 0xe9, 0x04, 0x56, 0x11, 0x00, 0x01, 0xd5, 0x03, 0x56, 0x10, 0x80, 0x01, 0x9c, 0xd9,
+    0xc1, 0x02, 0x9d, 0x69, 0x44, 0x20, 0x00, 0x32, 0x9f, 0xb1, 0x4c, 0x31, 0x7f, 0xdc, 0xe6, 0xa3,
+    0xe9, 0x2d, 0x46, 0x30, 0x01, 0x12, 0x58, 0x31, 0x81, 0x54, 0xd5, 0x1b, 0xc9, 0x02, 0xd5, 0x18,
+    0xa0, 0x5b, 0x02, 0x01, 0x80, 0x0c, 0xc1, 0x0c, 0x9a, 0x48, 0xe2, 0x24, 0xe8, 0x11, 0xa0, 0x5c,
+    0x84, 0xc1, 0x98, 0x01, 0x40, 0x02, 0x00, 0x06, 0x41, 0xc3, 0x00, 0x1b, 0xd5, 0x09, 0xa0, 0x5d,
+    0x98, 0x81, 0x9a, 0x08, 0xe2, 0x04, 0xe8, 0x04, 0xe2, 0x82, 0x4e, 0xf3, 0x00, 0xab, 0x8c, 0x7c,
+    0xa4, 0x18, 0xf2, 0x05, 0x44, 0x60, 0x00, 0xff, 0x40, 0x10, 0x08, 0x02, 0x4c, 0x03, 0x7f, 0xe0,
+    0x84, 0x01, 0x4d, 0xc0, 0x40, 0x04, 0x48, 0x00, 0x00, 0x9d, 0x9d, 0xf9, 0x8d, 0x4c, 0xf1, 0x0a,
+    0xe2, 0x27, 0xe8, 0x82, 0xf2, 0x01, 0x81, 0x1e, 0x80, 0xbc, 0x05, 0xef, 0x80, 0x0c, 0x05, 0xcf,
+    0x80, 0x0d, 0xe6, 0x43, 0xe8, 0x2b, 0x44, 0x3f, 0x90, 0x6f, 0x40, 0x14, 0x8c, 0x00, 0xe6, 0x33,
+    0xe8, 0x25, 0x80, 0x7c, 0x84, 0x40, 0x84, 0x21, 0xe3, 0x01, 0xe9, 0x04, 0x40, 0x04, 0x04, 0x01,
+    0xd5, 0x02, 0x80, 0x03, 0xf4, 0x03, 0x84, 0xcc, 0x42, 0x40, 0x18, 0x73, 0x44, 0x6f, 0x90, 0x6f,
+    0x80, 0x04, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42, 0x03, 0x08, 0x98, 0x04, 0x04, 0x00, 0x01, 0x12,
+    0x9c, 0x49, 0x98, 0x06, 0x9e, 0xd9, 0xe6, 0x13, 0xe8, 0x02, 0x9c, 0x91, 0x44, 0x00, 0x00, 0x32,
+    0x4c, 0x10, 0x7f, 0xe4, 0xe4, 0x44, 0xe9, 0x02, 0xd5, 0x64, 0xf1, 0x05, 0x84, 0x44, 0x4c, 0x11,
+    0x40, 0x31, 0xf3, 0x01, 0xe6, 0x63, 0xe8, 0x65, 0x44, 0x4e, 0xc7, 0xb1, 0x40, 0x04, 0x90, 0x00,
+    0x5c, 0xf0, 0x00, 0x63, 0xe8, 0x5e, 0x80, 0x7c, 0x84, 0x40, 0x84, 0x21, 0xe3, 0x01, 0xe9, 0x04,
+    0x40, 0x04, 0x04, 0x01, 0xd5, 0x02, 0x80, 0x03, 0xf6, 0x03, 0x84, 0x8c, 0x42, 0x60, 0x10, 0x73,
+    0x44, 0x4e, 0xc7, 0xb1, 0x80, 0x06, 0x46, 0x60, 0x01, 0x19, 0x58, 0x63, 0x03, 0x08, 0x98, 0x06,
+    0x04, 0x00, 0x01, 0x12, 0x9c, 0x49, 0x98, 0x04, 0x9e, 0xd9, 0x5c, 0xf0, 0x00, 0x63, 0xe8, 0x02,
+    0x9c, 0x91, 0x44, 0x60, 0x00, 0x32, 0x4c, 0x13, 0x7f, 0xe3, 0xe4, 0x44, 0xe9, 0x3a, 0xd5, 0x31,
+    0xf0, 0x05, 0x84, 0x28, 0x4c, 0x00, 0xc0, 0x36, 0xf2, 0x01, 0xe6, 0x43, 0xe8, 0x32, 0x44, 0x3e,
+    0xd3, 0x91, 0x40, 0x04, 0x8c, 0x00, 0xe6, 0x19, 0xe8, 0x2c, 0x80, 0x7c, 0x84, 0x40, 0x84, 0x21,
+    0xe3, 0x01, 0xe9, 0x04, 0x40, 0x04, 0x04, 0x01, 0xd5, 0x02, 0x80, 0x03, 0xf4, 0x03, 0x84, 0xcc,
+    0x42, 0x40, 0x18, 0x73, 0x44, 0x6e, 0xd3, 0x91, 0x80, 0x04, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42,
+    0x03, 0x08, 0x98, 0x04, 0x04, 0x00, 0x01, 0x12, 0x9c, 0x49, 0x98, 0x06, 0x9e, 0xd9, 0xe6, 0x19,
+    0xe8, 0x02, 0x9c, 0x91, 0x44, 0x00, 0x00, 0x32, 0x4c, 0x10, 0x7f, 0xe4, 0xe4, 0x43, 0xe9, 0x09,
+    0x84, 0x21, 0x46, 0xf0, 0x01, 0x19, 0x10, 0x17, 0x83, 0x05, 0x84, 0xa1, 0x48, 0x00, 0x01, 0xb9,
+    0x51, 0xef, 0x00, 0x0c, 0x51, 0xce, 0x00, 0x01, 0xf1, 0x09, 0x50, 0x8e, 0x7f, 0xe1, 0xe2, 0x28,
+    0x4e, 0xf2, 0xfe, 0xb4, 0xf2, 0x02, 0x9e, 0x91, 0xf2, 0x82, 0xf3, 0x06, 0xf4, 0x02, 0xe0, 0x64,
+    0x4e, 0xf3, 0xfe, 0x88, 0x46, 0xf0, 0x01, 0x19, 0x10, 0x57, 0x83, 0x05, 0x48, 0x00, 0x01, 0xa1,
+    0xf6, 0x04, 0x54, 0x10, 0x00, 0x1f, 0x98, 0x8e, 0x94, 0x94, 0x46, 0x30, 0x01, 0x19, 0x58, 0x31,
+    0x83, 0x48, 0xf4, 0x08, 0x99, 0x53, 0xb4, 0xc5, 0xb4, 0x84, 0x4c, 0x62, 0x00, 0x11, 0xf6, 0x01,
+    0x44, 0x10, 0x01, 0x80, 0x42, 0x13, 0x04, 0x24, 0xf1, 0x83, 0x46, 0xf0, 0x01, 0x19, 0x02, 0x17,
+    0x81, 0x84, 0xf0, 0x03, 0xf1, 0x85, 0xf0, 0x8a, 0x48, 0x00, 0x01, 0x78, 0x84, 0x5f, 0xac, 0xad,
+    0x9f, 0xc1, 0xf1, 0x83, 0x84, 0xcc, 0x85, 0x40, 0xf0, 0x85, 0x48, 0x00, 0x00, 0xb7, 0xf3, 0x04,
+    0x54, 0x13, 0x80, 0x1f, 0x98, 0x4b, 0x94, 0x4c, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42, 0x03, 0x48,
+    0x98, 0x0c, 0xb4, 0x20, 0xb4, 0x45, 0x9c, 0x4c, 0xe2, 0x22, 0x4e, 0xf3, 0x00, 0xab, 0xa4, 0xc4,
+    0xa4, 0xac, 0x98, 0x53, 0x96, 0x49, 0x4e, 0x93, 0x00, 0x17, 0x5c, 0xf1, 0x81, 0x2d, 0xe9, 0x05,
+    0x5c, 0xf1, 0x01, 0x2c, 0x4e, 0xf3, 0x00, 0x99, 0x5c, 0xf1, 0x01, 0x2d, 0xe9, 0x05, 0x5c, 0xf1,
+    0x81, 0x2c, 0x4e, 0xf3, 0x00, 0x92, 0x5c, 0xf0, 0x82, 0x6c, 0xe8, 0x03, 0x94, 0x71, 0xd5, 0x0c,
+    0x84, 0x28, 0xd5, 0x0a, 0x84, 0x41, 0x4c, 0x91, 0x40, 0x04, 0x92, 0x23, 0xd5, 0x05, 0x84, 0x62,
+    0x4c, 0x91, 0xc0, 0x05, 0x92, 0x26, 0x12, 0x1e, 0x00, 0x04, 0xa4, 0x44, 0xa4, 0xac, 0xe2, 0x22,
+    0xe9, 0x05, 0x02, 0x3e, 0x00, 0x04, 0x9a, 0x4a, 0xd5, 0x04, 0x02, 0x3e, 0x00, 0x04, 0x9a, 0x51,
+    0x40, 0x11, 0x84, 0x07, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char firmware3[] = {
+    0x00, 0x38, 0x00, 0x10, 0x56, 0x10, 0x80, 0x01, 0xc1, 0x6f, 0xa0, 0xc1, 0xa0, 0xa9, 0xe2, 0x62,
+    0xe9, 0x06, 0x46, 0x40, 0x04, 0x00, 0x98, 0x54, 0x9a, 0xcb, 0xd5, 0x02, 0x9a, 0xd3, 0x44, 0x10,
+    0x41, 0x05, 0xe2, 0x23, 0xe8, 0x5c, 0xbc, 0x01, 0x40, 0x12, 0x04, 0x09, 0xe2, 0x23, 0xe9, 0x57,
+    0x38, 0x4e, 0x79, 0x01, 0x80, 0x28, 0x42, 0x12, 0x18, 0x73, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42,
+    0x03, 0x08, 0x98, 0x4c, 0xf4, 0x03, 0x54, 0x23, 0x80, 0x1f, 0x12, 0x40, 0x82, 0x20, 0x80, 0x88,
+    0x38, 0x1e, 0x79, 0x01, 0x42, 0x40, 0x98, 0x73, 0x80, 0x24, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42,
+    0x03, 0x08, 0x98, 0x4c, 0xa5, 0x2c, 0x12, 0x40, 0x82, 0x21, 0x80, 0x88, 0x38, 0x1e, 0x79, 0x01,
+    0x42, 0x40, 0x98, 0x73, 0x80, 0x24, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42, 0x03, 0x08, 0x98, 0x4c,
+    0x12, 0x20, 0x82, 0x22, 0x80, 0x48, 0x38, 0x1e, 0x79, 0x01, 0xa4, 0x04, 0x42, 0x20, 0x98, 0x73,
+    0x98, 0x54, 0x12, 0x00, 0x82, 0x23, 0x80, 0x88, 0x38, 0x1e, 0x79, 0x01, 0x46, 0x00, 0x01, 0x19,
+    0x58, 0x00, 0x03, 0x08, 0x42, 0x40, 0x98, 0x73, 0x44, 0x20, 0xff, 0xff, 0x98, 0x60, 0x14, 0x30,
+    0x81, 0x12, 0xa4, 0x6d, 0x4c, 0x11, 0x40, 0x05, 0x38, 0x3e, 0x79, 0x01, 0xac, 0xed, 0x38, 0x4e,
+    0x79, 0x01, 0xad, 0x2e, 0x38, 0x1e, 0x79, 0x01, 0x9c, 0x49, 0x96, 0x49, 0x38, 0x1e, 0x79, 0x09,
+    0x5c, 0xf0, 0x80, 0x20, 0xe9, 0x09, 0x38, 0xae, 0x79, 0x09, 0xd5, 0x06, 0xbc, 0x01, 0x40, 0x12,
+    0x04, 0x09, 0xe2, 0x23, 0xe9, 0x06, 0x9f, 0xf9, 0xf0, 0x06, 0xe0, 0x07, 0x4e, 0xf3, 0xff, 0x49,
+    0xf0, 0x05, 0x9e, 0x01, 0xf1, 0x06, 0xe0, 0x20, 0x4e, 0xf3, 0xff, 0x1c, 0x48, 0xff, 0xff, 0x29,
+    0xf2, 0x02, 0xf3, 0x04, 0x54, 0x01, 0x00, 0x1f, 0x98, 0x03, 0x94, 0x04, 0x46, 0x40, 0x01, 0x19,
+    0x58, 0x42, 0x03, 0x48, 0xf6, 0x08, 0x98, 0x04, 0xb4, 0x20, 0xb4, 0xc6, 0x4c, 0x13, 0x40, 0xa3,
+    0xa4, 0x45, 0x44, 0x20, 0xff, 0xff, 0x4c, 0x11, 0x00, 0x96, 0xf2, 0x03, 0x84, 0x6c, 0x42, 0x20,
+    0x8c, 0x73, 0xa4, 0x06, 0x50, 0x42, 0x04, 0x04, 0x83, 0x81, 0xf0, 0x87, 0x41, 0xe1, 0x10, 0x00,
+    0x04, 0x9f, 0x80, 0x05, 0x48, 0x00, 0x00, 0x83, 0x02, 0x0f, 0x00, 0x00, 0xf6, 0x04, 0x46, 0x10,
+    0x01, 0x19, 0x58, 0x10, 0x83, 0x48, 0x98, 0x30, 0x94, 0x04, 0x98, 0x01, 0xa4, 0x45, 0x44, 0x20,
+    0xff, 0xff, 0x4c, 0x11, 0x00, 0x70, 0xf2, 0x03, 0xa4, 0x06, 0x84, 0x6c, 0x42, 0x20, 0x8c, 0x73,
+    0xf0, 0x89, 0x46, 0x40, 0x01, 0x19, 0x58, 0x42, 0x07, 0x4c, 0x80, 0xc1, 0x99, 0xd4, 0x04, 0x8f,
+    0x00, 0x01, 0xd5, 0x5d, 0xa4, 0x38, 0x4d, 0xc3, 0x00, 0x59, 0xf1, 0x04, 0x46, 0x20, 0x01, 0x19,
+    0x58, 0x21, 0x03, 0x48, 0x98, 0x08, 0x94, 0x04, 0x98, 0x02, 0xa4, 0x05, 0x44, 0x30, 0xff, 0xff,
+    0x4c, 0x01, 0x80, 0x4c, 0xa0, 0xf9, 0xe3, 0x03, 0xe9, 0x04, 0x40, 0x04, 0x0c, 0x01, 0xd5, 0x03,
+    0x40, 0x01, 0xa0, 0x01, 0x40, 0x04, 0x80, 0x06, 0x56, 0x00, 0x00, 0x01, 0xc0, 0x3e, 0xf4, 0x01,
+    0xe6, 0x83, 0xe8, 0x3b, 0x44, 0x00, 0x82, 0x35, 0xe2, 0x03, 0xe8, 0x37, 0x50, 0x53, 0x00, 0x1f,
+    0x85, 0x40, 0x84, 0x81, 0xe2, 0xc4, 0xe8, 0x03, 0x80, 0x05, 0xd5, 0x02, 0x9a, 0x34, 0xf1, 0x0a,
+    0x84, 0x4c, 0x42, 0x10, 0x08, 0x73, 0x80, 0x01, 0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x83, 0x08,
+    0x98, 0x01, 0x04, 0x00, 0x01, 0x12, 0x9a, 0x83, 0x9a, 0x58, 0x40, 0x24, 0x88, 0x06, 0x40, 0x14,
+    0x84, 0x06, 0xe2, 0x03, 0xe9, 0x04, 0x56, 0x11, 0x00, 0x01, 0xd5, 0x03, 0x56, 0x10, 0x80, 0x01,
+    0x9d, 0x21, 0xc1, 0x02, 0x8d, 0x41, 0x44, 0x20, 0x00, 0x32, 0x9f, 0x69, 0x4c, 0x41, 0x7f, 0xdc,
+    0xe7, 0x43, 0xe9, 0x0b, 0x84, 0x20, 0x56, 0x05, 0x00, 0x03, 0x40, 0x50, 0x80, 0x06, 0x46, 0xf0,
+    0x01, 0x19, 0x10, 0x57, 0x83, 0x05, 0xd5, 0x1c, 0x9d, 0xb1, 0x8c, 0xec, 0xf3, 0x09, 0xe2, 0x66,
+    0xe8, 0xa2, 0x51, 0xce, 0x00, 0x01, 0x51, 0xef, 0x00, 0x0c, 0xf4, 0x07, 0xe2, 0x9c, 0x4e, 0xf2,
+    0xff, 0x7d, 0xf6, 0x02, 0x9f, 0xb1, 0xf6, 0x82, 0xf0, 0x06, 0xf1, 0x02, 0xe0, 0x01, 0x4e, 0xf3,
+    0xff, 0x51, 0x84, 0x20, 0x46, 0xf0, 0x01, 0x19, 0x10, 0x17, 0x83, 0x05, 0x84, 0xa0, 0x80, 0x05,
+    0xec, 0x3c, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x82, 0xfc,
+    0x00, 0x00, 0x80, 0x08, 0x46, 0x20, 0x04, 0x11, 0x04, 0x41, 0x00, 0x47, 0x9c, 0xc1, 0x96, 0xd8,
+    0xa1, 0x49, 0x10, 0x30, 0x80, 0x08, 0xa9, 0x09, 0xc0, 0x0e, 0x46, 0x20, 0x0c, 0x00, 0x9b, 0x25,
+    0xe2, 0x44, 0xe9, 0x05, 0x84, 0x01, 0x40, 0x00, 0x0c, 0x06, 0xd5, 0x05, 0x84, 0x01, 0x10, 0x00,
+    0x80, 0x08, 0x84, 0x00, 0xdd, 0x9e, 0x92, 0x00, 0x3b, 0xff, 0xfc, 0xbc, 0xef, 0xfc, 0x96, 0x48,
+    0x4e, 0x22, 0x00, 0x87, 0x4e, 0x32, 0x00, 0x85, 0xa4, 0x00, 0x84, 0xa4, 0xd8, 0x2f, 0xe6, 0x23,
+    0xe8, 0x60, 0x5c, 0xf1, 0x80, 0x78, 0xe8, 0x0e, 0x5c, 0xf1, 0x0b, 0x54, 0xe9, 0x79, 0x50, 0x01,
+    0x6d, 0xa3, 0x5c, 0xf0, 0x06, 0xa3, 0xe9, 0x74, 0x50, 0x01, 0x65, 0x6f, 0x44, 0x10, 0x51, 0x16,
+    0xd5, 0x0b, 0x5c, 0xf1, 0x80, 0x82, 0xe8, 0x48, 0x5c, 0xf1, 0x0b, 0x54, 0xe9, 0x69, 0x50, 0x01,
+    0x58, 0x8b, 0x44, 0x10, 0x44, 0x32, 0xe2, 0x20, 0xe8, 0x63, 0x44, 0x1f, 0x92, 0xc7, 0x98, 0x11,
+    0x5c, 0xf0, 0x01, 0x8f, 0xe9, 0x5d, 0x44, 0x4f, 0x8f, 0xe3, 0x98, 0x14, 0x44, 0x10, 0xc7, 0xfe,
+    0xe2, 0x20, 0xe8, 0x56, 0x44, 0x01, 0x38, 0xe5, 0xd5, 0x50, 0x84, 0xa2, 0xd8, 0x0e, 0xe6, 0x23,
+    0xe8, 0x51, 0x5c, 0xf1, 0x13, 0x24, 0xe9, 0x4c, 0x50, 0x01, 0x58, 0x27, 0x5c, 0xf0, 0x08, 0x97,
+    0xe9, 0x47, 0x44, 0x01, 0x87, 0x05, 0xd5, 0x41, 0x84, 0xa1, 0xd8, 0x2b, 0xe6, 0x23, 0xe8, 0x21,
+    0x5c, 0xf1, 0x80, 0x78, 0xe8, 0x11, 0x5c, 0xf1, 0x0b, 0x54, 0xe9, 0x3a, 0x50, 0x01, 0x6d, 0xa3,
+    0x5c, 0xf0, 0x06, 0xa3, 0xe9, 0x35, 0x50, 0x01, 0x65, 0x6f, 0x5c, 0xf0, 0x0d, 0x47, 0xe9, 0x30,
+    0x44, 0x00, 0xf0, 0xa1, 0xd5, 0x2a, 0x5c, 0xf1, 0x80, 0x82, 0xe8, 0x06, 0x50, 0x21, 0x74, 0xac,
+    0x44, 0x00, 0xe5, 0x4d, 0xd5, 0x22, 0x50, 0x21, 0x70, 0xc4, 0x5c, 0x01, 0x18, 0x39, 0xd5, 0x23,
+    0x84, 0xa3, 0xd9, 0x20, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x82, 0xb4, 0xdd, 0x2f, 0xd5, 0x1b,
+    0x84, 0xa8, 0xd8, 0x18, 0xe6, 0x23, 0xe8, 0x16, 0x5c, 0xf1, 0x80, 0x83, 0xe8, 0x11, 0x44, 0x00,
+    0x6e, 0xc7, 0xe2, 0x02, 0xe8, 0x0d, 0x44, 0x1f, 0x8f, 0xe3, 0x98, 0x11, 0x44, 0x10, 0xbc, 0x46,
+    0xe2, 0x20, 0xe8, 0x06, 0x44, 0x01, 0x2c, 0x8d, 0x40, 0x01, 0x00, 0x06, 0xd5, 0x04, 0x84, 0x00,
+    0xd5, 0x02, 0x84, 0x01, 0xec, 0x04, 0x3b, 0xff, 0xfc, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc,
+    0xef, 0xec, 0x96, 0x00, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x27, 0x85, 0x4d, 0xf0, 0x83, 0x84, 0x01,
+    0x4c, 0x20, 0x40, 0x08, 0x46, 0x10, 0x01, 0x12, 0x58, 0x10, 0x82, 0xdc, 0xf1, 0x82, 0xd5, 0x1c,
+    0xca, 0x07, 0x46, 0x40, 0x01, 0x12, 0x58, 0x42, 0x03, 0xbc, 0xf4, 0x82, 0xd5, 0x15, 0x46, 0xf0,
+    0x01, 0x1c, 0x00, 0x37, 0x85, 0x4e, 0x46, 0x10, 0x01, 0x12, 0x58, 0x10, 0x85, 0x7c, 0x50, 0x31,
+    0xff, 0xcc, 0x96, 0xd8, 0x5c, 0x31, 0x80, 0x0d, 0x50, 0x20, 0xff, 0x20, 0x40, 0x00, 0x8c, 0x1b,
+    0x40, 0x01, 0x0c, 0x1a, 0xf0, 0x82, 0x46, 0x80, 0x04, 0x12, 0x58, 0x84, 0x0a, 0x58, 0x50, 0x54,
+    0x7f, 0xa8, 0x80, 0x28, 0x84, 0xc0, 0x47, 0xc0, 0x04, 0x12, 0x81, 0x5c, 0x81, 0x2a, 0x81, 0x05,
+    0x80, 0xe6, 0x80, 0xa1, 0xf1, 0x03, 0x40, 0x20, 0x98, 0x0e, 0x96, 0x94, 0xc2, 0x1d, 0x46, 0xf0,
+    0x01, 0x1c, 0x02, 0x27, 0x82, 0xa0, 0x80, 0x26, 0x40, 0x21, 0x40, 0x08, 0x40, 0x23, 0x08, 0x04,
+    0xb6, 0x48, 0x04, 0x2e, 0x02, 0x93, 0xf0, 0x02, 0x04, 0x35, 0x02, 0x94, 0x04, 0x44, 0x82, 0x97,
+    0xb4, 0x85, 0xf5, 0x81, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x82, 0xf4, 0xdd, 0x2f, 0x84, 0x21,
+    0xf5, 0x01, 0x40, 0x70, 0x80, 0x1b, 0x9d, 0xb1, 0x84, 0x84, 0x4c, 0x62, 0x7f, 0xdd, 0x80, 0x07,
+    0xec, 0x14, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa8, 0xbc, 0x46, 0x80, 0x04, 0x11,
+    0x46, 0x70, 0xff, 0xff, 0x40, 0x90, 0x80, 0x00, 0x58, 0x73, 0x8f, 0xfe, 0x84, 0xc0, 0x46, 0xa0,
+    0x00, 0x02, 0x58, 0xa5, 0x07, 0x50, 0x04, 0x14, 0x00, 0x47, 0x9d, 0xb1, 0x40, 0x20, 0xa4, 0x01,
+    0x84, 0x01, 0xe2, 0x29, 0xe9, 0x03, 0xe2, 0xe2, 0xe8, 0x06, 0x4b, 0xe0, 0x28, 0x01, 0x44, 0x50,
+    0x05, 0xdc, 0xde, 0xf2, 0x3a, 0x6f, 0xa8, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xa0, 0xbc,
+    0x46, 0xf0, 0x01, 0x1c, 0x00, 0x17, 0x85, 0x4c, 0x97, 0xc0, 0x84, 0xa2, 0xd1, 0x3f, 0x84, 0x08,
+    0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x82, 0x2c, 0xdd, 0x2f, 0x80, 0xc0, 0xc0, 0x37, 0xa0, 0x42,
+    0x84, 0x08, 0x12, 0x03, 0x00, 0x0c, 0xb6, 0xe1, 0x46, 0x35, 0x87, 0x08, 0x46, 0xf0, 0x01, 0x1c,
+    0x00, 0x27, 0x85, 0x4e, 0x58, 0x31, 0x80, 0x08, 0x40, 0x21, 0x20, 0x08, 0x40, 0x71, 0x1c, 0x04,
+    0xb6, 0xe1, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x27, 0x8b, 0x96, 0x46, 0x00, 0x01, 0x1b, 0x58, 0x00,
+    0x05, 0x80, 0x54, 0x21, 0x00, 0x03, 0x40, 0x21, 0x64, 0x08, 0x40, 0x21, 0x0c, 0x04, 0xa8, 0xb3,
+    0x80, 0x26, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x84, 0x90, 0xdd, 0x2f, 0xc8, 0x0f, 0x00, 0x03,
+    0x00, 0x1a, 0x46, 0x20, 0x01, 0x1a, 0x58, 0x21, 0x02, 0x18, 0x94, 0x04, 0x80, 0x26, 0x98, 0x02,
+    0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x84, 0x88, 0xdd, 0x2f, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e,
+    0x96, 0x00, 0x56, 0x00, 0x00, 0x01, 0x5c, 0x00, 0x00, 0x01, 0x58, 0x10, 0x00, 0x02, 0x46, 0x00,
+    0x04, 0x12, 0x96, 0x48, 0x14, 0x10, 0x02, 0xa4, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc,
+    0xef, 0xec, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x85, 0xbc, 0xdd, 0x2f, 0x46, 0x00,
+    0x01, 0x19, 0x58, 0x00, 0x03, 0x08, 0xa0, 0x43, 0x46, 0xa0, 0x04, 0x12, 0x9c, 0x49, 0xa8, 0x43,
+    0x87, 0x80, 0x58, 0xa5, 0x0a, 0x94, 0x81, 0x20, 0x80, 0xdf, 0xb4, 0x0a, 0x84, 0x9f, 0xb4, 0x2a,
+    0xb4, 0x4a, 0xb4, 0x6a, 0x4c, 0x02, 0x00, 0x80, 0x5e, 0x50, 0x00, 0x00, 0x85, 0x00, 0x87, 0xc2,
+    0x40, 0x8f, 0x14, 0x1b, 0x40, 0x71, 0x40, 0x09, 0x40, 0x41, 0xc0, 0x09, 0x00, 0x04, 0x80, 0x10,
+    0x40, 0x10, 0xa8, 0x08, 0x92, 0x2a, 0x54, 0x42, 0x00, 0x3f, 0x54, 0x53, 0x83, 0xff, 0x54, 0x31,
+    0x9f, 0xff, 0x54, 0x21, 0x0f, 0xff, 0xac, 0xb4, 0xad, 0x75, 0x10, 0x43, 0x00, 0x0c, 0xac, 0xf7,
+    0x10, 0x83, 0x00, 0x00, 0xa8, 0x71, 0x4c, 0x04, 0x00, 0x0e, 0x80, 0x3f, 0x84, 0x44, 0x46, 0x00,
+    0x01, 0x19, 0x58, 0x00, 0x03, 0x18, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84, 0xdd, 0x2f,
+    0xd5, 0x20, 0x9e, 0x01, 0x96, 0x00, 0xe6, 0x02, 0xe8, 0x0e, 0x04, 0x24, 0x80, 0x05, 0x02, 0x04,
+    0x80, 0x0c, 0x9a, 0x4a, 0x5c, 0xf0, 0x87, 0xd0, 0xe8, 0x06, 0x44, 0x70, 0x00, 0xc7, 0x40, 0x73,
+    0x80, 0x06, 0xd5, 0x02, 0x84, 0xe0, 0x46, 0x00, 0x01, 0x19, 0x58, 0x00, 0x03, 0x18, 0x80, 0x3f,
+    0x84, 0x44, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84, 0xdd, 0x2f, 0x84, 0xa1, 0xd7, 0x2d,
+    0xa6, 0x70, 0xe6, 0x22, 0xe8, 0x2a, 0x50, 0x00, 0x80, 0x1c, 0x47, 0xe0, 0x01, 0x19, 0x59, 0xef,
+    0x03, 0x08, 0x98, 0x00, 0x88, 0x1e, 0xa4, 0x82, 0x94, 0x4d, 0x98, 0x8a, 0x9c, 0x94, 0x04, 0x34,
+    0x80, 0x03, 0x94, 0x94, 0x88, 0x5e, 0xb6, 0x62, 0xa4, 0x82, 0xa1, 0x31, 0x98, 0x8a, 0x9c, 0x94,
+    0x94, 0x94, 0x88, 0x5e, 0xa9, 0x11, 0xa4, 0x82, 0xa5, 0x74, 0x98, 0x4a, 0x94, 0x4c, 0x88, 0x3e,
+    0x12, 0x50, 0x80, 0x24, 0xa4, 0x42, 0x9c, 0x49, 0x96, 0x49, 0xac, 0x42, 0x5c, 0xf0, 0x80, 0x20,
+    0xe9, 0x04, 0x87, 0xc0, 0x13, 0xe0, 0x00, 0x02, 0x51, 0xce, 0x00, 0x01, 0x44, 0x50, 0x00, 0x40,
+    0x4d, 0xc2, 0xff, 0x7d, 0x46, 0x30, 0x01, 0x19, 0x58, 0x31, 0x83, 0x08, 0x02, 0x41, 0x80, 0x1e,
+    0x02, 0x51, 0x80, 0x1f, 0x14, 0x41, 0x80, 0x0a, 0x14, 0x51, 0x80, 0x0b, 0x44, 0x10, 0x00, 0x67,
+    0x84, 0x40, 0x84, 0x02, 0x46, 0xf0, 0x00, 0x06, 0x58, 0xf7, 0x8c, 0x04, 0xdd, 0x2f, 0x84, 0x01,
+    0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x85, 0xbc, 0xdd, 0x2f, 0xec, 0x14, 0x3a, 0x6f, 0xaa, 0x84,
+    0xdd, 0x9e, 0x92, 0x00, 0x3b, 0xff, 0xfc, 0xbc, 0xef, 0xfc, 0x46, 0xf0, 0x00, 0x86, 0x58, 0xf7,
+    0x88, 0xa0, 0xdd, 0x2f, 0x46, 0x00, 0x01, 0x1c, 0x58, 0x00, 0x05, 0x4c, 0xa6, 0x41, 0xc9, 0x06,
+    0x46, 0x00, 0x01, 0x12, 0x58, 0x00, 0x07, 0x3c, 0xd5, 0x18, 0x84, 0xa1, 0xd9, 0x06, 0x46, 0x00,
+    0x01, 0x12, 0x58, 0x00, 0x06, 0x5c, 0xd5, 0x11, 0xa6, 0xc2, 0x46, 0x10, 0x01, 0x12, 0x58, 0x10,
+    0x86, 0x5c, 0x50, 0x31, 0xff, 0xcc, 0x96, 0xd8, 0x5c, 0x31, 0x80, 0x0d, 0x50, 0x20, 0x81, 0xc0,
+    0x40, 0x01, 0x0c, 0x1b, 0x40, 0x00, 0x8c, 0x1a, 0x46, 0xf0, 0x00, 0x86, 0x58, 0xf7, 0x86, 0x80,
+    0xdd, 0x2f, 0x84, 0x01, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x85, 0xbc, 0xdd, 0x2f, 0xec, 0x04,
+    0x3b, 0xff, 0xfc, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xa0, 0xbc, 0x84, 0x20, 0x81, 0x00,
+    0x84, 0x44, 0x46, 0x00, 0x01, 0x1c, 0x58, 0x00, 0x05, 0x4c, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7,
+    0x83, 0xc4, 0xdd, 0x2f, 0xb4, 0xc8, 0x46, 0x70, 0x01, 0x1c, 0x58, 0x73, 0x85, 0x4c, 0x92, 0xd8,
+    0xaf, 0xb8, 0x46, 0x30, 0x01, 0x12, 0xb4, 0x08, 0x92, 0x10, 0xae, 0x39, 0xb4, 0x08, 0x92, 0x08,
+    0xae, 0x3a, 0xb4, 0x08, 0xae, 0x3b, 0xc6, 0x17, 0x46, 0x20, 0x04, 0x12, 0x80, 0x02, 0x46, 0x10,
+    0xc3, 0x50, 0x84, 0x80, 0x58, 0x10, 0x80, 0x01, 0x10, 0x61, 0x8b, 0xa4, 0x14, 0x41, 0x02, 0x80,
+    0x14, 0x10, 0x00, 0x4b, 0xaf, 0x38, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x87, 0x50, 0xdd, 0x2f,
+    0xaf, 0xb8, 0xd5, 0x07, 0x46, 0x00, 0x04, 0x12, 0x10, 0x61, 0x8b, 0xa4, 0x14, 0x60, 0x02, 0x80,
+    0x84, 0x00, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e, 0x46, 0x00, 0x04, 0x02, 0x58, 0x00, 0x01, 0x00,
+    0xb4, 0x20, 0xb4, 0x40, 0x42, 0x21, 0x7c, 0x08, 0xb6, 0x40, 0xb4, 0x40, 0x42, 0x21, 0x7c, 0x09,
+    0xb6, 0x40, 0xb6, 0x20, 0xdd, 0x9e, 0x92, 0x00, 0x46, 0x20, 0x04, 0x02, 0x04, 0x21, 0x00, 0x40,
+    0x46, 0x30, 0x04, 0x00, 0x40, 0x21, 0x0c, 0x02, 0xc2, 0x02, 0x84, 0x41, 0xb6, 0x41, 0x46, 0xf0,
+    0x01, 0x0e, 0x00, 0x17, 0x8d, 0x91, 0xc1, 0x08, 0x84, 0x21, 0xb6, 0x20, 0x46, 0xf0, 0x01, 0x12,
+    0x10, 0x17, 0x8b, 0x9b, 0xd5, 0x02, 0xb6, 0x20, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc,
+    0xef, 0xe4, 0x46, 0x00, 0x04, 0x0e, 0xf0, 0x81, 0x80, 0x20, 0xf1, 0x82, 0x80, 0x20, 0xf1, 0x84,
+    0xf1, 0x01, 0xf0, 0x83, 0xf0, 0x85, 0xf0, 0x02, 0xf1, 0x81, 0xf1, 0x03, 0x58, 0x00, 0x00, 0x04,
+    0xf0, 0x82, 0x58, 0x10, 0x80, 0x08, 0xf0, 0x04, 0xf1, 0x83, 0xf1, 0x05, 0x58, 0x00, 0x00, 0x0c,
+    0xf0, 0x84, 0x58, 0x10, 0x80, 0x10, 0x84, 0x44, 0x46, 0x40, 0x01, 0x10, 0xf1, 0x85, 0x46, 0xf0,
+    0x01, 0x03, 0x14, 0x27, 0x83, 0x8b, 0x46, 0x10, 0x01, 0x00, 0x58, 0x10, 0x80, 0xc4, 0x84, 0x60,
+    0x58, 0x42, 0x08, 0x00, 0x44, 0x00, 0xf8, 0x00, 0xb6, 0x81, 0x14, 0x30, 0x80, 0x0b, 0xa8, 0x09,
+    0xa8, 0xcb, 0xa8, 0xcd, 0xa8, 0xcf, 0x14, 0x30, 0x80, 0x09, 0x46, 0x00, 0x00, 0x58, 0x58, 0x00,
+    0x03, 0x48, 0xf1, 0x01, 0x47, 0xe0, 0x04, 0x0e, 0xb6, 0x01, 0x46, 0x00, 0x00, 0x87, 0x58, 0x00,
+    0x0c, 0x44, 0xf1, 0x02, 0xb6, 0x01, 0x46, 0x00, 0x00, 0x03, 0x58, 0x00, 0x08, 0xbc, 0xf1, 0x03,
+    0x83, 0x9e, 0xb6, 0x01, 0x46, 0x00, 0x00, 0x87, 0x58, 0x00, 0x0b, 0x3c, 0xf1, 0x04, 0xb6, 0x01,
+    0x46, 0x00, 0x00, 0x03, 0x58, 0x00, 0x08, 0xf4, 0xf1, 0x05, 0x81, 0x5c, 0xb6, 0x01, 0x46, 0x00,
+    0x00, 0x87, 0x58, 0x00, 0x0a, 0xa8, 0x14, 0x0f, 0x00, 0x05, 0x46, 0x00, 0x00, 0x53, 0x58, 0x00,
+    0x01, 0xd8, 0xb8, 0x86, 0x46, 0x00, 0x00, 0x87, 0x58, 0x00, 0x09, 0xa4, 0x81, 0x2a, 0x14, 0x05,
+    0x00, 0x07, 0x46, 0x00, 0x00, 0x55, 0x58, 0x00, 0x00, 0x18, 0x81, 0x09, 0x14, 0x04, 0x80, 0x7a,
+    0x46, 0x00, 0x00, 0x87, 0x58, 0x00, 0x08, 0x64, 0x80, 0xe8, 0x80, 0xa7, 0x46, 0x62, 0x00, 0x00,
+    0x14, 0x04, 0x00, 0x7b, 0x84, 0x0f, 0x14, 0x03, 0x80, 0x80, 0x14, 0x62, 0x80, 0x81, 0xec, 0x1c,
+    0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xfc, 0x84, 0x00,
+    0x84, 0x28, 0x46, 0x20, 0x01, 0x0e, 0x58, 0x21, 0x02, 0x3c, 0x46, 0x60, 0x01, 0x12, 0x46, 0xf0,
+    0x00, 0x54, 0x58, 0xf7, 0x8e, 0x4c, 0xdd, 0x2f, 0x00, 0x03, 0x0b, 0x9b, 0x84, 0xa1, 0xd8, 0x09,
+    0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x88, 0x44, 0xdd, 0x2f, 0x84, 0x00, 0x10, 0x03, 0x0b, 0x9b,
+    0x84, 0x00, 0x46, 0x70, 0x00, 0x52, 0x58, 0x73, 0x81, 0xe0, 0x46, 0x60, 0x01, 0x0d, 0x58, 0x63,
+    0x06, 0x10, 0x4b, 0xe0, 0x1c, 0x01, 0x00, 0x13, 0x0c, 0x2c, 0x44, 0x50, 0x00, 0x20, 0x54, 0x00,
+    0x80, 0x60, 0xd0, 0x0e, 0x95, 0x69, 0xd0, 0x3d, 0xc8, 0x46, 0x50, 0x13, 0x0c, 0x2c, 0x50, 0x03,
+    0x0c, 0x60, 0x46, 0xf0, 0x00, 0x53, 0x58, 0xf7, 0x80, 0xac, 0xdd, 0x2f, 0xd5, 0x44, 0x44, 0x00,
+    0x00, 0x2d, 0x46, 0xf0, 0x00, 0x54, 0x58, 0xf7, 0x8c, 0xc4, 0xdd, 0x2f, 0x00, 0x03, 0x0c, 0x2c,
+    0x50, 0x00, 0x7f, 0xe0, 0x96, 0x00, 0xe6, 0x02, 0xe8, 0x2e, 0x00, 0x13, 0x0c, 0x30, 0x44, 0x00,
+    0x01, 0x5c, 0x42, 0x00, 0x80, 0x24, 0x46, 0x20, 0x01, 0x0d, 0x58, 0x21, 0x06, 0x10, 0x98, 0x02,
+    0x04, 0x20, 0x00, 0x10, 0xc2, 0x13, 0x50, 0x03, 0x0c, 0x2c, 0xdd, 0x22, 0x00, 0x13, 0x0c, 0x30,
+    0x44, 0x00, 0x00, 0x14, 0x42, 0x00, 0x80, 0x24, 0x46, 0x10, 0x01, 0x0e, 0x58, 0x10, 0x8c, 0xe0,
+    0x98, 0x01, 0xa0, 0x04, 0x4b, 0xe0, 0x1c, 0x01, 0xd5, 0x16, 0x84, 0x03, 0x84, 0x21, 0xd5, 0x0e,
+    0x50, 0x13, 0x0c, 0x2c, 0x50, 0x03, 0x0c, 0x60, 0x46, 0xf0, 0x00, 0x52, 0x58, 0xf7, 0x88, 0x40,
+    0xdd, 0x2f, 0xd5, 0x09, 0x84, 0x03, 0x84, 0x21, 0x84, 0x40, 0x46, 0xf0, 0x00, 0x56, 0x58, 0xf7,
+    0x8f, 0x24, 0xdd, 0x2f, 0xec, 0x04, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa0, 0xbc,
+    0x44, 0x20, 0x06, 0x48, 0x5c, 0x30, 0x86, 0x49, 0x40, 0x70, 0x8c, 0x1b, 0x40, 0x71, 0x0c, 0x1a,
+    0x81, 0x00, 0x84, 0x03, 0x46, 0xf0, 0x00, 0x58, 0x58, 0xf7, 0x81, 0x48, 0xdd, 0x2f, 0x80, 0x07,
+    0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x82, 0x2c, 0xdd, 0x2f, 0x80, 0xc0, 0xa0, 0x02, 0x80, 0x47,
+    0x80, 0x28, 0x97, 0xf9, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0x84, 0xdd, 0x2f, 0x12, 0x73,
+    0x00, 0x0c, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x07, 0x8b, 0x96, 0x54, 0x73, 0xbf, 0xff, 0x54, 0x00,
+    0x00, 0x03, 0x40, 0x00, 0x64, 0x08, 0x40, 0x73, 0x80, 0x04, 0x46, 0x05, 0x8d, 0x08, 0x40, 0x73,
+    0x80, 0x04, 0xa9, 0xf3, 0x80, 0x26, 0x46, 0x00, 0x01, 0x1b, 0x58, 0x00, 0x05, 0x80, 0x46, 0xf0,
+    0x00, 0x80, 0x58, 0xf7, 0x84, 0x90, 0xdd, 0x2f, 0x46, 0x00, 0x01, 0x1b, 0x58, 0x00, 0x05, 0x80,
+    0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x86, 0x7c, 0xdd, 0x2f, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xf4, 0x44, 0x10, 0x00, 0x30, 0x84, 0x03, 0xf1, 0x81, 0x46, 0xf0,
+    0x00, 0x58, 0x58, 0xf7, 0x81, 0x48, 0xdd, 0x2f, 0x44, 0x00, 0x01, 0x2c, 0x46, 0xf0, 0x00, 0x81,
+    0x58, 0xf7, 0x82, 0x2c, 0xdd, 0x2f, 0x84, 0x28, 0x12, 0x10, 0x00, 0x0c, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x27, 0x8b, 0x96, 0x46, 0x35, 0x8d, 0x18, 0x54, 0x21, 0x00, 0x03, 0x58, 0x31, 0x80, 0x08,
+    0x40, 0x21, 0x64, 0x08, 0x40, 0x21, 0x0c, 0x04, 0xa8, 0x83, 0x80, 0x20, 0x46, 0x00, 0x01, 0x1b,
+    0x58, 0x00, 0x05, 0x80, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x84, 0x90, 0xdd, 0x2f, 0x84, 0x24,
+    0x40, 0x0f, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x8e, 0x0c, 0xdd, 0x2f, 0x46, 0x60,
+    0x00, 0x00, 0x58, 0x63, 0x06, 0xc0, 0x84, 0x0a, 0x4b, 0xe0, 0x18, 0x01, 0x84, 0x07, 0x4b, 0xe0,
+    0x18, 0x01, 0x46, 0x10, 0x04, 0x00, 0x04, 0x20, 0x81, 0x06, 0x42, 0x21, 0x1c, 0x09, 0x14, 0x20,
+    0x81, 0x06, 0x80, 0x01, 0x04, 0x10, 0x00, 0x85, 0x42, 0x10, 0xb0, 0x09, 0x14, 0x10, 0x00, 0x85,
+    0x46, 0x60, 0x04, 0x00, 0x58, 0x63, 0x02, 0x0c, 0xb4, 0xe6, 0x84, 0x0a, 0x58, 0x13, 0x80, 0x10,
+    0xb6, 0x26, 0x46, 0xf0, 0x00, 0x02, 0x58, 0xf7, 0x87, 0x50, 0xdd, 0x2f, 0x42, 0x73, 0x90, 0x09,
+    0x84, 0x20, 0xb6, 0xe6, 0x46, 0xf0, 0x01, 0x00, 0x10, 0x17, 0x83, 0x02, 0x46, 0x10, 0x04, 0x00,
+    0x04, 0x20, 0x80, 0x8c, 0x84, 0x7e, 0x40, 0x21, 0x0c, 0x02, 0x14, 0x20, 0x80, 0x8c, 0x46, 0x00,
+    0x04, 0x05, 0x58, 0x00, 0x07, 0x00, 0xb4, 0x20, 0x58, 0x10, 0x80, 0x01, 0xb6, 0x20, 0xb4, 0x20,
+    0x40, 0x10, 0x8c, 0x02, 0xb6, 0x20, 0xb4, 0x06, 0x58, 0x00, 0x02, 0x00, 0xb6, 0x06, 0xec, 0x0c,
+    0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xfc, 0x96, 0x00,
+    0x97, 0x22, 0x97, 0x6a, 0x20, 0x8f, 0x80, 0x20, 0x20, 0x7f, 0x80, 0x24, 0xca, 0x11, 0x46, 0x00,
+    0x04, 0x02, 0x04, 0x10, 0x00, 0x40, 0x46, 0x2f, 0xfb, 0xcf, 0x58, 0x21, 0x0f, 0xff, 0x40, 0x10,
+    0x88, 0x02, 0x40, 0x31, 0x84, 0x04, 0x14, 0x30, 0x00, 0x40, 0x48, 0x00, 0x01, 0x43, 0x97, 0xa0,
+    0x5e, 0xf1, 0x84, 0x01, 0xe8, 0x23, 0x5e, 0xf1, 0x83, 0xff, 0xe8, 0x48, 0x44, 0x40, 0x00, 0x40,
+    0x4c, 0x32, 0x00, 0x3d, 0x5e, 0xf1, 0x80, 0x41, 0xe8, 0x0d, 0x44, 0x90, 0x00, 0x10, 0x4c, 0x34,
+    0x80, 0x32, 0x40, 0xa4, 0x84, 0x08, 0x4c, 0x35, 0x00, 0x30, 0x84, 0x88, 0x4c, 0x32, 0x40, 0x29,
+    0xd5, 0x29, 0x40, 0x92, 0x08, 0x08, 0x4c, 0x34, 0x80, 0x2e, 0x40, 0xa2, 0x0c, 0x08, 0x4c, 0x35,
+    0x00, 0x2c, 0x95, 0x21, 0x4c, 0x32, 0x40, 0x1d, 0xd5, 0x23, 0x44, 0x90, 0x10, 0x00, 0x4c, 0x34,
+    0x80, 0x26, 0x5e, 0xf1, 0x90, 0x01, 0xe8, 0x08, 0x44, 0xa0, 0x08, 0x00, 0x4c, 0x35, 0x00, 0x1f,
+    0x44, 0x40, 0x0c, 0x00, 0xd5, 0x0b, 0x44, 0x90, 0x40, 0x00, 0x4c, 0x34, 0x80, 0x18, 0x40, 0xa4,
+    0x84, 0x08, 0x4c, 0x35, 0x00, 0x14, 0x44, 0x40, 0x20, 0x00, 0x4c, 0x32, 0x00, 0x10, 0x84, 0x80,
+    0xd5, 0x0e, 0x84, 0x84, 0xd5, 0x0c, 0x84, 0x85, 0xd5, 0x0a, 0x84, 0x86, 0xd5, 0x08, 0x84, 0x87,
+    0xd5, 0x06, 0x84, 0x88, 0xd5, 0x04, 0x84, 0x89, 0xd5, 0x02, 0x84, 0x8a, 0xc9, 0x70, 0x44, 0xa4,
+    0x02, 0x10, 0x40, 0x90, 0x28, 0x00, 0x40, 0x94, 0x90, 0x08, 0x85, 0x41, 0x05, 0xc4, 0x80, 0x00,
+    0x4c, 0x25, 0x40, 0x09, 0x89, 0x47, 0x50, 0x14, 0x00, 0x01, 0x42, 0x15, 0x04, 0x24, 0x9e, 0x49,
+    0x96, 0x48, 0x40, 0x52, 0xa0, 0x08, 0x54, 0x52, 0xbf, 0x00, 0x54, 0x84, 0x00, 0x0f, 0x40, 0x84,
+    0x14, 0x04, 0x46, 0x50, 0x0c, 0x00, 0x40, 0x73, 0xd8, 0x08, 0x40, 0x73, 0x94, 0x02, 0x40, 0x74,
+    0x1c, 0x04, 0x46, 0x80, 0x03, 0xf0, 0x40, 0x10, 0xc0, 0x08, 0x50, 0xa0, 0x7f, 0xfc, 0x40, 0x10,
+    0xa0, 0x02, 0x54, 0xa5, 0x00, 0xff, 0x40, 0x13, 0x84, 0x04, 0xe7, 0x42, 0xe9, 0x03, 0x84, 0xa0,
+    0xd5, 0x07, 0x46, 0x50, 0x01, 0x10, 0x58, 0x52, 0x88, 0x0c, 0x38, 0x52, 0xaa, 0x02, 0x54, 0x52,
+    0x9f, 0xff, 0x40, 0x42, 0x40, 0x08, 0x85, 0x42, 0x40, 0x42, 0x90, 0x04, 0x4c, 0x25, 0x00, 0x14,
+    0x84, 0xa3, 0xda, 0x08, 0x40, 0x63, 0x60, 0x08, 0x40, 0x42, 0x18, 0x04, 0x58, 0x10, 0x80, 0x10,
+    0xd5, 0x0a, 0x84, 0xe1, 0x4c, 0x23, 0xc0, 0x08, 0x40, 0x63, 0x60, 0x08, 0x40, 0x42, 0x18, 0x04,
+    0x58, 0x10, 0x80, 0x20, 0x46, 0x20, 0x04, 0x02, 0x58, 0x21, 0x00, 0x8c, 0xb4, 0xe2, 0x84, 0xc1,
+    0x9f, 0x41, 0x40, 0x03, 0x00, 0x0c, 0x96, 0xdd, 0x40, 0x00, 0x1c, 0x04, 0x95, 0x6c, 0x40, 0x6e,
+    0x2c, 0x09, 0x40, 0x63, 0x2c, 0x08, 0x42, 0x31, 0xf4, 0x08, 0x50, 0x71, 0x00, 0x8c, 0x50, 0x83,
+    0xff, 0xfc, 0x40, 0x31, 0x98, 0x04, 0x99, 0xaf, 0x88, 0xa8, 0xd5, 0x75, 0x85, 0x21, 0x4c, 0x14,
+    0xc0, 0x78, 0x44, 0xa4, 0x02, 0x20, 0x40, 0x90, 0x28, 0x00, 0x40, 0x94, 0x90, 0x08, 0x05, 0xc4,
+    0x80, 0x00, 0x4c, 0x20, 0x80, 0x04, 0x85, 0x40, 0xd5, 0x0a, 0x50, 0xa3, 0x80, 0x01, 0x50, 0x14,
+    0x00, 0x01, 0x42, 0xa5, 0x04, 0x24, 0x8f, 0x41, 0x54, 0xa5, 0x00, 0xff, 0x40, 0x52, 0xa0, 0x08,
+    0x54, 0x52, 0xbf, 0x00, 0x54, 0x84, 0x00, 0x0f, 0x40, 0x14, 0x14, 0x04, 0x46, 0x50, 0x0c, 0x00,
+    0x40, 0x73, 0xd8, 0x08, 0x40, 0x73, 0x94, 0x02, 0x40, 0x10, 0x9c, 0x04, 0x46, 0x70, 0x03, 0xf0,
+    0x40, 0xa5, 0x40, 0x08, 0x9f, 0x44, 0x40, 0xa5, 0x1c, 0x02, 0x97, 0x68, 0x40, 0x10, 0xa8, 0x04,
+    0xe6, 0xa6, 0xe9, 0x03, 0x84, 0xa0, 0xd5, 0x07, 0x46, 0x70, 0x01, 0x10, 0x58, 0x73, 0x88, 0x14,
+    0x38, 0x53, 0x96, 0x02, 0x54, 0x52, 0x9f, 0xff, 0x40, 0x42, 0x40, 0x08, 0x85, 0x02, 0x40, 0x42,
+    0x90, 0x04, 0x4c, 0x24, 0x00, 0x14, 0x85, 0x43, 0x4c, 0x25, 0x40, 0x09, 0x40, 0x63, 0x60, 0x08,
+    0x40, 0x42, 0x18, 0x04, 0x58, 0x10, 0x80, 0x10, 0xd5, 0x09, 0x84, 0xa1, 0xda, 0x07, 0x40, 0x63,
+    0x60, 0x08, 0x40, 0x42, 0x18, 0x04, 0x58, 0x10, 0x80, 0x20, 0x46, 0x20, 0x04, 0x02, 0x58, 0x21,
+    0x00, 0x8c, 0xb4, 0xe2, 0x44, 0x61, 0x00, 0x00, 0x9f, 0x41, 0x40, 0x03, 0x00, 0x0c, 0x96, 0xdd,
+    0x40, 0x00, 0x1c, 0x04, 0x95, 0x6c, 0x40, 0x6e, 0x2c, 0x09, 0x40, 0x63, 0x2c, 0x08, 0x42, 0x31,
+    0xf4, 0x08, 0x50, 0xa1, 0x01, 0x8c, 0x50, 0x75, 0x7f, 0xfc, 0x40, 0x31, 0x98, 0x04, 0x40, 0x62,
+    0xa8, 0x00, 0x99, 0x6f, 0xb6, 0x02, 0xb6, 0x69, 0xb6, 0x25, 0xb6, 0x86, 0xd5, 0x0a, 0x46, 0x00,
+    0x00, 0x8e, 0x58, 0x00, 0x0d, 0xb0, 0x46, 0xf0, 0x00, 0x04, 0x58, 0xf7, 0x84, 0x84, 0xdd, 0x2f,
+    0xec, 0x04, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x84, 0x23, 0x42, 0x00, 0x04, 0x24, 0x84, 0x20,
+    0xd5, 0x08, 0x84, 0x40, 0x92, 0x00, 0x84, 0x67, 0x9c, 0x91, 0x4c, 0x21, 0xff, 0xfd, 0x9c, 0x49,
+    0xe2, 0x20, 0xe9, 0xf8, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x9c, 0x3c, 0x96, 0x04, 0x54, 0x40,
+    0x8f, 0xff, 0x40, 0x00, 0x40, 0x08, 0x46, 0x30, 0x04, 0x10, 0x40, 0x70, 0x10, 0x04, 0x58, 0x31,
+    0x85, 0x28, 0x84, 0x80, 0xb4, 0x03, 0x84, 0xa1, 0x42, 0x00, 0x34, 0x0b, 0xd0, 0x18, 0xb6, 0xe3,
+    0x84, 0xa0, 0xb4, 0xc3, 0x9d, 0x69, 0x42, 0x03, 0x34, 0x0b, 0xc8, 0x06, 0x54, 0x63, 0x0f, 0xff,
+    0x4c, 0x60, 0xc0, 0x0e, 0xd5, 0x05, 0x44, 0x00, 0x00, 0x64, 0xd8, 0xf4, 0xd5, 0x07, 0x46, 0x10,
+    0x04, 0x10, 0x04, 0x10, 0x81, 0x4b, 0xb6, 0x22, 0xd5, 0x06, 0x84, 0x01, 0x9d, 0x21, 0x44, 0x50,
+    0x00, 0x64, 0xdc, 0xe1, 0x3a, 0x6f, 0x9c, 0x04, 0xdd, 0x9e, 0x92, 0x00, 0x96, 0x04, 0x54, 0x10,
+    0x8f, 0xff, 0x58, 0x10, 0x90, 0x00, 0x40, 0x00, 0x40, 0x08, 0x46, 0x40, 0x04, 0x10, 0x80, 0x64,
+    0x40, 0x00, 0x80, 0x04, 0x14, 0x22, 0x01, 0x49, 0x14, 0x01, 0x81, 0x4a, 0x84, 0x20, 0x04, 0x01,
+    0x81, 0x4a, 0x9c, 0x49, 0x42, 0x00, 0x34, 0x0b, 0xc0, 0x06, 0x44, 0x00, 0x00, 0x64, 0x4c, 0x10,
+    0x7f, 0xf8, 0x84, 0x01, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xf4, 0x97, 0x80,
+    0x50, 0x2f, 0x80, 0x04, 0x84, 0x60, 0x80, 0x06, 0x80, 0xe1, 0xf3, 0x81, 0x46, 0xf0, 0x00, 0x87,
+    0x58, 0xf7, 0x8f, 0x24, 0xdd, 0x2f, 0x46, 0x30, 0x01, 0x12, 0x04, 0x21, 0x83, 0x00, 0x46, 0x10,
+    0x01, 0x19, 0x58, 0x10, 0x8b, 0x10, 0x9c, 0x11, 0x38, 0x60, 0x88, 0x08, 0xf1, 0x01, 0x46, 0x40,
+    0x01, 0x19, 0x58, 0x42, 0x0b, 0x30, 0x14, 0x01, 0x83, 0x00, 0x46, 0x00, 0x01, 0x19, 0x58, 0x00,
+    0x0b, 0xb0, 0x38, 0x72, 0x0a, 0x0a, 0x38, 0x10, 0x0a, 0x0a, 0xec, 0x0c, 0x3a, 0x6f, 0x9c, 0x84,
+    0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xa8, 0xbc, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x67, 0x83, 0x00,
+    0x46, 0x00, 0x01, 0x19, 0x58, 0x00, 0x0b, 0xb0, 0x50, 0x83, 0x7f, 0xff, 0x40, 0x74, 0x08, 0x08,
+    0x40, 0x93, 0x80, 0x00, 0x46, 0x00, 0x01, 0x19, 0x58, 0x00, 0x0b, 0x10, 0x89, 0x00, 0x46, 0x00,
+    0x01, 0x19, 0x58, 0x00, 0x0b, 0x30, 0x46, 0xa0, 0x00, 0x87, 0x58, 0xa5, 0x0f, 0x88, 0x99, 0xf8,
+    0x08, 0x04, 0x7f, 0xff, 0x0c, 0x13, 0xff, 0xff, 0x0c, 0x24, 0xff, 0xff, 0x9f, 0xb1, 0x4b, 0xe0,
+    0x28, 0x01, 0x4e, 0x66, 0xff, 0xf7, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x67, 0x83, 0x00, 0x3a, 0x6f,
+    0xa8, 0x84, 0xdd, 0x9e, 0x46, 0x20, 0x01, 0x12, 0x04, 0x11, 0x02, 0xff, 0x46, 0x30, 0x01, 0x19,
+    0x58, 0x31, 0x8c, 0x30, 0x38, 0x01, 0x86, 0x0a, 0x9c, 0xc9, 0xb4, 0x80, 0x46, 0x00, 0x01, 0x19,
+    0x58, 0x00, 0x0c, 0xb0, 0x38, 0x40, 0x06, 0x0a, 0x14, 0x31, 0x02, 0xff, 0xdd, 0x9e, 0x92, 0x00,
+    0x46, 0xf0, 0x01, 0x12, 0x04, 0x07, 0x82, 0xff, 0x4e, 0x07, 0x00, 0x1a, 0x9e, 0x41, 0x94, 0x4a,
+    0x46, 0x30, 0x01, 0x19, 0x58, 0x31, 0x8c, 0xb0, 0x98, 0x8b, 0x46, 0x30, 0x01, 0x19, 0x58, 0x31,
+    0x8c, 0x30, 0x98, 0x4b, 0x0c, 0x30, 0xff, 0xff, 0x0c, 0x41, 0x7f, 0xff, 0x9e, 0x01, 0xb6, 0x83,
+    0x4e, 0x06, 0xff, 0xfa, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x07, 0x82, 0xff, 0xdd, 0x9e, 0x92, 0x00,
+    0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xfc, 0x46, 0x10, 0x04, 0x10, 0x04, 0x20, 0x80, 0x20, 0x83, 0x80,
+    0x58, 0x21, 0x02, 0x00, 0x14, 0x20, 0x80, 0x20, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x67, 0x8b, 0xb1,
+    0xce, 0x48, 0x46, 0x20, 0x04, 0xf0, 0x04, 0x01, 0x00, 0x0c, 0x46, 0x10, 0x04, 0x0d, 0x58, 0x00,
+    0x00, 0x01, 0x14, 0x01, 0x00, 0x0c, 0xb4, 0x01, 0x47, 0xe1, 0x00, 0x00, 0x81, 0x21, 0x46, 0xa2,
+    0x01, 0xe8, 0x80, 0x41, 0x46, 0x87, 0x00, 0x04, 0x80, 0xa1, 0x46, 0x77, 0xf0, 0x30, 0x46, 0x47,
+    0x11, 0x14, 0x80, 0x61, 0x40, 0x00, 0x78, 0x04, 0x58, 0x84, 0x00, 0x01, 0x58, 0x73, 0x80, 0x7f,
+    0x58, 0xa5, 0x08, 0x5d, 0x58, 0x42, 0x00, 0x01, 0xb6, 0x01, 0x14, 0xa4, 0x80, 0x02, 0x14, 0x81,
+    0x00, 0x06, 0xa9, 0xe9, 0xa9, 0x16, 0xa9, 0x9b, 0x81, 0x01, 0xb4, 0x01, 0x46, 0x70, 0x00, 0x87,
+    0x58, 0x73, 0x8f, 0x04, 0x42, 0x00, 0x4c, 0x08, 0xb6, 0x01, 0xb4, 0x21, 0xd5, 0x08, 0x44, 0x50,
+    0x00, 0x65, 0xd6, 0x0a, 0x97, 0x91, 0x4b, 0xe0, 0x1c, 0x01, 0xb4, 0x28, 0x92, 0x30, 0x96, 0x4c,
+    0x9c, 0xb1, 0x84, 0x0a, 0xc9, 0xf5, 0x84, 0x21, 0x46, 0xf0, 0x01, 0x12, 0x10, 0x17, 0x8b, 0xb1,
+    0x46, 0x10, 0x04, 0x0d, 0xb4, 0x01, 0x54, 0x00, 0x00, 0x7f, 0xb6, 0x1c, 0xec, 0x04, 0x3a, 0x6f,
+    0xaa, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xc4, 0x84, 0x40, 0x96, 0x48, 0x96, 0x00,
+    0xf1, 0x84, 0xf2, 0x8b, 0xb6, 0x1f, 0xf2, 0x8d, 0xf2, 0x8c, 0x4e, 0x13, 0x03, 0x7f, 0x46, 0x60,
+    0x00, 0x87, 0x58, 0x63, 0x0f, 0xc4, 0xdd, 0x26, 0xb4, 0x1f, 0x44, 0x10, 0x00, 0x10, 0xdd, 0x26,
+    0xb4, 0x1f, 0x44, 0x10, 0x01, 0x14, 0xdd, 0x26, 0xb4, 0x1f, 0x44, 0x10, 0x01, 0x38, 0xdd, 0x26,
+    0xb4, 0x1f, 0x44, 0x10, 0x01, 0x2c, 0xdd, 0x26, 0xb4, 0x1f, 0x44, 0x10, 0x01, 0x30, 0xdd, 0x26,
+    0xb4, 0x1f, 0x44, 0x10, 0x02, 0x10, 0xdd, 0x26, 0xb4, 0x1f, 0x44, 0x10, 0x02, 0x44, 0xdd, 0x26,
+    0x46, 0x00, 0x04, 0x12, 0x46, 0x60, 0x00, 0x88, 0x58, 0x63, 0x00, 0x80, 0x58, 0x00, 0x07, 0x04,
+    0xdd, 0x26, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x07, 0x14, 0xdd, 0x26, 0x46, 0x00, 0x04, 0x12,
+    0x58, 0x00, 0x09, 0x34, 0xdd, 0x26, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x00, 0x04, 0xdd, 0x26,
+    0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x07, 0x18, 0xdd, 0x26, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00,
+    0x09, 0x80, 0xdd, 0x26, 0xf0, 0x04, 0xf0, 0x81, 0xf1, 0x01, 0xc9, 0x2e, 0x46, 0x28, 0x00, 0x56,
+    0xb4, 0x1f, 0x46, 0x60, 0x00, 0x87, 0x58, 0x63, 0x0f, 0x88, 0x58, 0x21, 0x0e, 0x53, 0xdd, 0x26,
+    0xb4, 0x1f, 0x46, 0x25, 0x40, 0x37, 0x44, 0x10, 0x01, 0x38, 0xdd, 0x26, 0xb4, 0x1f, 0x46, 0x20,
+    0x81, 0x00, 0x58, 0x21, 0x00, 0x1b, 0x44, 0x10, 0x01, 0x2c, 0xdd, 0x26, 0xb4, 0x1f, 0x44, 0x10,
+    0x02, 0x44, 0x44, 0x20, 0x01, 0xc0, 0xdd, 0x26, 0xf3, 0x01, 0x84, 0x44, 0x56, 0x41, 0x80, 0x01,
+    0x84, 0x65, 0x40, 0x01, 0x90, 0x1a, 0x40, 0x01, 0x10, 0x1b, 0x84, 0x20, 0xf0, 0x89, 0xf1, 0x82,
+    0x05, 0xcf, 0x80, 0x00, 0xd5, 0x1b, 0xf3, 0x01, 0x84, 0xa1, 0x46, 0x60, 0x00, 0x87, 0x58, 0x63,
+    0x0f, 0x88, 0xdb, 0x07, 0x46, 0x28, 0x20, 0x56, 0x58, 0x21, 0x0e, 0x53, 0xb4, 0x1f, 0xd5, 0x0c,
+    0xb4, 0x1f, 0x44, 0x20, 0x01, 0x00, 0x44, 0x10, 0x02, 0x44, 0xdd, 0x26, 0x46, 0x28, 0x30, 0x56,
+    0xb4, 0x1f, 0x58, 0x21, 0x0e, 0x53, 0x84, 0x20, 0xd5, 0xd7, 0xf7, 0x09, 0xf1, 0x01, 0xf3, 0x02,
+    0x84, 0x46, 0x40, 0x71, 0x04, 0x1a, 0x46, 0x60, 0x00, 0x87, 0x58, 0x63, 0x0f, 0x88, 0xcb, 0x22,
+    0x44, 0x10, 0x00, 0x10, 0x80, 0x1c, 0xdd, 0x26, 0x46, 0x20, 0x04, 0x00, 0x80, 0x1c, 0x58, 0x21,
+    0x08, 0xb1, 0x44, 0x10, 0x01, 0x14, 0xdd, 0x26, 0xf0, 0x01, 0xc8, 0x07, 0x80, 0x1c, 0x44, 0x10,
+    0x02, 0x10, 0x44, 0x20, 0x88, 0x88, 0xdd, 0x26, 0x46, 0x20, 0xa8, 0x98, 0x58, 0x21, 0x03, 0xbc,
+    0x80, 0x1c, 0x44, 0x10, 0x01, 0x30, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x88, 0xdd, 0x2f,
+    0xd5, 0x11, 0x46, 0x20, 0x04, 0x21, 0x58, 0x21, 0x08, 0xf1, 0x44, 0x10, 0x01, 0x14, 0x80, 0x1c,
+    0xdd, 0x26, 0x46, 0x20, 0xa8, 0x90, 0x80, 0x1c, 0x58, 0x21, 0x03, 0xbc, 0x44, 0x10, 0x01, 0x30,
+    0xdd, 0x26, 0x84, 0x61, 0x46, 0x60, 0x00, 0x87, 0x58, 0x63, 0x0f, 0x24, 0x44, 0x10, 0x02, 0x4c,
+    0x50, 0x2f, 0x80, 0x30, 0x80, 0x1c, 0x40, 0x91, 0x9c, 0x0c, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x30,
+    0x04, 0x12, 0xf3, 0x87, 0xf3, 0x85, 0x44, 0x10, 0x02, 0x50, 0x80, 0x1c, 0x50, 0x2f, 0x80, 0x2c,
+    0x4b, 0xe0, 0x18, 0x01, 0xf0, 0x07, 0xf1, 0x05, 0x9f, 0xf9, 0x58, 0x00, 0x07, 0x04, 0x58, 0x10,
+    0x89, 0xfc, 0xf7, 0x83, 0xf0, 0x87, 0xf1, 0x85, 0x04, 0xaf, 0x80, 0x02, 0xd5, 0x04, 0xf3, 0x03,
+    0x9e, 0xd9, 0xf3, 0x83, 0xf0, 0x03, 0xf1, 0x01, 0x9c, 0x01, 0xf0, 0x88, 0xc9, 0x1f, 0x4e, 0xa3,
+    0x00, 0x09, 0xf2, 0x0c, 0x92, 0x47, 0x94, 0x97, 0x80, 0x1c, 0x40, 0x24, 0x88, 0x04, 0xd5, 0x0e,
+    0x84, 0xa1, 0x4c, 0xa2, 0xc0, 0x5e, 0xf2, 0x0c, 0x44, 0x1f, 0x80, 0xff, 0x40, 0x34, 0xa0, 0x08,
+    0x40, 0x21, 0x04, 0x02, 0x40, 0x21, 0x88, 0x04, 0x80, 0x1c, 0x44, 0x10, 0x02, 0x4c, 0x46, 0xf0,
+    0x00, 0x87, 0x58, 0xf7, 0x8f, 0x88, 0xdd, 0x2f, 0xd5, 0x4b, 0xf3, 0x01, 0x84, 0xa1, 0xdb, 0x25,
+    0x4e, 0xa3, 0x00, 0x0c, 0xf2, 0x0c, 0x46, 0x1f, 0xf8, 0x0f, 0x58, 0x10, 0x8f, 0xff, 0x40, 0x34,
+    0xc0, 0x08, 0x40, 0x21, 0x04, 0x02, 0xd5, 0x0d, 0x84, 0xa1, 0x4c, 0xa2, 0xc0, 0xb4, 0xf2, 0x0c,
+    0x46, 0x08, 0x0f, 0xff, 0x58, 0x00, 0x0f, 0xff, 0x40, 0x34, 0xe0, 0x08, 0x40, 0x21, 0x00, 0x02,
+    0x40, 0x21, 0x88, 0x04, 0x80, 0x1c, 0x44, 0x10, 0x02, 0x4c, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7,
+    0x8f, 0x88, 0xdd, 0x2f, 0x48, 0x00, 0x00, 0x9f, 0xf1, 0x01, 0x84, 0xa2, 0x4c, 0x12, 0xc0, 0x98,
+    0x4e, 0xa3, 0x00, 0x09, 0xf2, 0x0b, 0x92, 0x47, 0x94, 0x97, 0x80, 0x1c, 0x40, 0x24, 0x88, 0x04,
+    0xd5, 0x0e, 0x84, 0xa1, 0x4c, 0xa2, 0xc1, 0x08, 0xf2, 0x0b, 0x44, 0x0f, 0x80, 0xff, 0x40, 0x21,
+    0x00, 0x02, 0x40, 0x34, 0xa0, 0x08, 0x40, 0x21, 0x88, 0x04, 0x80, 0x1c, 0x44, 0x10, 0x02, 0x50,
+    0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x88, 0xdd, 0x2f, 0x48, 0x00, 0x00, 0xf5, 0x46, 0x20,
+    0x04, 0x12, 0x80, 0x62, 0x84, 0x20, 0xa8, 0x51, 0x44, 0x23, 0x7f, 0x7f, 0x14, 0x21, 0x83, 0x3b,
+    0x4e, 0xa3, 0x00, 0x07, 0x46, 0x20, 0x12, 0x07, 0x58, 0x21, 0x0f, 0x7f, 0xd5, 0x05, 0x46, 0x20,
+    0x12, 0xa7, 0x58, 0x21, 0x0f, 0x7f, 0x14, 0x21, 0x83, 0x3b, 0x80, 0x43, 0x46, 0x38, 0x00, 0x00,
+    0x14, 0x31, 0x03, 0x3a, 0x4f, 0xc3, 0x00, 0x0c, 0x80, 0x82, 0x46, 0x38, 0x00, 0x00, 0x58, 0x31,
+    0x80, 0x12, 0x14, 0x32, 0x02, 0x4d, 0x15, 0xc1, 0x01, 0xc5, 0xd5, 0x0d, 0x80, 0x82, 0x46, 0x2c,
+    0x00, 0x00, 0x58, 0x21, 0x00, 0x12, 0x80, 0x64, 0x14, 0x22, 0x02, 0x4d, 0x44, 0x20, 0x00, 0x81,
+    0x14, 0x21, 0x81, 0xc5, 0x46, 0x60, 0x04, 0x12, 0x84, 0x01, 0xa8, 0x34, 0x46, 0xf0, 0x00, 0x87,
+    0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x46, 0x20, 0x04, 0x12, 0x46, 0x3f, 0x0f, 0x30, 0x84, 0xe0,
+    0xa9, 0xf4, 0x14, 0x71, 0x02, 0x60, 0x14, 0x31, 0x02, 0x60, 0x80, 0x47, 0xd5, 0x0c, 0x44, 0x50,
+    0x00, 0x65, 0xd7, 0x0c, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0xf0, 0x05,
+    0x9d, 0xf9, 0xb4, 0x40, 0x96, 0x94, 0x84, 0x0a, 0xc2, 0xf3, 0x46, 0x40, 0x04, 0x12, 0x46, 0x2f,
+    0x0f, 0x30, 0x58, 0x21, 0x00, 0x03, 0x14, 0x22, 0x02, 0x60, 0x80, 0x44, 0x04, 0x21, 0x02, 0x61,
+    0xf2, 0x86, 0x4e, 0xa3, 0x00, 0x07, 0x46, 0x3f, 0x0f, 0x30, 0x58, 0x31, 0x80, 0x20, 0xd5, 0x05,
+    0x46, 0x3f, 0x0f, 0x30, 0x58, 0x31, 0x80, 0x2a, 0x14, 0x32, 0x02, 0x60, 0x46, 0x30, 0x04, 0x12,
+    0x58, 0x31, 0x89, 0x84, 0x50, 0x41, 0x83, 0x64, 0x48, 0x00, 0x01, 0x47, 0xf3, 0x01, 0x84, 0xa1,
+    0xdb, 0x7a, 0x46, 0x30, 0x04, 0x12, 0x44, 0x20, 0x00, 0x12, 0x80, 0x83, 0xa8, 0x99, 0x44, 0x23,
+    0x7f, 0x7f, 0x14, 0x22, 0x03, 0x3b, 0x4e, 0xa3, 0x00, 0x07, 0x46, 0x20, 0x14, 0x07, 0x58, 0x21,
+    0x0f, 0x7f, 0xd5, 0x05, 0x46, 0x20, 0x15, 0x47, 0x58, 0x21, 0x0f, 0x7f, 0x14, 0x22, 0x03, 0x3b,
+    0x46, 0x38, 0x00, 0x00, 0x80, 0x44, 0x14, 0x31, 0x03, 0x3a, 0x4f, 0xc3, 0x00, 0x0c, 0x80, 0x82,
+    0x46, 0x38, 0x00, 0x00, 0x58, 0x31, 0x80, 0x12, 0x14, 0x32, 0x02, 0x4d, 0x15, 0xc1, 0x01, 0xc5,
+    0xd5, 0x0d, 0x80, 0x82, 0x46, 0x2c, 0x00, 0x00, 0x58, 0x21, 0x00, 0x12, 0x80, 0x64, 0x14, 0x22,
+    0x02, 0x4d, 0x44, 0x20, 0x00, 0x81, 0x14, 0x21, 0x81, 0xc5, 0x46, 0x60, 0x04, 0x12, 0x84, 0x01,
+    0xa8, 0x34, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x46, 0x20, 0x04, 0x12,
+    0x46, 0x3f, 0x0f, 0x30, 0x84, 0xe0, 0xa9, 0xf4, 0x14, 0x71, 0x02, 0x60, 0x14, 0x31, 0x02, 0x60,
+    0x80, 0x47, 0xd5, 0x0c, 0x44, 0x50, 0x00, 0x65, 0xd7, 0x0c, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7,
+    0x8f, 0x04, 0xdd, 0x2f, 0xf3, 0x05, 0x9d, 0xf9, 0xb4, 0x43, 0x96, 0x94, 0x84, 0x0a, 0xc2, 0xf3,
+    0x46, 0x40, 0x04, 0x12, 0x46, 0x2f, 0x0f, 0x30, 0x58, 0x21, 0x00, 0x03, 0x14, 0x22, 0x02, 0x60,
+    0x80, 0x44, 0x04, 0x21, 0x02, 0x61, 0xf2, 0x86, 0x4e, 0xa3, 0x00, 0x07, 0x46, 0x3f, 0x0f, 0x30,
+    0x58, 0x31, 0x80, 0x40, 0xd5, 0x05, 0x46, 0x3f, 0x0f, 0x30, 0x58, 0x31, 0x80, 0x54, 0x14, 0x32,
+    0x02, 0x60, 0x80, 0x64, 0x80, 0x83, 0x84, 0x00, 0x04, 0x31, 0x82, 0x61, 0x14, 0x02, 0x03, 0x3a,
+    0x48, 0x00, 0x00, 0xce, 0xf1, 0x07, 0x46, 0x40, 0x04, 0x12, 0x80, 0xa4, 0x46, 0x3c, 0x00, 0x02,
+    0x58, 0x31, 0x81, 0x01, 0x84, 0x00, 0x44, 0x20, 0x00, 0x5a, 0xb6, 0x01, 0xa8, 0xa1, 0x14, 0x32,
+    0x81, 0xc6, 0x4f, 0xc3, 0x00, 0x0c, 0x46, 0x38, 0x00, 0x00, 0x80, 0x44, 0x58, 0x31, 0x80, 0x12,
+    0x14, 0x32, 0x02, 0x4d, 0x15, 0xc1, 0x01, 0xc5, 0xd5, 0x0a, 0x50, 0x21, 0xdf, 0x11, 0x80, 0x64,
+    0x14, 0x22, 0x02, 0x4d, 0x44, 0x20, 0x00, 0x81, 0x14, 0x21, 0x81, 0xc5, 0x80, 0xc5, 0x84, 0x01,
+    0xa8, 0x34, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x46, 0x20, 0x04, 0x12,
+    0x46, 0x3f, 0x0f, 0x30, 0x84, 0xe0, 0xa9, 0xf4, 0x14, 0x71, 0x02, 0x60, 0x14, 0x31, 0x02, 0x60,
+    0x80, 0x47, 0xd5, 0x0c, 0x44, 0x50, 0x00, 0x65, 0xd7, 0x0c, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7,
+    0x8f, 0x04, 0xdd, 0x2f, 0xf3, 0x05, 0x9d, 0xf9, 0xb4, 0x43, 0x96, 0x94, 0x84, 0x0a, 0xc2, 0xf3,
+    0x46, 0x20, 0x04, 0x12, 0x46, 0x3f, 0x0f, 0x30, 0x58, 0x31, 0x80, 0x06, 0x14, 0x31, 0x02, 0x60,
+    0x04, 0x21, 0x02, 0x61, 0x46, 0x70, 0x04, 0x12, 0x80, 0xc7, 0x84, 0x61, 0x84, 0x00, 0xf2, 0x86,
+    0x14, 0x03, 0x81, 0xc6, 0xa8, 0xf4, 0x80, 0x03, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04,
+    0xdd, 0x2f, 0x84, 0x60, 0xa8, 0xf4, 0x4e, 0xa3, 0x00, 0x07, 0x46, 0x38, 0x00, 0x02, 0x58, 0x31,
+    0x81, 0x28, 0xd5, 0x05, 0x46, 0x3c, 0x00, 0x02, 0x58, 0x31, 0x81, 0x1c, 0x14, 0x33, 0x81, 0xc6,
+    0x4f, 0xc3, 0x00, 0x0e, 0x46, 0x50, 0x04, 0x12, 0x46, 0x48, 0x00, 0x00, 0x80, 0x65, 0x58, 0x42,
+    0x00, 0x12, 0x14, 0x42, 0x82, 0x4d, 0x15, 0xc1, 0x81, 0xc5, 0xd5, 0x0e, 0x46, 0x50, 0x04, 0x12,
+    0x46, 0x3c, 0x00, 0x00, 0x58, 0x31, 0x80, 0x12, 0x80, 0x85, 0x14, 0x32, 0x82, 0x4d, 0x44, 0x30,
+    0x00, 0x81, 0x14, 0x32, 0x01, 0xc5, 0x46, 0x80, 0x04, 0x12, 0x46, 0x70, 0x04, 0x12, 0x84, 0x61,
+    0x58, 0x84, 0x09, 0x80, 0x84, 0x00, 0xb6, 0x08, 0xa8, 0xfc, 0x80, 0x03, 0x46, 0xf0, 0x00, 0x87,
+    0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x46, 0x3f, 0x0f, 0x30, 0x84, 0xc0, 0xa9, 0xbc, 0xb6, 0xc8,
+    0xb6, 0x68, 0x80, 0x66, 0xd5, 0x0c, 0x44, 0x50, 0x00, 0x65, 0xd6, 0x0c, 0x46, 0xf0, 0x00, 0x87,
+    0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0xf0, 0x05, 0x9d, 0xb1, 0xb4, 0x60, 0x96, 0xdc, 0x84, 0x0a,
+    0xc3, 0xf3, 0x4e, 0xa3, 0x00, 0x0b, 0x46, 0x40, 0x04, 0x12, 0x46, 0x3f, 0x0f, 0x30, 0x58, 0x42,
+    0x09, 0x80, 0x58, 0x31, 0x80, 0x80, 0xd5, 0x09, 0x46, 0x40, 0x04, 0x12, 0x46, 0x3f, 0x0f, 0x30,
+    0x58, 0x42, 0x09, 0x80, 0x58, 0x31, 0x80, 0xa8, 0xb6, 0x64, 0x46, 0x30, 0x04, 0x12, 0x58, 0x31,
+    0x89, 0x84, 0x50, 0x41, 0xfd, 0x94, 0x84, 0x20, 0xb4, 0x63, 0xb6, 0x24, 0xf0, 0x06, 0x84, 0x21,
+    0x40, 0x30, 0x8c, 0x1a, 0x94, 0x87, 0x4e, 0xa3, 0x00, 0x08, 0x40, 0x21, 0x0c, 0x77, 0x5c, 0xf1,
+    0x01, 0x79, 0xe9, 0x0e, 0xd5, 0x06, 0x40, 0x21, 0x0c, 0x77, 0x5c, 0xf1, 0x01, 0xcb, 0xe9, 0x08,
+    0xf3, 0x08, 0x40, 0x10, 0x8c, 0x0c, 0x40, 0x10, 0x84, 0x05, 0x40, 0x94, 0x84, 0x02, 0xf0, 0x03,
+    0x4e, 0x05, 0x00, 0x09, 0x84, 0x21, 0x40, 0x10, 0x80, 0x0c, 0x40, 0x94, 0x84, 0x04, 0x48, 0xff,
+    0xfd, 0xb0, 0xf1, 0x01, 0xc9, 0x0d, 0xf3, 0x02, 0xcb, 0x06, 0x46, 0x20, 0x01, 0x19, 0x58, 0x21,
+    0x0a, 0xf8, 0xd5, 0x23, 0x46, 0x20, 0x01, 0x19, 0x58, 0x21, 0x0a, 0xfc, 0xd5, 0x1e, 0xf0, 0x01,
+    0x84, 0xa1, 0xd8, 0x0d, 0xf3, 0x02, 0xcb, 0x06, 0x46, 0x20, 0x01, 0x19, 0x58, 0x21, 0x0b, 0x00,
+    0xd5, 0x14, 0x46, 0x20, 0x01, 0x19, 0x58, 0x21, 0x0b, 0x04, 0xd5, 0x0f, 0xf0, 0x01, 0x84, 0xa2,
+    0xd8, 0x0e, 0xf3, 0x02, 0xcb, 0x06, 0x46, 0x20, 0x01, 0x19, 0x58, 0x21, 0x0b, 0x08, 0xd5, 0x05,
+    0x46, 0x20, 0x01, 0x19, 0x58, 0x21, 0x0b, 0x0c, 0x38, 0x91, 0x70, 0x08, 0xf0, 0x02, 0x84, 0xa2,
+    0x9c, 0x41, 0x96, 0x48, 0xf1, 0x82, 0x4c, 0x12, 0xfd, 0x1a, 0xf0, 0x01, 0x84, 0xa3, 0x9c, 0x41,
+    0x96, 0x48, 0xf1, 0x81, 0x4c, 0x12, 0xfc, 0xca, 0x50, 0x7f, 0x80, 0x34, 0xb4, 0x1f, 0x46, 0x60,
+    0x00, 0x87, 0x58, 0x63, 0x0f, 0x24, 0x44, 0x10, 0x02, 0x4c, 0x80, 0x47, 0xdd, 0x26, 0xb4, 0x1f,
+    0x46, 0x20, 0x01, 0x19, 0x58, 0x21, 0x0a, 0xf8, 0x38, 0xa1, 0x00, 0x00, 0xf3, 0x0d, 0x46, 0x20,
+    0x01, 0x19, 0x58, 0x21, 0x0a, 0xfc, 0x46, 0x18, 0x08, 0x08, 0x38, 0x91, 0x00, 0x00, 0x58, 0x10,
+    0x80, 0x80, 0x46, 0x20, 0x01, 0x19, 0x58, 0x21, 0x0b, 0x00, 0x38, 0x41, 0x00, 0x00, 0x40, 0x31,
+    0x84, 0x02, 0x46, 0x20, 0x01, 0x19, 0x58, 0x21, 0x0b, 0x04, 0x40, 0x54, 0xa0, 0x08, 0x40, 0x35,
+    0x0c, 0x04, 0x38, 0x21, 0x00, 0x00, 0x40, 0x31, 0x94, 0x04, 0x40, 0x42, 0x40, 0x08, 0x40, 0x31,
+    0x90, 0x04, 0x40, 0x21, 0x60, 0x08, 0x40, 0x31, 0x88, 0x04, 0xf3, 0x8d, 0x80, 0x43, 0x46, 0x80,
+    0x00, 0x87, 0x58, 0x84, 0x0f, 0x88, 0x44, 0x10, 0x02, 0x4c, 0xdd, 0x28, 0xb4, 0x1f, 0x44, 0x10,
+    0x02, 0x50, 0x80, 0x47, 0xdd, 0x26, 0xb4, 0x7f, 0x46, 0x20, 0x01, 0x19, 0x58, 0x21, 0x0b, 0x08,
+    0x38, 0x41, 0x0c, 0x00, 0x46, 0x20, 0x01, 0x19, 0x58, 0x21, 0x0b, 0x0c, 0x38, 0x21, 0x0c, 0x00,
+    0xf3, 0x0d, 0x44, 0x0f, 0x80, 0x80, 0x40, 0x31, 0x80, 0x02, 0x40, 0x32, 0x0c, 0x04, 0x40, 0x21,
+    0x20, 0x08, 0x40, 0x31, 0x88, 0x04, 0xf3, 0x8d, 0xb4, 0x1f, 0x80, 0x43, 0x44, 0x10, 0x02, 0x50,
+    0xdd, 0x28, 0xb4, 0x1f, 0x44, 0x10, 0x02, 0x4c, 0x80, 0x47, 0xdd, 0x26, 0xb4, 0x1f, 0x44, 0x10,
+    0x02, 0x50, 0x80, 0x47, 0xdd, 0x26, 0xb4, 0x1f, 0x44, 0x10, 0x02, 0x64, 0x80, 0x47, 0xdd, 0x26,
+    0xf2, 0x0d, 0x46, 0x18, 0x0f, 0xff, 0x58, 0x10, 0x8f, 0xff, 0x40, 0x21, 0x04, 0x02, 0x40, 0xa5,
+    0x60, 0x08, 0xb4, 0x1f, 0x40, 0x25, 0x08, 0x04, 0x44, 0x10, 0x02, 0x64, 0xdd, 0x28, 0xb4, 0x1f,
+    0x80, 0x47, 0x44, 0x10, 0x02, 0x78, 0xdd, 0x26, 0xf2, 0x0d, 0x46, 0x38, 0x0f, 0xff, 0x58, 0x31,
+    0x8f, 0xff, 0x40, 0x21, 0x0c, 0x02, 0x40, 0x94, 0xe0, 0x08, 0xb4, 0x1f, 0x40, 0x24, 0x88, 0x04,
+    0x44, 0x10, 0x02, 0x78, 0xdd, 0x28, 0xf0, 0x04, 0xc8, 0x16, 0x46, 0x60, 0x04, 0x12, 0x46, 0xf0,
+    0x00, 0x88, 0x58, 0xf7, 0x80, 0x20, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x80, 0xac,
+    0xdd, 0x2f, 0x84, 0x01, 0xa8, 0x34, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f,
+    0xf1, 0x04, 0xa8, 0x74, 0xec, 0x3c, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa0, 0xbc,
+    0x97, 0xc0, 0x46, 0x60, 0x00, 0x87, 0x58, 0x63, 0x0f, 0x88, 0xc7, 0x10, 0x84, 0x00, 0x46, 0x2a,
+    0x00, 0x56, 0x58, 0x21, 0x04, 0x06, 0x80, 0x20, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x2a, 0x00, 0x56,
+    0x58, 0x21, 0x04, 0x06, 0x84, 0x20, 0x84, 0x01, 0xd5, 0x0f, 0x46, 0x2a, 0x00, 0x56, 0x58, 0x21,
+    0x04, 0x02, 0x80, 0x27, 0x80, 0x07, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x2a, 0x00, 0x56, 0x58, 0x21,
+    0x04, 0x02, 0x84, 0x01, 0x80, 0x27, 0x4b, 0xe0, 0x18, 0x01, 0x84, 0x00, 0x46, 0x60, 0x00, 0x87,
+    0x58, 0x63, 0x0f, 0x88, 0x44, 0x10, 0x03, 0x08, 0x80, 0x40, 0xdd, 0x26, 0x44, 0x10, 0x03, 0x08,
+    0x44, 0x20, 0x08, 0x00, 0x84, 0x00, 0xdd, 0x26, 0x46, 0x80, 0x00, 0x87, 0x58, 0x84, 0x0f, 0x04,
+    0x44, 0x00, 0x00, 0x23, 0xdd, 0x28, 0x84, 0x00, 0x44, 0x10, 0x03, 0x08, 0x80, 0x40, 0xdd, 0x26,
+    0x44, 0x10, 0x03, 0x08, 0x44, 0x20, 0x40, 0x00, 0x84, 0x00, 0xdd, 0x26, 0x84, 0x0a, 0xdd, 0x28,
+    0x84, 0x00, 0x44, 0x10, 0x03, 0x08, 0x80, 0x40, 0xdd, 0x26, 0x44, 0x10, 0x03, 0x08, 0x44, 0x20,
+    0x08, 0x00, 0x84, 0x00, 0xdd, 0x26, 0x44, 0x00, 0x00, 0x23, 0xdd, 0x28, 0x84, 0x00, 0x44, 0x10,
+    0x03, 0x08, 0x80, 0x40, 0xdd, 0x26, 0x84, 0x00, 0x44, 0x10, 0x03, 0x08, 0x44, 0x20, 0x10, 0x00,
+    0xdd, 0x26, 0x44, 0x00, 0x00, 0x50, 0xdd, 0x28, 0xc7, 0x62, 0x84, 0x00, 0x44, 0x10, 0x03, 0x08,
+    0x80, 0x40, 0xdd, 0x26, 0x44, 0x10, 0x03, 0x08, 0x44, 0x21, 0x00, 0x00, 0x84, 0x00, 0xdd, 0x26,
+    0x44, 0x00, 0x00, 0x28, 0xdd, 0x28, 0x84, 0x00, 0x44, 0x10, 0x03, 0x08, 0x80, 0x40, 0xdd, 0x26,
+    0x44, 0x10, 0x03, 0x08, 0x44, 0x22, 0x00, 0x00, 0x84, 0x00, 0xdd, 0x26, 0x44, 0x00, 0x00, 0x14,
+    0xdd, 0x28, 0x84, 0x00, 0x44, 0x10, 0x03, 0x08, 0x80, 0x40, 0xdd, 0x26, 0x44, 0x10, 0x03, 0x08,
+    0x44, 0x24, 0x00, 0x00, 0x84, 0x00, 0xdd, 0x26, 0x44, 0x00, 0x00, 0x28, 0xdd, 0x28, 0x84, 0x00,
+    0x44, 0x10, 0x03, 0x08, 0x80, 0x40, 0xdd, 0x26, 0x46, 0x20, 0x00, 0x80, 0x44, 0x10, 0x03, 0x08,
+    0x84, 0x00, 0xdd, 0x26, 0x44, 0x00, 0x00, 0x14, 0xdd, 0x28, 0x44, 0x10, 0x03, 0x08, 0x84, 0x40,
+    0x84, 0x01, 0xdd, 0x26, 0x44, 0x10, 0x03, 0x08, 0x44, 0x24, 0x00, 0x00, 0x84, 0x01, 0xdd, 0x26,
+    0x44, 0x00, 0x00, 0x28, 0xdd, 0x28, 0x44, 0x10, 0x03, 0x08, 0x84, 0x40, 0x84, 0x01, 0xdd, 0x26,
+    0x46, 0x20, 0x00, 0x80, 0x44, 0x10, 0x03, 0x08, 0x84, 0x01, 0xdd, 0x26, 0x44, 0x00, 0x00, 0x14,
+    0xdd, 0x28, 0x84, 0x00, 0x46, 0x28, 0x00, 0x56, 0x58, 0x21, 0x00, 0x04, 0x80, 0x20, 0xdd, 0x26,
+    0x46, 0x28, 0x00, 0x56, 0x58, 0x21, 0x00, 0x04, 0x84, 0x20, 0xd5, 0x41, 0x44, 0x10, 0x03, 0x08,
+    0x80, 0x47, 0x80, 0x07, 0xdd, 0x26, 0x46, 0x20, 0x01, 0x00, 0x44, 0x10, 0x03, 0x08, 0x80, 0x07,
+    0xdd, 0x26, 0x44, 0x00, 0x00, 0x32, 0xdd, 0x28, 0x44, 0x10, 0x03, 0x08, 0x80, 0x47, 0x84, 0x01,
+    0xdd, 0x26, 0x46, 0x20, 0x01, 0x00, 0x44, 0x10, 0x03, 0x08, 0x84, 0x01, 0xdd, 0x26, 0x44, 0x00,
+    0x00, 0x32, 0xdd, 0x28, 0x44, 0x10, 0x03, 0x08, 0x80, 0x47, 0x80, 0x07, 0xdd, 0x26, 0x46, 0x20,
+    0x02, 0x00, 0x44, 0x10, 0x03, 0x08, 0x80, 0x07, 0xdd, 0x26, 0x44, 0x00, 0x00, 0x32, 0xdd, 0x28,
+    0x44, 0x10, 0x03, 0x08, 0x80, 0x47, 0x84, 0x01, 0xdd, 0x26, 0x46, 0x20, 0x02, 0x00, 0x44, 0x10,
+    0x03, 0x08, 0x84, 0x01, 0xdd, 0x26, 0x44, 0x00, 0x00, 0x32, 0xdd, 0x28, 0x46, 0x28, 0x00, 0x56,
+    0x80, 0x27, 0x80, 0x07, 0xdd, 0x26, 0x46, 0x28, 0x00, 0x56, 0x80, 0x27, 0x84, 0x01, 0xdd, 0x26,
+    0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xa4, 0xbc, 0xef, 0xf4, 0x97, 0x80,
+    0x46, 0x00, 0x04, 0x12, 0x46, 0x70, 0x00, 0x88, 0x58, 0x73, 0x80, 0x80, 0x58, 0x00, 0x00, 0x04,
+    0xdd, 0x27, 0x46, 0x00, 0x04, 0x12, 0x44, 0x10, 0x00, 0x42, 0xa8, 0x41, 0x46, 0x90, 0x00, 0x87,
+    0x58, 0x94, 0x8f, 0xc4, 0x80, 0x06, 0x84, 0x20, 0xdd, 0x29, 0x46, 0x28, 0x00, 0x56, 0x46, 0x80,
+    0x00, 0x87, 0x58, 0x84, 0x0f, 0x88, 0x58, 0x21, 0x0f, 0x57, 0x84, 0x20, 0x80, 0x06, 0xdd, 0x28,
+    0x80, 0x06, 0x44, 0x10, 0x00, 0x10, 0xdd, 0x29, 0x46, 0x23, 0x04, 0xf0, 0x58, 0x21, 0x00, 0x06,
+    0x44, 0x10, 0x00, 0x10, 0x80, 0x06, 0xdd, 0x28, 0x80, 0x06, 0x44, 0x10, 0x02, 0x44, 0xdd, 0x29,
+    0x44, 0x21, 0x01, 0x00, 0x44, 0x10, 0x02, 0x44, 0x80, 0x06, 0xdd, 0x28, 0x80, 0x06, 0x44, 0x10,
+    0x02, 0x98, 0xdd, 0x29, 0x46, 0x20, 0x30, 0x30, 0x58, 0x21, 0x03, 0x04, 0x44, 0x10, 0x02, 0x98,
+    0x80, 0x06, 0xdd, 0x28, 0x80, 0x06, 0x44, 0x10, 0x02, 0xa8, 0xdd, 0x29, 0x44, 0x10, 0x02, 0xa8,
+    0x50, 0x2f, 0x80, 0x04, 0x80, 0x06, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x24, 0xdd, 0x2f,
+    0xf2, 0x01, 0x42, 0x21, 0x60, 0x09, 0x44, 0x10, 0x02, 0xa8, 0x80, 0x06, 0xdd, 0x28, 0x80, 0x06,
+    0x44, 0x10, 0x01, 0x14, 0xdd, 0x29, 0x46, 0x20, 0x0c, 0x21, 0x58, 0x21, 0x01, 0xf1, 0x44, 0x10,
+    0x01, 0x14, 0x80, 0x06, 0xdd, 0x28, 0x80, 0x06, 0x44, 0x10, 0x01, 0x30, 0xdd, 0x29, 0x46, 0x20,
+    0xab, 0x92, 0x58, 0x21, 0x03, 0xbc, 0x44, 0x10, 0x01, 0x30, 0x80, 0x06, 0xdd, 0x28, 0x80, 0x06,
+    0x44, 0x10, 0x02, 0x10, 0xdd, 0x29, 0x44, 0x20, 0x95, 0x95, 0x44, 0x10, 0x02, 0x10, 0x80, 0x06,
+    0xdd, 0x28, 0x46, 0x00, 0x04, 0x12, 0x85, 0x00, 0x84, 0x21, 0xa8, 0x44, 0x14, 0x80, 0x00, 0x04,
+    0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x00, 0x88, 0xdd, 0x27, 0x46, 0x00, 0x04, 0x12, 0x84, 0x22,
+    0x14, 0x10, 0x00, 0x22, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x03, 0x00, 0xdd, 0x27, 0x46, 0x00,
+    0x04, 0x12, 0x44, 0x10, 0x74, 0x08, 0x14, 0x10, 0x00, 0xc0, 0x46, 0x00, 0x04, 0x11, 0x58, 0x00,
+    0x00, 0x04, 0xdd, 0x27, 0x46, 0x00, 0x04, 0x11, 0x58, 0x00, 0x00, 0x04, 0x84, 0x28, 0xb7, 0x00,
+    0xb6, 0x20, 0xb7, 0x00, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x00, 0x80, 0xdd, 0x27, 0x46, 0x00,
+    0x04, 0x12, 0x44, 0x13, 0x00, 0x01, 0x14, 0x10, 0x00, 0x20, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00,
+    0x07, 0x18, 0xdd, 0x27, 0x46, 0x00, 0x04, 0x12, 0x46, 0x1c, 0x00, 0x02, 0x58, 0x10, 0x81, 0x01,
+    0x14, 0x10, 0x01, 0xc6, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x07, 0x3c, 0xdd, 0x27, 0x46, 0x00,
+    0x04, 0x12, 0x46, 0x18, 0x00, 0x00, 0x14, 0x10, 0x01, 0xcf, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00,
+    0x07, 0x04, 0xdd, 0x27, 0x46, 0x00, 0x04, 0x12, 0x14, 0x80, 0x01, 0xc1, 0x46, 0x00, 0x04, 0x12,
+    0x58, 0x00, 0x07, 0x14, 0xdd, 0x27, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x09, 0x34, 0xdd, 0x27,
+    0x46, 0x38, 0x00, 0x00, 0x58, 0x31, 0x80, 0x12, 0x46, 0x10, 0x04, 0x12, 0x40, 0x23, 0x78, 0x08,
+    0x80, 0x01, 0x40, 0x21, 0x0c, 0x04, 0x58, 0x33, 0x00, 0x80, 0x14, 0x30, 0x81, 0xc5, 0x14, 0x20,
+    0x02, 0x4d, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x09, 0x80, 0xdd, 0x27, 0x46, 0x00, 0x04, 0x12,
+    0x58, 0x00, 0x07, 0x00, 0xdd, 0x27, 0x46, 0x30, 0x04, 0x12, 0x46, 0x47, 0x0f, 0x20, 0x80, 0x43,
+    0x80, 0x02, 0x46, 0x10, 0x92, 0xf5, 0x58, 0x42, 0x00, 0x06, 0x14, 0x41, 0x82, 0x60, 0x58, 0x10,
+    0x89, 0x08, 0x44, 0x31, 0x00, 0x00, 0x14, 0x31, 0x01, 0xc0, 0x80, 0xe0, 0x14, 0x10, 0x01, 0xda,
+    0x46, 0x90, 0x00, 0x87, 0x58, 0x94, 0x8f, 0x04, 0x44, 0x00, 0x03, 0xe8, 0x4b, 0xe0, 0x24, 0x01,
+    0x04, 0x03, 0x81, 0xdd, 0x8d, 0x01, 0x54, 0x00, 0x00, 0x80, 0xc0, 0x05, 0x44, 0x50, 0x00, 0x64,
+    0x4c, 0x82, 0xff, 0xf4, 0x46, 0x00, 0x04, 0x12, 0x46, 0x10, 0x92, 0xf5, 0x58, 0x10, 0x89, 0x00,
+    0x14, 0x10, 0x01, 0xda, 0x04, 0x00, 0x01, 0xf4, 0xce, 0x04, 0x54, 0x10, 0x00, 0x07, 0xd5, 0x05,
+    0x40, 0x10, 0x10, 0x09, 0x54, 0x10, 0x80, 0x07, 0x84, 0xa7, 0xd1, 0x17, 0x9c, 0x89, 0xce, 0x0a,
+    0x92, 0x03, 0x94, 0x03, 0x46, 0x10, 0x04, 0x12, 0x40, 0x21, 0x00, 0x04, 0x14, 0x20, 0x81, 0xf4,
+    0xd5, 0x0c, 0x44, 0x1f, 0xff, 0x8f, 0x40, 0x00, 0x04, 0x02, 0x94, 0x94, 0x46, 0x10, 0x04, 0x12,
+    0x40, 0x01, 0x00, 0x04, 0x14, 0x00, 0x81, 0xf4, 0x46, 0x80, 0x00, 0x88, 0x58, 0x84, 0x00, 0xac,
+    0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x80, 0x20, 0xdd, 0x2f, 0x4b, 0xe0, 0x20, 0x01, 0x46, 0x00,
+    0x04, 0x11, 0x58, 0x00, 0x00, 0x04, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x80, 0x80, 0xdd, 0x2f,
+    0x46, 0x00, 0x04, 0x11, 0x58, 0x00, 0x00, 0x04, 0x84, 0xe0, 0x84, 0x28, 0xb6, 0xe0, 0xb6, 0x20,
+    0xb6, 0xe0, 0x46, 0x60, 0x04, 0x12, 0x4b, 0xe0, 0x20, 0x01, 0x84, 0x01, 0xa8, 0x34, 0x46, 0xf0,
+    0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0xa9, 0xf4, 0xec, 0x0c, 0x3a, 0x6f, 0xa4, 0x84,
+    0xdd, 0x9e, 0x92, 0x00, 0x46, 0x20, 0x01, 0x12, 0x04, 0x11, 0x02, 0xfe, 0x46, 0x30, 0x01, 0x19,
+    0x58, 0x31, 0x8d, 0x30, 0x38, 0x01, 0x86, 0x0a, 0x9c, 0xc9, 0xb4, 0x80, 0x46, 0x00, 0x01, 0x19,
+    0x58, 0x00, 0x0d, 0xb0, 0x38, 0x40, 0x06, 0x0a, 0x14, 0x31, 0x02, 0xfe, 0xdd, 0x9e, 0x92, 0x00,
+    0x46, 0xf0, 0x01, 0x12, 0x04, 0x07, 0x82, 0xfe, 0x4e, 0x07, 0x00, 0x1a, 0x9e, 0x41, 0x94, 0x4a,
+    0x46, 0x30, 0x01, 0x19, 0x58, 0x31, 0x8d, 0xb0, 0x98, 0x8b, 0x46, 0x30, 0x01, 0x19, 0x58, 0x31,
+    0x8d, 0x30, 0x98, 0x4b, 0x0c, 0x30, 0xff, 0xff, 0x0c, 0x41, 0x7f, 0xff, 0x9e, 0x01, 0xb6, 0x83,
+    0x4e, 0x06, 0xff, 0xfa, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x07, 0x82, 0xfe, 0xdd, 0x9e, 0x92, 0x00,
+    0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xbc, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x27, 0x80, 0x33, 0x96, 0x00,
+    0x96, 0x48, 0x40, 0x31, 0x40, 0x09, 0xf0, 0x86, 0x84, 0xa1, 0xf1, 0x8b, 0x10, 0x3f, 0x80, 0x3e,
+    0x12, 0x2f, 0x80, 0x1e, 0xd9, 0x06, 0x84, 0x28, 0xf1, 0x8a, 0x44, 0x90, 0x00, 0xb8, 0xd5, 0x0f,
+    0x46, 0xf0, 0x01, 0x12, 0x00, 0x47, 0x8b, 0xa9, 0x44, 0x30, 0x00, 0xa4, 0x44, 0x20, 0x00, 0xb8,
+    0x40, 0x91, 0x90, 0x1a, 0x40, 0x91, 0x10, 0x1b, 0x84, 0x44, 0xf2, 0x8a, 0x46, 0x00, 0x04, 0x12,
+    0x46, 0x60, 0x00, 0x88, 0x58, 0x63, 0x0f, 0x30, 0x58, 0x00, 0x07, 0x14, 0xdd, 0x26, 0x46, 0x00,
+    0x04, 0x12, 0x58, 0x00, 0x07, 0x6c, 0xdd, 0x26, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x07, 0x70,
+    0xdd, 0x26, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x07, 0x18, 0xdd, 0x26, 0x46, 0x00, 0x04, 0x12,
+    0x58, 0x00, 0x09, 0x34, 0xdd, 0x26, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x09, 0x80, 0xdd, 0x26,
+    0xf3, 0x06, 0x46, 0x20, 0x04, 0x12, 0x46, 0x18, 0x00, 0x00, 0x58, 0x41, 0x80, 0x80, 0x46, 0x0c,
+    0x00, 0x02, 0x40, 0x31, 0xf8, 0x08, 0x58, 0x10, 0x80, 0x12, 0x14, 0x41, 0x01, 0xc5, 0x84, 0xa0,
+    0x46, 0x60, 0x0f, 0xff, 0x40, 0x11, 0x84, 0x04, 0x58, 0x00, 0x01, 0x01, 0x50, 0x2f, 0x80, 0x3f,
+    0xf1, 0x8c, 0x58, 0x63, 0x0f, 0xff, 0xf0, 0x89, 0xf5, 0x85, 0xf2, 0x81, 0x48, 0x00, 0x00, 0xc0,
+    0x46, 0x30, 0x04, 0x12, 0x40, 0x24, 0xa0, 0x08, 0xf3, 0x87, 0xf0, 0x06, 0x40, 0x21, 0x24, 0x04,
+    0x44, 0x10, 0x02, 0x10, 0xf3, 0x88, 0xf3, 0x84, 0xf5, 0x82, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7,
+    0x8f, 0x88, 0xdd, 0x2f, 0xf0, 0x07, 0xf1, 0x08, 0xf2, 0x04, 0x47, 0xc0, 0x04, 0x12, 0x58, 0x00,
+    0x07, 0x18, 0x58, 0x10, 0x87, 0x6c, 0x58, 0x21, 0x07, 0x70, 0x59, 0xce, 0x00, 0x10, 0x14, 0x9f,
+    0x80, 0x0d, 0xf0, 0x87, 0xf1, 0x88, 0xf2, 0x84, 0x04, 0x9f, 0x80, 0x0b, 0xf5, 0x02, 0x80, 0x7c,
+    0x50, 0xaf, 0x80, 0x3c, 0x83, 0x86, 0xf1, 0x09, 0xf0, 0x07, 0xb6, 0x20, 0x44, 0x00, 0x00, 0x3f,
+    0xf2, 0x08, 0x84, 0x21, 0xb6, 0x02, 0x00, 0x05, 0x00, 0x00, 0x4c, 0x90, 0xc0, 0x09, 0x40, 0x10,
+    0x20, 0x08, 0xf2, 0x04, 0x40, 0x00, 0x80, 0x04, 0xb6, 0x02, 0xd5, 0x0b, 0xf2, 0x04, 0x40, 0x00,
+    0x40, 0x08, 0x46, 0x10, 0x04, 0x12, 0xb6, 0x02, 0x44, 0x00, 0x00, 0x60, 0x14, 0x00, 0x83, 0x04,
+    0x84, 0x01, 0xb6, 0x03, 0xf3, 0x83, 0xf5, 0x82, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04,
+    0xdd, 0x2f, 0xf3, 0x03, 0x46, 0x00, 0x04, 0x12, 0x84, 0x20, 0xb6, 0x23, 0x14, 0x10, 0x02, 0x4d,
+    0x80, 0x40, 0xf1, 0x0c, 0x14, 0x10, 0x02, 0x4d, 0x84, 0x00, 0x14, 0x01, 0x02, 0x60, 0x84, 0x21,
+    0xf5, 0x02, 0x4c, 0x90, 0xc0, 0x07, 0x46, 0x0c, 0x00, 0x10, 0x58, 0x00, 0x00, 0x06, 0xd5, 0x05,
+    0x46, 0x0c, 0x00, 0x20, 0x58, 0x00, 0x00, 0x0c, 0x84, 0x20, 0x14, 0x01, 0x02, 0x60, 0x80, 0xc1,
+    0xd5, 0x0f, 0x44, 0x10, 0x00, 0x65, 0x4c, 0x60, 0x80, 0x15, 0xf3, 0x83, 0xf5, 0x82, 0x97, 0x91,
+    0x4b, 0xe0, 0x20, 0x01, 0x04, 0x13, 0x82, 0x7f, 0xf3, 0x03, 0xf5, 0x02, 0xd5, 0x06, 0x80, 0xe2,
+    0x46, 0x80, 0x00, 0x87, 0x58, 0x84, 0x0f, 0x04, 0x96, 0x4c, 0x9c, 0xb1, 0x84, 0x0a, 0xc1, 0xea,
+    0x84, 0x41, 0x4c, 0x91, 0x40, 0x0b, 0x46, 0x10, 0x04, 0x12, 0x46, 0x0c, 0x00, 0x10, 0x58, 0x10,
+    0x89, 0x80, 0x58, 0x00, 0x00, 0x06, 0xd5, 0x09, 0x46, 0x10, 0x04, 0x12, 0x46, 0x0c, 0x00, 0x20,
+    0x58, 0x10, 0x89, 0x80, 0x58, 0x00, 0x00, 0x0c, 0xb6, 0x01, 0x46, 0x00, 0x04, 0x12, 0x04, 0x00,
+    0x02, 0x61, 0x8d, 0x41, 0x40, 0x20, 0x70, 0x06, 0x40, 0x12, 0x80, 0x06, 0x40, 0x50, 0x04, 0x1b,
+    0x41, 0xc0, 0x08, 0x1b, 0xf0, 0x01, 0x4c, 0xa0, 0x7f, 0x80, 0x44, 0x20, 0xff, 0xfd, 0x04, 0x9f,
+    0x80, 0x0d, 0x80, 0xdc, 0xe2, 0x5c, 0xe9, 0x06, 0x5c, 0xf2, 0xb0, 0x00, 0xe8, 0x0d, 0x8d, 0x21,
+    0xd5, 0x02, 0x8f, 0x21, 0xf2, 0x05, 0x9c, 0x51, 0x96, 0x49, 0xf1, 0x85, 0xf3, 0x05, 0xf0, 0x0a,
+    0xe2, 0x60, 0x4e, 0xf3, 0xff, 0x3f, 0x46, 0x60, 0x04, 0x12, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7,
+    0x8f, 0x5c, 0xdd, 0x2f, 0x84, 0x01, 0xa8, 0x34, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04,
+    0xdd, 0x2f, 0x84, 0x00, 0xa8, 0x34, 0xec, 0x44, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x92, 0x00,
+    0x84, 0x21, 0x80, 0x40, 0x44, 0x00, 0x02, 0x58, 0x40, 0x31, 0x00, 0x97, 0x9c, 0x49, 0x96, 0x48,
+    0x98, 0x18, 0x84, 0x6b, 0x92, 0x01, 0x4c, 0x11, 0xff, 0xf9, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc,
+    0xef, 0xb4, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x47, 0x8b, 0xa8, 0x96, 0x00, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x27, 0x8b, 0xa9, 0xf0, 0x81, 0x84, 0x6c, 0x84, 0x00, 0x56, 0x42, 0x00, 0x01, 0xf2, 0x8d,
+    0x84, 0x46, 0xf0, 0x85, 0x40, 0x01, 0x90, 0x1a, 0x40, 0x01, 0x10, 0x1b, 0xf3, 0x01, 0x96, 0x48,
+    0x84, 0x40, 0xf1, 0x86, 0x58, 0x31, 0x80, 0x80, 0x84, 0x24, 0xf0, 0x8e, 0xf1, 0x83, 0xf2, 0x84,
+    0xf2, 0x8a, 0xf2, 0x8b, 0xf2, 0x82, 0xf2, 0x88, 0xf3, 0x8f, 0xf4, 0x06, 0x46, 0x60, 0x00, 0x87,
+    0x58, 0x63, 0x0f, 0xc4, 0x46, 0x70, 0x00, 0x87, 0x58, 0x73, 0x8f, 0x88, 0xc4, 0x7e, 0xf0, 0x01,
+    0x84, 0x20, 0xdd, 0x26, 0xf0, 0x01, 0x46, 0x28, 0x00, 0x56, 0x58, 0x21, 0x07, 0x57, 0x84, 0x20,
+    0xdd, 0x27, 0xf0, 0x01, 0x44, 0x10, 0x00, 0x10, 0xdd, 0x26, 0xf0, 0x01, 0x46, 0x23, 0x0d, 0x70,
+    0x58, 0x21, 0x00, 0x06, 0x44, 0x10, 0x00, 0x10, 0xdd, 0x27, 0xf0, 0x01, 0x44, 0x10, 0x02, 0x44,
+    0xdd, 0x26, 0xf0, 0x01, 0x44, 0x10, 0x02, 0x44, 0x44, 0x21, 0x01, 0x80, 0xdd, 0x27, 0xf0, 0x01,
+    0x44, 0x21, 0x01, 0x40, 0x44, 0x10, 0x02, 0x44, 0xdd, 0x27, 0xf0, 0x01, 0x44, 0x10, 0x00, 0x58,
+    0xdd, 0x26, 0xf0, 0x01, 0x44, 0x10, 0x00, 0x54, 0xdd, 0x26, 0xf0, 0x01, 0x46, 0x26, 0x57, 0xc0,
+    0x44, 0x10, 0x00, 0x58, 0xdd, 0x27, 0xf0, 0x01, 0x46, 0x20, 0x15, 0xac, 0x58, 0x21, 0x0a, 0x00,
+    0x44, 0x10, 0x00, 0x54, 0xdd, 0x27, 0xf0, 0x01, 0x44, 0x10, 0x02, 0x10, 0xdd, 0x26, 0xf0, 0x01,
+    0x44, 0x10, 0x01, 0x14, 0xdd, 0x26, 0xf0, 0x01, 0x46, 0x20, 0x0c, 0x21, 0x58, 0x21, 0x01, 0xf1,
+    0x44, 0x10, 0x01, 0x14, 0xdd, 0x27, 0x46, 0x30, 0x04, 0x10, 0x84, 0x48, 0x14, 0x21, 0x81, 0x48,
+    0x94, 0x56, 0xf0, 0x01, 0x46, 0x80, 0x00, 0x87, 0x58, 0x84, 0x0f, 0x24, 0xdd, 0x26, 0xf0, 0x01,
+    0x46, 0x20, 0x50, 0x00, 0x58, 0x21, 0x01, 0x0f, 0x44, 0x10, 0x02, 0x00, 0xdd, 0x27, 0x05, 0xcf,
+    0x80, 0x0e, 0x84, 0xc0, 0x46, 0x70, 0x00, 0x87, 0x58, 0x73, 0x8f, 0x04, 0xf0, 0x01, 0x44, 0x10,
+    0x02, 0x00, 0x50, 0x2f, 0x80, 0x40, 0x4b, 0xe0, 0x20, 0x01, 0xf1, 0x10, 0x9d, 0xb1, 0x54, 0x10,
+    0x81, 0x00, 0x97, 0xb1, 0x84, 0x05, 0x4e, 0x12, 0x00, 0x93, 0x4b, 0xe0, 0x1c, 0x01, 0x44, 0x50,
+    0x03, 0xe8, 0xde, 0xed, 0x48, 0x00, 0x00, 0x8c, 0xf0, 0x01, 0xf1, 0x06, 0xdd, 0x26, 0xf1, 0x06,
+    0xf0, 0x01, 0x46, 0x2a, 0x00, 0x56, 0x58, 0x21, 0x0f, 0x53, 0xdd, 0x27, 0xf0, 0x01, 0x84, 0x24,
+    0xdd, 0x26, 0xf0, 0x01, 0x44, 0x24, 0x01, 0x2c, 0x84, 0x24, 0xdd, 0x27, 0xf0, 0x01, 0x44, 0x10,
+    0x00, 0x10, 0xdd, 0x26, 0xf0, 0x01, 0x46, 0x23, 0x0d, 0x70, 0x58, 0x21, 0x00, 0x06, 0x44, 0x10,
+    0x00, 0x10, 0xdd, 0x27, 0xf0, 0x01, 0x44, 0x10, 0x02, 0x44, 0xdd, 0x26, 0xf0, 0x01, 0x44, 0x10,
+    0x02, 0x10, 0xdd, 0x26, 0xf1, 0x0d, 0x84, 0xa1, 0xd9, 0x09, 0xf0, 0x01, 0x44, 0x10, 0x02, 0x44,
+    0x44, 0x21, 0x01, 0x30, 0xdd, 0x27, 0x87, 0x8d, 0xd5, 0x08, 0xf0, 0x01, 0x44, 0x10, 0x02, 0x44,
+    0x44, 0x21, 0x01, 0x70, 0xdd, 0x27, 0x87, 0x86, 0xf0, 0x01, 0x46, 0x70, 0x00, 0x87, 0x58, 0x73,
+    0x8f, 0xc4, 0x44, 0x10, 0x01, 0x14, 0x4b, 0xe0, 0x1c, 0x01, 0x46, 0x20, 0x0c, 0x21, 0xf0, 0x01,
+    0x46, 0x60, 0x00, 0x87, 0x58, 0x63, 0x0f, 0x88, 0x58, 0x21, 0x01, 0xf1, 0x44, 0x10, 0x01, 0x14,
+    0x4b, 0xe0, 0x18, 0x01, 0xf0, 0x01, 0x44, 0x10, 0x00, 0x44, 0x4b, 0xe0, 0x1c, 0x01, 0xf0, 0x01,
+    0x46, 0x20, 0x04, 0x92, 0x58, 0x21, 0x00, 0x16, 0x44, 0x10, 0x00, 0x44, 0x4b, 0xe0, 0x18, 0x01,
+    0x46, 0x30, 0x04, 0x10, 0x84, 0x48, 0x14, 0x21, 0x81, 0x48, 0x94, 0x56, 0xf0, 0x01, 0x46, 0x80,
+    0x00, 0x87, 0x58, 0x84, 0x0f, 0x24, 0x4b, 0xe0, 0x1c, 0x01, 0xf0, 0x01, 0x46, 0x20, 0x50, 0x00,
+    0x58, 0x21, 0x01, 0x0f, 0x44, 0x10, 0x02, 0x00, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x70, 0x00, 0x87,
+    0x58, 0x73, 0x8f, 0x04, 0x84, 0xc0, 0xf0, 0x01, 0x44, 0x10, 0x02, 0x00, 0x50, 0x2f, 0x80, 0x40,
+    0x4b, 0xe0, 0x20, 0x01, 0xf1, 0x10, 0x9d, 0xb1, 0x54, 0x10, 0x81, 0x00, 0x97, 0xb1, 0x84, 0x05,
+    0xc1, 0x06, 0x4b, 0xe0, 0x1c, 0x01, 0x44, 0x50, 0x03, 0xe8, 0xde, 0xee, 0x46, 0x30, 0x04, 0x10,
+    0x84, 0x42, 0x14, 0x21, 0x81, 0x48, 0x46, 0x00, 0x04, 0x12, 0x46, 0x60, 0x00, 0x88, 0x58, 0x63,
+    0x00, 0x80, 0x58, 0x00, 0x00, 0x04, 0xdd, 0x26, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x07, 0x04,
+    0xdd, 0x26, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x07, 0x18, 0xdd, 0x26, 0x46, 0x00, 0x04, 0x12,
+    0x58, 0x00, 0x07, 0x14, 0xdd, 0x26, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x00, 0x88, 0xdd, 0x26,
+    0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x03, 0x00, 0xdd, 0x26, 0x46, 0x30, 0x04, 0x12, 0x44, 0x20,
+    0x74, 0x08, 0x14, 0x21, 0x80, 0xc0, 0x46, 0x00, 0x04, 0x11, 0x58, 0x00, 0x00, 0x04, 0xdd, 0x26,
+    0xf2, 0x03, 0x46, 0x30, 0x04, 0x11, 0x9e, 0x91, 0xf2, 0x87, 0x85, 0x40, 0x58, 0x31, 0x80, 0x04,
+    0x84, 0x48, 0x46, 0x40, 0x04, 0x12, 0xb7, 0x43, 0x50, 0x11, 0x90, 0x0c, 0xb6, 0x43, 0xb7, 0x43,
+    0x84, 0x61, 0x14, 0xa2, 0x00, 0x01, 0xb6, 0x61, 0xb7, 0x41, 0x80, 0x04, 0xf4, 0x07, 0x80, 0xa0,
+    0x84, 0x42, 0x14, 0x40, 0x03, 0x14, 0x14, 0x22, 0x80, 0x22, 0xb6, 0x3f, 0x50, 0x00, 0x80, 0x70,
+    0xdd, 0x26, 0x46, 0x30, 0x04, 0x12, 0x44, 0x23, 0x00, 0x01, 0x14, 0x21, 0x80, 0x20, 0x46, 0x00,
+    0x04, 0x12, 0x58, 0x00, 0x00, 0x84, 0xdd, 0x26, 0x46, 0x30, 0x04, 0x12, 0x44, 0x22, 0x00, 0x00,
+    0x14, 0x21, 0x80, 0x21, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x0c, 0xb8, 0xdd, 0x26, 0x46, 0x20,
+    0x04, 0x12, 0x14, 0xa1, 0x03, 0x2e, 0x81, 0x02, 0x46, 0x90, 0x00, 0x87, 0x58, 0x94, 0x8f, 0x04,
+    0x84, 0x05, 0x4b, 0xe0, 0x24, 0x01, 0x04, 0x44, 0x03, 0x04, 0x46, 0x70, 0x04, 0x12, 0x92, 0x83,
+    0x95, 0x23, 0x44, 0x20, 0x0b, 0x0b, 0x14, 0x44, 0x03, 0x04, 0x14, 0x23, 0x81, 0xc1, 0x80, 0xc7,
+    0xf2, 0x0f, 0x80, 0xa6, 0x46, 0x3c, 0x00, 0x02, 0x58, 0x31, 0x81, 0x01, 0x14, 0x23, 0x01, 0xc5,
+    0x14, 0x32, 0x81, 0xc6, 0x44, 0x00, 0x00, 0x32, 0x4b, 0xe0, 0x24, 0x01, 0xf3, 0x07, 0x46, 0x00,
+    0x00, 0x88, 0x40, 0x21, 0xc0, 0x08, 0x46, 0x40, 0x04, 0x12, 0x58, 0x00, 0x00, 0x80, 0x40, 0x01,
+    0x00, 0x04, 0x58, 0x42, 0x0c, 0x24, 0x14, 0xaf, 0x80, 0x09, 0xf0, 0x8c, 0x04, 0xaf, 0x80, 0x08,
+    0xf4, 0x87, 0x46, 0x30, 0x04, 0x12, 0xf1, 0x0c, 0x84, 0x81, 0xf0, 0x01, 0xa9, 0x1c, 0x84, 0x80,
+    0xa9, 0x1c, 0x40, 0x2e, 0x04, 0x04, 0x40, 0x1e, 0x20, 0x08, 0x40, 0x21, 0x04, 0x04, 0x44, 0x10,
+    0x02, 0x10, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x88, 0xdd, 0x2f, 0xf0, 0x01, 0x50, 0x2f,
+    0x80, 0x44, 0x44, 0x10, 0x02, 0x10, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x24, 0xdd, 0x2f,
+    0x46, 0x00, 0x04, 0x12, 0x46, 0x60, 0x00, 0x88, 0x58, 0x63, 0x00, 0x80, 0x58, 0x00, 0x0c, 0x08,
+    0x4b, 0xe0, 0x18, 0x01, 0xf0, 0x01, 0x46, 0x10, 0x04, 0x12, 0x14, 0x00, 0x83, 0x02, 0x84, 0x03,
+    0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00,
+    0x0c, 0x14, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x20, 0x04, 0x12, 0x44, 0x10, 0x04, 0x0c, 0x14, 0x11,
+    0x03, 0x05, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x0c, 0x04, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x20,
+    0x04, 0x12, 0x58, 0x61, 0x0c, 0x04, 0x44, 0x10, 0x00, 0x93, 0xb6, 0x26, 0xf7, 0x05, 0xd5, 0x0a,
+    0x9d, 0xf9, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x5c, 0xf3, 0x80, 0xc8,
+    0xe8, 0x06, 0xb4, 0x26, 0x84, 0x0a, 0x54, 0x10, 0x80, 0x80, 0xc9, 0xf3, 0xf7, 0x85, 0x46, 0x90,
+    0x04, 0x12, 0x46, 0x83, 0xff, 0xff, 0x46, 0x70, 0x07, 0xff, 0x58, 0x84, 0x0f, 0xff, 0x58, 0x73,
+    0x8f, 0xff, 0x84, 0xc0, 0xf3, 0x07, 0xb6, 0xc3, 0x04, 0x04, 0x83, 0x0a, 0xe6, 0xc2, 0xe8, 0x0a,
+    0xe2, 0xe0, 0xe8, 0x12, 0x46, 0x1f, 0xf0, 0x00, 0x40, 0x00, 0x20, 0x08, 0x92, 0x08, 0x98, 0x01,
+    0xd5, 0x0b, 0x84, 0xa4, 0xde, 0x09, 0xe3, 0x00, 0xe8, 0x07, 0x46, 0x48, 0x00, 0x00, 0x42, 0x00,
+    0x7c, 0x09, 0x98, 0x04, 0xd5, 0x0f, 0xce, 0x04, 0x40, 0xa0, 0x30, 0x0a, 0xd5, 0x16, 0x84, 0xa1,
+    0xde, 0x04, 0x90, 0x0c, 0xf0, 0x82, 0xd5, 0x11, 0x84, 0xa2, 0xde, 0x04, 0x90, 0x0c, 0xf0, 0x8b,
+    0xd5, 0x0c, 0xf3, 0x04, 0xf4, 0x0a, 0x90, 0x0c, 0x56, 0x13, 0x00, 0x03, 0x40, 0x30, 0x04, 0x1b,
+    0x40, 0x40, 0x04, 0x1a, 0xf3, 0x84, 0xf4, 0x8a, 0x84, 0x0a, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7,
+    0x8f, 0x04, 0xdd, 0x2f, 0x9d, 0xb1, 0x84, 0xa5, 0xde, 0xc6, 0xf3, 0x06, 0x84, 0xa1, 0xd3, 0x30,
+    0xf0, 0x03, 0x84, 0xa4, 0xd8, 0x2d, 0xf1, 0x0b, 0x42, 0x15, 0x28, 0x75, 0x5c, 0xf0, 0xab, 0xf2,
+    0xe9, 0x04, 0x51, 0xce, 0x7f, 0xff, 0xd5, 0x10, 0x5c, 0xf0, 0x87, 0x08, 0xe8, 0x21, 0x5c, 0xf0,
+    0x81, 0xc3, 0xe8, 0x04, 0x51, 0xce, 0x00, 0x05, 0xd5, 0x15, 0x5c, 0xf0, 0x82, 0xae, 0xe8, 0x04,
+    0x51, 0xce, 0x00, 0x04, 0xd5, 0x0f, 0x5c, 0xf0, 0x84, 0x23, 0xe8, 0x04, 0x51, 0xce, 0x00, 0x03,
+    0xd5, 0x09, 0x5c, 0xf0, 0x85, 0x49, 0xe8, 0x04, 0x51, 0xce, 0x00, 0x02, 0xd5, 0x03, 0x51, 0xce,
+    0x00, 0x01, 0xf2, 0x09, 0x84, 0xa6, 0x9c, 0x91, 0xf2, 0x89, 0x4c, 0x22, 0xff, 0x2c, 0xf2, 0x0b,
+    0x44, 0x80, 0x00, 0x64, 0x42, 0x25, 0x28, 0x75, 0x14, 0xaf, 0x80, 0x08, 0x42, 0x01, 0x20, 0x24,
+    0x46, 0x70, 0x00, 0x89, 0x58, 0x73, 0x82, 0x1c, 0x4b, 0xe0, 0x1c, 0x01, 0xf2, 0x0a, 0xf4, 0x02,
+    0x81, 0x20, 0x42, 0x22, 0x10, 0x75, 0x42, 0x01, 0x20, 0x24, 0x4b, 0xe0, 0x1c, 0x01, 0x80, 0xc0,
+    0xc0, 0x23, 0x4e, 0x92, 0x00, 0x22, 0x44, 0x20, 0x03, 0xe8, 0x42, 0x20, 0x08, 0x24, 0xf3, 0x04,
+    0x40, 0x21, 0x24, 0xb6, 0xf0, 0x02, 0x04, 0xaf, 0x80, 0x08, 0x84, 0x8a, 0x42, 0x30, 0x28, 0x75,
+    0x42, 0x73, 0x24, 0x24, 0x42, 0x41, 0x90, 0x24, 0x44, 0x30, 0x11, 0xe8, 0x42, 0x42, 0x0c, 0x24,
+    0x50, 0x31, 0x7c, 0x18, 0x40, 0x51, 0xa4, 0x08, 0x50, 0x21, 0x03, 0xe8, 0x41, 0xe2, 0x88, 0xd6,
+    0x40, 0x32, 0x1c, 0x96, 0xd5, 0x03, 0x84, 0x60, 0x83, 0xc3, 0xf1, 0x01, 0x54, 0x81, 0x80, 0x7f,
+    0x54, 0x0f, 0x00, 0x7f, 0xc9, 0x0a, 0x46, 0x70, 0x04, 0x12, 0x40, 0x84, 0x20, 0x08, 0x58, 0x73,
+    0x8c, 0x60, 0x50, 0x63, 0x80, 0x10, 0xd5, 0x09, 0x46, 0x70, 0x04, 0x12, 0x40, 0x84, 0x20, 0x08,
+    0x58, 0x73, 0x8c, 0x64, 0x50, 0x63, 0x80, 0x10, 0xb7, 0x07, 0x46, 0x50, 0x04, 0x12, 0xb6, 0x06,
+    0x04, 0x22, 0x83, 0x04, 0x58, 0x21, 0x00, 0x07, 0x14, 0x22, 0x83, 0x04, 0xf2, 0x06, 0xca, 0x1f,
+    0x54, 0x71, 0x80, 0x7f, 0x84, 0x64, 0x80, 0x05, 0x83, 0x80, 0x81, 0x40, 0x81, 0x20, 0x81, 0x00,
+    0xf3, 0x83, 0x40, 0x73, 0xa0, 0x08, 0x54, 0x2f, 0x00, 0x7f, 0x80, 0x23, 0x9e, 0x49, 0x14, 0x10,
+    0x03, 0x14, 0xf4, 0x01, 0xcc, 0x06, 0x14, 0x74, 0x83, 0x18, 0x14, 0x24, 0x03, 0x1c, 0xd5, 0x05,
+    0x14, 0x7e, 0x03, 0x19, 0x14, 0x25, 0x03, 0x1d, 0xc9, 0xf2, 0xf1, 0x83, 0x80, 0x45, 0x84, 0xe0,
+    0x14, 0x71, 0x01, 0xc6, 0x46, 0x60, 0x00, 0x88, 0x58, 0x63, 0x00, 0xac, 0x46, 0xf0, 0x00, 0x88,
+    0x58, 0xf7, 0x80, 0x20, 0xdd, 0x2f, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x00, 0x04, 0x11, 0x58, 0x00,
+    0x00, 0x04, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x80, 0x80, 0xdd, 0x2f, 0x46, 0x30, 0x04, 0x11,
+    0x58, 0x31, 0x80, 0x04, 0x84, 0x48, 0xb6, 0xe3, 0xb6, 0x43, 0xb6, 0xe3, 0x46, 0x80, 0x04, 0x12,
+    0x4b, 0xe0, 0x18, 0x01, 0x46, 0x40, 0x04, 0x12, 0x80, 0x64, 0x84, 0x01, 0x14, 0x72, 0x03, 0x24,
+    0x14, 0x71, 0x83, 0x25, 0x14, 0x04, 0x00, 0x04, 0x46, 0x60, 0x00, 0x87, 0x58, 0x63, 0x0f, 0x04,
+    0x4b, 0xe0, 0x18, 0x01, 0x14, 0x74, 0x00, 0x04, 0x84, 0x02, 0x4b, 0xe0, 0x18, 0x01, 0xf0, 0x06,
+    0xc0, 0x06, 0xf1, 0x03, 0x9e, 0x49, 0xf1, 0x83, 0x4e, 0x13, 0xfc, 0xb9, 0xec, 0x4c, 0x3a, 0x6f,
+    0xaa, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xfc, 0x46, 0x10, 0x04, 0x11, 0x84, 0x48,
+    0x96, 0x00, 0x04, 0xa0, 0x80, 0x01, 0xa8, 0x89, 0xe6, 0x0f, 0xe8, 0x0a, 0x46, 0x00, 0x04, 0x12,
+    0x46, 0x12, 0x02, 0x02, 0x58, 0x00, 0x0c, 0xe0, 0x58, 0x10, 0x80, 0x20, 0xd5, 0x73, 0x46, 0xf0,
+    0x01, 0x12, 0x00, 0x17, 0x8b, 0xaa, 0xc9, 0x2a, 0x5c, 0xf0, 0x00, 0x34, 0xe8, 0x0a, 0x46, 0x00,
+    0x04, 0x12, 0x46, 0x16, 0x45, 0x03, 0x58, 0x00, 0x0c, 0xe0, 0x58, 0x10, 0x8f, 0x3f, 0xd5, 0x62,
+    0x5c, 0xf0, 0x00, 0x45, 0xe8, 0x02, 0xd5, 0x4d, 0x5c, 0xf0, 0x00, 0x75, 0xe8, 0x02, 0xd5, 0x49,
+    0x5c, 0xf0, 0x00, 0xae, 0xe8, 0x0a, 0x46, 0x00, 0x04, 0x12, 0x46, 0x13, 0xf3, 0xf3, 0x58, 0x00,
+    0x0c, 0xe0, 0x58, 0x10, 0x8f, 0x3f, 0xd5, 0x4e, 0x46, 0x00, 0x04, 0x12, 0x46, 0x16, 0x46, 0x43,
+    0x58, 0x00, 0x0c, 0xe0, 0x58, 0x10, 0x8f, 0x3f, 0xd5, 0x45, 0x5c, 0xf0, 0x00, 0x34, 0xe8, 0x0a,
+    0x46, 0x00, 0x04, 0x12, 0x46, 0x13, 0xf3, 0xf3, 0x58, 0x00, 0x0c, 0xe0, 0x58, 0x10, 0x83, 0x33,
+    0xd5, 0x39, 0x5c, 0xf0, 0x00, 0x45, 0xe8, 0x0a, 0x46, 0x00, 0x04, 0x12, 0x46, 0x13, 0xf3, 0xf2,
+    0x58, 0x00, 0x0c, 0xe0, 0x58, 0x10, 0x88, 0x33, 0xd5, 0x2d, 0x5c, 0xf0, 0x00, 0x75, 0xe8, 0x0a,
+    0x46, 0x00, 0x04, 0x12, 0x46, 0x13, 0x33, 0x32, 0x58, 0x00, 0x0c, 0xe0, 0x58, 0x10, 0x88, 0x33,
+    0xd5, 0x21, 0x5c, 0xf0, 0x00, 0xae, 0xe8, 0x0a, 0x46, 0x00, 0x04, 0x12, 0x46, 0x13, 0x33, 0x32,
+    0x58, 0x00, 0x0c, 0xe0, 0x58, 0x10, 0x80, 0x28, 0xd5, 0x15, 0x5c, 0xf0, 0x00, 0xc5, 0xe8, 0x0a,
+    0x46, 0x00, 0x04, 0x12, 0x46, 0x15, 0x05, 0x03, 0x58, 0x00, 0x0c, 0xe0, 0x58, 0x10, 0x8f, 0x3f,
+    0xd5, 0x09, 0x46, 0x00, 0x04, 0x12, 0x46, 0x15, 0x05, 0x03, 0x58, 0x00, 0x0c, 0xe0, 0x58, 0x10,
+    0x83, 0x33, 0xb6, 0x20, 0x46, 0x60, 0x04, 0x12, 0x81, 0x06, 0x84, 0x01, 0x44, 0x10, 0xff, 0xff,
+    0x05, 0xc3, 0x00, 0xc2, 0x14, 0x13, 0x00, 0xc2, 0x14, 0x04, 0x00, 0x04, 0x46, 0x90, 0x00, 0x87,
+    0x58, 0x94, 0x8f, 0x04, 0x4b, 0xe0, 0x24, 0x01, 0x46, 0x70, 0x04, 0x12, 0x84, 0x20, 0x14, 0x14,
+    0x00, 0x04, 0x44, 0x10, 0x33, 0xf0, 0x80, 0x07, 0x14, 0x13, 0x83, 0x2f, 0x44, 0x10, 0x00, 0x4c,
+    0x14, 0x10, 0x03, 0x2e, 0x44, 0x00, 0x00, 0x14, 0x4b, 0xe0, 0x24, 0x01, 0x44, 0x00, 0x33, 0xe0,
+    0x14, 0x03, 0x83, 0x2f, 0x44, 0x00, 0x00, 0x14, 0x4b, 0xe0, 0x24, 0x01, 0x46, 0x00, 0x04, 0x11,
+    0x15, 0xc3, 0x00, 0xc2, 0x14, 0xa0, 0x00, 0x01, 0xec, 0x04, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0x9c, 0x3c, 0x46, 0x20, 0x04, 0x12, 0x04, 0x11, 0x01, 0xca, 0x80, 0xc2, 0x46, 0x10,
+    0x10, 0x00, 0x84, 0x60, 0x14, 0x13, 0x01, 0xc9, 0x44, 0x44, 0x00, 0x00, 0x04, 0x71, 0x01, 0xca,
+    0x98, 0x4c, 0x97, 0xf8, 0x98, 0xdf, 0x46, 0x70, 0x12, 0xc0, 0x80, 0xa2, 0x80, 0x82, 0x4c, 0x13,
+    0xff, 0xf3, 0x46, 0x10, 0x12, 0x80, 0x14, 0x12, 0x81, 0xc9, 0x84, 0x4a, 0x04, 0x12, 0x01, 0xca,
+    0x44, 0x40, 0x00, 0x37, 0x96, 0x48, 0x42, 0x10, 0x90, 0x24, 0x40, 0x10, 0x88, 0x57, 0x9a, 0xd9,
+    0xe0, 0x60, 0xe9, 0x03, 0x84, 0x00, 0xd5, 0x05, 0x5e, 0x31, 0xff, 0xf2, 0x56, 0x01, 0x80, 0x01,
+    0x3a, 0x6f, 0x9c, 0x04, 0xdd, 0x9e, 0x92, 0x00, 0x46, 0x00, 0x01, 0x11, 0x58, 0x00, 0x0e, 0x68,
+    0x46, 0x20, 0x04, 0x12, 0xb4, 0x20, 0x58, 0x51, 0x03, 0x20, 0xd1, 0x05, 0x9d, 0x6c, 0xd1, 0x03,
+    0xa0, 0x81, 0xb6, 0x41, 0x8c, 0x08, 0x46, 0x50, 0x01, 0x11, 0x58, 0x52, 0x8f, 0x28, 0xd8, 0xf1,
+    0xdd, 0x9e, 0x92, 0x00, 0x46, 0x00, 0x01, 0x11, 0x58, 0x00, 0x0c, 0x38, 0x46, 0x20, 0x04, 0x12,
+    0xb4, 0x20, 0x58, 0x51, 0x03, 0x20, 0xd1, 0x05, 0x9d, 0x6c, 0xd1, 0x03, 0xa0, 0x81, 0xb6, 0x41,
+    0x8c, 0x08, 0x46, 0x50, 0x01, 0x11, 0x58, 0x52, 0x8e, 0x68, 0xd8, 0xf1, 0x46, 0x00, 0x04, 0x00,
+    0xb4, 0x00, 0x92, 0x04, 0x54, 0x00, 0x00, 0x0f, 0xe6, 0x03, 0xe9, 0x08, 0x46, 0x00, 0x04, 0x12,
+    0x46, 0x18, 0x70, 0x00, 0x58, 0x10, 0x83, 0x0a, 0xa8, 0x43, 0xdd, 0x9e, 0x3a, 0x6f, 0x9c, 0x3c,
+    0x46, 0x00, 0x01, 0x11, 0x58, 0x00, 0x0c, 0x18, 0xa0, 0x47, 0xb4, 0xc0, 0xa1, 0xc1, 0xa1, 0x02,
+    0xa1, 0x43, 0xa0, 0x84, 0xa0, 0xc5, 0xa0, 0x06, 0xb6, 0xe6, 0xb6, 0xa4, 0xb6, 0x62, 0xb6, 0x20,
+    0x3a, 0x6f, 0x9c, 0x04, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xa4, 0xbc, 0xef, 0xfc, 0x46, 0x60,
+    0x01, 0x11, 0x58, 0x63, 0x0b, 0xc8, 0x46, 0x70, 0x00, 0x87, 0x58, 0x73, 0x8f, 0x88, 0xa6, 0x30,
+    0x84, 0xa9, 0xd8, 0x0e, 0x02, 0x83, 0x00, 0x01, 0x04, 0x93, 0x00, 0x01, 0x80, 0x28, 0x80, 0x49,
+    0x84, 0x00, 0x4b, 0xe0, 0x1c, 0x01, 0x80, 0x28, 0x80, 0x49, 0x84, 0x01, 0xd5, 0x05, 0xe6, 0x02,
+    0xe8, 0x05, 0xa4, 0x71, 0xa0, 0xb1, 0x4b, 0xe0, 0x1c, 0x01, 0x8c, 0xc8, 0x46, 0x50, 0x01, 0x11,
+    0x58, 0x52, 0x8c, 0x18, 0xde, 0xe5, 0xec, 0x04, 0x3a, 0x6f, 0xa4, 0x84, 0xdd, 0x9e, 0x92, 0x00,
+    0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xfc, 0x55, 0xc0, 0x00, 0xff, 0x4f, 0xc2, 0x00, 0x0e, 0x46, 0xf0,
+    0x01, 0x12, 0x00, 0x07, 0x8b, 0xa8, 0x84, 0xa1, 0xd8, 0x13, 0x46, 0x60, 0x01, 0x12, 0x58, 0x63,
+    0x0a, 0xcc, 0x85, 0x4b, 0xd5, 0x0f, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x07, 0x8b, 0xa9, 0x84, 0xa1,
+    0xd8, 0x07, 0x46, 0x60, 0x01, 0x12, 0x58, 0x63, 0x0b, 0x24, 0x85, 0x45, 0xd5, 0x03, 0x84, 0xc0,
+    0x81, 0x46, 0x80, 0xe6, 0x85, 0x20, 0x46, 0x80, 0x00, 0x87, 0x58, 0x84, 0x0f, 0x88, 0xd5, 0x15,
+    0xa6, 0x38, 0x84, 0xa9, 0xd8, 0x0a, 0xa4, 0x79, 0xa0, 0xb9, 0x84, 0x00, 0x4b, 0xe0, 0x20, 0x01,
+    0xa4, 0x79, 0xa0, 0xb9, 0x84, 0x01, 0xd5, 0x05, 0xe6, 0x02, 0xe8, 0x05, 0xa4, 0x79, 0xa0, 0xb9,
+    0x4b, 0xe0, 0x20, 0x01, 0x8d, 0x21, 0x8c, 0xe8, 0xe1, 0x2a, 0xe9, 0xeb, 0x4f, 0xc2, 0x00, 0x0e,
+    0x46, 0xf0, 0x01, 0x12, 0x00, 0x87, 0x8b, 0xaa, 0x84, 0xa1, 0x4c, 0x82, 0xc0, 0x13, 0x46, 0x60,
+    0x01, 0x12, 0x58, 0x63, 0x0b, 0x4c, 0xd5, 0x0e, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x87, 0x8b, 0xab,
+    0x84, 0xa1, 0x4c, 0x82, 0xc0, 0x07, 0x46, 0x60, 0x01, 0x12, 0x58, 0x63, 0x0b, 0x54, 0xd5, 0x02,
+    0x85, 0x00, 0x84, 0x00, 0x46, 0x70, 0x00, 0x87, 0x58, 0x73, 0x8f, 0x88, 0xd5, 0x14, 0xa6, 0x30,
+    0x84, 0xa9, 0xd8, 0x0a, 0xa4, 0x71, 0xa0, 0xb1, 0x84, 0x00, 0x4b, 0xe0, 0x1c, 0x01, 0xa4, 0x71,
+    0xa0, 0xb1, 0x84, 0x01, 0xd5, 0x05, 0xe6, 0x02, 0xe8, 0x05, 0xa4, 0x71, 0xa0, 0xb1, 0x4b, 0xe0,
+    0x1c, 0x01, 0x84, 0x01, 0xe0, 0x08, 0xe9, 0xec, 0xec, 0x04, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0xa4, 0xbc, 0xef, 0xf4, 0x84, 0x00, 0xf0, 0x81, 0x46, 0x60, 0x01, 0x11, 0x58, 0x63,
+    0x0b, 0xb0, 0x46, 0x70, 0x00, 0x87, 0x58, 0x73, 0x8f, 0x88, 0xa6, 0x30, 0x84, 0xa9, 0xd8, 0x0e,
+    0x02, 0x83, 0x00, 0x01, 0x04, 0x93, 0x00, 0x01, 0x80, 0x28, 0x80, 0x49, 0x84, 0x00, 0x4b, 0xe0,
+    0x1c, 0x01, 0x80, 0x28, 0x80, 0x49, 0x84, 0x01, 0xd5, 0x05, 0xe6, 0x02, 0xe8, 0x05, 0xa4, 0x71,
+    0xa0, 0xb1, 0x4b, 0xe0, 0x1c, 0x01, 0x8c, 0xc8, 0x46, 0x50, 0x01, 0x11, 0x58, 0x52, 0x8b, 0xc8,
+    0xde, 0xe5, 0x50, 0x8f, 0x80, 0x04, 0x46, 0x70, 0x00, 0x87, 0x58, 0x73, 0x8f, 0x24, 0x80, 0x48,
+    0x44, 0x10, 0x00, 0x34, 0x84, 0x00, 0x4b, 0xe0, 0x1c, 0x01, 0xf2, 0x01, 0x46, 0x60, 0x00, 0x87,
+    0x58, 0x63, 0x0f, 0x88, 0x44, 0x10, 0x00, 0x34, 0x58, 0x21, 0x00, 0x01, 0x84, 0x00, 0x4b, 0xe0,
+    0x18, 0x01, 0x80, 0x48, 0x44, 0x10, 0x00, 0x34, 0x84, 0x01, 0x4b, 0xe0, 0x1c, 0x01, 0xf2, 0x01,
+    0x84, 0x01, 0x40, 0x21, 0x00, 0x04, 0x44, 0x10, 0x00, 0x34, 0x4b, 0xe0, 0x18, 0x01, 0xec, 0x0c,
+    0x3a, 0x6f, 0xa4, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xf4, 0x84, 0xe0,
+    0x54, 0xa0, 0x00, 0xff, 0x55, 0xc0, 0x80, 0xff, 0x50, 0x6f, 0x80, 0x04, 0x44, 0x10, 0x01, 0x30,
+    0x80, 0x07, 0x80, 0x46, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x24, 0xdd, 0x2f, 0xf0, 0x01,
+    0x84, 0x61, 0x42, 0x00, 0x48, 0x09, 0x42, 0x00, 0x4c, 0x09, 0x4d, 0xc1, 0xc0, 0x05, 0x42, 0x00,
+    0x48, 0x08, 0xd5, 0x03, 0x42, 0x00, 0x4c, 0x08, 0xf0, 0x81, 0x44, 0x10, 0x01, 0x30, 0xf2, 0x01,
+    0x80, 0x07, 0x46, 0x90, 0x01, 0x10, 0x58, 0x94, 0x88, 0x2e, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7,
+    0x8f, 0x88, 0xdd, 0x2f, 0x50, 0x84, 0x80, 0x22, 0x02, 0x04, 0x80, 0x00, 0xe3, 0x40, 0xe9, 0x30,
+    0x02, 0x04, 0x80, 0x01, 0xe2, 0x0a, 0xe9, 0x2c, 0x44, 0x10, 0x00, 0x58, 0x80, 0x46, 0x80, 0x07,
+    0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x24, 0xdd, 0x2f, 0xf0, 0x01, 0x46, 0x1f, 0x8f, 0xff,
+    0x58, 0x10, 0x8f, 0xff, 0x84, 0x61, 0x40, 0x00, 0x04, 0x02, 0x4d, 0xc1, 0xc0, 0x05, 0x00, 0x14,
+    0x00, 0x00, 0xd5, 0x08, 0x4f, 0xc3, 0x00, 0x05, 0x04, 0x14, 0x7f, 0xff, 0xd5, 0x03, 0x00, 0x14,
+    0x00, 0x01, 0x40, 0x10, 0xe0, 0x08, 0x40, 0x00, 0x80, 0x04, 0xf0, 0x81, 0x44, 0x10, 0x00, 0x58,
+    0xf2, 0x01, 0x80, 0x07, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x88, 0xdd, 0x2f, 0x50, 0x84,
+    0x00, 0x34, 0x46, 0x50, 0x01, 0x10, 0x58, 0x52, 0x89, 0xbc, 0x50, 0x94, 0x80, 0x34, 0x4c, 0x82,
+    0xff, 0xc5, 0x9d, 0xf9, 0x84, 0xa2, 0xdf, 0x9b, 0xe7, 0x4f, 0xe8, 0x0e, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x57, 0x8b, 0xa9, 0x84, 0x61, 0xd3, 0x06, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x57, 0x8b, 0xab,
+    0xdb, 0x14, 0x84, 0x00, 0xd5, 0x0d, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x57, 0x8b, 0xa8, 0x84, 0x21,
+    0xd1, 0x06, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x57, 0x8b, 0xaa, 0xd9, 0x07, 0x84, 0x01, 0x46, 0xf0,
+    0x00, 0x89, 0x58, 0xf7, 0x8b, 0xfc, 0xdd, 0x2f, 0xec, 0x0c, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e,
+    0x96, 0x00, 0x96, 0x48, 0x96, 0x90, 0xe6, 0x0f, 0xe8, 0x24, 0x84, 0x01, 0x4c, 0x10, 0x40, 0x12,
+    0x40, 0x21, 0x04, 0x03, 0x46, 0x30, 0x01, 0x12, 0x58, 0x31, 0x89, 0x44, 0x46, 0x40, 0x01, 0x12,
+    0x58, 0x42, 0x08, 0xfc, 0x40, 0x02, 0x08, 0x1a, 0x40, 0x01, 0x88, 0x1b, 0x84, 0x29, 0xd5, 0x49,
+    0x46, 0x10, 0x01, 0x12, 0x58, 0x10, 0x89, 0xc4, 0x56, 0x21, 0x00, 0x01, 0x46, 0x30, 0x01, 0x12,
+    0x58, 0x31, 0x89, 0x8c, 0x40, 0x01, 0x88, 0x1a, 0x40, 0x00, 0x88, 0x1b, 0x84, 0x27, 0xd5, 0x39,
+    0x84, 0x01, 0x4c, 0x10, 0x40, 0x1b, 0x84, 0xa2, 0xda, 0x07, 0x46, 0x00, 0x01, 0x12, 0x58, 0x00,
+    0x09, 0xfc, 0x84, 0x23, 0xd5, 0x2e, 0x84, 0x66, 0x56, 0x21, 0x00, 0x01, 0x84, 0x07, 0x40, 0x11,
+    0x88, 0x1a, 0x40, 0x10, 0x08, 0x1b, 0x46, 0x40, 0x01, 0x12, 0x58, 0x42, 0x0a, 0x14, 0x46, 0x30,
+    0x01, 0x12, 0x58, 0x31, 0x8a, 0x44, 0xd5, 0x19, 0x84, 0xa2, 0xda, 0x07, 0x46, 0x00, 0x01, 0x12,
+    0x58, 0x00, 0x0a, 0x7c, 0x84, 0x21, 0xd5, 0x15, 0x84, 0x64, 0x56, 0x21, 0x00, 0x01, 0x84, 0x05,
+    0x40, 0x11, 0x88, 0x1a, 0x40, 0x10, 0x08, 0x1b, 0x46, 0x40, 0x01, 0x12, 0x58, 0x42, 0x0a, 0x84,
+    0x46, 0x30, 0x01, 0x12, 0x58, 0x31, 0x8a, 0xa4, 0x40, 0x02, 0x08, 0x1a, 0x40, 0x01, 0x88, 0x1b,
+    0x84, 0x40, 0xb4, 0x60, 0xa1, 0x01, 0x9c, 0x91, 0xb6, 0x83, 0x8c, 0x08, 0xe0, 0x41, 0xe9, 0xfa,
+    0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x9c, 0x3c, 0x46, 0x00, 0x04, 0x11, 0x46, 0x18, 0x02, 0x50,
+    0x46, 0x60, 0x04, 0x12, 0x46, 0x50, 0x07, 0x77, 0x80, 0x86, 0x84, 0x48, 0xa1, 0xc1, 0xa8, 0x81,
+    0x58, 0x52, 0x87, 0x77, 0x84, 0x00, 0x48, 0x00, 0x00, 0xaf, 0x84, 0x21, 0x4c, 0x00, 0x80, 0x92,
+    0xe6, 0x06, 0x4e, 0xf3, 0x00, 0x92, 0xe6, 0x0b, 0x4e, 0xf3, 0x00, 0x92, 0xe6, 0x11, 0x4e, 0xf3,
+    0x00, 0x92, 0xe6, 0x17, 0x4e, 0xf3, 0x00, 0x92, 0xe6, 0x1e, 0x4e, 0xf3, 0x00, 0x92, 0x5c, 0xf0,
+    0x00, 0x28, 0x4e, 0xf3, 0x00, 0x91, 0x5c, 0xf0, 0x00, 0x3a, 0x4e, 0xf3, 0x00, 0x90, 0x5c, 0xf0,
+    0x00, 0x46, 0x4e, 0xf3, 0x00, 0x8f, 0x5c, 0xf0, 0x00, 0x58, 0x4e, 0xf3, 0x00, 0x88, 0x5c, 0xf0,
+    0x00, 0x62, 0x4e, 0xf3, 0x00, 0x81, 0x5c, 0xf0, 0x00, 0x69, 0xe9, 0x7a, 0x5c, 0xf0, 0x00, 0x6f,
+    0xe9, 0x74, 0x5c, 0xf0, 0x00, 0x75, 0xe9, 0x6e, 0x5c, 0xf0, 0x00, 0x7a, 0xe9, 0x68, 0x5c, 0xf0,
+    0x00, 0x7e, 0xe9, 0x62, 0x5c, 0xf0, 0x00, 0x81, 0xe9, 0x5c, 0x5c, 0xf0, 0x00, 0x83, 0xe9, 0x5c,
+    0x5c, 0xf0, 0x00, 0x88, 0xe9, 0x5f, 0x5c, 0xf0, 0x00, 0x8a, 0xe9, 0x5f, 0x5c, 0xf0, 0x00, 0x8e,
+    0xe9, 0x5f, 0x5c, 0xf0, 0x00, 0x92, 0xe9, 0x5f, 0x5c, 0xf0, 0x00, 0x9a, 0xe9, 0x5f, 0x5c, 0xf0,
+    0x00, 0xa0, 0xe9, 0x5f, 0x5c, 0xf0, 0x00, 0xa8, 0xe9, 0x59, 0x5c, 0xf0, 0x00, 0xac, 0xe9, 0x53,
+    0x5c, 0xf0, 0x00, 0xb0, 0xe9, 0x4d, 0x5c, 0xf0, 0x00, 0xb2, 0xe9, 0x47, 0x5c, 0xf0, 0x00, 0xb5,
+    0xe9, 0x41, 0x5c, 0xf0, 0x00, 0xb7, 0xe9, 0x3b, 0x5c, 0xf0, 0x00, 0xb9, 0xe9, 0x35, 0x5c, 0xf0,
+    0x00, 0xbb, 0xe9, 0x2f, 0x44, 0x10, 0x00, 0xbb, 0x4c, 0x00, 0x80, 0x2f, 0x9c, 0x49, 0x4c, 0x00,
+    0x80, 0x2f, 0x9c, 0x49, 0x4c, 0x00, 0x80, 0x2f, 0x9c, 0x49, 0x4c, 0x00, 0x80, 0x2f, 0x9c, 0x49,
+    0x4c, 0x00, 0x80, 0x2f, 0x5c, 0xf0, 0x00, 0xc2, 0xe9, 0x2e, 0x5c, 0xf0, 0x00, 0xc6, 0xe9, 0x2e,
+    0x5c, 0xf0, 0x00, 0xca, 0xe9, 0x2e, 0x5c, 0xf0, 0x00, 0xce, 0xe9, 0x28, 0x5c, 0xf0, 0x00, 0xd0,
+    0xe9, 0x22, 0x8c, 0x31, 0x4c, 0x00, 0x80, 0x1d, 0x9c, 0x49, 0x4c, 0x00, 0x80, 0x17, 0x9c, 0x49,
+    0x4c, 0x00, 0x80, 0x11, 0x9c, 0x49, 0x4c, 0x00, 0x80, 0x0b, 0x9c, 0x49, 0x4c, 0x00, 0x80, 0x05,
+    0x46, 0x18, 0x02, 0x50, 0xd5, 0x18, 0x46, 0x18, 0x02, 0x40, 0xd5, 0x15, 0x46, 0x18, 0x02, 0x30,
+    0xd5, 0x12, 0x46, 0x18, 0x02, 0x20, 0xd5, 0x0f, 0x46, 0x18, 0x02, 0x10, 0xd5, 0x0c, 0x46, 0x18,
+    0x02, 0x00, 0xd5, 0x09, 0x46, 0x18, 0x01, 0xf0, 0xd5, 0x06, 0x46, 0x18, 0x01, 0xe0, 0xd5, 0x03,
+    0x46, 0x18, 0x01, 0xd0, 0x40, 0x10, 0x04, 0x04, 0x80, 0x44, 0x14, 0x53, 0x01, 0x8c, 0x9c, 0x01,
+    0x14, 0x12, 0x01, 0x8d, 0x44, 0x10, 0x00, 0xd6, 0x80, 0x65, 0x4c, 0x00, 0xff, 0x48, 0x46, 0x00,
+    0x04, 0x11, 0x9e, 0x5c, 0x14, 0x31, 0x01, 0x8c, 0x14, 0x11, 0x01, 0x8c, 0xa9, 0xc1, 0x3a, 0x6f,
+    0x9c, 0x04, 0xdd, 0x9e, 0x3a, 0x6f, 0xa0, 0xbc, 0x46, 0x70, 0x04, 0x11, 0x84, 0xc0, 0x46, 0x80,
+    0x00, 0x87, 0x58, 0x84, 0x0f, 0x04, 0x04, 0x13, 0x80, 0x80, 0x9d, 0xb1, 0x96, 0x4c, 0x84, 0x01,
+    0xc1, 0x06, 0x4b, 0xe0, 0x20, 0x01, 0x44, 0x50, 0x75, 0x30, 0xde, 0xf6, 0x46, 0x70, 0x04, 0x12,
+    0x84, 0xc0, 0x46, 0x80, 0x00, 0x87, 0x58, 0x84, 0x0f, 0x04, 0x04, 0x13, 0x80, 0x4c, 0x9d, 0xb1,
+    0x84, 0x01, 0xc1, 0x06, 0x4b, 0xe0, 0x20, 0x01, 0x44, 0x50, 0x75, 0x30, 0xde, 0xf7, 0x3a, 0x6f,
+    0xa0, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xe4, 0x54, 0x90, 0x00, 0xff, 0x96, 0xc8,
+    0x96, 0x90, 0xe7, 0x22, 0x4e, 0xf2, 0x01, 0x83, 0xca, 0x0e, 0x44, 0x00, 0x00, 0xe0, 0x42, 0x94,
+    0x80, 0x24, 0x46, 0x00, 0x01, 0x1c, 0x58, 0x00, 0x05, 0x50, 0x89, 0x20, 0x10, 0x24, 0x80, 0x00,
+    0x48, 0x00, 0x01, 0x75, 0x44, 0xa0, 0x00, 0xe0, 0x42, 0xa4, 0xa8, 0x24, 0x46, 0x10, 0x01, 0x1c,
+    0x58, 0x10, 0x85, 0x50, 0x40, 0x65, 0x04, 0x00, 0x50, 0x63, 0x00, 0x88, 0x84, 0x81, 0x50, 0x8f,
+    0x80, 0x14, 0x10, 0x43, 0x7f, 0x78, 0x10, 0x33, 0x7f, 0x79, 0x46, 0x70, 0x00, 0x87, 0x58, 0x73,
+    0x8f, 0x24, 0x44, 0x10, 0x02, 0x14, 0x80, 0x48, 0x84, 0x00, 0xdd, 0x27, 0xf3, 0x05, 0x44, 0x10,
+    0x02, 0x18, 0x14, 0x33, 0x7f, 0xdf, 0x80, 0x48, 0x84, 0x00, 0xdd, 0x27, 0x44, 0x30, 0x00, 0x38,
+    0x42, 0x34, 0x8c, 0x24, 0xf5, 0x05, 0x9c, 0xd9, 0x46, 0x40, 0x01, 0x1c, 0x58, 0x42, 0x05, 0x50,
+    0x94, 0xda, 0x98, 0xdc, 0xa9, 0x59, 0x44, 0x10, 0x02, 0x1c, 0x80, 0x48, 0x84, 0x00, 0xdd, 0x27,
+    0x44, 0x30, 0x00, 0x1c, 0x42, 0x34, 0x8c, 0x24, 0x05, 0xef, 0x80, 0x05, 0x9c, 0xd9, 0x47, 0xc0,
+    0x01, 0x1c, 0x59, 0xce, 0x05, 0x50, 0x94, 0xdb, 0x88, 0x7c, 0x15, 0xe1, 0x80, 0x01, 0x44, 0x10,
+    0x02, 0x20, 0x80, 0x48, 0x84, 0x00, 0xdd, 0x27, 0xf3, 0x05, 0x44, 0x10, 0x02, 0x24, 0x14, 0x33,
+    0x7f, 0xe2, 0x80, 0x48, 0x84, 0x00, 0xdd, 0x27, 0x84, 0x6e, 0x42, 0x34, 0x8c, 0x24, 0xf4, 0x05,
+    0x9c, 0xd9, 0x94, 0xdc, 0x88, 0x7c, 0xa9, 0x19, 0x44, 0x10, 0x02, 0x28, 0x80, 0x48, 0x84, 0x00,
+    0xdd, 0x27, 0xf5, 0x05, 0x44, 0x10, 0x02, 0x14, 0x14, 0x53, 0x7f, 0xe4, 0x80, 0x48, 0x84, 0x01,
+    0xdd, 0x27, 0x05, 0xcf, 0x80, 0x05, 0x44, 0x10, 0x02, 0x18, 0x15, 0xc3, 0x7f, 0xe5, 0x80, 0x48,
+    0x84, 0x01, 0xdd, 0x27, 0x05, 0xef, 0x80, 0x05, 0x44, 0x10, 0x02, 0x1c, 0x15, 0xe3, 0x7f, 0xe6,
+    0x80, 0x48, 0x84, 0x01, 0xdd, 0x27, 0x84, 0x67, 0x42, 0x34, 0x8c, 0x24, 0xf4, 0x05, 0x9c, 0xd9,
+    0x46, 0x00, 0x01, 0x1c, 0x58, 0x00, 0x05, 0x50, 0x94, 0xdd, 0x98, 0xd8, 0xa9, 0x19, 0x44, 0x10,
+    0x02, 0x20, 0x80, 0x48, 0x84, 0x01, 0xdd, 0x27, 0xf5, 0x05, 0x44, 0x10, 0x02, 0x24, 0x14, 0x53,
+    0x7f, 0xe8, 0x80, 0x48, 0x84, 0x01, 0xdd, 0x27, 0x05, 0xcf, 0x80, 0x05, 0x44, 0x10, 0x02, 0x28,
+    0x15, 0xc3, 0x7f, 0xe9, 0x80, 0x48, 0x84, 0x01, 0xdd, 0x27, 0x05, 0xef, 0x80, 0x05, 0x44, 0x10,
+    0x02, 0x4c, 0x15, 0xe3, 0x7f, 0xea, 0x80, 0x48, 0x84, 0x00, 0xdd, 0x27, 0xf3, 0x05, 0x50, 0x53,
+    0x7f, 0xac, 0xb6, 0x65, 0xf5, 0x83, 0x44, 0x10, 0x02, 0x50, 0x80, 0x48, 0x84, 0x00, 0xdd, 0x27,
+    0x05, 0xcf, 0x80, 0x05, 0x50, 0x43, 0x7f, 0xb0, 0x15, 0xc2, 0x00, 0x00, 0xf4, 0x82, 0x44, 0x10,
+    0x02, 0x64, 0x80, 0x48, 0x84, 0x00, 0xdd, 0x27, 0x05, 0xef, 0x80, 0x05, 0x50, 0x33, 0x7f, 0xb4,
+    0x15, 0xe1, 0x80, 0x00, 0xf3, 0x81, 0x44, 0x10, 0x02, 0x78, 0x80, 0x48, 0x84, 0x00, 0xdd, 0x27,
+    0x05, 0xef, 0x80, 0x05, 0x51, 0xc3, 0x7f, 0xb8, 0x15, 0xee, 0x00, 0x00, 0x44, 0x10, 0x02, 0x4c,
+    0x80, 0x48, 0x84, 0x01, 0xdd, 0x27, 0x05, 0xef, 0x80, 0x05, 0xf5, 0x03, 0x44, 0x10, 0x02, 0x50,
+    0x15, 0xe2, 0x80, 0x00, 0x80, 0x48, 0x84, 0x01, 0xdd, 0x27, 0xf4, 0x02, 0xf5, 0x05, 0x44, 0x10,
+    0x02, 0x64, 0xb6, 0xa4, 0x80, 0x48, 0x84, 0x01, 0xdd, 0x27, 0xf3, 0x01, 0x05, 0xef, 0x80, 0x05,
+    0x80, 0x48, 0x15, 0xe1, 0x80, 0x00, 0x44, 0x10, 0x02, 0x78, 0x84, 0x01, 0xdd, 0x27, 0xf1, 0x05,
+    0x46, 0x00, 0x04, 0x12, 0xb6, 0x3c, 0x04, 0x10, 0x01, 0xdd, 0x46, 0x20, 0x0f, 0xf0, 0x40, 0x10,
+    0x88, 0x02, 0x14, 0x13, 0x7f, 0xf3, 0x04, 0x10, 0x01, 0xe6, 0xb6, 0x26, 0x04, 0x10, 0x01, 0xe7,
+    0xa8, 0x71, 0x04, 0x10, 0x01, 0xe8, 0xa8, 0x72, 0x04, 0x10, 0x01, 0xe9, 0xa8, 0x73, 0x04, 0x10,
+    0x01, 0xf0, 0xa8, 0x74, 0x04, 0x10, 0x01, 0xf1, 0xa8, 0x75, 0x04, 0x10, 0x01, 0xf2, 0xa8, 0x76,
+    0x04, 0x00, 0x01, 0xf3, 0x50, 0xa5, 0x00, 0xa8, 0x46, 0x50, 0x04, 0x12, 0x80, 0x85, 0x80, 0x64,
+    0x80, 0x43, 0x80, 0x22, 0x46, 0x70, 0x01, 0x1c, 0x58, 0x73, 0x85, 0x50, 0xa8, 0x37, 0x40, 0x65,
+    0x1c, 0x00, 0x84, 0x00, 0x14, 0x02, 0x83, 0x14, 0x47, 0xe0, 0x07, 0xf0, 0x04, 0xa2, 0x03, 0x18,
+    0x04, 0x81, 0x83, 0x19, 0x05, 0xc1, 0x03, 0x1c, 0x04, 0x70, 0x83, 0x1d, 0x55, 0xce, 0x00, 0x7f,
+    0x41, 0xce, 0x20, 0x08, 0x54, 0x73, 0x80, 0x7f, 0x40, 0x7e, 0x1c, 0x04, 0x47, 0xc7, 0xf0, 0x00,
+    0x40, 0xa5, 0x40, 0x08, 0x40, 0xa5, 0x70, 0x02, 0x40, 0x84, 0x20, 0x08, 0x40, 0x73, 0xa8, 0x04,
+    0x40, 0x84, 0x78, 0x02, 0x40, 0x73, 0xa0, 0x04, 0xab, 0xf1, 0x9c, 0x01, 0x84, 0xe4, 0x4c, 0x03,
+    0xff, 0xdb, 0x44, 0x00, 0x00, 0xe0, 0x42, 0x04, 0x80, 0x24, 0x04, 0x10, 0x82, 0x06, 0x46, 0xa0,
+    0x01, 0x1c, 0x58, 0xa5, 0x05, 0x50, 0x88, 0x0a, 0x50, 0x00, 0x00, 0xb8, 0xb6, 0x20, 0x80, 0x22,
+    0x04, 0x20, 0x82, 0x07, 0xa8, 0x81, 0x04, 0x20, 0x82, 0x08, 0xa8, 0x82, 0x04, 0x20, 0x82, 0x09,
+    0xa8, 0x83, 0x04, 0x20, 0x82, 0x0a, 0xa8, 0x84, 0x04, 0x20, 0x82, 0x0b, 0xa8, 0x85, 0x04, 0x20,
+    0x81, 0xcf, 0xa8, 0x86, 0x04, 0x20, 0x83, 0x04, 0xa8, 0x87, 0x04, 0x20, 0x83, 0x05, 0x14, 0x20,
+    0x00, 0x08, 0x04, 0x10, 0x82, 0x05, 0x14, 0x10, 0x00, 0x09, 0xec, 0x1c, 0x3a, 0x6f, 0xaa, 0x84,
+    0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xfc, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x27,
+    0x85, 0x50, 0x84, 0x61, 0x96, 0x00, 0x4c, 0x21, 0xc0, 0x09, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x57,
+    0x85, 0x51, 0xd8, 0x03, 0x85, 0x00, 0xd5, 0x0e, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x87, 0x86, 0x30,
+    0x84, 0xa1, 0x4c, 0x82, 0xc1, 0x34, 0x46, 0xf0, 0x01, 0x1c, 0x00, 0x57, 0x86, 0x31, 0x4c, 0x50,
+    0x41, 0x2e, 0x44, 0x90, 0x00, 0xe0, 0x42, 0x94, 0x24, 0x24, 0x46, 0x30, 0x01, 0x1c, 0x58, 0x31,
+    0x85, 0x50, 0x40, 0x64, 0x8c, 0x00, 0x50, 0x63, 0x00, 0x28, 0x04, 0x23, 0x7f, 0xf7, 0x46, 0x70,
+    0x00, 0x87, 0x58, 0x73, 0x8f, 0x88, 0x44, 0x10, 0x02, 0x14, 0x84, 0x00, 0xdd, 0x27, 0x44, 0x00,
+    0x00, 0x38, 0x42, 0x04, 0x00, 0x24, 0x46, 0x20, 0x01, 0x1c, 0x58, 0x21, 0x05, 0x50, 0x9c, 0x01,
+    0x94, 0x02, 0x98, 0x02, 0xa0, 0x81, 0x44, 0x10, 0x02, 0x18, 0x84, 0x00, 0xdd, 0x27, 0x44, 0x00,
+    0x00, 0x1c, 0x42, 0x04, 0x00, 0x24, 0x46, 0x30, 0x01, 0x1c, 0x58, 0x31, 0x85, 0x50, 0x9c, 0x01,
+    0x94, 0x03, 0x98, 0x03, 0xa0, 0x81, 0x44, 0x10, 0x02, 0x1c, 0x84, 0x00, 0xdd, 0x27, 0x04, 0x23,
+    0x7f, 0xfa, 0x44, 0x10, 0x02, 0x20, 0x84, 0x00, 0xdd, 0x27, 0x84, 0x0e, 0x42, 0x04, 0x00, 0x24,
+    0x46, 0x20, 0x01, 0x1c, 0x58, 0x21, 0x05, 0x50, 0x9c, 0x01, 0x94, 0x04, 0x98, 0x02, 0xa0, 0x81,
+    0x44, 0x10, 0x02, 0x24, 0x84, 0x00, 0xdd, 0x27, 0x04, 0x23, 0x7f, 0xfc, 0x44, 0x10, 0x02, 0x28,
+    0x84, 0x00, 0xdd, 0x27, 0x04, 0x23, 0x7f, 0xfd, 0x44, 0x10, 0x02, 0x14, 0x84, 0x01, 0xdd, 0x27,
+    0x04, 0x23, 0x7f, 0xfe, 0x44, 0x10, 0x02, 0x18, 0x84, 0x01, 0xdd, 0x27, 0x84, 0x07, 0x42, 0x04,
+    0x00, 0x24, 0x46, 0x30, 0x01, 0x1c, 0x58, 0x31, 0x85, 0x50, 0x9c, 0x01, 0x94, 0x05, 0x98, 0x03,
+    0xa0, 0x81, 0x44, 0x10, 0x02, 0x1c, 0x84, 0x01, 0xdd, 0x27, 0xb4, 0x46, 0x44, 0x10, 0x02, 0x20,
+    0x84, 0x01, 0xdd, 0x27, 0xa0, 0xb1, 0x44, 0x10, 0x02, 0x24, 0x84, 0x01, 0xdd, 0x27, 0xa0, 0xb2,
+    0x44, 0x10, 0x02, 0x28, 0x84, 0x01, 0xdd, 0x27, 0xa0, 0xb3, 0x44, 0x10, 0x02, 0x4c, 0x84, 0x00,
+    0xdd, 0x27, 0xa0, 0xb4, 0x44, 0x10, 0x02, 0x50, 0x84, 0x00, 0xdd, 0x27, 0xa0, 0xb5, 0x44, 0x10,
+    0x02, 0x64, 0x84, 0x00, 0xdd, 0x27, 0xa0, 0xb6, 0x44, 0x10, 0x02, 0x78, 0x84, 0x00, 0xdd, 0x27,
+    0xa0, 0xb7, 0x44, 0x10, 0x02, 0x4c, 0x84, 0x01, 0xdd, 0x27, 0x04, 0x23, 0x00, 0x08, 0x44, 0x10,
+    0x02, 0x50, 0x84, 0x01, 0xdd, 0x27, 0x04, 0x23, 0x00, 0x09, 0x44, 0x10, 0x02, 0x64, 0x84, 0x01,
+    0xdd, 0x27, 0x04, 0x23, 0x00, 0x0a, 0x44, 0x10, 0x02, 0x78, 0x84, 0x01, 0xdd, 0x27, 0x46, 0x00,
+    0x04, 0x12, 0x04, 0x10, 0x01, 0xdd, 0x46, 0x3f, 0xf0, 0x0f, 0x04, 0x23, 0x00, 0x0b, 0x58, 0x31,
+    0x8f, 0xff, 0x40, 0x10, 0x8c, 0x02, 0x40, 0x10, 0x88, 0x04, 0x14, 0x10, 0x01, 0xdd, 0x04, 0x13,
+    0x00, 0x18, 0x14, 0x10, 0x01, 0xe6, 0x04, 0x13, 0x00, 0x19, 0x14, 0x10, 0x01, 0xe7, 0x04, 0x13,
+    0x00, 0x1a, 0x14, 0x10, 0x01, 0xe8, 0x04, 0x13, 0x00, 0x1b, 0x14, 0x10, 0x01, 0xe9, 0x04, 0x13,
+    0x00, 0x1c, 0x14, 0x10, 0x01, 0xf0, 0x04, 0x13, 0x00, 0x1d, 0x14, 0x10, 0x01, 0xf1, 0x04, 0x13,
+    0x00, 0x1e, 0x14, 0x10, 0x01, 0xf2, 0x04, 0x13, 0x00, 0x1f, 0x14, 0x10, 0x01, 0xf3, 0x50, 0x74,
+    0x80, 0xa8, 0x46, 0x00, 0x01, 0x1c, 0x58, 0x00, 0x05, 0x50, 0x46, 0x60, 0x04, 0x12, 0x80, 0xa6,
+    0x80, 0x85, 0x80, 0x64, 0x80, 0x43, 0x99, 0xf8, 0x84, 0x00, 0x14, 0x03, 0x03, 0x14, 0x9c, 0x01,
+    0xa2, 0x79, 0x40, 0xa0, 0xa0, 0x09, 0x41, 0xc0, 0xc0, 0x09, 0x81, 0x2a, 0x54, 0x10, 0x80, 0x7f,
+    0x55, 0xce, 0x7f, 0x00, 0x54, 0xa5, 0x00, 0x7f, 0x54, 0x94, 0xff, 0x00, 0x15, 0xc2, 0x83, 0x18,
+    0x14, 0xa2, 0x03, 0x1c, 0x14, 0x91, 0x83, 0x19, 0x14, 0x11, 0x03, 0x1d, 0x84, 0x24, 0x4c, 0x00,
+    0xff, 0xe6, 0x44, 0x00, 0x00, 0xe0, 0x42, 0x04, 0x00, 0x24, 0x46, 0x20, 0x01, 0x1c, 0x58, 0x21,
+    0x05, 0x50, 0x98, 0x02, 0x50, 0x00, 0x00, 0xb8, 0xb4, 0x40, 0x80, 0x23, 0x14, 0x20, 0x82, 0x06,
+    0xa0, 0x81, 0x14, 0x20, 0x82, 0x07, 0xa0, 0x82, 0x14, 0x20, 0x82, 0x08, 0xa0, 0x83, 0x14, 0x20,
+    0x82, 0x09, 0xa0, 0x84, 0x14, 0x20, 0x82, 0x0a, 0xa0, 0x85, 0x14, 0x20, 0x82, 0x0b, 0xa0, 0x86,
+    0x14, 0x20, 0x81, 0xcf, 0xa0, 0x87, 0x14, 0x20, 0x83, 0x04, 0x04, 0x20, 0x00, 0x08, 0x14, 0x20,
+    0x83, 0x05, 0x04, 0x00, 0x00, 0x09, 0x14, 0x00, 0x82, 0x05, 0xec, 0x04, 0x3a, 0x6f, 0xaa, 0x84,
+    0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xd4, 0x96, 0x00, 0x84, 0xee, 0x46, 0xf0,
+    0x01, 0x12, 0x00, 0x17, 0x8b, 0xb2, 0x40, 0x73, 0x80, 0x06, 0xf0, 0x83, 0x84, 0x02, 0x54, 0x91,
+    0x00, 0xff, 0xf7, 0x82, 0x4c, 0x10, 0x40, 0x04, 0x84, 0xc8, 0xd5, 0x09, 0x56, 0x10, 0x80, 0x01,
+    0x84, 0x40, 0x84, 0x64, 0x40, 0x61, 0x84, 0x1a, 0x40, 0x61, 0x04, 0x1b, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x17, 0x8b, 0xb3, 0x84, 0xa1, 0xd9, 0x08, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x37, 0x8b, 0xb4,
+    0x4c, 0x30, 0xc0, 0x0e, 0xd5, 0x16, 0x84, 0xa2, 0xd9, 0x14, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x17,
+    0x8b, 0xb4, 0x84, 0xa1, 0xd9, 0x09, 0x40, 0x80, 0x0c, 0x08, 0xd5, 0x0c, 0x84, 0xa2, 0xdb, 0x09,
+    0x40, 0x80, 0x10, 0x08, 0xd5, 0x07, 0x84, 0xa2, 0xd9, 0x04, 0x44, 0x80, 0x00, 0x30, 0xd5, 0x02,
+    0x85, 0x00, 0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7, 0x8b, 0x30, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x89,
+    0x58, 0xf7, 0x8c, 0xec, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7, 0x8b, 0x78, 0xdd, 0x2f,
+    0xf3, 0x02, 0xc3, 0x06, 0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7, 0x8b, 0x04, 0xdd, 0x2f, 0xf0, 0x02,
+    0x40, 0x13, 0x00, 0x04, 0x40, 0x80, 0xa0, 0x04, 0x46, 0x10, 0x01, 0x10, 0x58, 0x10, 0x89, 0x98,
+    0xb4, 0x01, 0x54, 0x50, 0x00, 0x3f, 0x4c, 0x54, 0x40, 0x0c, 0x46, 0x20, 0x04, 0x12, 0xa0, 0x09,
+    0x58, 0x51, 0x03, 0x20, 0xd0, 0x05, 0x9d, 0x6c, 0xd0, 0x03, 0xa0, 0x8a, 0xb6, 0x40, 0x8c, 0x2c,
+    0x46, 0x50, 0x01, 0x10, 0x58, 0x52, 0x8e, 0xa8, 0xd9, 0xec, 0x46, 0x10, 0x04, 0x00, 0x04, 0x20,
+    0x80, 0x0e, 0x84, 0xa1, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char firmware4[] = {
+    0x00, 0x38, 0x00, 0x10, 0x92, 0x54, 0x54, 0x21, 0x00, 0x03, 0xd2, 0x08, 0x04, 0x10, 0x80, 0x0e,
+    0x84, 0xa2, 0x92, 0x34, 0x54, 0x10, 0x80, 0x03, 0xd9, 0x13, 0xf1, 0x02, 0xc1, 0x1e, 0x84, 0xa4,
+    0xd6, 0x03, 0x84, 0xa8, 0xde, 0x0f, 0x46, 0x40, 0x04, 0x12, 0x46, 0x11, 0xe4, 0x25, 0x80, 0x64,
+    0x58, 0x10, 0x8c, 0xf8, 0x14, 0x12, 0x00, 0xc8, 0x14, 0x11, 0x80, 0xc9, 0xd5, 0x03, 0xf0, 0x02,
+    0xc0, 0x0c, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x17, 0x8b, 0xaa, 0x84, 0xa1, 0xd9, 0x42, 0x46, 0x10,
+    0x01, 0x10, 0x58, 0x10, 0x8e, 0xa8, 0xd5, 0x08, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x17, 0x8b, 0xab,
+    0x84, 0xa1, 0xd9, 0x37, 0xd5, 0xf5, 0xb4, 0x01, 0x54, 0x50, 0x00, 0x3f, 0x4c, 0x54, 0x40, 0x05,
+    0xa0, 0x09, 0xa0, 0x8a, 0xb6, 0x40, 0x8c, 0x2c, 0x46, 0x50, 0x01, 0x11, 0x58, 0x52, 0x81, 0x90,
+    0xd9, 0xf3, 0x46, 0x10, 0x04, 0x00, 0x58, 0x10, 0x81, 0x30, 0xb4, 0x41, 0x44, 0x3f, 0xbf, 0xbf,
+    0x40, 0x21, 0x0c, 0x02, 0xb6, 0x41, 0xf0, 0x02, 0xc0, 0x07, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x37,
+    0x8b, 0xa8, 0xcb, 0x0b, 0xd5, 0x06, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x37, 0x8b, 0xa9, 0xcb, 0x08,
+    0xb4, 0x41, 0x58, 0x21, 0x40, 0x40, 0xd5, 0x0c, 0x84, 0xa1, 0xdb, 0x0b, 0xd5, 0x03, 0x84, 0xa1,
+    0xdb, 0x08, 0x46, 0x10, 0x04, 0x12, 0x58, 0x10, 0x80, 0x88, 0x44, 0x20, 0x00, 0x40, 0xb6, 0x41,
+    0x4e, 0x93, 0x01, 0xb1, 0x46, 0x80, 0x01, 0x11, 0x58, 0x84, 0x01, 0x90, 0x50, 0x94, 0x00, 0x08,
+    0x50, 0x6f, 0x80, 0x24, 0x47, 0xc0, 0x00, 0x87, 0x59, 0xce, 0x0f, 0x24, 0x46, 0xa0, 0x00, 0x87,
+    0x58, 0xa5, 0x0f, 0x88, 0xd5, 0x62, 0x00, 0x54, 0x00, 0x00, 0xf3, 0x03, 0xdb, 0x5c, 0x44, 0x10,
+    0x01, 0x44, 0x80, 0x46, 0x84, 0x00, 0xdd, 0x3c, 0x04, 0x74, 0x00, 0x01, 0xf4, 0x09, 0x46, 0x0f,
+    0xe0, 0x00, 0x58, 0x00, 0x07, 0xff, 0x54, 0x73, 0xbf, 0xff, 0x40, 0x73, 0xac, 0x08, 0x40, 0x42,
+    0x00, 0x02, 0x40, 0x43, 0x90, 0x04, 0xf4, 0x89, 0x80, 0x44, 0x44, 0x10, 0x01, 0x44, 0x84, 0x00,
+    0xdd, 0x2a, 0x44, 0x10, 0x01, 0x44, 0x80, 0x46, 0x84, 0x01, 0xdd, 0x3c, 0xf3, 0x09, 0x46, 0x2f,
+    0xe0, 0x00, 0x58, 0x21, 0x07, 0xff, 0x40, 0x31, 0x88, 0x02, 0x40, 0x33, 0x8c, 0x04, 0xf3, 0x89,
+    0x80, 0x43, 0x44, 0x10, 0x01, 0x44, 0x84, 0x01, 0xdd, 0x2a, 0x44, 0x10, 0x01, 0x58, 0x80, 0x46,
+    0x84, 0x00, 0xdd, 0x3c, 0xf4, 0x09, 0xb4, 0xa9, 0x04, 0x74, 0x80, 0x01, 0x54, 0x52, 0x83, 0xff,
+    0x54, 0x42, 0x0c, 0x00, 0x40, 0x42, 0x14, 0x04, 0x40, 0x73, 0xb0, 0x08, 0x40, 0x42, 0x1c, 0x04,
+    0xf5, 0x81, 0xf4, 0x89, 0x80, 0x44, 0x44, 0x10, 0x01, 0x58, 0x84, 0x00, 0xdd, 0x2a, 0x44, 0x10,
+    0x01, 0x58, 0x80, 0x46, 0x84, 0x01, 0xdd, 0x3c, 0xf3, 0x09, 0xf5, 0x01, 0x54, 0x31, 0x8c, 0x00,
+    0x40, 0x31, 0x94, 0x04, 0x40, 0x31, 0x9c, 0x04, 0xf3, 0x89, 0x84, 0x01, 0x80, 0x43, 0x44, 0x10,
+    0x01, 0x58, 0xdd, 0x2a, 0x8d, 0x10, 0x8d, 0x30, 0x46, 0x50, 0x01, 0x11, 0x58, 0x52, 0x8b, 0xb0,
+    0x4c, 0x82, 0xff, 0x9b, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x17, 0x8b, 0xaa, 0x46, 0x70, 0x01, 0x10,
+    0x58, 0x73, 0x88, 0x2e, 0xf1, 0x84, 0x50, 0xa3, 0x80, 0x1a, 0x50, 0x93, 0x80, 0x26, 0x50, 0x83,
+    0x80, 0x06, 0x51, 0xcf, 0x80, 0x24, 0xa4, 0x38, 0xf1, 0x03, 0xe2, 0x20, 0x4e, 0xf3, 0x00, 0x8a,
+    0xa4, 0x39, 0xe2, 0x01, 0x4e, 0xf3, 0x00, 0x86, 0x50, 0x23, 0x80, 0x0e, 0x50, 0x33, 0x80, 0x1e,
+    0x50, 0x03, 0x80, 0x2e, 0xf2, 0x85, 0xf3, 0x86, 0xf0, 0x87, 0x84, 0xc0, 0xf2, 0x04, 0x84, 0xa1,
+    0x80, 0x06, 0x44, 0x10, 0x02, 0x54, 0xda, 0x0b, 0xb4, 0x49, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7,
+    0x8f, 0x88, 0xdd, 0x2f, 0x80, 0x06, 0x04, 0x24, 0x80, 0x01, 0xd5, 0x0a, 0xb4, 0x48, 0x46, 0xf0,
+    0x00, 0x87, 0x58, 0xf7, 0x8f, 0x88, 0xdd, 0x2f, 0x04, 0x24, 0x00, 0x01, 0x80, 0x06, 0x44, 0x10,
+    0x02, 0x60, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x88, 0xdd, 0x2f, 0xf0, 0x05, 0x44, 0x10,
+    0x02, 0x9c, 0xb4, 0x40, 0x80, 0x06, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x88, 0xdd, 0x2f,
+    0x80, 0x06, 0x44, 0x10, 0x02, 0x10, 0x80, 0x5c, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x24,
+    0xdd, 0x2f, 0xf1, 0x09, 0x02, 0x35, 0x00, 0x00, 0x92, 0x30, 0x40, 0x10, 0xc0, 0x08, 0x40, 0x31,
+    0x84, 0x04, 0x80, 0x43, 0x80, 0x06, 0x44, 0x10, 0x02, 0x10, 0xf3, 0x89, 0x46, 0xf0, 0x00, 0x87,
+    0x58, 0xf7, 0x8f, 0x88, 0xdd, 0x2f, 0x80, 0x06, 0x44, 0x10, 0x01, 0x48, 0x80, 0x5c, 0x46, 0xf0,
+    0x00, 0x87, 0x58, 0xf7, 0x8f, 0x24, 0xdd, 0x2f, 0xf2, 0x09, 0x00, 0x15, 0x00, 0x02, 0x44, 0x0f,
+    0x87, 0xff, 0x40, 0x21, 0x00, 0x02, 0x40, 0x10, 0xac, 0x08, 0x40, 0x30, 0x88, 0x04, 0x80, 0x43,
+    0x80, 0x06, 0x44, 0x10, 0x01, 0x48, 0xf3, 0x89, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x88,
+    0xdd, 0x2f, 0xf1, 0x06, 0x80, 0x06, 0xb4, 0x41, 0x44, 0x10, 0x00, 0x58, 0x46, 0xf0, 0x00, 0x87,
+    0x58, 0xf7, 0x8f, 0x88, 0xdd, 0x2f, 0xf1, 0x07, 0x80, 0x06, 0xb4, 0x41, 0x44, 0x10, 0x02, 0x98,
+    0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x88, 0xdd, 0x2f, 0x9d, 0xb1, 0x84, 0xa2, 0xde, 0x87,
+    0x50, 0x73, 0x80, 0x34, 0x46, 0x50, 0x01, 0x10, 0x58, 0x52, 0x89, 0x9a, 0x50, 0xa5, 0x00, 0x34,
+    0x50, 0x94, 0x80, 0x34, 0x50, 0x84, 0x00, 0x34, 0x4c, 0x72, 0xff, 0x67, 0xf2, 0x02, 0xc2, 0x0e,
+    0x84, 0x01, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x8a, 0x28, 0xdd, 0x2f, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x17, 0x8b, 0xa8, 0x84, 0xa1, 0xd9, 0x62, 0xd5, 0x64, 0xf7, 0x02, 0x50, 0x6f, 0x80, 0x24,
+    0x46, 0x90, 0x00, 0x87, 0x58, 0x94, 0x8f, 0x24, 0x46, 0x80, 0x00, 0x87, 0x58, 0x84, 0x0f, 0x88,
+    0x80, 0x07, 0x44, 0x10, 0x02, 0x10, 0x80, 0x46, 0x4b, 0xe0, 0x24, 0x01, 0xf3, 0x09, 0x92, 0x70,
+    0x40, 0x31, 0xc0, 0x08, 0x58, 0x31, 0x8c, 0x0c, 0xf3, 0x89, 0x80, 0x43, 0x80, 0x07, 0x44, 0x10,
+    0x02, 0x10, 0x4b, 0xe0, 0x20, 0x01, 0x80, 0x07, 0x44, 0x10, 0x01, 0x48, 0x80, 0x46, 0x4b, 0xe0,
+    0x24, 0x01, 0xf3, 0x09, 0x44, 0x2f, 0x87, 0xff, 0x40, 0x31, 0x88, 0x02, 0x58, 0x31, 0xb0, 0x00,
+    0xf3, 0x89, 0x80, 0x43, 0x80, 0x07, 0x44, 0x10, 0x01, 0x48, 0x4b, 0xe0, 0x20, 0x01, 0x80, 0x07,
+    0x44, 0x10, 0x00, 0x58, 0x80, 0x46, 0x4b, 0xe0, 0x24, 0x01, 0xf3, 0x09, 0x46, 0x1f, 0x8f, 0xff,
+    0x58, 0x10, 0x8f, 0xff, 0x46, 0x20, 0x60, 0x00, 0x40, 0x31, 0x84, 0x02, 0x40, 0x31, 0x88, 0x04,
+    0xf3, 0x89, 0x80, 0x07, 0x80, 0x43, 0x44, 0x10, 0x00, 0x58, 0x4b, 0xe0, 0x20, 0x01, 0x9d, 0xf9,
+    0x84, 0xa2, 0xdf, 0xbf, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x8a, 0x28, 0xdd, 0x2f,
+    0x46, 0xf0, 0x01, 0x12, 0x00, 0x57, 0x8b, 0xa9, 0x84, 0x01, 0xd0, 0x06, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x57, 0x8b, 0xab, 0xd8, 0x0c, 0x84, 0x00, 0xd5, 0x05, 0xf1, 0x04, 0x84, 0xa1, 0xd9, 0x07,
+    0x84, 0x01, 0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7, 0x8b, 0xfc, 0xdd, 0x2f, 0xf0, 0x03, 0x46, 0xf0,
+    0x00, 0x8a, 0x58, 0xf7, 0x84, 0xb0, 0xdd, 0x2f, 0x46, 0x10, 0x04, 0x12, 0x46, 0x20, 0x07, 0x77,
+    0x58, 0x21, 0x07, 0x73, 0x14, 0x20, 0x81, 0x8c, 0xf3, 0x03, 0x46, 0xf0, 0x01, 0x12, 0x10, 0x37,
+    0x8b, 0xb5, 0xec, 0x2c, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x27, 0x8b, 0xb2, 0x46, 0x10, 0x04, 0x12, 0x96, 0x00, 0x04, 0x10, 0x80, 0xc0, 0xca, 0x02,
+    0xd5, 0x0c, 0x84, 0xa1, 0xda, 0x07, 0x4c, 0x01, 0x40, 0x03, 0xd5, 0x07, 0x84, 0xa3, 0xd8, 0x20,
+    0xd5, 0x0b, 0x84, 0xa2, 0xda, 0x1d, 0xc8, 0x06, 0x44, 0x3f, 0xfc, 0xff, 0x40, 0x10, 0x8c, 0x02,
+    0xd5, 0x17, 0x84, 0xa1, 0xd8, 0x08, 0x44, 0x3f, 0xfc, 0xff, 0x40, 0x10, 0x8c, 0x02, 0x58, 0x10,
+    0x81, 0x00, 0xd5, 0x0e, 0x84, 0xa2, 0xd8, 0x08, 0x44, 0x3f, 0xfc, 0xff, 0x40, 0x10, 0x8c, 0x02,
+    0x58, 0x10, 0x82, 0x00, 0xd5, 0x05, 0x84, 0xa3, 0xd8, 0x30, 0x58, 0x10, 0x83, 0x00, 0x46, 0x30,
+    0x04, 0x12, 0x14, 0x11, 0x80, 0xc0, 0x80, 0x23, 0x04, 0x10, 0x81, 0xc0, 0xca, 0x02, 0xd5, 0x10,
+    0x84, 0xa1, 0xda, 0x0b, 0x4c, 0x01, 0x40, 0x03, 0xd5, 0x0b, 0x84, 0xa3, 0xd8, 0x1b, 0x92, 0x22,
+    0x94, 0x4a, 0x58, 0x10, 0x80, 0x01, 0xd5, 0x16, 0x84, 0xa2, 0xda, 0x14, 0xc8, 0x04, 0x92, 0x22,
+    0x94, 0x4a, 0xd5, 0x10, 0x84, 0x41, 0x4c, 0x01, 0x40, 0x03, 0xd5, 0x04, 0x84, 0x42, 0x4c, 0x01,
+    0x40, 0x05, 0x92, 0x22, 0x94, 0x4a, 0xd5, 0x04, 0x84, 0x43, 0x4c, 0x01, 0x40, 0x07, 0x40, 0x10,
+    0x88, 0x04, 0x80, 0x03, 0x14, 0x10, 0x01, 0xc0, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc,
+    0xef, 0xd4, 0x96, 0x00, 0xe6, 0x0f, 0xe9, 0x70, 0x50, 0x10, 0x7f, 0x9e, 0x96, 0x48, 0xe6, 0x31,
+    0xe9, 0x0a, 0x50, 0x10, 0x7f, 0x8c, 0x96, 0x48, 0xe6, 0x3d, 0xe9, 0x05, 0x44, 0x10, 0x1c, 0x1c,
+    0xf1, 0x88, 0xd5, 0x04, 0x44, 0x20, 0x1a, 0x1a, 0xf2, 0x88, 0x46, 0x30, 0x04, 0x11, 0x58, 0x31,
+    0x83, 0xa8, 0xb4, 0x23, 0x47, 0xe0, 0x04, 0x11, 0x54, 0x10, 0x80, 0x3f, 0x15, 0xef, 0x80, 0x03,
+    0xb6, 0x23, 0x46, 0x11, 0xb0, 0xf0, 0xf1, 0x84, 0x80, 0x5e, 0xb4, 0x23, 0xf2, 0x85, 0xf2, 0x87,
+    0x46, 0x21, 0xb0, 0xf0, 0x58, 0x21, 0x04, 0x00, 0x40, 0x20, 0x88, 0x04, 0xf1, 0x03, 0xf2, 0x89,
+    0xf2, 0x04, 0x15, 0xef, 0x80, 0x06, 0x58, 0x10, 0x83, 0xac, 0xf1, 0x83, 0x58, 0x21, 0x04, 0x76,
+    0xf1, 0x05, 0xf2, 0x84, 0xf2, 0x06, 0x58, 0x10, 0x83, 0xc0, 0xf1, 0x85, 0x58, 0x21, 0x02, 0x14,
+    0xf1, 0x07, 0xf2, 0x86, 0xf2, 0x09, 0x58, 0x10, 0x82, 0x18, 0xf1, 0x87, 0xb6, 0x43, 0x46, 0xa0,
+    0x0f, 0xf0, 0xf2, 0x04, 0xf3, 0x03, 0xb6, 0x43, 0x83, 0x9e, 0xf2, 0x08, 0xf3, 0x05, 0x81, 0x3c,
+    0xb6, 0x43, 0x44, 0x20, 0xff, 0xff, 0xf3, 0x06, 0x46, 0x83, 0x83, 0xc0, 0xb6, 0x43, 0x80, 0xe9,
+    0xf3, 0x07, 0x46, 0x62, 0x42, 0x82, 0x80, 0xa7, 0x80, 0x85, 0x58, 0xa5, 0x00, 0xff, 0x84, 0x20,
+    0x58, 0x84, 0x02, 0x3c, 0x58, 0x63, 0x0e, 0x28, 0xb7, 0x43, 0x14, 0x2f, 0x00, 0x87, 0x14, 0xae,
+    0x00, 0x88, 0x14, 0x84, 0x80, 0xe8, 0x14, 0x63, 0x80, 0xe9, 0x14, 0x12, 0x80, 0x8a, 0x14, 0x12,
+    0x00, 0x8b, 0x48, 0x00, 0x00, 0x8b, 0x46, 0x20, 0x04, 0x11, 0x58, 0x21, 0x03, 0xa8, 0xb4, 0x22,
+    0x47, 0xe0, 0x04, 0x11, 0x54, 0x10, 0x80, 0x3f, 0x15, 0xef, 0x80, 0x04, 0xb6, 0x22, 0xb4, 0x22,
+    0x15, 0xef, 0x80, 0x06, 0xf1, 0x89, 0x46, 0x10, 0x10, 0x05, 0xf1, 0x83, 0x15, 0xef, 0x80, 0x08,
+    0x05, 0xef, 0x80, 0x03, 0x46, 0x10, 0x04, 0x11, 0x59, 0xef, 0x05, 0xff, 0xf1, 0x81, 0x15, 0xef,
+    0x80, 0x03, 0xf1, 0x09, 0x47, 0xe3, 0x51, 0x60, 0x46, 0x30, 0x04, 0x11, 0x59, 0xef, 0x0a, 0x00,
+    0xf3, 0x85, 0x41, 0xe0, 0xf8, 0x04, 0xf1, 0x04, 0x15, 0xef, 0x80, 0x09, 0x05, 0xef, 0x80, 0x05,
+    0x58, 0x10, 0x83, 0xac, 0xf3, 0x87, 0xf1, 0x84, 0xf1, 0x06, 0x59, 0xef, 0x03, 0xc0, 0x15, 0xef,
+    0x80, 0x05, 0x58, 0x10, 0x82, 0x14, 0x05, 0xef, 0x80, 0x07, 0xf1, 0x86, 0xf1, 0x08, 0x59, 0xef,
+    0x02, 0x18, 0x15, 0xef, 0x80, 0x07, 0x58, 0x10, 0x82, 0x1c, 0x05, 0xef, 0x80, 0x01, 0xf1, 0x88,
+    0xf1, 0x09, 0x59, 0xef, 0x02, 0x20, 0x15, 0xef, 0x80, 0x01, 0xb6, 0x22, 0x46, 0xa3, 0x51, 0x60,
+    0xf2, 0x04, 0x58, 0xa5, 0x0a, 0x06, 0xb7, 0x42, 0x44, 0x10, 0x06, 0x06, 0x05, 0xef, 0x80, 0x05,
+    0x47, 0xc0, 0x05, 0x50, 0xb6, 0x3e, 0x59, 0xce, 0x00, 0x55, 0xf2, 0x03, 0xf1, 0x06, 0x81, 0x23,
+    0xb6, 0x41, 0x05, 0xef, 0x80, 0x07, 0x46, 0x80, 0xf3, 0xc3, 0x15, 0xcf, 0x00, 0x00, 0x80, 0xe3,
+    0xf1, 0x08, 0x80, 0xc3, 0xb6, 0x41, 0x46, 0x5f, 0x40, 0x00, 0xf2, 0x01, 0x80, 0x83, 0x46, 0x3f,
+    0xa0, 0x00, 0x58, 0x84, 0x0c, 0x3c, 0x58, 0x31, 0x82, 0x00, 0x58, 0x52, 0x82, 0x00, 0x15, 0xc1,
+    0x00, 0x00, 0x14, 0x84, 0x80, 0xe8, 0x14, 0x83, 0x80, 0xe9, 0x14, 0x53, 0x00, 0x8a, 0x14, 0x32,
+    0x00, 0x8b, 0x84, 0x6e, 0x4c, 0x01, 0xc0, 0x0a, 0x46, 0x10, 0x04, 0x12, 0x58, 0x10, 0x80, 0x04,
+    0xb4, 0x41, 0x58, 0x21, 0x00, 0x20, 0xd5, 0x08, 0x46, 0x10, 0x04, 0x12, 0x58, 0x10, 0x80, 0x04,
+    0xb4, 0x41, 0x42, 0x21, 0x14, 0x09, 0xb6, 0x41, 0x46, 0x10, 0x04, 0x10, 0x04, 0x20, 0x81, 0x46,
+    0x44, 0x3f, 0xff, 0xe1, 0x40, 0x21, 0x0c, 0x02, 0x14, 0x20, 0x81, 0x46, 0xe6, 0x0f, 0xe9, 0x0c,
+    0x46, 0x00, 0x04, 0x11, 0x58, 0x00, 0x03, 0x2c, 0xb4, 0x20, 0x87, 0xd9, 0x40, 0x10, 0xf8, 0x02,
+    0x58, 0x10, 0x80, 0x02, 0xd5, 0x0b, 0x46, 0x00, 0x04, 0x11, 0x58, 0x00, 0x03, 0x2c, 0xb4, 0x20,
+    0x84, 0x59, 0x40, 0x10, 0x88, 0x02, 0x58, 0x10, 0x80, 0x04, 0xb6, 0x20, 0xec, 0x2c, 0x3a, 0x6f,
+    0xaa, 0x84, 0xdd, 0x9e, 0x96, 0x00, 0x56, 0x10, 0x00, 0x80, 0x5c, 0xf0, 0x80, 0x7f, 0xe9, 0x03,
+    0x84, 0x00, 0xd5, 0x11, 0x54, 0x10, 0x00, 0x40, 0x54, 0x00, 0x00, 0x3f, 0xc1, 0x06, 0x44, 0x10,
+    0x00, 0x1f, 0x42, 0x00, 0x04, 0x01, 0xd5, 0x07, 0x52, 0x00, 0x00, 0x00, 0x44, 0x1f, 0xff, 0xe0,
+    0x42, 0x00, 0x04, 0x00, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xfc, 0x96, 0x00,
+    0x46, 0x70, 0x01, 0x19, 0x58, 0x73, 0x8e, 0x90, 0x46, 0x60, 0x00, 0x8a, 0x58, 0x63, 0x0f, 0x90,
+    0xe6, 0x0f, 0xe9, 0x7c, 0xa6, 0x38, 0xdd, 0x26, 0x96, 0x40, 0xa6, 0x39, 0x40, 0x80, 0xc0, 0x08,
+    0xdd, 0x26, 0x40, 0x00, 0x60, 0x08, 0x46, 0x23, 0xf3, 0xf3, 0x58, 0x21, 0x0f, 0x3f, 0x40, 0x04,
+    0x00, 0x04, 0x46, 0x10, 0x04, 0x11, 0x40, 0x00, 0x08, 0x02, 0x14, 0x00, 0x80, 0xc5, 0xa6, 0x3a,
+    0xdd, 0x26, 0x54, 0x80, 0x00, 0xff, 0xa6, 0x3b, 0xdd, 0x26, 0x54, 0xa0, 0x00, 0xff, 0x00, 0x03,
+    0x80, 0x0c, 0x40, 0x15, 0x20, 0x08, 0x40, 0x84, 0x04, 0x04, 0xdd, 0x26, 0x96, 0x40, 0x00, 0x03,
+    0x80, 0x0d, 0x40, 0x10, 0xc0, 0x08, 0x40, 0x84, 0x04, 0x04, 0xdd, 0x26, 0x40, 0x00, 0x60, 0x08,
+    0x46, 0x33, 0xf3, 0xf3, 0x58, 0x31, 0x8f, 0x3f, 0x40, 0x04, 0x00, 0x04, 0x46, 0x10, 0x04, 0x11,
+    0x40, 0x00, 0x0c, 0x02, 0x14, 0x00, 0x80, 0xc6, 0x00, 0x03, 0x80, 0x0e, 0xdd, 0x26, 0x54, 0x80,
+    0x00, 0xff, 0x00, 0x03, 0x80, 0x0f, 0xdd, 0x26, 0x54, 0x90, 0x00, 0xff, 0x00, 0x03, 0x80, 0x10,
+    0x40, 0x14, 0xa0, 0x08, 0x40, 0x84, 0x04, 0x04, 0xdd, 0x26, 0x96, 0x40, 0x00, 0x03, 0x80, 0x11,
+    0x40, 0x10, 0xc0, 0x08, 0x40, 0x84, 0x04, 0x04, 0xdd, 0x26, 0x40, 0x00, 0x60, 0x08, 0x46, 0x23,
+    0xf3, 0xf3, 0x58, 0x21, 0x0f, 0x3f, 0x40, 0x04, 0x00, 0x04, 0x46, 0x10, 0x04, 0x11, 0x40, 0x00,
+    0x08, 0x02, 0x14, 0x00, 0x80, 0xc7, 0x00, 0x03, 0x80, 0x12, 0xdd, 0x26, 0x54, 0x80, 0x00, 0xff,
+    0x00, 0x03, 0x80, 0x13, 0xdd, 0x26, 0x96, 0x00, 0x40, 0x00, 0x20, 0x08, 0x46, 0x33, 0xf3, 0xf3,
+    0x40, 0x04, 0x00, 0x04, 0x46, 0x10, 0x04, 0x11, 0x58, 0x31, 0x8f, 0x3f, 0x40, 0x00, 0x0c, 0x02,
+    0x14, 0x00, 0x80, 0xc8, 0xa6, 0x3c, 0x48, 0x00, 0x00, 0x8d, 0xa6, 0x3e, 0xdd, 0x26, 0x54, 0x80,
+    0x00, 0xff, 0xa6, 0x3f, 0xdd, 0x26, 0x96, 0x80, 0x00, 0x03, 0x80, 0x08, 0x40, 0x21, 0x20, 0x08,
+    0x40, 0x84, 0x08, 0x04, 0xdd, 0x26, 0x96, 0x40, 0x00, 0x03, 0x80, 0x09, 0x40, 0x10, 0xc0, 0x08,
+    0x40, 0x84, 0x04, 0x04, 0xdd, 0x26, 0x40, 0x00, 0x60, 0x08, 0x46, 0x23, 0xf3, 0xf3, 0x58, 0x21,
+    0x0f, 0x3f, 0x40, 0x04, 0x00, 0x04, 0x46, 0x10, 0x04, 0x11, 0x40, 0x00, 0x08, 0x02, 0x14, 0x00,
+    0x80, 0xc5, 0x00, 0x03, 0x80, 0x0a, 0xdd, 0x26, 0x54, 0x80, 0x00, 0xff, 0x00, 0x03, 0x80, 0x0b,
+    0xdd, 0x26, 0x54, 0xa0, 0x00, 0xff, 0x00, 0x03, 0x80, 0x0c, 0x40, 0x15, 0x20, 0x08, 0x40, 0x84,
+    0x04, 0x04, 0xdd, 0x26, 0x96, 0x40, 0x00, 0x03, 0x80, 0x0d, 0x40, 0x10, 0xc0, 0x08, 0x40, 0x84,
+    0x04, 0x04, 0xdd, 0x26, 0x40, 0x00, 0x60, 0x08, 0x46, 0x33, 0xf3, 0xf3, 0x58, 0x31, 0x8f, 0x3f,
+    0x40, 0x04, 0x00, 0x04, 0x46, 0x10, 0x04, 0x11, 0x40, 0x00, 0x0c, 0x02, 0x14, 0x00, 0x80, 0xc6,
+    0x00, 0x03, 0x80, 0x0e, 0xdd, 0x26, 0x54, 0x80, 0x00, 0xff, 0x00, 0x03, 0x80, 0x0f, 0xdd, 0x26,
+    0x54, 0x90, 0x00, 0xff, 0x00, 0x03, 0x80, 0x10, 0x40, 0x14, 0xa0, 0x08, 0x40, 0x84, 0x04, 0x04,
+    0xdd, 0x26, 0x96, 0x40, 0x00, 0x03, 0x80, 0x11, 0x40, 0x10, 0xc0, 0x08, 0x40, 0x84, 0x04, 0x04,
+    0xdd, 0x26, 0x40, 0x00, 0x60, 0x08, 0x46, 0x23, 0xf3, 0xf3, 0x58, 0x21, 0x0f, 0x3f, 0x40, 0x04,
+    0x00, 0x04, 0x46, 0x10, 0x04, 0x11, 0x40, 0x00, 0x08, 0x02, 0x14, 0x00, 0x80, 0xc7, 0x00, 0x03,
+    0x80, 0x12, 0xdd, 0x26, 0x55, 0xc0, 0x00, 0xff, 0x00, 0x03, 0x80, 0x13, 0xdd, 0x26, 0x54, 0x80,
+    0x00, 0xff, 0x40, 0x14, 0x20, 0x08, 0x46, 0x33, 0xf3, 0xf3, 0x40, 0x0e, 0x04, 0x04, 0x58, 0x31,
+    0x8f, 0x3f, 0x46, 0x10, 0x04, 0x11, 0x40, 0x00, 0x0c, 0x02, 0x14, 0x00, 0x80, 0xc8, 0xa6, 0x3d,
+    0xdd, 0x26, 0x96, 0x40, 0x40, 0x00, 0xa0, 0x08, 0x40, 0xa5, 0x00, 0x04, 0x40, 0x94, 0xc0, 0x08,
+    0x40, 0x00, 0xc0, 0x08, 0x40, 0x95, 0x24, 0x04, 0x40, 0x84, 0x00, 0x04, 0x40, 0x10, 0xe0, 0x08,
+    0x46, 0x33, 0xf3, 0xf3, 0x58, 0x31, 0x8f, 0x3f, 0x40, 0x84, 0x04, 0x04, 0x46, 0x20, 0x04, 0x11,
+    0x40, 0x14, 0x84, 0x04, 0x80, 0x02, 0x40, 0x10, 0x8c, 0x02, 0x40, 0x84, 0x0c, 0x02, 0x14, 0x11,
+    0x00, 0xf5, 0x14, 0x80, 0x00, 0xf6, 0xec, 0x04, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x92, 0x00,
+    0x46, 0x10, 0x04, 0x11, 0x04, 0x30, 0x80, 0xeb, 0x96, 0x00, 0x92, 0x63, 0x94, 0xdb, 0xe6, 0x0f,
+    0xe9, 0x13, 0x50, 0x10, 0x7f, 0x9e, 0x96, 0x48, 0xe6, 0x31, 0xe9, 0x09, 0x50, 0x00, 0x7f, 0x8c,
+    0x96, 0x00, 0xe6, 0x1d, 0xe9, 0x04, 0x44, 0x20, 0x1c, 0x1c, 0xd5, 0x03, 0x44, 0x20, 0x1a, 0x1a,
+    0x58, 0x31, 0x80, 0x06, 0xd5, 0x05, 0x58, 0x31, 0x80, 0x04, 0x44, 0x20, 0x1f, 0x1f, 0x46, 0x10,
+    0x04, 0x11, 0x80, 0x01, 0x14, 0x20, 0x80, 0xf0, 0x14, 0x30, 0x00, 0xeb, 0x84, 0x00, 0xdd, 0x9e,
+    0x3a, 0x6f, 0xa4, 0x3c, 0x46, 0x70, 0x04, 0x12, 0x81, 0x00, 0x80, 0xc7, 0x80, 0x06, 0x80, 0xa0,
+    0x80, 0x80, 0x80, 0x68, 0x50, 0x24, 0x00, 0x20, 0x84, 0x20, 0x14, 0x10, 0x03, 0x14, 0x9c, 0x49,
+    0x04, 0x93, 0x83, 0x18, 0xb7, 0x23, 0x04, 0x93, 0x03, 0x1c, 0x14, 0x91, 0x80, 0x01, 0x8c, 0x68,
+    0x04, 0x92, 0x83, 0x19, 0xb7, 0x22, 0x04, 0x92, 0x03, 0x1d, 0x14, 0x91, 0x00, 0x01, 0x85, 0x24,
+    0x8c, 0x48, 0x4c, 0x14, 0xff, 0xec, 0x80, 0x20, 0x04, 0x10, 0x82, 0x05, 0x84, 0x00, 0x14, 0x14,
+    0x00, 0x10, 0x3a, 0x6f, 0xa4, 0x04, 0xdd, 0x9e, 0x46, 0x10, 0x04, 0x12, 0x96, 0x00, 0x04, 0x20,
+    0x80, 0xc0, 0xc8, 0x06, 0x42, 0x21, 0x10, 0x09, 0x58, 0x21, 0x00, 0x0b, 0xd5, 0x10, 0x84, 0xa1,
+    0xd8, 0x06, 0x44, 0x0f, 0xff, 0xe4, 0x40, 0x21, 0x00, 0x02, 0xd5, 0x09, 0x84, 0xa2, 0xd8, 0x09,
+    0x44, 0x0f, 0xff, 0xe5, 0x40, 0x21, 0x00, 0x02, 0x58, 0x21, 0x00, 0x01, 0x14, 0x20, 0x80, 0xc0,
+    0x84, 0x01, 0xdd, 0x9e, 0x3a, 0x6f, 0x98, 0xbc, 0x46, 0x20, 0x04, 0x10, 0x04, 0x61, 0x00, 0x6f,
+    0x46, 0x2f, 0xff, 0x7f, 0x58, 0x21, 0x0f, 0xf5, 0x40, 0x63, 0x08, 0x02, 0x96, 0x00, 0x84, 0x41,
+    0x96, 0x48, 0x4c, 0x01, 0x40, 0x13, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x47, 0x8b, 0x9c, 0x58, 0x63,
+    0x00, 0x08, 0x46, 0x20, 0x01, 0x12, 0x58, 0x21, 0x0b, 0xb6, 0x46, 0x30, 0x01, 0x12, 0x58, 0x31,
+    0x8b, 0xb7, 0x4c, 0x40, 0x40, 0x19, 0xd5, 0x13, 0x84, 0xa2, 0xd8, 0x18, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x47, 0x8b, 0x9c, 0x84, 0xa1, 0x42, 0x63, 0x4c, 0x08, 0x46, 0x20, 0x01, 0x12, 0x58, 0x21,
+    0x0b, 0xb6, 0x46, 0x30, 0x01, 0x12, 0x58, 0x31, 0x8b, 0xb7, 0xdc, 0x05, 0x84, 0x00, 0xaf, 0x10,
+    0xae, 0x18, 0xd5, 0x0f, 0xae, 0x18, 0xae, 0x10, 0xd5, 0x0c, 0xc8, 0x0b, 0x46, 0xf0, 0x01, 0x12,
+    0x10, 0x27, 0x8b, 0xb7, 0x46, 0xf0, 0x01, 0x12, 0x10, 0x27, 0x8b, 0xb6, 0x58, 0x63, 0x00, 0x02,
+    0x46, 0xf0, 0x01, 0x12, 0x00, 0x07, 0x8b, 0xb6, 0x84, 0xa1, 0xd8, 0x32, 0x46, 0x00, 0x04, 0x11,
+    0x04, 0x30, 0x00, 0xca, 0x92, 0x64, 0x94, 0xdc, 0x58, 0x31, 0x80, 0x03, 0x14, 0x30, 0x00, 0xca,
+    0x46, 0x20, 0x04, 0x12, 0x04, 0x31, 0x00, 0x49, 0x42, 0x31, 0xac, 0x09, 0x14, 0x31, 0x00, 0x49,
+    0x80, 0x02, 0x04, 0x30, 0x01, 0xc5, 0x92, 0x68, 0x40, 0x31, 0xa0, 0x08, 0x14, 0x30, 0x01, 0xc5,
+    0x80, 0x40, 0x04, 0x31, 0x00, 0x20, 0x42, 0x31, 0xd0, 0x09, 0x42, 0x31, 0xd4, 0x09, 0x42, 0x31,
+    0xd4, 0x08, 0x46, 0x00, 0x04, 0x12, 0x14, 0x31, 0x00, 0x20, 0x58, 0x00, 0x00, 0x84, 0xb4, 0x40,
+    0x44, 0x5f, 0xe1, 0xff, 0x40, 0x21, 0x14, 0x02, 0x58, 0x21, 0x08, 0x00, 0xd5, 0x35, 0x84, 0xa2,
+    0xd8, 0x34, 0x46, 0x00, 0x04, 0x11, 0x04, 0x30, 0x00, 0xca, 0x92, 0x64, 0x94, 0xdc, 0x58, 0x31,
+    0x80, 0x0c, 0x14, 0x30, 0x00, 0xca, 0x46, 0x20, 0x04, 0x12, 0x04, 0x31, 0x00, 0x49, 0x42, 0x31,
+    0xac, 0x09, 0x14, 0x31, 0x00, 0x49, 0x80, 0x02, 0x04, 0x30, 0x01, 0xc5, 0x92, 0x68, 0x40, 0x31,
+    0xa0, 0x08, 0x58, 0x31, 0x80, 0x01, 0x14, 0x30, 0x01, 0xc5, 0x80, 0x40, 0x04, 0x31, 0x00, 0x20,
+    0x42, 0x31, 0xd0, 0x09, 0x42, 0x31, 0xd4, 0x09, 0x42, 0x31, 0xd0, 0x08, 0x46, 0x00, 0x04, 0x12,
+    0x14, 0x31, 0x00, 0x20, 0x58, 0x00, 0x00, 0x84, 0xb4, 0x40, 0x44, 0x5f, 0xe1, 0xff, 0x40, 0x21,
+    0x14, 0x02, 0x58, 0x21, 0x02, 0x00, 0xb6, 0x40, 0xc9, 0x0a, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x07,
+    0x8b, 0xb7, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x82, 0xe4, 0xdd, 0x2f, 0x46, 0x00, 0x04, 0x10,
+    0x14, 0x60, 0x00, 0x6f, 0x84, 0x01, 0x3a, 0x6f, 0x98, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0x9c, 0xbc,
+    0xef, 0xfc, 0x46, 0x40, 0x04, 0x00, 0x04, 0x52, 0x00, 0x48, 0x44, 0x6f, 0x0f, 0x0f, 0x40, 0x52,
+    0x98, 0x02, 0x58, 0x52, 0x90, 0x10, 0x14, 0x52, 0x00, 0x48, 0x80, 0x64, 0x04, 0x51, 0x80, 0x4a,
+    0x44, 0x6f, 0x0f, 0xff, 0x40, 0x52, 0x98, 0x02, 0x58, 0x52, 0x90, 0x00, 0x14, 0x51, 0x80, 0x4a,
+    0x46, 0x40, 0x04, 0x10, 0x04, 0x52, 0x00, 0x6e, 0x46, 0x6f, 0xff, 0x7f, 0x58, 0x63, 0x0f, 0xf5,
+    0x40, 0x52, 0x98, 0x02, 0x14, 0x52, 0x00, 0x6e, 0x46, 0x30, 0x04, 0x11, 0x04, 0x41, 0x80, 0xec,
+    0x46, 0x63, 0xf3, 0xf0, 0x97, 0xc8, 0x96, 0x61, 0x40, 0x10, 0x98, 0x04, 0x14, 0x11, 0x80, 0xec,
+    0x97, 0x90, 0x96, 0x00, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x82, 0x3c, 0xdd, 0x2f, 0x80, 0x07,
+    0x80, 0x26, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x83, 0x20, 0xdd, 0x2f, 0xec, 0x04, 0x3a, 0x6f,
+    0x9c, 0x84, 0xdd, 0x9e, 0x46, 0x30, 0x04, 0x12, 0x58, 0x31, 0x8c, 0x50, 0x84, 0x20, 0xb6, 0x23,
+    0x04, 0x10, 0x00, 0x08, 0x50, 0x21, 0x80, 0x10, 0xb6, 0x22, 0x04, 0x40, 0x00, 0x09, 0x50, 0x11,
+    0x00, 0x10, 0xb6, 0x81, 0x84, 0x81, 0xb6, 0x83, 0x04, 0x40, 0x00, 0x0a, 0xb6, 0x82, 0x04, 0x40,
+    0x00, 0x0b, 0xb6, 0x81, 0x84, 0x82, 0xb6, 0x83, 0x04, 0x40, 0x00, 0x0c, 0xb6, 0x82, 0x04, 0x40,
+    0x00, 0x0d, 0xb6, 0x81, 0x84, 0x83, 0xb6, 0x83, 0x04, 0x30, 0x00, 0x0e, 0xb6, 0x62, 0x04, 0x00,
+    0x00, 0x0f, 0xb6, 0x01, 0xdd, 0x9e, 0x92, 0x00, 0x3b, 0xff, 0xfc, 0xbc, 0xef, 0xfc, 0x84, 0x20,
+    0x96, 0x00, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x83, 0x20, 0xdd, 0x2f, 0x84, 0x01, 0xec, 0x04,
+    0x3b, 0xff, 0xfc, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x37, 0x8b, 0x9c,
+    0x46, 0x20, 0x04, 0x11, 0x96, 0x02, 0x96, 0x48, 0x04, 0x21, 0x00, 0xec, 0xcb, 0x15, 0x84, 0x62,
+    0x96, 0x00, 0x4c, 0x11, 0xc0, 0x0b, 0x44, 0x1f, 0xc0, 0xff, 0x54, 0x00, 0x00, 0x3f, 0x40, 0x21,
+    0x04, 0x02, 0x40, 0x10, 0x20, 0x08, 0xd5, 0x0c, 0x92, 0x46, 0x94, 0x96, 0x54, 0x00, 0x00, 0x3f,
+    0x40, 0x10, 0x08, 0x04, 0xd5, 0x07, 0x92, 0x46, 0x94, 0x96, 0x54, 0x10, 0x00, 0x3f, 0x40, 0x10,
+    0x88, 0x04, 0x46, 0x00, 0x04, 0x11, 0x14, 0x10, 0x00, 0xec, 0x84, 0x00, 0xdd, 0x9e, 0x92, 0x00,
+    0x3a, 0x6f, 0xaa, 0x3c, 0x96, 0x00, 0xe6, 0x0f, 0xe8, 0x03, 0x84, 0xc0, 0xd5, 0x1a, 0x46, 0x10,
+    0x01, 0x10, 0x58, 0x10, 0x88, 0x2e, 0x44, 0x60, 0x00, 0xff, 0xa4, 0x88, 0xe2, 0x02, 0xe9, 0x06,
+    0xa4, 0x89, 0xe2, 0x40, 0xe9, 0x03, 0x00, 0x60, 0xff, 0xfe, 0x50, 0x10, 0x80, 0x34, 0x46, 0x50,
+    0x01, 0x10, 0x58, 0x52, 0x89, 0x9a, 0xd9, 0xf2, 0x44, 0x50, 0x00, 0xff, 0x4c, 0x62, 0x80, 0xf6,
+    0x46, 0x00, 0x04, 0x12, 0x04, 0x10, 0x01, 0xdd, 0x44, 0x00, 0x00, 0x68, 0x42, 0x03, 0x00, 0x24,
+    0x46, 0x90, 0x0f, 0xf0, 0x46, 0xa0, 0x01, 0x19, 0x58, 0xa5, 0x0e, 0xa4, 0x88, 0x0a, 0x50, 0x00,
+    0x00, 0x24, 0x40, 0x10, 0xa4, 0x02, 0x14, 0x10, 0x7f, 0xf8, 0x46, 0x10, 0x04, 0x12, 0x04, 0x20,
+    0x81, 0xe0, 0x14, 0x20, 0x7f, 0xfd, 0x04, 0x20, 0x81, 0xe1, 0x14, 0x20, 0x7f, 0xfe, 0x04, 0x20,
+    0x81, 0xe2, 0x14, 0x20, 0x7f, 0xff, 0x04, 0x20, 0x81, 0xe3, 0xb6, 0x40, 0x04, 0x20, 0x81, 0xe4,
+    0xa8, 0x81, 0x04, 0x20, 0x81, 0xe5, 0xa8, 0x82, 0x04, 0x20, 0x81, 0xea, 0xa8, 0x83, 0x04, 0x20,
+    0x81, 0xeb, 0xa8, 0x84, 0x04, 0x20, 0x81, 0xec, 0xa8, 0x85, 0x04, 0x20, 0x81, 0xed, 0xa8, 0x86,
+    0x04, 0x20, 0x81, 0xee, 0xa8, 0x87, 0x04, 0x20, 0x81, 0xef, 0x14, 0x20, 0x00, 0x08, 0x04, 0x20,
+    0x81, 0xe6, 0x14, 0x20, 0x00, 0x09, 0x04, 0x20, 0x81, 0xe7, 0x14, 0x20, 0x00, 0x0a, 0x04, 0x20,
+    0x81, 0xe8, 0x14, 0x20, 0x00, 0x0b, 0x04, 0x20, 0x81, 0xe9, 0x14, 0x20, 0x00, 0x0c, 0x04, 0x20,
+    0x81, 0xf0, 0x14, 0x20, 0x00, 0x0d, 0x04, 0x20, 0x81, 0xf1, 0x14, 0x20, 0x00, 0x0e, 0x04, 0x20,
+    0x81, 0xf2, 0x14, 0x20, 0x00, 0x0f, 0x04, 0x10, 0x81, 0xf3, 0x46, 0x50, 0x04, 0x12, 0x14, 0x10,
+    0x00, 0x10, 0x58, 0x52, 0x8c, 0x50, 0x84, 0x23, 0xb6, 0x25, 0x46, 0x20, 0x04, 0x12, 0x50, 0x42,
+    0x80, 0x10, 0x9c, 0xe4, 0xb5, 0x24, 0x50, 0x11, 0x80, 0x10, 0xb5, 0x03, 0x04, 0xa1, 0x03, 0x1c,
+    0xb4, 0xe1, 0x54, 0xa5, 0x00, 0x7f, 0x47, 0xc7, 0xf0, 0x00, 0x40, 0xa5, 0x20, 0x08, 0x40, 0x94,
+    0xc0, 0x08, 0x54, 0x73, 0x80, 0x7f, 0x40, 0x94, 0xf0, 0x02, 0x40, 0x75, 0x1c, 0x04, 0x40, 0x73,
+    0xa4, 0x04, 0x46, 0x90, 0x07, 0xf0, 0x40, 0x84, 0x20, 0x08, 0x40, 0x84, 0x24, 0x02, 0x40, 0x73,
+    0xa0, 0x04, 0x14, 0x70, 0x7f, 0xfc, 0x84, 0xe2, 0xb6, 0xe5, 0x84, 0xe1, 0xb5, 0x44, 0xb5, 0x23,
+    0x05, 0xc1, 0x03, 0x1c, 0xb5, 0x01, 0x55, 0xce, 0x00, 0x7f, 0x41, 0xce, 0x20, 0x08, 0x54, 0x84,
+    0x00, 0x7f, 0x40, 0x8e, 0x20, 0x04, 0x47, 0xc7, 0xf0, 0x00, 0x40, 0xa5, 0x40, 0x08, 0x40, 0xa5,
+    0x70, 0x02, 0x40, 0x84, 0x28, 0x04, 0x46, 0xa0, 0x07, 0xf0, 0x40, 0x94, 0xa0, 0x08, 0x40, 0x94,
+    0xa8, 0x02, 0x40, 0x84, 0x24, 0x04, 0x14, 0x80, 0x7f, 0xfb, 0xb6, 0xe5, 0xb5, 0x24, 0xb5, 0x03,
+    0x05, 0xc1, 0x03, 0x1c, 0xb5, 0x41, 0x55, 0xce, 0x00, 0x7f, 0x41, 0xce, 0x20, 0x08, 0x54, 0xa5,
+    0x00, 0x7f, 0x40, 0xae, 0x28, 0x04, 0x47, 0xc7, 0xf0, 0x00, 0x40, 0x94, 0xc0, 0x08, 0x40, 0x94,
+    0xf0, 0x02, 0x40, 0x95, 0x24, 0x04, 0x46, 0xa0, 0x07, 0xf0, 0x40, 0x84, 0x20, 0x08, 0x40, 0x84,
+    0x28, 0x02, 0x40, 0x84, 0xa0, 0x04, 0x14, 0x80, 0x7f, 0xfa, 0x85, 0x00, 0xb7, 0x05, 0xb4, 0xa4,
+    0xb4, 0x83, 0x04, 0x21, 0x03, 0x1c, 0xb4, 0x21, 0x54, 0x21, 0x00, 0x7f, 0x54, 0x10, 0x80, 0x7f,
+    0x40, 0x21, 0x20, 0x08, 0x40, 0x21, 0x04, 0x04, 0x40, 0x32, 0xc0, 0x08, 0x84, 0x2d, 0x42, 0x63,
+    0x04, 0x24, 0x40, 0x31, 0xf0, 0x02, 0x40, 0x12, 0x20, 0x08, 0x40, 0x10, 0xa8, 0x02, 0x40, 0x21,
+    0x0c, 0x04, 0x40, 0x21, 0x04, 0x04, 0x99, 0xb7, 0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x8e, 0xa4,
+    0x38, 0x20, 0x9b, 0x0a, 0x14, 0x70, 0x7f, 0xf7, 0x3a, 0x6f, 0xaa, 0x04, 0xdd, 0x9e, 0x92, 0x00,
+    0x3a, 0x6f, 0xaa, 0xbc, 0x96, 0x00, 0xe6, 0x0f, 0xe8, 0x03, 0x84, 0x20, 0xd5, 0x1a, 0x46, 0x20,
+    0x01, 0x10, 0x58, 0x21, 0x08, 0x2e, 0x44, 0x10, 0x00, 0xff, 0xa4, 0xd0, 0xe2, 0x03, 0xe9, 0x06,
+    0xa4, 0xd1, 0xe2, 0x60, 0xe9, 0x03, 0x00, 0x11, 0x7f, 0xfe, 0x50, 0x21, 0x00, 0x34, 0x46, 0x50,
+    0x01, 0x10, 0x58, 0x52, 0x89, 0x9a, 0xda, 0xf2, 0x44, 0x50, 0x00, 0xff, 0x4c, 0x12, 0x80, 0xc7,
+    0x44, 0x30, 0x00, 0x68, 0x42, 0x30, 0x8c, 0x24, 0x46, 0x60, 0x01, 0x19, 0x58, 0x63, 0x0e, 0xa4,
+    0x98, 0xde, 0xb5, 0x03, 0x4e, 0x82, 0x00, 0xbb, 0x46, 0x20, 0x04, 0x12, 0x44, 0x41, 0x00, 0x00,
+    0x04, 0x91, 0x01, 0xc0, 0x14, 0x41, 0x01, 0xc0, 0xe6, 0x0f, 0xe9, 0x12, 0x46, 0x00, 0x04, 0x12,
+    0x58, 0x00, 0x07, 0x74, 0xb4, 0x40, 0x46, 0xaf, 0xf0, 0x0f, 0x58, 0xa5, 0x0f, 0xff, 0x40, 0x21,
+    0x28, 0x02, 0xb6, 0x40, 0xa0, 0x99, 0xb4, 0x60, 0x40, 0x21, 0x88, 0x04, 0xb6, 0x40, 0x44, 0x00,
+    0x00, 0x68, 0x42, 0x00, 0x80, 0x24, 0x83, 0x86, 0x88, 0x1c, 0x8c, 0x18, 0xb4, 0x60, 0x46, 0x20,
+    0x04, 0x12, 0x14, 0x31, 0x01, 0xe0, 0xa0, 0xc1, 0x14, 0x31, 0x01, 0xe1, 0xa0, 0xc2, 0x14, 0x31,
+    0x01, 0xe2, 0xa0, 0xc3, 0x14, 0x31, 0x01, 0xe3, 0xa0, 0xc4, 0x14, 0x31, 0x01, 0xe4, 0xa0, 0xc5,
+    0x14, 0x31, 0x01, 0xe5, 0xa0, 0xc6, 0x14, 0x31, 0x01, 0xea, 0xa0, 0xc7, 0x14, 0x31, 0x01, 0xeb,
+    0x04, 0x30, 0x00, 0x08, 0x14, 0x31, 0x01, 0xec, 0x04, 0x30, 0x00, 0x09, 0x14, 0x31, 0x01, 0xed,
+    0x04, 0x30, 0x00, 0x0a, 0x14, 0x31, 0x01, 0xee, 0x04, 0x30, 0x00, 0x0b, 0x14, 0x31, 0x01, 0xef,
+    0x04, 0x30, 0x00, 0x0c, 0x14, 0x31, 0x01, 0xe6, 0x04, 0x30, 0x00, 0x0d, 0x14, 0x31, 0x01, 0xe7,
+    0x04, 0x30, 0x00, 0x0e, 0x14, 0x31, 0x01, 0xe8, 0x04, 0x30, 0x00, 0x0f, 0x14, 0x31, 0x01, 0xe9,
+    0x04, 0x30, 0x00, 0x10, 0x14, 0x31, 0x01, 0xf0, 0x04, 0x30, 0x00, 0x11, 0x14, 0x31, 0x01, 0xf1,
+    0x04, 0x30, 0x00, 0x12, 0x14, 0x31, 0x01, 0xf2, 0x84, 0xed, 0x42, 0x70, 0x9c, 0x24, 0x04, 0x20,
+    0x00, 0x13, 0x46, 0x00, 0x04, 0x12, 0x9d, 0xf9, 0x14, 0x20, 0x01, 0xf3, 0x95, 0xfb, 0x80, 0xa0,
+    0x46, 0x30, 0x04, 0x12, 0x88, 0xfc, 0x58, 0x31, 0x8c, 0x60, 0x9c, 0x9c, 0x50, 0x11, 0x00, 0x0c,
+    0x9c, 0x0c, 0x84, 0x80, 0x14, 0x42, 0x83, 0x14, 0x45, 0xef, 0x00, 0xff, 0xb4, 0xc3, 0x45, 0xc0,
+    0xff, 0x00, 0x40, 0x63, 0x78, 0x02, 0xb6, 0xc3, 0x9d, 0x21, 0xa3, 0xb9, 0xb5, 0x43, 0x40, 0x83,
+    0x40, 0x09, 0x40, 0x84, 0x70, 0x02, 0x40, 0x84, 0x28, 0x04, 0xb7, 0x03, 0x40, 0x83, 0x20, 0x09,
+    0xb5, 0x42, 0x41, 0xc4, 0x70, 0x02, 0x40, 0xa5, 0x78, 0x02, 0xb7, 0x42, 0x45, 0xef, 0xff, 0x00,
+    0xb5, 0x42, 0x54, 0x84, 0x00, 0xff, 0x40, 0xae, 0x28, 0x04, 0xb7, 0x42, 0x97, 0xb0, 0xb5, 0x41,
+    0x40, 0xa5, 0x78, 0x02, 0xb7, 0x41, 0xb5, 0x41, 0x40, 0x84, 0x28, 0x04, 0xb7, 0x01, 0xb5, 0x00,
+    0x40, 0x84, 0x78, 0x02, 0xb7, 0x00, 0xb5, 0x00, 0x40, 0x63, 0x20, 0x04, 0xb6, 0xc0, 0x84, 0xc4,
+    0x4c, 0x43, 0x7f, 0xca, 0x80, 0x05, 0x14, 0x90, 0x01, 0xc0, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e,
+    0x3b, 0xff, 0xfc, 0xbc, 0xef, 0xfc, 0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7, 0x8b, 0xa4, 0xdd, 0x2f,
+    0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7, 0x8c, 0xec, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7,
+    0x8b, 0x30, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7, 0x8b, 0x78, 0xdd, 0x2f, 0x46, 0xf0,
+    0x00, 0x89, 0x58, 0xf7, 0x8f, 0x90, 0xdd, 0x2f, 0xec, 0x04, 0x3b, 0xff, 0xfc, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0x98, 0xbc, 0xef, 0xf8, 0x84, 0x42, 0x50, 0x1f, 0x80, 0x06, 0x84, 0xc0, 0x44, 0x00,
+    0x01, 0xc4, 0xad, 0x88, 0x46, 0xf0, 0x00, 0x51, 0x58, 0xf7, 0x80, 0xf0, 0xdd, 0x2f, 0x02, 0x1f,
+    0x80, 0x03, 0x44, 0x50, 0x02, 0xe6, 0x46, 0x00, 0x01, 0x12, 0xd9, 0x05, 0x84, 0x21, 0x10, 0x10,
+    0x0b, 0x9c, 0xd5, 0x03, 0x10, 0x60, 0x0b, 0x9c, 0xec, 0x08, 0x3a, 0x6f, 0x98, 0x84, 0xdd, 0x9e,
+    0x3a, 0x6f, 0xa0, 0xbc, 0xef, 0xf8, 0x50, 0x8f, 0x80, 0x07, 0x46, 0x70, 0x00, 0x51, 0x58, 0x73,
+    0x80, 0xf0, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00, 0x00, 0xb2, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00,
+    0x46, 0x60, 0x01, 0x19, 0x58, 0x63, 0x0e, 0x90, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00, 0x00, 0xb3,
+    0xae, 0xf0, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00, 0x00, 0xb4,
+    0xae, 0xf1, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00, 0x00, 0xb5,
+    0xae, 0xf2, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00, 0x00, 0xbe,
+    0xae, 0xf3, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00, 0x00, 0xbf,
+    0xae, 0xf4, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00, 0x00, 0xa0,
+    0xae, 0xf5, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00, 0x00, 0xa1,
+    0xae, 0xf6, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00, 0x00, 0xa2,
+    0xae, 0xf7, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00, 0x00, 0xa3,
+    0x10, 0x33, 0x00, 0x08, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00,
+    0x00, 0xa4, 0x10, 0x33, 0x00, 0x09, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00, 0x80, 0x28, 0x84, 0x41,
+    0x44, 0x00, 0x00, 0xa5, 0x10, 0x33, 0x00, 0x0a, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00, 0x80, 0x28,
+    0x84, 0x41, 0x44, 0x00, 0x00, 0xa6, 0x10, 0x33, 0x00, 0x0b, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00,
+    0x80, 0x28, 0x84, 0x41, 0x44, 0x00, 0x00, 0xa7, 0x10, 0x33, 0x00, 0x0c, 0xdd, 0x27, 0x00, 0x34,
+    0x00, 0x00, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00, 0x00, 0xa8, 0x10, 0x33, 0x00, 0x0d, 0xdd, 0x27,
+    0x00, 0x34, 0x00, 0x00, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00, 0x00, 0xa9, 0x10, 0x33, 0x00, 0x0e,
+    0xdd, 0x27, 0x00, 0x34, 0x00, 0x00, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00, 0x00, 0xaa, 0x10, 0x33,
+    0x00, 0x0f, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00, 0x00, 0xab,
+    0x10, 0x33, 0x00, 0x10, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00, 0x80, 0x28, 0x84, 0x41, 0x44, 0x00,
+    0x00, 0xac, 0x10, 0x33, 0x00, 0x11, 0xdd, 0x27, 0x00, 0x34, 0x00, 0x00, 0x80, 0x28, 0x84, 0x41,
+    0x44, 0x00, 0x00, 0xad, 0x10, 0x33, 0x00, 0x12, 0xdd, 0x27, 0x00, 0x04, 0x00, 0x00, 0x10, 0x03,
+    0x00, 0x13, 0xec, 0x08, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x9c, 0xbc,
+    0xef, 0xf4, 0x46, 0x30, 0x04, 0x00, 0x04, 0x31, 0x80, 0x0e, 0x97, 0x80, 0x40, 0x01, 0xb4, 0x09,
+    0x97, 0xd0, 0x54, 0x00, 0x00, 0x07, 0x84, 0x42, 0x96, 0x48, 0x4c, 0x01, 0x00, 0x06, 0x84, 0xa1,
+    0x4c, 0x62, 0xc0, 0x8e, 0xd5, 0x03, 0x84, 0xa1, 0xde, 0x04, 0x10, 0x1f, 0x80, 0x07, 0xd5, 0x0b,
+    0x44, 0x00, 0x00, 0x35, 0x50, 0x1f, 0x80, 0x07, 0x84, 0x41, 0x46, 0xf0, 0x00, 0x51, 0x58, 0xf7,
+    0x80, 0xf0, 0xdd, 0x2f, 0x00, 0x0f, 0x80, 0x07, 0x42, 0x10, 0x04, 0x0b, 0xc9, 0x06, 0x84, 0x41,
+    0x46, 0xf0, 0x01, 0x12, 0x10, 0x27, 0x8b, 0xa8, 0x96, 0x04, 0xc8, 0x06, 0x84, 0x21, 0x46, 0xf0,
+    0x01, 0x12, 0x10, 0x17, 0x8b, 0xa9, 0x84, 0xa1, 0xde, 0x04, 0x10, 0x7f, 0x80, 0x07, 0xd5, 0x0b,
+    0x44, 0x00, 0x00, 0x36, 0x50, 0x1f, 0x80, 0x07, 0x84, 0x41, 0x46, 0xf0, 0x00, 0x51, 0x58, 0xf7,
+    0x80, 0xf0, 0xdd, 0x2f, 0x00, 0x0f, 0x80, 0x07, 0x42, 0x10, 0x0c, 0x0b, 0xc1, 0x06, 0x84, 0x41,
+    0x46, 0xf0, 0x01, 0x12, 0x10, 0x27, 0x8b, 0xaa, 0x42, 0x00, 0x08, 0x0b, 0xc0, 0x06, 0x84, 0x21,
+    0x46, 0xf0, 0x01, 0x12, 0x10, 0x17, 0x8b, 0xab, 0x84, 0x21, 0x4c, 0x60, 0xc0, 0x49, 0x46, 0xf0,
+    0x01, 0x12, 0x00, 0x57, 0x8b, 0xa8, 0xd6, 0x10, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x57, 0x8b, 0xa9,
+    0xd1, 0x0b, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x57, 0x8b, 0xaa, 0xd1, 0x06, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x57, 0x8b, 0xab, 0xd9, 0x34, 0x46, 0x00, 0x04, 0x00, 0x84, 0x80, 0x14, 0x40, 0x00, 0x48,
+    0x46, 0x00, 0x04, 0x00, 0x58, 0x00, 0x00, 0x4c, 0xb4, 0x20, 0x44, 0x2f, 0xff, 0xc5, 0x40, 0x10,
+    0x88, 0x02, 0xb6, 0x20, 0x46, 0x30, 0x04, 0x00, 0xb4, 0x20, 0x58, 0x10, 0x80, 0x10, 0xb6, 0x20,
+    0x04, 0x01, 0x80, 0x08, 0x80, 0x43, 0x42, 0x00, 0x30, 0x09, 0x14, 0x01, 0x80, 0x08, 0x04, 0x31,
+    0x00, 0x20, 0x42, 0x31, 0x98, 0x09, 0x14, 0x31, 0x00, 0x20, 0x46, 0x10, 0x04, 0x00, 0x58, 0x10,
+    0x81, 0x24, 0xb4, 0x41, 0xb6, 0x81, 0x9c, 0x0c, 0xb4, 0x40, 0xb6, 0x80, 0xb4, 0x41, 0xb6, 0x41,
+    0x44, 0x27, 0x70, 0x00, 0xb4, 0x20, 0x40, 0x10, 0x88, 0x04, 0xb6, 0x20, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x07, 0x8b, 0xa9, 0xc0, 0x19, 0x46, 0x10, 0x04, 0x00, 0x04, 0x20, 0x80, 0x49, 0x46, 0x3f,
+    0xff, 0x00, 0x58, 0x31, 0x8f, 0xff, 0x40, 0x21, 0x0c, 0x02, 0x44, 0x57, 0x70, 0x00, 0x40, 0x21,
+    0x14, 0x04, 0x14, 0x20, 0x80, 0x49, 0x46, 0x00, 0x04, 0x10, 0x04, 0x10, 0x01, 0x46, 0x58, 0x10,
+    0x80, 0x14, 0x14, 0x10, 0x01, 0x46, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x07, 0x8b, 0xa8, 0xc0, 0x19,
+    0x46, 0x10, 0x04, 0x00, 0x04, 0x20, 0x80, 0x49, 0x46, 0x3f, 0x00, 0xff, 0x58, 0x31, 0x8f, 0xff,
+    0x46, 0x50, 0x77, 0x00, 0x40, 0x21, 0x0c, 0x02, 0x40, 0x21, 0x14, 0x04, 0x14, 0x20, 0x80, 0x49,
+    0x46, 0x00, 0x04, 0x10, 0x04, 0x10, 0x01, 0x46, 0x58, 0x10, 0x80, 0x0a, 0x14, 0x10, 0x01, 0x46,
+    0x46, 0xf0, 0x01, 0x12, 0x00, 0x07, 0x8b, 0xaa, 0xc8, 0x06, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x07,
+    0x8b, 0xab, 0xc0, 0x16, 0x46, 0x10, 0x04, 0x00, 0x04, 0x20, 0x80, 0x49, 0x46, 0x57, 0x00, 0x00,
+    0x94, 0x94, 0x92, 0x44, 0x40, 0x21, 0x14, 0x04, 0x14, 0x20, 0x80, 0x49, 0x80, 0x01, 0x04, 0x10,
+    0x00, 0x4a, 0x92, 0x24, 0x94, 0x4c, 0x58, 0x10, 0x80, 0x07, 0x14, 0x10, 0x00, 0x4a, 0xec, 0x0c,
+    0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0x9c, 0xbc, 0xef, 0xfc, 0x96, 0x49,
+    0xb4, 0x40, 0xb4, 0xc0, 0xb4, 0xe0, 0xe6, 0x25, 0xe9, 0x13, 0x9c, 0x04, 0xb4, 0x60, 0x92, 0x7f,
+    0x46, 0xf0, 0x01, 0x12, 0x10, 0x37, 0x8b, 0xa5, 0xb4, 0x60, 0x46, 0xf0, 0x01, 0x12, 0x10, 0x37,
+    0x8b, 0xa6, 0xb4, 0x20, 0x92, 0x28, 0x46, 0xf0, 0x01, 0x12, 0x10, 0x17, 0x8b, 0xa7, 0x96, 0x90,
+    0x84, 0x02, 0x4c, 0x20, 0x00, 0x3d, 0xe6, 0x43, 0xe8, 0x06, 0xc2, 0x0b, 0x84, 0xa1, 0x4c, 0x22,
+    0xc0, 0x88, 0xd5, 0x1e, 0x84, 0xa3, 0xd2, 0x5e, 0x84, 0xa4, 0x4c, 0x22, 0xc0, 0x82, 0xd5, 0x7b,
+    0x46, 0xf0, 0x01, 0x12, 0x00, 0x07, 0x8b, 0xa5, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x17, 0x8b, 0xa6,
+    0x46, 0xf0, 0x01, 0x12, 0x00, 0x27, 0x8b, 0xa7, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x8b, 0xf8,
+    0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7, 0x8b, 0xa4, 0xdd, 0x2f, 0xd5, 0x69, 0x46, 0xf0,
+    0x01, 0x12, 0x00, 0x07, 0x8b, 0xa5, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x17, 0x8b, 0xa6, 0x46, 0xf0,
+    0x01, 0x12, 0x00, 0x27, 0x8b, 0xa7, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x8b, 0xf8, 0xdd, 0x2f,
+    0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7, 0x8b, 0x30, 0xdd, 0x2f, 0xd5, 0x52, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x07, 0x8b, 0xa5, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x17, 0x8b, 0xa6, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x27, 0x8b, 0xa7, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x8b, 0xf8, 0xdd, 0x2f, 0x46, 0xf0,
+    0x00, 0x89, 0x58, 0xf7, 0x8b, 0xa4, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7, 0x8c, 0xec,
+    0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7, 0x8b, 0x30, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x89,
+    0x58, 0xf7, 0x8b, 0x78, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7, 0x8f, 0x90, 0xdd, 0x2f,
+    0xd5, 0x27, 0x92, 0xc8, 0x92, 0xf0, 0x97, 0xb0, 0x97, 0xf8, 0x80, 0x07, 0x80, 0x26, 0x46, 0xf0,
+    0x00, 0x89, 0x58, 0xf7, 0x8d, 0x94, 0xdd, 0x2f, 0xce, 0x0a, 0x80, 0x07, 0x80, 0x26, 0x84, 0x41,
+    0x46, 0xf0, 0x00, 0x8a, 0x58, 0xf7, 0x87, 0x50, 0xdd, 0x2f, 0xd5, 0x12, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x27, 0x8b, 0xb2, 0x80, 0x26, 0x80, 0x07, 0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7, 0x8e, 0xbc,
+    0xdd, 0x2f, 0xd5, 0x06, 0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7, 0x8c, 0xec, 0xdd, 0x2f, 0x84, 0x00,
+    0xec, 0x04, 0x3a, 0x6f, 0x9c, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa0, 0xbc, 0xef, 0xf8, 0x84, 0xc0,
+    0x84, 0x60, 0x50, 0x1f, 0x80, 0x07, 0x84, 0x41, 0x44, 0x00, 0x01, 0x38, 0xae, 0xc8, 0xb6, 0xdf,
+    0x46, 0x70, 0x00, 0x87, 0x58, 0x73, 0x8f, 0x24, 0x46, 0xf0, 0x00, 0x51, 0x58, 0xf7, 0x80, 0xf0,
+    0xdd, 0x2f, 0x80, 0x5f, 0x44, 0x10, 0x00, 0x38, 0x80, 0x06, 0x4b, 0xe0, 0x1c, 0x01, 0x00, 0x3f,
+    0x80, 0x07, 0xb4, 0x1f, 0x46, 0x1f, 0xff, 0x0f, 0x58, 0x10, 0x8f, 0xff, 0x54, 0x31, 0x80, 0x0f,
+    0x40, 0x00, 0x04, 0x02, 0x40, 0x31, 0xc0, 0x08, 0x40, 0x31, 0x80, 0x04, 0xb6, 0x7f, 0x80, 0x43,
+    0x80, 0x06, 0x44, 0x10, 0x00, 0x38, 0x46, 0x60, 0x00, 0x87, 0x58, 0x63, 0x0f, 0x88, 0x4b, 0xe0,
+    0x18, 0x01, 0x80, 0x5f, 0x44, 0x10, 0x00, 0x38, 0x84, 0x01, 0x4b, 0xe0, 0x1c, 0x01, 0x00, 0x3f,
+    0x80, 0x07, 0xb4, 0x1f, 0x46, 0x1f, 0xff, 0x0f, 0x58, 0x10, 0x8f, 0xff, 0x54, 0x31, 0x80, 0x0f,
+    0x40, 0x00, 0x04, 0x02, 0x40, 0x31, 0xc0, 0x08, 0x40, 0x31, 0x80, 0x04, 0xb6, 0x7f, 0x80, 0x43,
+    0x44, 0x10, 0x00, 0x38, 0x84, 0x01, 0x81, 0x1f, 0x4b, 0xe0, 0x18, 0x01, 0xec, 0x08, 0x3a, 0x6f,
+    0xa0, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xfc, 0x80, 0x40, 0xb5, 0x00, 0xb4, 0xe0,
+    0xa2, 0x51, 0x80, 0xc0, 0x92, 0x30, 0x46, 0xf0, 0x01, 0x12, 0x10, 0x17, 0x8b, 0xb2, 0xb4, 0x22,
+    0x84, 0xa1, 0x46, 0xf0, 0x01, 0x12, 0x10, 0x17, 0x8b, 0xb4, 0xb4, 0x22, 0x92, 0x28, 0x46, 0xf0,
+    0x01, 0x12, 0x10, 0x17, 0x8b, 0xb3, 0xb4, 0x02, 0xb5, 0x22, 0xb4, 0x22, 0xb5, 0x42, 0x42, 0x10,
+    0xe4, 0x0b, 0xd9, 0x40, 0x46, 0x40, 0x04, 0x11, 0x80, 0xa6, 0x50, 0x13, 0x00, 0x0c, 0x50, 0x33,
+    0x00, 0x08, 0xb4, 0x63, 0x05, 0xc0, 0x80, 0x00, 0x04, 0x42, 0x00, 0x47, 0x0d, 0xe2, 0x80, 0x04,
+    0x46, 0x10, 0x01, 0x19, 0x58, 0x10, 0x8a, 0x48, 0x15, 0xe0, 0x80, 0x00, 0x88, 0x7c, 0xb4, 0x42,
+    0x42, 0x21, 0x64, 0x09, 0x47, 0xc0, 0x40, 0x00, 0x40, 0x21, 0x70, 0x04, 0xa8, 0x89, 0xb4, 0x45,
+    0xa8, 0x8c, 0xe2, 0x64, 0xe8, 0x0a, 0x9a, 0xdc, 0x50, 0x31, 0xd8, 0xef, 0xc3, 0x1b, 0x44, 0x10,
+    0x03, 0xe8, 0x40, 0x11, 0x84, 0x77, 0xd5, 0x0c, 0x50, 0x12, 0x27, 0x10, 0xe2, 0x61, 0xe9, 0x12,
+    0x52, 0x42, 0x58, 0xf0, 0x98, 0xe3, 0x44, 0x00, 0x03, 0xe8, 0x40, 0x11, 0x80, 0x77, 0x46, 0x00,
+    0x01, 0x19, 0x58, 0x00, 0x0e, 0x78, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x8e, 0xa8, 0xdd, 0x2f,
+    0xd5, 0x3c, 0x92, 0x10, 0x96, 0x00, 0x50, 0x10, 0x00, 0x20, 0x96, 0x48, 0xe6, 0x24, 0xe8, 0x09,
+    0x54, 0x00, 0x00, 0x0f, 0x46, 0xf0, 0x00, 0x8a, 0x58, 0xf7, 0x8c, 0x78, 0xdd, 0x2f, 0xd5, 0x2d,
+    0x42, 0x05, 0x68, 0x0b, 0x84, 0x40, 0x46, 0xf0, 0x01, 0x12, 0x10, 0x27, 0x8b, 0xac, 0xc0, 0x03,
+    0x84, 0xe1, 0xd5, 0x03, 0x92, 0xe8, 0x97, 0xf8, 0x42, 0x04, 0xe0, 0x0b, 0x84, 0x61, 0x4c, 0x01,
+    0xc0, 0x0d, 0x50, 0x03, 0x00, 0x08, 0x50, 0x13, 0x00, 0x0c, 0xb4, 0x00, 0xb4, 0x21, 0x46, 0xf0,
+    0x00, 0x87, 0x58, 0xf7, 0x84, 0xe4, 0xdd, 0x2f, 0x8c, 0xd0, 0xb4, 0x66, 0x54, 0x04, 0x00, 0xff,
+    0x80, 0x27, 0x84, 0x40, 0x46, 0xf0, 0x00, 0x84, 0x58, 0xf7, 0x80, 0x18, 0xdd, 0x2f, 0x84, 0x21,
+    0x46, 0xf0, 0x01, 0x12, 0x10, 0x17, 0x8b, 0x94, 0x84, 0x00, 0xec, 0x04, 0x3a, 0x6f, 0xaa, 0x84,
+    0xdd, 0x9e, 0x92, 0x00, 0x3b, 0xff, 0xfc, 0xbc, 0xef, 0xfc, 0x46, 0x00, 0x01, 0x19, 0x58, 0x00,
+    0x0e, 0x78, 0x46, 0x10, 0x00, 0x8c, 0x58, 0x10, 0x81, 0x6c, 0x84, 0x40, 0x46, 0xf0, 0x00, 0x80,
+    0x58, 0xf7, 0x8c, 0x80, 0xdd, 0x2f, 0xec, 0x04, 0x3b, 0xff, 0xfc, 0x84, 0xdd, 0x9e, 0x92, 0x00,
+    0x3b, 0xff, 0xfc, 0xbc, 0xef, 0xfc, 0x44, 0x10, 0x00, 0x14, 0x46, 0x00, 0x01, 0x19, 0x58, 0x00,
+    0x0a, 0x48, 0x46, 0xf0, 0x00, 0x8c, 0x58, 0xf7, 0x80, 0x00, 0xdd, 0x2f, 0x84, 0x20, 0x80, 0x41,
+    0x84, 0x0f, 0x46, 0xf0, 0x00, 0x84, 0x58, 0xf7, 0x87, 0x14, 0xdd, 0x2f, 0xec, 0x04, 0x3b, 0xff,
+    0xfc, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xb4, 0x46, 0x10, 0x01, 0x11, 0x58, 0x10,
+    0x8f, 0x84, 0x54, 0x80, 0x00, 0xff, 0x3a, 0x00, 0x84, 0x00, 0x46, 0x20, 0x01, 0x11, 0x58, 0x21,
+    0x0f, 0x7c, 0xf0, 0x90, 0x12, 0x1f, 0x80, 0x22, 0x3a, 0x01, 0x04, 0x00, 0x46, 0x20, 0x01, 0x11,
+    0x58, 0x21, 0x0f, 0x74, 0xf0, 0x8e, 0x12, 0x1f, 0x80, 0x1e, 0x3a, 0x01, 0x04, 0x00, 0x51, 0xcf,
+    0x80, 0x30, 0xb6, 0x1c, 0x12, 0x1e, 0x00, 0x02, 0x46, 0x20, 0x04, 0x10, 0x46, 0x35, 0x85, 0x04,
+    0x58, 0x31, 0x88, 0x40, 0x50, 0x7f, 0x80, 0x1c, 0x04, 0xa1, 0x01, 0x09, 0x14, 0x31, 0x01, 0x09,
+    0x46, 0x90, 0x00, 0x5a, 0x58, 0x94, 0x83, 0xc4, 0x84, 0x20, 0x44, 0x20, 0x00, 0x14, 0x80, 0x07,
+    0x4b, 0xe0, 0x24, 0x01, 0xa7, 0xba, 0xa7, 0x3b, 0xa4, 0xfb, 0xa6, 0xbc, 0x00, 0x03, 0x80, 0x12,
+    0x92, 0xc7, 0x95, 0xb7, 0x54, 0x42, 0x00, 0x1f, 0x92, 0x6e, 0x40, 0x31, 0xb8, 0x08, 0x54, 0x21,
+    0x00, 0x03, 0x54, 0x54, 0x00, 0x7f, 0x58, 0x42, 0x00, 0x40, 0x40, 0x53, 0x14, 0x04, 0x59, 0xe1,
+    0x00, 0x1c, 0x40, 0x60, 0x10, 0x09, 0x95, 0xb4, 0x58, 0x31, 0x80, 0x18, 0xaf, 0x3b, 0x84, 0x81,
+    0x50, 0x8f, 0x80, 0x04, 0xaf, 0x7a, 0x11, 0xe3, 0x80, 0x04, 0xaf, 0x3d, 0xac, 0xfb, 0x10, 0x63,
+    0x80, 0x12, 0x84, 0x20, 0x44, 0x20, 0x00, 0x18, 0x80, 0x08, 0x4b, 0xe0, 0x24, 0x01, 0x00, 0x44,
+    0x00, 0x00, 0x00, 0x34, 0x00, 0x01, 0x54, 0x42, 0x00, 0x03, 0x58, 0x42, 0x00, 0x08, 0x58, 0x31,
+    0x80, 0x01, 0x10, 0x44, 0x00, 0x00, 0x10, 0x34, 0x00, 0x01, 0x46, 0x60, 0x00, 0x5a, 0x58, 0x63,
+    0x03, 0x84, 0x50, 0x1f, 0x80, 0x40, 0x84, 0x46, 0x50, 0x0f, 0x80, 0x08, 0xdd, 0x26, 0x50, 0x1f,
+    0x80, 0x38, 0x84, 0x46, 0x50, 0x0f, 0x80, 0x0e, 0xdd, 0x26, 0x80, 0x3c, 0x84, 0x46, 0x50, 0x0f,
+    0x80, 0x14, 0xdd, 0x26, 0x46, 0x20, 0x04, 0x10, 0x04, 0x31, 0x01, 0x01, 0x44, 0x1f, 0xff, 0x1f,
+    0x40, 0x31, 0x84, 0x02, 0x14, 0x31, 0x01, 0x01, 0x46, 0x00, 0x04, 0x1d, 0x80, 0x27, 0x44, 0x20,
+    0x00, 0x14, 0xdd, 0x26, 0x46, 0x00, 0x04, 0x1d, 0x80, 0x28, 0x58, 0x00, 0x00, 0x14, 0x44, 0x20,
+    0x00, 0x18, 0xdd, 0x26, 0x46, 0x00, 0x04, 0x11, 0x84, 0x24, 0xa8, 0x41, 0x46, 0x00, 0x04, 0x10,
+    0x58, 0x00, 0x04, 0x10, 0xb4, 0x20, 0x81, 0x00, 0x58, 0x10, 0x80, 0x04, 0xb6, 0x20, 0x84, 0xc0,
+    0x46, 0x70, 0x00, 0x87, 0x58, 0x73, 0x8f, 0x04, 0xb4, 0x28, 0x84, 0x0a, 0x54, 0x10, 0x80, 0x40,
+    0xc1, 0x08, 0x9d, 0xb1, 0x4b, 0xe0, 0x1c, 0x01, 0x97, 0xb1, 0x44, 0x50, 0x03, 0xe8, 0xde, 0xf5,
+    0x46, 0x10, 0x04, 0x11, 0x46, 0x00, 0x04, 0x10, 0x84, 0x40, 0xa8, 0x89, 0x14, 0xa0, 0x01, 0x09,
+    0xec, 0x4c, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0x64, 0x46, 0x10,
+    0x01, 0x11, 0x58, 0x10, 0x8f, 0x68, 0x96, 0x00, 0xf0, 0x81, 0x3a, 0x00, 0x88, 0x00, 0x50, 0x3f,
+    0x80, 0x80, 0x3a, 0x01, 0x84, 0x24, 0xf0, 0x01, 0xac, 0x98, 0xe6, 0x0f, 0xe8, 0x09, 0x46, 0xf0,
+    0x01, 0x12, 0x00, 0x17, 0x8b, 0xa9, 0x84, 0xa1, 0xd9, 0x0a, 0x48, 0x00, 0x06, 0x54, 0x46, 0xf0,
+    0x01, 0x12, 0x00, 0x17, 0x8b, 0xa8, 0x84, 0xa1, 0x4c, 0x12, 0x86, 0x4d, 0x46, 0x20, 0x01, 0x12,
+    0x00, 0x51, 0x0b, 0xac, 0xf0, 0x01, 0xd0, 0x14, 0x84, 0x20, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x17,
+    0x82, 0xfd, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x17, 0x82, 0xfa, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x17,
+    0x82, 0xfb, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x17, 0x82, 0xfc, 0x10, 0x01, 0x0b, 0xac, 0x46, 0x30,
+    0x04, 0x12, 0x84, 0x20, 0x50, 0x2f, 0x80, 0x8c, 0x58, 0x31, 0x87, 0x20, 0xf1, 0x84, 0xac, 0x52,
+    0xb6, 0x22, 0xf3, 0x82, 0xf1, 0x89, 0xf1, 0x87, 0xf1, 0x86, 0x83, 0x81, 0xd5, 0x02, 0x87, 0x81,
+    0x46, 0x10, 0x04, 0x11, 0x04, 0x10, 0x80, 0xec, 0xf1, 0x85, 0x4f, 0xc3, 0x00, 0x99, 0x46, 0x10,
+    0x04, 0x11, 0x04, 0x20, 0x80, 0xed, 0x54, 0x11, 0x00, 0x20, 0x54, 0x21, 0x00, 0x3f, 0xc1, 0x03,
+    0x50, 0x21, 0x7f, 0xc0, 0x46, 0x10, 0x04, 0x11, 0x04, 0x10, 0x80, 0xec, 0x54, 0x10, 0x80, 0x3f,
+    0x98, 0x51, 0x4e, 0x14, 0x00, 0x04, 0x84, 0x20, 0xd5, 0x02, 0x96, 0x48, 0x46, 0xf0, 0x01, 0x12,
+    0x04, 0x27, 0x82, 0xfa, 0xca, 0x06, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x37, 0x82, 0xfb, 0xc3, 0x09,
+    0xe2, 0x41, 0xe9, 0x07, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x27, 0x82, 0xfb, 0xe2, 0x22, 0xe8, 0xd0,
+    0x54, 0x20, 0x80, 0x03, 0xe4, 0x42, 0xe9, 0x35, 0x46, 0x20, 0x01, 0x12, 0x5e, 0xf0, 0x80, 0x78,
+    0xe9, 0x06, 0x44, 0x30, 0x00, 0x7f, 0x14, 0x31, 0x02, 0xfa, 0xd5, 0x0d, 0x50, 0x30, 0x80, 0x08,
+    0x14, 0x31, 0x02, 0xfa, 0xe4, 0x24, 0xe8, 0x07, 0x84, 0x40, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x27,
+    0x82, 0xfb, 0xd5, 0x06, 0x9e, 0x4c, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x17, 0x82, 0xfb, 0xf0, 0x05,
+    0x44, 0x70, 0x00, 0x3f, 0x54, 0x50, 0x00, 0x3f, 0x50, 0x82, 0x80, 0x04, 0x50, 0x12, 0x80, 0x08,
+    0x5c, 0x34, 0x00, 0x40, 0x5c, 0x60, 0x80, 0x40, 0x40, 0x83, 0x8c, 0x1a, 0x84, 0x5f, 0x84, 0x62,
+    0x84, 0x01, 0x40, 0x13, 0x98, 0x1a, 0x9f, 0x6c, 0xf2, 0x8a, 0xf3, 0x8b, 0xf0, 0x8c, 0xd5, 0x2e,
+    0x46, 0x20, 0x01, 0x12, 0x5e, 0xf0, 0x80, 0x7c, 0xe9, 0x06, 0x44, 0x30, 0x00, 0x7f, 0x14, 0x31,
+    0x02, 0xfa, 0xd5, 0x0c, 0x9c, 0xcc, 0x14, 0x31, 0x02, 0xfa, 0xe4, 0x28, 0xe8, 0x07, 0x84, 0x40,
+    0x46, 0xf0, 0x01, 0x12, 0x14, 0x27, 0x82, 0xfb, 0xd5, 0x06, 0x8e, 0x28, 0x46, 0xf0, 0x01, 0x12,
+    0x14, 0x17, 0x82, 0xfb, 0xf2, 0x05, 0x44, 0x30, 0x00, 0x3f, 0x54, 0x11, 0x00, 0x3f, 0x9d, 0x4c,
+    0x5c, 0x42, 0x80, 0x40, 0x40, 0x51, 0x90, 0x1a, 0x84, 0x1e, 0x84, 0x61, 0x84, 0x5f, 0xf3, 0x8a,
+    0xf0, 0x8b, 0xf2, 0x8c, 0x50, 0x80, 0xff, 0xfc, 0x8e, 0x28, 0xf0, 0x05, 0x40, 0x30, 0x18, 0x09,
+    0x94, 0xde, 0x40, 0x52, 0x8c, 0x04, 0xf5, 0x8d, 0x48, 0x00, 0x00, 0xa2, 0x46, 0x10, 0x04, 0x11,
+    0x04, 0x20, 0x80, 0xea, 0x54, 0x11, 0x00, 0x20, 0x54, 0x21, 0x00, 0x3f, 0xc1, 0x03, 0x50, 0x21,
+    0x7f, 0xc0, 0x46, 0x10, 0x04, 0x11, 0x04, 0x10, 0x80, 0xec, 0x92, 0x28, 0x54, 0x10, 0x80, 0x3f,
+    0x98, 0x51, 0x4e, 0x14, 0x00, 0x04, 0x84, 0x20, 0xd5, 0x02, 0x96, 0x48, 0x46, 0xf0, 0x01, 0x12,
+    0x04, 0x27, 0x82, 0xfc, 0xca, 0x06, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x37, 0x82, 0xfd, 0xc3, 0x0a,
+    0xe2, 0x41, 0xe9, 0x08, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x27, 0x82, 0xfd, 0xe2, 0x22, 0x4e, 0xf2,
+    0x05, 0x5a, 0x54, 0x20, 0x80, 0x03, 0xe4, 0x42, 0xe9, 0x36, 0x46, 0x20, 0x01, 0x12, 0x5e, 0xf0,
+    0x80, 0x78, 0xe9, 0x06, 0x44, 0x30, 0x00, 0x7f, 0x14, 0x31, 0x02, 0xfc, 0xd5, 0x0d, 0x50, 0x30,
+    0x80, 0x08, 0x14, 0x31, 0x02, 0xfc, 0xe4, 0x24, 0xe8, 0x07, 0x84, 0x40, 0x46, 0xf0, 0x01, 0x12,
+    0x14, 0x27, 0x82, 0xfd, 0xd5, 0x06, 0x9e, 0x4c, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x17, 0x82, 0xfd,
+    0xf3, 0x05, 0x44, 0x70, 0x00, 0x3f, 0x40, 0x11, 0xa0, 0x09, 0x54, 0x50, 0x80, 0x3f, 0x9d, 0x2c,
+    0x50, 0x12, 0x80, 0x08, 0x5c, 0x32, 0x00, 0x40, 0x5c, 0x60, 0x80, 0x40, 0x40, 0x43, 0x8c, 0x1a,
+    0x84, 0x1f, 0x84, 0x42, 0x84, 0x61, 0x40, 0x13, 0x98, 0x1a, 0x9f, 0x6c, 0xf0, 0x8a, 0xf2, 0x8b,
+    0xf3, 0x8c, 0xd5, 0x2f, 0x46, 0x20, 0x01, 0x12, 0x5e, 0xf0, 0x80, 0x7c, 0xe9, 0x06, 0x44, 0x30,
+    0x00, 0x7f, 0x14, 0x31, 0x02, 0xfc, 0xd5, 0x0c, 0x9c, 0xcc, 0x14, 0x31, 0x02, 0xfc, 0xe4, 0x28,
+    0xe8, 0x07, 0x84, 0x40, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x27, 0x82, 0xfd, 0xd5, 0x06, 0x8e, 0x28,
+    0x46, 0xf0, 0x01, 0x12, 0x14, 0x17, 0x82, 0xfd, 0xf0, 0x05, 0x44, 0x30, 0x00, 0x3f, 0x40, 0x10,
+    0x20, 0x09, 0x54, 0x10, 0x80, 0x3f, 0x9d, 0x4c, 0x5c, 0x42, 0x80, 0x40, 0x40, 0x51, 0x90, 0x1a,
+    0x84, 0x41, 0x84, 0x7e, 0x84, 0x1f, 0xf2, 0x8a, 0xf3, 0x8b, 0xf0, 0x8c, 0x9f, 0x0c, 0x8e, 0x28,
+    0xf2, 0x05, 0x44, 0x0f, 0xc0, 0xff, 0x40, 0x82, 0x20, 0x08, 0x40, 0x31, 0x00, 0x02, 0x40, 0x42,
+    0xa0, 0x08, 0x40, 0x42, 0x0c, 0x04, 0xf4, 0x8d, 0x40, 0x10, 0xa0, 0x08, 0x40, 0x84, 0x0c, 0x04,
+    0x40, 0x30, 0x8c, 0x04, 0xf3, 0x8e, 0x14, 0x8f, 0x80, 0x0f, 0x46, 0x00, 0x04, 0x11, 0x46, 0x60,
+    0x00, 0x88, 0x58, 0x63, 0x00, 0x80, 0x58, 0x00, 0x00, 0x04, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x00,
+    0x04, 0x11, 0x58, 0x00, 0x03, 0x44, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x60, 0x04, 0x11, 0xa1, 0x31,
+    0x84, 0x33, 0x40, 0x32, 0x04, 0x02, 0xa8, 0xf1, 0x80, 0xe6, 0x04, 0x43, 0x80, 0xd1, 0x81, 0x26,
+    0x40, 0x32, 0x20, 0x09, 0x40, 0x31, 0xa0, 0x08, 0x14, 0x33, 0x80, 0xd1, 0x84, 0xe0, 0x46, 0xa0,
+    0x00, 0x87, 0x58, 0xa5, 0x0f, 0x04, 0x04, 0x64, 0x80, 0x80, 0x9d, 0xf9, 0x97, 0xb4, 0x84, 0x0a,
+    0xc6, 0x08, 0x4b, 0xe0, 0x28, 0x01, 0x44, 0x50, 0x0b, 0xb8, 0xdf, 0xf6, 0x48, 0x00, 0x02, 0x1b,
+    0x46, 0x70, 0x04, 0x12, 0x46, 0x90, 0x00, 0x87, 0x58, 0x94, 0x8f, 0x04, 0x04, 0x13, 0x80, 0x4c,
+    0x9d, 0xb1, 0x84, 0x0a, 0xc1, 0x08, 0x4b, 0xe0, 0x24, 0x01, 0x44, 0x50, 0x0b, 0xb8, 0xde, 0xf7,
+    0x48, 0x00, 0x02, 0x09, 0x46, 0x00, 0x04, 0x11, 0x46, 0x60, 0x00, 0x88, 0x58, 0x63, 0x00, 0x80,
+    0x58, 0x00, 0x03, 0xb0, 0xdd, 0x26, 0xf1, 0x02, 0x44, 0x2f, 0x1f, 0xff, 0xb4, 0x81, 0x46, 0x00,
+    0x04, 0x12, 0x40, 0x32, 0x08, 0x02, 0xb6, 0x61, 0x58, 0x00, 0x03, 0x20, 0xdd, 0x26, 0x46, 0x40,
+    0x04, 0x12, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x07, 0x04, 0x04, 0x42, 0x00, 0xc8, 0xdd, 0x26,
+    0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x07, 0x08, 0xdd, 0x26, 0x44, 0x00, 0x13, 0x28, 0xdd, 0x26,
+    0xf3, 0x01, 0xe6, 0x6f, 0xe8, 0x15, 0x4f, 0xc3, 0x00, 0x0b, 0x46, 0x50, 0x04, 0x11, 0x46, 0x40,
+    0x01, 0xc0, 0x58, 0x52, 0x83, 0x28, 0x58, 0x42, 0x00, 0x20, 0xd5, 0x1d, 0x46, 0x50, 0x04, 0x11,
+    0x46, 0x40, 0x01, 0xc0, 0x58, 0x52, 0x83, 0x28, 0x58, 0x42, 0x00, 0x80, 0xd5, 0x14, 0x4f, 0xc3,
+    0x00, 0x0b, 0x46, 0x50, 0x04, 0x11, 0x46, 0x40, 0x01, 0xc0, 0x58, 0x52, 0x83, 0x28, 0x58, 0x42,
+    0x00, 0x10, 0xd5, 0x09, 0x46, 0x50, 0x04, 0x11, 0x46, 0x40, 0x01, 0xc0, 0x58, 0x52, 0x83, 0x28,
+    0x58, 0x42, 0x00, 0x40, 0xb6, 0x85, 0x46, 0x00, 0x04, 0x12, 0x46, 0x70, 0x04, 0x12, 0x58, 0x00,
+    0x00, 0x04, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x80, 0x80, 0xdd, 0x2f, 0xa1, 0xb9, 0x54, 0x43,
+    0x00, 0x10, 0xcc, 0x04, 0x58, 0x33, 0x00, 0x10, 0xa8, 0xf9, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00,
+    0x01, 0x24, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x80, 0x80, 0xdd, 0x2f, 0x46, 0x40, 0x04, 0x12,
+    0x44, 0x3f, 0xf5, 0x7c, 0x14, 0x32, 0x00, 0x49, 0x46, 0x60, 0x00, 0x87, 0x58, 0x63, 0x0f, 0xc4,
+    0xf0, 0x01, 0x46, 0x70, 0x00, 0x87, 0x58, 0x73, 0x8f, 0x88, 0xe6, 0x0f, 0xe8, 0x45, 0x80, 0x1c,
+    0x84, 0x20, 0xdd, 0x26, 0x80, 0x1c, 0x84, 0x24, 0xdd, 0x26, 0x80, 0x1c, 0x44, 0x10, 0x00, 0x10,
+    0xdd, 0x26, 0x80, 0x1c, 0x44, 0x10, 0x00, 0x44, 0xdd, 0x26, 0x80, 0x1c, 0x44, 0x10, 0x02, 0x10,
+    0xdd, 0x26, 0x80, 0x1c, 0x44, 0x10, 0x02, 0x64, 0xdd, 0x26, 0x80, 0x1c, 0x44, 0x10, 0x01, 0x14,
+    0xdd, 0x26, 0x46, 0x2a, 0x00, 0x56, 0x58, 0x21, 0x0f, 0x53, 0x84, 0x20, 0x80, 0x1c, 0xdd, 0x27,
+    0x84, 0x24, 0x44, 0x24, 0x01, 0x2c, 0x80, 0x1c, 0xdd, 0x27, 0x46, 0x23, 0x0c, 0xf0, 0x58, 0x21,
+    0x00, 0x06, 0x44, 0x10, 0x00, 0x10, 0x80, 0x1c, 0xdd, 0x27, 0x46, 0x20, 0x25, 0x12, 0x58, 0x21,
+    0x00, 0x16, 0x44, 0x10, 0x00, 0x44, 0x80, 0x1c, 0xdd, 0x27, 0x46, 0x20, 0x00, 0xb9, 0x58, 0x21,
+    0x0e, 0x9e, 0x44, 0x10, 0x02, 0x10, 0x80, 0x1c, 0xdd, 0x27, 0x46, 0x20, 0x08, 0x88, 0x80, 0x1c,
+    0x44, 0x10, 0x02, 0x64, 0xd5, 0x52, 0x84, 0x20, 0x80, 0x1c, 0xdd, 0x26, 0x80, 0x1c, 0x84, 0x24,
+    0xdd, 0x26, 0x80, 0x1c, 0x44, 0x10, 0x00, 0x10, 0xdd, 0x26, 0x80, 0x1c, 0x44, 0x10, 0x02, 0xa8,
+    0xdd, 0x26, 0x80, 0x1c, 0x44, 0x10, 0x02, 0x10, 0xdd, 0x26, 0x80, 0x1c, 0x44, 0x10, 0x02, 0x54,
+    0xdd, 0x26, 0x80, 0x1c, 0x44, 0x10, 0x02, 0x60, 0xdd, 0x26, 0x80, 0x1c, 0x44, 0x10, 0x01, 0x14,
+    0xdd, 0x26, 0x46, 0x2a, 0x00, 0x56, 0x58, 0x21, 0x0f, 0x57, 0x84, 0x20, 0x80, 0x1c, 0xdd, 0x27,
+    0x84, 0x24, 0x44, 0x24, 0x01, 0x23, 0x80, 0x1c, 0xdd, 0x27, 0x46, 0x23, 0x04, 0xf0, 0x58, 0x21,
+    0x00, 0x06, 0x44, 0x10, 0x00, 0x10, 0x80, 0x1c, 0xdd, 0x27, 0x46, 0x20, 0x14, 0xec, 0x58, 0x21,
+    0x0d, 0x28, 0x44, 0x10, 0x02, 0xa8, 0x80, 0x1c, 0xdd, 0x27, 0x46, 0x20, 0x00, 0xb9, 0x58, 0x21,
+    0x0e, 0x9e, 0x44, 0x10, 0x02, 0x10, 0x80, 0x1c, 0xdd, 0x27, 0x46, 0x23, 0x64, 0x55, 0x58, 0x21,
+    0x07, 0x77, 0x44, 0x10, 0x02, 0x54, 0x80, 0x1c, 0xdd, 0x27, 0x46, 0x26, 0x63, 0xca, 0x80, 0x1c,
+    0x58, 0x21, 0x05, 0x8f, 0x44, 0x10, 0x02, 0x60, 0xdd, 0x27, 0x46, 0x20, 0x08, 0x04, 0x44, 0x10,
+    0x01, 0x14, 0x58, 0x21, 0x00, 0x81, 0x80, 0x1c, 0xdd, 0x27, 0x46, 0x60, 0x00, 0x88, 0x58, 0x63,
+    0x00, 0x80, 0x44, 0x00, 0x13, 0xb8, 0x4b, 0xe0, 0x18, 0x01, 0x44, 0x00, 0x13, 0xbc, 0x4b, 0xe0,
+    0x18, 0x01, 0x46, 0x60, 0x04, 0x11, 0x04, 0x43, 0x00, 0xef, 0x40, 0x3e, 0x7c, 0x08, 0x40, 0x31,
+    0x90, 0x04, 0x14, 0x33, 0x00, 0xef, 0x84, 0x25, 0xf1, 0x88, 0x15, 0xcf, 0x80, 0x03, 0x04, 0x9f,
+    0x80, 0x06, 0x85, 0x02, 0x84, 0xa2, 0x4c, 0x82, 0xc0, 0x08, 0x46, 0x20, 0x04, 0x11, 0xf3, 0x05,
+    0x14, 0x31, 0x00, 0xec, 0xd5, 0x35, 0x84, 0xa3, 0x4c, 0x82, 0xc0, 0x0c, 0xf1, 0x07, 0xf3, 0x0c,
+    0x46, 0x20, 0x04, 0x11, 0xf0, 0x0f, 0x40, 0x90, 0x8c, 0x00, 0x14, 0x01, 0x00, 0xec, 0xd5, 0x18,
+    0x84, 0xa4, 0x4c, 0x82, 0xc0, 0x0c, 0xf3, 0x07, 0xf0, 0x0b, 0x46, 0x20, 0x04, 0x11, 0x58, 0x21,
+    0x03, 0xb0, 0x40, 0x91, 0x80, 0x00, 0xf1, 0x0e, 0xd5, 0x0a, 0xf3, 0x07, 0xf0, 0x0a, 0x46, 0x20,
+    0x04, 0x11, 0xf1, 0x0d, 0x58, 0x21, 0x03, 0xb0, 0x40, 0x91, 0x80, 0x00, 0xb6, 0x22, 0x4e, 0x94,
+    0x00, 0x09, 0x46, 0x30, 0x04, 0x11, 0x58, 0x31, 0x83, 0xb8, 0x44, 0x20, 0x00, 0x10, 0xd5, 0x07,
+    0x46, 0x30, 0x04, 0x11, 0x58, 0x31, 0x83, 0xb8, 0x58, 0x24, 0x80, 0x10, 0xb6, 0x43, 0xf2, 0x01,
+    0xe6, 0x4f, 0xe8, 0x0d, 0x46, 0x30, 0x04, 0x12, 0x44, 0x20, 0x11, 0x10, 0x46, 0x40, 0x04, 0x12,
+    0x14, 0x21, 0x81, 0xc1, 0x58, 0x42, 0x07, 0x08, 0x84, 0x40, 0xd5, 0x0d, 0x46, 0x30, 0x04, 0x12,
+    0x44, 0x20, 0x0d, 0x0d, 0x46, 0x40, 0x04, 0x12, 0x14, 0x21, 0x81, 0xc1, 0x58, 0x42, 0x07, 0x08,
+    0x44, 0x20, 0x08, 0x08, 0xb6, 0x44, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x07, 0x14, 0x46, 0xf0,
+    0x00, 0x88, 0x58, 0xf7, 0x80, 0x80, 0xdd, 0x2f, 0xf3, 0x03, 0xcb, 0x06, 0x46, 0x20, 0x04, 0x12,
+    0x14, 0x31, 0x01, 0xc5, 0xd5, 0x07, 0x46, 0x30, 0x04, 0x12, 0x44, 0x20, 0x00, 0x81, 0x14, 0x21,
+    0x81, 0xc5, 0xf0, 0x03, 0x44, 0x10, 0x02, 0x98, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0xc4,
+    0xdd, 0x2f, 0x46, 0x00, 0x04, 0x11, 0x58, 0x00, 0x02, 0x80, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7,
+    0x80, 0x80, 0xdd, 0x2f, 0xf0, 0x03, 0x84, 0x60, 0x44, 0x10, 0x02, 0x98, 0x50, 0x2f, 0x80, 0x94,
+    0xf3, 0xa5, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x24, 0xdd, 0x2f, 0xf3, 0x25, 0x92, 0x62,
+    0x94, 0xda, 0xf0, 0x03, 0x80, 0x43, 0x44, 0x10, 0x02, 0x98, 0xf3, 0xa5, 0x46, 0xf0, 0x00, 0x87,
+    0x58, 0xf7, 0x8f, 0x88, 0xdd, 0x2f, 0x46, 0x30, 0x04, 0x11, 0x44, 0x20, 0x00, 0x30, 0x14, 0x21,
+    0x80, 0xa0, 0x84, 0xa2, 0x4c, 0x82, 0xc0, 0x08, 0x84, 0x07, 0x46, 0xf0, 0x00, 0x8c, 0x58, 0xf7,
+    0x81, 0xa0, 0xdd, 0x2f, 0x46, 0x70, 0x04, 0x11, 0x84, 0xc0, 0x04, 0x13, 0x80, 0x80, 0x9d, 0xb1,
+    0x96, 0x4c, 0x84, 0x0a, 0xc1, 0x0a, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f,
+    0x44, 0x50, 0x03, 0xe8, 0xde, 0xf3, 0xd5, 0x11, 0x46, 0x60, 0x04, 0x12, 0x80, 0xe1, 0x04, 0x13,
+    0x00, 0x4c, 0x9d, 0xf9, 0x84, 0x0a, 0xc1, 0x15, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04,
+    0xdd, 0x2f, 0x44, 0x50, 0x03, 0xe8, 0xdf, 0xf4, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x80, 0x20,
+    0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x80, 0xac, 0xdd, 0x2f, 0x48, 0x00, 0x02, 0x8b,
+    0x84, 0xa2, 0x4c, 0x82, 0xc0, 0x0a, 0x46, 0x10, 0x04, 0x11, 0x04, 0x10, 0x80, 0xef, 0x54, 0x10,
+    0x80, 0x0f, 0xf1, 0x87, 0x81, 0x21, 0x85, 0x40, 0x14, 0x9f, 0x80, 0x06, 0x04, 0x9f, 0x80, 0x08,
+    0x84, 0xe5, 0x83, 0x8a, 0x50, 0x0f, 0x80, 0x80, 0x38, 0x10, 0x1c, 0x00, 0x46, 0x30, 0x00, 0xb0,
+    0x40, 0x20, 0xa0, 0x08, 0xf0, 0x03, 0x40, 0x10, 0x8c, 0x04, 0x40, 0x20, 0x88, 0x04, 0x44, 0x10,
+    0x02, 0x10, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x88, 0xdd, 0x2f, 0x46, 0x20, 0x04, 0x11,
+    0x84, 0x28, 0x80, 0xa2, 0x46, 0x38, 0x00, 0x08, 0x80, 0x82, 0x46, 0x60, 0x04, 0x12, 0xa8, 0x51,
+    0x44, 0x10, 0x21, 0x05, 0x15, 0xc1, 0x00, 0x01, 0x14, 0x32, 0x80, 0x99, 0x46, 0x20, 0x04, 0x12,
+    0x14, 0x32, 0x00, 0x9a, 0x14, 0x13, 0x01, 0xc6, 0x58, 0x21, 0x07, 0x24, 0xb4, 0x22, 0x46, 0x03,
+    0x80, 0x0f, 0x58, 0x00, 0x0f, 0xff, 0x40, 0x10, 0x80, 0x02, 0xb6, 0x22, 0xf1, 0x03, 0xc9, 0x1a,
+    0x84, 0xa4, 0x4c, 0x82, 0x80, 0x10, 0x84, 0xa5, 0x4c, 0x82, 0x80, 0x11, 0x84, 0xa3, 0x4c, 0x82,
+    0x80, 0x06, 0x46, 0x30, 0x20, 0x00, 0xb4, 0x22, 0xd5, 0x21, 0x46, 0x04, 0x20, 0x00, 0xb4, 0x22,
+    0xd5, 0x23, 0x46, 0x30, 0x60, 0x00, 0xb4, 0x22, 0xd5, 0x19, 0x46, 0x04, 0x60, 0x00, 0xb4, 0x22,
+    0xd5, 0x1b, 0x84, 0xa4, 0x4c, 0x82, 0x80, 0x10, 0x84, 0xa5, 0x4c, 0x82, 0x80, 0x13, 0x84, 0xa3,
+    0x4c, 0x82, 0x80, 0x06, 0x46, 0x38, 0x20, 0x00, 0xb4, 0x22, 0xd5, 0x08, 0x46, 0x0c, 0x20, 0x00,
+    0xb4, 0x22, 0xd5, 0x0a, 0x46, 0x38, 0x60, 0x00, 0xb4, 0x22, 0x40, 0x10, 0x8c, 0x04, 0xd5, 0x06,
+    0x46, 0x0c, 0x60, 0x00, 0xb4, 0x22, 0x40, 0x10, 0x80, 0x04, 0xb6, 0x22, 0x80, 0x46, 0x84, 0x21,
+    0xa8, 0x54, 0x15, 0xc1, 0x00, 0x04, 0x46, 0x34, 0x10, 0x06, 0xf1, 0x02, 0x58, 0x31, 0x80, 0x0a,
+    0xb6, 0x61, 0x84, 0xc0, 0xf2, 0x02, 0x9d, 0xb1, 0xb4, 0x22, 0x84, 0x0a, 0x54, 0x10, 0xa0, 0x00,
+    0xc1, 0x09, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x44, 0x50, 0x00, 0x64,
+    0xde, 0xf2, 0x46, 0x30, 0x04, 0x12, 0x80, 0x43, 0x46, 0x10, 0x1f, 0xc0, 0x15, 0xc1, 0x81, 0xc6,
+    0x14, 0x11, 0x01, 0xc9, 0x80, 0x22, 0x04, 0x10, 0x81, 0xca, 0x96, 0x48, 0x5e, 0xf0, 0x80, 0x50,
+    0xe8, 0x06, 0x9d, 0xf9, 0xe4, 0xea, 0x4e, 0xf3, 0xff, 0x67, 0xd5, 0x2d, 0x5e, 0xf0, 0x80, 0xa1,
+    0xe9, 0x05, 0x9f, 0xf9, 0x4e, 0x74, 0xff, 0x60, 0xd5, 0x26, 0x84, 0x25, 0x40, 0x25, 0x04, 0x36,
+    0x84, 0xa4, 0xd9, 0x02, 0x8d, 0x26, 0x84, 0xa5, 0x4c, 0xa2, 0x80, 0x1e, 0x80, 0x09, 0x46, 0xf0,
+    0x00, 0x89, 0x58, 0xf7, 0x8a, 0x9c, 0xdd, 0x2f, 0x80, 0x60, 0x84, 0xa1, 0xdb, 0x11, 0x14, 0x9f,
+    0x80, 0x08, 0x04, 0x9f, 0x80, 0x06, 0x50, 0x4f, 0x80, 0x8c, 0x54, 0x24, 0x80, 0xff, 0x38, 0x32,
+    0x20, 0x08, 0xe6, 0x49, 0xe9, 0x11, 0x84, 0x20, 0x38, 0x12, 0x20, 0x08, 0xd5, 0x0d, 0x8d, 0x41,
+    0x48, 0xff, 0xff, 0x3a, 0x84, 0x60, 0x50, 0x2f, 0x80, 0x8c, 0x14, 0x9f, 0x80, 0x08, 0x38, 0x31,
+    0x20, 0x08, 0x04, 0x9f, 0x80, 0x06, 0x8d, 0x01, 0x84, 0x26, 0x4c, 0x80, 0xfe, 0x45, 0x05, 0xcf,
+    0x80, 0x03, 0x14, 0x9f, 0x80, 0x06, 0x50, 0x1f, 0x80, 0x8c, 0x4f, 0xc3, 0x00, 0x51, 0xa6, 0x48,
+    0xc9, 0x0a, 0x46, 0x20, 0x04, 0x12, 0x80, 0x22, 0x15, 0xc1, 0x01, 0xc9, 0x44, 0x20, 0x0f, 0xff,
+    0x14, 0x20, 0x81, 0xcb, 0x00, 0x1f, 0x80, 0x8d, 0xc9, 0x0c, 0x46, 0x20, 0x04, 0x12, 0x80, 0x22,
+    0x44, 0x31, 0x00, 0x00, 0x14, 0x31, 0x01, 0xc9, 0x44, 0x20, 0x0f, 0xff, 0x14, 0x20, 0x81, 0xcb,
+    0x00, 0x1f, 0x80, 0x8e, 0xc9, 0x0c, 0x46, 0x20, 0x04, 0x12, 0x46, 0x30, 0x20, 0x00, 0x80, 0x22,
+    0x14, 0x31, 0x01, 0xc9, 0x44, 0x20, 0x0f, 0xff, 0x14, 0x20, 0x81, 0xcb, 0x00, 0x1f, 0x80, 0x8f,
+    0xc9, 0x0c, 0x46, 0x20, 0x04, 0x12, 0x46, 0x30, 0x20, 0x10, 0x80, 0x22, 0x14, 0x31, 0x01, 0xc9,
+    0x44, 0x20, 0x0f, 0xff, 0x14, 0x20, 0x81, 0xcb, 0x00, 0x1f, 0x80, 0x90, 0xc9, 0x0c, 0x46, 0x20,
+    0x04, 0x12, 0x46, 0x30, 0x60, 0x00, 0x80, 0x22, 0x14, 0x31, 0x01, 0xc9, 0x44, 0x20, 0x0f, 0xff,
+    0x14, 0x20, 0x81, 0xcb, 0x00, 0x1f, 0x80, 0x91, 0xc9, 0x5f, 0x46, 0x20, 0x04, 0x12, 0x46, 0x30,
+    0x60, 0x10, 0x46, 0x10, 0x04, 0x12, 0x58, 0x21, 0x07, 0x24, 0xd5, 0x51, 0xa6, 0x48, 0xc9, 0x0c,
+    0x46, 0x20, 0x04, 0x12, 0x80, 0x22, 0x44, 0x32, 0x00, 0x00, 0x14, 0x31, 0x01, 0xc9, 0x44, 0x20,
+    0x0f, 0xff, 0x14, 0x20, 0x81, 0xcb, 0x00, 0x1f, 0x80, 0x8d, 0xc9, 0x0c, 0x46, 0x20, 0x04, 0x12,
+    0x80, 0x22, 0x44, 0x31, 0x00, 0x00, 0x14, 0x31, 0x01, 0xc9, 0x44, 0x23, 0x0f, 0xff, 0x14, 0x20,
+    0x81, 0xcb, 0x00, 0x1f, 0x80, 0x8e, 0xc9, 0x0c, 0x46, 0x20, 0x04, 0x12, 0x46, 0x30, 0x20, 0x20,
+    0x80, 0x22, 0x14, 0x31, 0x01, 0xc9, 0x44, 0x20, 0x0f, 0xff, 0x14, 0x20, 0x81, 0xcb, 0x00, 0x1f,
+    0x80, 0x8f, 0xc9, 0x0c, 0x46, 0x20, 0x04, 0x12, 0x46, 0x30, 0x20, 0x30, 0x80, 0x22, 0x14, 0x31,
+    0x01, 0xc9, 0x44, 0x20, 0x0f, 0xff, 0x14, 0x20, 0x81, 0xcb, 0x00, 0x1f, 0x80, 0x90, 0xc9, 0x0c,
+    0x46, 0x20, 0x04, 0x12, 0x46, 0x30, 0x60, 0x20, 0x80, 0x22, 0x14, 0x31, 0x01, 0xc9, 0x44, 0x20,
+    0x0f, 0xff, 0x14, 0x20, 0x81, 0xcb, 0x00, 0x1f, 0x80, 0x91, 0xc9, 0x0e, 0x46, 0x20, 0x04, 0x12,
+    0x46, 0x30, 0x60, 0x30, 0x46, 0x10, 0x04, 0x12, 0x58, 0x21, 0x07, 0x24, 0xb6, 0x62, 0x44, 0x20,
+    0x0f, 0xff, 0x14, 0x20, 0x81, 0xcb, 0x46, 0x50, 0x01, 0x11, 0x58, 0x52, 0x8f, 0x28, 0x3a, 0x02,
+    0x8c, 0x04, 0x50, 0x6f, 0x80, 0x40, 0x80, 0x86, 0x46, 0x70, 0x04, 0x12, 0x81, 0x27, 0x3a, 0x02,
+    0x0c, 0x24, 0x58, 0x73, 0x87, 0x24, 0x83, 0xc6, 0x85, 0x02, 0x3a, 0x02, 0x8c, 0x04, 0x85, 0x4a,
+    0x3a, 0x02, 0x0c, 0x24, 0x3a, 0x02, 0x8c, 0x04, 0x3a, 0x02, 0x0c, 0x24, 0x3a, 0x02, 0x8c, 0x00,
+    0x3a, 0x02, 0x0c, 0x20, 0xb4, 0x07, 0x46, 0x2f, 0x80, 0x0f, 0x58, 0x21, 0x0f, 0xff, 0x40, 0x00,
+    0x08, 0x02, 0x84, 0x64, 0xb6, 0x07, 0x4c, 0x81, 0x80, 0x1c, 0x84, 0x05, 0x4c, 0x80, 0x00, 0x25,
+    0x84, 0x23, 0x4c, 0x80, 0x80, 0x0c, 0x4f, 0xc3, 0x00, 0x06, 0x46, 0x20, 0x20, 0x00, 0xb4, 0x07,
+    0xd5, 0x20, 0x46, 0x30, 0x20, 0x20, 0xb4, 0x07, 0xd5, 0x22, 0x4f, 0xc3, 0x00, 0x06, 0x46, 0x10,
+    0x20, 0x10, 0xb4, 0x07, 0xd5, 0x0e, 0x46, 0x20, 0x20, 0x30, 0xb4, 0x07, 0xd5, 0x12, 0x4f, 0xc3,
+    0x00, 0x06, 0x46, 0x30, 0x60, 0x00, 0xb4, 0x07, 0xd5, 0x12, 0x46, 0x10, 0x60, 0x20, 0xb4, 0x07,
+    0x40, 0x00, 0x04, 0x04, 0xd5, 0x0e, 0x4f, 0xc3, 0x00, 0x08, 0x46, 0x20, 0x60, 0x10, 0xb4, 0x07,
+    0x40, 0x00, 0x08, 0x04, 0xd5, 0x06, 0x46, 0x30, 0x60, 0x30, 0xb4, 0x07, 0x40, 0x00, 0x0c, 0x04,
+    0xb6, 0x07, 0x80, 0x9e, 0xb4, 0xa7, 0x84, 0x60, 0x40, 0x01, 0x94, 0x04, 0xb6, 0x07, 0x04, 0x04,
+    0x81, 0xca, 0xa6, 0x60, 0x96, 0x80, 0x50, 0x21, 0x7f, 0x80, 0x42, 0x11, 0x04, 0x24, 0x4e, 0x26,
+    0x00, 0x05, 0x44, 0x10, 0x00, 0x80, 0xd5, 0x05, 0x40, 0x10, 0xa8, 0x56, 0x50, 0x10, 0x80, 0x80,
+    0x92, 0x08, 0x40, 0x00, 0x20, 0x08, 0x40, 0x00, 0x80, 0x04, 0x46, 0x20, 0x10, 0x00, 0x44, 0x14,
+    0x00, 0x00, 0x98, 0xd9, 0x14, 0x04, 0x81, 0xca, 0x9d, 0x21, 0x4c, 0x31, 0x7f, 0xdf, 0x8d, 0x01,
+    0x84, 0x66, 0x4c, 0x81, 0xff, 0x99, 0xf0, 0x01, 0xe6, 0x0f, 0xe8, 0x05, 0x80, 0x27, 0x44, 0x20,
+    0x0c, 0x0c, 0xd5, 0x1c, 0xf2, 0x01, 0x50, 0x11, 0x7f, 0xdc, 0x96, 0x48, 0xe6, 0x2d, 0xe8, 0x02,
+    0xd5, 0x07, 0xf3, 0x01, 0x50, 0x11, 0xff, 0xcc, 0x96, 0x48, 0xe6, 0x2d, 0xe8, 0x05, 0x80, 0x27,
+    0x44, 0x20, 0x22, 0x22, 0xd5, 0x0b, 0xf0, 0x01, 0x50, 0x10, 0x7f, 0x9e, 0x96, 0x48, 0xe6, 0x31,
+    0xe8, 0x02, 0xd5, 0x01, 0x80, 0x27, 0x44, 0x20, 0x18, 0x18, 0xb6, 0x41, 0x50, 0x1f, 0x80, 0x8c,
+    0x4f, 0xc3, 0x00, 0x13, 0xa6, 0x88, 0xca, 0x20, 0xa6, 0x89, 0xca, 0x1e, 0xa6, 0x8a, 0xca, 0x1c,
+    0xa6, 0x8b, 0xca, 0x1a, 0xa6, 0x8c, 0xca, 0x18, 0xa6, 0x8d, 0xf0, 0x09, 0x84, 0x21, 0x40, 0x00,
+    0x88, 0x1a, 0xf0, 0x89, 0xd5, 0x11, 0xa6, 0x88, 0xca, 0x0f, 0xa6, 0x89, 0xca, 0x0d, 0xa6, 0x8a,
+    0xca, 0x0b, 0xa6, 0x8b, 0xca, 0x09, 0xa6, 0x8c, 0xca, 0x07, 0xa6, 0x8d, 0xf3, 0x04, 0x84, 0x21,
+    0x40, 0x30, 0x88, 0x1a, 0xf3, 0x84, 0xf0, 0x09, 0x84, 0x21, 0x4c, 0x00, 0xc0, 0x0d, 0xf2, 0x04,
+    0x4c, 0x20, 0x40, 0x0a, 0xf3, 0x02, 0x44, 0x0f, 0x9f, 0xff, 0xb4, 0x23, 0x40, 0x10, 0x80, 0x02,
+    0xb6, 0x23, 0xd5, 0x0c, 0xf2, 0x02, 0x44, 0x3f, 0x9f, 0xff, 0xb4, 0x22, 0x40, 0x10, 0x8c, 0x02,
+    0xb6, 0x22, 0xb4, 0x22, 0x42, 0x10, 0xbc, 0x08, 0xb6, 0x22, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7,
+    0x80, 0x20, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x80, 0xac, 0xdd, 0x2f, 0x4f, 0xc2,
+    0xf9, 0xe0, 0xec, 0x9c, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc,
+    0xef, 0x34, 0x46, 0x40, 0x01, 0x12, 0x58, 0x42, 0x00, 0x3c, 0x96, 0x00, 0x96, 0x48, 0xf0, 0x85,
+    0xf1, 0x87, 0x3a, 0x02, 0x04, 0x00, 0x96, 0x90, 0x96, 0xd8, 0x46, 0x40, 0x01, 0x12, 0x58, 0x42,
+    0x00, 0x24, 0xf0, 0xae, 0x12, 0x1f, 0x80, 0x5e, 0xf2, 0x89, 0xf3, 0x86, 0x3a, 0x02, 0x0c, 0x04,
+    0x50, 0x5f, 0x80, 0x7c, 0x46, 0x60, 0x01, 0x12, 0x58, 0x63, 0x00, 0x1c, 0x46, 0x80, 0x01, 0x12,
+    0x58, 0x84, 0x00, 0x04, 0x51, 0xef, 0x80, 0x64, 0x3a, 0x02, 0x8c, 0x24, 0x50, 0x0f, 0x80, 0x4c,
+    0x47, 0xc0, 0x01, 0x11, 0x59, 0xce, 0x0f, 0xfc, 0x46, 0xa0, 0x01, 0x11, 0x58, 0xa5, 0x0f, 0xd4,
+    0x46, 0x70, 0x00, 0x87, 0x58, 0x73, 0x8f, 0xc4, 0xf0, 0x81, 0x3a, 0x02, 0x04, 0x00, 0x80, 0x45,
+    0x3a, 0x01, 0x04, 0x20, 0x50, 0x1f, 0x80, 0x94, 0xb6, 0x3f, 0x3a, 0x03, 0x04, 0x00, 0x46, 0x40,
+    0x01, 0x11, 0x58, 0x42, 0x0f, 0xe4, 0xf0, 0xac, 0x12, 0x1f, 0x80, 0x5a, 0x3a, 0x04, 0x0c, 0x04,
+    0x46, 0x90, 0x00, 0x88, 0x58, 0x94, 0x80, 0x80, 0x46, 0x60, 0x00, 0x87, 0x58, 0x63, 0x0f, 0x88,
+    0x3a, 0x0f, 0x0c, 0x24, 0x3a, 0x04, 0x04, 0x00, 0x3a, 0x0f, 0x04, 0x20, 0x3a, 0x0e, 0x04, 0x00,
+    0xf0, 0xaa, 0x12, 0x1f, 0x80, 0x56, 0x3a, 0x02, 0x0c, 0x04, 0xf5, 0x01, 0x3a, 0x02, 0x8c, 0x24,
+    0x3a, 0x02, 0x04, 0x00, 0x3a, 0x02, 0x84, 0x20, 0x3a, 0x05, 0x08, 0x00, 0x46, 0xf0, 0x01, 0x11,
+    0x04, 0x47, 0x83, 0xf8, 0xb4, 0x7f, 0x40, 0x52, 0x40, 0x09, 0x3a, 0x01, 0x88, 0x20, 0x44, 0x10,
+    0x02, 0x44, 0x10, 0x5f, 0x80, 0xc6, 0x12, 0x4f, 0x80, 0x62, 0xf0, 0x05, 0xdd, 0x27, 0x46, 0x00,
+    0x04, 0x12, 0x58, 0x00, 0x07, 0x00, 0x4b, 0xe0, 0x24, 0x01, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00,
+    0x00, 0x04, 0x4b, 0xe0, 0x24, 0x01, 0x46, 0x40, 0x04, 0x12, 0x44, 0x50, 0x00, 0x42, 0xa9, 0x61,
+    0xf5, 0x07, 0xc5, 0x77, 0xf0, 0x05, 0x84, 0x20, 0xdd, 0x27, 0xf0, 0x05, 0x46, 0x2a, 0x00, 0x56,
+    0x58, 0x21, 0x06, 0x57, 0x84, 0x20, 0xdd, 0x26, 0xf0, 0x05, 0x44, 0x10, 0x00, 0x10, 0xdd, 0x27,
+    0xf0, 0x05, 0x46, 0x23, 0x80, 0x70, 0x58, 0x21, 0x00, 0x06, 0x44, 0x10, 0x00, 0x10, 0xdd, 0x26,
+    0xf0, 0x05, 0x44, 0x10, 0x01, 0x14, 0xdd, 0x27, 0xf0, 0x05, 0x46, 0x20, 0x04, 0x08, 0x58, 0x21,
+    0x02, 0x95, 0x44, 0x10, 0x01, 0x14, 0xdd, 0x26, 0xf0, 0x05, 0x44, 0x10, 0x01, 0x30, 0xdd, 0x27,
+    0xf0, 0x05, 0x46, 0x20, 0xa8, 0x90, 0x58, 0x21, 0x03, 0xbc, 0x44, 0x10, 0x01, 0x30, 0xdd, 0x26,
+    0xf0, 0x05, 0x44, 0x10, 0x02, 0x10, 0xdd, 0x27, 0xf0, 0x05, 0x44, 0x20, 0xb8, 0xb8, 0x44, 0x10,
+    0x02, 0x10, 0xdd, 0x26, 0x46, 0x40, 0x04, 0x10, 0x84, 0xa8, 0x14, 0x52, 0x01, 0x48, 0x44, 0x10,
+    0x02, 0x0c, 0xf0, 0x05, 0x46, 0x90, 0x00, 0x87, 0x58, 0x94, 0x8f, 0x24, 0xdd, 0x27, 0xf0, 0x05,
+    0x46, 0x20, 0x04, 0xf0, 0x44, 0x10, 0x02, 0x0c, 0xdd, 0x26, 0xf0, 0x05, 0x44, 0x10, 0x02, 0x00,
+    0xdd, 0x27, 0xf0, 0x05, 0x46, 0x20, 0x50, 0x80, 0x58, 0x21, 0x04, 0x0f, 0x44, 0x10, 0x02, 0x00,
+    0xdd, 0x26, 0x84, 0xe0, 0x50, 0x6f, 0x80, 0xc0, 0x46, 0x80, 0x00, 0x87, 0x58, 0x84, 0x0f, 0x04,
+    0xf0, 0x05, 0x44, 0x10, 0x02, 0x00, 0x80, 0x46, 0x4b, 0xe0, 0x24, 0x01, 0xf1, 0x30, 0x9d, 0xf9,
+    0x54, 0x10, 0x84, 0x00, 0x97, 0xf9, 0x84, 0x05, 0xc1, 0x06, 0x4b, 0xe0, 0x20, 0x01, 0x44, 0x50,
+    0x03, 0xe8, 0xdf, 0xef, 0x46, 0x40, 0x04, 0x10, 0x84, 0xa2, 0x14, 0x52, 0x01, 0x48, 0xd5, 0x7d,
+    0xf0, 0x05, 0xf1, 0x07, 0x46, 0x90, 0x00, 0x87, 0x58, 0x94, 0x8f, 0x24, 0xdd, 0x27, 0xf1, 0x07,
+    0xf0, 0x05, 0x46, 0x2a, 0x00, 0x56, 0x58, 0x21, 0x0e, 0x53, 0xdd, 0x26, 0xf0, 0x05, 0x44, 0x10,
+    0x00, 0x10, 0xdd, 0x27, 0xf0, 0x05, 0x46, 0x23, 0x80, 0x70, 0x58, 0x21, 0x00, 0x06, 0x44, 0x10,
+    0x00, 0x10, 0xdd, 0x26, 0xf0, 0x05, 0x44, 0x10, 0x01, 0x14, 0xdd, 0x27, 0xf0, 0x05, 0x46, 0x20,
+    0x04, 0x08, 0x58, 0x21, 0x02, 0x95, 0x44, 0x10, 0x01, 0x14, 0xdd, 0x26, 0xf0, 0x05, 0x44, 0x10,
+    0x01, 0x30, 0xdd, 0x27, 0xf0, 0x05, 0x46, 0x20, 0xa8, 0x90, 0x58, 0x21, 0x03, 0xbc, 0x44, 0x10,
+    0x01, 0x30, 0xdd, 0x26, 0xf0, 0x05, 0x44, 0x10, 0x02, 0x10, 0xdd, 0x27, 0xf0, 0x05, 0x44, 0x20,
+    0xa4, 0xa4, 0x44, 0x10, 0x02, 0x10, 0xdd, 0x26, 0x46, 0x40, 0x04, 0x10, 0x84, 0xa8, 0x14, 0x52,
+    0x01, 0x48, 0x44, 0x10, 0x02, 0x0c, 0xf0, 0x05, 0x46, 0x80, 0x00, 0x87, 0x58, 0x84, 0x0f, 0x04,
+    0xdd, 0x27, 0xf0, 0x05, 0x46, 0x20, 0x04, 0xf0, 0x44, 0x10, 0x02, 0x0c, 0xdd, 0x26, 0xf0, 0x05,
+    0x44, 0x10, 0x02, 0x00, 0xdd, 0x27, 0xf0, 0x05, 0x46, 0x20, 0x50, 0x80, 0x58, 0x21, 0x04, 0x0f,
+    0x44, 0x10, 0x02, 0x00, 0xdd, 0x26, 0xf7, 0x07, 0x50, 0x6f, 0x80, 0xc0, 0xf0, 0x05, 0x44, 0x10,
+    0x02, 0x00, 0x80, 0x46, 0x4b, 0xe0, 0x24, 0x01, 0xf1, 0x30, 0x9d, 0xf9, 0x54, 0x10, 0x84, 0x00,
+    0x97, 0xf9, 0x84, 0x05, 0xc1, 0x06, 0x4b, 0xe0, 0x20, 0x01, 0x44, 0x50, 0x03, 0xe8, 0xdf, 0xef,
+    0x46, 0x40, 0x04, 0x10, 0x84, 0xa2, 0x14, 0x52, 0x01, 0x48, 0x84, 0x20, 0xf0, 0x05, 0x46, 0xf0,
+    0x00, 0x88, 0x58, 0xf7, 0x8f, 0x9c, 0xdd, 0x2f, 0x46, 0x00, 0x04, 0x12, 0x46, 0x60, 0x00, 0x88,
+    0x58, 0x63, 0x00, 0x80, 0x58, 0x00, 0x00, 0x88, 0xdd, 0x26, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00,
+    0x03, 0x00, 0xdd, 0x26, 0x46, 0x40, 0x04, 0x12, 0x84, 0xe0, 0x85, 0x21, 0x81, 0x04, 0x14, 0x92,
+    0x00, 0x04, 0xa9, 0xe4, 0x80, 0xa4, 0x84, 0x82, 0x14, 0x44, 0x00, 0x22, 0x44, 0x40, 0x74, 0x08,
+    0x14, 0x42, 0x80, 0xc0, 0x46, 0x00, 0x04, 0x11, 0x58, 0x00, 0x00, 0x04, 0xdd, 0x26, 0x46, 0x40,
+    0x04, 0x11, 0x58, 0x42, 0x00, 0x04, 0x84, 0xa8, 0xb6, 0xe4, 0xb6, 0xa4, 0xb6, 0xe4, 0x50, 0x02,
+    0x10, 0x7c, 0xdd, 0x26, 0x46, 0x40, 0x04, 0x12, 0x44, 0x53, 0x00, 0x01, 0x14, 0x52, 0x00, 0x20,
+    0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x00, 0x84, 0xdd, 0x26, 0x46, 0x40, 0x04, 0x12, 0x44, 0x52,
+    0x00, 0x00, 0x14, 0x52, 0x00, 0x21, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x07, 0x18, 0xdd, 0x26,
+    0x46, 0x40, 0x04, 0x12, 0x46, 0x54, 0x00, 0x02, 0x58, 0x52, 0x81, 0x01, 0x14, 0x52, 0x01, 0xc6,
+    0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x07, 0x3c, 0xdd, 0x26, 0x46, 0x40, 0x04, 0x12, 0x46, 0x58,
+    0x00, 0x00, 0x14, 0x52, 0x01, 0xcf, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x07, 0x14, 0xdd, 0x26,
+    0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x09, 0x34, 0xdd, 0x26, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00,
+    0x07, 0x04, 0xdd, 0x26, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x09, 0x80, 0xdd, 0x26, 0xf3, 0x05,
+    0x46, 0x08, 0x00, 0x00, 0x40, 0xa1, 0xf8, 0x08, 0x58, 0x00, 0x00, 0x12, 0x46, 0x90, 0x04, 0x12,
+    0x81, 0x09, 0x80, 0xa8, 0x46, 0x64, 0x80, 0x20, 0x59, 0xc1, 0x80, 0x80, 0x40, 0xa5, 0x00, 0x04,
+    0x58, 0x63, 0x00, 0x0c, 0x80, 0x85, 0x15, 0xc4, 0x81, 0xc5, 0x14, 0xa4, 0x02, 0x4d, 0x14, 0x62,
+    0x82, 0x60, 0x44, 0x50, 0x00, 0x60, 0x14, 0x52, 0x03, 0x04, 0x04, 0x62, 0x03, 0x05, 0x80, 0xa4,
+    0x58, 0x63, 0x00, 0x0c, 0x14, 0x62, 0x03, 0x05, 0x44, 0x41, 0x00, 0x00, 0x14, 0x42, 0x81, 0xc0,
+    0x84, 0x05, 0x46, 0x60, 0x00, 0x87, 0x58, 0x63, 0x0f, 0x04, 0x4b, 0xe0, 0x18, 0x01, 0xf1, 0x06,
+    0x46, 0x00, 0x92, 0xf5, 0x40, 0x30, 0xf0, 0x08, 0x58, 0x00, 0x09, 0x04, 0x9e, 0x42, 0x46, 0x50,
+    0x04, 0x12, 0x40, 0x01, 0x80, 0x04, 0x40, 0x11, 0x84, 0x04, 0x58, 0x52, 0x87, 0x74, 0xf0, 0x8a,
+    0xf7, 0x88, 0xf1, 0x8b, 0xf5, 0x86, 0x50, 0x4f, 0x80, 0x34, 0x50, 0x5f, 0x80, 0xa0, 0xf3, 0x07,
+    0x4e, 0x32, 0x01, 0x9f, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x77, 0x8b, 0xa8, 0x46, 0x60, 0x00, 0x5a,
+    0x58, 0x63, 0x03, 0x84, 0x4e, 0x73, 0x00, 0xcb, 0xf5, 0x84, 0xf4, 0x83, 0x80, 0x05, 0x50, 0x1f,
+    0x80, 0xb8, 0x84, 0x46, 0xdd, 0x26, 0xf0, 0x03, 0x50, 0x1f, 0x80, 0x7c, 0x44, 0x20, 0x00, 0x18,
+    0xdd, 0x26, 0x46, 0x80, 0x04, 0x12, 0x04, 0xaf, 0x80, 0x05, 0x05, 0xcf, 0x80, 0x09, 0xf5, 0x04,
+    0xf4, 0x03, 0x46, 0x90, 0x00, 0x87, 0x58, 0x94, 0x8f, 0x88, 0x4f, 0xc3, 0x00, 0x23, 0x38, 0x22,
+    0x9c, 0x00, 0x44, 0x11, 0x01, 0x00, 0xf4, 0x83, 0xf5, 0x84, 0x94, 0x94, 0x40, 0x21, 0x04, 0x04,
+    0x80, 0x0a, 0x44, 0x10, 0x02, 0x44, 0x4b, 0xe0, 0x24, 0x01, 0xf4, 0x03, 0x46, 0x00, 0x92, 0xf5,
+    0x38, 0x32, 0x1e, 0x02, 0x40, 0x23, 0xf0, 0x08, 0x46, 0x10, 0x04, 0x12, 0x58, 0x00, 0x09, 0x02,
+    0x40, 0x21, 0x00, 0x04, 0x14, 0x34, 0x01, 0xc1, 0x14, 0x20, 0x81, 0xda, 0xf5, 0x04, 0xd5, 0x15,
+    0xf4, 0x83, 0xf5, 0x84, 0x44, 0x10, 0x02, 0x44, 0x44, 0x21, 0x01, 0x80, 0x80, 0x0a, 0x4b, 0xe0,
+    0x24, 0x01, 0x44, 0x10, 0x0a, 0x0a, 0x14, 0x14, 0x01, 0xc1, 0x46, 0x20, 0x04, 0x12, 0xf1, 0x0b,
+    0x14, 0x11, 0x01, 0xda, 0xf5, 0x04, 0xf4, 0x03, 0x84, 0xc0, 0x44, 0x00, 0x01, 0xf4, 0xf4, 0x83,
+    0xf5, 0x84, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0xf1, 0x06, 0x9d, 0xb1,
+    0xb4, 0x01, 0x97, 0xb1, 0x54, 0x00, 0x00, 0x08, 0xf4, 0x03, 0xf5, 0x04, 0xc0, 0x05, 0x44, 0x30,
+    0x27, 0x10, 0x4c, 0x61, 0xff, 0xec, 0x84, 0x05, 0xf4, 0x83, 0xf5, 0x84, 0x46, 0x60, 0x04, 0x12,
+    0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x46, 0x10, 0x92, 0xf5, 0x58, 0x10,
+    0x89, 0x00, 0x58, 0x63, 0x07, 0x68, 0xb6, 0x26, 0x84, 0x05, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7,
+    0x8f, 0x04, 0xdd, 0x2f, 0xf4, 0x03, 0xf5, 0x04, 0x4f, 0xc3, 0x00, 0x0c, 0x46, 0x00, 0x92, 0xf5,
+    0x40, 0x13, 0xf0, 0x08, 0x58, 0x00, 0x09, 0x04, 0x40, 0x10, 0x80, 0x04, 0xb6, 0x26, 0xd5, 0x04,
+    0xf1, 0x0a, 0x84, 0xea, 0xb6, 0x26, 0x84, 0xc0, 0x44, 0x00, 0x01, 0xf4, 0xf4, 0x83, 0xf5, 0x84,
+    0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0xf1, 0x06, 0x9d, 0xb1, 0xb4, 0x01,
+    0x97, 0xb1, 0x54, 0x00, 0x00, 0x08, 0xf4, 0x03, 0xf5, 0x04, 0xc0, 0x05, 0x44, 0x30, 0x27, 0x10,
+    0x4c, 0x61, 0xff, 0xec, 0x84, 0x05, 0xf4, 0x83, 0xf5, 0x84, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7,
+    0x8f, 0x04, 0xdd, 0x2f, 0x46, 0x20, 0x04, 0x12, 0x46, 0x10, 0x92, 0xf5, 0x58, 0x10, 0x89, 0x00,
+    0x80, 0x62, 0x14, 0x11, 0x01, 0xda, 0x84, 0x21, 0xa8, 0x5c, 0x84, 0x20, 0xa8, 0x5c, 0x84, 0x05,
+    0x9d, 0xf9, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0xf4, 0x03, 0xf5, 0x04,
+    0xe6, 0xe6, 0x4e, 0xf3, 0xff, 0x54, 0x48, 0x00, 0x01, 0xc3, 0xf5, 0x84, 0xf4, 0x83, 0x80, 0x05,
+    0x50, 0x1f, 0x80, 0xb0, 0x84, 0x46, 0xdd, 0x26, 0xf0, 0x03, 0x50, 0x1f, 0x80, 0x64, 0x44, 0x20,
+    0x00, 0x18, 0xdd, 0x26, 0x46, 0x80, 0x04, 0x12, 0x04, 0xaf, 0x80, 0x05, 0x05, 0xcf, 0x80, 0x09,
+    0xf5, 0x04, 0xf4, 0x03, 0x84, 0xe0, 0x46, 0x90, 0x00, 0x87, 0x58, 0x94, 0x8f, 0x88, 0x4f, 0xc3,
+    0x00, 0x23, 0x38, 0x22, 0x9c, 0x00, 0x44, 0x11, 0x01, 0x00, 0xf4, 0x83, 0xf5, 0x84, 0x94, 0x94,
+    0x40, 0x21, 0x04, 0x04, 0x80, 0x0a, 0x44, 0x10, 0x02, 0x44, 0x4b, 0xe0, 0x24, 0x01, 0xf4, 0x03,
+    0x46, 0x00, 0x92, 0xf5, 0x38, 0x32, 0x1e, 0x02, 0x40, 0x23, 0xf0, 0x08, 0x46, 0x10, 0x04, 0x12,
+    0x58, 0x00, 0x09, 0x02, 0x40, 0x21, 0x00, 0x04, 0x14, 0x34, 0x01, 0xc1, 0x14, 0x20, 0x81, 0xda,
+    0xf5, 0x04, 0xd5, 0x15, 0xf4, 0x83, 0xf5, 0x84, 0x44, 0x10, 0x02, 0x44, 0x44, 0x21, 0x01, 0x80,
+    0x80, 0x0a, 0x4b, 0xe0, 0x24, 0x01, 0x44, 0x10, 0x0a, 0x0a, 0x14, 0x14, 0x01, 0xc1, 0x46, 0x20,
+    0x04, 0x12, 0xf1, 0x0b, 0x14, 0x11, 0x01, 0xda, 0xf5, 0x04, 0xf4, 0x03, 0x84, 0xc0, 0x44, 0x00,
+    0x01, 0xf4, 0xf4, 0x83, 0xf5, 0x84, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f,
+    0xf1, 0x06, 0x9d, 0xb1, 0xb4, 0x01, 0x97, 0xb1, 0x54, 0x00, 0x00, 0x08, 0xf4, 0x03, 0xf5, 0x04,
+    0xc0, 0x05, 0x44, 0x30, 0x27, 0x10, 0x4c, 0x61, 0xff, 0xec, 0x84, 0x05, 0xf4, 0x83, 0xf5, 0x84,
+    0x46, 0x60, 0x04, 0x12, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x46, 0x10,
+    0x92, 0xf5, 0x58, 0x10, 0x89, 0x00, 0x58, 0x63, 0x07, 0x68, 0xb6, 0x26, 0x84, 0x05, 0x46, 0xf0,
+    0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0xf4, 0x03, 0xf5, 0x04, 0x4f, 0xc3, 0x00, 0x0c,
+    0x46, 0x00, 0x92, 0xf5, 0x40, 0x13, 0xf0, 0x08, 0x58, 0x00, 0x09, 0x04, 0x40, 0x10, 0x80, 0x04,
+    0xb6, 0x26, 0xd5, 0x04, 0xf1, 0x0a, 0x84, 0xea, 0xb6, 0x26, 0x84, 0xc0, 0x44, 0x00, 0x01, 0xf4,
+    0xf4, 0x83, 0xf5, 0x84, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0xf1, 0x06,
+    0x9d, 0xb1, 0xb4, 0x01, 0x97, 0xb1, 0x54, 0x00, 0x00, 0x08, 0xf4, 0x03, 0xf5, 0x04, 0xc0, 0x05,
+    0x44, 0x30, 0x27, 0x10, 0x4c, 0x61, 0xff, 0xec, 0x84, 0x05, 0xf4, 0x83, 0xf5, 0x84, 0x46, 0xf0,
+    0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x46, 0x20, 0x04, 0x12, 0x46, 0x10, 0x92, 0xf5,
+    0x58, 0x10, 0x89, 0x00, 0x80, 0x62, 0x14, 0x11, 0x01, 0xda, 0x84, 0x21, 0xa8, 0x5c, 0x84, 0x20,
+    0xa8, 0x5c, 0x84, 0x05, 0x9d, 0xf9, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f,
+    0xf4, 0x03, 0xf5, 0x04, 0xe6, 0xe6, 0x4e, 0xf3, 0xff, 0x54, 0x48, 0x00, 0x00, 0xf9, 0x46, 0xf0,
+    0x01, 0x12, 0x00, 0x17, 0x8b, 0xa9, 0x46, 0x60, 0x00, 0x5a, 0x58, 0x63, 0x03, 0x84, 0xc9, 0x78,
+    0xf5, 0x84, 0xf4, 0x83, 0x80, 0x05, 0x50, 0x1f, 0x80, 0xa8, 0x84, 0x46, 0xdd, 0x26, 0xf0, 0x03,
+    0x50, 0x1f, 0x80, 0x4c, 0x44, 0x20, 0x00, 0x18, 0xdd, 0x26, 0xf4, 0x03, 0x47, 0xc0, 0x04, 0x12,
+    0x46, 0x80, 0x04, 0x12, 0x04, 0x9f, 0x80, 0x07, 0xf5, 0x04, 0x58, 0x84, 0x07, 0x68, 0x81, 0x44,
+    0x38, 0x22, 0xa4, 0x00, 0x44, 0x11, 0x01, 0x00, 0xf0, 0x05, 0x94, 0x94, 0x40, 0x21, 0x04, 0x04,
+    0x44, 0x10, 0x02, 0x44, 0xf4, 0x83, 0xf5, 0x84, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x88,
+    0xdd, 0x2f, 0x46, 0x00, 0x92, 0xf5, 0xb4, 0x6a, 0x40, 0x74, 0xf0, 0x08, 0x58, 0x00, 0x09, 0x02,
+    0x40, 0x13, 0x80, 0x04, 0x14, 0x3e, 0x01, 0xc1, 0xb6, 0x28, 0x84, 0xc0, 0xf5, 0x04, 0xf4, 0x03,
+    0xf1, 0x06, 0x9d, 0xb1, 0xb4, 0x01, 0x97, 0xb1, 0x54, 0x10, 0x00, 0x08, 0x84, 0x05, 0xc1, 0x0e,
+    0xf4, 0x83, 0xf5, 0x84, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x44, 0x00,
+    0x03, 0xe8, 0xf4, 0x03, 0xf5, 0x04, 0x4c, 0x60, 0x7f, 0xed, 0x46, 0x30, 0x92, 0xf5, 0x58, 0x31,
+    0x89, 0x04, 0x9e, 0x5c, 0x40, 0x23, 0x8c, 0x04, 0xb6, 0x28, 0xb6, 0x48, 0x84, 0xc0, 0xf1, 0x06,
+    0x9d, 0xb1, 0xb4, 0x01, 0x97, 0xb1, 0x54, 0x10, 0x00, 0x08, 0x84, 0x05, 0xc1, 0x0e, 0xf4, 0x83,
+    0xf5, 0x84, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x44, 0x00, 0x03, 0xe8,
+    0xf4, 0x03, 0xf5, 0x04, 0x4c, 0x60, 0x7f, 0xed, 0x46, 0x10, 0x92, 0xf5, 0x58, 0x10, 0x89, 0x00,
+    0xb6, 0x28, 0x8d, 0x21, 0x84, 0x26, 0x8d, 0x44, 0x4c, 0x90, 0xff, 0xa4, 0xd5, 0x78, 0xf5, 0x84,
+    0xf4, 0x83, 0x80, 0x05, 0x50, 0x1f, 0x80, 0xc4, 0x84, 0x43, 0xdd, 0x26, 0xf0, 0x03, 0x50, 0x1f,
+    0x80, 0x94, 0x84, 0x4c, 0xdd, 0x26, 0xf4, 0x03, 0x47, 0xc0, 0x04, 0x12, 0x46, 0x80, 0x04, 0x12,
+    0x04, 0x9f, 0x80, 0x07, 0xf5, 0x04, 0x58, 0x84, 0x07, 0x68, 0x81, 0x44, 0x38, 0x22, 0xa4, 0x00,
+    0x44, 0x31, 0x01, 0x00, 0xf0, 0x05, 0x94, 0x94, 0x40, 0x21, 0x0c, 0x04, 0x44, 0x10, 0x02, 0x44,
+    0xf4, 0x83, 0xf5, 0x84, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x88, 0xdd, 0x2f, 0x50, 0x14,
+    0x80, 0x03, 0x46, 0x00, 0x92, 0xf5, 0xb4, 0x6a, 0x40, 0x70, 0xf0, 0x08, 0x58, 0x00, 0x09, 0x02,
+    0x40, 0x23, 0x80, 0x04, 0x14, 0x3e, 0x01, 0xc1, 0xb6, 0x48, 0x84, 0xc0, 0xf5, 0x04, 0xf4, 0x03,
+    0xf1, 0x06, 0x9d, 0xb1, 0xb4, 0x01, 0x97, 0xb1, 0x54, 0x10, 0x00, 0x08, 0x84, 0x05, 0xc1, 0x0e,
+    0xf4, 0x83, 0xf5, 0x84, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x44, 0x00,
+    0x03, 0xe8, 0xf4, 0x03, 0xf5, 0x04, 0x4c, 0x60, 0x7f, 0xed, 0x46, 0x30, 0x92, 0xf5, 0x58, 0x31,
+    0x89, 0x04, 0x9e, 0x9c, 0x40, 0x13, 0x8c, 0x04, 0xb6, 0x48, 0xb6, 0x28, 0x84, 0xc0, 0xf1, 0x06,
+    0x9d, 0xb1, 0xb4, 0x01, 0x97, 0xb1, 0x54, 0x10, 0x00, 0x08, 0x84, 0x05, 0xc1, 0x0e, 0xf4, 0x83,
+    0xf5, 0x84, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x44, 0x00, 0x03, 0xe8,
+    0xf4, 0x03, 0xf5, 0x04, 0x4c, 0x60, 0x7f, 0xed, 0x46, 0x10, 0x92, 0xf5, 0x58, 0x10, 0x89, 0x00,
+    0xb6, 0x28, 0x8d, 0x21, 0x84, 0x23, 0x8d, 0x44, 0x4c, 0x90, 0xff, 0xa2, 0xf3, 0x08, 0x84, 0x02,
+    0x9c, 0xd9, 0xf3, 0x88, 0x4c, 0x30, 0x7d, 0x65, 0x46, 0x80, 0x00, 0x88, 0x58, 0x84, 0x00, 0xac,
+    0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x80, 0x20, 0xdd, 0x2f, 0x4b, 0xe0, 0x20, 0x01, 0x46, 0x00,
+    0x04, 0x11, 0x58, 0x00, 0x00, 0x04, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x80, 0x80, 0xdd, 0x2f,
+    0x46, 0x10, 0x04, 0x11, 0x58, 0x10, 0x80, 0x04, 0x84, 0xe0, 0x84, 0x68, 0xb6, 0xe1, 0xb6, 0x61,
+    0xb6, 0xe1, 0x46, 0x60, 0x04, 0x12, 0x4b, 0xe0, 0x20, 0x01, 0x84, 0x01, 0xa8, 0x34, 0x46, 0xf0,
+    0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0xa9, 0xf4, 0xf1, 0x09, 0xc9, 0x23, 0xf3, 0x05,
+    0x84, 0xa1, 0xdb, 0x20, 0x46, 0x00, 0x04, 0x12, 0x04, 0x10, 0x01, 0xda, 0x46, 0xf0, 0x01, 0x19,
+    0x14, 0x17, 0x82, 0xa8, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x07, 0x80, 0x46, 0x30, 0x01, 0x19,
+    0x58, 0x31, 0x8a, 0xa0, 0x46, 0x5f, 0xfb, 0xed, 0xb4, 0x40, 0x98, 0x43, 0x58, 0x52, 0x88, 0x84,
+    0x98, 0x4d, 0xb6, 0x41, 0x46, 0x10, 0x04, 0x12, 0x9c, 0x04, 0x58, 0x10, 0x87, 0xd4, 0x4c, 0x00,
+    0xff, 0xef, 0xec, 0xcc, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc,
+    0xef, 0x0c, 0x46, 0x40, 0x01, 0x12, 0x58, 0x42, 0x00, 0xc0, 0x96, 0x00, 0x96, 0x48, 0x96, 0x90,
+    0xf0, 0x87, 0xf1, 0x88, 0xf2, 0x8a, 0x3a, 0x02, 0x08, 0x00, 0x50, 0x5f, 0x80, 0xcc, 0x46, 0x40,
+    0x01, 0x12, 0x58, 0x42, 0x00, 0xb8, 0x3a, 0x02, 0x84, 0x24, 0x50, 0x8f, 0x80, 0xd8, 0x46, 0x70,
+    0x01, 0x12, 0x58, 0x73, 0x80, 0xb0, 0x3a, 0x02, 0x04, 0x00, 0x96, 0xd8, 0x3a, 0x04, 0x04, 0x20,
+    0x46, 0x40, 0x01, 0x12, 0x58, 0x42, 0x00, 0x88, 0x3a, 0x03, 0x84, 0x00, 0x50, 0x7f, 0x80, 0x58,
+    0xae, 0xa8, 0xf3, 0x8b, 0xf0, 0xb8, 0x12, 0x14, 0x00, 0x06, 0x3a, 0x02, 0x0c, 0x04, 0x83, 0x87,
+    0x50, 0x5f, 0x80, 0x7c, 0x50, 0x6f, 0x80, 0x9c, 0x47, 0xe0, 0x01, 0x12, 0x59, 0xef, 0x00, 0x68,
+    0x3a, 0x0e, 0x0c, 0x24, 0x50, 0x0f, 0x80, 0xb4, 0x46, 0x70, 0x00, 0x87, 0x58, 0x73, 0x8f, 0xc4,
+    0x46, 0x80, 0x00, 0x87, 0x58, 0x84, 0x0f, 0x88, 0xf0, 0x81, 0x3a, 0x02, 0x0c, 0x04, 0xf5, 0x83,
+    0xf6, 0x82, 0x3a, 0x0e, 0x0c, 0x24, 0x46, 0x60, 0x00, 0x88, 0x58, 0x63, 0x00, 0x80, 0x46, 0xf0,
+    0x01, 0x12, 0x04, 0xa7, 0x80, 0x2b, 0x80, 0xbe, 0x3a, 0x02, 0x8c, 0x04, 0x40, 0x95, 0x40, 0x09,
+    0xb4, 0x84, 0x10, 0x9f, 0x80, 0xee, 0xb6, 0x9c, 0xf4, 0x03, 0x12, 0xaf, 0x80, 0x76, 0x3a, 0x02,
+    0x0c, 0x24, 0x3a, 0x02, 0x8c, 0x00, 0x3a, 0x02, 0x0c, 0x20, 0x46, 0x40, 0x01, 0x12, 0x58, 0x42,
+    0x00, 0x50, 0x3a, 0x02, 0x0c, 0x04, 0xf5, 0x02, 0x3a, 0x02, 0x8c, 0x24, 0x46, 0x30, 0x01, 0x12,
+    0x58, 0x31, 0x80, 0x44, 0x3a, 0x02, 0x04, 0x00, 0x3a, 0x02, 0x84, 0x20, 0x3a, 0x01, 0x88, 0x00,
+    0xf5, 0x01, 0x3a, 0x02, 0x88, 0x20, 0x44, 0x10, 0x02, 0x44, 0xf0, 0x07, 0xdd, 0x27, 0x46, 0x00,
+    0x04, 0x12, 0x58, 0x00, 0x07, 0x00, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00,
+    0x00, 0x04, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x40, 0x04, 0x12, 0x44, 0x50, 0x00, 0x42, 0xa9, 0x61,
+    0xf6, 0x08, 0xc6, 0x77, 0xf0, 0x07, 0x84, 0x20, 0xdd, 0x27, 0xf0, 0x07, 0x46, 0x2a, 0x00, 0x56,
+    0x58, 0x21, 0x06, 0x57, 0x84, 0x20, 0xdd, 0x28, 0xf0, 0x07, 0x44, 0x10, 0x00, 0x10, 0xdd, 0x27,
+    0xf0, 0x07, 0x46, 0x23, 0x80, 0x70, 0x58, 0x21, 0x00, 0x06, 0x44, 0x10, 0x00, 0x10, 0xdd, 0x28,
+    0xf0, 0x07, 0x44, 0x10, 0x01, 0x14, 0xdd, 0x27, 0xf0, 0x07, 0x46, 0x20, 0x04, 0x08, 0x58, 0x21,
+    0x02, 0x95, 0x44, 0x10, 0x01, 0x14, 0xdd, 0x28, 0xf0, 0x07, 0x44, 0x10, 0x01, 0x30, 0xdd, 0x27,
+    0xf0, 0x07, 0x46, 0x20, 0xab, 0x90, 0x58, 0x21, 0x03, 0xbc, 0x44, 0x10, 0x01, 0x30, 0xdd, 0x28,
+    0xf0, 0x07, 0x44, 0x10, 0x02, 0x10, 0xdd, 0x27, 0xf0, 0x07, 0x44, 0x20, 0xa8, 0xa8, 0x44, 0x10,
+    0x02, 0x10, 0xdd, 0x28, 0x46, 0x40, 0x04, 0x10, 0x84, 0xa8, 0x14, 0x52, 0x01, 0x48, 0x44, 0x10,
+    0x02, 0x0c, 0xf0, 0x07, 0x50, 0x6f, 0x80, 0xe8, 0xdd, 0x27, 0xf0, 0x07, 0x46, 0x20, 0x04, 0xf0,
+    0x44, 0x10, 0x02, 0x0c, 0xdd, 0x28, 0xf0, 0x07, 0x44, 0x10, 0x02, 0x00, 0xdd, 0x27, 0xf0, 0x07,
+    0x46, 0x20, 0x50, 0x80, 0x58, 0x21, 0x04, 0x0f, 0x44, 0x10, 0x02, 0x00, 0xdd, 0x28, 0x84, 0xe0,
+    0x46, 0x90, 0x00, 0x87, 0x58, 0x94, 0x8f, 0x24, 0x46, 0x80, 0x00, 0x87, 0x58, 0x84, 0x0f, 0x04,
+    0xf0, 0x07, 0x44, 0x10, 0x02, 0x00, 0x80, 0x46, 0x4b, 0xe0, 0x24, 0x01, 0xf1, 0x3a, 0x9d, 0xf9,
+    0x54, 0x10, 0x84, 0x00, 0x97, 0xf9, 0x84, 0x05, 0xc1, 0x06, 0x4b, 0xe0, 0x20, 0x01, 0x44, 0x50,
+    0x03, 0xe8, 0xdf, 0xef, 0x46, 0x40, 0x04, 0x10, 0x84, 0xa2, 0x14, 0x52, 0x01, 0x48, 0xd5, 0x7d,
+    0xf0, 0x07, 0xf1, 0x08, 0x50, 0x6f, 0x80, 0xe8, 0xdd, 0x27, 0xf1, 0x08, 0xf0, 0x07, 0x46, 0x2a,
+    0x00, 0x56, 0x58, 0x21, 0x0e, 0x53, 0xdd, 0x28, 0xf0, 0x07, 0x44, 0x10, 0x00, 0x10, 0xdd, 0x27,
+    0xf0, 0x07, 0x46, 0x23, 0x80, 0x70, 0x58, 0x21, 0x00, 0x06, 0x44, 0x10, 0x00, 0x10, 0xdd, 0x28,
+    0xf0, 0x07, 0x44, 0x10, 0x01, 0x14, 0xdd, 0x27, 0xf0, 0x07, 0x46, 0x20, 0x04, 0x08, 0x58, 0x21,
+    0x02, 0x95, 0x44, 0x10, 0x01, 0x14, 0xdd, 0x28, 0xf0, 0x07, 0x44, 0x10, 0x01, 0x30, 0xdd, 0x27,
+    0xf0, 0x07, 0x46, 0x20, 0xa8, 0x90, 0x58, 0x21, 0x03, 0xbc, 0x44, 0x10, 0x01, 0x30, 0xdd, 0x28,
+    0xf0, 0x07, 0x44, 0x10, 0x02, 0x10, 0xdd, 0x27, 0xf0, 0x07, 0x44, 0x20, 0xb8, 0xb8, 0x44, 0x10,
+    0x02, 0x10, 0xdd, 0x28, 0x46, 0x40, 0x04, 0x10, 0x84, 0xa8, 0x14, 0x52, 0x01, 0x48, 0x44, 0x10,
+    0x02, 0x0c, 0xf0, 0x07, 0x46, 0x90, 0x00, 0x87, 0x58, 0x94, 0x8f, 0x24, 0xdd, 0x27, 0xf0, 0x07,
+    0x46, 0x20, 0x04, 0xf0, 0x44, 0x10, 0x02, 0x0c, 0xdd, 0x28, 0xf0, 0x07, 0x44, 0x10, 0x02, 0x00,
+    0xdd, 0x27, 0xf0, 0x07, 0x46, 0x20, 0x50, 0x80, 0x58, 0x21, 0x04, 0x0f, 0x44, 0x10, 0x02, 0x00,
+    0xdd, 0x28, 0xf7, 0x08, 0x46, 0x80, 0x00, 0x87, 0x58, 0x84, 0x0f, 0x04, 0xf0, 0x07, 0x44, 0x10,
+    0x02, 0x00, 0x80, 0x46, 0x4b, 0xe0, 0x24, 0x01, 0xf1, 0x3a, 0x9d, 0xf9, 0x54, 0x10, 0x84, 0x00,
+    0x97, 0xf9, 0x84, 0x05, 0xc1, 0x06, 0x4b, 0xe0, 0x20, 0x01, 0x44, 0x50, 0x03, 0xe8, 0xdf, 0xef,
+    0x46, 0x40, 0x04, 0x10, 0x84, 0xa2, 0x14, 0x52, 0x01, 0x48, 0x84, 0x21, 0xf0, 0x07, 0x46, 0xf0,
+    0x00, 0x88, 0x58, 0xf7, 0x8f, 0x9c, 0xdd, 0x2f, 0x46, 0x40, 0x04, 0x12, 0x84, 0x60, 0x84, 0xa1,
+    0xa9, 0x64, 0x46, 0x00, 0x04, 0x12, 0xa8, 0xe4, 0xf3, 0x85, 0x46, 0x70, 0x00, 0x88, 0x58, 0x73,
+    0x80, 0x80, 0x58, 0x00, 0x00, 0x88, 0xdd, 0x27, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x03, 0x00,
+    0x46, 0x80, 0x04, 0x12, 0x81, 0x20, 0xdd, 0x27, 0x84, 0xc2, 0x44, 0x20, 0x74, 0x08, 0x14, 0x64,
+    0x00, 0x22, 0x46, 0x00, 0x04, 0x11, 0xb6, 0x49, 0x58, 0x00, 0x00, 0x04, 0xdd, 0x27, 0x46, 0x00,
+    0x04, 0x12, 0x58, 0x00, 0x07, 0x04, 0xdd, 0x27, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x00, 0x80,
+    0xdd, 0x27, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x00, 0x84, 0xdd, 0x27, 0x46, 0x50, 0x04, 0x12,
+    0xf5, 0x89, 0xf3, 0x05, 0xf0, 0x09, 0x46, 0x40, 0x04, 0x11, 0x58, 0x42, 0x00, 0x04, 0x84, 0x48,
+    0x58, 0x00, 0x00, 0x80, 0xf0, 0x89, 0xb6, 0x64, 0xb6, 0x44, 0xb6, 0x64, 0x14, 0x64, 0x00, 0x22,
+    0x44, 0x60, 0x74, 0x08, 0xb6, 0xc9, 0x44, 0x03, 0x00, 0x01, 0xf6, 0x09, 0x83, 0xc5, 0x83, 0x85,
+    0x46, 0xa4, 0x00, 0x02, 0x46, 0x18, 0x00, 0x00, 0xb6, 0x06, 0xb6, 0x64, 0xb6, 0x44, 0xb6, 0x64,
+    0x44, 0x42, 0x00, 0x00, 0x58, 0xa5, 0x01, 0x01, 0x14, 0x4f, 0x00, 0x21, 0x46, 0x00, 0x04, 0x12,
+    0x14, 0xae, 0x01, 0xc6, 0x14, 0x12, 0x81, 0xcf, 0xf2, 0x86, 0xf3, 0x85, 0x58, 0x00, 0x07, 0x14,
+    0xdd, 0x27, 0x46, 0x00, 0x04, 0x12, 0x58, 0x00, 0x09, 0x34, 0xdd, 0x27, 0xf0, 0x07, 0x46, 0x18,
+    0x00, 0x00, 0x46, 0x90, 0x04, 0x12, 0x40, 0xa0, 0x78, 0x08, 0x81, 0x09, 0x80, 0xa8, 0x46, 0x74,
+    0x80, 0x10, 0x58, 0x10, 0x80, 0x12, 0x80, 0x85, 0x40, 0xa5, 0x04, 0x04, 0x58, 0x73, 0x80, 0x06,
+    0x59, 0xc0, 0x00, 0x80, 0x15, 0xc4, 0x81, 0xc5, 0x14, 0xa4, 0x02, 0x4d, 0x14, 0x72, 0x82, 0x60,
+    0x44, 0x51, 0x00, 0x00, 0x14, 0x52, 0x01, 0xc0, 0xf5, 0x08, 0xf2, 0x06, 0xf3, 0x05, 0x4e, 0x52,
+    0x01, 0x0a, 0xf0, 0x0b, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x47, 0x8b, 0xa8, 0x40, 0x60, 0x70, 0x08,
+    0x50, 0x8f, 0x80, 0xc0, 0x46, 0x70, 0x00, 0x5a, 0x58, 0x73, 0x83, 0x84, 0x50, 0x9f, 0x80, 0x34,
+    0xcc, 0x7d, 0xf4, 0x86, 0x50, 0x1f, 0x80, 0xcc, 0x84, 0x49, 0x80, 0x08, 0xdd, 0x27, 0x50, 0x1f,
+    0x80, 0x58, 0x80, 0x09, 0x44, 0x20, 0x00, 0x24, 0xdd, 0x27, 0x46, 0x10, 0x92, 0xf5, 0x58, 0x10,
+    0x89, 0x01, 0x40, 0x13, 0x04, 0x04, 0xf4, 0x06, 0x46, 0xa0, 0x04, 0x12, 0x83, 0x8a, 0xf1, 0x88,
+    0x80, 0xc4, 0x46, 0x80, 0x00, 0x87, 0x58, 0x84, 0x0f, 0x88, 0xf2, 0x0a, 0xca, 0x2e, 0x50, 0x3f,
+    0x80, 0xc0, 0x38, 0x21, 0x98, 0x00, 0x44, 0x51, 0x01, 0x00, 0xf0, 0x07, 0x94, 0x94, 0x40, 0x21,
+    0x14, 0x04, 0x44, 0x10, 0x02, 0x44, 0x4b, 0xe0, 0x20, 0x01, 0x38, 0x04, 0x9a, 0x02, 0x14, 0x05,
+    0x01, 0xc1, 0xe6, 0xc6, 0xe8, 0x0c, 0x46, 0x20, 0x92, 0xf5, 0x40, 0x03, 0x70, 0x08, 0x58, 0x21,
+    0x09, 0x01, 0x46, 0x10, 0x04, 0x12, 0x40, 0x00, 0x08, 0x04, 0xd5, 0x0c, 0x9c, 0x33, 0x46, 0x30,
+    0x92, 0xf5, 0x40, 0x00, 0x70, 0x08, 0x58, 0x31, 0x89, 0x01, 0x46, 0x10, 0x04, 0x12, 0x40, 0x00,
+    0x0c, 0x04, 0x14, 0x00, 0x81, 0xda, 0xd5, 0x13, 0xf0, 0x07, 0x44, 0x10, 0x02, 0x44, 0x44, 0x21,
+    0x01, 0x80, 0x4b, 0xe0, 0x20, 0x01, 0x44, 0x00, 0x04, 0x04, 0x14, 0x05, 0x01, 0xc1, 0x46, 0x10,
+    0x04, 0x12, 0xf5, 0x08, 0x14, 0x50, 0x81, 0xda, 0x44, 0x60, 0x00, 0x64, 0x84, 0xe0, 0x04, 0x1e,
+    0x01, 0xdd, 0x9d, 0xf9, 0x54, 0x10, 0x80, 0x08, 0x97, 0xf9, 0x84, 0x05, 0xc1, 0x09, 0x46, 0xf0,
+    0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x44, 0x50, 0x27, 0x10, 0xdf, 0xf1, 0x9d, 0xb1,
+    0x46, 0x10, 0x04, 0x12, 0x46, 0x20, 0x92, 0xf5, 0x58, 0x21, 0x09, 0x00, 0x97, 0xb1, 0x14, 0x20,
+    0x81, 0xda, 0xe6, 0xc9, 0xe9, 0xa3, 0x48, 0x00, 0x01, 0x2c, 0xf3, 0x85, 0x50, 0x1f, 0x80, 0xd8,
+    0x80, 0x08, 0xdd, 0x27, 0x80, 0x09, 0x50, 0x1f, 0x80, 0x7c, 0x44, 0x20, 0x00, 0x20, 0xdd, 0x27,
+    0x46, 0x50, 0x92, 0xf5, 0x58, 0x52, 0x89, 0x01, 0x40, 0x53, 0x14, 0x04, 0xf3, 0x05, 0x46, 0xa0,
+    0x04, 0x12, 0x83, 0x8a, 0xf5, 0x88, 0x80, 0xc3, 0x46, 0x80, 0x00, 0x87, 0x58, 0x84, 0x0f, 0x88,
+    0xf0, 0x0a, 0xc8, 0x2f, 0x50, 0x1f, 0x80, 0xc0, 0x38, 0x20, 0x98, 0x00, 0x44, 0x31, 0x01, 0x00,
+    0xf0, 0x07, 0x94, 0x94, 0x40, 0x21, 0x0c, 0x04, 0x44, 0x10, 0x02, 0x44, 0x4b, 0xe0, 0x20, 0x01,
+    0x38, 0x04, 0x9a, 0x02, 0x14, 0x05, 0x01, 0xc1, 0xe6, 0xc5, 0xe8, 0x0d, 0x9c, 0x31, 0x46, 0x50,
+    0x92, 0xf5, 0x40, 0x00, 0x70, 0x08, 0x58, 0x52, 0x89, 0x01, 0x46, 0x10, 0x04, 0x12, 0x40, 0x00,
+    0x14, 0x04, 0xd5, 0x0c, 0x9c, 0x34, 0x46, 0x20, 0x92, 0xf5, 0x40, 0x00, 0x70, 0x08, 0x58, 0x21,
+    0x09, 0x01, 0x46, 0x10, 0x04, 0x12, 0x40, 0x00, 0x08, 0x04, 0x14, 0x00, 0x81, 0xda, 0xd5, 0x13,
+    0xf0, 0x07, 0x44, 0x10, 0x02, 0x44, 0x44, 0x21, 0x01, 0x80, 0x4b, 0xe0, 0x20, 0x01, 0x44, 0x00,
+    0x04, 0x04, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char firmware5[] = {
+    0x78, 0x0d, 0x00, 0x10, 0x01, 0xc1, 0x46, 0x10, 0x04, 0x12, 0xf3, 0x08, 0x14, 0x30, 0x81, 0xda,
+    0x44, 0x60, 0x00, 0x64, 0x84, 0xe0, 0x04, 0x1e, 0x01, 0xdd, 0x9d, 0xf9, 0x54, 0x10, 0x80, 0x08,
+    0x97, 0xf9, 0x84, 0x05, 0xc1, 0x09, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f,
+    0x44, 0x50, 0x27, 0x10, 0xdf, 0xf1, 0x9d, 0xb1, 0x46, 0x10, 0x04, 0x12, 0x46, 0x20, 0x92, 0xf5,
+    0x58, 0x21, 0x09, 0x00, 0x97, 0xb1, 0x14, 0x20, 0x81, 0xda, 0xe6, 0xc8, 0xe9, 0xa2, 0x48, 0x00,
+    0x00, 0xb0, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x27, 0x8b, 0xa9, 0x50, 0x8f, 0x80, 0xc0, 0x46, 0x70,
+    0x00, 0x5a, 0x58, 0x73, 0x83, 0x84, 0x50, 0x9f, 0x80, 0x34, 0xca, 0x52, 0x50, 0x1f, 0x80, 0xe0,
+    0x84, 0x46, 0x80, 0x08, 0xdd, 0x27, 0x46, 0x30, 0x04, 0x12, 0xf3, 0x89, 0x80, 0x09, 0x50, 0x1f,
+    0x80, 0x9c, 0x44, 0x20, 0x00, 0x18, 0xdd, 0x27, 0xf5, 0x09, 0x46, 0xa0, 0x04, 0x12, 0x58, 0x52,
+    0x87, 0x04, 0x83, 0x8a, 0xf6, 0x08, 0xf5, 0x89, 0x46, 0x80, 0x00, 0x87, 0x58, 0x84, 0x0f, 0x04,
+    0x50, 0x0f, 0x80, 0xc0, 0x38, 0x20, 0x18, 0x00, 0x44, 0x11, 0x01, 0x00, 0xf0, 0x07, 0x94, 0x94,
+    0x40, 0x21, 0x04, 0x04, 0x44, 0x10, 0x02, 0x44, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x88,
+    0xdd, 0x2f, 0x46, 0x50, 0x92, 0xf5, 0xb4, 0x49, 0xf0, 0x09, 0x40, 0x13, 0x70, 0x08, 0x58, 0x52,
+    0x89, 0x01, 0x40, 0x10, 0x94, 0x04, 0xb6, 0x40, 0x14, 0x15, 0x01, 0xda, 0x84, 0xe0, 0x04, 0x1e,
+    0x01, 0xdd, 0x9d, 0xf9, 0x54, 0x10, 0x80, 0x08, 0x97, 0xf9, 0x84, 0x05, 0xc1, 0x06, 0x4b, 0xe0,
+    0x20, 0x01, 0x44, 0x50, 0x27, 0x10, 0xdf, 0xf4, 0x46, 0x10, 0x92, 0xf5, 0x58, 0x10, 0x89, 0x00,
+    0x9d, 0xb1, 0x84, 0xa6, 0x14, 0x15, 0x01, 0xda, 0x8d, 0x24, 0xde, 0xcb, 0xd5, 0x51, 0x50, 0x1f,
+    0x80, 0xec, 0x84, 0x43, 0x80, 0x08, 0xdd, 0x27, 0x46, 0x30, 0x04, 0x12, 0xf3, 0x89, 0x80, 0x09,
+    0x50, 0x1f, 0x80, 0xb4, 0x84, 0x4c, 0xdd, 0x27, 0xf5, 0x09, 0x46, 0xa0, 0x04, 0x12, 0x58, 0x52,
+    0x87, 0x04, 0x83, 0x8a, 0xf6, 0x08, 0xf5, 0x89, 0x46, 0x80, 0x00, 0x87, 0x58, 0x84, 0x0f, 0x04,
+    0x50, 0x0f, 0x80, 0xc0, 0x38, 0x20, 0x18, 0x00, 0x44, 0x11, 0x01, 0x00, 0xf0, 0x07, 0x94, 0x94,
+    0x40, 0x21, 0x04, 0x04, 0x44, 0x10, 0x02, 0x44, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x88,
+    0xdd, 0x2f, 0x9c, 0x73, 0x46, 0x50, 0x92, 0xf5, 0xb4, 0x49, 0xf0, 0x09, 0x40, 0x10, 0xf0, 0x08,
+    0x58, 0x52, 0x89, 0x01, 0x40, 0x10, 0x94, 0x04, 0xb6, 0x40, 0x14, 0x15, 0x01, 0xda, 0x84, 0xe0,
+    0x04, 0x1e, 0x01, 0xdd, 0x9d, 0xf9, 0x54, 0x10, 0x80, 0x08, 0x97, 0xf9, 0x84, 0x05, 0xc1, 0x06,
+    0x4b, 0xe0, 0x20, 0x01, 0x44, 0x50, 0x27, 0x10, 0xdf, 0xf4, 0x46, 0x10, 0x92, 0xf5, 0x58, 0x10,
+    0x89, 0x00, 0x9d, 0xb1, 0x84, 0xa3, 0x14, 0x15, 0x01, 0xda, 0x8d, 0x24, 0xde, 0xca, 0x46, 0x00,
+    0x04, 0x12, 0x84, 0x21, 0xa8, 0x44, 0x84, 0x20, 0xa8, 0x44, 0x84, 0x05, 0x46, 0xf0, 0x00, 0x87,
+    0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x46, 0x00, 0x04, 0x12, 0x84, 0xe0, 0x14, 0x70, 0x02, 0x60,
+    0x46, 0x80, 0x00, 0x88, 0x58, 0x84, 0x00, 0xac, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x80, 0x20,
+    0xdd, 0x2f, 0x4b, 0xe0, 0x20, 0x01, 0x46, 0x00, 0x04, 0x11, 0x58, 0x00, 0x00, 0x04, 0x46, 0xf0,
+    0x00, 0x88, 0x58, 0xf7, 0x80, 0x80, 0xdd, 0x2f, 0x46, 0x00, 0x04, 0x11, 0x58, 0x00, 0x00, 0x04,
+    0x84, 0x28, 0xb6, 0xe0, 0xb6, 0x20, 0xb6, 0xe0, 0x46, 0x60, 0x04, 0x12, 0x4b, 0xe0, 0x20, 0x01,
+    0x84, 0x01, 0xa8, 0x34, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0xa9, 0xf4,
+    0xec, 0xf4, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x3a, 0x6f, 0xa0, 0xbc, 0x96, 0x49, 0x80, 0x40,
+    0xe6, 0x24, 0xe8, 0x04, 0x84, 0x01, 0x48, 0x00, 0x00, 0xea, 0x46, 0x40, 0x04, 0x12, 0x46, 0x60,
+    0x04, 0x11, 0x46, 0x38, 0x00, 0x08, 0x80, 0xa6, 0xb4, 0x20, 0x44, 0x7f, 0xf5, 0x7c, 0x04, 0x82,
+    0x00, 0x49, 0x14, 0x72, 0x00, 0x49, 0x14, 0x33, 0x00, 0x99, 0x14, 0x32, 0x80, 0x9a, 0x84, 0x66,
+    0x4c, 0x11, 0x80, 0x59, 0xe6, 0x27, 0xe8, 0x14, 0x84, 0x63, 0x4c, 0x11, 0x80, 0x35, 0xe6, 0x24,
+    0xe8, 0x08, 0x84, 0x41, 0x4c, 0x11, 0x00, 0x22, 0x84, 0x62, 0x4c, 0x11, 0xc0, 0xba, 0xd5, 0x24,
+    0x84, 0x04, 0x4c, 0x10, 0x00, 0x38, 0x84, 0x65, 0x4c, 0x11, 0xc0, 0xb3, 0xd5, 0x3a, 0x84, 0x0b,
+    0x4c, 0x10, 0x00, 0x79, 0xe6, 0x2c, 0xe8, 0x08, 0x84, 0x67, 0x4c, 0x11, 0x80, 0x4c, 0x84, 0x08,
+    0x4c, 0x10, 0x40, 0xa7, 0xd5, 0x58, 0x84, 0x6c, 0x4c, 0x11, 0x80, 0x82, 0x44, 0x00, 0x00, 0xff,
+    0x4c, 0x10, 0x40, 0x9f, 0x48, 0x00, 0x00, 0x8f, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x8f, 0x54,
+    0xdd, 0x2f, 0x48, 0x00, 0x00, 0x96, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x80, 0xec, 0xdd, 0x2f,
+    0x48, 0x00, 0x00, 0x8f, 0x9c, 0x84, 0xb4, 0xc2, 0x46, 0xf0, 0x00, 0x8a, 0x58, 0xf7, 0x81, 0x40,
+    0xdd, 0x2f, 0x96, 0x30, 0x46, 0xf0, 0x00, 0x89, 0x58, 0xf7, 0x89, 0x20, 0xdd, 0x2f, 0x48, 0x00,
+    0x00, 0x80, 0x9c, 0x94, 0xb4, 0xe2, 0x46, 0x60, 0x00, 0x88, 0x58, 0x63, 0x01, 0xb0, 0xd5, 0x5d,
+    0x9c, 0x94, 0xb4, 0x02, 0x96, 0x00, 0x46, 0xf0, 0x00, 0x88, 0x58, 0xf7, 0x8a, 0x28, 0xdd, 0x2f,
+    0xd5, 0x6f, 0x46, 0xf0, 0x00, 0x8a, 0x58, 0xf7, 0x81, 0x40, 0xdd, 0x2f, 0x46, 0x60, 0x00, 0x88,
+    0x58, 0x63, 0x0c, 0x44, 0x84, 0x00, 0x4b, 0xe0, 0x18, 0x01, 0x84, 0x01, 0x4b, 0xe0, 0x18, 0x01,
+    0xd5, 0x5f, 0x9c, 0x94, 0xb4, 0xe2, 0x46, 0xf0, 0x00, 0x8a, 0x58, 0xf7, 0x81, 0x40, 0xdd, 0x2f,
+    0x97, 0xf8, 0x84, 0x00, 0x80, 0x27, 0x80, 0x40, 0x80, 0x60, 0x46, 0x60, 0x00, 0x8d, 0x58, 0x63,
+    0x0a, 0x58, 0xd5, 0x11, 0x9c, 0x94, 0xb4, 0xe2, 0x46, 0xf0, 0x00, 0x8a, 0x58, 0xf7, 0x81, 0x40,
+    0xdd, 0x2f, 0x97, 0xf8, 0x84, 0x00, 0x80, 0x27, 0x80, 0x40, 0x80, 0x60, 0x46, 0x60, 0x00, 0x8d,
+    0x58, 0x63, 0x00, 0x18, 0xdd, 0x26, 0x84, 0x40, 0x80, 0x27, 0x84, 0x01, 0x80, 0x62, 0xdd, 0x26,
+    0xd5, 0x37, 0x46, 0x60, 0x04, 0x10, 0x58, 0x63, 0x00, 0x40, 0x9c, 0x94, 0xb4, 0x02, 0xb4, 0xe6,
+    0xb4, 0x26, 0x44, 0x2f, 0xff, 0x3f, 0x40, 0x10, 0x88, 0x02, 0xb6, 0x26, 0x96, 0x00, 0x46, 0xf0,
+    0x00, 0x8c, 0x58, 0xf7, 0x83, 0x34, 0xdd, 0x2f, 0xb6, 0xe6, 0xd5, 0x22, 0x9c, 0x94, 0xb4, 0xe2,
+    0x46, 0x60, 0x00, 0x89, 0x58, 0x63, 0x02, 0x38, 0x97, 0xf8, 0x46, 0xf0, 0x00, 0x8a, 0x58, 0xf7,
+    0x81, 0x40, 0xdd, 0x2f, 0x80, 0x27, 0x84, 0x00, 0xdd, 0x26, 0x80, 0x27, 0x84, 0x01, 0xdd, 0x26,
+    0xd5, 0x0f, 0x9c, 0x94, 0xb4, 0x02, 0xb4, 0x22, 0xb4, 0x42, 0x92, 0x28, 0x42, 0x00, 0x40, 0x0b,
+    0x96, 0x48, 0x96, 0x94, 0x46, 0xf0, 0x00, 0x8a, 0x58, 0xf7, 0x81, 0x90, 0xdd, 0x2f, 0x46, 0x40,
+    0x04, 0x11, 0x80, 0x44, 0x46, 0x38, 0x00, 0x08, 0x46, 0x10, 0x04, 0x12, 0x84, 0x00, 0x14, 0x02,
+    0x00, 0x99, 0x14, 0x31, 0x00, 0x9a, 0x14, 0x80, 0x80, 0x49, 0x3a, 0x6f, 0xa0, 0x84, 0xdd, 0x9e,
+    0x3b, 0xff, 0xfc, 0xbc, 0xef, 0xf4, 0x84, 0x87, 0x96, 0xc0, 0x84, 0x28, 0x80, 0x1f, 0xb6, 0x9f,
+    0xf3, 0x81, 0x46, 0xf0, 0x00, 0x8e, 0x58, 0xf7, 0x82, 0x64, 0xdd, 0x2f, 0x44, 0x00, 0x03, 0xe8,
+    0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x84, 0x00, 0xec, 0x0c, 0x3b, 0xff,
+    0xfc, 0x84, 0xdd, 0x9e, 0x3b, 0xff, 0xfc, 0xbc, 0xef, 0xf4, 0x84, 0x68, 0x97, 0x00, 0x80, 0x23,
+    0x80, 0x1f, 0xf4, 0x81, 0xb6, 0x7f, 0x46, 0xf0, 0x00, 0x8e, 0x58, 0xf7, 0x82, 0x64, 0xdd, 0x2f,
+    0x44, 0x00, 0x03, 0xe8, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04, 0xdd, 0x2f, 0x84, 0x00,
+    0xec, 0x0c, 0x3b, 0xff, 0xfc, 0x84, 0xdd, 0x9e, 0x3b, 0xff, 0xfc, 0xbc, 0xef, 0xf4, 0x84, 0x8c,
+    0x96, 0xc0, 0x84, 0x28, 0x80, 0x1f, 0xb6, 0x9f, 0xf3, 0x81, 0x46, 0xf0, 0x00, 0x8e, 0x58, 0xf7,
+    0x82, 0x64, 0xdd, 0x2f, 0x44, 0x00, 0x03, 0xe8, 0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x8f, 0x04,
+    0xdd, 0x2f, 0x84, 0x00, 0xec, 0x0c, 0x3b, 0xff, 0xfc, 0x84, 0xdd, 0x9e, 0x3b, 0xff, 0xfc, 0xbc,
+    0xef, 0xf4, 0x84, 0x46, 0x50, 0x0f, 0x80, 0x04, 0x84, 0x24, 0xf2, 0x81, 0x46, 0xf0, 0x00, 0x8e,
+    0x58, 0xf7, 0x82, 0x64, 0xdd, 0x2f, 0x84, 0x00, 0xec, 0x0c, 0x3b, 0xff, 0xfc, 0x84, 0xdd, 0x9e,
+    0x3b, 0xff, 0xfc, 0xbc, 0xef, 0xf4, 0x84, 0x83, 0x96, 0xc0, 0x84, 0x28, 0x80, 0x1f, 0xb6, 0x9f,
+    0xf3, 0x81, 0x46, 0xf0, 0x00, 0x8e, 0x58, 0xf7, 0x82, 0x64, 0xdd, 0x2f, 0x84, 0x00, 0xec, 0x0c,
+    0x3b, 0xff, 0xfc, 0x84, 0xdd, 0x9e, 0x92, 0x00, 0x3a, 0x6f, 0xaa, 0xbc, 0xef, 0xfc, 0x46, 0x00,
+    0x04, 0x00, 0x46, 0x15, 0xc1, 0xfe, 0x58, 0x10, 0x8e, 0x80, 0x14, 0x10, 0x00, 0x47, 0x04, 0x20,
+    0x00, 0x4a, 0x44, 0x3f, 0x0f, 0xff, 0x40, 0x21, 0x0c, 0x02, 0x14, 0x20, 0x00, 0x4a, 0x80, 0x20,
+    0x04, 0x20, 0x80, 0x6e, 0x46, 0x4f, 0xff, 0x7f, 0x58, 0x42, 0x0f, 0xff, 0x40, 0x21, 0x10, 0x02,
+    0x14, 0x20, 0x80, 0x6e, 0x04, 0x10, 0x00, 0x6f, 0x46, 0x70, 0x01, 0x00, 0x40, 0x10, 0x90, 0x02,
+    0x14, 0x10, 0x00, 0x6f, 0x46, 0x80, 0x00, 0x00, 0x58, 0x84, 0x06, 0x3c, 0x46, 0xf0, 0x00, 0x87,
+    0x58, 0xf7, 0x88, 0x98, 0xdd, 0x2f, 0x04, 0x23, 0x80, 0x51, 0x84, 0x03, 0x84, 0x21, 0xdd, 0x22,
+    0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x80, 0x0c, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7,
+    0x89, 0xfc, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x8a, 0x40, 0xdd, 0x2f, 0x46, 0x10,
+    0x04, 0x10, 0x04, 0x20, 0x82, 0x01, 0x40, 0x21, 0x20, 0x08, 0x92, 0x48, 0x14, 0x20, 0x82, 0x01,
+    0x84, 0x0a, 0x84, 0x20, 0x4b, 0xe0, 0x20, 0x01, 0x46, 0x60, 0x00, 0x80, 0x58, 0x63, 0x0c, 0x1c,
+    0x84, 0x0c, 0x46, 0x10, 0x00, 0x80, 0x58, 0x10, 0x80, 0xf8, 0x4b, 0xe0, 0x18, 0x01, 0x84, 0x0d,
+    0x46, 0x10, 0x00, 0x80, 0x58, 0x10, 0x80, 0xa8, 0x4b, 0xe0, 0x18, 0x01, 0x84, 0x0f, 0x46, 0x10,
+    0x00, 0x85, 0x58, 0x10, 0x8f, 0x44, 0x4b, 0xe0, 0x18, 0x01, 0x84, 0x07, 0x84, 0x20, 0x4b, 0xe0,
+    0x20, 0x01, 0x46, 0x10, 0x00, 0x80, 0x58, 0x10, 0x82, 0x7c, 0x46, 0x20, 0x00, 0x8e, 0x58, 0x21,
+    0x0d, 0xa8, 0x46, 0x80, 0x00, 0x00, 0x58, 0x84, 0x07, 0xac, 0x84, 0x07, 0x4b, 0xe0, 0x20, 0x01,
+    0x46, 0x60, 0x00, 0x00, 0x58, 0x63, 0x06, 0x84, 0x84, 0x07, 0x4b, 0xe0, 0x18, 0x01, 0x46, 0x20,
+    0x00, 0x8e, 0x58, 0x21, 0x0d, 0xa8, 0x46, 0x10, 0x00, 0x80, 0x58, 0x10, 0x8b, 0x80, 0x84, 0x0a,
+    0x4b, 0xe0, 0x20, 0x01, 0x84, 0x0a, 0x4b, 0xe0, 0x18, 0x01, 0x84, 0x02, 0x46, 0xf0, 0x00, 0x81,
+    0x58, 0xf7, 0x80, 0x70, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x80, 0x88, 0xdd, 0x2f,
+    0x84, 0x00, 0x46, 0xf0, 0x00, 0x02, 0x58, 0xf7, 0x86, 0xd4, 0xdd, 0x2f, 0x80, 0x40, 0x46, 0xf0,
+    0x01, 0x12, 0x10, 0x27, 0x8b, 0xa3, 0x80, 0x20, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x03, 0x58, 0xf7,
+    0x81, 0x20, 0xdd, 0x2f, 0x46, 0x20, 0x00, 0x86, 0x58, 0x21, 0x00, 0x80, 0x46, 0xf0, 0x01, 0x0e,
+    0x14, 0x27, 0x80, 0xb0, 0x46, 0x00, 0x00, 0x86, 0x58, 0x00, 0x00, 0xd4, 0x46, 0xf0, 0x00, 0x57,
+    0x58, 0xf7, 0x82, 0xe0, 0xdd, 0x2f, 0x46, 0x20, 0x00, 0x86, 0x58, 0x21, 0x04, 0x00, 0x46, 0xf0,
+    0x01, 0x00, 0x14, 0x27, 0x80, 0x54, 0x46, 0x20, 0x00, 0x86, 0x58, 0x21, 0x02, 0x68, 0x46, 0xf0,
+    0x01, 0x00, 0x14, 0x27, 0x80, 0x42, 0x46, 0x60, 0x00, 0x34, 0x58, 0x63, 0x0f, 0x7c, 0x84, 0x01,
+    0x4b, 0xe0, 0x18, 0x01, 0x84, 0x45, 0x46, 0xf0, 0x01, 0x01, 0x14, 0x27, 0x81, 0xca, 0x84, 0x01,
+    0x4b, 0xe0, 0x18, 0x01, 0x04, 0x23, 0x80, 0x51, 0x84, 0x02, 0x84, 0x20, 0xdd, 0x22, 0x46, 0xf0,
+    0x00, 0x8b, 0x58, 0xf7, 0x8a, 0x7c, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x8a, 0x3c,
+    0xdd, 0x2f, 0x46, 0x00, 0x04, 0x00, 0x04, 0x20, 0x00, 0x8c, 0x80, 0x20, 0x58, 0x21, 0x00, 0x01,
+    0x14, 0x20, 0x00, 0x8c, 0x84, 0x00, 0x14, 0x00, 0x80, 0x8f, 0x46, 0x70, 0x01, 0x1b, 0x58, 0x73,
+    0x85, 0x80, 0x46, 0xf0, 0x00, 0x8c, 0x58, 0xf7, 0x81, 0x40, 0xdd, 0x2f, 0x47, 0xc0, 0x00, 0x81,
+    0x59, 0xce, 0x02, 0xb0, 0x46, 0xa0, 0x00, 0x84, 0x58, 0xa5, 0x04, 0x84, 0x84, 0x02, 0x46, 0xf0,
+    0x00, 0x02, 0x58, 0xf7, 0x8c, 0xf4, 0xdd, 0x2f, 0x80, 0xc0, 0x46, 0xf0, 0x00, 0x02, 0x58, 0xf7,
+    0x87, 0x3c, 0xdd, 0x2f, 0xa0, 0xb2, 0x44, 0x30, 0x00, 0x6d, 0x81, 0x00, 0x4c, 0x21, 0xc0, 0x1e,
+    0x46, 0xf0, 0x01, 0x12, 0x00, 0x07, 0x8b, 0x9c, 0x84, 0xa1, 0xd8, 0x0f, 0x46, 0x10, 0x04, 0x00,
+    0x04, 0x10, 0x80, 0x70, 0x54, 0x10, 0x88, 0x00, 0xc9, 0x08, 0x84, 0x04, 0x80, 0x41, 0x46, 0xf0,
+    0x00, 0x84, 0x58, 0xf7, 0x87, 0x14, 0xdd, 0x2f, 0x44, 0x10, 0x9c, 0x40, 0x40, 0x04, 0x04, 0x37,
+    0x46, 0x10, 0x04, 0x00, 0x14, 0x00, 0x80, 0x8e, 0xa1, 0x72, 0x44, 0x00, 0x00, 0x67, 0xd8, 0x16,
+    0x46, 0x80, 0x00, 0x86, 0x58, 0x84, 0x09, 0x64, 0x84, 0x00, 0x4b, 0xe0, 0x20, 0x01, 0x84, 0x21,
+    0x4c, 0x00, 0x80, 0x07, 0x80, 0x01, 0x4b, 0xe0, 0x20, 0x01, 0x84, 0xa1, 0xd8, 0x07, 0x84, 0x01,
+    0x46, 0xf0, 0x00, 0x87, 0x58, 0xf7, 0x85, 0x28, 0xdd, 0x2f, 0xa0, 0xf2, 0x44, 0x50, 0x00, 0x64,
+    0x4c, 0x32, 0xc1, 0xb6, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x07, 0x82, 0xdf, 0x84, 0xa1, 0x4c, 0x02,
+    0xc0, 0xf5, 0xa0, 0x33, 0x4e, 0x03, 0x00, 0xf2, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x17, 0x8b, 0xa2,
+    0xc9, 0x18, 0x46, 0x00, 0x04, 0x11, 0x04, 0x20, 0x00, 0x43, 0x58, 0x21, 0x01, 0x41, 0x14, 0x20,
+    0x00, 0x43, 0x00, 0x03, 0x8a, 0xc8, 0xd8, 0x76, 0x44, 0x20, 0x08, 0xc1, 0x46, 0x00, 0x01, 0x1a,
+    0x58, 0x00, 0x05, 0x78, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0xc4, 0xdd, 0x2f, 0xd5, 0x6a,
+    0x46, 0x00, 0x04, 0x11, 0x04, 0x00, 0x00, 0x44, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x17, 0x82, 0xf8,
+    0x46, 0xf0, 0x01, 0x12, 0x14, 0x07, 0x82, 0xf9, 0x4c, 0x00, 0xc0, 0x04, 0x84, 0x1f, 0xd5, 0x02,
+    0x9a, 0x01, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x27, 0x8b, 0xa2, 0x46, 0x10, 0x01, 0x1a, 0x58, 0x10,
+    0x8e, 0xa0, 0x9e, 0x91, 0x38, 0x30, 0x8a, 0x02, 0x84, 0x2c, 0x40, 0x40, 0x20, 0x08, 0x92, 0x88,
+    0x42, 0x11, 0x04, 0x24, 0x40, 0x31, 0xe0, 0x08, 0x98, 0xe3, 0x46, 0x40, 0x01, 0x1c, 0x58, 0x42,
+    0x00, 0x50, 0x98, 0x4c, 0xb6, 0x61, 0x84, 0x63, 0x46, 0x10, 0x04, 0x11, 0x42, 0x21, 0x0c, 0x24,
+    0x04, 0x40, 0x80, 0x4d, 0x46, 0x30, 0x01, 0x1c, 0x58, 0x31, 0x80, 0x50, 0x9c, 0x51, 0x38, 0x41,
+    0x86, 0x0a, 0x46, 0x10, 0x04, 0x11, 0x04, 0x10, 0x80, 0x50, 0x00, 0x43, 0x8a, 0xc8, 0x9c, 0x92,
+    0x84, 0xa1, 0x38, 0x11, 0x8a, 0x0a, 0xdc, 0x26, 0x46, 0x80, 0x01, 0x1a, 0x00, 0x24, 0x05, 0x78,
+    0x5c, 0xf1, 0x00, 0x20, 0xe8, 0x1f, 0x44, 0x30, 0x00, 0x64, 0x42, 0x10, 0x8c, 0x24, 0x46, 0x30,
+    0x01, 0x1a, 0x58, 0x31, 0x85, 0x79, 0x40, 0x10, 0x80, 0x17, 0x44, 0x00, 0x00, 0x46, 0x42, 0x21,
+    0x00, 0x24, 0x46, 0x00, 0x01, 0x19, 0x58, 0x00, 0x02, 0x90, 0x98, 0x93, 0x96, 0x48, 0x46, 0xf0,
+    0x00, 0x83, 0x58, 0xf7, 0x87, 0x20, 0xdd, 0x2f, 0x00, 0x04, 0x05, 0x78, 0x9c, 0x01, 0x10, 0x04,
+    0x05, 0x78, 0x46, 0x80, 0x01, 0x12, 0x84, 0x20, 0x00, 0x04, 0x0b, 0xcc, 0x80, 0x41, 0x46, 0xf0,
+    0x00, 0x8a, 0x58, 0xf7, 0x87, 0x50, 0xdd, 0x2f, 0x04, 0x04, 0x02, 0xf3, 0xe6, 0x0f, 0xe8, 0x08,
+    0x84, 0x00, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x85, 0x84, 0xdd, 0x2f, 0xd5, 0x0d, 0x46, 0x10,
+    0x00, 0x8b, 0x58, 0x10, 0x85, 0x84, 0x5c, 0xf0, 0x00, 0x64, 0xe8, 0x03, 0x84, 0x01, 0xd5, 0x02,
+    0x84, 0x02, 0x4b, 0xe0, 0x04, 0x01, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x17, 0x8b, 0xa2, 0x46, 0xf0,
+    0x01, 0x12, 0x04, 0x07, 0x82, 0xf4, 0xe2, 0x20, 0xe9, 0x40, 0x00, 0x13, 0x8a, 0xc8, 0x84, 0x40,
+    0x46, 0xf0, 0x01, 0x12, 0x14, 0x27, 0x82, 0xdf, 0xc9, 0x0b, 0x46, 0x00, 0x04, 0x10, 0x04, 0x20,
+    0x02, 0x03, 0x46, 0x40, 0x30, 0x00, 0x40, 0x21, 0x10, 0x04, 0x14, 0x20, 0x02, 0x03, 0x46, 0x00,
+    0x04, 0x10, 0x04, 0x20, 0x01, 0x06, 0x44, 0x5d, 0xff, 0x7f, 0x40, 0x21, 0x14, 0x02, 0x14, 0x20,
+    0x01, 0x06, 0xc1, 0x1a, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x05, 0x78, 0x46, 0xf0, 0x00, 0x82,
+    0x58, 0xf7, 0x8f, 0xcc, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x84, 0x58, 0xf7, 0x88, 0x98, 0xdd, 0x2f,
+    0x46, 0x00, 0x01, 0x1b, 0x58, 0x00, 0x05, 0x68, 0x84, 0x21, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7,
+    0x8e, 0xa8, 0xdd, 0x2f, 0xd5, 0x0a, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x07, 0x82, 0xf3, 0x46, 0xf0,
+    0x00, 0x85, 0x58, 0xf7, 0x8f, 0xd8, 0xdd, 0x2f, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x07, 0x82, 0xdf,
+    0x84, 0x21, 0x4c, 0x00, 0xc0, 0xb5, 0xa0, 0xb3, 0x4c, 0x20, 0x40, 0xb2, 0x46, 0xf0, 0x01, 0x12,
+    0x00, 0x17, 0x8b, 0xa2, 0xc9, 0x18, 0x46, 0x00, 0x04, 0x11, 0x04, 0x30, 0x00, 0x43, 0x58, 0x31,
+    0x81, 0x41, 0x14, 0x30, 0x00, 0x43, 0x00, 0x03, 0x8a, 0xc8, 0x4c, 0x01, 0x40, 0x0d, 0x46, 0x00,
+    0x01, 0x1a, 0x58, 0x00, 0x05, 0x78, 0x44, 0x20, 0x08, 0xc1, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7,
+    0x83, 0xc4, 0xdd, 0x2f, 0x46, 0x80, 0x01, 0x12, 0x46, 0xf0, 0x01, 0x12, 0x04, 0x07, 0x82, 0xf4,
+    0x00, 0x14, 0x0b, 0xa2, 0xe2, 0x20, 0x4e, 0xf2, 0x00, 0x8b, 0x44, 0x00, 0x00, 0x8c, 0x46, 0xf0,
+    0x00, 0x02, 0x58, 0xf7, 0x87, 0x50, 0xdd, 0x2f, 0x00, 0x04, 0x0b, 0xa2, 0x46, 0x90, 0x01, 0x1a,
+    0x58, 0x94, 0x8e, 0xa0, 0x38, 0x04, 0x82, 0x00, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x8f, 0x54,
+    0xdd, 0x2f, 0x00, 0x03, 0x8a, 0xc8, 0x84, 0xa1, 0xd8, 0x15, 0x84, 0x20, 0x46, 0x00, 0x01, 0x19,
+    0x58, 0x00, 0x02, 0x90, 0x44, 0x20, 0x00, 0x5c, 0x46, 0xf0, 0x00, 0x5a, 0x58, 0xf7, 0x83, 0xc4,
+    0xdd, 0x2f, 0x00, 0x14, 0x0b, 0xa2, 0x38, 0x14, 0x86, 0x00, 0x46, 0xf0, 0x01, 0x19, 0x10, 0x17,
+    0x82, 0x91, 0x46, 0x90, 0x01, 0x12, 0x00, 0x04, 0x8b, 0xa2, 0x46, 0x80, 0x01, 0x1a, 0x58, 0x84,
+    0x0e, 0xa0, 0x38, 0x04, 0x02, 0x00, 0x84, 0x20, 0x80, 0x41, 0x46, 0xf0, 0x00, 0x8a, 0x58, 0xf7,
+    0x87, 0x50, 0xdd, 0x2f, 0x00, 0x04, 0x8b, 0xa2, 0x38, 0x04, 0x02, 0x00, 0xe6, 0x0f, 0xe8, 0x08,
+    0x84, 0x00, 0x46, 0xf0, 0x00, 0x8b, 0x58, 0xf7, 0x85, 0x84, 0xdd, 0x2f, 0xd5, 0x0d, 0x46, 0x10,
+    0x00, 0x8b, 0x58, 0x10, 0x85, 0x84, 0x5c, 0xf0, 0x00, 0x64, 0xe8, 0x03, 0x84, 0x01, 0xd5, 0x02,
+    0x84, 0x02, 0x4b, 0xe0, 0x04, 0x01, 0x46, 0x00, 0x04, 0x11, 0x04, 0x20, 0x00, 0x44, 0x46, 0xf0,
+    0x01, 0x12, 0x00, 0x17, 0x8b, 0xa2, 0x46, 0xf0, 0x01, 0x12, 0x14, 0x27, 0x82, 0xf8, 0x84, 0x63,
+    0x42, 0x30, 0x8c, 0x24, 0x04, 0x40, 0x00, 0x4d, 0x46, 0x20, 0x01, 0x1c, 0x58, 0x21, 0x00, 0x50,
+    0x9c, 0x19, 0x38, 0x41, 0x02, 0x0a, 0x46, 0x00, 0x04, 0x11, 0x04, 0x00, 0x00, 0x50, 0x9c, 0xda,
+    0x38, 0x01, 0x0e, 0x0a, 0x46, 0x00, 0x01, 0x1a, 0x58, 0x00, 0x0e, 0xa0, 0x38, 0x00, 0x06, 0x02,
+    0x4e, 0x05, 0x00, 0x07, 0x46, 0xf0, 0x00, 0x85, 0x58, 0xf7, 0x8f, 0x9c, 0xdd, 0x2f, 0x46, 0x00,
+    0x01, 0x12, 0x00, 0x10, 0x0b, 0xa2, 0x9c, 0x49, 0x10, 0x10, 0x0b, 0xa2, 0xa0, 0x32, 0x44, 0x50,
+    0x00, 0x71, 0xd8, 0x76, 0x46, 0x70, 0x00, 0x00, 0x58, 0x73, 0x86, 0xc0, 0x84, 0x0a, 0x4b, 0xe0,
+    0x1c, 0x01, 0x84, 0x07, 0x4b, 0xe0, 0x1c, 0x01, 0x46, 0x10, 0x04, 0x00, 0x04, 0x20, 0x81, 0x06,
+    0x42, 0x21, 0x1c, 0x09, 0x14, 0x20, 0x81, 0x06, 0x80, 0x01, 0x04, 0x10, 0x00, 0x85, 0x42, 0x10,
+    0xb0, 0x09, 0x14, 0x10, 0x00, 0x85, 0x46, 0x70, 0x04, 0x00, 0x58, 0x73, 0x82, 0x0c, 0xb5, 0x07,
+    0x84, 0x0a, 0x58, 0x14, 0x00, 0x10, 0xb6, 0x27, 0x46, 0xf0, 0x00, 0x02, 0x58, 0xf7, 0x87, 0x50,
+    0xdd, 0x2f, 0x42, 0x84, 0x10, 0x09, 0xb7, 0x07, 0x46, 0xf0, 0x01, 0x01, 0x00, 0x37, 0x8a, 0x08,
+    0x9e, 0xd9, 0x46, 0xf0, 0x01, 0x12, 0x00, 0x17, 0x8b, 0xa3, 0x46, 0xf0, 0x01, 0x01, 0x10, 0x37,
+    0x8a, 0x08, 0x84, 0x00, 0x46, 0xf0, 0x00, 0x03, 0x58, 0xf7, 0x81, 0x84, 0xdd, 0x2f, 0x84, 0x20,
+    0x46, 0xf0, 0x01, 0x00, 0x10, 0x17, 0x83, 0x02, 0x46, 0x00, 0x04, 0x00, 0x04, 0x20, 0x00, 0x8c,
+    0x42, 0x21, 0x00, 0x09, 0x14, 0x20, 0x00, 0x8c, 0x46, 0x10, 0x00, 0x00, 0x58, 0x10, 0x8a, 0x2c,
+    0x46, 0x20, 0x00, 0x8e, 0x58, 0x21, 0x0d, 0xa8, 0x84, 0x0a, 0x46, 0xf0, 0x00, 0x00, 0x58, 0xf7,
+    0x87, 0xac, 0xdd, 0x2f, 0x84, 0x0a, 0x46, 0xf0, 0x00, 0x00, 0x58, 0xf7, 0x86, 0x84, 0xdd, 0x2f,
+    0x46, 0xf0, 0x00, 0x81, 0x58, 0xf7, 0x80, 0x28, 0xdd, 0x2f, 0x46, 0x10, 0x01, 0x01, 0x00, 0x20,
+    0x85, 0xab, 0x80, 0x06, 0x9e, 0x91, 0x10, 0x20, 0x85, 0xab, 0x46, 0xf0, 0x00, 0x02, 0x58, 0xf7,
+    0x8a, 0x30, 0xdd, 0x2f, 0x84, 0x00, 0xec, 0x04, 0x3a, 0x6f, 0xaa, 0x84, 0xdd, 0x9e, 0x84, 0xa1,
+    0xd8, 0x06, 0x46, 0xf0, 0x00, 0x80, 0x58, 0xf7, 0x8d, 0x90, 0xdd, 0x2f, 0x46, 0xf0, 0x00, 0x86,
+    0x58, 0xf7, 0x86, 0x14, 0xdd, 0x2f, 0x46, 0x90, 0x00, 0x81, 0x58, 0x94, 0x84, 0x88, 0xd5, 0x16,
+    0xdd, 0x3c, 0x81, 0x00, 0x80, 0x20, 0x46, 0x00, 0x01, 0x1b, 0x58, 0x00, 0x05, 0x80, 0x4b, 0xe0,
+    0x28, 0x01, 0xc8, 0x0c, 0x00, 0x04, 0x00, 0x1a, 0x46, 0x50, 0x01, 0x1a, 0x58, 0x52, 0x82, 0x18,
+    0x94, 0x04, 0x80, 0x28, 0x98, 0x05, 0x4b, 0xe0, 0x24, 0x01, 0x04, 0x13, 0x81, 0x70, 0x46, 0x00,
+    0x01, 0x1b, 0x58, 0x00, 0x0b, 0x38, 0xc9, 0xe5, 0x80, 0x06, 0x46, 0xf0, 0x00, 0x02, 0x58, 0xf7,
+    0x8a, 0x30, 0xdd, 0x2f, 0x48, 0xff, 0xfd, 0x54, 0x77, 0x69, 0x66, 0x69, 0x2f, 0x52, 0x41, 0x4d,
+    0x2f, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x2f, 0x66, 0x63, 0x65, 0x2f, 0x66, 0x63, 0x65, 0x2e,
+    0x63, 0x00, 0x00, 0x00, 0x77, 0x69, 0x66, 0x69, 0x2f, 0x52, 0x41, 0x4d, 0x2f, 0x64, 0x72, 0x69,
+    0x76, 0x65, 0x72, 0x2f, 0x70, 0x64, 0x6d, 0x61, 0x2f, 0x70, 0x64, 0x6d, 0x61, 0x2e, 0x63, 0x00,
+    0x53, 0x57, 0x20, 0x52, 0x54, 0x59, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x00, 0x77, 0x69, 0x66, 0x69,
+    0x2f, 0x52, 0x41, 0x4d, 0x2f, 0x70, 0x65, 0x72, 0x69, 0x2f, 0x6d, 0x63, 0x75, 0x63, 0x74, 0x6c,
+    0x2f, 0x6d, 0x63, 0x75, 0x63, 0x74, 0x6c, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x77, 0x69, 0x66, 0x69,
+    0x2f, 0x52, 0x41, 0x4d, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x63, 0x6e, 0x6d, 0x5f, 0x74, 0x69, 0x6d,
+    0x65, 0x72, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x77, 0x69, 0x66, 0x69, 0x2f, 0x52, 0x41, 0x4d,
+    0x2f, 0x61, 0x70, 0x69, 0x2f, 0x63, 0x6e, 0x6d, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x72, 0x2e, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x77, 0x69, 0x66, 0x69, 0x2f, 0x52, 0x41, 0x4d, 0x2f, 0x61, 0x70, 0x69,
+    0x2f, 0x70, 0x64, 0x6d, 0x61, 0x5f, 0x71, 0x75, 0x65, 0x75, 0x65, 0x2e, 0x63, 0x00, 0x00, 0x00,
+    0x77, 0x69, 0x66, 0x69, 0x2f, 0x52, 0x41, 0x4d, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x70, 0x6b, 0x74,
+    0x5f, 0x71, 0x75, 0x65, 0x75, 0x65, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x77, 0x69, 0x66, 0x69,
+    0x2f, 0x52, 0x41, 0x4d, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x6c, 0x69, 0x73, 0x74, 0x2e, 0x63, 0x00,
+    0x77, 0x69, 0x66, 0x69, 0x2f, 0x52, 0x41, 0x4d, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x74, 0x78, 0x6d,
+    0x5f, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x2e, 0x63, 0x00, 0x4e, 0x55, 0x4c, 0x4c,
+    0x00, 0x00, 0x00, 0x00, 0x6e, 0x6f, 0x6e, 0x65, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char firmware6[] = {
+    0xa0, 0x23, 0x00, 0x10, 0x80, 0x3e, 0x80, 0x3e, 0x20, 0x4e, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00,
+    0x44, 0x01, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00, 0x84, 0x02, 0x00, 0x00,
+    0x01, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x77, 0x77, 0x55, 0x33, 0x8f, 0xaa, 0x11, 0x66,
+    0x10, 0x1f, 0x1f, 0x3f, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x3a, 0x3a, 0x0f, 0x00,
+    0x00, 0x60, 0x9c, 0x0f, 0x05, 0x07, 0x00, 0x00, 0x77, 0x77, 0x44, 0x33, 0x8f, 0xaa, 0x33, 0x66,
+    0x00, 0xf3, 0x33, 0x03, 0x02, 0x00, 0xc8, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x77, 0x77, 0x55, 0x33,
+    0x8f, 0xaa, 0x11, 0x66, 0x10, 0x1f, 0x1f, 0x3f, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+    0x3a, 0x3a, 0x0f, 0x00, 0x00, 0x60, 0x9c, 0x0f, 0x05, 0x07, 0x00, 0x00, 0x77, 0x77, 0x44, 0x22,
+    0x8f, 0xaa, 0x33, 0xaa, 0x00, 0xf3, 0x33, 0x03, 0x03, 0x00, 0x20, 0x00, 0x32, 0x00, 0x00, 0x00,
+    0x77, 0x77, 0x45, 0x33, 0x8f, 0xaa, 0x11, 0x66, 0x10, 0x1f, 0x1f, 0x3f, 0x16, 0x00, 0x00, 0x00,
+    0x17, 0x00, 0x00, 0x00, 0x3a, 0x3a, 0x0f, 0x00, 0x00, 0x60, 0x9c, 0x0f, 0x05, 0x07, 0x00, 0x00,
+    0x77, 0x77, 0x33, 0x22, 0x8f, 0xaa, 0x66, 0xaa, 0x00, 0xf3, 0x33, 0x03, 0x04, 0x00, 0x34, 0x00,
+    0x44, 0x00, 0x00, 0x00, 0x77, 0x77, 0x44, 0x33, 0x8f, 0xaa, 0x33, 0x66, 0x10, 0x1f, 0x1f, 0x3f,
+    0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x3a, 0x3a, 0x0f, 0x00, 0x00, 0x60, 0x9c, 0x0f,
+    0x05, 0x07, 0x00, 0x00, 0x77, 0x77, 0x33, 0x21, 0x8f, 0xaa, 0x66, 0xaf, 0x00, 0xf3, 0x33, 0x03,
+    0x05, 0x00, 0x64, 0x00, 0x74, 0x00, 0x00, 0x00, 0x77, 0x57, 0x44, 0x33, 0x8f, 0xaa, 0x33, 0x66,
+    0x10, 0x10, 0x10, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3a, 0x3a, 0x0f, 0x00,
+    0x00, 0x60, 0x7c, 0x2f, 0x05, 0x07, 0x00, 0x00, 0x65, 0x46, 0x22, 0x21, 0x8f, 0xaa, 0xaa, 0xaf,
+    0x00, 0xf3, 0x03, 0x03, 0x06, 0x00, 0x78, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x77, 0x46, 0x33, 0x33,
+    0x8f, 0xaa, 0x66, 0x66, 0x10, 0x0f, 0x0f, 0x3f, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+    0x3a, 0x3a, 0x0f, 0x00, 0x00, 0x60, 0x7c, 0x2b, 0x05, 0x07, 0x00, 0x00, 0x64, 0x35, 0x22, 0x10,
+    0x8f, 0xaa, 0xaa, 0xff, 0x00, 0x83, 0xf3, 0x02, 0x07, 0x00, 0x95, 0x00, 0xa5, 0x00, 0x00, 0x00,
+    0x65, 0x34, 0x33, 0x33, 0x8f, 0xaa, 0x66, 0x66, 0x10, 0x0f, 0x0f, 0x3f, 0x12, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x3a, 0x3a, 0x0f, 0x00, 0x00, 0x60, 0x7c, 0x2b, 0x05, 0x07, 0x00, 0x00,
+    0x32, 0x03, 0x22, 0x10, 0x8f, 0xaa, 0xaa, 0xff, 0x00, 0x83, 0xf3, 0x02, 0x04, 0x00, 0x00, 0x00,
+    0x04, 0x20, 0x41, 0x00, 0x52, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x20, 0x41, 0x00,
+    0x52, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x20, 0x41, 0x00, 0xd2, 0x00, 0x00, 0x00,
+    0x35, 0x00, 0x00, 0x00, 0x04, 0x20, 0x41, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x04, 0x20, 0x41, 0x00, 0xda, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x04, 0x20, 0x41, 0x00,
+    0xda, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x23, 0x41, 0x00, 0x08, 0x14, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x23, 0x41, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+    0x00, 0x23, 0x41, 0x00, 0x08, 0x34, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x23, 0x41, 0x00,
+    0x08, 0x14, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x23, 0x41, 0x00, 0x00, 0x34, 0x00, 0x00,
+    0x35, 0x00, 0x00, 0x00, 0x00, 0x23, 0x41, 0x00, 0x08, 0x34, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x23, 0x41, 0x00, 0x00, 0x74, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x23, 0x41, 0x00,
+    0x08, 0x74, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x23, 0x41, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x00, 0x04, 0x23, 0x41, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x04, 0x23, 0x41, 0x00, 0x02, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x04, 0x23, 0x41, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x23, 0x41, 0x00, 0x70, 0x70, 0x00, 0x00,
+    0x39, 0x00, 0x00, 0x00, 0x08, 0x23, 0x41, 0x00, 0x70, 0x70, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x10, 0x23, 0x41, 0x00, 0x50, 0x9d, 0xe8, 0x15, 0x35, 0x00, 0x00, 0x00, 0x10, 0x23, 0x41, 0x00,
+    0x50, 0x9d, 0xe8, 0x15, 0x09, 0x00, 0x00, 0x00, 0x10, 0x23, 0x41, 0x00, 0x4e, 0x9b, 0xe7, 0x15,
+    0x39, 0x00, 0x00, 0x00, 0x10, 0x23, 0x41, 0x00, 0x4e, 0x9b, 0xe7, 0x15, 0x05, 0x00, 0x00, 0x00,
+    0x14, 0x23, 0x41, 0x00, 0x50, 0x9d, 0xe8, 0x15, 0x35, 0x00, 0x00, 0x00, 0x14, 0x23, 0x41, 0x00,
+    0x50, 0x9d, 0xe8, 0x15, 0x09, 0x00, 0x00, 0x00, 0x14, 0x23, 0x41, 0x00, 0x4e, 0x9b, 0xe7, 0x15,
+    0x39, 0x00, 0x00, 0x00, 0x14, 0x23, 0x41, 0x00, 0x4e, 0x9b, 0xe7, 0x15, 0x09, 0x00, 0x00, 0x00,
+    0x18, 0x23, 0x41, 0x00, 0x02, 0x02, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x18, 0x23, 0x41, 0x00,
+    0x02, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00, 0xfa, 0x5c, 0x42, 0x1e,
+    0x34, 0x00, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00, 0xfa, 0x5c, 0x42, 0x1e, 0x05, 0x00, 0x00, 0x00,
+    0x20, 0x23, 0x41, 0x00, 0xfa, 0x5a, 0x42, 0x1e, 0x35, 0x00, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00,
+    0xfa, 0x5a, 0x42, 0x1e, 0x09, 0x00, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00, 0xfa, 0x58, 0x42, 0x1e,
+    0x39, 0x00, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00, 0xfa, 0x58, 0x42, 0x1e, 0x04, 0x00, 0x00, 0x00,
+    0x24, 0x23, 0x41, 0x00, 0xfa, 0x5c, 0x42, 0x1e, 0x34, 0x00, 0x00, 0x00, 0x24, 0x23, 0x41, 0x00,
+    0xfa, 0x5c, 0x42, 0x1e, 0x05, 0x00, 0x00, 0x00, 0x24, 0x23, 0x41, 0x00, 0xfa, 0x5a, 0x42, 0x1e,
+    0x35, 0x00, 0x00, 0x00, 0x24, 0x23, 0x41, 0x00, 0xfa, 0x5a, 0x42, 0x1e, 0x09, 0x00, 0x00, 0x00,
+    0x24, 0x23, 0x41, 0x00, 0xfa, 0x58, 0x42, 0x1e, 0x39, 0x00, 0x00, 0x00, 0x24, 0x23, 0x41, 0x00,
+    0xfa, 0x58, 0x42, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x30, 0x23, 0x41, 0x00, 0xf3, 0x00, 0x05, 0x08,
+    0x30, 0x00, 0x00, 0x00, 0x30, 0x23, 0x41, 0x00, 0xf3, 0x00, 0x05, 0x08, 0x01, 0x00, 0x00, 0x00,
+    0x30, 0x23, 0x41, 0x00, 0xf3, 0x00, 0x05, 0x07, 0x31, 0x00, 0x00, 0x00, 0x30, 0x23, 0x41, 0x00,
+    0xf3, 0x00, 0x05, 0x07, 0x04, 0x00, 0x00, 0x00, 0x34, 0x23, 0x41, 0x00, 0x08, 0x04, 0x0a, 0x04,
+    0x34, 0x00, 0x00, 0x00, 0x34, 0x23, 0x41, 0x00, 0x08, 0x04, 0x0a, 0x04, 0x01, 0x00, 0x00, 0x00,
+    0x34, 0x23, 0x41, 0x00, 0x0b, 0x08, 0x0a, 0x04, 0x31, 0x00, 0x00, 0x00, 0x34, 0x23, 0x41, 0x00,
+    0x0b, 0x08, 0x0a, 0x04, 0x05, 0x00, 0x00, 0x00, 0x34, 0x23, 0x41, 0x00, 0x08, 0x04, 0x0a, 0x04,
+    0x35, 0x00, 0x00, 0x00, 0x34, 0x23, 0x41, 0x00, 0x08, 0x04, 0x0a, 0x04, 0x09, 0x00, 0x00, 0x00,
+    0x34, 0x23, 0x41, 0x00, 0x05, 0x03, 0x0a, 0x04, 0x39, 0x00, 0x00, 0x00, 0x34, 0x23, 0x41, 0x00,
+    0x05, 0x03, 0x0a, 0x04, 0x09, 0x00, 0x00, 0x00, 0x8c, 0x23, 0x41, 0x00, 0x14, 0x10, 0x10, 0x10,
+    0x39, 0x00, 0x00, 0x00, 0x8c, 0x23, 0x41, 0x00, 0x14, 0x10, 0x10, 0x10, 0x04, 0x00, 0x00, 0x00,
+    0xa4, 0x23, 0x41, 0x00, 0x32, 0x23, 0x2e, 0x2e, 0x34, 0x00, 0x00, 0x00, 0xa4, 0x23, 0x41, 0x00,
+    0x32, 0x23, 0x2e, 0x2e, 0x05, 0x00, 0x00, 0x00, 0xa4, 0x23, 0x41, 0x00, 0x32, 0x23, 0x2e, 0x2e,
+    0x35, 0x00, 0x00, 0x00, 0xa4, 0x23, 0x41, 0x00, 0x32, 0x23, 0x2e, 0x2e, 0x09, 0x00, 0x00, 0x00,
+    0xa4, 0x23, 0x41, 0x00, 0x26, 0x22, 0x1c, 0x1c, 0x39, 0x00, 0x00, 0x00, 0xa4, 0x23, 0x41, 0x00,
+    0x26, 0x22, 0x1c, 0x1c, 0x09, 0x00, 0x00, 0x00, 0xac, 0x23, 0x41, 0x00, 0x17, 0x17, 0x16, 0x16,
+    0x39, 0x00, 0x00, 0x00, 0xac, 0x23, 0x41, 0x00, 0x17, 0x17, 0x16, 0x16, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x26, 0x41, 0x00, 0x41, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x26, 0x41, 0x00,
+    0x41, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x26, 0x41, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x26, 0x41, 0x00, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x26, 0x41, 0x00, 0x81, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x26, 0x41, 0x00,
+    0x81, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x26, 0x41, 0x00, 0x82, 0x00, 0x00, 0x00,
+    0x39, 0x00, 0x00, 0x00, 0x00, 0x26, 0x41, 0x00, 0x82, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x04, 0x26, 0x41, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x26, 0x41, 0x00,
+    0x0b, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x26, 0x41, 0x00, 0x0b, 0x0f, 0x03, 0x00,
+    0x31, 0x00, 0x00, 0x00, 0x04, 0x26, 0x41, 0x00, 0x0b, 0x0f, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x04, 0x26, 0x41, 0x00, 0x0b, 0x2c, 0x01, 0x00, 0x35, 0x00, 0x00, 0x00, 0x04, 0x26, 0x41, 0x00,
+    0x0b, 0x2c, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x26, 0x41, 0x00, 0x0b, 0x3c, 0x00, 0x00,
+    0x39, 0x00, 0x00, 0x00, 0x04, 0x26, 0x41, 0x00, 0x0b, 0x3c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x0c, 0x26, 0x41, 0x00, 0x87, 0x00, 0x10, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0c, 0x26, 0x41, 0x00,
+    0x87, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x26, 0x41, 0x00, 0xf4, 0xa7, 0xab, 0x00,
+    0x31, 0x00, 0x00, 0x00, 0x14, 0x26, 0x41, 0x00, 0xf4, 0xa7, 0xab, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x14, 0x26, 0x41, 0x00, 0xf5, 0xa7, 0xab, 0x00, 0x35, 0x00, 0x00, 0x00, 0x14, 0x26, 0x41, 0x00,
+    0xf5, 0xa7, 0xab, 0x00, 0x09, 0x00, 0x00, 0x00, 0x14, 0x26, 0x41, 0x00, 0xf6, 0xa7, 0xab, 0x00,
+    0x39, 0x00, 0x00, 0x00, 0x14, 0x26, 0x41, 0x00, 0xf6, 0xa7, 0xab, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x1c, 0x26, 0x41, 0x00, 0x00, 0x04, 0x0e, 0x00, 0x31, 0x00, 0x00, 0x00, 0x1c, 0x26, 0x41, 0x00,
+    0x00, 0x04, 0x0e, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1c, 0x26, 0x41, 0x00, 0x00, 0x04, 0x18, 0x00,
+    0x35, 0x00, 0x00, 0x00, 0x1c, 0x26, 0x41, 0x00, 0x00, 0x04, 0x18, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x1c, 0x26, 0x41, 0x00, 0x00, 0x04, 0x20, 0x00, 0x39, 0x00, 0x00, 0x00, 0x1c, 0x26, 0x41, 0x00,
+    0x00, 0x04, 0x20, 0x00, 0x05, 0x00, 0x00, 0x00, 0x34, 0x29, 0x41, 0x00, 0x92, 0x05, 0x00, 0x00,
+    0x35, 0x00, 0x00, 0x00, 0x34, 0x29, 0x41, 0x00, 0x92, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x40, 0x29, 0x41, 0x00, 0x1e, 0x38, 0x00, 0x01, 0x31, 0x00, 0x00, 0x00, 0x40, 0x29, 0x41, 0x00,
+    0x1e, 0x38, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x40, 0x29, 0x41, 0x00, 0x1e, 0x38, 0x00, 0x01,
+    0x35, 0x00, 0x00, 0x00, 0x40, 0x29, 0x41, 0x00, 0x1e, 0x38, 0x00, 0x01, 0x09, 0x00, 0x00, 0x00,
+    0x48, 0x29, 0x41, 0x00, 0x91, 0xa9, 0x00, 0xf0, 0x39, 0x00, 0x00, 0x00, 0x48, 0x29, 0x41, 0x00,
+    0x91, 0xa9, 0x00, 0xf0, 0x09, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x41, 0x00, 0xf9, 0x9f, 0xff, 0xf9,
+    0x39, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x41, 0x00, 0xf9, 0x9f, 0xff, 0xf9, 0x04, 0x00, 0x00, 0x00,
+    0xac, 0x29, 0x41, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xac, 0x29, 0x41, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xac, 0x29, 0x41, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x35, 0x00, 0x00, 0x00, 0xac, 0x29, 0x41, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x23, 0x41, 0x00, 0x4e, 0xa5, 0xf3, 0x15, 0x30, 0x00, 0x00, 0x00, 0x10, 0x23, 0x41, 0x00,
+    0x4e, 0xa5, 0xf3, 0x15, 0x04, 0x00, 0x00, 0x00, 0x10, 0x23, 0x41, 0x00, 0x4e, 0xa4, 0xf3, 0x15,
+    0x34, 0x00, 0x00, 0x00, 0x10, 0x23, 0x41, 0x00, 0x4e, 0xa4, 0xf3, 0x15, 0x01, 0x00, 0x00, 0x00,
+    0x10, 0x23, 0x41, 0x00, 0x5b, 0xa6, 0xf3, 0x15, 0x31, 0x00, 0x00, 0x00, 0x10, 0x23, 0x41, 0x00,
+    0x5b, 0xa6, 0xf3, 0x15, 0x05, 0x00, 0x00, 0x00, 0x10, 0x23, 0x41, 0x00, 0x5b, 0xa8, 0xf3, 0x15,
+    0x35, 0x00, 0x00, 0x00, 0x10, 0x23, 0x41, 0x00, 0x5b, 0xa8, 0xf3, 0x15, 0x09, 0x00, 0x00, 0x00,
+    0x10, 0x23, 0x41, 0x00, 0x5b, 0xa8, 0xf3, 0x15, 0x39, 0x00, 0x00, 0x00, 0x10, 0x23, 0x41, 0x00,
+    0x5b, 0xa8, 0xf3, 0x15, 0x00, 0x00, 0x00, 0x00, 0x14, 0x23, 0x41, 0x00, 0x4e, 0xa5, 0xf3, 0x15,
+    0x30, 0x00, 0x00, 0x00, 0x14, 0x23, 0x41, 0x00, 0x4e, 0xa5, 0xf3, 0x15, 0x04, 0x00, 0x00, 0x00,
+    0x14, 0x23, 0x41, 0x00, 0x4e, 0xa4, 0xf3, 0x15, 0x34, 0x00, 0x00, 0x00, 0x14, 0x23, 0x41, 0x00,
+    0x4e, 0xa4, 0xf3, 0x15, 0x01, 0x00, 0x00, 0x00, 0x14, 0x23, 0x41, 0x00, 0x5b, 0xa6, 0xf3, 0x15,
+    0x31, 0x00, 0x00, 0x00, 0x14, 0x23, 0x41, 0x00, 0x5b, 0xa6, 0xf3, 0x15, 0x05, 0x00, 0x00, 0x00,
+    0x14, 0x23, 0x41, 0x00, 0x5b, 0xa8, 0xf3, 0x15, 0x35, 0x00, 0x00, 0x00, 0x14, 0x23, 0x41, 0x00,
+    0x5b, 0xa8, 0xf3, 0x15, 0x09, 0x00, 0x00, 0x00, 0x14, 0x23, 0x41, 0x00, 0x5b, 0xa8, 0xf3, 0x15,
+    0x39, 0x00, 0x00, 0x00, 0x14, 0x23, 0x41, 0x00, 0x5b, 0xa8, 0xf3, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x23, 0x41, 0x00, 0x10, 0x10, 0xff, 0x00, 0x30, 0x00, 0x00, 0x00, 0x18, 0x23, 0x41, 0x00,
+    0x10, 0x10, 0xff, 0x00, 0x04, 0x00, 0x00, 0x00, 0x18, 0x23, 0x41, 0x00, 0x10, 0x10, 0xff, 0x00,
+    0x34, 0x00, 0x00, 0x00, 0x18, 0x23, 0x41, 0x00, 0x10, 0x10, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x18, 0x23, 0x41, 0x00, 0x10, 0x10, 0xff, 0x00, 0x31, 0x00, 0x00, 0x00, 0x18, 0x23, 0x41, 0x00,
+    0x10, 0x10, 0xff, 0x00, 0x05, 0x00, 0x00, 0x00, 0x18, 0x23, 0x41, 0x00, 0x10, 0x10, 0xff, 0x00,
+    0x35, 0x00, 0x00, 0x00, 0x18, 0x23, 0x41, 0x00, 0x10, 0x10, 0xff, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x18, 0x23, 0x41, 0x00, 0x10, 0x10, 0xff, 0x00, 0x39, 0x00, 0x00, 0x00, 0x18, 0x23, 0x41, 0x00,
+    0x10, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00, 0xf8, 0x4a, 0x36, 0x0f,
+    0x30, 0x00, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00, 0xf8, 0x4a, 0x36, 0x0f, 0x04, 0x00, 0x00, 0x00,
+    0x20, 0x23, 0x41, 0x00, 0xf8, 0x48, 0x36, 0x18, 0x34, 0x00, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00,
+    0xf8, 0x48, 0x36, 0x18, 0x01, 0x00, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00, 0xf8, 0x4a, 0x36, 0x18,
+    0x31, 0x00, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00, 0xf8, 0x4a, 0x36, 0x18, 0x05, 0x00, 0x00, 0x00,
+    0x20, 0x23, 0x41, 0x00, 0xf8, 0x48, 0x36, 0x18, 0x35, 0x00, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00,
+    0xf8, 0x48, 0x36, 0x18, 0x09, 0x00, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00, 0xf8, 0x48, 0x36, 0x18,
+    0x39, 0x00, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00, 0xf8, 0x48, 0x36, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x23, 0x41, 0x00, 0xf8, 0x4a, 0x36, 0x0f, 0x30, 0x00, 0x00, 0x00, 0x24, 0x23, 0x41, 0x00,
+    0xf8, 0x4a, 0x36, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x24, 0x23, 0x41, 0x00, 0xf8, 0x48, 0x36, 0x18,
+    0x34, 0x00, 0x00, 0x00, 0x24, 0x23, 0x41, 0x00, 0xf8, 0x48, 0x36, 0x18, 0x01, 0x00, 0x00, 0x00,
+    0x24, 0x23, 0x41, 0x00, 0xf8, 0x4a, 0x36, 0x18, 0x31, 0x00, 0x00, 0x00, 0x24, 0x23, 0x41, 0x00,
+    0xf8, 0x4a, 0x36, 0x18, 0x05, 0x00, 0x00, 0x00, 0x24, 0x23, 0x41, 0x00, 0xf8, 0x48, 0x36, 0x18,
+    0x35, 0x00, 0x00, 0x00, 0x24, 0x23, 0x41, 0x00, 0xf8, 0x48, 0x36, 0x18, 0x09, 0x00, 0x00, 0x00,
+    0x24, 0x23, 0x41, 0x00, 0xf8, 0x48, 0x36, 0x18, 0x39, 0x00, 0x00, 0x00, 0x24, 0x23, 0x41, 0x00,
+    0xf8, 0x48, 0x36, 0x18, 0x01, 0x00, 0x00, 0x00, 0x68, 0x23, 0x41, 0x00, 0x04, 0x20, 0x7c, 0x00,
+    0x31, 0x00, 0x00, 0x00, 0x68, 0x23, 0x41, 0x00, 0x04, 0x20, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xec, 0x23, 0x41, 0x00, 0x96, 0x0e, 0x9e, 0xba, 0x30, 0x00, 0x00, 0x00, 0xec, 0x23, 0x41, 0x00,
+    0x96, 0x0e, 0x9e, 0xba, 0x04, 0x00, 0x00, 0x00, 0xec, 0x23, 0x41, 0x00, 0x96, 0x0e, 0x9e, 0xba,
+    0x34, 0x00, 0x00, 0x00, 0xec, 0x23, 0x41, 0x00, 0x96, 0x0e, 0x9e, 0xba, 0x01, 0x00, 0x00, 0x00,
+    0xec, 0x23, 0x41, 0x00, 0x96, 0x0e, 0x9e, 0xba, 0x31, 0x00, 0x00, 0x00, 0xec, 0x23, 0x41, 0x00,
+    0x96, 0x0e, 0x9e, 0xba, 0x05, 0x00, 0x00, 0x00, 0xec, 0x23, 0x41, 0x00, 0x96, 0x0e, 0x9e, 0xba,
+    0x35, 0x00, 0x00, 0x00, 0xec, 0x23, 0x41, 0x00, 0x96, 0x0e, 0x9e, 0xba, 0x09, 0x00, 0x00, 0x00,
+    0xec, 0x23, 0x41, 0x00, 0x96, 0x0e, 0x9e, 0xba, 0x39, 0x00, 0x00, 0x00, 0xec, 0x23, 0x41, 0x00,
+    0x96, 0x0e, 0x9e, 0xba, 0x01, 0x00, 0x00, 0x00, 0x45, 0x1c, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+    0x66, 0x66, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x54, 0x1c, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x09, 0x00, 0x03, 0x00, 0x00, 0x00, 0x63, 0x1c, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+    0xbb, 0xbb, 0x0b, 0x00, 0x04, 0x00, 0x00, 0x00, 0x72, 0x1c, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+    0x66, 0x66, 0x0e, 0x00, 0x05, 0x00, 0x00, 0x00, 0x81, 0x1c, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x90, 0x1c, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+    0xbb, 0xbb, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x9f, 0x1c, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+    0x66, 0x66, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0xae, 0x1c, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x09, 0x00, 0x09, 0x00, 0x00, 0x00, 0xbd, 0x1c, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+    0xbb, 0xbb, 0x0b, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xcc, 0x1c, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+    0x66, 0x66, 0x0e, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xdb, 0x1c, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xea, 0x1c, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+    0xbb, 0xbb, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xf9, 0x1c, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+    0x66, 0x66, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1d, 0x1d, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+    0xcc, 0xcc, 0x0c, 0x00, 0x22, 0x00, 0x00, 0x00, 0x4c, 0x1e, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x02, 0x00, 0x24, 0x00, 0x00, 0x00, 0x5b, 0x1e, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x05, 0x00, 0x25, 0x00, 0x00, 0x00, 0x63, 0x1e, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0x6a, 0x1e, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x27, 0x00, 0x00, 0x00, 0x72, 0x1e, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x09, 0x00, 0x28, 0x00, 0x00, 0x00, 0x79, 0x1e, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0a, 0x00, 0x29, 0x00, 0x00, 0x00, 0x81, 0x1e, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x88, 0x1e, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x0d, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x90, 0x1e, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0e, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x97, 0x1e, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x9f, 0x1e, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x01, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xa6, 0x1e, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x02, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xae, 0x1e, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, 0x00, 0xb5, 0x1e, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x05, 0x00, 0x31, 0x00, 0x00, 0x00, 0xbd, 0x1e, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x06, 0x00, 0x32, 0x00, 0x00, 0x00, 0xc4, 0x1e, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x33, 0x00, 0x00, 0x00, 0xcc, 0x1e, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x09, 0x00, 0x34, 0x00, 0x00, 0x00, 0xd3, 0x1e, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0a, 0x00, 0x35, 0x00, 0x00, 0x00, 0xdb, 0x1e, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x00, 0x36, 0x00, 0x00, 0x00, 0xe2, 0x1e, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x0d, 0x00, 0x37, 0x00, 0x00, 0x00, 0xea, 0x1e, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0e, 0x00, 0x38, 0x00, 0x00, 0x00, 0xf1, 0x1e, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xf9, 0x1e, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x01, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x02, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x05, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x17, 0x1f, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x06, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x1e, 0x1f, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x26, 0x1f, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x09, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2d, 0x1f, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0a, 0x00, 0x41, 0x00, 0x00, 0x00, 0x35, 0x1f, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x00, 0x42, 0x00, 0x00, 0x00, 0x3c, 0x1f, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x0d, 0x00, 0x43, 0x00, 0x00, 0x00, 0x44, 0x1f, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0e, 0x00, 0x44, 0x00, 0x00, 0x00, 0x4b, 0x1f, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x53, 0x1f, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x01, 0x00, 0x46, 0x00, 0x00, 0x00, 0x5a, 0x1f, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x02, 0x00, 0x47, 0x00, 0x00, 0x00, 0x62, 0x1f, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x48, 0x00, 0x00, 0x00, 0x69, 0x1f, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x05, 0x00, 0x49, 0x00, 0x00, 0x00, 0x71, 0x1f, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x06, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x78, 0x1f, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x80, 0x1f, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x09, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x87, 0x1f, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0a, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x8f, 0x1f, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x96, 0x1f, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x0d, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x9e, 0x1f, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0e, 0x00, 0x50, 0x00, 0x00, 0x00, 0xa5, 0x1f, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0xad, 0x1f, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x01, 0x00, 0x52, 0x00, 0x00, 0x00, 0xb4, 0x1f, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x02, 0x00, 0x53, 0x00, 0x00, 0x00, 0xbc, 0x1f, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x54, 0x00, 0x00, 0x00, 0xc3, 0x1f, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x05, 0x00, 0x55, 0x00, 0x00, 0x00, 0xcb, 0x1f, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x06, 0x00, 0x56, 0x00, 0x00, 0x00, 0xd2, 0x1f, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x57, 0x00, 0x00, 0x00, 0xda, 0x1f, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x09, 0x00, 0x58, 0x00, 0x00, 0x00, 0xe1, 0x1f, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0a, 0x00, 0x59, 0x00, 0x00, 0x00, 0xe9, 0x1f, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x00, 0x5a, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x0d, 0x00, 0x5b, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0e, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x0e, 0x20, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x02, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x16, 0x20, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d, 0x20, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x05, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x20, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x06, 0x00, 0x61, 0x00, 0x00, 0x00, 0x2c, 0x20, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x62, 0x00, 0x00, 0x00, 0x34, 0x20, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x09, 0x00, 0x63, 0x00, 0x00, 0x00, 0x44, 0x1f, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0e, 0x00, 0x64, 0x00, 0x00, 0x00, 0x3b, 0x20, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0a, 0x00, 0x65, 0x00, 0x00, 0x00, 0x43, 0x20, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x00, 0x66, 0x00, 0x00, 0x00, 0x4a, 0x20, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x0d, 0x00, 0x67, 0x00, 0x00, 0x00, 0x52, 0x20, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0e, 0x00, 0x68, 0x00, 0x00, 0x00, 0x59, 0x20, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x61, 0x20, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x01, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x68, 0x20, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x02, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x70, 0x20, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x77, 0x20, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x05, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x7f, 0x20, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x06, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x86, 0x20, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x8e, 0x20, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x09, 0x00, 0x70, 0x00, 0x00, 0x00, 0x95, 0x20, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0a, 0x00, 0x71, 0x00, 0x00, 0x00, 0x9d, 0x20, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x00, 0x72, 0x00, 0x00, 0x00, 0xa4, 0x20, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x0d, 0x00, 0x73, 0x00, 0x00, 0x00, 0xac, 0x20, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0e, 0x00, 0x74, 0x00, 0x00, 0x00, 0xb3, 0x20, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0xbb, 0x20, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x01, 0x00, 0x76, 0x00, 0x00, 0x00, 0xc2, 0x20, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x02, 0x00, 0x77, 0x00, 0x00, 0x00, 0xca, 0x20, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x78, 0x00, 0x00, 0x00, 0xd1, 0x20, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x05, 0x00, 0x79, 0x00, 0x00, 0x00, 0xd9, 0x20, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x06, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xe0, 0x20, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x7b, 0x00, 0x00, 0x00, 0xe8, 0x20, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x09, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xef, 0x20, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0a, 0x00, 0x7d, 0x00, 0x00, 0x00, 0xf7, 0x20, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x00, 0x7e, 0x00, 0x00, 0x00, 0xfe, 0x20, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x0d, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x06, 0x21, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0e, 0x00, 0x80, 0x00, 0x00, 0x00, 0x0d, 0x21, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x15, 0x21, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x01, 0x00, 0x82, 0x00, 0x00, 0x00, 0x1c, 0x21, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x02, 0x00, 0x83, 0x00, 0x00, 0x00, 0x24, 0x21, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x84, 0x00, 0x00, 0x00, 0x2b, 0x21, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x05, 0x00, 0x85, 0x00, 0x00, 0x00, 0x33, 0x21, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x06, 0x00, 0x86, 0x00, 0x00, 0x00, 0x3a, 0x21, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x87, 0x00, 0x00, 0x00, 0x42, 0x21, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x09, 0x00, 0x88, 0x00, 0x00, 0x00, 0x49, 0x21, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0a, 0x00, 0x89, 0x00, 0x00, 0x00, 0x51, 0x21, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x58, 0x21, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x0d, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x60, 0x21, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0e, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x67, 0x21, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x6f, 0x21, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x01, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x76, 0x21, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x02, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x7e, 0x21, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x90, 0x00, 0x00, 0x00, 0x85, 0x21, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x05, 0x00, 0x91, 0x00, 0x00, 0x00, 0x8d, 0x21, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x06, 0x00, 0x92, 0x00, 0x00, 0x00, 0x94, 0x21, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x93, 0x00, 0x00, 0x00, 0x9c, 0x21, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x09, 0x00, 0x94, 0x00, 0x00, 0x00, 0xa3, 0x21, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0a, 0x00, 0x95, 0x00, 0x00, 0x00, 0xab, 0x21, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x00, 0x96, 0x00, 0x00, 0x00, 0xb2, 0x21, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x0d, 0x00, 0x97, 0x00, 0x00, 0x00, 0xba, 0x21, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0e, 0x00, 0x98, 0x00, 0x00, 0x00, 0xc1, 0x21, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0xc9, 0x21, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x01, 0x00, 0x9a, 0x00, 0x00, 0x00, 0xd0, 0x21, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x02, 0x00, 0x9b, 0x00, 0x00, 0x00, 0xd8, 0x21, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xdf, 0x21, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x05, 0x00, 0x9d, 0x00, 0x00, 0x00, 0xe7, 0x21, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x06, 0x00, 0x9e, 0x00, 0x00, 0x00, 0xee, 0x21, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xf6, 0x21, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x09, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xfd, 0x21, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0a, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x05, 0x22, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x0c, 0x22, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x0d, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x14, 0x22, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0e, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x1b, 0x22, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x23, 0x22, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x01, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x32, 0x22, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x41, 0x22, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x06, 0x00, 0xab, 0x00, 0x00, 0x00, 0x50, 0x22, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x09, 0x00, 0xad, 0x00, 0x00, 0x00, 0x5f, 0x22, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0c, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xce, 0x1c, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0e, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xd5, 0x1c, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0xdd, 0x1c, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x01, 0x00, 0xbb, 0x00, 0x00, 0x00, 0xec, 0x1c, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xf3, 0x1c, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x05, 0x00, 0xbd, 0x00, 0x00, 0x00, 0xfb, 0x1c, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x06, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x11, 0x1d, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0a, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x2f, 0x1d, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x4d, 0x1d, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x05, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x6b, 0x1d, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0a, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x89, 0x1d, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xa7, 0x1d, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x05, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xc5, 0x1d, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+    0xaa, 0xaa, 0x0a, 0x00, 0x09, 0x00, 0x08, 0x00, 0x00, 0x00, 0x47, 0x10, 0x09, 0x00, 0x0c, 0x00,
+    0x47, 0x30, 0xc7, 0x11, 0x09, 0x00, 0x10, 0x00, 0x47, 0x10, 0x00, 0x00, 0x09, 0x00, 0x9c, 0x02,
+    0x10, 0x10, 0x10, 0x3f, 0x09, 0x00, 0x6c, 0x02, 0x57, 0x77, 0x50, 0x00, 0x00, 0x00, 0xa4, 0x02,
+    0x5f, 0x77, 0x2a, 0x25, 0x00, 0x00, 0x54, 0x01, 0xa1, 0x1e, 0xf6, 0xac, 0x00, 0x00, 0x48, 0x01,
+    0x00, 0x7c, 0x72, 0xa9, 0x00, 0x00, 0x08, 0x03, 0x00, 0x7c, 0x72, 0xa9, 0x00, 0x00, 0x58, 0x00,
+    0x00, 0x60, 0x7c, 0x2f, 0x01, 0x00, 0xa4, 0x02, 0x7e, 0x77, 0x2a, 0x26, 0x09, 0x00, 0x34, 0x01,
+    0x80, 0x38, 0x04, 0x20, 0x01, 0x00, 0x20, 0x03, 0x83, 0x68, 0x88, 0x04, 0x04, 0x2f, 0x41, 0x00,
+    0x01, 0x22, 0x00, 0x80, 0x0c, 0x2f, 0x41, 0x00, 0xaa, 0xbb, 0xcc, 0xdd, 0x10, 0x2f, 0x41, 0x00,
+    0xee, 0xff, 0x00, 0x00, 0xd8, 0x2f, 0x41, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x20, 0x41, 0x00,
+    0x42, 0x00, 0x00, 0x00, 0x08, 0x20, 0x41, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x20, 0x41, 0x00,
+    0x0a, 0x03, 0x00, 0x03, 0x2c, 0x21, 0x41, 0x00, 0x01, 0x80, 0xde, 0x0f, 0x00, 0x23, 0x41, 0x00,
+    0x00, 0x14, 0x00, 0x00, 0x04, 0x23, 0x41, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x23, 0x41, 0x00,
+    0x14, 0x14, 0x00, 0x00, 0x10, 0x23, 0x41, 0x00, 0x44, 0x95, 0xe7, 0x15, 0x14, 0x23, 0x41, 0x00,
+    0x44, 0x95, 0xe7, 0x15, 0x18, 0x23, 0x41, 0x00, 0x40, 0x40, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00,
+    0xfa, 0x5e, 0x36, 0x18, 0x24, 0x23, 0x41, 0x00, 0xfa, 0x5e, 0x36, 0x18, 0x30, 0x23, 0x41, 0x00,
+    0xf3, 0x00, 0x05, 0x05, 0x34, 0x23, 0x41, 0x00, 0x08, 0x04, 0x0a, 0x04, 0x38, 0x23, 0x41, 0x00,
+    0x38, 0x20, 0x0f, 0x11, 0x5c, 0x23, 0x41, 0x00, 0x2c, 0x27, 0x00, 0x00, 0x64, 0x23, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x68, 0x23, 0x41, 0x00, 0x05, 0x20, 0x7c, 0x00, 0x6c, 0x23, 0x41, 0x00,
+    0xcf, 0x00, 0x00, 0x00, 0x70, 0x23, 0x41, 0x00, 0x00, 0x08, 0x00, 0x00, 0x78, 0x23, 0x41, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x7c, 0x23, 0x41, 0x00, 0xe3, 0x0f, 0x00, 0x00, 0x84, 0x23, 0x41, 0x00,
+    0x70, 0x70, 0x00, 0x00, 0x8c, 0x23, 0x41, 0x00, 0x16, 0x15, 0x11, 0x11, 0x9c, 0x23, 0x41, 0x00,
+    0x45, 0x3e, 0x38, 0x38, 0xa4, 0x23, 0x41, 0x00, 0x2e, 0x2a, 0x2a, 0x2a, 0xac, 0x23, 0x41, 0x00,
+    0x30, 0x2b, 0x26, 0x26, 0xcc, 0x23, 0x41, 0x00, 0x1c, 0x1c, 0x16, 0x16, 0xd4, 0x23, 0x41, 0x00,
+    0x2f, 0x2a, 0x26, 0x26, 0xdc, 0x23, 0x41, 0x00, 0x66, 0x54, 0x40, 0x40, 0xec, 0x23, 0x41, 0x00,
+    0x96, 0x0e, 0xa2, 0xba, 0x00, 0x24, 0x41, 0x00, 0x03, 0x04, 0xe9, 0x02, 0x08, 0x24, 0x41, 0x00,
+    0xaa, 0x55, 0x00, 0x00, 0x04, 0x25, 0x41, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x14, 0x25, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0x25, 0x41, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x26, 0x41, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x04, 0x26, 0x41, 0x00, 0x0b, 0x06, 0x06, 0x00, 0x0c, 0x26, 0x41, 0x00,
+    0x07, 0x00, 0x10, 0x00, 0x10, 0x26, 0x41, 0x00, 0x07, 0x00, 0x00, 0x00, 0x14, 0x26, 0x41, 0x00,
+    0xf4, 0x03, 0xc0, 0x00, 0x18, 0x26, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x26, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x26, 0x41, 0x00, 0x73, 0x77, 0x77, 0x00, 0x00, 0x27, 0x41, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x08, 0x27, 0x41, 0x00, 0x00, 0x00, 0x04, 0x01, 0x10, 0x27, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x27, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x27, 0x41, 0x00,
+    0x14, 0x00, 0x00, 0x80, 0x40, 0x27, 0x41, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x25, 0x41, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x14, 0x25, 0x41, 0x00, 0xec, 0xc4, 0x77, 0xf9, 0x00, 0x28, 0x41, 0x00,
+    0xe0, 0x00, 0x50, 0x3d, 0x34, 0x29, 0x41, 0x00, 0x92, 0x04, 0x00, 0x00, 0x38, 0x29, 0x41, 0x00,
+    0x11, 0x04, 0x56, 0x00, 0x3c, 0x29, 0x41, 0x00, 0x1c, 0x1b, 0xf2, 0xc8, 0x40, 0x29, 0x41, 0x00,
+    0x1e, 0x58, 0x00, 0x00, 0x44, 0x29, 0x41, 0x00, 0x20, 0x40, 0x07, 0x00, 0x48, 0x29, 0x41, 0x00,
+    0x91, 0xa9, 0x00, 0xc0, 0x4c, 0x29, 0x41, 0x00, 0xf9, 0x9f, 0xff, 0xb9, 0x50, 0x29, 0x41, 0x00,
+    0x6e, 0x00, 0x40, 0x26, 0x60, 0x29, 0x41, 0x00, 0x16, 0x00, 0x00, 0x00, 0x64, 0x29, 0x41, 0x00,
+    0x30, 0xf0, 0x8f, 0x89, 0x88, 0x29, 0x41, 0x00, 0x44, 0x44, 0x01, 0x00, 0x94, 0x29, 0x41, 0x00,
+    0x00, 0x00, 0xe0, 0x01, 0xac, 0x29, 0x41, 0x00, 0x28, 0x00, 0x00, 0x00, 0xd4, 0x29, 0x41, 0x00,
+    0x00, 0x8a, 0x00, 0x00, 0xf0, 0x29, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x50, 0x2c, 0x41, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0xc4, 0x2c, 0x41, 0x00, 0x07, 0x4f, 0x03, 0x00, 0x08, 0x23, 0x41, 0x00,
+    0x0e, 0x0e, 0x00, 0x00, 0x10, 0x23, 0x41, 0x00, 0x4f, 0x9d, 0xe8, 0x15, 0x14, 0x23, 0x41, 0x00,
+    0x4f, 0x9d, 0xe8, 0x15, 0x18, 0x23, 0x41, 0x00, 0x04, 0x04, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00,
+    0xfa, 0x5c, 0x36, 0x18, 0x24, 0x23, 0x41, 0x00, 0xfa, 0x5c, 0x36, 0x18, 0x38, 0x23, 0x41, 0x00,
+    0x38, 0x02, 0x0f, 0x11, 0x78, 0x23, 0x41, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7c, 0x23, 0x41, 0x00,
+    0xf3, 0x0f, 0x00, 0x00, 0x84, 0x23, 0x41, 0x00, 0x78, 0x78, 0x00, 0x00, 0x8c, 0x23, 0x41, 0x00,
+    0x16, 0x11, 0x11, 0x11, 0xcc, 0x23, 0x41, 0x00, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x23, 0x41, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xdc, 0x23, 0x41, 0x00, 0xff, 0xff, 0xff, 0xff, 0x08, 0x24, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x25, 0x41, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x14, 0x25, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x26, 0x41, 0x00, 0x08, 0x00, 0x04, 0x00, 0x10, 0x26, 0x41, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x18, 0x26, 0x41, 0x00, 0x70, 0x00, 0x00, 0x00, 0x44, 0x29, 0x41, 0x00,
+    0x21, 0x40, 0x07, 0x00, 0xd4, 0x29, 0x41, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x10, 0x27, 0x41, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x41, 0x00, 0xe0, 0x00, 0x50, 0x89, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x88, 0x90, 0x98, 0x9a,
+    0x9c, 0x9e, 0xb8, 0xba, 0xbc, 0xbe, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0x00, 0x00, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x00, 0x00,
+    0xa8, 0xa8, 0x88, 0x00, 0xa0, 0xa0, 0x99, 0x00, 0x98, 0x98, 0xaa, 0x00, 0x90, 0x90, 0xbb, 0x00,
+    0x8b, 0x8b, 0xbb, 0x00, 0x87, 0x87, 0xbb, 0x00, 0x06, 0x06, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00,
+    0x09, 0x09, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00,
+    0x27, 0x00, 0x25, 0x00, 0x65, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0x05, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x06, 0x06, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00,
+    0x08, 0x08, 0x00, 0x00, 0x05, 0x07, 0x06, 0x00, 0x07, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
+    0x08, 0x08, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00,
+    0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00,
+    0x06, 0x06, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x0d, 0x0c, 0x08, 0x07, 0x06, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00,
+    0x0c, 0x0c, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00,
+    0x0c, 0x0b, 0x0a, 0x06, 0x08, 0x07, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00,
+    0x06, 0x06, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00,
+    0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00,
+    0x06, 0x06, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00,
+    0x08, 0x08, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x02, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00,
+    0x0a, 0x0a, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x0a, 0x0a, 0x00, 0x00,
+    0x08, 0x07, 0x06, 0x00, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x00, 0x00, 0x0d, 0x0c, 0x0b, 0x0a,
+    0x09, 0x08, 0x07, 0x06, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x00, 0x00, 0x00,
+    0x60, 0x00, 0x20, 0x00, 0x40, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x01, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x07, 0x00, 0x0a, 0x00, 0xe8, 0x03,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x6f, 0x00, 0x00,
+    0x96, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x0d, 0x00, 0xe8, 0x03, 0x00, 0x00, 0x01, 0x00,
+    0xb8, 0x0b, 0x00, 0x00, 0xe4, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x07, 0x00, 0x64, 0x00, 0xdc, 0x05, 0x00, 0x00, 0x01, 0x00, 0xa0, 0x0f, 0x00, 0x00,
+    0xe8, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00,
+    0x0c, 0x00, 0xe8, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfa, 0x19, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x28, 0x00, 0xe8, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x2c, 0x01, 0x00,
+    0xb4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x05, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6c, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x07, 0x00, 0x1e, 0x00, 0xe8, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4e, 0x38, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0f, 0x00,
+    0x0a, 0x00, 0xe8, 0x03, 0x00, 0x00, 0x01, 0x00, 0x11, 0x4e, 0x00, 0x00, 0x5a, 0x86, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x0a, 0x00, 0xd0, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0xca, 0x30, 0x00, 0x00, 0x5a, 0x86, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x15, 0x00, 0xd0, 0x07, 0x00, 0x00, 0x01, 0x00,
+    0x84, 0x13, 0x00, 0x00, 0xf0, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x0f, 0x00, 0x7c, 0x01, 0xb8, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x84, 0x13, 0x00, 0x00,
+    0x08, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0f, 0x00,
+    0x0a, 0x00, 0x20, 0x03, 0x00, 0x00, 0x01, 0x00, 0x2d, 0xc3, 0x00, 0x00, 0x9c, 0x04, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x0a, 0x00, 0x20, 0x03,
+    0x00, 0x00, 0x01, 0x00, 0x0d, 0x41, 0x00, 0x00, 0x73, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1e, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0xd0, 0x07,
+    0x05, 0x00, 0x00, 0x00, 0x54, 0x0b, 0x00, 0x00, 0x48, 0x71, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x46, 0x00, 0x2a, 0x00, 0x7e, 0x00, 0x14, 0x00, 0x88, 0x13, 0x05, 0x00, 0x00, 0x00,
+    0x54, 0x0b, 0x00, 0x00, 0x48, 0x71, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x64, 0x00,
+    0x2a, 0x00, 0xa0, 0x00, 0x14, 0x00, 0x88, 0x13, 0x19, 0x00, 0x00, 0x00, 0x54, 0x0b, 0x00, 0x00,
+    0x74, 0x27, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0xc8, 0x00, 0x14, 0x00, 0x96, 0x00,
+    0x84, 0x03, 0x98, 0x08, 0x32, 0x00, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00, 0xff, 0xc9, 0x9a, 0x3b,
+    0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc9, 0x9a, 0x3b, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x04, 0x00, 0xff, 0x0f,
+    0x05, 0x00, 0x00, 0x00, 0x78, 0x1e, 0x00, 0x00, 0x88, 0x8a, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x46, 0x00, 0x2a, 0x00, 0x5a, 0x00, 0x14, 0x00, 0xff, 0x0f, 0x03, 0x00, 0x00, 0x00,
+    0x24, 0x13, 0x00, 0x00, 0x88, 0x8a, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x64, 0x00,
+    0x2a, 0x00, 0xa0, 0x00, 0x14, 0x00, 0xff, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x24, 0x13, 0x00, 0x00,
+    0x88, 0x8a, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xc8, 0x00, 0x14, 0x00, 0x96, 0x00,
+    0xc8, 0x00, 0xff, 0x0f, 0x64, 0x00, 0x00, 0x00, 0x24, 0x13, 0x00, 0x00, 0xf8, 0x2a, 0x00, 0x00,
+    0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x08, 0x00, 0x11, 0x00, 0x07, 0x00, 0x46, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0xf4, 0x7e, 0x00, 0x00, 0x34, 0x0f, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0xd0, 0x07,
+    0x05, 0x00, 0x00, 0x00, 0x54, 0x0b, 0x00, 0x00, 0x08, 0x4c, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x46, 0x00, 0x30, 0x00, 0x7e, 0x00, 0x14, 0x00, 0x88, 0x13, 0x05, 0x00, 0x00, 0x00,
+    0x54, 0x0b, 0x00, 0x00, 0x08, 0x4c, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x64, 0x00,
+    0x30, 0x00, 0xa0, 0x00, 0x14, 0x00, 0x88, 0x13, 0x19, 0x00, 0x00, 0x00, 0x54, 0x0b, 0x00, 0x00,
+    0x08, 0x4c, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0xc8, 0x00, 0x14, 0x00, 0x96, 0x00,
+    0x84, 0x03, 0x98, 0x08, 0x32, 0x00, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00, 0xff, 0xc9, 0x9a, 0x3b,
+    0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc9, 0x9a, 0x3b, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x10, 0x00, 0x08, 0x00, 0xd0, 0x07,
+    0x05, 0x00, 0x00, 0x00, 0x60, 0x6d, 0x00, 0x00, 0x08, 0x4c, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x20, 0x00, 0x18, 0x00, 0x40, 0x00, 0x14, 0x00, 0xd0, 0x07, 0x05, 0x00, 0x00, 0x00,
+    0x60, 0x6d, 0x00, 0x00, 0x08, 0x4c, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x64, 0x00,
+    0x2a, 0x00, 0xa0, 0x00, 0x14, 0x00, 0xd0, 0x07, 0x19, 0x00, 0x00, 0x00, 0x60, 0x6d, 0x00, 0x00,
+    0x08, 0x4c, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x07, 0x00, 0x6a, 0x00, 0x96, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x54, 0x0b, 0x00, 0x00, 0xe4, 0x38, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x40, 0x01, 0xdc, 0x13, 0x00, 0x00,
+    0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x07, 0x00, 0x6a, 0x00, 0x8c, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0xd0, 0x6b, 0x00, 0x00, 0xfc, 0x6c, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x40, 0x01, 0xdd, 0x19, 0x00, 0x00, 0x02, 0x00, 0x28, 0x00,
+    0x04, 0x00, 0x2c, 0x00, 0x60, 0x00, 0xe0, 0x01, 0x96, 0x00, 0x00, 0x00, 0x54, 0x0b, 0x00, 0x00,
+    0xe4, 0x38, 0x01, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7f,
+    0x00, 0x1c, 0x4e, 0x0e, 0xcc, 0x12, 0x00, 0x00, 0x03, 0x02, 0x3c, 0x00, 0x0f, 0x00, 0x30, 0x00,
+    0x80, 0x02, 0x20, 0x08, 0x20, 0x00, 0x00, 0x00, 0x90, 0x4c, 0x00, 0x00, 0x08, 0x9d, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x93, 0x03, 0x00, 0xcf, 0x7b, 0x05,
+    0x89, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x09, 0x00, 0x6a, 0x00, 0x96, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x24, 0x13, 0x00, 0x00, 0x00, 0x87, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x40, 0x01, 0xcc, 0x19, 0x00, 0x00,
+    0x01, 0x00, 0x28, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x60, 0x00, 0x7c, 0x01, 0x96, 0x00, 0x00, 0x00,
+    0x24, 0x13, 0x00, 0x00, 0x00, 0x87, 0x01, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x40, 0x01, 0xcc, 0x19, 0x00, 0x00, 0x02, 0x03, 0x3c, 0x00,
+    0x14, 0x00, 0x2e, 0x00, 0x2c, 0x01, 0x80, 0x02, 0x50, 0x00, 0x00, 0x00, 0x24, 0x13, 0x00, 0x00,
+    0x74, 0x27, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7f,
+    0x00, 0x1c, 0x4e, 0x0e, 0xdd, 0x19, 0x00, 0x00, 0x03, 0x08, 0x08, 0x00, 0x02, 0x00, 0x09, 0x00,
+    0x6a, 0x00, 0x96, 0x00, 0x20, 0x00, 0x00, 0x00, 0x24, 0x13, 0x00, 0x00, 0x00, 0x87, 0x04, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x40, 0x01,
+    0xcc, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x09, 0x00, 0x6a, 0x00, 0x96, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0xf0, 0x6e, 0x00, 0x00, 0xc8, 0x2c, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x40, 0x01, 0xcc, 0x16, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x28, 0x00,
+    0x04, 0x00, 0x2c, 0x00, 0x60, 0x00, 0xc8, 0x00, 0x96, 0x00, 0x00, 0x00, 0xf0, 0x6e, 0x00, 0x00,
+    0xc8, 0x2c, 0x01, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7f,
+    0x00, 0x1c, 0x4e, 0x0e, 0xcc, 0x16, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x23, 0x41, 0x00, 0x43, 0x94, 0xe5, 0x15, 0x14, 0x23, 0x41, 0x00, 0x43, 0x94, 0xe5, 0x15,
+    0x20, 0x23, 0x41, 0x00, 0xf8, 0x5e, 0x42, 0x1e, 0x24, 0x23, 0x41, 0x00, 0xf8, 0x5e, 0x42, 0x1e,
+    0x34, 0x23, 0x41, 0x00, 0x08, 0x04, 0x0d, 0x04, 0x38, 0x23, 0x41, 0x00, 0x38, 0x2e, 0x0f, 0x11,
+    0x6c, 0x23, 0x41, 0x00, 0xec, 0x00, 0x00, 0x00, 0xac, 0x23, 0x41, 0x00, 0x30, 0x2b, 0x26, 0x26,
+    0xcc, 0x23, 0x41, 0x00, 0x1c, 0x1c, 0x15, 0x15, 0x10, 0x23, 0x41, 0x00, 0x43, 0x94, 0xe5, 0x15,
+    0x14, 0x23, 0x41, 0x00, 0x43, 0x94, 0xe5, 0x15, 0x20, 0x23, 0x41, 0x00, 0xf8, 0x60, 0x42, 0x1e,
+    0x24, 0x23, 0x41, 0x00, 0xf8, 0x60, 0x42, 0x1e, 0x34, 0x23, 0x41, 0x00, 0x0f, 0x04, 0x0d, 0x04,
+    0x38, 0x23, 0x41, 0x00, 0x38, 0x2e, 0x0f, 0x11, 0x6c, 0x23, 0x41, 0x00, 0xec, 0x00, 0x00, 0x00,
+    0xac, 0x23, 0x41, 0x00, 0x30, 0x2b, 0x26, 0x26, 0xcc, 0x23, 0x41, 0x00, 0x1c, 0x1c, 0x15, 0x15,
+    0x20, 0x23, 0x41, 0x00, 0xf8, 0x5a, 0x36, 0x18, 0x24, 0x23, 0x41, 0x00, 0xf8, 0x5a, 0x36, 0x18,
+    0x34, 0x23, 0x41, 0x00, 0x0a, 0x04, 0x0a, 0x04, 0x38, 0x23, 0x41, 0x00, 0x38, 0x2e, 0x0f, 0x11,
+    0x6c, 0x23, 0x41, 0x00, 0xec, 0x00, 0x00, 0x00, 0xac, 0x23, 0x41, 0x00, 0x28, 0x23, 0x1e, 0x1e,
+    0xcc, 0x23, 0x41, 0x00, 0x1c, 0x1c, 0x15, 0x15, 0x20, 0x23, 0x41, 0x00, 0xf8, 0x5c, 0x36, 0x18,
+    0x24, 0x23, 0x41, 0x00, 0xf8, 0x5c, 0x36, 0x18, 0x34, 0x23, 0x41, 0x00, 0x0d, 0x08, 0x0a, 0x04,
+    0x38, 0x23, 0x41, 0x00, 0x38, 0x2e, 0x0f, 0x11, 0x6c, 0x23, 0x41, 0x00, 0xec, 0x00, 0x00, 0x00,
+    0xac, 0x23, 0x41, 0x00, 0x28, 0x23, 0x1e, 0x1e, 0xcc, 0x23, 0x41, 0x00, 0x1c, 0x1c, 0x15, 0x15,
+    0x20, 0x23, 0x41, 0x00, 0xf8, 0x5a, 0x42, 0x1e, 0x24, 0x23, 0x41, 0x00, 0xf8, 0x5a, 0x42, 0x1e,
+    0x6c, 0x23, 0x41, 0x00, 0xec, 0x00, 0x00, 0x00, 0x20, 0x23, 0x41, 0x00, 0xf8, 0x5a, 0x42, 0x1e,
+    0x24, 0x23, 0x41, 0x00, 0xf8, 0x5a, 0x42, 0x1e, 0x68, 0x23, 0x41, 0x00, 0x05, 0x20, 0x7c, 0x00,
+    0x6c, 0x23, 0x41, 0x00, 0xec, 0x00, 0x00, 0x00, 0xa4, 0x23, 0x41, 0x00, 0x28, 0x24, 0x24, 0x24,
+    0xac, 0x23, 0x41, 0x00, 0x30, 0x2b, 0x26, 0x26, 0x20, 0x23, 0x41, 0x00, 0xf8, 0x5a, 0x36, 0x18,
+    0x24, 0x23, 0x41, 0x00, 0xf8, 0x5a, 0x36, 0x18, 0x34, 0x23, 0x41, 0x00, 0x0a, 0x08, 0x0a, 0x04,
+    0x6c, 0x23, 0x41, 0x00, 0xec, 0x00, 0x00, 0x00, 0x7c, 0x23, 0x41, 0x00, 0xf3, 0x0f, 0x00, 0x00,
+    0xa4, 0x23, 0x41, 0x00, 0x21, 0x1d, 0x1d, 0x1d, 0xac, 0x23, 0x41, 0x00, 0x28, 0x23, 0x1e, 0x1e,
+    0x6c, 0x23, 0x41, 0x00, 0xec, 0x00, 0x00, 0x00, 0x68, 0x23, 0x41, 0x00, 0x06, 0x20, 0x7c, 0x00,
+    0x6c, 0x23, 0x41, 0x00, 0xec, 0x00, 0x00, 0x00, 0xa4, 0x23, 0x41, 0x00, 0x32, 0x2e, 0x2e, 0x2e,
+    0xac, 0x23, 0x41, 0x00, 0x2a, 0x1c, 0x20, 0x20, 0x34, 0x23, 0x41, 0x00, 0x0b, 0x08, 0x0a, 0x04,
+    0x6c, 0x23, 0x41, 0x00, 0xec, 0x00, 0x00, 0x00, 0x7c, 0x23, 0x41, 0x00, 0xd3, 0x0f, 0x00, 0x00,
+    0xa4, 0x23, 0x41, 0x00, 0x21, 0x1d, 0x1d, 0x1d, 0xac, 0x23, 0x41, 0x00, 0x30, 0x2b, 0x26, 0x26,
+    0x09, 0x00, 0x54, 0x00, 0x00, 0x3a, 0x7a, 0x29, 0x09, 0x00, 0x58, 0x00, 0x00, 0x60, 0x6c, 0x22,
+    0x09, 0x00, 0x94, 0x02, 0xe3, 0x03, 0xe1, 0x03, 0x09, 0x00, 0x98, 0x02, 0x00, 0x03, 0x03, 0x03,
+    0x09, 0x00, 0x9c, 0x02, 0x10, 0x1f, 0x1f, 0x2e, 0x09, 0x00, 0x7c, 0x02, 0x27, 0x00, 0x25, 0x00,
+    0x09, 0x00, 0x80, 0x02, 0x24, 0x00, 0x67, 0x00, 0x09, 0x00, 0x84, 0x02, 0x65, 0x00, 0x64, 0x00,
+    0x09, 0x00, 0x88, 0x02, 0xe7, 0x00, 0xe5, 0x00, 0x09, 0x00, 0x8c, 0x02, 0xe4, 0x00, 0xe7, 0x03,
+    0x09, 0x00, 0x90, 0x02, 0xe5, 0x03, 0xe4, 0x03, 0x09, 0x00, 0x3c, 0x00, 0xc5, 0x59, 0xb5, 0x05,
+    0x09, 0x00, 0xa0, 0x02, 0x14, 0x14, 0x1a, 0xdc, 0x00, 0x00, 0xa4, 0x02, 0x7f, 0x47, 0x20, 0x20,
+    0x01, 0x00, 0xa4, 0x02, 0x7f, 0x47, 0x20, 0x20, 0x09, 0x00, 0xa8, 0x02, 0x28, 0xee, 0x0e, 0x00,
+    0x09, 0x00, 0x5c, 0x00, 0xa1, 0x0a, 0xb4, 0x14, 0x09, 0x00, 0x44, 0x00, 0x16, 0x20, 0x55, 0x02,
+    0x0c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0xe5, 0x14, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+#endif // __ONEFIRMWARE_H__
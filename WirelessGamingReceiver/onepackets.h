@@ -0,0 +1,187 @@
+/*
+ MICE Xbox 360 Controller driver for Mac OS X
+ Copyright (C) 2006-2013 Colin Munro
+ 
+ onepackets.h - messages sent to the Xbox One wireless receiver
+ 
+ This file is part of Xbox360Controller.
+ 
+ Xbox360Controller is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+ 
+ Xbox360Controller is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with Foobar; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef __ONEPACKETS_H__
+#define __ONEPACKETS_H__
+
+// Messages are sent as captured, with the addresses of the controller and the
+// receiver stamped in at fixed places. Only include from
+// OneWirelessGamingReceiver.cpp and the host tests, it defines the data.
+
+// Largest message, pooled buffers are this big
+#define ONE_PACKET_MAX              96
+
+// A field patched into a message
+typedef struct OnePatch
+{
+    unsigned int offset;
+    unsigned int length;
+} OnePatch;
+
+// Where a message carries the controller's address and the receiver's, twice
+typedef struct OneAddressing
+{
+    OnePatch controller;
+    OnePatch adapter;
+    OnePatch source;
+} OneAddressing;
+
+static constexpr bool OneFits(const OnePatch &patch, unsigned long size)
+{
+    return patch.offset + patch.length <= size;
+}
+
+static constexpr bool OneFits(const OneAddressing &addressing, unsigned long size)
+{
+    return size <= ONE_PACKET_MAX &&
+           OneFits(addressing.controller, size) &&
+           OneFits(addressing.adapter, size) &&
+           OneFits(addressing.source, size);
+}
+
+// Frames wrapped for the radio (0x0805)
+static constexpr OneAddressing kOneRadio = {{28, 6}, {34, 6}, {40, 6}};
+// Frames carrying controller data (0x0050)
+static constexpr OneAddressing kOneData = {{0x24, 6}, {0x2a, 6}, {0x30, 6}};
+// Pairing request, only the controller is named
+static constexpr OnePatch kOnePairController = {8, 6};
+// Sequence number echoed back in the 6c00c04a reply
+static constexpr OnePatch kOneDataSequence = {0x3e, 1};
+
+// Sent when the receiver's button is pressed, opens it up for pairing
+static constexpr unsigned char kOneButton1[] = {
+    0x04, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static constexpr unsigned char kOneButton2[] = {
+    0x08, 0x00, 0x81, 0x50, 0x14, 0x11, 0x41, 0x00, 0x40, 0x06, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static constexpr unsigned char kOneButton3[] = {
+    0x18, 0x00, 0x82, 0x50, 0x38, 0xc0, 0x41, 0x00, 0x00, 0x00, 0xdd, 0x10, 0x00, 0x50, 0xf2, 0x11,
+    0x01, 0x10, 0x01, 0x9d, 0x28, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static constexpr unsigned char kOneButton4[] = {
+    0x08, 0x00, 0x83, 0x50, 0x14, 0x11, 0x41, 0x00, 0x40, 0x06, 0x3f, 0x64, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Pairing handshake, in order. The first is addressed to the controller
+static constexpr unsigned char kOnePairing1[] = {
+    0x0c, 0x00, 0x8d, 0x50, 0x08, 0x18, 0x41, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+static constexpr unsigned char kOnePairing2[] = {
+    0x0c, 0x00, 0x3e, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+static constexpr unsigned char kOnePairing3[] = {
+    0x3c, 0x00, 0x08, 0x05, 0xa0, 0x00, 0x00, 0x20, 0x01, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x7e, 0xed, 0x8d, 0x5c,
+    0x41, 0xe3, 0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59, 0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59, 0xf0, 0x00,
+    0x00, 0x00, 0x10, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+
+// Replies to messages from a controller being brought up, named after the
+// header they answer
+static constexpr unsigned char kOneReply44000800[] = {
+    0x4c, 0x00, 0x08, 0x05, 0xa8, 0x00, 0x00, 0x20, 0x01, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x7e, 0xed, 0x8d, 0x5c,
+    0x41, 0xe3, 0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59, 0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59, 0x30, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x31, 0xc6, 0x00, 0x00, 0xdd, 0x10,
+    0x00, 0x50, 0xf2, 0x11, 0x02, 0x10, 0x01, 0x2c, 0x99, 0x95, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+static constexpr unsigned char kOneReply5000c04a[] = {
+    0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x20,
+    0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x02, 0x90, 0x00, 0x7e, 0xed, 0x8d, 0x5c, 0x41, 0xe3, 0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59,
+    0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x30, 0x04, 0x01,
+    0x00, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+};
+static constexpr unsigned char kOneReply5c00c04a[] = {
+    0x3c, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x20,
+    0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x02, 0x90, 0x00, 0x7e, 0xed, 0x8d, 0x5c, 0x41, 0xe3, 0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59,
+    0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+static constexpr unsigned char kOneReply7c00c04a[] = {
+    0x48, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x20,
+    0x01, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x02, 0x90, 0x00, 0x7e, 0xed, 0x8d, 0x5c, 0x41, 0xe3, 0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59,
+    0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x01, 0x09,
+    0x00, 0x04, 0x20, 0x3a, 0x00, 0x00, 0x00, 0x9c, 0x00, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+};
+static constexpr unsigned char kOneReply6c00c04a[] = {
+    0x48, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x20,
+    0x01, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x02, 0x90, 0x00, 0x7e, 0xed, 0x8d, 0x5c, 0x41, 0xe3, 0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59,
+    0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x03, 0x09,
+    0x00, 0x04, 0x20, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+};
+static constexpr unsigned char kOneReply4400c04a1[] = {
+    0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x20,
+    0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x02, 0x90, 0x00, 0x7e, 0xed, 0x8d, 0x5c, 0x41, 0xe3, 0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59,
+    0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x02, 0x01,
+    0x00, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+};
+static constexpr unsigned char kOneReply4400c04a2[] = {
+    0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x20,
+    0x01, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x02, 0x90, 0x00, 0x7e, 0xed, 0x8d, 0x5c, 0x41, 0xe3, 0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59,
+    0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x20, 0x03, 0x03,
+    0x00, 0x01, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00,
+};
+static constexpr unsigned char kOneReply4400c04a3[] = {
+    0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x20,
+    0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x02, 0x90, 0x00, 0x7e, 0xed, 0x8d, 0x5c, 0x41, 0xe3, 0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59,
+    0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x30, 0x04, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static constexpr unsigned char kOneReply4c00c04a[] = {
+    0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x20,
+    0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x02, 0x90, 0x00, 0x7e, 0xed, 0x8d, 0x5c, 0x41, 0xe3, 0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59,
+    0x62, 0x45, 0xb4, 0xea, 0x2d, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x30, 0x05, 0x01,
+    0x01, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+};
+
+static_assert(sizeof(kOneButton1) <= ONE_PACKET_MAX, "kOneButton1 doesn't fit a pooled buffer");
+static_assert(sizeof(kOneButton2) <= ONE_PACKET_MAX, "kOneButton2 doesn't fit a pooled buffer");
+static_assert(sizeof(kOneButton3) <= ONE_PACKET_MAX, "kOneButton3 doesn't fit a pooled buffer");
+static_assert(sizeof(kOneButton4) <= ONE_PACKET_MAX, "kOneButton4 doesn't fit a pooled buffer");
+static_assert(OneFits(kOnePairController, sizeof(kOnePairing1)), "kOnePairing1 is too short for its address");
+static_assert(sizeof(kOnePairing2) <= ONE_PACKET_MAX, "kOnePairing2 doesn't fit a pooled buffer");
+static_assert(OneFits(kOneRadio, sizeof(kOnePairing3)), "kOnePairing3 is too short for its addresses");
+static_assert(OneFits(kOneRadio, sizeof(kOneReply44000800)), "kOneReply44000800 is too short for its addresses");
+static_assert(OneFits(kOneData, sizeof(kOneReply5000c04a)), "kOneReply5000c04a is too short for its addresses");
+static_assert(OneFits(kOneData, sizeof(kOneReply5c00c04a)), "kOneReply5c00c04a is too short for its addresses");
+static_assert(OneFits(kOneData, sizeof(kOneReply7c00c04a)), "kOneReply7c00c04a is too short for its addresses");
+static_assert(OneFits(kOneData, sizeof(kOneReply6c00c04a)), "kOneReply6c00c04a is too short for its addresses");
+static_assert(OneFits(kOneDataSequence, sizeof(kOneReply6c00c04a)), "kOneReply6c00c04a is too short for its sequence");
+static_assert(OneFits(kOneData, sizeof(kOneReply4400c04a1)), "kOneReply4400c04a1 is too short for its addresses");
+static_assert(OneFits(kOneData, sizeof(kOneReply4400c04a2)), "kOneReply4400c04a2 is too short for its addresses");
+static_assert(OneFits(kOneData, sizeof(kOneReply4400c04a3)), "kOneReply4400c04a3 is too short for its addresses");
+static_assert(OneFits(kOneData, sizeof(kOneReply4c00c04a)), "kOneReply4c00c04a is too short for its addresses");
+
+#endif // __ONEPACKETS_H__
@@ -0,0 +1,47 @@
+/*
+ MICE Xbox 360 Controller driver for Mac OS X
+ Copyright (C) 2006-2013 Colin Munro
+ 
+ onesignature.h - reading and hashing Xbox One receiver message signatures
+ 
+ This file is part of Xbox360Controller.
+ 
+ Xbox360Controller is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+ 
+ Xbox360Controller is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with Foobar; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef __ONESIGNATURE_H__
+#define __ONESIGNATURE_H__
+
+// The first four bytes of a message, which say what it is
+#define ONE_SIGNATURE(a, b, c, d)   (((unsigned int)(a) << 24) | ((unsigned int)(b) << 16) | ((unsigned int)(c) << 8) | (unsigned int)(d))
+
+// Buckets the requests waiting for a response are hashed into
+#define ONE_TRANSACTION_BUCKETS     8
+#if (ONE_TRANSACTION_BUCKETS & (ONE_TRANSACTION_BUCKETS - 1)) != 0
+#error ONE_TRANSACTION_BUCKETS must be a power of two
+#endif
+
+// Reads a message's signature, the caller checks there are four bytes
+static inline unsigned int OneSignature(const unsigned char *data)
+{
+    return ONE_SIGNATURE(data[0], data[1], data[2], data[3]);
+}
+
+// Folds all four bytes in, as the ones that differ move around between messages
+static inline int OneTransactionBucket(unsigned int signature)
+{
+    return (signature ^ (signature >> 8) ^ (signature >> 16) ^ (signature >> 24)) & (ONE_TRANSACTION_BUCKETS - 1);
+}
+
+#endif // __ONESIGNATURE_H__
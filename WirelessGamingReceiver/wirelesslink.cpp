@@ -0,0 +1,172 @@
+/*
+    MICE Xbox 360 Controller driver for Mac OS X
+    Copyright (C) 2006-2013 Colin Munro
+
+    wirelesslink.cpp - wireless connection state machine
+
+    This file is part of Xbox360Controller.
+
+    Xbox360Controller is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    Xbox360Controller is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Foobar; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+#include "wirelesslink.h"
+
+// Checked in order, the first match wins. A length of 0 matches any length
+static const struct {
+    int length;
+    unsigned char mask0, value0;
+    unsigned char mask1, value1;
+    WirelessLink::PACKET packet;
+} classifiers[] = {
+    { 2, 0xFF, 0x08, 0xFF, 0x00, WirelessLink::pkUnlink },
+    { 2, 0xFF, 0x08, 0x00, 0x00, WirelessLink::pkLink },
+    { 0, 0x00, 0x00, 0xFF, 0x0F, WirelessLink::pkInfo },
+    { 0, 0x00, 0x00, 0xFF, 0x01, WirelessLink::pkHID },
+    { 0, 0x00, 0x00, 0xFF, 0x00, WirelessLink::pkUpdate },
+};
+
+#define Q   WirelessLink::acQueue
+#define C   WirelessLink::acCreate
+#define D   WirelessLink::acDispatch
+#define R   WirelessLink::acRegister
+#define T   (WirelessLink::acTerminate | WirelessLink::acTeardown)
+#define F   WirelessLink::acConfirm
+
+// Indexed by state, then packet
+static const struct {
+    WirelessLink::STATE next;
+    unsigned int actions;
+} transitions[][WirelessLink::pkOther + 1] = {
+    /* lsEmpty */ {
+        /* pkLink */    { WirelessLink::lsLinking,       C },
+        /* pkUnlink */  { WirelessLink::lsEmpty,         WirelessLink::acNone },
+        /* pkInfo */    { WirelessLink::lsInfo,          C | Q | R },
+        /* pkHID */     { WirelessLink::lsLinking,       C | Q },
+        /* pkUpdate */  { WirelessLink::lsLinking,       C | Q },
+        /* pkOther */   { WirelessLink::lsLinking,       C | Q },
+    },
+    /* lsLinking */ {
+        /* pkLink */    { WirelessLink::lsLinking,       WirelessLink::acNone },
+        /* pkUnlink */  { WirelessLink::lsDisconnecting, WirelessLink::acTeardown },
+        /* pkInfo */    { WirelessLink::lsInfo,          Q | R },
+        /* pkHID */     { WirelessLink::lsLinking,       Q },
+        /* pkUpdate */  { WirelessLink::lsLinking,       Q },
+        /* pkOther */   { WirelessLink::lsLinking,       Q },
+    },
+    /* lsKnown */ {
+        /* pkLink */    { WirelessLink::lsKnown,         WirelessLink::acNone },
+        /* pkUnlink */  { WirelessLink::lsDisconnecting, WirelessLink::acTeardown },
+        /* pkInfo */    { WirelessLink::lsInfo,          Q | R },
+        /* pkHID */     { WirelessLink::lsProvisional,   Q | R },
+        /* pkUpdate */  { WirelessLink::lsKnown,         Q },
+        /* pkOther */   { WirelessLink::lsKnown,         Q },
+    },
+    /* lsProvisional */ {
+        /* pkLink */    { WirelessLink::lsProvisional,   WirelessLink::acNone },
+        /* pkUnlink */  { WirelessLink::lsDisconnecting, T },
+        /* pkInfo */    { WirelessLink::lsActive,        F | Q },
+        /* pkHID */     { WirelessLink::lsProvisional,   D },
+        /* pkUpdate */  { WirelessLink::lsProvisional,   Q },
+        /* pkOther */   { WirelessLink::lsProvisional,   Q },
+    },
+    /* lsInfo */ {
+        /* pkLink */    { WirelessLink::lsInfo,          WirelessLink::acNone },
+        /* pkUnlink */  { WirelessLink::lsDisconnecting, T },
+        /* pkInfo */    { WirelessLink::lsInfo,          Q },
+        /* pkHID */     { WirelessLink::lsActive,        D },
+        /* pkUpdate */  { WirelessLink::lsInfo,          Q },
+        /* pkOther */   { WirelessLink::lsInfo,          Q },
+    },
+    /* lsActive */ {
+        /* pkLink */    { WirelessLink::lsActive,        WirelessLink::acNone },
+        /* pkUnlink */  { WirelessLink::lsDisconnecting, T },
+        /* pkInfo */    { WirelessLink::lsActive,        Q },
+        /* pkHID */     { WirelessLink::lsActive,        D },
+        /* pkUpdate */  { WirelessLink::lsActive,        Q },
+        /* pkOther */   { WirelessLink::lsActive,        Q },
+    },
+    /* lsDisconnecting */ {
+        /* pkLink */    { WirelessLink::lsDisconnecting, WirelessLink::acNone },
+        /* pkUnlink */  { WirelessLink::lsDisconnecting, WirelessLink::acNone },
+        /* pkInfo */    { WirelessLink::lsDisconnecting, WirelessLink::acNone },
+        /* pkHID */     { WirelessLink::lsDisconnecting, WirelessLink::acNone },
+        /* pkUpdate */  { WirelessLink::lsDisconnecting, WirelessLink::acNone },
+        /* pkOther */   { WirelessLink::lsDisconnecting, WirelessLink::acNone },
+    },
+};
+
+#undef Q
+#undef C
+#undef D
+#undef R
+#undef T
+#undef F
+
+WirelessLink::PACKET WirelessLink::classify(const unsigned char *data, int length)
+{
+    if (length < 2)
+        return pkOther;
+    for (unsigned int i = 0; i < sizeof(classifiers) / sizeof(classifiers[0]); i++)
+    {
+        if ((classifiers[i].length != 0) && (classifiers[i].length != length))
+            continue;
+        if ((data[0] & classifiers[i].mask0) != classifiers[i].value0)
+            continue;
+        if ((data[1] & classifiers[i].mask1) != classifiers[i].value1)
+            continue;
+        return classifiers[i].packet;
+    }
+    return pkOther;
+}
+
+// Reads the serial number out of an info packet as 8 hex digits
+bool WirelessLink::serialNumber(const unsigned char *data, int length, char *serial, int size)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    int i;
+
+    if ((length < 0x0E) || (size < 9))
+        return false;
+    for (i = 0; i < 4; i++)
+    {
+        serial[(i * 2) + 0] = hex[(data[0x0A + i] & 0xF0) >> 4];
+        serial[(i * 2) + 1] = hex[data[0x0A + i] & 0x0F];
+    }
+    serial[8] = '\0';
+    return true;
+}
+
+// Moves on for a packet and returns the ACTION flags the receiver should carry out
+unsigned int WirelessLink::receive(PACKET packet)
+{
+    unsigned int actions = transitions[state][packet].actions;
+
+    state = transitions[state][packet].next;
+    return actions;
+}
+
+// The receiver restored the identity of the controller last on this
+// connection, so the first report can register it without waiting for the
+// info packet
+void WirelessLink::recognised(void)
+{
+    if (state == lsLinking)
+        state = lsKnown;
+}
+
+// The receiver has finished tearing the device down
+void WirelessLink::disconnected(void)
+{
+    state = lsEmpty;
+}
@@ -0,0 +1,79 @@
+/*
+    MICE Xbox 360 Controller driver for Mac OS X
+    Copyright (C) 2006-2013 Colin Munro
+
+    wirelesslink.h - declaration of the wireless connection state machine
+
+    This file is part of Xbox360Controller.
+
+    Xbox360Controller is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    Xbox360Controller is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Foobar; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+#ifndef __WIRELESSLINK_H__
+#define __WIRELESSLINK_H__
+
+// Tracks one receiver connection from the packets it sees. Packets are
+// sorted by a classifier table and the state table says what the receiver
+// should do with each one; creating services and queueing is left to it.
+class WirelessLink
+{
+public:
+    typedef enum PACKET {
+        pkLink,                 // 08 xx, a controller linked
+        pkUnlink,               // 08 00, the controller went away
+        pkInfo,                 // xx 0f, device info including the serial number
+        pkHID,                  // xx 01, input report
+        pkUpdate,               // xx 00, battery and other status
+        pkOther,
+    } PACKET;
+
+    typedef enum STATE {
+        lsEmpty,
+        lsLinking,              // Device node exists, waiting for its info
+        lsKnown,                // Same, but the connection's last controller is cached
+        lsProvisional,          // Registered as the cached controller, waiting for its info to confirm it
+        lsInfo,                 // Registered, waiting for the first report
+        lsActive,
+        lsDisconnecting,
+    } STATE;
+
+    typedef enum ACTION {
+        acNone      = 0,
+        acCreate    = 1 << 0,   // Create the device node
+        acQueue     = 1 << 1,   // Queue the packet for the device
+        acDispatch  = 1 << 2,   // Hand the packet to the device, queue it if that's not possible
+        acRegister  = 1 << 3,   // Register the device node so the HID driver matches
+        acTerminate = 1 << 4,   // Terminate the registered HID driver
+        acTeardown  = 1 << 5,   // Detach and release the device node
+        acConfirm   = 1 << 6,   // Check the info packet is from the controller it was registered as
+    } ACTION;
+
+    WirelessLink() { reset(); }
+
+    static PACKET classify(const unsigned char *data, int length);
+    static bool serialNumber(const unsigned char *data, int length, char *serial, int size);
+
+    void reset(void) { state = lsEmpty; }
+    unsigned int receive(PACKET packet);
+    void recognised(void);
+    void disconnected(void);
+
+    STATE getState(void) const { return state; }
+    bool isRegistered(void) const { return (state == lsProvisional) || (state == lsInfo) || (state == lsActive); }
+
+private:
+    STATE state;
+};
+
+#endif // __WIRELESSLINK_H__
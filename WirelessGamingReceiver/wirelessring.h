@@ -0,0 +1,175 @@
+/*
+    MICE Xbox 360 Controller driver for Mac OS X
+    Copyright (C) 2006-2013 Colin Munro
+
+    wirelessring.h - per-connection packet queue of the wireless receiver
+
+    This file is part of Xbox360Controller.
+
+    Xbox360Controller is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    Xbox360Controller is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Foobar; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+#ifndef __WIRELESSRING_H__
+#define __WIRELESSRING_H__
+
+// Only needs UInt32, SInt32, memcpy and OSCompareAndSwap, so it builds on
+// the host as well as in the kernel
+
+// Largest packet a controller sends
+#define WIRELESS_PACKET_SIZE        32
+
+// Packets buffered for each controller, must be a power of two
+#define WIRELESS_RING_SIZE          16
+#if (WIRELESS_RING_SIZE & (WIRELESS_RING_SIZE - 1)) != 0
+#error WIRELESS_RING_SIZE must be a power of two
+#endif
+
+// Input reports and everything else are queued apart, so that a full queue
+// can give up status packets before reports
+#define WIRELESS_RING_HID           0
+#define WIRELESS_RING_OTHER         1
+#define WIRELESS_RINGS              2
+
+// Holds a packet waiting for the controller
+typedef struct WGRPACKET
+{
+    UInt32 sequence;                        // Order across both rings
+    int length;
+    unsigned char data[WIRELESS_PACKET_SIZE];
+} WGRPACKET;
+
+// Single producer, single consumer queue of packets
+typedef struct WGRRING
+{
+    WGRPACKET slots[WIRELESS_RING_SIZE];
+    volatile UInt32 head, tail;             // Free running, the slot is the count modulo the ring size
+} WGRRING;
+
+// Everything queued for one controller
+typedef struct WGRQUEUE
+{
+    WGRRING rings[WIRELESS_RINGS];          // Together they hold at most WIRELESS_RING_SIZE packets
+    UInt32 sequence;
+} WGRQUEUE;
+
+static inline UInt32 WirelessRingCount(const WGRRING *ring)
+{
+    return ring->tail - ring->head;
+}
+
+static inline void WirelessQueueInit(WGRQUEUE *queue)
+{
+    for (int i = 0; i < WIRELESS_RINGS; i++)
+    {
+        queue->rings[i].head = 0;
+        queue->rings[i].tail = 0;
+    }
+    queue->sequence = 0;
+}
+
+// Empties the queue, only the writer may do this
+static inline void WirelessQueueReset(WGRQUEUE *queue)
+{
+    for (int i = 0; i < WIRELESS_RINGS; i++)
+        queue->rings[i].head = queue->rings[i].tail;
+}
+
+static inline bool WirelessQueueEmpty(const WGRQUEUE *queue)
+{
+    for (int i = 0; i < WIRELESS_RINGS; i++)
+    {
+        if (WirelessRingCount(&queue->rings[i]) != 0)
+            return false;
+    }
+    return true;
+}
+
+// Adds a packet, returning false if it can't be queued at all
+// Only the writer adds packets. When the queue is full the oldest status
+// packet is dropped, and only if there are none the oldest report, so a
+// stalled reader still sees the most recent state once it catches up.
+// dropped counts what each ring gave up.
+static inline bool WirelessQueuePush(WGRQUEUE *queue, const unsigned char *data, int length, int dropped[WIRELESS_RINGS])
+{
+    WGRRING *hid = &queue->rings[WIRELESS_RING_HID];
+    WGRRING *other = &queue->rings[WIRELESS_RING_OTHER];
+    WGRRING *ring, *victim;
+    WGRPACKET *slot;
+    UInt32 head, tail;
+
+    if ((length < 2) || (length > WIRELESS_PACKET_SIZE))
+        return false;
+    while ((WirelessRingCount(hid) + WirelessRingCount(other)) >= WIRELESS_RING_SIZE)
+    {
+        victim = (WirelessRingCount(other) != 0) ? other : hid;
+        head = victim->head;
+        // If the reader takes it first there's room anyway
+        if ((head != victim->tail) && OSCompareAndSwap(head, head + 1, &victim->head))
+            dropped[(victim == hid) ? WIRELESS_RING_HID : WIRELESS_RING_OTHER]++;
+    }
+
+    ring = (data[1] == 0x01) ? hid : other;
+    tail = ring->tail;
+    slot = &ring->slots[tail & (WIRELESS_RING_SIZE - 1)];
+    memcpy(slot->data, data, length);
+    slot->length = length;
+    slot->sequence = queue->sequence++;
+    // Barrier, so the reader never sees the slot before its contents
+    OSCompareAndSwap(tail, tail + 1, &ring->tail);
+    return true;
+}
+
+// Takes the oldest packet, length is the buffer size on entry
+// Copies first, then claims the slot. If the writer dropped it meanwhile the
+// copy may be torn, so it tries again with the new oldest packet.
+static inline bool WirelessQueuePop(WGRQUEUE *queue, void *data, int *length)
+{
+    WGRRING *ring;
+    WGRPACKET *slot, *first;
+    UInt32 head, firstHead;
+    int size;
+
+    do
+    {
+        // Whichever ring holds the older packet goes first
+        ring = NULL;
+        first = NULL;
+        firstHead = 0;
+        for (int i = 0; i < WIRELESS_RINGS; i++)
+        {
+            head = queue->rings[i].head;
+            if (head == queue->rings[i].tail)
+                continue;
+            slot = &queue->rings[i].slots[head & (WIRELESS_RING_SIZE - 1)];
+            if ((first == NULL) || ((SInt32)(slot->sequence - first->sequence) < 0))
+            {
+                ring = &queue->rings[i];
+                first = slot;
+                firstHead = head;
+            }
+        }
+        if (ring == NULL)
+            return false;
+        size = first->length;
+        if (size > *length)
+            size = *length;
+        memcpy(data, first->data, size);
+    }
+    while (!OSCompareAndSwap(firstHead, firstHead + 1, &ring->head));
+
+    *length = size;
+    return true;
+}
+
+#endif // __WIRELESSRING_H__
@@ -0,0 +1,42 @@
+/*
+    MICE Xbox 360 Controller driver for Mac OS X
+    Copyright (C) 2006-2013 Colin Munro
+
+    wirelessslot.h - location IDs for controllers with a system-wide slot
+
+    This file is part of Xbox360Controller.
+
+    Xbox360Controller is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    Xbox360Controller is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Foobar; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+#ifndef __WIRELESSSLOT_H__
+#define __WIRELESSSLOT_H__
+
+// Controllers across all receivers that get their own location ID
+#define WIRELESS_SLOTS              16
+
+// The slot goes in the low four bits, with bit 4 set to mark it
+#if WIRELESS_SLOTS > 16
+#error WIRELESS_SLOTS must fit in the low four bits of a location ID
+#endif
+
+// The receiver's location ID with the low five bits taken by the slot, so
+// pads on different receivers never share an ID even if the receivers' IDs
+// are close together
+static inline unsigned int WirelessSlotLocation(unsigned int owner, int slot)
+{
+    return (owner & ~0x1FU) | 0x10 | (unsigned int)slot;
+}
+
+#endif // __WIRELESSSLOT_H__